@@ -0,0 +1,178 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/copy_engine_helper.cmake"
+  "/root/repo/libs/mdlconvlib/CMakeLists.txt"
+  "/root/repo/libs/sge_audio/CMakeLists.txt"
+  "/root/repo/libs/sge_core/CMakeLists.txt"
+  "/root/repo/libs/sge_engine/CMakeLists.txt"
+  "/root/repo/libs/sge_renderer/CMakeLists.txt"
+  "/root/repo/libs/sge_utils/CMakeLists.txt"
+  "/root/repo/libs_ext/HLSLParser/CMakeLists.txt"
+  "/root/repo/libs_ext/SDL2/CMakeLists.txt"
+  "/root/repo/libs_ext/SDL2/SDL2.spec.in"
+  "/root/repo/libs_ext/SDL2/cmake/macros.cmake"
+  "/root/repo/libs_ext/SDL2/cmake/sdlchecks.cmake"
+  "/root/repo/libs_ext/SDL2/include/SDL_config.h.cmake"
+  "/root/repo/libs_ext/SDL2/sdl2-config.in"
+  "/root/repo/libs_ext/SDL2/sdl2.pc.in"
+  "/root/repo/libs_ext/bullet/CMakeLists.txt"
+  "/root/repo/libs_ext/bullet/bullet3/BulletConfig.cmake.in"
+  "/root/repo/libs_ext/bullet/bullet3/CMakeLists.txt"
+  "/root/repo/libs_ext/bullet/bullet3/src/Bullet3Common/CMakeLists.txt"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CMakeLists.txt"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/CMakeLists.txt"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletInverseDynamics/CMakeLists.txt"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeLists.txt"
+  "/root/repo/libs_ext/bullet/bullet3/src/CMakeLists.txt"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/CMakeLists.txt"
+  "/root/repo/libs_ext/doctest/CMakeLists.txt"
+  "/root/repo/libs_ext/doctest/doctest/CMakeLists.txt"
+  "/root/repo/libs_ext/doctest/doctest/scripts/cmake/Config.cmake.in"
+  "/root/repo/libs_ext/imgui/CMakeLists.txt"
+  "/root/repo/libs_ext/mcpp/CMakeLists.txt"
+  "/root/repo/libs_ext/recastnavigation/CMakeLists.txt"
+  "/root/repo/samples/CharacterGame/CMakeLists.txt"
+  "/root/repo/samples/Demo/CMakeLists.txt"
+  "/root/repo/samples/SpriteGame2D/CMakeLists.txt"
+  "/root/repo/samples/TemplateGame/CMakeLists.txt"
+  "/root/repo/scripts/cmake/macros.cmake"
+  "/root/repo/sge_editor/CMakeLists.txt"
+  "/root/repo/sge_player/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenGL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/mcpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/HLSLParser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/bullet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/bullet/bullet3/BulletConfig.cmake"
+  "libs_ext/bullet/bullet3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/bullet/bullet3/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/bullet/bullet3/src/BulletInverseDynamics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/bullet/bullet3/src/Bullet3Common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/recastnavigation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/imgui/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/doctest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/doctest/doctest/generated/doctestConfigVersion.cmake"
+  "libs_ext/doctest/doctest/generated/doctestConfig.cmake"
+  "libs_ext/doctest/doctest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs_ext/SDL2/include/SDL_config.h"
+  "libs_ext/SDL2/sdl2.pc"
+  "libs_ext/SDL2/sdl2-config"
+  "libs_ext/SDL2/sdl2-config"
+  "libs_ext/SDL2/SDL2.spec"
+  "libs_ext/SDL2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/sge_utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/sge_renderer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/sge_audio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/sge_core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/sge_engine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "sge_player/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "sge_editor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/mdlconvlib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/Demo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/TemplateGame/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/CharacterGame/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/SpriteGame2D/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "libs_ext/mcpp/CMakeFiles/mcpp.dir/DependInfo.cmake"
+  "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/DependInfo.cmake"
+  "libs_ext/bullet/bullet3/src/BulletInverseDynamics/CMakeFiles/BulletInverseDynamics.dir/DependInfo.cmake"
+  "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/DependInfo.cmake"
+  "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/DependInfo.cmake"
+  "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/DependInfo.cmake"
+  "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/DependInfo.cmake"
+  "libs_ext/bullet/bullet3/src/Bullet3Common/CMakeFiles/Bullet3Common.dir/DependInfo.cmake"
+  "libs_ext/recastnavigation/CMakeFiles/Recast.dir/DependInfo.cmake"
+  "libs_ext/recastnavigation/CMakeFiles/Detour.dir/DependInfo.cmake"
+  "libs_ext/imgui/CMakeFiles/imgui.dir/DependInfo.cmake"
+  "libs_ext/SDL2/CMakeFiles/SDL2main.dir/DependInfo.cmake"
+  "libs_ext/SDL2/CMakeFiles/SDL2.dir/DependInfo.cmake"
+  "libs/sge_utils/CMakeFiles/sge_utils.dir/DependInfo.cmake"
+  "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/DependInfo.cmake"
+  "libs/sge_renderer/CMakeFiles/sge_renderer.dir/DependInfo.cmake"
+  "libs/sge_audio/CMakeFiles/sge_audio.dir/DependInfo.cmake"
+  "libs/sge_core/CMakeFiles/sge_core.dir/DependInfo.cmake"
+  "libs/sge_core/CMakeFiles/sge_core_Tests.dir/DependInfo.cmake"
+  "libs/sge_engine/CMakeFiles/sge_engine.dir/DependInfo.cmake"
+  "libs/sge_engine/CMakeFiles/sge_engine_Tests.dir/DependInfo.cmake"
+  "sge_player/CMakeFiles/sge_player.dir/DependInfo.cmake"
+  "sge_editor/CMakeFiles/sge_editor.dir/DependInfo.cmake"
+  "samples/Demo/CMakeFiles/Demo.dir/DependInfo.cmake"
+  "samples/Demo/CMakeFiles/Demo_AssembleAndDebug.dir/DependInfo.cmake"
+  "samples/TemplateGame/CMakeFiles/TemplateGame.dir/DependInfo.cmake"
+  "samples/TemplateGame/CMakeFiles/TemplateGame_AssembleAndDebug.dir/DependInfo.cmake"
+  "samples/CharacterGame/CMakeFiles/CharacterGame.dir/DependInfo.cmake"
+  "samples/CharacterGame/CMakeFiles/CharacterGame_AssembleAndDebug.dir/DependInfo.cmake"
+  "samples/SpriteGame2D/CMakeFiles/SpriteGame2D.dir/DependInfo.cmake"
+  "samples/SpriteGame2D/CMakeFiles/SpriteGame2D_AssembleAndDebug.dir/DependInfo.cmake"
+  )
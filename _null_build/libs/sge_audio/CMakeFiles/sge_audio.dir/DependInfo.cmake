@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/sge_audio/src/sge_audio/AudioDecoder.cpp" "libs/sge_audio/CMakeFiles/sge_audio.dir/src/sge_audio/AudioDecoder.cpp.o" "gcc" "libs/sge_audio/CMakeFiles/sge_audio.dir/src/sge_audio/AudioDecoder.cpp.o.d"
+  "/root/repo/libs/sge_audio/src/sge_audio/AudioDevice.cpp" "libs/sge_audio/CMakeFiles/sge_audio.dir/src/sge_audio/AudioDevice.cpp.o" "gcc" "libs/sge_audio/CMakeFiles/sge_audio.dir/src/sge_audio/AudioDevice.cpp.o.d"
+  "/root/repo/libs/sge_audio/src/sge_audio/AudioDeviceSdl.cpp" "libs/sge_audio/CMakeFiles/sge_audio.dir/src/sge_audio/AudioDeviceSdl.cpp.o" "gcc" "libs/sge_audio/CMakeFiles/sge_audio.dir/src/sge_audio/AudioDeviceSdl.cpp.o.d"
+  "/root/repo/libs/sge_audio/src/sge_audio/AudioTrack.cpp" "libs/sge_audio/CMakeFiles/sge_audio.dir/src/sge_audio/AudioTrack.cpp.o" "gcc" "libs/sge_audio/CMakeFiles/sge_audio.dir/src/sge_audio/AudioTrack.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/libs/sge_utils/CMakeFiles/sge_utils.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/SDL2/CMakeFiles/SDL2main.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/SDL2/CMakeFiles/SDL2.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sge_audio.dir/src/sge_audio/AudioDecoder.cpp.o"
+  "CMakeFiles/sge_audio.dir/src/sge_audio/AudioDecoder.cpp.o.d"
+  "CMakeFiles/sge_audio.dir/src/sge_audio/AudioDevice.cpp.o"
+  "CMakeFiles/sge_audio.dir/src/sge_audio/AudioDevice.cpp.o.d"
+  "CMakeFiles/sge_audio.dir/src/sge_audio/AudioDeviceSdl.cpp.o"
+  "CMakeFiles/sge_audio.dir/src/sge_audio/AudioDeviceSdl.cpp.o.d"
+  "CMakeFiles/sge_audio.dir/src/sge_audio/AudioTrack.cpp.o"
+  "CMakeFiles/sge_audio.dir/src/sge_audio/AudioTrack.cpp.o.d"
+  "libsge_audio.a"
+  "libsge_audio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sge_audio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
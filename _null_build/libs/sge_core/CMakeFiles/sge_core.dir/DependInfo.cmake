@@ -0,0 +1,70 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/sge_core/src/sge_core/AnimationLod.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/AnimationLod.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/AnimationLod.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/AnimationSystem.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/AnimationSystem.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/AnimationSystem.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/Animator.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/Animator.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/Animator.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/AssetLibrary.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/AssetLibrary.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/AssetLibrary.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/CoreLog.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/CoreLog.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/CoreLog.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/DebugDraw.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/DebugDraw.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/DebugDraw.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/GameUI/Layout.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/GameUI/Layout.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/GameUI/Layout.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/GameUI/UIContext.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/GameUI/UIContext.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/GameUI/UIContext.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/GameUI/Widget.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/GameUI/Widget.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/GameUI/Widget.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/GeomGen.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/GeomGen.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/GeomGen.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/Gizmo3D.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/Gizmo3D.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/Gizmo3D.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/ICore.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/ICore.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/ICore.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/InstanceBatcher.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/InstanceBatcher.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/InstanceBatcher.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/LightClusters.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/LightClusters.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/LightClusters.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/QuickDraw.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/QuickDraw.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/QuickDraw.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/RenderQueue.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/RenderQueue.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/RenderQueue.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/SGEImGui.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/SGEImGui.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/SGEImGui.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/ShadowCacheInvalidator.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/ShadowCacheInvalidator.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/ShadowCacheInvalidator.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/Sprite.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/Sprite.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/Sprite.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/TextureStreamingManager.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/TextureStreamingManager.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/TextureStreamingManager.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/TextureStreamingPolicy.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/TextureStreamingPolicy.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/TextureStreamingPolicy.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/application/application.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/application/application.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/application/application.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/application/input.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/application/input.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/application/input.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/dds/dds.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/dds/dds.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/dds/dds.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/AnimationCompressor.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/AnimationCompressor.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/AnimationCompressor.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/AnimationPose.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/AnimationPose.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/AnimationPose.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/AnimationRetarget.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/AnimationRetarget.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/AnimationRetarget.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/CpuSkinning.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/CpuSkinning.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/CpuSkinning.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/EvaluatedModel.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/EvaluatedModel.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/EvaluatedModel.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/MeshOptimizer.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/MeshOptimizer.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/MeshOptimizer.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/MeshQuantizer.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/MeshQuantizer.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/MeshQuantizer.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/MeshSimplifier.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/MeshSimplifier.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/MeshSimplifier.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/Model.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/Model.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/Model.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/ModelReader.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/ModelReader.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/ModelReader.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/ModelWriter.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/ModelWriter.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/ModelWriter.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/Parameter.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/Parameter.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/Parameter.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/model/SharedEvaluatedModelCache.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/SharedEvaluatedModelCache.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/model/SharedEvaluatedModelCache.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/setImGuiContexCore.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/setImGuiContexCore.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/setImGuiContexCore.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/shaders/ConstantColorShader.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/shaders/ConstantColorShader.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/shaders/ConstantColorShader.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/shaders/ShadingProgramPermuator.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/shaders/ShadingProgramPermuator.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/shaders/ShadingProgramPermuator.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/shaders/SkyShader.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/shaders/SkyShader.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/shaders/SkyShader.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/shaders/modeldraw.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/shaders/modeldraw.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/shaders/modeldraw.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/stb_implement.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/stb_implement.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/stb_implement.cpp.o.d"
+  "/root/repo/libs/sge_core/src/sge_core/ui/MultiCurve2DEditor.cpp" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/ui/MultiCurve2DEditor.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core.dir/src/sge_core/ui/MultiCurve2DEditor.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/libs/sge_renderer/CMakeFiles/sge_renderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_audio/CMakeFiles/sge_audio.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/imgui/CMakeFiles/imgui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/SDL2/CMakeFiles/SDL2main.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/SDL2/CMakeFiles/SDL2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/mcpp/CMakeFiles/mcpp.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_utils/CMakeFiles/sge_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
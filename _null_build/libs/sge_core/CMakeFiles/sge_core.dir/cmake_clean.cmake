@@ -0,0 +1,97 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sge_core.dir/src/sge_core/AnimationLod.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/AnimationLod.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/AnimationSystem.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/AnimationSystem.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/Animator.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/Animator.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/AssetLibrary.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/AssetLibrary.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/CoreLog.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/CoreLog.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/DebugDraw.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/DebugDraw.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/GameUI/Layout.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/GameUI/Layout.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/GameUI/UIContext.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/GameUI/UIContext.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/GameUI/Widget.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/GameUI/Widget.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/GeomGen.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/GeomGen.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/Gizmo3D.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/Gizmo3D.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/ICore.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/ICore.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/InstanceBatcher.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/InstanceBatcher.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/LightClusters.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/LightClusters.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/QuickDraw.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/QuickDraw.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/RenderQueue.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/RenderQueue.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/SGEImGui.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/SGEImGui.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/ShadowCacheInvalidator.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/ShadowCacheInvalidator.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/Sprite.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/Sprite.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/TextureStreamingManager.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/TextureStreamingManager.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/TextureStreamingPolicy.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/TextureStreamingPolicy.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/application/application.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/application/application.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/application/input.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/application/input.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/dds/dds.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/dds/dds.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/AnimationCompressor.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/AnimationCompressor.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/AnimationPose.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/AnimationPose.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/AnimationRetarget.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/AnimationRetarget.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/CpuSkinning.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/CpuSkinning.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/EvaluatedModel.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/EvaluatedModel.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/MeshOptimizer.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/MeshOptimizer.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/MeshQuantizer.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/MeshQuantizer.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/MeshSimplifier.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/MeshSimplifier.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/Model.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/Model.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/ModelReader.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/ModelReader.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/ModelWriter.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/ModelWriter.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/Parameter.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/Parameter.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/SharedEvaluatedModelCache.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/model/SharedEvaluatedModelCache.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/setImGuiContexCore.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/setImGuiContexCore.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/shaders/ConstantColorShader.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/shaders/ConstantColorShader.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/shaders/ShadingProgramPermuator.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/shaders/ShadingProgramPermuator.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/shaders/SkyShader.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/shaders/SkyShader.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/shaders/modeldraw.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/shaders/modeldraw.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/stb_implement.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/stb_implement.cpp.o.d"
+  "CMakeFiles/sge_core.dir/src/sge_core/ui/MultiCurve2DEditor.cpp.o"
+  "CMakeFiles/sge_core.dir/src/sge_core/ui/MultiCurve2DEditor.cpp.o.d"
+  "libsge_core.pdb"
+  "libsge_core.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sge_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/sge_core/tests/AllocationCounter.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AllocationCounter.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AllocationCounter.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/AnimationCompressor.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AnimationCompressor.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AnimationCompressor.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/AnimationLod.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AnimationLod.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AnimationLod.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/AnimationPose.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AnimationPose.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AnimationPose.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/AnimationRetarget.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AnimationRetarget.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AnimationRetarget.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/AnimationSystem.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AnimationSystem.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/AnimationSystem.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/Animator.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/Animator.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/Animator.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/CpuSkinning.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/CpuSkinning.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/CpuSkinning.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/EvaluatedModel.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/EvaluatedModel.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/EvaluatedModel.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/GLContextStateCache.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/GLContextStateCache.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/GLContextStateCache.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/InstanceBatcher.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/InstanceBatcher.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/InstanceBatcher.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/KeyFrames.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/KeyFrames.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/KeyFrames.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/LightClusters.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/LightClusters.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/LightClusters.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/MeshOptimizer.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/MeshOptimizer.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/MeshOptimizer.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/MeshQuantizer.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/MeshQuantizer.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/MeshQuantizer.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/MeshSimplifier.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/MeshSimplifier.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/MeshSimplifier.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/ModelFileV2.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/ModelFileV2.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/ModelFileV2.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/NullDevice.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/NullDevice.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/NullDevice.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/RecordingContext.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/RecordingContext.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/RecordingContext.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/RenderQueue.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/RenderQueue.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/RenderQueue.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/SgeCoreTestMain.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/SgeCoreTestMain.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/SgeCoreTestMain.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/ShadowCacheInvalidator.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/ShadowCacheInvalidator.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/ShadowCacheInvalidator.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/SharedEvaluatedModelCache.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/SharedEvaluatedModelCache.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/SharedEvaluatedModelCache.Test.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/TestModels.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/TestModels.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/TestModels.cpp.o.d"
+  "/root/repo/libs/sge_core/tests/TextureStreamingPolicy.Test.cpp" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/TextureStreamingPolicy.Test.cpp.o" "gcc" "libs/sge_core/CMakeFiles/sge_core_Tests.dir/tests/TextureStreamingPolicy.Test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/libs/sge_core/CMakeFiles/sge_core.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_renderer/CMakeFiles/sge_renderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/mcpp/CMakeFiles/mcpp.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_audio/CMakeFiles/sge_audio.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_utils/CMakeFiles/sge_utils.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/imgui/CMakeFiles/imgui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/SDL2/CMakeFiles/SDL2main.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/SDL2/CMakeFiles/SDL2.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
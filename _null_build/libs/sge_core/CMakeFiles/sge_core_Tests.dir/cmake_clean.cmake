@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sge_core_Tests.dir/tests/AllocationCounter.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/AllocationCounter.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/AnimationCompressor.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/AnimationCompressor.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/AnimationLod.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/AnimationLod.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/AnimationPose.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/AnimationPose.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/AnimationRetarget.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/AnimationRetarget.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/AnimationSystem.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/AnimationSystem.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/Animator.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/Animator.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/CpuSkinning.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/CpuSkinning.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/EvaluatedModel.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/EvaluatedModel.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/GLContextStateCache.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/GLContextStateCache.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/InstanceBatcher.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/InstanceBatcher.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/KeyFrames.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/KeyFrames.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/LightClusters.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/LightClusters.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/MeshOptimizer.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/MeshOptimizer.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/MeshQuantizer.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/MeshQuantizer.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/MeshSimplifier.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/MeshSimplifier.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/ModelFileV2.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/ModelFileV2.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/NullDevice.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/NullDevice.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/RecordingContext.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/RecordingContext.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/RenderQueue.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/RenderQueue.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/SgeCoreTestMain.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/SgeCoreTestMain.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/ShadowCacheInvalidator.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/ShadowCacheInvalidator.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/SharedEvaluatedModelCache.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/SharedEvaluatedModelCache.Test.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/TestModels.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/TestModels.cpp.o.d"
+  "CMakeFiles/sge_core_Tests.dir/tests/TextureStreamingPolicy.Test.cpp.o"
+  "CMakeFiles/sge_core_Tests.dir/tests/TextureStreamingPolicy.Test.cpp.o.d"
+  "sge_core_Tests"
+  "sge_core_Tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sge_core_Tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,116 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/sge_engine/src/sge_engine/Actor.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/Actor.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/Actor.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/ActorsSpatialIndex.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/ActorsSpatialIndex.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/ActorsSpatialIndex.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/AssetProperty.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/AssetProperty.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/AssetProperty.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/Camera.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/Camera.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/Camera.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/DefaultGameDrawer.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/DefaultGameDrawer.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/DefaultGameDrawer.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/DynamicProperties.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/DynamicProperties.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/DynamicProperties.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/EditMode.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/EditMode.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/EditMode.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/EngineGlobal.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/EngineGlobal.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/EngineGlobal.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/GameDrawer.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameDrawer.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameDrawer.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/GameExport.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameExport.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameExport.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/GameInspector.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameInspector.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameInspector.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/GameObject.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameObject.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameObject.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/GamePlayerSettings.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GamePlayerSettings.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GamePlayerSettings.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/GameSerialization.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameSerialization.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameSerialization.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/GameWorld.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameWorld.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/GameWorld.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/IPlugin.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/IPlugin.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/IPlugin.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/IWorldScript.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/IWorldScript.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/IWorldScript.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/InspectorCmd.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/InspectorCmd.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/InspectorCmd.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/InspectorTool.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/InspectorTool.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/InspectorTool.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/Physics.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/Physics.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/Physics.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/PhysicsDebugDraw.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/PhysicsDebugDraw.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/PhysicsDebugDraw.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/PhysicsHelpers.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/PhysicsHelpers.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/PhysicsHelpers.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/PlantingTool.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/PlantingTool.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/PlantingTool.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/RigidBodyEditorConfig.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/RigidBodyEditorConfig.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/RigidBodyEditorConfig.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/RigidBodyFromModel.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/RigidBodyFromModel.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/RigidBodyFromModel.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/SceneInstance.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/SceneInstance.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/SceneInstance.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/ScriptObject.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/ScriptObject.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/ScriptObject.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/SelectionTool.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/SelectionTool.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/SelectionTool.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/TerrainGenerator.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/TerrainGenerator.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/TerrainGenerator.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/TexturedPlaneDraw.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/TexturedPlaneDraw.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/TexturedPlaneDraw.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/TransformTool.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/TransformTool.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/TransformTool.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/TypeRegister.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/TypeRegister.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/TypeRegister.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/TypeRegisterRegisterCommonTypes.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/TypeRegisterRegisterCommonTypes.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/TypeRegisterRegisterCommonTypes.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/UIAssetPicker.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/UIAssetPicker.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/UIAssetPicker.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ABackgroundMusic.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ABackgroundMusic.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ABackgroundMusic.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ABlockingObstacle.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ABlockingObstacle.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ABlockingObstacle.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ACRSpline.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ACRSpline.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ACRSpline.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ACamera.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ACamera.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ACamera.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ADynamicObstacle.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ADynamicObstacle.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ADynamicObstacle.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/AInfinitePlaneObstacle.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/AInfinitePlaneObstacle.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/AInfinitePlaneObstacle.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/AInvisibleRigidObstacle.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/AInvisibleRigidObstacle.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/AInvisibleRigidObstacle.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ALight.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALight.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALight.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ALine.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALine.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALine.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ALocator.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALocator.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALocator.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ANavMesh.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ANavMesh.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ANavMesh.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ANavMesh_btCollisionShapeToTriangles.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ANavMesh_btCollisionShapeToTriangles.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ANavMesh_btCollisionShapeToTriangles.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/AParticles.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/AParticles.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/AParticles.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ASky.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ASky.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ASky.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/AStaticObstacle.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/AStaticObstacle.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/AStaticObstacle.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/ATimeline.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ATimeline.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/ATimeline.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/actors/IKNode.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/IKNode.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/actors/IKNode.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/behaviours/CharacterController.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/behaviours/CharacterController.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/behaviours/CharacterController.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/enums2d.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/enums2d.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/enums2d.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/materials/Material.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/materials/Material.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/materials/Material.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/setImGuiContextEngine.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/setImGuiContextEngine.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/setImGuiContextEngine.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitActorList.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitActorList.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitActorList.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitCharacterController.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitCharacterController.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitCharacterController.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitModel.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitModel.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitModel.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitMultiModel.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitMultiModel.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitMultiModel.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitParticles.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitParticles.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitParticles.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitPath.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitPath.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitPath.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitRenderable.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRenderable.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRenderable.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitRenderableGeom.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRenderableGeom.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRenderableGeom.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitRigidBody.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRigidBody.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRigidBody.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitScriptSlot.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitScriptSlot.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitScriptSlot.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitTexturedPlane.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitTexturedPlane.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitTexturedPlane.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/traits/TraitViewportIcon.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitViewportIcon.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitViewportIcon.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/typelibHelper.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/typelibHelper.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/typelibHelper.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/ActorCreateWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/ActorCreateWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/ActorCreateWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/AssetsWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/AssetsWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/AssetsWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/CreditsWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/CreditsWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/CreditsWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/EditorWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/EditorWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/EditorWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/GameInspectorWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/GameInspectorWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/GameInspectorWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/GamePlayWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/GamePlayWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/GamePlayWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/HelpWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/HelpWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/HelpWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/InfoWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/InfoWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/InfoWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/LogWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/LogWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/LogWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/ModelPreviewWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/ModelPreviewWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/ModelPreviewWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/OutlinerWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/OutlinerWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/OutlinerWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/PrefabWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/PrefabWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/PrefabWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/ProjectSettingsWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/ProjectSettingsWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/ProjectSettingsWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/PropertyEditorWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/PropertyEditorWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/PropertyEditorWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/SceneWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/SceneWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/SceneWindow.cpp.o.d"
+  "/root/repo/libs/sge_engine/src/sge_engine/windows/WorldSettingsWindow.cpp" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/WorldSettingsWindow.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine.dir/src/sge_engine/windows/WorldSettingsWindow.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/libs/sge_core/CMakeFiles/sge_core.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/recastnavigation/CMakeFiles/Recast.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/recastnavigation/CMakeFiles/Detour.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_renderer/CMakeFiles/sge_renderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/mcpp/CMakeFiles/mcpp.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_audio/CMakeFiles/sge_audio.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_utils/CMakeFiles/sge_utils.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/imgui/CMakeFiles/imgui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/SDL2/CMakeFiles/SDL2main.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/SDL2/CMakeFiles/SDL2.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
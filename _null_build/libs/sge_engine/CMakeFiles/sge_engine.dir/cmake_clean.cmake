@@ -0,0 +1,177 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sge_engine.dir/src/sge_engine/Actor.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/Actor.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/ActorsSpatialIndex.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/ActorsSpatialIndex.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/AssetProperty.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/AssetProperty.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/Camera.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/Camera.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/DefaultGameDrawer.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/DefaultGameDrawer.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/DynamicProperties.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/DynamicProperties.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/EditMode.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/EditMode.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/EngineGlobal.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/EngineGlobal.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameDrawer.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameDrawer.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameExport.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameExport.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameInspector.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameInspector.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameObject.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameObject.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GamePlayerSettings.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GamePlayerSettings.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameSerialization.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameSerialization.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameWorld.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/GameWorld.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/IPlugin.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/IPlugin.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/IWorldScript.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/IWorldScript.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/InspectorCmd.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/InspectorCmd.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/InspectorTool.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/InspectorTool.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/Physics.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/Physics.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/PhysicsDebugDraw.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/PhysicsDebugDraw.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/PhysicsHelpers.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/PhysicsHelpers.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/PlantingTool.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/PlantingTool.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/RigidBodyEditorConfig.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/RigidBodyEditorConfig.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/RigidBodyFromModel.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/RigidBodyFromModel.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/SceneInstance.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/SceneInstance.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/ScriptObject.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/ScriptObject.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/SelectionTool.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/SelectionTool.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/TerrainGenerator.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/TerrainGenerator.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/TexturedPlaneDraw.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/TexturedPlaneDraw.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/TransformTool.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/TransformTool.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/TypeRegister.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/TypeRegister.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/TypeRegisterRegisterCommonTypes.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/TypeRegisterRegisterCommonTypes.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/UIAssetPicker.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/UIAssetPicker.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ABackgroundMusic.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ABackgroundMusic.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ABlockingObstacle.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ABlockingObstacle.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ACRSpline.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ACRSpline.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ACamera.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ACamera.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ADynamicObstacle.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ADynamicObstacle.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/AInfinitePlaneObstacle.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/AInfinitePlaneObstacle.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/AInvisibleRigidObstacle.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/AInvisibleRigidObstacle.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALight.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALight.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALine.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALine.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALocator.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ALocator.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ANavMesh.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ANavMesh.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ANavMesh_btCollisionShapeToTriangles.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ANavMesh_btCollisionShapeToTriangles.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/AParticles.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/AParticles.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ASky.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ASky.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/AStaticObstacle.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/AStaticObstacle.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ATimeline.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/ATimeline.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/IKNode.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/actors/IKNode.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/behaviours/CharacterController.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/behaviours/CharacterController.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/enums2d.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/enums2d.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/materials/Material.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/materials/Material.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/setImGuiContextEngine.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/setImGuiContextEngine.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitActorList.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitActorList.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitCharacterController.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitCharacterController.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitModel.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitModel.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitMultiModel.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitMultiModel.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitParticles.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitParticles.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitPath.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitPath.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRenderable.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRenderable.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRenderableGeom.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRenderableGeom.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRigidBody.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitRigidBody.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitScriptSlot.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitScriptSlot.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitTexturedPlane.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitTexturedPlane.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitViewportIcon.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/traits/TraitViewportIcon.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/typelibHelper.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/typelibHelper.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/ActorCreateWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/ActorCreateWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/AssetsWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/AssetsWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/CreditsWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/CreditsWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/EditorWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/EditorWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/GameInspectorWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/GameInspectorWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/GamePlayWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/GamePlayWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/HelpWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/HelpWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/InfoWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/InfoWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/LogWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/LogWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/ModelPreviewWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/ModelPreviewWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/OutlinerWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/OutlinerWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/PrefabWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/PrefabWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/ProjectSettingsWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/ProjectSettingsWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/PropertyEditorWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/PropertyEditorWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/SceneWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/SceneWindow.cpp.o.d"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/WorldSettingsWindow.cpp.o"
+  "CMakeFiles/sge_engine.dir/src/sge_engine/windows/WorldSettingsWindow.cpp.o.d"
+  "libsge_engine.pdb"
+  "libsge_engine.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sge_engine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
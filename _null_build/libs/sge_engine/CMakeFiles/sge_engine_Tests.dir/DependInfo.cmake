@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/sge_engine/tests/GameWorldAnimation.Test.cpp" "libs/sge_engine/CMakeFiles/sge_engine_Tests.dir/tests/GameWorldAnimation.Test.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine_Tests.dir/tests/GameWorldAnimation.Test.cpp.o.d"
+  "/root/repo/libs/sge_engine/tests/SgeEngineTestMain.cpp" "libs/sge_engine/CMakeFiles/sge_engine_Tests.dir/tests/SgeEngineTestMain.cpp.o" "gcc" "libs/sge_engine/CMakeFiles/sge_engine_Tests.dir/tests/SgeEngineTestMain.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/libs/sge_engine/CMakeFiles/sge_engine.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_core/CMakeFiles/sge_core.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_renderer/CMakeFiles/sge_renderer.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/mcpp/CMakeFiles/mcpp.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_audio/CMakeFiles/sge_audio.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs/sge_utils/CMakeFiles/sge_utils.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/imgui/CMakeFiles/imgui.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/SDL2/CMakeFiles/SDL2main.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/SDL2/CMakeFiles/SDL2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/recastnavigation/CMakeFiles/Recast.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/recastnavigation/CMakeFiles/Detour.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sge_engine_Tests.dir/tests/GameWorldAnimation.Test.cpp.o"
+  "CMakeFiles/sge_engine_Tests.dir/tests/GameWorldAnimation.Test.cpp.o.d"
+  "CMakeFiles/sge_engine_Tests.dir/tests/SgeEngineTestMain.cpp.o"
+  "CMakeFiles/sge_engine_Tests.dir/tests/SgeEngineTestMain.cpp.o.d"
+  "sge_engine_Tests"
+  "sge_engine_Tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sge_engine_Tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/sge_renderer/src/sge_renderer/null/Buffer_null.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Buffer_null.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Buffer_null.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/null/FrameTarget_null.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/FrameTarget_null.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/FrameTarget_null.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/null/GraphicsInterface_null.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/GraphicsInterface_null.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/GraphicsInterface_null.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/null/Query_null.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Query_null.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Query_null.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/null/RenderState_null.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/RenderState_null.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/RenderState_null.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/null/SamplerState_null.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/SamplerState_null.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/SamplerState_null.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/null/ShaderReflection_null.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/ShaderReflection_null.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/ShaderReflection_null.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/null/Shader_null.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Shader_null.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Shader_null.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/null/ShadingProgram_null.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/ShadingProgram_null.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/ShadingProgram_null.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/null/Texture_null.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Texture_null.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Texture_null.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/renderer/APICommands.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/APICommands.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/APICommands.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/renderer/GraphicsCommon.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/GraphicsCommon.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/GraphicsCommon.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/renderer/HLSLTranslator.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/HLSLTranslator.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/HLSLTranslator.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/renderer/RecordingContext.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/RecordingContext.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/RecordingContext.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/renderer/ShaderReflection.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/ShaderReflection.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/ShaderReflection.cpp.o.d"
+  "/root/repo/libs/sge_renderer/src/sge_renderer/renderer/renderer.cpp" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/renderer.cpp.o" "gcc" "libs/sge_renderer/CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/renderer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/libs/sge_utils/CMakeFiles/sge_utils.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/DependInfo.cmake"
+  "/root/repo/_null_build/libs_ext/mcpp/CMakeFiles/mcpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Buffer_null.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Buffer_null.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/FrameTarget_null.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/FrameTarget_null.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/GraphicsInterface_null.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/GraphicsInterface_null.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Query_null.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Query_null.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/RenderState_null.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/RenderState_null.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/SamplerState_null.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/SamplerState_null.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/ShaderReflection_null.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/ShaderReflection_null.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Shader_null.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Shader_null.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/ShadingProgram_null.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/ShadingProgram_null.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Texture_null.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/null/Texture_null.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/APICommands.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/APICommands.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/GraphicsCommon.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/GraphicsCommon.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/HLSLTranslator.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/HLSLTranslator.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/RecordingContext.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/RecordingContext.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/ShaderReflection.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/ShaderReflection.cpp.o.d"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/renderer.cpp.o"
+  "CMakeFiles/sge_renderer.dir/src/sge_renderer/renderer/renderer.cpp.o.d"
+  "libsge_renderer.a"
+  "libsge_renderer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sge_renderer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
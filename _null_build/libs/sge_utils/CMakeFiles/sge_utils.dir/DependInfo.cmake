@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/sge_utils/src/sge_utils/Logger.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/Logger.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/Logger.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/credits/sge_all_3rd_party_credits.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/credits/sge_all_3rd_party_credits.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/credits/sge_all_3rd_party_credits.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/math/DynamicAABBTree.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/DynamicAABBTree.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/DynamicAABBTree.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/math/FABRIKSolver.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/FABRIKSolver.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/FABRIKSolver.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/math/Frustum.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/Frustum.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/Frustum.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/math/FrustumCulling.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/FrustumCulling.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/FrustumCulling.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/math/MultiCurve2D.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/MultiCurve2D.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/MultiCurve2D.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/math/Random.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/Random.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/Random.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/math/ShadowCascades.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/ShadowCascades.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/ShadowCascades.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/math/transform.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/transform.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/math/transform.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/sge_utils.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/sge_utils.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/sge_utils.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/tiny/FileOpenDialog.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/tiny/FileOpenDialog.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/tiny/FileOpenDialog.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/DLLHandler.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/DLLHandler.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/DLLHandler.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/FileStream.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/FileStream.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/FileStream.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/LinearAllocator.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/LinearAllocator.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/LinearAllocator.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/MemoryMappedFile.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/MemoryMappedFile.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/MemoryMappedFile.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/OptionPermutator.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/OptionPermutator.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/OptionPermutator.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/Path.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/Path.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/Path.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/ThreadPool.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/ThreadPool.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/ThreadPool.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/Wildcard.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/Wildcard.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/Wildcard.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/base64/base64.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/base64/base64.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/base64/base64.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/common.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/common.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/common.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/json.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/json.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/json.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/strings.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/strings.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/strings.cpp.o.d"
+  "/root/repo/libs/sge_utils/src/sge_utils/utils/timer.cpp" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/timer.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils.dir/src/sge_utils/utils/timer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sge_utils.dir/src/sge_utils/Logger.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/Logger.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/credits/sge_all_3rd_party_credits.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/credits/sge_all_3rd_party_credits.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/DynamicAABBTree.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/DynamicAABBTree.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/FABRIKSolver.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/FABRIKSolver.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/Frustum.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/Frustum.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/FrustumCulling.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/FrustumCulling.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/MultiCurve2D.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/MultiCurve2D.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/Random.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/Random.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/ShadowCascades.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/ShadowCascades.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/transform.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/math/transform.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/sge_utils.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/sge_utils.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/tiny/FileOpenDialog.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/tiny/FileOpenDialog.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/DLLHandler.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/DLLHandler.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/FileStream.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/FileStream.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/LinearAllocator.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/LinearAllocator.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/MemoryMappedFile.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/MemoryMappedFile.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/OptionPermutator.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/OptionPermutator.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/Path.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/Path.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/ThreadPool.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/ThreadPool.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/Wildcard.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/Wildcard.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/base64/base64.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/base64/base64.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/common.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/common.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/json.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/json.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/strings.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/strings.cpp.o.d"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/timer.cpp.o"
+  "CMakeFiles/sge_utils.dir/src/sge_utils/utils/timer.cpp.o.d"
+  "libsge_utils.a"
+  "libsge_utils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sge_utils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/sge_utils/tests/DynamicAABBTree.Test.cpp" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/DynamicAABBTree.Test.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/DynamicAABBTree.Test.cpp.o.d"
+  "/root/repo/libs/sge_utils/tests/FrustumCulling.Test.cpp" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/FrustumCulling.Test.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/FrustumCulling.Test.cpp.o.d"
+  "/root/repo/libs/sge_utils/tests/Optional.Test.cpp" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/Optional.Test.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/Optional.Test.cpp.o.d"
+  "/root/repo/libs/sge_utils/tests/SgeUtilsTestMain.cpp" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/SgeUtilsTestMain.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/SgeUtilsTestMain.cpp.o.d"
+  "/root/repo/libs/sge_utils/tests/SgeUtilsTestPlayground.cpp" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/SgeUtilsTestPlayground.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/SgeUtilsTestPlayground.cpp.o.d"
+  "/root/repo/libs/sge_utils/tests/ShadowCascades.Test.cpp" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/ShadowCascades.Test.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/ShadowCascades.Test.cpp.o.d"
+  "/root/repo/libs/sge_utils/tests/ThreadPool.Test.cpp" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/ThreadPool.Test.cpp.o" "gcc" "libs/sge_utils/CMakeFiles/sge_utils_Tests.dir/tests/ThreadPool.Test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/libs/sge_utils/CMakeFiles/sge_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sge_utils_Tests.dir/tests/DynamicAABBTree.Test.cpp.o"
+  "CMakeFiles/sge_utils_Tests.dir/tests/DynamicAABBTree.Test.cpp.o.d"
+  "CMakeFiles/sge_utils_Tests.dir/tests/FrustumCulling.Test.cpp.o"
+  "CMakeFiles/sge_utils_Tests.dir/tests/FrustumCulling.Test.cpp.o.d"
+  "CMakeFiles/sge_utils_Tests.dir/tests/Optional.Test.cpp.o"
+  "CMakeFiles/sge_utils_Tests.dir/tests/Optional.Test.cpp.o.d"
+  "CMakeFiles/sge_utils_Tests.dir/tests/SgeUtilsTestMain.cpp.o"
+  "CMakeFiles/sge_utils_Tests.dir/tests/SgeUtilsTestMain.cpp.o.d"
+  "CMakeFiles/sge_utils_Tests.dir/tests/SgeUtilsTestPlayground.cpp.o"
+  "CMakeFiles/sge_utils_Tests.dir/tests/SgeUtilsTestPlayground.cpp.o.d"
+  "CMakeFiles/sge_utils_Tests.dir/tests/ShadowCascades.Test.cpp.o"
+  "CMakeFiles/sge_utils_Tests.dir/tests/ShadowCascades.Test.cpp.o.d"
+  "CMakeFiles/sge_utils_Tests.dir/tests/ThreadPool.Test.cpp.o"
+  "CMakeFiles/sge_utils_Tests.dir/tests/ThreadPool.Test.cpp.o.d"
+  "sge_utils_Tests"
+  "sge_utils_Tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sge_utils_Tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs_ext/HLSLParser/src/CodeWriter.cpp" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/CodeWriter.cpp.o" "gcc" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/CodeWriter.cpp.o.d"
+  "/root/repo/libs_ext/HLSLParser/src/Engine.cpp" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/Engine.cpp.o" "gcc" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/Engine.cpp.o.d"
+  "/root/repo/libs_ext/HLSLParser/src/GLSLGenerator.cpp" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/GLSLGenerator.cpp.o" "gcc" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/GLSLGenerator.cpp.o.d"
+  "/root/repo/libs_ext/HLSLParser/src/HLSLGenerator.cpp" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/HLSLGenerator.cpp.o" "gcc" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/HLSLGenerator.cpp.o.d"
+  "/root/repo/libs_ext/HLSLParser/src/HLSLParser.cpp" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/HLSLParser.cpp.o" "gcc" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/HLSLParser.cpp.o.d"
+  "/root/repo/libs_ext/HLSLParser/src/HLSLTokenizer.cpp" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/HLSLTokenizer.cpp.o" "gcc" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/HLSLTokenizer.cpp.o.d"
+  "/root/repo/libs_ext/HLSLParser/src/HLSLTree.cpp" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/HLSLTree.cpp.o" "gcc" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/HLSLTree.cpp.o.d"
+  "/root/repo/libs_ext/HLSLParser/src/MSLGenerator.cpp" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/MSLGenerator.cpp.o" "gcc" "libs_ext/HLSLParser/CMakeFiles/HLSLParser.dir/src/MSLGenerator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/libs_ext/mcpp/CMakeFiles/mcpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
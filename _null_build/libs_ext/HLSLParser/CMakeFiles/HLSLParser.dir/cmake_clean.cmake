@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HLSLParser.dir/src/CodeWriter.cpp.o"
+  "CMakeFiles/HLSLParser.dir/src/CodeWriter.cpp.o.d"
+  "CMakeFiles/HLSLParser.dir/src/Engine.cpp.o"
+  "CMakeFiles/HLSLParser.dir/src/Engine.cpp.o.d"
+  "CMakeFiles/HLSLParser.dir/src/GLSLGenerator.cpp.o"
+  "CMakeFiles/HLSLParser.dir/src/GLSLGenerator.cpp.o.d"
+  "CMakeFiles/HLSLParser.dir/src/HLSLGenerator.cpp.o"
+  "CMakeFiles/HLSLParser.dir/src/HLSLGenerator.cpp.o.d"
+  "CMakeFiles/HLSLParser.dir/src/HLSLParser.cpp.o"
+  "CMakeFiles/HLSLParser.dir/src/HLSLParser.cpp.o.d"
+  "CMakeFiles/HLSLParser.dir/src/HLSLTokenizer.cpp.o"
+  "CMakeFiles/HLSLParser.dir/src/HLSLTokenizer.cpp.o.d"
+  "CMakeFiles/HLSLParser.dir/src/HLSLTree.cpp.o"
+  "CMakeFiles/HLSLParser.dir/src/HLSLTree.cpp.o.d"
+  "CMakeFiles/HLSLParser.dir/src/MSLGenerator.cpp.o"
+  "CMakeFiles/HLSLParser.dir/src/MSLGenerator.cpp.o.d"
+  "libHLSLParser.a"
+  "libHLSLParser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HLSLParser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,173 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs_ext/SDL2/src/SDL.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/SDL_assert.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL_assert.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL_assert.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/SDL_dataqueue.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL_dataqueue.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL_dataqueue.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/SDL_error.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL_error.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL_error.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/SDL_hints.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL_hints.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL_hints.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/SDL_log.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL_log.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/SDL_log.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/atomic/SDL_atomic.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/atomic/SDL_atomic.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/atomic/SDL_atomic.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/atomic/SDL_spinlock.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/atomic/SDL_spinlock.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/atomic/SDL_spinlock.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/audio/SDL_audio.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_audio.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_audio.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/audio/SDL_audiocvt.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_audiocvt.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_audiocvt.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/audio/SDL_audiodev.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_audiodev.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_audiodev.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/audio/SDL_audiotypecvt.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_audiotypecvt.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_audiotypecvt.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/audio/SDL_mixer.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_mixer.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_mixer.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/audio/SDL_wave.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_wave.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/SDL_wave.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/audio/disk/SDL_diskaudio.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/disk/SDL_diskaudio.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/disk/SDL_diskaudio.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/audio/dsp/SDL_dspaudio.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/dsp/SDL_dspaudio.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/dsp/SDL_dspaudio.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/audio/dummy/SDL_dummyaudio.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/dummy/SDL_dummyaudio.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/audio/dummy/SDL_dummyaudio.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/core/linux/SDL_dbus.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_dbus.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_dbus.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/core/linux/SDL_evdev.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_evdev.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_evdev.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/core/linux/SDL_evdev_kbd.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_evdev_kbd.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_evdev_kbd.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/core/linux/SDL_fcitx.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_fcitx.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_fcitx.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/core/linux/SDL_ibus.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_ibus.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_ibus.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/core/linux/SDL_ime.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_ime.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_ime.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/core/linux/SDL_threadprio.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_threadprio.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_threadprio.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/core/linux/SDL_udev.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_udev.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/linux/SDL_udev.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/core/unix/SDL_poll.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/unix/SDL_poll.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/core/unix/SDL_poll.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/cpuinfo/SDL_cpuinfo.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/cpuinfo/SDL_cpuinfo.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/cpuinfo/SDL_cpuinfo.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/dynapi/SDL_dynapi.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/dynapi/SDL_dynapi.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/dynapi/SDL_dynapi.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/events/SDL_clipboardevents.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_clipboardevents.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_clipboardevents.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/events/SDL_displayevents.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_displayevents.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_displayevents.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/events/SDL_dropevents.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_dropevents.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_dropevents.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/events/SDL_events.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_events.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_events.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/events/SDL_gesture.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_gesture.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_gesture.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/events/SDL_keyboard.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_keyboard.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_keyboard.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/events/SDL_mouse.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_mouse.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_mouse.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/events/SDL_quit.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_quit.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_quit.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/events/SDL_touch.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_touch.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_touch.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/events/SDL_windowevents.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_windowevents.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/events/SDL_windowevents.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/file/SDL_rwops.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/file/SDL_rwops.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/file/SDL_rwops.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/filesystem/unix/SDL_sysfilesystem.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/filesystem/unix/SDL_sysfilesystem.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/filesystem/unix/SDL_sysfilesystem.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/haptic/SDL_haptic.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/haptic/SDL_haptic.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/haptic/SDL_haptic.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/haptic/linux/SDL_syshaptic.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/haptic/linux/SDL_syshaptic.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/haptic/linux/SDL_syshaptic.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/joystick/SDL_gamecontroller.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/joystick/SDL_gamecontroller.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/joystick/SDL_gamecontroller.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/joystick/SDL_joystick.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/joystick/SDL_joystick.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/joystick/SDL_joystick.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/joystick/linux/SDL_sysjoystick.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/joystick/linux/SDL_sysjoystick.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/joystick/linux/SDL_sysjoystick.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/joystick/steam/SDL_steamcontroller.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/joystick/steam/SDL_steamcontroller.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/joystick/steam/SDL_steamcontroller.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/e_atan2.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_atan2.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_atan2.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/e_exp.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_exp.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_exp.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/e_fmod.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_fmod.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_fmod.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/e_log.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_log.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_log.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/e_log10.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_log10.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_log10.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/e_pow.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_pow.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_pow.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/e_rem_pio2.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_rem_pio2.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_rem_pio2.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/e_sqrt.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_sqrt.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/e_sqrt.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/k_cos.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/k_cos.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/k_cos.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/k_rem_pio2.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/k_rem_pio2.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/k_rem_pio2.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/k_sin.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/k_sin.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/k_sin.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/k_tan.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/k_tan.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/k_tan.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/s_atan.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_atan.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_atan.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/s_copysign.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_copysign.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_copysign.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/s_cos.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_cos.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_cos.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/s_fabs.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_fabs.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_fabs.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/s_floor.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_floor.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_floor.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/s_scalbn.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_scalbn.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_scalbn.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/s_sin.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_sin.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_sin.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/libm/s_tan.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_tan.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/libm/s_tan.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/loadso/dlopen/SDL_sysloadso.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/loadso/dlopen/SDL_sysloadso.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/loadso/dlopen/SDL_sysloadso.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/power/SDL_power.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/power/SDL_power.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/power/SDL_power.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/power/linux/SDL_syspower.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/power/linux/SDL_syspower.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/power/linux/SDL_syspower.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/SDL_d3dmath.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/SDL_d3dmath.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/SDL_d3dmath.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/SDL_render.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/SDL_render.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/SDL_render.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/SDL_yuv_sw.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/SDL_yuv_sw.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/SDL_yuv_sw.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/direct3d/SDL_render_d3d.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/direct3d/SDL_render_d3d.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/direct3d/SDL_render_d3d.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/direct3d/SDL_shaders_d3d.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/direct3d/SDL_shaders_d3d.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/direct3d/SDL_shaders_d3d.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/direct3d11/SDL_render_d3d11.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/direct3d11/SDL_render_d3d11.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/direct3d11/SDL_render_d3d11.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/direct3d11/SDL_shaders_d3d11.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/direct3d11/SDL_shaders_d3d11.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/direct3d11/SDL_shaders_d3d11.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/opengl/SDL_render_gl.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/opengl/SDL_render_gl.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/opengl/SDL_render_gl.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/opengl/SDL_shaders_gl.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/opengl/SDL_shaders_gl.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/opengl/SDL_shaders_gl.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/opengles/SDL_render_gles.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/opengles/SDL_render_gles.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/opengles/SDL_render_gles.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/opengles2/SDL_render_gles2.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/opengles2/SDL_render_gles2.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/opengles2/SDL_render_gles2.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/opengles2/SDL_shaders_gles2.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/opengles2/SDL_shaders_gles2.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/opengles2/SDL_shaders_gles2.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/psp/SDL_render_psp.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/psp/SDL_render_psp.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/psp/SDL_render_psp.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/software/SDL_blendfillrect.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_blendfillrect.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_blendfillrect.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/software/SDL_blendline.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_blendline.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_blendline.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/software/SDL_blendpoint.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_blendpoint.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_blendpoint.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/software/SDL_drawline.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_drawline.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_drawline.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/software/SDL_drawpoint.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_drawpoint.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_drawpoint.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/software/SDL_render_sw.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_render_sw.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_render_sw.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/render/software/SDL_rotate.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_rotate.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/render/software/SDL_rotate.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/sensor/SDL_sensor.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/sensor/SDL_sensor.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/sensor/SDL_sensor.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/sensor/dummy/SDL_dummysensor.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/sensor/dummy/SDL_dummysensor.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/sensor/dummy/SDL_dummysensor.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/stdlib/SDL_getenv.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_getenv.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_getenv.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/stdlib/SDL_iconv.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_iconv.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_iconv.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/stdlib/SDL_malloc.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_malloc.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_malloc.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/stdlib/SDL_qsort.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_qsort.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_qsort.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/stdlib/SDL_stdlib.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_stdlib.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_stdlib.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/stdlib/SDL_string.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_string.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/stdlib/SDL_string.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/thread/SDL_thread.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/SDL_thread.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/SDL_thread.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/thread/pthread/SDL_syscond.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/pthread/SDL_syscond.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/pthread/SDL_syscond.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/thread/pthread/SDL_sysmutex.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/pthread/SDL_sysmutex.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/pthread/SDL_sysmutex.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/thread/pthread/SDL_syssem.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/pthread/SDL_syssem.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/pthread/SDL_syssem.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/thread/pthread/SDL_systhread.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/pthread/SDL_systhread.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/pthread/SDL_systhread.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/thread/pthread/SDL_systls.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/pthread/SDL_systls.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/thread/pthread/SDL_systls.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/timer/SDL_timer.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/timer/SDL_timer.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/timer/SDL_timer.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/timer/unix/SDL_systimer.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/timer/unix/SDL_systimer.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/timer/unix/SDL_systimer.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_RLEaccel.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_RLEaccel.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_RLEaccel.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_blit.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_blit_0.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_0.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_0.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_blit_1.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_1.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_1.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_blit_A.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_A.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_A.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_blit_N.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_N.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_N.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_blit_auto.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_auto.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_auto.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_blit_copy.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_copy.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_copy.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_blit_slow.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_slow.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_blit_slow.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_bmp.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_bmp.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_bmp.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_clipboard.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_clipboard.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_clipboard.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_egl.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_egl.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_egl.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_fillrect.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_fillrect.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_fillrect.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_pixels.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_pixels.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_pixels.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_rect.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_rect.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_rect.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_shape.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_shape.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_shape.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_stretch.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_stretch.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_stretch.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_surface.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_surface.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_surface.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_video.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_video.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_video.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_vulkan_utils.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_vulkan_utils.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_vulkan_utils.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/SDL_yuv.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_yuv.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/SDL_yuv.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/dummy/SDL_nullevents.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/dummy/SDL_nullevents.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/dummy/SDL_nullevents.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/dummy/SDL_nullframebuffer.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/dummy/SDL_nullframebuffer.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/dummy/SDL_nullframebuffer.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/dummy/SDL_nullvideo.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/dummy/SDL_nullvideo.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/dummy/SDL_nullvideo.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11clipboard.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11clipboard.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11clipboard.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11dyn.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11dyn.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11dyn.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11events.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11events.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11events.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11framebuffer.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11framebuffer.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11framebuffer.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11keyboard.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11keyboard.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11keyboard.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11messagebox.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11messagebox.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11messagebox.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11modes.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11modes.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11modes.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11mouse.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11mouse.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11mouse.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11opengl.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11opengl.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11opengl.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11opengles.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11opengles.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11opengles.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11shape.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11shape.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11shape.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11touch.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11touch.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11touch.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11video.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11video.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11video.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11vulkan.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11vulkan.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11vulkan.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11window.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11window.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11window.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/SDL_x11xinput2.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11xinput2.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/SDL_x11xinput2.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/edid-parse.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/edid-parse.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/edid-parse.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/x11/imKStoUCS.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/imKStoUCS.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/x11/imKStoUCS.c.o.d"
+  "/root/repo/libs_ext/SDL2/src/video/yuv2rgb/yuv_rgb.c" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/yuv2rgb/yuv_rgb.c.o" "gcc" "libs_ext/SDL2/CMakeFiles/SDL2.dir/src/video/yuv2rgb/yuv_rgb.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_null_build/libs_ext/SDL2/libSDL2-2.0.so" "/root/repo/_null_build/libs_ext/SDL2/libSDL2-2.0.so.0.10.0"
+  "/root/repo/_null_build/libs_ext/SDL2/libSDL2-2.0.so.0" "/root/repo/_null_build/libs_ext/SDL2/libSDL2-2.0.so.0.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
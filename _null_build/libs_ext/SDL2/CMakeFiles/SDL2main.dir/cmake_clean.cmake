@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SDL2main.dir/src/main/dummy/SDL_dummy_main.c.o"
+  "CMakeFiles/SDL2main.dir/src/main/dummy/SDL_dummy_main.c.o.d"
+  "libSDL2main.a"
+  "libSDL2main.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/SDL2main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
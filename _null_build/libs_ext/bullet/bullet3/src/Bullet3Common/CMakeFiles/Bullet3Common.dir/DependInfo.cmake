@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs_ext/bullet/bullet3/src/Bullet3Common/b3AlignedAllocator.cpp" "libs_ext/bullet/bullet3/src/Bullet3Common/CMakeFiles/Bullet3Common.dir/b3AlignedAllocator.o" "gcc" "libs_ext/bullet/bullet3/src/Bullet3Common/CMakeFiles/Bullet3Common.dir/b3AlignedAllocator.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/Bullet3Common/b3Logging.cpp" "libs_ext/bullet/bullet3/src/Bullet3Common/CMakeFiles/Bullet3Common.dir/b3Logging.o" "gcc" "libs_ext/bullet/bullet3/src/Bullet3Common/CMakeFiles/Bullet3Common.dir/b3Logging.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/Bullet3Common/b3Vector3.cpp" "libs_ext/bullet/bullet3/src/Bullet3Common/CMakeFiles/Bullet3Common.dir/b3Vector3.o" "gcc" "libs_ext/bullet/bullet3/src/Bullet3Common/CMakeFiles/Bullet3Common.dir/b3Vector3.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Bullet3Common.dir/b3AlignedAllocator.o"
+  "CMakeFiles/Bullet3Common.dir/b3AlignedAllocator.o.d"
+  "CMakeFiles/Bullet3Common.dir/b3Logging.o"
+  "CMakeFiles/Bullet3Common.dir/b3Logging.o.d"
+  "CMakeFiles/Bullet3Common.dir/b3Vector3.o"
+  "CMakeFiles/Bullet3Common.dir/b3Vector3.o.d"
+  "libBullet3Common.a"
+  "libBullet3Common.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Bullet3Common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,115 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/BroadphaseCollision/btAxisSweep3.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btAxisSweep3.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btAxisSweep3.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/BroadphaseCollision/btBroadphaseProxy.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btBroadphaseProxy.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btBroadphaseProxy.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/BroadphaseCollision/btCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/BroadphaseCollision/btDbvt.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvt.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvt.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/BroadphaseCollision/btDbvtBroadphase.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvtBroadphase.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvtBroadphase.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/BroadphaseCollision/btDispatcher.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDispatcher.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDispatcher.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/BroadphaseCollision/btOverlappingPairCache.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btOverlappingPairCache.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btOverlappingPairCache.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/BroadphaseCollision/btQuantizedBvh.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btQuantizedBvh.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btQuantizedBvh.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/BroadphaseCollision/btSimpleBroadphase.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btSimpleBroadphase.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btSimpleBroadphase.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/SphereTriangleDetector.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/SphereTriangleDetector.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/SphereTriangleDetector.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btActivatingCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btActivatingCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btBoxBoxCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btBoxBoxDetector.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxDetector.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxDetector.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btCollisionDispatcher.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionDispatcher.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionDispatcher.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btCollisionDispatcherMt.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionDispatcherMt.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionDispatcherMt.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btCollisionObject.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionObject.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionObject.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btCollisionWorld.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionWorld.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionWorld.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btCollisionWorldImporter.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionWorldImporter.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionWorldImporter.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btCompoundCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btConvex2dConvex2dAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvex2dConvex2dAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvex2dConvex2dAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btConvexConcaveCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConcaveCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConcaveCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btConvexConvexAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConvexAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConvexAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btConvexPlaneCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexPlaneCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexPlaneCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btDefaultCollisionConfiguration.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btDefaultCollisionConfiguration.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btDefaultCollisionConfiguration.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btEmptyCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btEmptyCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btEmptyCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btGhostObject.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btGhostObject.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btGhostObject.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btHashedSimplePairCache.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btHashedSimplePairCache.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btHashedSimplePairCache.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btInternalEdgeUtility.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btInternalEdgeUtility.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btInternalEdgeUtility.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btManifoldResult.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btManifoldResult.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btManifoldResult.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btSimulationIslandManager.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSimulationIslandManager.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSimulationIslandManager.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btSphereBoxCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereBoxCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereBoxCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btSphereSphereCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereSphereCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereSphereCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btSphereTriangleCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereTriangleCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereTriangleCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionDispatch/btUnionFind.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btUnionFind.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btUnionFind.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btBox2dShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBox2dShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBox2dShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btBoxShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBoxShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBoxShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btBvhTriangleMeshShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBvhTriangleMeshShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBvhTriangleMeshShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btCapsuleShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCapsuleShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCapsuleShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btCollisionShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCollisionShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCollisionShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btCompoundShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCompoundShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCompoundShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btConcaveShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConcaveShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConcaveShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btConeShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConeShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConeShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btConvex2dShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvex2dShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvex2dShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btConvexHullShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexHullShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexHullShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btConvexInternalShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexInternalShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexInternalShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btConvexPointCloudShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPointCloudShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPointCloudShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btConvexPolyhedron.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPolyhedron.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPolyhedron.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btConvexShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btConvexTriangleMeshShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexTriangleMeshShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexTriangleMeshShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btCylinderShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCylinderShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCylinderShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btEmptyShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btEmptyShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btEmptyShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btHeightfieldTerrainShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btHeightfieldTerrainShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btHeightfieldTerrainShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btMiniSDF.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMiniSDF.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMiniSDF.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btMinkowskiSumShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMinkowskiSumShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMinkowskiSumShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btMultiSphereShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMultiSphereShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMultiSphereShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btMultimaterialTriangleMeshShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMultimaterialTriangleMeshShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMultimaterialTriangleMeshShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btOptimizedBvh.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btOptimizedBvh.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btOptimizedBvh.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btPolyhedralConvexShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btPolyhedralConvexShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btPolyhedralConvexShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btScaledBvhTriangleMeshShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btScaledBvhTriangleMeshShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btSdfCollisionShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btSdfCollisionShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btSdfCollisionShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btShapeHull.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btShapeHull.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btShapeHull.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btSphereShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btSphereShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btSphereShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btStaticPlaneShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btStaticPlaneShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btStaticPlaneShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btStridingMeshInterface.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btStridingMeshInterface.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btStridingMeshInterface.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btTetrahedronShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTetrahedronShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTetrahedronShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btTriangleBuffer.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleBuffer.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleBuffer.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btTriangleCallback.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleCallback.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleCallback.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btTriangleIndexVertexArray.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexArray.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexArray.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btTriangleIndexVertexMaterialArray.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexMaterialArray.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexMaterialArray.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btTriangleMesh.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMesh.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMesh.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btTriangleMeshShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMeshShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMeshShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/CollisionShapes/btUniformScalingShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btUniformScalingShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btUniformScalingShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/Gimpact/btContactProcessing.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btContactProcessing.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btContactProcessing.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/Gimpact/btGImpactBvh.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactBvh.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactBvh.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/Gimpact/btGImpactCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/Gimpact/btGImpactQuantizedBvh.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactQuantizedBvh.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactQuantizedBvh.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/Gimpact/btGImpactShape.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactShape.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactShape.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/Gimpact/btGenericPoolAllocator.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGenericPoolAllocator.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGenericPoolAllocator.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/Gimpact/btTriangleShapeEx.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btTriangleShapeEx.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btTriangleShapeEx.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/Gimpact/gim_box_set.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_box_set.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_box_set.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/Gimpact/gim_contact.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_contact.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_contact.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/Gimpact/gim_memory.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_memory.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_memory.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/Gimpact/gim_tri_collision.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_tri_collision.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_tri_collision.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btContinuousConvexCollision.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btContinuousConvexCollision.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btContinuousConvexCollision.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btConvexCast.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btConvexCast.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btConvexCast.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btGjkConvexCast.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkConvexCast.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkConvexCast.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btGjkEpa2.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpa2.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpa2.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btGjkPairDetector.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkPairDetector.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkPairDetector.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btPersistentManifold.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPersistentManifold.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPersistentManifold.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btPolyhedralContactClipping.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPolyhedralContactClipping.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPolyhedralContactClipping.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btRaycastCallback.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btRaycastCallback.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btRaycastCallback.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btSubSimplexConvexCast.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btSubSimplexConvexCast.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btSubSimplexConvexCast.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.cpp" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btVoronoiSimplexSolver.o" "gcc" "libs_ext/bullet/bullet3/src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btVoronoiSimplexSolver.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
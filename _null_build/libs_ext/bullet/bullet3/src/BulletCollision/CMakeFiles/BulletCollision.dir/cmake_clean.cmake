@@ -0,0 +1,203 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btAxisSweep3.o"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btAxisSweep3.o.d"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btBroadphaseProxy.o"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btBroadphaseProxy.o.d"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvt.o"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvt.o.d"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvtBroadphase.o"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvtBroadphase.o.d"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDispatcher.o"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDispatcher.o.d"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btOverlappingPairCache.o"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btOverlappingPairCache.o.d"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btQuantizedBvh.o"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btQuantizedBvh.o.d"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btSimpleBroadphase.o"
+  "CMakeFiles/BulletCollision.dir/BroadphaseCollision/btSimpleBroadphase.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/SphereTriangleDetector.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/SphereTriangleDetector.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btActivatingCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btActivatingCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxDetector.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxDetector.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionDispatcher.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionDispatcher.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionDispatcherMt.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionDispatcherMt.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionObject.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionObject.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionWorld.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionWorld.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionWorldImporter.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionWorldImporter.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvex2dConvex2dAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvex2dConvex2dAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConcaveCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConcaveCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConvexAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConvexAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexPlaneCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexPlaneCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btDefaultCollisionConfiguration.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btDefaultCollisionConfiguration.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btEmptyCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btEmptyCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btGhostObject.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btGhostObject.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btHashedSimplePairCache.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btHashedSimplePairCache.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btInternalEdgeUtility.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btInternalEdgeUtility.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btManifoldResult.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btManifoldResult.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btSimulationIslandManager.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btSimulationIslandManager.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereBoxCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereBoxCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereSphereCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereSphereCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereTriangleCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereTriangleCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btUnionFind.o"
+  "CMakeFiles/BulletCollision.dir/CollisionDispatch/btUnionFind.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btBox2dShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btBox2dShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btBoxShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btBoxShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btBvhTriangleMeshShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btBvhTriangleMeshShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btCapsuleShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btCapsuleShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btCollisionShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btCollisionShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btCompoundShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btCompoundShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConcaveShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConcaveShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConeShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConeShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvex2dShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvex2dShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexHullShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexHullShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexInternalShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexInternalShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPointCloudShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPointCloudShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPolyhedron.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPolyhedron.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexTriangleMeshShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexTriangleMeshShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btCylinderShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btCylinderShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btEmptyShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btEmptyShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btHeightfieldTerrainShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btHeightfieldTerrainShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btMiniSDF.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btMiniSDF.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btMinkowskiSumShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btMinkowskiSumShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btMultiSphereShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btMultiSphereShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btMultimaterialTriangleMeshShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btMultimaterialTriangleMeshShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btOptimizedBvh.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btOptimizedBvh.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btPolyhedralConvexShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btPolyhedralConvexShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btScaledBvhTriangleMeshShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btScaledBvhTriangleMeshShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btSdfCollisionShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btSdfCollisionShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btShapeHull.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btShapeHull.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btSphereShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btSphereShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btStaticPlaneShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btStaticPlaneShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btStridingMeshInterface.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btStridingMeshInterface.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTetrahedronShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTetrahedronShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleBuffer.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleBuffer.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleCallback.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleCallback.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexArray.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexArray.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexMaterialArray.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexMaterialArray.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMesh.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMesh.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMeshShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMeshShape.o.d"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btUniformScalingShape.o"
+  "CMakeFiles/BulletCollision.dir/CollisionShapes/btUniformScalingShape.o.d"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btContactProcessing.o"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btContactProcessing.o.d"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btGImpactBvh.o"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btGImpactBvh.o.d"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btGImpactCollisionAlgorithm.o"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btGImpactCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btGImpactQuantizedBvh.o"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btGImpactQuantizedBvh.o.d"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btGImpactShape.o"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btGImpactShape.o.d"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btGenericPoolAllocator.o"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btGenericPoolAllocator.o.d"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btTriangleShapeEx.o"
+  "CMakeFiles/BulletCollision.dir/Gimpact/btTriangleShapeEx.o.d"
+  "CMakeFiles/BulletCollision.dir/Gimpact/gim_box_set.o"
+  "CMakeFiles/BulletCollision.dir/Gimpact/gim_box_set.o.d"
+  "CMakeFiles/BulletCollision.dir/Gimpact/gim_contact.o"
+  "CMakeFiles/BulletCollision.dir/Gimpact/gim_contact.o.d"
+  "CMakeFiles/BulletCollision.dir/Gimpact/gim_memory.o"
+  "CMakeFiles/BulletCollision.dir/Gimpact/gim_memory.o.d"
+  "CMakeFiles/BulletCollision.dir/Gimpact/gim_tri_collision.o"
+  "CMakeFiles/BulletCollision.dir/Gimpact/gim_tri_collision.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btContinuousConvexCollision.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btContinuousConvexCollision.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btConvexCast.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btConvexCast.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkConvexCast.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkConvexCast.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpa2.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpa2.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkPairDetector.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkPairDetector.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPersistentManifold.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPersistentManifold.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPolyhedralContactClipping.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPolyhedralContactClipping.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btRaycastCallback.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btRaycastCallback.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btSubSimplexConvexCast.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btSubSimplexConvexCast.o.d"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btVoronoiSimplexSolver.o"
+  "CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btVoronoiSimplexSolver.o.d"
+  "libBulletCollision.a"
+  "libBulletCollision.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BulletCollision.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,59 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Character/btKinematicCharacterController.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Character/btKinematicCharacterController.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Character/btKinematicCharacterController.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btBatchedConstraints.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btBatchedConstraints.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btBatchedConstraints.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btConeTwistConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btConeTwistConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btConeTwistConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btContactConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btContactConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btContactConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btFixedConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btFixedConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btFixedConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btGearConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGearConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGearConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btGeneric6DofConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btGeneric6DofSpring2Constraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofSpring2Constraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofSpring2Constraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btGeneric6DofSpringConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofSpringConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofSpringConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btHinge2Constraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHinge2Constraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHinge2Constraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btHingeConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHingeConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHingeConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btNNCGConstraintSolver.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btNNCGConstraintSolver.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btNNCGConstraintSolver.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btPoint2PointConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btPoint2PointConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btPoint2PointConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolver.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSequentialImpulseConstraintSolver.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSequentialImpulseConstraintSolver.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSequentialImpulseConstraintSolverMt.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSequentialImpulseConstraintSolverMt.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btSliderConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSliderConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSliderConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btSolve2LinearConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSolve2LinearConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSolve2LinearConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btTypedConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btTypedConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btTypedConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/ConstraintSolver/btUniversalConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btUniversalConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btUniversalConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Dynamics/btDiscreteDynamicsWorld.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btDiscreteDynamicsWorld.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btDiscreteDynamicsWorld.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btDiscreteDynamicsWorldMt.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btDiscreteDynamicsWorldMt.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Dynamics/btRigidBody.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btRigidBody.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btRigidBody.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Dynamics/btSimpleDynamicsWorld.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btSimpleDynamicsWorld.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btSimpleDynamicsWorld.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Dynamics/btSimulationIslandManagerMt.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btSimulationIslandManagerMt.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btSimulationIslandManagerMt.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBody.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBody.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBody.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBodyConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBodyConstraintSolver.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraintSolver.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraintSolver.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBodyDynamicsWorld.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyDynamicsWorld.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyDynamicsWorld.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBodyFixedConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyFixedConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyFixedConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBodyGearConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyGearConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyGearConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBodyJointLimitConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointLimitConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointLimitConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBodyJointMotor.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointMotor.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointMotor.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBodyMLCPConstraintSolver.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyMLCPConstraintSolver.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyMLCPConstraintSolver.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBodyPoint2Point.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyPoint2Point.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyPoint2Point.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBodySliderConstraint.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodySliderConstraint.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodySliderConstraint.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Featherstone/btMultiBodySphericalJointMotor.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodySphericalJointMotor.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodySphericalJointMotor.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/MLCPSolvers/btDantzigLCP.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/MLCPSolvers/btDantzigLCP.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/MLCPSolvers/btDantzigLCP.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/MLCPSolvers/btLemkeAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/MLCPSolvers/btLemkeAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/MLCPSolvers/btLemkeAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/MLCPSolvers/btMLCPSolver.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/MLCPSolvers/btMLCPSolver.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/MLCPSolvers/btMLCPSolver.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Vehicle/btRaycastVehicle.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Vehicle/btRaycastVehicle.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Vehicle/btRaycastVehicle.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletDynamics/Vehicle/btWheelInfo.cpp" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Vehicle/btWheelInfo.o" "gcc" "libs_ext/bullet/bullet3/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Vehicle/btWheelInfo.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
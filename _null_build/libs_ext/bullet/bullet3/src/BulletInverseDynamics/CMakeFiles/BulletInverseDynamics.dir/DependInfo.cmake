@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletInverseDynamics/IDMath.cpp" "libs_ext/bullet/bullet3/src/BulletInverseDynamics/CMakeFiles/BulletInverseDynamics.dir/IDMath.o" "gcc" "libs_ext/bullet/bullet3/src/BulletInverseDynamics/CMakeFiles/BulletInverseDynamics.dir/IDMath.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletInverseDynamics/MultiBodyTree.cpp" "libs_ext/bullet/bullet3/src/BulletInverseDynamics/CMakeFiles/BulletInverseDynamics.dir/MultiBodyTree.o" "gcc" "libs_ext/bullet/bullet3/src/BulletInverseDynamics/CMakeFiles/BulletInverseDynamics.dir/MultiBodyTree.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletInverseDynamics/details/MultiBodyTreeImpl.cpp" "libs_ext/bullet/bullet3/src/BulletInverseDynamics/CMakeFiles/BulletInverseDynamics.dir/details/MultiBodyTreeImpl.o" "gcc" "libs_ext/bullet/bullet3/src/BulletInverseDynamics/CMakeFiles/BulletInverseDynamics.dir/details/MultiBodyTreeImpl.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletInverseDynamics/details/MultiBodyTreeInitCache.cpp" "libs_ext/bullet/bullet3/src/BulletInverseDynamics/CMakeFiles/BulletInverseDynamics.dir/details/MultiBodyTreeInitCache.o" "gcc" "libs_ext/bullet/bullet3/src/BulletInverseDynamics/CMakeFiles/BulletInverseDynamics.dir/details/MultiBodyTreeInitCache.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
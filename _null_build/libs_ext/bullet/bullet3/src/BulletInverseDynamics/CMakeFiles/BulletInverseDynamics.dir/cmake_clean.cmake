@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BulletInverseDynamics.dir/IDMath.o"
+  "CMakeFiles/BulletInverseDynamics.dir/IDMath.o.d"
+  "CMakeFiles/BulletInverseDynamics.dir/MultiBodyTree.o"
+  "CMakeFiles/BulletInverseDynamics.dir/MultiBodyTree.o.d"
+  "CMakeFiles/BulletInverseDynamics.dir/details/MultiBodyTreeImpl.o"
+  "CMakeFiles/BulletInverseDynamics.dir/details/MultiBodyTreeImpl.o.d"
+  "CMakeFiles/BulletInverseDynamics.dir/details/MultiBodyTreeInitCache.o"
+  "CMakeFiles/BulletInverseDynamics.dir/details/MultiBodyTreeInitCache.o.d"
+  "libBulletInverseDynamics.a"
+  "libBulletInverseDynamics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BulletInverseDynamics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
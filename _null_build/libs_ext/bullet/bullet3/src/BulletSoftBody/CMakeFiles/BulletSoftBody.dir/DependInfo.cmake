@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletSoftBody/btDefaultSoftBodySolver.cpp" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btDefaultSoftBodySolver.o" "gcc" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btDefaultSoftBodySolver.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletSoftBody/btSoftBody.cpp" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBody.o" "gcc" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBody.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletSoftBody/btSoftBodyConcaveCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyConcaveCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyConcaveCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletSoftBody/btSoftBodyHelpers.cpp" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyHelpers.o" "gcc" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyHelpers.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletSoftBody/btSoftBodyRigidBodyCollisionConfiguration.cpp" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyRigidBodyCollisionConfiguration.o" "gcc" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyRigidBodyCollisionConfiguration.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletSoftBody/btSoftMultiBodyDynamicsWorld.cpp" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftMultiBodyDynamicsWorld.o" "gcc" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftMultiBodyDynamicsWorld.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletSoftBody/btSoftRigidCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftRigidCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftRigidCollisionAlgorithm.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletSoftBody/btSoftRigidDynamicsWorld.cpp" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftRigidDynamicsWorld.o" "gcc" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftRigidDynamicsWorld.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/BulletSoftBody/btSoftSoftCollisionAlgorithm.cpp" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftSoftCollisionAlgorithm.o" "gcc" "libs_ext/bullet/bullet3/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftSoftCollisionAlgorithm.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BulletSoftBody.dir/btDefaultSoftBodySolver.o"
+  "CMakeFiles/BulletSoftBody.dir/btDefaultSoftBodySolver.o.d"
+  "CMakeFiles/BulletSoftBody.dir/btSoftBody.o"
+  "CMakeFiles/BulletSoftBody.dir/btSoftBody.o.d"
+  "CMakeFiles/BulletSoftBody.dir/btSoftBodyConcaveCollisionAlgorithm.o"
+  "CMakeFiles/BulletSoftBody.dir/btSoftBodyConcaveCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletSoftBody.dir/btSoftBodyHelpers.o"
+  "CMakeFiles/BulletSoftBody.dir/btSoftBodyHelpers.o.d"
+  "CMakeFiles/BulletSoftBody.dir/btSoftBodyRigidBodyCollisionConfiguration.o"
+  "CMakeFiles/BulletSoftBody.dir/btSoftBodyRigidBodyCollisionConfiguration.o.d"
+  "CMakeFiles/BulletSoftBody.dir/btSoftMultiBodyDynamicsWorld.o"
+  "CMakeFiles/BulletSoftBody.dir/btSoftMultiBodyDynamicsWorld.o.d"
+  "CMakeFiles/BulletSoftBody.dir/btSoftRigidCollisionAlgorithm.o"
+  "CMakeFiles/BulletSoftBody.dir/btSoftRigidCollisionAlgorithm.o.d"
+  "CMakeFiles/BulletSoftBody.dir/btSoftRigidDynamicsWorld.o"
+  "CMakeFiles/BulletSoftBody.dir/btSoftRigidDynamicsWorld.o.d"
+  "CMakeFiles/BulletSoftBody.dir/btSoftSoftCollisionAlgorithm.o"
+  "CMakeFiles/BulletSoftBody.dir/btSoftSoftCollisionAlgorithm.o.d"
+  "libBulletSoftBody.a"
+  "libBulletSoftBody.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BulletSoftBody.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
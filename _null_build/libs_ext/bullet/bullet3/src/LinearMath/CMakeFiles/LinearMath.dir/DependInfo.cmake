@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/TaskScheduler/btTaskScheduler.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/TaskScheduler/btTaskScheduler.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/TaskScheduler/btTaskScheduler.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/TaskScheduler/btThreadSupportPosix.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/TaskScheduler/btThreadSupportPosix.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/TaskScheduler/btThreadSupportPosix.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/TaskScheduler/btThreadSupportWin32.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/TaskScheduler/btThreadSupportWin32.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/TaskScheduler/btThreadSupportWin32.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/btAlignedAllocator.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btAlignedAllocator.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btAlignedAllocator.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/btConvexHull.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btConvexHull.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btConvexHull.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/btConvexHullComputer.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btConvexHullComputer.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btConvexHullComputer.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/btGeometryUtil.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btGeometryUtil.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btGeometryUtil.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/btPolarDecomposition.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btPolarDecomposition.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btPolarDecomposition.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/btQuickprof.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btQuickprof.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btQuickprof.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/btSerializer.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btSerializer.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btSerializer.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/btSerializer64.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btSerializer64.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btSerializer64.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/btThreads.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btThreads.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btThreads.o.d"
+  "/root/repo/libs_ext/bullet/bullet3/src/LinearMath/btVector3.cpp" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btVector3.o" "gcc" "libs_ext/bullet/bullet3/src/LinearMath/CMakeFiles/LinearMath.dir/btVector3.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LinearMath.dir/TaskScheduler/btTaskScheduler.o"
+  "CMakeFiles/LinearMath.dir/TaskScheduler/btTaskScheduler.o.d"
+  "CMakeFiles/LinearMath.dir/TaskScheduler/btThreadSupportPosix.o"
+  "CMakeFiles/LinearMath.dir/TaskScheduler/btThreadSupportPosix.o.d"
+  "CMakeFiles/LinearMath.dir/TaskScheduler/btThreadSupportWin32.o"
+  "CMakeFiles/LinearMath.dir/TaskScheduler/btThreadSupportWin32.o.d"
+  "CMakeFiles/LinearMath.dir/btAlignedAllocator.o"
+  "CMakeFiles/LinearMath.dir/btAlignedAllocator.o.d"
+  "CMakeFiles/LinearMath.dir/btConvexHull.o"
+  "CMakeFiles/LinearMath.dir/btConvexHull.o.d"
+  "CMakeFiles/LinearMath.dir/btConvexHullComputer.o"
+  "CMakeFiles/LinearMath.dir/btConvexHullComputer.o.d"
+  "CMakeFiles/LinearMath.dir/btGeometryUtil.o"
+  "CMakeFiles/LinearMath.dir/btGeometryUtil.o.d"
+  "CMakeFiles/LinearMath.dir/btPolarDecomposition.o"
+  "CMakeFiles/LinearMath.dir/btPolarDecomposition.o.d"
+  "CMakeFiles/LinearMath.dir/btQuickprof.o"
+  "CMakeFiles/LinearMath.dir/btQuickprof.o.d"
+  "CMakeFiles/LinearMath.dir/btSerializer.o"
+  "CMakeFiles/LinearMath.dir/btSerializer.o.d"
+  "CMakeFiles/LinearMath.dir/btSerializer64.o"
+  "CMakeFiles/LinearMath.dir/btSerializer64.o.d"
+  "CMakeFiles/LinearMath.dir/btThreads.o"
+  "CMakeFiles/LinearMath.dir/btThreads.o.d"
+  "CMakeFiles/LinearMath.dir/btVector3.o"
+  "CMakeFiles/LinearMath.dir/btVector3.o.d"
+  "libLinearMath.a"
+  "libLinearMath.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LinearMath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs_ext/mcpp/mcpp-2.7.2/src/directive.c" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/directive.c.o" "gcc" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/directive.c.o.d"
+  "/root/repo/libs_ext/mcpp/mcpp-2.7.2/src/eval.c" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/eval.c.o" "gcc" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/eval.c.o.d"
+  "/root/repo/libs_ext/mcpp/mcpp-2.7.2/src/expand.c" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/expand.c.o" "gcc" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/expand.c.o.d"
+  "/root/repo/libs_ext/mcpp/mcpp-2.7.2/src/main.c" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/main.c.o" "gcc" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/main.c.o.d"
+  "/root/repo/libs_ext/mcpp/mcpp-2.7.2/src/mbchar.c" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/mbchar.c.o" "gcc" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/mbchar.c.o.d"
+  "/root/repo/libs_ext/mcpp/mcpp-2.7.2/src/preproc.c" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/preproc.c.o" "gcc" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/preproc.c.o.d"
+  "/root/repo/libs_ext/mcpp/mcpp-2.7.2/src/sge_mcpp_file.c" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/sge_mcpp_file.c.o" "gcc" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/sge_mcpp_file.c.o.d"
+  "/root/repo/libs_ext/mcpp/mcpp-2.7.2/src/support.c" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/support.c.o" "gcc" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/support.c.o.d"
+  "/root/repo/libs_ext/mcpp/mcpp-2.7.2/src/system.c" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/system.c.o" "gcc" "libs_ext/mcpp/CMakeFiles/mcpp.dir/mcpp-2.7.2/src/system.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
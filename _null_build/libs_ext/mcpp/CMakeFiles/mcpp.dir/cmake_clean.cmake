@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/directive.c.o"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/directive.c.o.d"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/eval.c.o"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/eval.c.o.d"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/expand.c.o"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/expand.c.o.d"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/main.c.o"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/main.c.o.d"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/mbchar.c.o"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/mbchar.c.o.d"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/preproc.c.o"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/preproc.c.o.d"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/sge_mcpp_file.c.o"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/sge_mcpp_file.c.o.d"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/support.c.o"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/support.c.o.d"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/system.c.o"
+  "CMakeFiles/mcpp.dir/mcpp-2.7.2/src/system.c.o.d"
+  "libmcpp.a"
+  "libmcpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mcpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
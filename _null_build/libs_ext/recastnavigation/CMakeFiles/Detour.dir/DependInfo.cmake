@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Detour/Source/DetourAlloc.cpp" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourAlloc.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourAlloc.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Detour/Source/DetourCommon.cpp" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourCommon.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourCommon.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Detour/Source/DetourNavMesh.cpp" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMesh.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMesh.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Detour/Source/DetourNavMeshBuilder.cpp" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMeshBuilder.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMeshBuilder.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Detour/Source/DetourNavMeshQuery.cpp" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMeshQuery.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMeshQuery.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Detour/Source/DetourNode.cpp" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNode.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNode.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
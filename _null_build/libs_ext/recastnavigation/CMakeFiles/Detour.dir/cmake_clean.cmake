@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourAlloc.cpp.o"
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourAlloc.cpp.o.d"
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourCommon.cpp.o"
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourCommon.cpp.o.d"
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMesh.cpp.o"
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMesh.cpp.o.d"
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMeshBuilder.cpp.o"
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMeshBuilder.cpp.o.d"
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMeshQuery.cpp.o"
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNavMeshQuery.cpp.o.d"
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNode.cpp.o"
+  "CMakeFiles/Detour.dir/recastnavigation/Detour/Source/DetourNode.cpp.o.d"
+  "libDetour.a"
+  "libDetour.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Detour.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Recast/Source/Recast.cpp" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/Recast.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/Recast.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Recast/Source/RecastAlloc.cpp" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastAlloc.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastAlloc.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Recast/Source/RecastArea.cpp" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastArea.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastArea.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Recast/Source/RecastContour.cpp" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastContour.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastContour.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Recast/Source/RecastFilter.cpp" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastFilter.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastFilter.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Recast/Source/RecastLayers.cpp" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastLayers.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastLayers.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Recast/Source/RecastMesh.cpp" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastMesh.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastMesh.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Recast/Source/RecastMeshDetail.cpp" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastMeshDetail.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastMeshDetail.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Recast/Source/RecastRasterization.cpp" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastRasterization.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastRasterization.cpp.o.d"
+  "/root/repo/libs_ext/recastnavigation/recastnavigation/Recast/Source/RecastRegion.cpp" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastRegion.cpp.o" "gcc" "libs_ext/recastnavigation/CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastRegion.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/Recast.cpp.o"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/Recast.cpp.o.d"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastAlloc.cpp.o"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastAlloc.cpp.o.d"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastArea.cpp.o"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastArea.cpp.o.d"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastContour.cpp.o"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastContour.cpp.o.d"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastFilter.cpp.o"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastFilter.cpp.o.d"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastLayers.cpp.o"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastLayers.cpp.o.d"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastMesh.cpp.o"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastMesh.cpp.o.d"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastMeshDetail.cpp.o"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastMeshDetail.cpp.o.d"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastRasterization.cpp.o"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastRasterization.cpp.o.d"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastRegion.cpp.o"
+  "CMakeFiles/Recast.dir/recastnavigation/Recast/Source/RecastRegion.cpp.o.d"
+  "libRecast.a"
+  "libRecast.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Recast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
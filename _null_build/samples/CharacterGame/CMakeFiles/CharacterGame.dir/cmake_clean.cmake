@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CharacterGame.dir/src/DummyActor.cpp.o"
+  "CMakeFiles/CharacterGame.dir/src/DummyActor.cpp.o.d"
+  "CMakeFiles/CharacterGame.dir/src/PluginMain.cpp.o"
+  "CMakeFiles/CharacterGame.dir/src/PluginMain.cpp.o.d"
+  "libCharacterGame.gll"
+  "libCharacterGame.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CharacterGame.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CharacterGame_AssembleAndDebug"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CharacterGame_AssembleAndDebug.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Demo.dir/src/MainMenuScript.cpp.o"
+  "CMakeFiles/Demo.dir/src/MainMenuScript.cpp.o.d"
+  "CMakeFiles/Demo.dir/src/Player.cpp.o"
+  "CMakeFiles/Demo.dir/src/Player.cpp.o.d"
+  "CMakeFiles/Demo.dir/src/PluginMain.cpp.o"
+  "CMakeFiles/Demo.dir/src/PluginMain.cpp.o.d"
+  "libDemo.gll"
+  "libDemo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Demo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
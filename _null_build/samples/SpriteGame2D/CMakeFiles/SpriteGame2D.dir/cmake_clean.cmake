@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SpriteGame2D.dir/src/PluginMain.cpp.o"
+  "CMakeFiles/SpriteGame2D.dir/src/PluginMain.cpp.o.d"
+  "CMakeFiles/SpriteGame2D.dir/src/Snowman.cpp.o"
+  "CMakeFiles/SpriteGame2D.dir/src/Snowman.cpp.o.d"
+  "libSpriteGame2D.gll"
+  "libSpriteGame2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SpriteGame2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SpriteGame2D_AssembleAndDebug"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/SpriteGame2D_AssembleAndDebug.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
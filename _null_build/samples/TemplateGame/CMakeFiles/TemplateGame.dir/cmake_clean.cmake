@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TemplateGame.dir/src/DummyActor.cpp.o"
+  "CMakeFiles/TemplateGame.dir/src/DummyActor.cpp.o.d"
+  "CMakeFiles/TemplateGame.dir/src/PluginMain.cpp.o"
+  "CMakeFiles/TemplateGame.dir/src/PluginMain.cpp.o.d"
+  "libTemplateGame.gll"
+  "libTemplateGame.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TemplateGame.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
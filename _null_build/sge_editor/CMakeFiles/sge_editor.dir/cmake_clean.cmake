@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sge_editor.dir/src/exe/DummyPlugin.cpp.o"
+  "CMakeFiles/sge_editor.dir/src/exe/DummyPlugin.cpp.o.d"
+  "CMakeFiles/sge_editor.dir/src/exe/MiniDump.cpp.o"
+  "CMakeFiles/sge_editor.dir/src/exe/MiniDump.cpp.o.d"
+  "CMakeFiles/sge_editor.dir/src/exe/SgeEditorExeMain.cpp.o"
+  "CMakeFiles/sge_editor.dir/src/exe/SgeEditorExeMain.cpp.o.d"
+  "sge_editor"
+  "sge_editor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sge_editor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
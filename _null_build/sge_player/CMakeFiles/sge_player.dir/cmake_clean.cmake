@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sge_player.dir/src/exe/GameMode.cpp.o"
+  "CMakeFiles/sge_player.dir/src/exe/GameMode.cpp.o.d"
+  "CMakeFiles/sge_player.dir/src/exe/MiniDump.cpp.o"
+  "CMakeFiles/sge_player.dir/src/exe/MiniDump.cpp.o.d"
+  "CMakeFiles/sge_player.dir/src/exe/sgePlayerMain.cpp.o"
+  "CMakeFiles/sge_player.dir/src/exe/sgePlayerMain.cpp.o.d"
+  "sge_player"
+  "sge_player.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sge_player.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
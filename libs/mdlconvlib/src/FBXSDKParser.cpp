@@ -1141,7 +1141,7 @@ void FBXSDKParser::importAnimations() {
 		const float animationDuration = animationEnd - animationStart;
 
 		// Per node keyframes for this animation. They keyframes are in node local space.
-		std::map<int, KeyFrames> perNodeKeyFrames;
+		std::vector<KeyFrames> perNodeKeyFrames;
 
 		// Each stack constist of multiple layers. This abstaction is used by the artist in Maya/Max/ect. to separate the different type
 		// of keyframes while animating. This us purely used to keep the animation timeline organized and has no functionally when
@@ -1175,7 +1175,7 @@ void FBXSDKParser::importAnimations() {
 						const float keyTimeSeconds = (float)fbxKeyTime.GetSecondDouble() - animationStart;
 						vec3f const position = vec3f((float)fbxPos.mData[0], (float)fbxPos.mData[1], (float)fbxPos.mData[2]);
 
-						nodeKeyFrames.positionKeyFrames[keyTimeSeconds] = position;
+						nodeKeyFrames.positionKeyFrames.setKey(keyTimeSeconds, position);
 					}
 				}
 
@@ -1192,7 +1192,7 @@ void FBXSDKParser::importAnimations() {
 						// Convert the keyframe to our own format and save it.
 						float const keyTimeSeconds = (float)fbxKeyTime.GetSecondDouble() - animationStart;
 						quatf const rotation = quatFromFbx(FbxEuler::eOrderXYZ, fRotation);
-						nodeKeyFrames.rotationKeyFrames[keyTimeSeconds] = rotation;
+						nodeKeyFrames.rotationKeyFrames.setKey(keyTimeSeconds, rotation);
 					}
 				}
 
@@ -1210,14 +1210,16 @@ void FBXSDKParser::importAnimations() {
 						float const keyTimeSeconds = (float)fbxKeyTime.GetSecondDouble() - animationStart;
 						fbxsdk::FbxVector4 const fScaling = localTransform.GetS();
 						vec3f const scaling = vec3f((float)fScaling.mData[0], (float)fScaling.mData[1], (float)fScaling.mData[2]);
-						nodeKeyFrames.scalingKeyFrames[keyTimeSeconds] = scaling;
+						nodeKeyFrames.scalingKeyFrames.setKey(keyTimeSeconds, scaling);
 					}
 				}
 
 				// Save the keyframes to the animation.
 				// if there are no key frames, skip the node.
-				if (!nodeKeyFrames.positionKeyFrames.empty() || !nodeKeyFrames.rotationKeyFrames.empty() ||
-				    !nodeKeyFrames.scalingKeyFrames.empty()) {
+				if (!nodeKeyFrames.empty()) {
+					if (itr.second >= int(perNodeKeyFrames.size())) {
+						perNodeKeyFrames.resize(itr.second + 1);
+					}
 					perNodeKeyFrames[itr.second] = std::move(nodeKeyFrames);
 				}
 			} // End for each node loop.
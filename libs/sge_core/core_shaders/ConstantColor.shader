@@ -11,6 +11,10 @@
 uniform float4x4 uProjView;
 uniform float4x4 uWorld;
 
+// Vertex positions dequantization, identity if the mesh isn't quantized.
+uniform float3 uPositionDequantScale;
+uniform float3 uPositionDequantOffset;
+
 uniform float4 uColor;
 
 #if OPT_HasVertexSkinning == kHasVertexSkinning_Yes
@@ -39,7 +43,7 @@ VS_OUTPUT vsMain(VS_INPUT vsin)
 {
 	VS_OUTPUT res;
 
-	float3 vertexPosOs = vsin.a_position;
+	float3 vertexPosOs = vsin.a_position * uPositionDequantScale + uPositionDequantOffset;
 #if OPT_HasVertexSkinning == kHasVertexSkinning_Yes	
 	float4x4 skinMtx = libSkining_getSkinningTransform(vsin.a_bonesIds, uSkinningFirstBoneOffsetInTex, vsin.a_bonesWeights, uSkinningBones);
 	vertexPosOs = mul(skinMtx, float4(vertexPosOs, 1.0)).xyz;
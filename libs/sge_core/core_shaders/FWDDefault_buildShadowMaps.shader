@@ -5,12 +5,20 @@
 	#include "lib_skinning.shader"
 #endif
 
+#if OPT_Instancing == kInstancing_Yes
+	#include "lib_instancing.shader"
+#endif
+
 //--------------------------------------------------------------------
 // Uniforms.
 //--------------------------------------------------------------------
 uniform float4x4 projView;
 uniform float4x4 world;
 
+// Vertex positions dequantization, identity if the mesh isn't quantized.
+uniform float3 uPositionDequantScale;
+uniform float3 uPositionDequantOffset;
+
 #if OPT_LightType == FWDDBSM_OPT_LightType_Point
 // Point light shadow map building specifics.
 uniform float3 uPointLightPositionWs;
@@ -22,6 +30,11 @@ uniform float uPointLightFarPlaneDistance;
 	uniform int uSkinningFirstBoneOffsetInTex; ///< The row (integer) in @uSkinningBones of the fist bone for the mesh that is being drawn.
 #endif
 
+#if OPT_Instancing == kInstancing_Yes
+	uniform sampler2D uInstanceData;
+	uniform int uInstancingFirstRowInTex; ///< The row (integer) in @uInstanceData of the 1st instance that is being drawn.
+#endif
+
 //--------------------------------------------------------------------
 // Vertex Shader.
 //--------------------------------------------------------------------
@@ -33,6 +46,10 @@ struct VS_INPUT
 	int4 a_bonesIds : a_bonesIds;
 	float4 a_bonesWeights : a_bonesWeights;	
 #endif
+
+#if OPT_Instancing == kInstancing_Yes
+	int a_instanceId : SV_InstanceID;
+#endif
 };
 
 struct VS_OUTPUT {
@@ -46,13 +63,19 @@ VS_OUTPUT vsMain(VS_INPUT vsin)
 {
 	VS_OUTPUT res;
 	
-	float3 vertexPosOs = vsin.a_position;
+	float3 vertexPosOs = vsin.a_position * uPositionDequantScale + uPositionDequantOffset;
 #if OPT_HasVertexSkinning == kHasVertexSkinning_Yes	
 	float4x4 skinMtx = libSkining_getSkinningTransform(vsin.a_bonesIds, uSkinningFirstBoneOffsetInTex, vsin.a_bonesWeights, uSkinningBones);
 	vertexPosOs = mul(skinMtx, float4(vertexPosOs, 1.0)).xyz;
 #endif
 	
-	const float4 worldPos = mul(world, float4(vertexPosOs, 1.0));
+#if OPT_Instancing == kInstancing_Yes
+	const float4x4 instanceWorld = libInstancing_getWorld(uInstancingFirstRowInTex + vsin.a_instanceId, uInstanceData);
+#else
+	const float4x4 instanceWorld = world;
+#endif
+
+	const float4 worldPos = mul(instanceWorld, float4(vertexPosOs, 1.0));
 	const float4 posProjSpace = mul(projView, worldPos);
 	
 	res.SV_Position = posProjSpace;
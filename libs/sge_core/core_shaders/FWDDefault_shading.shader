@@ -6,10 +6,22 @@
 	#include "lib_skinning.shader"
 #endif
 
+#if OPT_Instancing == kInstancing_Yes
+	#include "lib_instancing.shader"
+#endif
+
 #if OPT_Lighting != kLightingForceNoLighting
 	#include "lib_pbr.shader"
 #endif
 
+#if OPT_Lighting == kLightingClustered
+	#include "lib_light_clusters.shader"
+#endif
+
+#if OPT_NormalEncoding == kNormalEncoding_Octahedral
+	#include "lib_quantization.shader"
+#endif
+
 //--------------------------------------------------------------------
 // Uniforms
 //--------------------------------------------------------------------
@@ -39,10 +51,31 @@ cbuffer ParamsCbFWDDefaultShading {
 	float4 lightColorWFlag;         // w used for flags.
 	
 	float4x4 lightShadowMapProjView;
-	float4 lightShadowRange;
+	float4 lightShadowRange; // x - range, y - number of shadow map cascades (0 if not cascaded), z - cascades blend fraction.
 
 	// Skinning.
 	int uSkinningFirstBoneOffsetInTex; ///< The row (integer) in @uSkinningBones of the fist bone for the mesh that is being drawn.
+
+	// Instancing.
+	int uInstancingFirstRowInTex; ///< The row (integer) in @uInstanceData of the 1st instance that is being drawn.
+
+	// Clustered lighting.
+	int uEvalClusteredLights; ///< Non-zero if the lights of the clusters should be added, only the 1st pass of the draw call does it.
+
+	// Vertex attributes dequantization, identity if the mesh isn't quantized.
+	float4 uPositionDequantScale;
+	float4 uPositionDequantOffset;
+	float4 uUvDequantScaleOffset; ///< xy is the scale, zw is the offset.
+
+	// Clustered lighting, see lib_light_clusters.shader.
+	float4 uLightClustersGridSize;
+	float4 uLightClustersDepthParams;
+
+	// Cascaded shadow maps, see getShadowCascade.
+	float4 uShadowCascade0;
+	float4 uShadowCascade1;
+	float4 uShadowCascade2;
+	float4 uShadowCascade3;
 };
 
 // Material.
@@ -69,6 +102,18 @@ uniform samplerCUBE uPointLightShadowMap;
 	uniform sampler2D uSkinningBones;
 #endif
 
+// Instancing.
+#if OPT_Instancing == kInstancing_Yes
+	uniform sampler2D uInstanceData;
+#endif
+
+// Clustered lighting.
+#if OPT_Lighting == kLightingClustered
+	uniform sampler2D uLightClusters;
+	uniform sampler2D uLightClusterIndices;
+	uniform sampler2D uClusteredLights;
+#endif
+
 //--------------------------------------------------------------------
 //
 //--------------------------------------------------------------------
@@ -81,6 +126,67 @@ float2 directionToUV_Spherical(float3 dir)
     return uv;
 }
 
+//--------------------------------------------------------------------
+// Shadows
+//--------------------------------------------------------------------
+float2 shadowNdcToUv(float2 ndc) {
+#ifndef OpenGL
+	return ndc * float2(0.5, -0.5) + float2(0.5, 0.5);
+#else
+	return ndc * float2(0.5, 0.5) + float2(0.5, 0.5);
+#endif
+}
+
+/// Returns the fraction of the PCF samples around @uv that are in shadow.
+/// The samples are clamped to [uvMin;uvMax], the area of the shadow map that is being sampled.
+float sampleShadowMapPCF(sampler2D shadowMap, float2 uv, float2 uvMin, float2 uvMax, float currentZ) {
+	const float2 pixelSizeUVShadow = (1.0 / tex2Dsize(shadowMap));
+
+	float samplesInShadow = 0.f;
+	const int pcfWidth = 1;
+	const int pcfTotalSamples = (2 * pcfWidth + 1) * (2 * pcfWidth + 1);
+	for (int ix = -pcfWidth; ix <= pcfWidth; ix += 1) {
+		for (int iy = -pcfWidth; iy <= pcfWidth; iy += 1) {
+			const float2 sampleUv = clamp(uv + float2(float(ix) * pixelSizeUVShadow.x, float(iy) * pixelSizeUVShadow.y), uvMin, uvMax);
+			const float shadowZ = tex2D(shadowMap, sampleUv).x;
+			if (shadowZ < currentZ) {
+				samplesInShadow += 1.f;
+			}
+		}
+	}
+
+	return samplesInShadow / (float)(pcfTotalSamples);
+}
+
+/// Returns the parameters of a cascade of a cascaded shadow map, see @computeShadowCascadeNdcTransform.
+/// (x, y, z) transform the normalized device coordinates of @lightShadowMapProjView to the cascade: ndc * x + (y, z).
+/// w is the view distance where the cascade ends.
+float4 getShadowCascade(int iCascade) {
+	if (iCascade == 0) {
+		return uShadowCascade0;
+	} else if (iCascade == 1) {
+		return uShadowCascade1;
+	} else if (iCascade == 2) {
+		return uShadowCascade2;
+	}
+	return uShadowCascade3;
+}
+
+/// Returns the fraction of the PCF samples in shadow for the specified cascade.
+/// The cascades are placed next to each other in the shadow map texture.
+float sampleShadowCascade(float2 ndc, int iCascade, int numCascades, float currentZ) {
+	const float4 cascade = getShadowCascade(iCascade);
+	float2 uv = shadowNdcToUv(ndc * cascade.x + cascade.yz);
+	uv.x = (uv.x + float(iCascade)) / float(numCascades);
+
+	// Do not let the PCF samples leak into the neighbouring cascades.
+	const float2 halfPixelSizeUV = 0.5 / tex2Dsize(lightShadowMap);
+	const float2 uvMin = float2(float(iCascade) / float(numCascades) + halfPixelSizeUV.x, halfPixelSizeUV.y);
+	const float2 uvMax = float2(float(iCascade + 1) / float(numCascades) - halfPixelSizeUV.x, 1.0 - halfPixelSizeUV.y);
+
+	return sampleShadowMapPCF(lightShadowMap, uv, uvMin, uvMax, currentZ);
+}
+
 //--------------------------------------------------------------------
 // Vertex Shader
 //--------------------------------------------------------------------
@@ -91,10 +197,18 @@ struct VS_INPUT {
 	float2 a_uv : a_uv;
 #endif
 
+#if OPT_NormalEncoding == kNormalEncoding_Octahedral
+	float2 a_normal : a_normal;
+	#if OPT_UseNormalMap == 1
+	float2 a_tangent : a_tangent;
+	float2 a_binormal : a_binormal;
+	#endif
+#else
 	float3 a_normal : a_normal;
-#if OPT_UseNormalMap == 1
+	#if OPT_UseNormalMap == 1
 	float3 a_tangent : a_tangent;
 	float3 a_binormal : a_binormal;
+	#endif
 #endif
 
 #if OPT_DiffuseColorSrc == kDiffuseColorSrcVertex
@@ -105,6 +219,10 @@ struct VS_INPUT {
 	int4 a_bonesIds : a_bonesIds;
 	float4 a_bonesWeights : a_bonesWeights;
 #endif
+
+#if OPT_Instancing == kInstancing_Yes
+	int a_instanceId : SV_InstanceID;
+#endif
 };
 
 struct VS_OUTPUT {
@@ -123,13 +241,29 @@ struct VS_OUTPUT {
 #if OPT_DiffuseColorSrc == kDiffuseColorSrcVertex
 	float4 v_vertexDiffuse : v_vertexDiffuse;
 #endif
+
+#if OPT_Instancing == kInstancing_Yes
+	float4 v_instanceTint : v_instanceTint;
+#endif
 };
 
 VS_OUTPUT vsMain(VS_INPUT vsin) {
 	VS_OUTPUT res;
 	
-	float3 vertexPosOs = vsin.a_position;
+	float3 vertexPosOs = vsin.a_position * uPositionDequantScale.xyz + uPositionDequantOffset.xyz;
+#if OPT_NormalEncoding == kNormalEncoding_Octahedral
+	float3 normalOs = libQuantization_octahedralDecode(vsin.a_normal);
+	#if OPT_UseNormalMap == 1
+	const float3 tangentOs = libQuantization_octahedralDecode(vsin.a_tangent);
+	const float3 binormalOs = libQuantization_octahedralDecode(vsin.a_binormal);
+	#endif
+#else
 	float3 normalOs = vsin.a_normal;
+	#if OPT_UseNormalMap == 1
+	const float3 tangentOs = vsin.a_tangent;
+	const float3 binormalOs = vsin.a_binormal;
+	#endif
+#endif
 
 	// If there is a skinning avilable apply it to the vertex in object space.
 #if OPT_HasVertexSkinning == kHasVertexSkinning_Yes
@@ -138,21 +272,31 @@ VS_OUTPUT vsMain(VS_INPUT vsin) {
 	normalOs = mul(skinMtx, float4(normalOs, 0.0)).xyz; // TODO: Proper normal transfrom by inverse transpose.
 #endif
 	
+	// When instancing the world transform and the tint of each instance come from the instance data texture.
+#if OPT_Instancing == kInstancing_Yes
+	const int instanceRow = uInstancingFirstRowInTex + vsin.a_instanceId;
+	const float4x4 instanceWorld = libInstancing_getWorld(instanceRow, uInstanceData);
+	res.v_instanceTint = libInstancing_getTint(instanceRow, uInstanceData);
+#else
+	const float4x4 instanceWorld = world;
+#endif
+
 	// Pass the varyings to the next shader.
-	const float4 worldPos = mul(world, float4(vertexPosOs, 1.0));
-	const float4 worldNormal = mul(world, float4(normalOs, 0.0)); // TODO: Proper normal transfrom by inverse transpose.
+	const float4 worldPos = mul(instanceWorld, float4(vertexPosOs, 1.0));
+	const float4 worldNormal = mul(instanceWorld, float4(normalOs, 0.0)); // TODO: Proper normal transfrom by inverse transpose.
 
 	res.v_normal = worldNormal.xyz;
 	res.v_posWS = worldPos.xyz;
 	res.SV_Position = mul(projView, worldPos);
 
 #if OPT_UseNormalMap == 1
-	res.v_tangent = mul(world, float4(vsin.a_tangent, 0.0)).xyz;
-	res.v_binormal = mul(world, float4(vsin.a_binormal, 0.0)).xyz;
+	res.v_tangent = mul(instanceWorld, float4(tangentOs, 0.0)).xyz;
+	res.v_binormal = mul(instanceWorld, float4(binormalOs, 0.0)).xyz;
 #endif
 
 #if (OPT_UseNormalMap == 1) || (OPT_DiffuseColorSrc == kDiffuseColorSrcTexture)
-	res.v_uv = mul(uvwTransform, float4(vsin.a_uv, 0.0, 1.0)).xy;
+	const float2 uv = vsin.a_uv * uUvDequantScaleOffset.xy + uUvDequantScaleOffset.zw;
+	res.v_uv = mul(uvwTransform, float4(uv, 0.0, 1.0)).xy;
 #endif
 
 #if OPT_DiffuseColorSrc == kDiffuseColorSrcVertex
@@ -166,8 +310,33 @@ VS_OUTPUT vsMain(VS_INPUT vsin) {
 // Pixel Shader
 //--------------------------------------------------------------------
 #ifdef SGE_PIXEL_SHADER
+#if OPT_Lighting != kLightingForceNoLighting
+/// Computes the light reflected towards the viewer by the Cook-Torrance BRDF for a single light.
+float3 shadeGGX(float3 N, float3 V, float3 L, float3 lightRadiance, float3 diffuseColor, float metallic, float roughness, float3 F0) {
+	const float NdotL = max(dot(N, L), 0.0);
+	const float3 H = normalize(V + L);
+
+	const float NDF = DistributionGGX(N, H, roughness);
+	const float G = GeometrySmith(N, V, L, roughness);
+	const float3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);
+
+	const float3 kS = F;
+	const float3 kD = (float3(1.f, 1.f, 1.f) - kS) * (1.0 - metallic);
+
+	const float3 numerator = NDF * G * F;
+	const float denominator = 4.f * max(dot(N, V), 0.f) * NdotL;
+	const float3 specular = numerator / max(denominator, 0.001f);
+
+	return (kD * diffuseColor / PI + specular) * lightRadiance * NdotL;
+}
+#endif
+
 float4 psMain(VS_OUTPUT IN) : SV_Target0 {
+#if OPT_Instancing == kInstancing_Yes
+	float4 diffuseColor = pow(IN.v_instanceTint, 2.2f);
+#else
 	float4 diffuseColor = pow(uDiffuseColorTint, 2.2f);
+#endif
 
 #if OPT_DiffuseColorSrc == kDiffuseColorSrcVertex
 	diffuseColor = IN.v_vertexDiffuse;
@@ -219,26 +388,26 @@ float4 psMain(VS_OUTPUT IN) : SV_Target0 {
 	float3 lighting = float3(0.f, 0.f, 0.f);
 #if OPT_Lighting != kLightingForceNoLighting
 	// Lighting.
-	const int fLightFlags = (int)lightColorWFlag.w;
-	const bool dontLight = (fLightFlags & kLightFlt_DontLight) != 0;
-	if (dontLight == false) {
-		// GGX Material crap:
-		float metallic = uMetalness;
+	// GGX Material crap:
+	float metallic = uMetalness;
 #if (OPT_UseNormalMap == 1) || (OPT_DiffuseColorSrc == kDiffuseColorSrcTexture)
-		if ((uPBRMtlFlags & kPBRMtl_Flags_HasMetalnessMap) != 0) {
-			metallic *= pow(tex2D(uTexMetalness, IN.v_uv).r, 2.2f);
-		}
+	if ((uPBRMtlFlags & kPBRMtl_Flags_HasMetalnessMap) != 0) {
+		metallic *= pow(tex2D(uTexMetalness, IN.v_uv).r, 2.2f);
+	}
 #endif
 
-		float roughness = uRoughness;
+	float roughness = uRoughness;
 #if (OPT_UseNormalMap == 1) || (OPT_DiffuseColorSrc == kDiffuseColorSrcTexture)
-		if ((uPBRMtlFlags & kPBRMtl_Flags_HasRoughnessMap) != 0) {
-			roughness *= pow(tex2D(uTexRoughness, IN.v_uv).r, 2.2f);
-		}
+	if ((uPBRMtlFlags & kPBRMtl_Flags_HasRoughnessMap) != 0) {
+		roughness *= pow(tex2D(uTexRoughness, IN.v_uv).r, 2.2f);
+	}
 #endif
 
-		const float3 F0 = lerp(float3(0.04f, 0.04f, 0.04f), diffuseColor.xyz, metallic);
+	const float3 F0 = lerp(float3(0.04f, 0.04f, 0.04f), diffuseColor.xyz, metallic);
 
+	const int fLightFlags = (int)lightColorWFlag.w;
+	const bool dontLight = (fLightFlags & kLightFlt_DontLight) != 0;
+	if (dontLight == false) {
 		float3 lightRadiance = float3(0.f, 0.f, 0.f);
 		float3 L = float3(0.f, 0.f, 0.f);
 
@@ -295,71 +464,61 @@ float4 psMain(VS_OUTPUT IN) : SV_Target0 {
 				const float4 pixelShadowProj = mul(lightShadowMapProjView, float4(IN.v_posWS, 1.f));
 				const float4 pixelShadowNDC = pixelShadowProj / pixelShadowProj.w;
 
-				float2 shadowMapSampleLocation = pixelShadowNDC.xy;
 #ifndef OpenGL
-				shadowMapSampleLocation = shadowMapSampleLocation * float2(0.5, -0.5) + float2(0.5, 0.5);
+				const float currentZ = pixelShadowNDC.z;
 #else
-				shadowMapSampleLocation = shadowMapSampleLocation * float2(0.5, 0.5) + float2(0.5, 0.5);
+				const float currentZ = (pixelShadowNDC.z + 1.0) * 0.5;
 #endif
 
-				const float2 pixelSizeUVShadow = (1.0 / tex2Dsize(lightShadowMap));
-
-				float samplesWeights = 0.f;
-				const int pcfWidth = 1;
-				const int pcfTotalSamples = (2 * pcfWidth + 1) * (2 * pcfWidth + 1);
-				for (int ix = -pcfWidth; ix <= pcfWidth; ix += 1) {
-					for (int iy = -pcfWidth; iy <= pcfWidth; iy += 1) {
-						const float2 sampleUv =
-						    shadowMapSampleLocation + float2(float(ix) * pixelSizeUVShadow.x, float(iy) * pixelSizeUVShadow.y);
-
-#ifndef OpenGL
-						const float shadowZ = tex2D(lightShadowMap, sampleUv).x;
-						const float currentZ = pixelShadowNDC.z;
-#else
-						const float shadowZ = tex2D(lightShadowMap, sampleUv).x;
-						const float currentZ = (pixelShadowNDC.z + 1.0) * 0.5;
-#endif
-
-						float fadeOutMult = 1.f;
-
-						// Make directional light fade as they capture some limited area, and when the shadow map ends in the distance
-						// this will hide the rough edge.
-						if (lightPosF4.w == 1.f) {
-							const float distanceFromCamera = min(length(IN.v_posWS - cameraPositionWs), lightShadowRange.x);
-							const float fadeStart = lightShadowRange.x * 0.90f;
-							if (distanceFromCamera > fadeStart) {
-								fadeOutMult = lerp(1.f, 0.f, (distanceFromCamera - fadeStart) / (lightShadowRange.x * 0.1f));
+				const int numCascades = (int)lightShadowRange.y;
+				if (numCascades == 0) {
+					// The shadow map uses the whole texture.
+					const float2 uv = shadowNdcToUv(pixelShadowNDC.xy);
+					shadowScale = 1.f - sampleShadowMapPCF(lightShadowMap, uv, float2(0.0, 0.0), float2(1.0, 1.0), currentZ);
+				} else {
+					// Cascaded shadow map, pick the cascade based on the view distance.
+					const float viewDistance = dot(IN.v_posWS - cameraPositionWs.xyz, uCameraLookDirWs.xyz);
+
+					int iCascade = -1;
+					float cascadeStart = 0.f;
+					for (int t = 0; t < numCascades; t += 1) {
+						if (iCascade < 0) {
+							if (viewDistance <= getShadowCascade(t).w) {
+								iCascade = t;
+							} else {
+								cascadeStart = getShadowCascade(t).w;
 							}
 						}
+					}
 
-						if (shadowZ < currentZ || NdotL <= 0.0) {
-							samplesWeights += fadeOutMult;
+					// Past the last cascade there are no shadows.
+					if (iCascade >= 0) {
+						float inShadow = sampleShadowCascade(pixelShadowNDC.xy, iCascade, numCascades, currentZ);
+
+						// Blend with the next cascade at the end of the current one to hide the seam.
+						// The last cascade fades out, this hides the rough edge where the shadows end.
+						const float cascadeEnd = getShadowCascade(iCascade).w;
+						const float blendStart = cascadeEnd - (cascadeEnd - cascadeStart) * lightShadowRange.z;
+						if (viewDistance > blendStart) {
+							const float k = saturate((viewDistance - blendStart) / max(cascadeEnd - blendStart, 1e-6f));
+							float nextInShadow = 0.f;
+							if (iCascade + 1 < numCascades) {
+								nextInShadow = sampleShadowCascade(pixelShadowNDC.xy, iCascade + 1, numCascades, currentZ);
+							}
+							inShadow = lerp(inShadow, nextInShadow, k);
 						}
+
+						shadowScale = 1.f - inShadow;
 					}
 				}
-
-				shadowScale = 1.f - (samplesWeights / (float)(pcfTotalSamples));
 			}
 		}
 #endif // shadow map enabled
 
 		if (NdotL > 1e-6f && shadowScale > 1e-6f) {
-			const float3 H = normalize(V + L);
-
 			// cook-torrance brdf
 #if 1
-			const float NDF = DistributionGGX(N, H, roughness);
-			const float G = GeometrySmith(N, V, L, roughness);
-			const float3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);
-
-			const float3 kS = F;
-			const float3 kD = (float3(1.f, 1.f, 1.f) - kS) * (1.0 - metallic);
-
-			const float3 numerator = NDF * G * F;
-			const float denominator = 4.f * max(dot(N, V), 0.f) * max(dot(N, L), 0.f);
-			const float3 specular = numerator / max(denominator, 0.001f);
-
-			lighting += shadowScale * (kD * diffuseColor.xyz / PI + specular) * lightRadiance * NdotL;
+			lighting += shadowScale * shadeGGX(N, V, L, lightRadiance, diffuseColor.xyz, metallic, roughness, F0);
 #else
 			const float3 lightLighting = shadowScale * diffuseColor.xyz * lightRadiance * NdotL;
 			lighting += lightLighting;
@@ -371,9 +530,43 @@ float4 psMain(VS_OUTPUT IN) : SV_Target0 {
 			lighting += ((normal.y * 0.5f + 0.5f) * ambience + ambience * 0.05f) * diffuseColor.xyz;
 		}
 	}
+
+#if OPT_Lighting == kLightingClustered
+	// The point and spot lights without shadows come from the cluster of the pixel.
+	if (uEvalClusteredLights != 0) {
+		const int2 cluster = libLightClusters_findCluster(
+		    IN.v_posWS, projView, cameraPositionWs.xyz, uCameraLookDirWs.xyz, uLightClustersGridSize, uLightClustersDepthParams);
+		const int2 clusterLights = libLightClusters_getClusterLights(cluster, uLightClusters);
+
+		for (int iIndex = clusterLights.x; iIndex < clusterLights.x + clusterLights.y; ++iIndex) {
+			const int iLight = libLightClusters_getLightIndex(iIndex, uLightClusterIndices);
+			const float4 clLightPosAndType = libLightClusters_fetch(uClusteredLights, 0, iLight);
+			const float4 clSpotDirAndCosAngle = libLightClusters_fetch(uClusteredLights, 1, iLight);
+			const float4 clColorAndRange = libLightClusters_fetch(uClusteredLights, 2, iLight);
+
+			// Same attenuation as the point and spot lights above.
+			const float3 toLightWs = clLightPosAndType.xyz - IN.v_posWS;
+			const float clRange2 = clColorAndRange.w * clColorAndRange.w;
+			const float k = 1.f - saturate(dot(toLightWs, toLightWs) / clRange2);
+			float attenuation = saturate(k * k);
+			const float3 clL = normalize(toLightWs);
+
+			if (clLightPosAndType.w == 2.f) {
+				const float spotLightAngleCosine = clSpotDirAndCosAngle.w;
+				const float visibilityCosine = saturate(dot(clL, -clSpotDirAndCosAngle.xyz));
+				const float c = saturate(visibilityCosine - spotLightAngleCosine);
+				attenuation *= saturate(c / (1.f - spotLightAngleCosine));
+			}
+
+			if (attenuation > 1e-6f && dot(N, clL) > 1e-6f) {
+				lighting += shadeGGX(N, V, clL, clColorAndRange.xyz * attenuation, diffuseColor.xyz, metallic, roughness, F0);
+			}
+		}
+	}
+#endif
 #endif
 
-#if OPT_Lighting == kLightingShaded
+#if (OPT_Lighting == kLightingShaded) || (OPT_Lighting == kLightingClustered)
 	const float3 ambientLightColorLinear = ambientLightColor; // pow(ambientLightColor, 2.2f);
 	const float3 fakeAmbientDetail =
 	    ((normal.y * 0.5f + 0.5f) * ambientLightColorLinear + ambientLightColorLinear * 0.05f) * diffuseColor.xyz;
@@ -0,0 +1,53 @@
+#ifndef SGE_LIB_INSTANCING
+#define SGE_LIB_INSTANCING
+
+/// The instance data texture has a row for each instance, each row has kInstanceDataNumTexels RGBA texels.
+/// The first 4 texels are the columns of the world transform of the instance, the 5th is the tint of the instance.
+/// The rows of all instanced draw calls are in the same texture, the row of the 1st instance of the draw call is specified by the user.
+
+/// Samples a single texel of an instance.
+/// @param iRow the row that contains the data for the instance.
+/// @param iTexel the texel in the row.
+/// @param instanceDataTex the texture containing the data of the instances.
+/// @param instanceDataTexSizeYAsFloat is the height of the @instanceDataTex casted to float.
+float4 libInstancing_getTexel(int iRow, int iTexel, sampler2D instanceDataTex, float instanceDataTexSizeYAsFloat) {
+	const float u = ((float)iTexel + 0.5f) / (float)kInstanceDataNumTexels;
+	const float v = ((float)iRow + 0.5f) / instanceDataTexSizeYAsFloat;
+	return tex2Dlod(instanceDataTex, float4(u, v, 0.f, 0.f));
+}
+
+/// Retrieves the world transform of the instance stored at the row @iRow.
+float4x4 libInstancing_getWorld(int iRow, sampler2D instanceDataTex) {
+	const float fInstanceDataTexSizeY = (float)(tex2Dsize(instanceDataTex).y);
+
+	const float4 c0 = libInstancing_getTexel(iRow, 0, instanceDataTex, fInstanceDataTexSizeY);
+	const float4 c1 = libInstancing_getTexel(iRow, 1, instanceDataTex, fInstanceDataTexSizeY);
+	const float4 c2 = libInstancing_getTexel(iRow, 2, instanceDataTex, fInstanceDataTexSizeY);
+	const float4 c3 = libInstancing_getTexel(iRow, 3, instanceDataTex, fInstanceDataTexSizeY);
+
+	// Caution:
+	// The matrices are initialized row-by-row in HLSL, see the same comment in lib_skinning.shader.
+#ifndef OpenGL
+	const float4x4 mtx = float4x4(
+		c0.x, c1.x, c2.x, c3.x,
+		c0.y, c1.y, c2.y, c3.y,
+		c0.z, c1.z, c2.z, c3.z,
+		c0.w, c1.w, c2.w, c3.w);
+#else
+	const float4x4 mtx = float4x4(
+		c0.x, c0.y, c0.z, c0.w,
+		c1.x, c1.y, c1.z, c1.w,
+		c2.x, c2.y, c2.z, c2.w,
+		c3.x, c3.y, c3.z, c3.w);
+#endif
+
+	return mtx;
+}
+
+/// Retrieves the tint (the diffuse color of the material) of the instance stored at the row @iRow.
+float4 libInstancing_getTint(int iRow, sampler2D instanceDataTex) {
+	const float fInstanceDataTexSizeY = (float)(tex2Dsize(instanceDataTex).y);
+	return libInstancing_getTexel(iRow, 4, instanceDataTex, fInstanceDataTexSizeY);
+}
+
+#endif
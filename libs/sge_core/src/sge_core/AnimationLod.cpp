@@ -0,0 +1,125 @@
+#include <algorithm>
+
+#include "AnimationLod.h"
+
+namespace sge {
+
+//--------------------------------------------------------------
+// AnimationLodSettings
+//--------------------------------------------------------------
+AnimationLodSettings AnimationLodSettings::getDefault() {
+	AnimationLodSettings settings;
+	settings.levels.push_back(AnimationLodLevel(0.f, 1, false));
+	settings.levels.push_back(AnimationLodLevel(20.f, 2, false));
+	settings.levels.push_back(AnimationLodLevel(40.f, 4, true));
+	settings.levels.push_back(AnimationLodLevel(80.f, 8, true));
+	return settings;
+}
+
+const AnimationLodLevel& AnimationLodSettings::findLevel(const float distanceToCamera) const {
+	static const AnimationLodLevel fullDetailLevel;
+
+	const AnimationLodLevel* result = &fullDetailLevel;
+	for (const AnimationLodLevel& level : levels) {
+		if (distanceToCamera >= level.minDistance) {
+			result = &level;
+		} else {
+			break;
+		}
+	}
+
+	return *result;
+}
+
+//--------------------------------------------------------------
+// AnimationLodState
+//--------------------------------------------------------------
+void AnimationLodState::update(const AnimationLodSettings& settings, const float distanceToCamera, const bool isVisible) {
+	m_level = settings.findLevel(distanceToCamera);
+	m_bonesMaskMinImportance = settings.bonesMaskMinImportance;
+	m_isFrozen = settings.freezeWhenCulled && isVisible == false && m_hasEvaluated;
+}
+
+const ubyte* AnimationLodState::getBonesMask(const Model& model) {
+	if (model.isNodesImportanceComputed() == false) {
+		return nullptr;
+	}
+
+	if (m_bonesMaskModel != &model || m_bonesMaskThreshold != m_bonesMaskMinImportance || m_bonesMask.size() != size_t(model.numNodes())) {
+		m_bonesMaskModel = &model;
+		m_bonesMaskThreshold = m_bonesMaskMinImportance;
+		m_bonesMask.resize(model.numNodes());
+
+		// The nodes that move no vertices are usually sockets, attachment points or IK targets and the gameplay might
+		// depend on their transform, so they are always sampled. Their parents are needed to compute it.
+		const std::vector<float>& importance = model.getNodesImportance();
+		for (int iNode = 0; iNode < model.numNodes(); ++iNode) {
+			m_bonesMask[iNode] = (importance[iNode] >= m_bonesMaskMinImportance || importance[iNode] == 0.f) ? 1 : 0;
+		}
+
+		const std::vector<int>& nodesOrder = model.getNodesParentFirstOrder();
+		for (auto itrNode = nodesOrder.rbegin(); itrNode != nodesOrder.rend(); ++itrNode) {
+			const int parentIndex = model.getNodeParentIndex(*itrNode);
+			if (parentIndex >= 0 && m_bonesMask[*itrNode] != 0) {
+				m_bonesMask[parentIndex] = 1;
+			}
+		}
+	}
+
+	return m_bonesMask.data();
+}
+
+bool AnimationLodState::evaluateNodes(EvaluatedModel& evalModel,
+                                      const EvalMomentSets evalMoments[],
+                                      const int numMoments,
+                                      const uint32 frameIndex) {
+	if (evalModel.isInitialized() == false) {
+		return false;
+	}
+
+	const ubyte* const bonesMask = m_level.useBonesMask ? getBonesMask(*evalModel.m_model) : nullptr;
+	const int updateInterval = std::max(m_level.updateInterval, 1);
+	const uint32 phase = uint32(std::max(m_phase, 0));
+
+	const bool hasSkippedFrames = m_lastFrameIndex + 1 != frameIndex;
+	m_lastFrameIndex = frameIndex;
+	m_hasEvaluated = true;
+
+	// Models updated every frame need no interpolation.
+	if (updateInterval == 1) {
+		m_hasSampledPoses = false;
+		return evalModel.evaluateNodes(evalMoments, numMoments, bonesMask);
+	}
+
+	// The interpolation needs two poses of the current animation. After the model was frozen or got evaluated
+	// every frame the old poses are no longer valid, so both get snapped to the current one.
+	const bool needsSnap = m_hasSampledPoses == false || hasSkippedFrames || m_sampledModel != evalModel.m_model;
+	const uint32 step = (frameIndex + phase) % uint32(updateInterval);
+
+	if (needsSnap) {
+		if (evalModel.evaluateLocalPose(evalMoments, numMoments, bonesMask) == false) {
+			return false;
+		}
+		m_nextPose = evalModel.getLocalPose();
+		m_prevPose = m_nextPose;
+		m_hasSampledPoses = true;
+		m_sampledModel = evalModel.m_model;
+	} else if (step == 0) {
+		if (evalModel.evaluateLocalPose(evalMoments, numMoments, bonesMask) == false) {
+			return false;
+		}
+		std::swap(m_prevPose, m_nextPose);
+		m_nextPose = evalModel.getLocalPose();
+	}
+
+	// Reach the last sampled pose right before the next sample.
+	const float t = float(step + 1) / float(updateInterval);
+	if (t >= 1.f) {
+		return evalModel.evaluateNodesFromPose(m_nextPose);
+	}
+
+	AnimationPoseBlender::interpolate(m_interpolatedPose, m_prevPose, m_nextPose, t);
+	return evalModel.evaluateNodesFromPose(m_interpolatedPose);
+}
+
+} // namespace sge
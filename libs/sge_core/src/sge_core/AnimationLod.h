@@ -0,0 +1,103 @@
+#pragma once
+
+#include <vector>
+
+#include "sge_core/model/AnimationPose.h"
+#include "sge_core/model/EvaluatedModel.h"
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+struct AnimationSystem;
+
+/// @brief Describes how often and how detailed the animation of a model is evaluated when it is far enough from the camera.
+struct AnimationLodLevel {
+	AnimationLodLevel() = default;
+	AnimationLodLevel(const float minDistance, const int updateInterval, const bool useBonesMask)
+	    : minDistance(minDistance)
+	    , updateInterval(updateInterval)
+	    , useBonesMask(useBonesMask) {}
+
+	/// The level is used for models at least this far from the camera.
+	float minDistance = 0.f;
+	/// The animations get sampled once every this many frames, the frames in between interpolate the last two sampled poses.
+	int updateInterval = 1;
+	/// If true only the important nodes of the model get sampled, see @AnimationLodSettings::bonesMaskMinImportance.
+	bool useBonesMask = false;
+};
+
+/// @brief The levels of detail used for the animations of the models, based on their distance to the camera.
+struct SGE_CORE_API AnimationLodSettings {
+	/// A few levels that work for human sized characters.
+	static AnimationLodSettings getDefault();
+
+	/// Returns the level to be used for a model at the specified distance to the camera.
+	const AnimationLodLevel& findLevel(const float distanceToCamera) const;
+
+  public:
+	/// Sorted by @AnimationLodLevel::minDistance. If empty every model gets evaluated fully each frame.
+	std::vector<AnimationLodLevel> levels;
+
+	/// The nodes with @Model::getNodesImportance smaller than this are not sampled in the levels that use the bones mask.
+	/// Their children are never more important, so whole branches (fingers, face, accessories) get skipped.
+	/// The nodes that move no vertices (sockets, attachment points, IK targets) and their parents are always sampled.
+	float bonesMaskMinImportance = 0.02f;
+
+	/// If true the models that are not visible keep their last evaluated pose and are not evaluated at all.
+	bool freezeWhenCulled = true;
+};
+
+/// @brief The animation level of detail state of a single model, it needs to be kept between the frames.
+/// Each frame the user calls @update with the distance of the model to the camera and its visibility and then
+/// passes the state to @AnimationSystem::addModel.
+///
+/// In the levels that update less often the sampled poses lag behind the animation by up to
+/// @AnimationLodLevel::updateInterval frames, as the displayed pose is interpolated between the last two sampled poses.
+/// The models get different phases, so only a part of the distant models get sampled each frame.
+struct SGE_CORE_API AnimationLodState {
+	/// @brief Picks the level of detail for the current frame.
+	/// @param [in] isVisible false if the model got culled. A model is frozen only after its first evaluation.
+	void update(const AnimationLodSettings& settings, const float distanceToCamera, const bool isVisible);
+
+	const AnimationLodLevel& getLevel() const { return m_level; }
+
+	/// Returns true if the model should not be evaluated this frame.
+	bool isFrozen() const { return m_isFrozen; }
+
+	/// @brief Evaluates the nodes of the model (see @EvaluatedModel::evaluateNodes) for the specified frame,
+	/// sampling the moments only if the level of detail needs it. Called by @AnimationSystem.
+	/// @param [in] frameIndex increases by one each frame, used to spread the sampling of the models across the frames.
+	bool evaluateNodes(EvaluatedModel& evalModel, const EvalMomentSets evalMoments[], const int numMoments, const uint32 frameIndex);
+
+	/// Forgets the sampled poses, the next evaluation samples the moments.
+	void reset() { m_hasSampledPoses = false; }
+
+  private:
+	/// Returns the nodes mask for @EvaluatedModel::evaluateNodes, recomputed only when the model or the threshold change.
+	const ubyte* getBonesMask(const Model& model);
+
+	friend AnimationSystem;
+
+  private:
+	AnimationLodLevel m_level;
+	float m_bonesMaskMinImportance = 0.f;
+	bool m_isFrozen = false;
+	bool m_hasEvaluated = false;
+
+	/// Assigned by @AnimationSystem the first time the model gets added, -1 if not assigned yet.
+	int m_phase = -1;
+
+	bool m_hasSampledPoses = false;
+	const Model* m_sampledModel = nullptr;
+	uint32 m_lastFrameIndex = 0;
+	AnimationPose m_prevPose;
+	AnimationPose m_nextPose;
+	AnimationPose m_interpolatedPose;
+
+	const Model* m_bonesMaskModel = nullptr;
+	float m_bonesMaskThreshold = -1.f;
+	std::vector<ubyte> m_bonesMask;
+};
+
+} // namespace sge
@@ -0,0 +1,82 @@
+#include "AnimationSystem.h"
+
+namespace sge {
+
+void AnimationSystem::addModel(EvaluatedModel* const evalModel,
+                               const EvalMomentSets* const evalMoments,
+                               const int numMoments,
+                               AnimationLodState* const lodState) {
+	if (evalModel == nullptr || evalModel->isInitialized() == false) {
+		sgeAssert(false && "Only initialized models could be evaluated");
+		return;
+	}
+
+	if (lodState != nullptr) {
+		if (lodState->isFrozen()) {
+			return;
+		}
+
+		if (lodState->m_phase < 0) {
+			lodState->m_phase = m_nextLodPhase++;
+		}
+	}
+
+	ModelToEvaluate modelToEval;
+	modelToEval.evalModel = evalModel;
+	modelToEval.firstMoment = int(m_moments.size());
+	modelToEval.numMoments = (evalMoments != nullptr) ? numMoments : 0;
+	modelToEval.lodState = lodState;
+
+	for (int iMoment = 0; iMoment < modelToEval.numMoments; ++iMoment) {
+		m_moments.push_back(evalMoments[iMoment]);
+	}
+
+	m_models.push_back(modelToEval);
+}
+
+void AnimationSystem::evaluate() {
+	evaluateNodesAndPalettes();
+	finishEvaluation();
+}
+
+void AnimationSystem::evaluateNodesAndPalettes() {
+	const auto evaluateModel = [this](const int iModel) -> void {
+		const ModelToEvaluate& modelToEval = m_models[iModel];
+		const EvalMomentSets* const moments = modelToEval.numMoments > 0 ? &m_moments[modelToEval.firstMoment] : nullptr;
+		if (modelToEval.lodState != nullptr) {
+			modelToEval.lodState->evaluateNodes(*modelToEval.evalModel, moments, modelToEval.numMoments, m_frameIndex);
+		} else {
+			modelToEval.evalModel->evaluateNodes(moments, modelToEval.numMoments);
+		}
+		modelToEval.evalModel->computeSkinningPalette();
+	};
+
+	if (useWorkerThreads && m_models.size() > 1) {
+		if (m_threadPool == nullptr) {
+			m_threadPool.reset(new ThreadPool(numWorkerThreads >= 0 ? numWorkerThreads : ThreadPool::getDefaultNumWorkers()));
+		}
+
+		m_threadPool->parallelFor(int(m_models.size()), evaluateModel);
+	} else {
+		for (int iModel = 0; iModel < int(m_models.size()); ++iModel) {
+			evaluateModel(iModel);
+		}
+	}
+
+	m_frameIndex++;
+}
+
+void AnimationSystem::finishEvaluation() {
+	for (const ModelToEvaluate& modelToEval : m_models) {
+		modelToEval.evalModel->finishEvaluation();
+	}
+
+	clear();
+}
+
+void AnimationSystem::clear() {
+	m_models.clear();
+	m_moments.clear();
+}
+
+} // namespace sge
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "sge_core/AnimationLod.h"
+#include "sge_core/model/EvaluatedModel.h"
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/utils/ThreadPool.h"
+
+namespace sge {
+
+/// @brief Evaluates the animations of many models at once, spreading the work across worker threads.
+/// Each frame the user adds the models that need to be evaluated with @addModel and then calls @evaluate.
+/// The sampling, the blending and the skinning palettes (see @EvaluatedModel::evaluateNodes and
+/// @EvaluatedModel::computeSkinningPalette) are computed in parallel, after that the GPU uploads are done serially
+/// on the calling thread (see @EvaluatedModel::finishEvaluation).
+///
+/// A model must not be added more than once per frame, and the models must be initialized (including their animation donors)
+/// before being added, as loading assets isn't allowed during the parallel part.
+struct SGE_CORE_API AnimationSystem {
+	AnimationSystem() = default;
+
+	AnimationSystem(const AnimationSystem&) = delete;
+	AnimationSystem& operator=(const AnimationSystem&) = delete;
+
+	/// @brief Adds a model to be evaluated by the next call to @evaluate. The moments are copied.
+	/// Pass nullptr and 0 moments to evaluate the model in its static pose.
+	/// @param [in,out] lodState optional level of detail of the animation of the model, updated by the user (see @AnimationLodState::update)
+	///                 and kept between the frames. Frozen models are not added. If nullptr the model is fully evaluated.
+	void addModel(EvaluatedModel* const evalModel,
+	              const EvalMomentSets* const evalMoments,
+	              const int numMoments,
+	              AnimationLodState* const lodState = nullptr);
+
+	/// Returns the number of models added since the last evaluation.
+	int getNumModels() const { return int(m_models.size()); }
+
+	/// @brief Evaluates all added models and uploads their skinning to the GPU, then clears the list of models.
+	void evaluate();
+
+	/// @brief Evaluates the nodes and the skinning palettes of the added models without touching the GPU.
+	/// The models are kept, so @finishEvaluation needs to be called after that.
+	void evaluateNodesAndPalettes();
+
+	/// @brief Does the serial part of the evaluation (see @EvaluatedModel::finishEvaluation) for all added models
+	/// and clears the list of models.
+	void finishEvaluation();
+
+	/// Removes all added models without evaluating them.
+	void clear();
+
+  public:
+	/// If false all models are evaluated on the calling thread.
+	bool useWorkerThreads = true;
+
+	/// The number of worker threads to be used, excluding the calling thread. -1 means one per hardware thread.
+	/// Takes effect when the worker threads get created, on the first evaluation that needs them.
+	int numWorkerThreads = -1;
+
+  private:
+	struct ModelToEvaluate {
+		EvaluatedModel* evalModel = nullptr;
+		int firstMoment = 0;
+		int numMoments = 0;
+		AnimationLodState* lodState = nullptr;
+	};
+
+	std::vector<ModelToEvaluate> m_models;
+	std::vector<EvalMomentSets> m_moments; ///< The moments of all models to be evaluated, see @ModelToEvaluate::firstMoment.
+
+	/// Increased after each evaluation, see @AnimationLodState::evaluateNodes.
+	uint32 m_frameIndex = 1;
+	/// The phase to be assigned to the next model with a level of detail state that didn't have one.
+	int m_nextLodPhase = 0;
+
+	/// Created lazily, so systems that never evaluate many models do not spawn any threads.
+	std::unique_ptr<ThreadPool> m_threadPool;
+};
+
+} // namespace sge
@@ -1,4 +1,3 @@
-
 #include "Animator.h"
 #include "sge_core/AssetLibrary.h"
 #include "sge_core/ICore.h"
@@ -10,16 +9,36 @@ void ModelAnimator::addTrack_begin(EvaluatedModel& modelToBeAnimated) {
 	m_modelToBeAnimated = &modelToBeAnimated;
 }
 
-void ModelAnimator::addTrack(int newTrackId, float fadeInTime, TrackTransition transition) {
-	AnimatorTrack& track = m_tracks[newTrackId];
+int ModelAnimator::addTrack(int newTrackId, float fadeInTime, TrackTransition transition, int switchToTrackId) {
+	int trackIndex = findTrackIndex(newTrackId);
+	if (trackIndex < 0) {
+		trackIndex = int(m_tracks.size());
+		m_tracks.emplace_back();
+		m_trackIdToIndex[newTrackId] = trackIndex;
+	}
+
+	AnimatorTrack& track = m_tracks[trackIndex];
 	track.blendingTime = fadeInTime;
 	track.transition = transition;
+	track.switchToPlaybackTrackId = switchToTrackId;
+
+	return trackIndex;
 }
 
 void ModelAnimator::addAnimationToTrack(int newTrackId, const char* const donorModelPath, const char* donorAnimationName) {
-	AnimatorTrack& track = m_tracks[newTrackId];
-
 	std::shared_ptr<Asset> donorModel = getCore()->getAssetLib()->getAsset(donorModelPath, true);
+	addAnimationToTrack(newTrackId, donorModel, donorAnimationName);
+}
+
+void ModelAnimator::addAnimationToTrack(int newTrackId, const std::shared_ptr<Asset>& donorModel, const char* donorAnimationName) {
+	const int trackIndex = findTrackIndex(newTrackId);
+	if (trackIndex < 0) {
+		sgeAssert(false && "The track needs to be added before its animations.");
+		return;
+	}
+
+	AnimatorTrack& track = m_tracks[trackIndex];
+
 	if (isAssetLoaded(donorModel, AssetType::Model)) {
 		AnimatorTrack::AnimationDonor donor;
 		donor.modelAnimationDonor = donorModel;
@@ -33,39 +52,154 @@ void ModelAnimator::addAnimationToTrack(int newTrackId, const char* const donorM
 void ModelAnimator::addTrack_finish() {
 }
 
+int ModelAnimator::findTrackIndex(int const trackId) const {
+	const int* const trackIndex = m_trackIdToIndex.find_element(trackId);
+	return trackIndex != nullptr ? *trackIndex : -1;
+}
+
 void ModelAnimator::playTrack(int const trackId, Optional<float> blendToSeconds) {
-	// If we are already playing the same track do nothing.
-	if (m_playingTrack == trackId) {
+	const int trackIndex = findTrackIndex(trackId);
+
+	if (trackIndex < 0) {
+		sgeAssert(false && "Invalid track id.");
 		return;
 	}
 
-	const auto& itrTrackDesc = m_tracks.find(trackId);
+	playTrackIndex(trackIndex, blendToSeconds ? *blendToSeconds : m_tracks[trackIndex].blendingTime, crossfadeCurve_linear);
+}
 
-	if (itrTrackDesc == m_tracks.end()) {
-		sgeAssert(false && "Invalid track id.");
+void ModelAnimator::playTrackIndex(int const trackIndex, float const fadeTime, AnimatorCrossfadeCurve const crossfadeCurve) {
+	// If we are already playing the same track do nothing.
+	if (m_playingTrack == trackIndex) {
 		return;
 	}
 
-	fadeoutTimeTotal = blendToSeconds ? *blendToSeconds : itrTrackDesc->second.blendingTime;
+	m_playingTrack = trackIndex;
+
+	fadeoutTimeTotal = fadeTime;
 	if (fadeoutTimeTotal == 0.f) {
 		m_playbacks.clear();
 		fadeoutTimeTotal = 0.f;
 	}
 
+	// The previous main track starts fading out with the curve of this transition.
+	if (m_playbacks.size() != 0) {
+		m_playbacks.back().crossfadeCurve = crossfadeCurve;
+	}
+
+	// When too many animations are fading out forget the oldest one. Its weight is given to the next oldest one,
+	// so the pose doesn't jump. That one continues fading out linearly from the combined weight.
+	if (m_playbacks.isFull()) {
+		TrackPlayback& next = m_playbacks[1];
+		const float combinedWeight = evaluateCrossfadeCurve(m_playbacks[0].crossfadeCurve, m_playbacks[0].unormWeight) +
+		                             evaluateCrossfadeCurve(next.crossfadeCurve, next.unormWeight);
+		next.unormWeight = clamp01(combinedWeight);
+		next.crossfadeCurve = crossfadeCurve_linear;
+		removePlayback(0);
+	}
+
 	TrackPlayback playback;
 
-	playback.trackId = trackId;
+	playback.trackIndex = trackIndex;
 	playback.timeInAnimation = 0.f;
 	playback.iAnimation = 0; // TODO: randomize this.
 	// If there is going to be a fadeout start form 0 weight growing to one, to smoothly transition.
 	// otherwise durectly use 100% weight.
-	playback.unormWeight = m_playbacks.empty() ? 1.f : 0.f;
+	playback.unormWeight = m_playbacks.size() == 0 ? 1.f : 0.f;
+	playback.crossfadeCurve = crossfadeCurve;
+
+	m_playbacks.push_back(playback);
+}
 
-	m_playbacks.emplace_back(playback);
+void ModelAnimator::removePlayback(int const iPlayback) {
+	for (int t = iPlayback; t + 1 < m_playbacks.size(); ++t) {
+		m_playbacks[t] = m_playbacks[t + 1];
+	}
+	m_playbacks.pop_back();
+}
+
+int ModelAnimator::addState(int const trackId) {
+	AnimatorState state;
+	state.trackIndex = findTrackIndex(trackId);
+	sgeAssert(state.trackIndex >= 0 && "The track needs to be added before the state.");
+
+	m_states.push_back(state);
+	return int(m_states.size()) - 1;
+}
+
+int ModelAnimator::addParameter(float const initialValue) {
+	m_parameters.push_back(initialValue);
+	return int(m_parameters.size()) - 1;
+}
+
+void ModelAnimator::addTransition(const AnimatorStateTransition& transition) {
+	sgeAssert(transition.toState >= 0 && transition.toState < int(m_states.size()));
+	m_transitions.push_back(transition);
+}
+
+void ModelAnimator::setParameter(int const parameterIndex, float const value) {
+	if (parameterIndex >= 0 && parameterIndex < int(m_parameters.size())) {
+		m_parameters[parameterIndex] = value;
+	} else {
+		sgeAssert(false && "Invalid parameter index.");
+	}
+}
+
+float ModelAnimator::getParameter(int const parameterIndex) const {
+	if (parameterIndex >= 0 && parameterIndex < int(m_parameters.size())) {
+		return m_parameters[parameterIndex];
+	}
+
+	sgeAssert(false && "Invalid parameter index.");
+	return 0.f;
+}
+
+void ModelAnimator::setState(int const stateIndex) {
+	if (stateIndex < 0 || stateIndex >= int(m_states.size()) || m_states[stateIndex].trackIndex < 0) {
+		sgeAssert(false && "Invalid state index.");
+		return;
+	}
+
+	m_currentState = stateIndex;
+	m_playingTrack = -1;
+	playTrackIndex(m_states[stateIndex].trackIndex, 0.f, crossfadeCurve_linear);
+}
+
+bool ModelAnimator::isTransitionConditionMet(const AnimatorStateTransition& transition) const {
+	switch (transition.condition) {
+		case animatorCondition_always:
+			return true;
+		case animatorCondition_greater:
+			return getParameter(transition.parameterIndex) > transition.threshold;
+		case animatorCondition_less:
+			return getParameter(transition.parameterIndex) < transition.threshold;
+		case animatorCondition_animationEnded:
+			return m_playbacks.size() != 0 && m_playbacks.back().hasReachedEnd;
+		default:
+			sgeAssert(false && "Unimplemented condition");
+			return false;
+	}
+}
+
+void ModelAnimator::updateStateMachine() {
+	if (m_currentState < 0) {
+		return;
+	}
+
+	// Take the first transition that could happen. Transitions to the current state are ignored,
+	// so the transitions from any state do not restart the state over and over.
+	for (const AnimatorStateTransition& transition : m_transitions) {
+		const bool isFromCurrentState = transition.fromState == -1 || transition.fromState == m_currentState;
+		if (isFromCurrentState && transition.toState != m_currentState && isTransitionConditionMet(transition)) {
+			m_currentState = transition.toState;
+			playTrackIndex(m_states[m_currentState].trackIndex, transition.crossfadeSeconds, transition.crossfadeCurve);
+			return;
+		}
+	}
 }
 
 void ModelAnimator::update(float const dt) {
-	if (m_playbacks.empty()) {
+	if (m_playbacks.size() == 0) {
 		return;
 	}
 
@@ -75,16 +209,16 @@ void ModelAnimator::update(float const dt) {
 	for (int iPlayback = 0; iPlayback < m_playbacks.size(); ++iPlayback) {
 		TrackPlayback& playback = m_playbacks[iPlayback];
 
-		const AnimatorTrack& trackInfo = m_tracks[playback.trackId];
+		const AnimatorTrack& trackInfo = m_tracks[playback.trackIndex];
 
-		AnimatorTrack::AnimationDonor animationDonor = trackInfo.animations[playback.iAnimation];
+		const AnimatorTrack::AnimationDonor& animationDonor = trackInfo.animations[playback.iAnimation];
 		const ModelAnimation* const animInfo = animationDonor.getAnimation();
 
 		if (animInfo == nullptr) {
 			// This should never happen, all the animations should be available.
 			// Handle this so we do not crash.
 			sgeAssert(false);
-			m_playbacks.erase(m_playbacks.begin() + iPlayback);
+			removePlayback(iPlayback);
 			--iPlayback;
 			continue;
 		}
@@ -98,6 +232,7 @@ void ModelAnimator::update(float const dt) {
 		// In that case the animation has ended. Handle the track transitions.
 		if (repeatCnt != 0) {
 			bool trackNeedsRemoving = false;
+			playback.hasReachedEnd = true;
 
 			switch (trackInfo.transition) {
 				case trackTransition_loop: {
@@ -108,9 +243,9 @@ void ModelAnimator::update(float const dt) {
 					playback.timeInAnimation = animInfo->durationSec;
 				} break;
 				case trackTransition_switchTo: {
-					// In that case we need to switch to another track if we aren't already in it.
-					if (m_playingTrack != playback.trackId && trackInfo.switchToPlaybackTrackId != playback.trackId &&
-					    trackInfo.switchToPlaybackTrackId != -1) {
+					// In that case we need to switch to another track if the main track has ended.
+					if (m_playingTrack == playback.trackIndex && trackInfo.switchToPlaybackTrackId != -1 &&
+					    findTrackIndex(trackInfo.switchToPlaybackTrackId) != playback.trackIndex) {
 						switchToPlayTrackId = trackInfo.switchToPlaybackTrackId;
 					}
 
@@ -128,7 +263,10 @@ void ModelAnimator::update(float const dt) {
 			}
 
 			if (trackNeedsRemoving) {
-				m_playbacks.erase(m_playbacks.begin() + iPlayback);
+				if (m_playingTrack == playback.trackIndex) {
+					m_playingTrack = -1;
+				}
+				removePlayback(iPlayback);
 				--iPlayback;
 				continue;
 			}
@@ -139,6 +277,8 @@ void ModelAnimator::update(float const dt) {
 		playTrack(switchToPlayTrackId);
 	}
 
+	updateStateMachine();
+
 	// Update the track weights.
 	if (fadeoutTimeTotal > 1e-6f) {
 		const float fadePercentage = dt / fadeoutTimeTotal;
@@ -147,10 +287,10 @@ void ModelAnimator::update(float const dt) {
 			TrackPlayback& playback = m_playbacks[iPlayback];
 
 			// The last element here is the primary track. It needs to fade in.
-			if (iPlayback != (int(m_playbacks.size()) - 1)) {
+			if (iPlayback != (m_playbacks.size() - 1)) {
 				playback.unormWeight -= fadePercentage;
 				if (playback.unormWeight <= 0.f) {
-					m_playbacks.erase(m_playbacks.begin() + iPlayback);
+					removePlayback(iPlayback);
 					--iPlayback;
 					continue;
 				}
@@ -162,23 +302,39 @@ void ModelAnimator::update(float const dt) {
 	}
 }
 
-void ModelAnimator::computeEvalMoments(std::vector<EvalMomentSets>& outMoments) {
+float ModelAnimator::evaluateCrossfadeCurve(AnimatorCrossfadeCurve const curve, float const t) {
+	const float x = clamp01(t);
+	switch (curve) {
+		case crossfadeCurve_linear:
+			return x;
+		case crossfadeCurve_smoothStep:
+			return x * x * (3.f - 2.f * x);
+		case crossfadeCurve_easeIn:
+			return x * x;
+		case crossfadeCurve_easeOut:
+			return x * (2.f - x);
+		default:
+			sgeAssert(false && "Unimplemented crossfade curve");
+			return x;
+	}
+}
+
+void ModelAnimator::computeEvalMoments(AnimatorEvalMoments& outMoments) const {
 	outMoments.clear();
 
-	if (m_playbacks.empty()) {
+	if (m_playbacks.size() == 0) {
 		// In that case evaluate at static moment.
 		outMoments.push_back(EvalMomentSets());
+		return;
 	}
 
-	const float maxUnormWeightTotal = float(m_playbacks.size());
-
 	float totalWeigth = 0.f;
 	for (int iPlayback = 0; iPlayback < m_playbacks.size(); ++iPlayback) {
-		TrackPlayback& playback = m_playbacks[iPlayback];
-		const AnimatorTrack& trackInfo = m_tracks[playback.trackId];
+		const TrackPlayback& playback = m_playbacks[iPlayback];
+		const AnimatorTrack& trackInfo = m_tracks[playback.trackIndex];
 
 		EvalMomentSets momentForTrack;
-		momentForTrack.weight = playback.unormWeight / maxUnormWeightTotal;
+		momentForTrack.weight = evaluateCrossfadeCurve(playback.crossfadeCurve, playback.unormWeight);
 		momentForTrack.time = playback.timeInAnimation;
 		momentForTrack.donorIndex = trackInfo.animations[playback.iAnimation].donorIndex;
 		momentForTrack.animationIndex = trackInfo.animations[playback.iAnimation].animationIndexInDonor;
@@ -194,9 +350,17 @@ void ModelAnimator::computeEvalMoments(std::vector<EvalMomentSets>& outMoments)
 			m.weight = m.weight / totalWeigth;
 		}
 	} else {
-		sgeAssert(false);
-		outMoments.clear();
-		outMoments.push_back(EvalMomentSets());
+		// Only the main track is left and it has just started fading in.
+		outMoments.back().weight = 1.f;
+		for (int iMoment = 0; iMoment + 1 < outMoments.size(); ++iMoment) {
+			outMoments[iMoment].weight = 0.f;
+		}
 	}
 }
+
+void ModelAnimator::computeEvalMoments(std::vector<EvalMomentSets>& outMoments) const {
+	AnimatorEvalMoments moments;
+	computeEvalMoments(moments);
+	outMoments.assign(moments.begin(), moments.end());
+}
 } // namespace sge
@@ -4,9 +4,10 @@
 
 #include "model/EvaluatedModel.h"
 #include "sge_core/AssetLibrary.h"
+#include "sge_utils/utils/StaticArray.h"
 #include "sge_utils/utils/optional.h"
+#include "sge_utils/utils/vector_map.h"
 #include "sgecore_api.h"
-#include <unordered_map>
 
 namespace sge {
 
@@ -55,44 +56,134 @@ struct AnimatorTrack {
 	int switchToPlaybackTrackId = -1;
 };
 
+/// @brief Describes how the weights of the animations change while cross fading between them.
+enum AnimatorCrossfadeCurve : int {
+	crossfadeCurve_linear,
+	crossfadeCurve_smoothStep, ///< Slow at the start and at the end of the fade.
+	crossfadeCurve_easeIn,     ///< The new animation starts slowly and speeds up.
+	crossfadeCurve_easeOut,    ///< The new animation starts fast and slows down at the end.
+};
+
+/// @brief Describes when a transition between two animator states should happen.
+enum AnimatorCondition : int {
+	animatorCondition_always,         ///< The transition happens as soon as the source state is active.
+	animatorCondition_greater,        ///< The parameter is greater than the threshold.
+	animatorCondition_less,           ///< The parameter is less than the threshold.
+	animatorCondition_animationEnded, ///< The animation of the source state has reached its end at least once.
+};
+
+/// @brief A transition between two states of the @ModelAnimator state machine.
+struct AnimatorStateTransition {
+	/// The state in which the transition is checked, -1 means any state.
+	int fromState = -1;
+	int toState = -1;
+
+	AnimatorCondition condition = animatorCondition_always;
+	/// The parameter compared with @threshold, see @ModelAnimator::addParameter.
+	int parameterIndex = -1;
+	float threshold = 0.f;
+
+	float crossfadeSeconds = 0.f;
+	AnimatorCrossfadeCurve crossfadeCurve = crossfadeCurve_linear;
+};
+
+/// The maximum number of animations that could be blended at the same time.
+static const int kAnimatorMaxPlaybacks = 8;
+
+/// The moments produced by @ModelAnimator, stored inline so computing them doesn't allocate.
+typedef StaticArray<EvalMomentSets, kAnimatorMaxPlaybacks> AnimatorEvalMoments;
+
+/// @brief Plays and blends the tracks of a model.
+/// The tracks are stored in an array and the playbacks refer to them by index, the user ids of the tracks are resolved
+/// only when a track gets played. Optionally the tracks could be driven by a state machine, whose states, transitions
+/// and parameters are specified once after the tracks. After that updating the animator and computing the moments
+/// doesn't allocate any memory.
 struct SGE_CORE_API ModelAnimator {
 	ModelAnimator() = default;
 
 	void addTrack_begin(EvaluatedModel& modelToBeAnimated);
-	void addTrack(int newTrackId, float fadeInTime, TrackTransition transition);
+	/// Adds a track with the specified user id (or changes the existing one) and returns its index.
+	int addTrack(int newTrackId, float fadeInTime, TrackTransition transition, int switchToTrackId = -1);
 	void addAnimationToTrack(int newTrackId, const char* const donorModelPath, const char* donorAnimationName);
+	void addAnimationToTrack(int newTrackId, const std::shared_ptr<Asset>& donorModel, const char* donorAnimationName);
 	void addTrack_finish();
 
+	/// Returns the index of the track with the specified user id, -1 if there is no such track.
+	int findTrackIndex(int const trackId) const;
+	int getNumTracks() const { return int(m_tracks.size()); }
+
 	void playTrack(int const trackId, Optional<float> blendToSeconds = NullOptional());
 
+	/// @brief Adds a state of the state machine playing the specified track. Returns the index of the state.
+	int addState(int const trackId);
+	/// @brief Adds a parameter used by the conditions of the transitions. Returns the index of the parameter.
+	int addParameter(float const initialValue = 0.f);
+	/// @brief Adds a transition between two states. The transitions are checked in the order they were added.
+	void addTransition(const AnimatorStateTransition& transition);
+
+	void setParameter(int const parameterIndex, float const value);
+	float getParameter(int const parameterIndex) const;
+
+	/// @brief Immediately switches the state machine to the specified state, playing its track without any fading.
+	void setState(int const stateIndex);
+	/// Returns the current state of the state machine, -1 if it isn't used.
+	int getState() const { return m_currentState; }
+
 	// Advanced the animation.
 	void update(float const dt);
 
 	/// @brief Generates the moments that are needed to evalute a 3d model in the specified state.
 	/// Keep in mind that it is assument that the model has the same animation donors as the ModelAnimator in the same order.
-	void computeEvalMoments(std::vector<EvalMomentSets>& outMoments);
+	void computeEvalMoments(AnimatorEvalMoments& outMoments) const;
+	/// Same as above, but allocates. Kept for the code that passes the moments around in a std::vector.
+	void computeEvalMoments(std::vector<EvalMomentSets>& outMoments) const;
+
+	/// Returns the value of the curve for the linear fade progress @t in [0;1].
+	static float evaluateCrossfadeCurve(AnimatorCrossfadeCurve const curve, float const t);
 
   private:
 	struct TrackPlayback {
-		int trackId = -1;
+		int trackIndex = -1;
 
 		int iAnimation = -1;
 		float timeInAnimation = 0.f;
+		/// The linear progress of the fade, the weight of the playback is this value mapped by @crossfadeCurve.
 		float unormWeight = 1.f;
+		/// The curve of the fade in which the playback is fading in or out. Playbacks keep fading with the curve of the
+		/// transition that started their fade, even if another transition happens meanwhile.
+		AnimatorCrossfadeCurve crossfadeCurve = crossfadeCurve_linear;
+		/// True if the animation reached its end at least once.
+		bool hasReachedEnd = false;
 	};
 
+	struct AnimatorState {
+		int trackIndex = -1;
+	};
+
+	void playTrackIndex(int const trackIndex, float const fadeTime, AnimatorCrossfadeCurve const crossfadeCurve);
+	void removePlayback(int const iPlayback);
+	bool isTransitionConditionMet(const AnimatorStateTransition& transition) const;
+	void updateStateMachine();
+
   private:
-	std::unordered_map<int, AnimatorTrack> m_tracks;
+	std::vector<AnimatorTrack> m_tracks;
+	/// The index in @m_tracks of each track id.
+	vector_map<int, int> m_trackIdToIndex;
 
 	/// The main track that we are currently playing. This does not mean that we are playing only this track,
 	/// there might be other track currently fading out.
 	int m_playingTrack = -1;
 
-	/// The state of each playing track.
-	std::vector<TrackPlayback> m_playbacks;
+	/// The state of each playing track. The last one is the main track.
+	StaticArray<TrackPlayback, kAnimatorMaxPlaybacks> m_playbacks;
 
 	float fadeoutTimeTotal = 0.f;
 
+	std::vector<AnimatorState> m_states;
+	std::vector<AnimatorStateTransition> m_transitions;
+	std::vector<float> m_parameters;
+	int m_currentState = -1;
+
 	EvaluatedModel* m_modelToBeAnimated = nullptr;
 };
 
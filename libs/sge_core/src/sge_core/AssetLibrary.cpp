@@ -265,19 +265,12 @@ struct ModelAssetFactory : public IAssetFactory {
 
 		AssetModel& modelAsset = *(AssetModel*)(pAsset);
 
-		FileReadStream frs(pPath);
-
-		if (frs.isOpened() == false) {
-			SGE_DEBUG_ERR("Unable to find model asset: '%s'!\n", pPath);
-			// sgeAssert(false);
-			return false;
-		}
-
 		ModelLoadSettings loadSettings;
 		loadSettings.assetDir = extractFileDir(pPath, true);
 
+		// Version 2 model files get memory mapped, the mesh data is not copied.
 		ModelReader modelReader;
-		const bool succeeded = modelReader.loadModel(loadSettings, &frs, modelAsset.model);
+		const bool succeeded = modelReader.loadModel(loadSettings, pPath, modelAsset.model);
 
 		if (!succeeded) {
 			SGE_DEBUG_ERR("Unable to load model asset: '%s'!\n", pPath);
@@ -289,6 +282,7 @@ struct ModelAssetFactory : public IAssetFactory {
 
 		modelAsset.staticEval.initialize(pMngr, &modelAsset.model);
 		modelAsset.staticEval.evaluateStatic();
+		modelAsset.sharedStaticEvals.initialize(&modelAsset.staticEval);
 
 		modelAsset.sharedEval.initialize(pMngr, &modelAsset.model);
 		modelAsset.sharedEval.evaluateStatic();
@@ -302,6 +296,7 @@ struct ModelAssetFactory : public IAssetFactory {
 
 		AssetModel& model = *(AssetModel*)(pAsset);
 
+		model.sharedStaticEvals.clear();
 		model.staticEval = EvaluatedModel();
 		model.sharedEval = EvaluatedModel();
 
@@ -325,6 +320,16 @@ struct TextureViewAssetFactory : public IAssetFactory {
 	DDSLoadCode loadDDS(void* const pAsset, const char* const pPath, AssetLibrary* const pMngr) {
 		std::string const ddsPath = (extractFileExtension(pPath) == "dds") ? pPath : std::string(pPath) + ".dds";
 
+		// Try to create the texture with streamed mips, if that isn't possible the whole texture gets loaded.
+		{
+			AssetTexture& texture = *(AssetTexture*)(pAsset);
+			texture.assetSamplerDesc = getTextureSamplerDesc(pPath);
+			if (pMngr->getTextureStreaming().createStreamedTexture(*pMngr->getDevice(), texture.tex, ddsPath.c_str(),
+			                                                       texture.assetSamplerDesc)) {
+				return ddsLoadCode_fine;
+			}
+		}
+
 		// Load the File contents.
 		std::vector<char> ddsDataRaw;
 		if (FileReadStream::readFile(ddsPath.c_str(), ddsDataRaw) == false) {
@@ -676,6 +681,8 @@ bool AssetLibrary::reloadAssetModified(Asset* const asset) {
 		return false;
 	}
 
+	asset->m_loadedModifiedTime = fileNewModTime;
+
 	// Measure the loading time.
 	const float reloadEndTime = Timer::now_seconds();
 	SGE_DEBUG_LOG("Asset '%s' loaded in %f seconds.\n", pathToAsset.c_str(), reloadEndTime - reloadStartTime);
@@ -4,8 +4,10 @@
 #include <memory>
 
 #include "sge_core/Sprite.h"
+#include "sge_core/TextureStreamingManager.h"
 #include "sge_core/model/EvaluatedModel.h"
 #include "sge_core/model/Model.h"
+#include "sge_core/model/SharedEvaluatedModelCache.h"
 #include "sge_utils/utils/vector_map.h"
 #include "sgecore_api.h"
 
@@ -32,6 +34,9 @@ struct AssetModel {
 	Model model;
 	EvaluatedModel staticEval;
 	EvaluatedModel sharedEval;
+
+	/// The static evaluation (@staticEval) shared by the instances of the model, one entry for each combination of material overrides.
+	SharedEvaluatedModelCache sharedStaticEvals;
 };
 
 // Defines all posible asset types.
@@ -218,6 +223,9 @@ struct SGE_CORE_API AssetLibrary {
 
 	const std::string& getAssetsDirAbs() const { return m_gameAssetsDir; }
 
+	/// The manager streaming the mips of the DDS textures. @TextureStreamingManager::update needs to be called every frame.
+	TextureStreamingManager& getTextureStreaming() { return m_textureStreaming; }
+
   private:
 	std::string m_gameAssetsDir;
 
@@ -235,6 +243,8 @@ struct SGE_CORE_API AssetLibrary {
 	std::map<AssetType, std::map<std::string, std::shared_ptr<Asset>>> m_assets;
 
 	SGEDevice* m_sgedev;
+
+	TextureStreamingManager m_textureStreaming;
 };
 
 /// @brief Returns true if the specified asset is loaded.
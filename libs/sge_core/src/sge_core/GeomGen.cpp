@@ -1,4 +1,5 @@
 #include "GeomGen.h"
+#include <algorithm>
 #include <vector>
 
 namespace sge {
@@ -92,6 +93,96 @@ int GeomGen::sphere(Buffer* resultVertBuffer, int numRings, int numSectors) {
 	return (int)verts.size();
 }
 
+void GeomGen::indexedSphere(std::vector<vec3f>& outVertices, std::vector<uint32>& outIndices, int numRings, int numSectors) {
+	if (numRings < 3) {
+		sgeAssert(false);
+		numRings = 3;
+	}
+	if (numSectors < 3) {
+		sgeAssert(false);
+		numSectors = 3;
+	}
+
+	outVertices.clear();
+	outIndices.clear();
+
+	// The poles are a single vertex, each ring in between has numSectors vertices.
+	outVertices.push_back(vec3f(0.f, 1.f, 0.f));
+	for (int iRing = 1; iRing < numRings; ++iRing) {
+		const float ringAngle = sgePi * (float)iRing / (float)numRings;
+		for (int iSector = 0; iSector < numSectors; ++iSector) {
+			const float sectorAngle = sge2Pi * (float)iSector / (float)numSectors;
+			outVertices.push_back(vec3f(cosf(sectorAngle) * sinf(ringAngle), cosf(ringAngle), -sinf(sectorAngle) * sinf(ringAngle)));
+		}
+	}
+	outVertices.push_back(vec3f(0.f, -1.f, 0.f));
+
+	const uint32 northPole = 0;
+	const uint32 southPole = uint32(outVertices.size() - 1);
+	const auto ringVertex = [numSectors](int iRing, int iSector) -> uint32 {
+		return uint32(1 + (iRing - 1) * numSectors + (iSector % numSectors));
+	};
+
+	for (int iSector = 0; iSector < numSectors; ++iSector) {
+		outIndices.push_back(northPole);
+		outIndices.push_back(ringVertex(1, iSector));
+		outIndices.push_back(ringVertex(1, iSector + 1));
+	}
+
+	for (int iRing = 1; iRing < numRings - 1; ++iRing) {
+		for (int iSector = 0; iSector < numSectors; ++iSector) {
+			outIndices.push_back(ringVertex(iRing, iSector));
+			outIndices.push_back(ringVertex(iRing + 1, iSector));
+			outIndices.push_back(ringVertex(iRing + 1, iSector + 1));
+
+			outIndices.push_back(ringVertex(iRing, iSector));
+			outIndices.push_back(ringVertex(iRing + 1, iSector + 1));
+			outIndices.push_back(ringVertex(iRing, iSector + 1));
+		}
+	}
+
+	for (int iSector = 0; iSector < numSectors; ++iSector) {
+		outIndices.push_back(ringVertex(numRings - 1, iSector));
+		outIndices.push_back(southPole);
+		outIndices.push_back(ringVertex(numRings - 1, iSector + 1));
+	}
+}
+
+void GeomGen::indexedGrid(std::vector<vec3f>& outVertices, std::vector<uint32>& outIndices, int numCellsX, int numCellsZ) {
+	if (numCellsX < 1 || numCellsZ < 1) {
+		sgeAssert(false);
+		numCellsX = std::max(numCellsX, 1);
+		numCellsZ = std::max(numCellsZ, 1);
+	}
+
+	outVertices.clear();
+	outIndices.clear();
+
+	const int numVertsX = numCellsX + 1;
+	for (int z = 0; z <= numCellsZ; ++z) {
+		for (int x = 0; x <= numCellsX; ++x) {
+			outVertices.push_back(vec3f((float)x, 0.f, (float)z));
+		}
+	}
+
+	for (int z = 0; z < numCellsZ; ++z) {
+		for (int x = 0; x < numCellsX; ++x) {
+			const uint32 v00 = uint32(z * numVertsX + x);
+			const uint32 v10 = v00 + 1;
+			const uint32 v01 = v00 + uint32(numVertsX);
+			const uint32 v11 = v01 + 1;
+
+			outIndices.push_back(v00);
+			outIndices.push_back(v01);
+			outIndices.push_back(v11);
+
+			outIndices.push_back(v00);
+			outIndices.push_back(v11);
+			outIndices.push_back(v10);
+		}
+	}
+}
+
 int GeomGen::plane(Buffer* resultVertBuffer, const vec3f& up, const vec3f& right, const bool addNormals) {
 	const vec3f norm = cross(right, up);
 
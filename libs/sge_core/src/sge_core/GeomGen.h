@@ -23,6 +23,14 @@ struct SGE_CORE_API GeomGen {
 	// Vertices: Triangle List of [ float3 Position ]
 	static int sphere(Buffer* const resultVertBuffer, int numSlices, int numSectors);
 
+	/// Generates an indexed sphere with radius 1 in RH Y-up, with the triangles ordered ring by ring.
+	/// Vertices: Triangle List of [ float3 Position ]
+	static void indexedSphere(std::vector<vec3f>& outVertices, std::vector<uint32>& outIndices, int numRings, int numSectors);
+
+	/// Generates an indexed grid of numCellsX by numCellsZ unit quads on the XZ plane, with the triangles ordered row by row.
+	/// Vertices: Triangle List of [ float3 Position ]
+	static void indexedGrid(std::vector<vec3f>& outVertices, std::vector<uint32>& outIndices, int numCellsX, int numCellsZ);
+
 	// Generates a plane using up and right vector.
 	// Returns the number of vertices
 	// Vertices: Triangle List of [ float3 Position, float3 Normal ]
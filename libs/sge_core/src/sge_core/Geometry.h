@@ -4,6 +4,17 @@
 
 namespace sge {
 
+/// Describes how the quantized vertex attributes of a mesh should be decoded, see @MeshQuantizer.
+/// The default values describe a mesh without any quantized attributes.
+struct VertexDequantization {
+	vec3f positionScale = vec3f(1.f);  ///< The position is a_position * positionScale + positionOffset.
+	vec3f positionOffset = vec3f(0.f);
+	vec2f uvScale = vec2f(1.f); ///< The uv is a_uv * uvScale + uvOffset.
+	vec2f uvOffset = vec2f(0.f);
+	bool hasQuantizedPositions = false; ///< True if the positions are stored as 16bit integers relative to the mesh bounding box.
+	bool hasOctahedralNormals = false;  ///< True if the normals, tangents and binormals are octahedral encoded in two components.
+};
+
 struct Geometry {
 	Geometry() = default;
 	Geometry(Buffer* vertexBuffer,
@@ -57,6 +68,8 @@ struct Geometry {
 	int stride = 0;                                 ///< The size of a whole vertex in bytes.
 	UniformType::Enum ibFmt = UniformType::Unknown; ///< The format the index buffer, if unknown this mesh doesn't use index buffers.
 	uint32 numElements = 0;                         ///< The number of vertices/indices used by this mesh.
+
+	VertexDequantization dequantization; ///< Describes how to decode the vertex attributes in the shaders.
 };
 
 
@@ -0,0 +1,62 @@
+#include "InstanceBatcher.h"
+
+namespace sge {
+
+void InstanceBatcher::setLimits(const int maxInstancesPerBatch, const int maxInstanceRows) {
+	sgeAssert(maxInstancesPerBatch >= 1 && maxInstanceRows >= 0);
+	m_maxInstancesPerBatch = maxInstancesPerBatch;
+	m_maxInstanceRows = maxInstanceRows;
+}
+
+void InstanceBatcher::build(const std::vector<RenderItem>& sortedItems,
+                            const int* const instancingIdPerPayload,
+                            const InstanceData* const instanceDataPerPayload) {
+	m_batches.clear();
+	m_instanceTexels.clear();
+	m_stats = InstanceBatcherStats();
+
+	const int numItems = int(sortedItems.size());
+	int numRows = 0;
+
+	int iItem = 0;
+	while (iItem < numItems) {
+		const int instancingId = instancingIdPerPayload[sortedItems[iItem].payloadIndex];
+
+		// Extend the batch with the following items with the same id, as long as there is space for their data.
+		int batchEnd = iItem + 1;
+		if (instancingId >= 0) {
+			const int maxBatchEnd = iItem + minOf(m_maxInstancesPerBatch, m_maxInstanceRows - numRows);
+			while (batchEnd < numItems && batchEnd < maxBatchEnd && instancingIdPerPayload[sortedItems[batchEnd].payloadIndex] == instancingId) {
+				batchEnd++;
+			}
+		}
+
+		InstanceBatch batch;
+		batch.firstItem = iItem;
+		batch.numItems = batchEnd - iItem;
+
+		// A single item is cheaper to draw without instancing.
+		if (batch.numItems > 1) {
+			batch.firstInstanceRow = numRows;
+			for (int iInstance = iItem; iInstance < batchEnd; ++iInstance) {
+				const InstanceData& data = instanceDataPerPayload[sortedItems[iInstance].payloadIndex];
+				m_instanceTexels.push_back(data.world.data[0]);
+				m_instanceTexels.push_back(data.world.data[1]);
+				m_instanceTexels.push_back(data.world.data[2]);
+				m_instanceTexels.push_back(data.world.data[3]);
+				m_instanceTexels.push_back(data.tint);
+			}
+			numRows += batch.numItems;
+
+			m_stats.numInstancedBatches++;
+			m_stats.numInstancedItems += batch.numItems;
+		}
+
+		m_batches.push_back(batch);
+		iItem = batchEnd;
+	}
+
+	m_stats.numBatches = int(m_batches.size());
+}
+
+} // namespace sge
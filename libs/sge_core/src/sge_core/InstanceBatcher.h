@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+
+#include "sge_core/RenderQueue.h"
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/math/mat4.h"
+
+namespace sge {
+
+/// The data that could differ between the instances drawn by a single instanced draw call.
+struct InstanceData {
+	mat4f world = mat4f::getIdentity();
+	/// The diffuse color of the material of the instance.
+	vec4f tint = vec4f(1.f);
+};
+
+/// A run of neighbouring render items that get drawn with a single draw call.
+struct InstanceBatch {
+	/// The index of the 1st item of the batch in the sorted items passed to @InstanceBatcher::build.
+	int firstItem = 0;
+	int numItems = 0;
+	/// The row of the 1st instance in the instance data, see @InstanceBatcher::getInstanceTexels.
+	/// -1 if the batch has a single item, these are drawn without instancing.
+	int firstInstanceRow = -1;
+
+	bool isInstanced() const { return firstInstanceRow >= 0; }
+};
+
+struct InstanceBatcherStats {
+	/// The number of batches, each one is a single draw call.
+	int numBatches = 0;
+	/// The number of batches that are drawn with instancing.
+	int numInstancedBatches = 0;
+	/// The number of items in the instanced batches, without instancing each one would be a separate draw call.
+	int numInstancedItems = 0;
+};
+
+/// @brief Groups the neighbouring items of a sorted render queue (see @RenderQueue) that could be drawn with
+/// a single instanced draw call and packs the per instance data of these items.
+/// The packed data is meant to be uploaded to a RGBA32F texture, each instance is a row of @kNumTexelsPerInstance texels:
+/// the four columns of the world transform followed by the tint.
+struct SGE_CORE_API InstanceBatcher {
+	static constexpr int kNumTexelsPerInstance = 5;
+
+	/// @param [in] maxInstancesPerBatch the maximum number of items drawn by a single instanced draw call.
+	/// @param [in] maxInstanceRows the maximum number of rows of the instance data, when all are used
+	///             the remaining items get drawn without instancing.
+	void setLimits(const int maxInstancesPerBatch, const int maxInstanceRows);
+
+	/// @brief Splits the items in batches, the items in each batch share the same instancing id and are neighbours in @sortedItems.
+	/// @param [in] sortedItems the items in the order they are going to be drawn, usually @RenderQueue::getItems after sorting.
+	/// @param [in] instancingIdPerPayload for each payload index, the items with equal non-negative ids could be drawn
+	///             with a single instanced draw call. -1 if the item cannot be instanced.
+	/// @param [in] instanceDataPerPayload for each payload index, the data of the instance.
+	void build(const std::vector<RenderItem>& sortedItems, const int* const instancingIdPerPayload, const InstanceData* const instanceDataPerPayload);
+
+	const std::vector<InstanceBatch>& getBatches() const { return m_batches; }
+
+	/// The packed data of all instanced batches, @kNumTexelsPerInstance texels per row.
+	const std::vector<vec4f>& getInstanceTexels() const { return m_instanceTexels; }
+	int getNumInstanceRows() const { return int(m_instanceTexels.size()) / kNumTexelsPerInstance; }
+
+	/// The statistics of the last @build.
+	const InstanceBatcherStats& getStats() const { return m_stats; }
+
+  private:
+	int m_maxInstancesPerBatch = 512;
+	int m_maxInstanceRows = 4096;
+
+	std::vector<InstanceBatch> m_batches;
+	std::vector<vec4f> m_instanceTexels;
+	InstanceBatcherStats m_stats;
+};
+
+} // namespace sge
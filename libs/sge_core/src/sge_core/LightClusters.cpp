@@ -0,0 +1,360 @@
+#include "LightClusters.h"
+#include "sge_core/shaders/modeldraw.h"
+#include "sge_utils/utils/ThreadPool.h"
+#include <algorithm>
+
+// Caution:
+// this include is an exception do not include anything else like it.
+#include "../core_shaders/ShadeCommon.h"
+
+namespace sge {
+
+static_assert(LightClusters::kNumTexelsPerLight == kClusteredLightNumTexels, "The light layout must match the shaders");
+static_assert(LightClusters::kNumLightIndicesPerRow == kClusteredLightIndicesPerRow, "The indices layout must match the shaders");
+
+namespace {
+	/// The height of the light indices and the lights textures is a multiple of this.
+	constexpr int kTexRowsGranularity = 64;
+
+	/// Uploads the texels to the texture, the texture gets (re)created if it doesn't exist or it is too small.
+	/// The texels get padded to the size of the texture as the whole texture gets updated.
+	void uploadTexels(SGEContext* const sgecon, GpuHandle<Texture>& tex, std::vector<vec4f>& texels, const int width, const int minHeight) {
+		const int neededHeight = maxOf(minHeight, 1);
+		const bool doesBigEnoughTextureExists = tex.HasResource() && tex->getDesc().texture2D.width == width &&
+		                                        tex->getDesc().texture2D.height >= neededHeight;
+		const int texHeight = doesBigEnoughTextureExists ? tex->getDesc().texture2D.height : neededHeight;
+
+		texels.resize(size_t(width) * size_t(texHeight), vec4f(0.f));
+		const TextureData data(texels.data(), sizeof(vec4f) * width);
+
+		if (doesBigEnoughTextureExists == false) {
+			TextureDesc td;
+			td.textureType = UniformType::Texture2D;
+			td.usage = TextureUsage::DynamicResource;
+			td.format = TextureFormat::R32G32B32A32_FLOAT;
+			td.texture2D.arraySize = 1;
+			td.texture2D = Texture2DDesc(width, texHeight);
+
+			SamplerDesc sd;
+			sd.filter = TextureFilter::Min_Mag_Mip_Point;
+
+			tex = sgecon->getDevice()->requestResource<Texture>();
+			tex->create(td, &data, sd);
+		} else {
+			sgecon->updateTextureData(tex.GetPtr(), data);
+		}
+	}
+
+	int roundUpRows(const int numRows) { return ((numRows + kTexRowsGranularity - 1) / kTexRowsGranularity) * kTexRowsGranularity; }
+} // namespace
+
+bool LightClusters::isLightClusterable(const ShadingLightData& light) {
+	const float type = light.lightPositionAndType.w;
+	const bool hasShadowMap = (int(light.lightColorWFlags.w) & kLightFlg_HasShadowMap) != 0;
+	return (type == 0.f || type == 2.f) && hasShadowMap == false;
+}
+
+bool LightClusters::doesLightAffectBox(const vec3f& lightPosition,
+                                       const float range,
+                                       const bool isSpot,
+                                       const vec3f& spotDirection,
+                                       const float spotCosAngle,
+                                       const AABox3f& box) {
+	// The sphere of the light against the box.
+	float distanceSqr = 0.f;
+	for (int t = 0; t < 3; ++t) {
+		const float d = maxOf(maxOf(box.min[t] - lightPosition[t], lightPosition[t] - box.max[t]), 0.f);
+		distanceSqr += d * d;
+	}
+
+	if (distanceSqr > range * range) {
+		return false;
+	}
+
+	if (isSpot == false) {
+		return true;
+	}
+
+	// The cone of the spot light against the bounding sphere of the box.
+	// https://bartwronski.com/2017/04/13/cull-that-cone/
+	const vec3f sphereCenter = box.center();
+	const float sphereRadius = box.halfDiagonal().length();
+	const float spotSinAngle = sqrtf(maxOf(1.f - spotCosAngle * spotCosAngle, 0.f));
+
+	const vec3f v = sphereCenter - lightPosition;
+	const float vLengthSqr = v.lengthSqr();
+	const float vAlongDir = dot(v, spotDirection);
+	const float distanceToConeSurface = spotCosAngle * sqrtf(maxOf(vLengthSqr - vAlongDir * vAlongDir, 0.f)) - vAlongDir * spotSinAngle;
+
+	const bool isOutsideTheAngle = distanceToConeSurface > sphereRadius;
+	const bool isInFrontOfTheCone = vAlongDir > sphereRadius + range;
+	// Cones wider than a hemisphere reach behind the light.
+	const bool isBehindTheCone = spotCosAngle >= 0.f && vAlongDir < -sphereRadius;
+
+	return !(isOutsideTheAngle || isInFrontOfTheCone || isBehindTheCone);
+}
+
+void LightClusters::setSettings(const LightClustersSettings& settings) {
+	sgeAssert(settings.numTilesX >= 1 && settings.numTilesY >= 1 && settings.numSlices >= 1);
+	m_settings = settings;
+}
+
+float LightClusters::getSliceNearDepth(const int iSlice) const {
+	return m_nearPlane * expf(m_logDepthRatio * float(iSlice) / float(m_settings.numSlices));
+}
+
+int LightClusters::computeSlice(const float depth) const {
+	if (depth <= 0.f) {
+		return -1;
+	}
+
+	return int(floorf(logf(depth / m_nearPlane) / m_logDepthRatio * float(m_settings.numSlices)));
+}
+
+int LightClusters::ndcToTile(const float ndc, const int numTiles) {
+	return int(floorf((ndc * 0.5f + 0.5f) * float(numTiles)));
+}
+
+void LightClusters::findOverlappingTiles(
+    const AABox3f* const clusterBoxes, const int axis, const float minCoord, const float maxCoord, int& outFirst, int& outLast) const {
+	// The boxes of the clusters in a row (or a column) of tiles are ordered along the axis, the overlapping ones are consecutive.
+	const int numTiles = axis == 0 ? m_settings.numTilesX : m_settings.numTilesY;
+	const int tileStride = axis == 0 ? 1 : m_settings.numTilesX;
+
+	outFirst = 0;
+	while (outFirst < numTiles && clusterBoxes[outFirst * tileStride].max[axis] < minCoord) {
+		outFirst++;
+	}
+
+	outLast = numTiles - 1;
+	while (outLast >= outFirst && clusterBoxes[outLast * tileStride].min[axis] > maxCoord) {
+		outLast--;
+	}
+}
+
+AABox3f LightClusters::computeClusterBoxVs(const int ix, const int iy, const int iz) const {
+	const float depths[2] = {getSliceNearDepth(iz), getSliceNearDepth(iz + 1)};
+	const float ndcX[2] = {-1.f + 2.f * float(ix) / float(m_settings.numTilesX), -1.f + 2.f * float(ix + 1) / float(m_settings.numTilesX)};
+	const float ndcY[2] = {-1.f + 2.f * float(iy) / float(m_settings.numTilesY), -1.f + 2.f * float(iy + 1) / float(m_settings.numTilesY)};
+
+	AABox3f box;
+	for (const float depth : depths) {
+		for (const float x : ndcX) {
+			for (const float y : ndcY) {
+				vec3f corner;
+				if (m_isPerspective) {
+					corner.x = depth * (x + m_proj.data[2][0]) / m_proj.data[0][0];
+					corner.y = depth * (y + m_proj.data[2][1]) / m_proj.data[1][1];
+				} else {
+					corner.x = (x - m_proj.data[3][0]) / m_proj.data[0][0];
+					corner.y = (y - m_proj.data[3][1]) / m_proj.data[1][1];
+				}
+				corner.z = -depth;
+				box.expand(corner);
+			}
+		}
+	}
+
+	return box;
+}
+
+int LightClusters::findCluster(const vec3f& positionWs) const {
+	const vec3f positionVs = m_view.transfPos(positionWs);
+	const float depth = -positionVs.z;
+	if (depth < m_nearPlane || depth > m_farPlane) {
+		return -1;
+	}
+
+	float ndcX = 0.f;
+	float ndcY = 0.f;
+	if (m_isPerspective) {
+		ndcX = m_proj.data[0][0] * positionVs.x / depth - m_proj.data[2][0];
+		ndcY = m_proj.data[1][1] * positionVs.y / depth - m_proj.data[2][1];
+	} else {
+		ndcX = m_proj.data[0][0] * positionVs.x + m_proj.data[3][0];
+		ndcY = m_proj.data[1][1] * positionVs.y + m_proj.data[3][1];
+	}
+
+	const int ix = ndcToTile(ndcX, m_settings.numTilesX);
+	const int iy = ndcToTile(ndcY, m_settings.numTilesY);
+	if (ix < 0 || ix >= m_settings.numTilesX || iy < 0 || iy >= m_settings.numTilesY) {
+		return -1;
+	}
+
+	const int iz = clamp(computeSlice(depth), 0, m_settings.numSlices - 1);
+	return getClusterIndex(ix, iy, iz);
+}
+
+void LightClusters::build(const mat4f& view,
+                          const mat4f& proj,
+                          const float nearPlane,
+                          const float farPlane,
+                          const ShadingLightData* const lights,
+                          const int numLights,
+                          ThreadPool* const threadPool) {
+	sgeAssert(nearPlane > 0.f && farPlane > nearPlane);
+
+	m_view = view;
+	m_proj = proj;
+	m_isPerspective = proj.data[2][3] != 0.f;
+	m_nearPlane = nearPlane;
+	m_farPlane = farPlane;
+	m_logDepthRatio = logf(farPlane / nearPlane);
+
+	// Transform the clusterable lights to view space and find the slices they could affect.
+	// The lights texture has a row for each light, the non-clusterable ones are never referenced.
+	m_lightsVs.clear();
+	m_lightsTexels.assign(size_t(roundUpRows(numLights)) * kNumTexelsPerLight, vec4f(0.f));
+	for (int iLight = 0; iLight < numLights; ++iLight) {
+		const ShadingLightData& light = lights[iLight];
+		if (isLightClusterable(light) == false) {
+			continue;
+		}
+
+		LightVs lightVs;
+		lightVs.iLight = iLight;
+		lightVs.position = view.transfPos(light.lightPositionAndType.xyz());
+		lightVs.range = light.lightXShadowRange.x;
+		lightVs.isSpot = light.lightPositionAndType.w == 2.f;
+		lightVs.spotDirection = view.transfDir(light.lightSpotDirAndCosAngle.xyz()).normalized0();
+		lightVs.spotCosAngle = light.lightSpotDirAndCosAngle.w;
+
+		const float depth = -lightVs.position.z;
+		if (depth + lightVs.range >= nearPlane && depth - lightVs.range <= farPlane) {
+			// A slice of margin as the boundaries of the slices are computed differently, the exact test is done per cluster.
+			lightVs.firstSlice = clamp(computeSlice(depth - lightVs.range) - 1, 0, m_settings.numSlices - 1);
+			lightVs.lastSlice = clamp(computeSlice(depth + lightVs.range) + 1, 0, m_settings.numSlices - 1);
+			m_lightsVs.push_back(lightVs);
+		}
+
+		vec4f* const lightTexels = &m_lightsTexels[size_t(iLight) * kNumTexelsPerLight];
+		lightTexels[0] = light.lightPositionAndType;
+		lightTexels[1] = light.lightSpotDirAndCosAngle;
+		lightTexels[2] = vec4f(light.lightColorWFlags.xyz(), light.lightXShadowRange.x);
+	}
+
+	// Bin the slices independently, possibly in parallel.
+	m_sliceBins.resize(m_settings.numSlices);
+	m_clusterRanges.resize(getNumClusters());
+	if (threadPool != nullptr) {
+		threadPool->parallelFor(m_settings.numSlices, [this](const int iSlice) { binSlice(iSlice); });
+	} else {
+		for (int iSlice = 0; iSlice < m_settings.numSlices; ++iSlice) {
+			binSlice(iSlice);
+		}
+	}
+
+	// Concatenate the slices in order, the ranges of the clusters were computed relative to their slice.
+	m_lightIndices.clear();
+	const int numClustersPerSlice = m_settings.numTilesX * m_settings.numTilesY;
+	for (int iSlice = 0; iSlice < m_settings.numSlices; ++iSlice) {
+		const int sliceFirstIndex = int(m_lightIndices.size());
+		for (int iCluster = iSlice * numClustersPerSlice; iCluster < (iSlice + 1) * numClustersPerSlice; ++iCluster) {
+			m_clusterRanges[iCluster].firstIndex += sliceFirstIndex;
+		}
+
+		const std::vector<int>& sliceIndices = m_sliceBins[iSlice].lightIndices;
+		m_lightIndices.insert(m_lightIndices.end(), sliceIndices.begin(), sliceIndices.end());
+	}
+}
+
+void LightClusters::binSlice(const int iSlice) {
+	const int numClustersPerSlice = m_settings.numTilesX * m_settings.numTilesY;
+
+	SliceBins& bins = m_sliceBins[iSlice];
+	bins.pairs.clear();
+
+	bins.clusterBoxes.resize(numClustersPerSlice);
+	for (int iy = 0; iy < m_settings.numTilesY; ++iy) {
+		for (int ix = 0; ix < m_settings.numTilesX; ++ix) {
+			bins.clusterBoxes[ix + m_settings.numTilesX * iy] = computeClusterBoxVs(ix, iy, iSlice);
+		}
+	}
+
+	// The lights are visited in order, so the lights of each cluster are sorted.
+	for (const LightVs& light : m_lightsVs) {
+		if (iSlice < light.firstSlice || iSlice > light.lastSlice) {
+			continue;
+		}
+
+		// Only the clusters whose boxes overlap the box of the light sphere could be affected.
+		int firstTileX, lastTileX, firstTileY, lastTileY;
+		findOverlappingTiles(bins.clusterBoxes.data(), 0, light.position.x - light.range, light.position.x + light.range, firstTileX, lastTileX);
+		findOverlappingTiles(bins.clusterBoxes.data(), 1, light.position.y - light.range, light.position.y + light.range, firstTileY, lastTileY);
+
+		for (int iy = firstTileY; iy <= lastTileY; ++iy) {
+			for (int ix = firstTileX; ix <= lastTileX; ++ix) {
+				const AABox3f& clusterBox = bins.clusterBoxes[ix + m_settings.numTilesX * iy];
+				if (doesLightAffectBox(light.position, light.range, light.isSpot, light.spotDirection, light.spotCosAngle, clusterBox)) {
+					ClusterLightPair pair;
+					pair.iClusterInSlice = ix + m_settings.numTilesX * iy;
+					pair.iLight = light.iLight;
+					bins.pairs.push_back(pair);
+				}
+			}
+		}
+	}
+
+	// Counting sort of the pairs by cluster, the sort is stable so the lights stay sorted.
+	LightClusterRange* const sliceRanges = &m_clusterRanges[iSlice * numClustersPerSlice];
+	for (int iCluster = 0; iCluster < numClustersPerSlice; ++iCluster) {
+		sliceRanges[iCluster] = LightClusterRange();
+	}
+
+	for (const ClusterLightPair& pair : bins.pairs) {
+		sliceRanges[pair.iClusterInSlice].numLights++;
+	}
+
+	int firstIndex = 0;
+	for (int iCluster = 0; iCluster < numClustersPerSlice; ++iCluster) {
+		sliceRanges[iCluster].firstIndex = firstIndex;
+		firstIndex += sliceRanges[iCluster].numLights;
+	}
+
+	bins.lightIndices.resize(bins.pairs.size());
+	for (int iCluster = 0; iCluster < numClustersPerSlice; ++iCluster) {
+		// The counts get recomputed while writing the indices.
+		sliceRanges[iCluster].numLights = 0;
+	}
+
+	for (const ClusterLightPair& pair : bins.pairs) {
+		LightClusterRange& range = sliceRanges[pair.iClusterInSlice];
+		bins.lightIndices[range.firstIndex + range.numLights] = pair.iLight;
+		range.numLights++;
+	}
+}
+
+void LightClusters::upload(SGEContext* const sgecon) {
+	const int numClustersPerSlice = m_settings.numTilesX * m_settings.numTilesY;
+
+	m_clustersTexels.resize(m_clusterRanges.size());
+	for (size_t iCluster = 0; iCluster < m_clusterRanges.size(); ++iCluster) {
+		const LightClusterRange& range = m_clusterRanges[iCluster];
+		m_clustersTexels[iCluster] = vec4f(float(range.firstIndex), float(range.numLights), 0.f, 0.f);
+	}
+	uploadTexels(sgecon, m_clustersTex, m_clustersTexels, numClustersPerSlice, m_settings.numSlices);
+
+	// 4 indices per texel.
+	const int numIndexTexelsPerRow = kNumLightIndicesPerRow / 4;
+	const int numIndexRows = (int(m_lightIndices.size()) + kNumLightIndicesPerRow - 1) / kNumLightIndicesPerRow;
+	m_lightIndicesTexels.assign(size_t(numIndexRows) * numIndexTexelsPerRow, vec4f(0.f));
+	for (size_t t = 0; t < m_lightIndices.size(); ++t) {
+		m_lightIndicesTexels[t / 4][int(t % 4)] = float(m_lightIndices[t]);
+	}
+	uploadTexels(sgecon, m_lightIndicesTex, m_lightIndicesTexels, numIndexTexelsPerRow, roundUpRows(numIndexRows));
+
+	const int numLightRows = int(m_lightsTexels.size()) / kNumTexelsPerLight;
+	uploadTexels(sgecon, m_lightsTex, m_lightsTexels, kNumTexelsPerLight, numLightRows);
+}
+
+vec4f LightClusters::getShaderGridSize() const {
+	return vec4f(float(m_settings.numTilesX), float(m_settings.numTilesY), float(m_settings.numSlices), 0.f);
+}
+
+vec4f LightClusters::getShaderDepthParams() const {
+	// slice = floor(log(depth) * z - w), see @computeSlice.
+	const float slicesPerLog = float(m_settings.numSlices) / m_logDepthRatio;
+	return vec4f(m_nearPlane, m_farPlane, slicesPerLog, logf(m_nearPlane) * slicesPerLog);
+}
+
+} // namespace sge
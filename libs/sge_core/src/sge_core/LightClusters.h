@@ -0,0 +1,177 @@
+#pragma once
+
+#include <vector>
+
+#include "sge_core/sgecore_api.h"
+#include "sge_renderer/renderer/renderer.h"
+#include "sge_utils/math/Box.h"
+#include "sge_utils/math/mat4.h"
+
+namespace sge {
+
+struct ShadingLightData;
+struct ThreadPool;
+
+/// Describes how the view frustum gets split into clusters.
+struct LightClustersSettings {
+	/// The number of tiles along the width of the screen.
+	int numTilesX = 16;
+	/// The number of tiles along the height of the screen.
+	int numTilesY = 9;
+	/// The number of depth slices, the slices get exponentially thicker with the distance to the camera.
+	int numSlices = 24;
+};
+
+/// The lights of a cluster, a range in @LightClusters::getLightIndices.
+struct LightClusterRange {
+	int firstIndex = 0;
+	int numLights = 0;
+};
+
+/// @brief Splits the view frustum into clusters (froxels) and finds the lights that could affect each cluster.
+/// The shading of a pixel then only needs to evaluate the lights of its cluster, instead of testing every light against every object.
+/// Only the point and the spot lights without shadow maps get clustered, see @isLightClusterable.
+///
+/// The clusters are in view space, the depth slices are between the specified near and far planes.
+/// The lights of each cluster are sorted by their index, so the result doesn't depend on the threads used for binning.
+///
+/// The result is meant to be uploaded to RGBA32F textures (see @upload) and used by the clustered lighting
+/// of the forward shading (see kLightingClustered in ShadeCommon.h):
+///   - the clusters texture, numTilesX*numTilesY texels wide and numSlices texels high, x is the first index and y is the number of lights;
+///   - the indices texture, the indices of the lights of all clusters, 4 indices per texel and @kNumLightIndicesPerRow per row;
+///   - the lights texture, a row of @kNumTexelsPerLight texels for each light passed to @build.
+struct SGE_CORE_API LightClusters {
+	static constexpr int kNumTexelsPerLight = 3;
+	static constexpr int kNumLightIndicesPerRow = 1024;
+
+	/// Returns true if the light could be shaded via the clusters.
+	/// The shadowed lights need their shadow maps bound and the directional lights affect everything, these stay per object.
+	static bool isLightClusterable(const ShadingLightData& light);
+
+	/// Returns true if the light could affect something inside the box, everything is in the same space.
+	/// The test is conservative, it may return true for boxes only near the light.
+	/// @param [in] spotCosAngle the cosine of the half angle of the spot light cone, ignored if @isSpot is false.
+	static bool doesLightAffectBox(const vec3f& lightPosition,
+	                               const float range,
+	                               const bool isSpot,
+	                               const vec3f& spotDirection,
+	                               const float spotCosAngle,
+	                               const AABox3f& box);
+
+	/// Changes the cluster grid, takes effect on the next @build.
+	void setSettings(const LightClustersSettings& settings);
+	const LightClustersSettings& getSettings() const { return m_settings; }
+
+	/// @brief Finds the lights that could affect each cluster.
+	/// @param [in] view the view transform of the camera.
+	/// @param [in] proj the projection of the camera, perspective or orthographic.
+	/// @param [in] nearPlane, farPlane the range of view space depths covered by the clusters.
+	/// @param [in] lights the lights, the non-clusterable lights are skipped (see @isLightClusterable).
+	/// @param [in] threadPool if not nullptr, the depth slices are binned in parallel. The result is the same either way.
+	void build(const mat4f& view,
+	           const mat4f& proj,
+	           const float nearPlane,
+	           const float farPlane,
+	           const ShadingLightData* const lights,
+	           const int numLights,
+	           ThreadPool* const threadPool);
+
+	int getNumClusters() const { return m_settings.numTilesX * m_settings.numTilesY * m_settings.numSlices; }
+	int getClusterIndex(const int ix, const int iy, const int iz) const {
+		return ix + m_settings.numTilesX * (iy + m_settings.numTilesY * iz);
+	}
+
+	/// Returns the index of the cluster containing the specified world space point, -1 if the point is outside of the clusters.
+	int findCluster(const vec3f& positionWs) const;
+
+	/// Computes the view space bounding box of the specified cluster.
+	AABox3f computeClusterBoxVs(const int ix, const int iy, const int iz) const;
+
+	LightClusterRange getClusterLights(const int iCluster) const { return m_clusterRanges[iCluster]; }
+
+	/// The indices (in the array passed to @build) of the lights of all clusters, see @getClusterLights.
+	const std::vector<int>& getLightIndices() const { return m_lightIndices; }
+
+	/// Uploads the result of the last @build to the textures used by the shaders.
+	void upload(SGEContext* const sgecon);
+
+	Texture* getClustersTexture() const { return m_clustersTex.GetPtr(); }
+	Texture* getLightIndicesTexture() const { return m_lightIndicesTex.GetPtr(); }
+	Texture* getLightsTexture() const { return m_lightsTex.GetPtr(); }
+
+	/// The number of tiles and slices (x,y,z) used by the shaders to find the cluster of a pixel, w is unused.
+	vec4f getShaderGridSize() const;
+	/// The parameters used by the shaders to compute the slice of a pixel, see lib_light_clusters.shader.
+	vec4f getShaderDepthParams() const;
+
+  private:
+	/// A clusterable light in view space.
+	struct LightVs {
+		int iLight = 0;
+		vec3f position;
+		float range = 0.f;
+		bool isSpot = false;
+		vec3f spotDirection;
+		float spotCosAngle = 0.f;
+		int firstSlice = 0;
+		int lastSlice = -1;
+	};
+
+	/// A light affecting a cluster of a slice.
+	struct ClusterLightPair {
+		int iClusterInSlice = 0;
+		int iLight = 0;
+	};
+
+	/// The result of binning a single slice, the slices are binned independently.
+	struct SliceBins {
+		/// The view space boxes of the clusters in the slice.
+		std::vector<AABox3f> clusterBoxes;
+		std::vector<ClusterLightPair> pairs;
+		/// The lights of the clusters in the slice, sorted by cluster and then by light.
+		std::vector<int> lightIndices;
+	};
+
+	/// Returns the view space depth where the slice @iSlice starts.
+	float getSliceNearDepth(const int iSlice) const;
+	/// Returns the slice that contains the specified view space depth, the result is not clamped.
+	int computeSlice(const float depth) const;
+	/// Converts a x or y value in normalized device coordinates to a tile index, the result is not clamped.
+	static int ndcToTile(const float ndc, const int numTiles);
+
+	/// Finds the range of tiles along an axis whose cluster boxes overlap the specified range of coordinates.
+	/// @param [in] axis 0 for x, 1 for y.
+	/// @param [in] clusterBoxes the boxes of the clusters in a slice.
+	void findOverlappingTiles(
+	    const AABox3f* const clusterBoxes, const int axis, const float minCoord, const float maxCoord, int& outFirst, int& outLast) const;
+
+	void binSlice(const int iSlice);
+
+  private:
+	LightClustersSettings m_settings;
+
+	mat4f m_view = mat4f::getIdentity();
+	mat4f m_proj = mat4f::getIdentity();
+	bool m_isPerspective = true;
+	float m_nearPlane = 0.1f;
+	float m_farPlane = 100.f;
+	/// The logarithm of @m_farPlane / @m_nearPlane.
+	float m_logDepthRatio = 1.f;
+
+	std::vector<LightVs> m_lightsVs;
+	std::vector<SliceBins> m_sliceBins;
+
+	std::vector<LightClusterRange> m_clusterRanges;
+	std::vector<int> m_lightIndices;
+
+	/// The texels for each of the textures, padded to the size of the texture.
+	std::vector<vec4f> m_clustersTexels;
+	std::vector<vec4f> m_lightIndicesTexels;
+	std::vector<vec4f> m_lightsTexels;
+
+	GpuHandle<Texture> m_clustersTex;
+	GpuHandle<Texture> m_lightIndicesTex;
+	GpuHandle<Texture> m_lightsTex;
+};
+
+} // namespace sge
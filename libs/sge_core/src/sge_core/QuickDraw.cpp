@@ -1,5 +1,6 @@
 #include "QuickDraw.h"
 
+#include "sge_core/AssetLibrary.h"
 #include "sge_core/ICore.h"
 #include "sge_utils/math/color.h"
 #include <sge_utils/math/Box.h>
@@ -479,6 +480,8 @@ void QuickDraw::drawRectTexture(const RenderDestination& rdest,
 		return;
 	}
 
+	getCore()->getAssetLib()->getTextureStreaming().requestForScreenSize(texture, maxOf(width, height));
+
 	vec4f region(topUV, bottomUV);
 
 	const mat4f sizeScaling = mat4f::getScaling(width / 2.f, height / 2.f, 1.f);
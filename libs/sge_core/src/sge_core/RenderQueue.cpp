@@ -0,0 +1,181 @@
+#include <utility>
+
+#include "RenderQueue.h"
+
+namespace sge {
+
+namespace {
+	constexpr uint64 fieldMask(const int numBits) { return (uint64(1) << numBits) - 1; }
+
+	constexpr int kPassShift = 64 - RenderSortKey::kPassBits;
+
+	// The shifts of the fields in the keys of the opaque items.
+	constexpr int kOpaqueProgramShift = kPassShift - RenderSortKey::kProgramBits;
+	constexpr int kOpaqueMaterialShift = kOpaqueProgramShift - RenderSortKey::kMaterialBits;
+	constexpr int kOpaqueMeshShift = kOpaqueMaterialShift - RenderSortKey::kMeshBits;
+	static_assert(kOpaqueMeshShift == RenderSortKey::kDepthBits, "The fields of the sort key must fill exactly 64 bits");
+
+	// The shifts of the fields in the keys of the transparent items.
+	constexpr int kTransparentDepthShift = kPassShift - RenderSortKey::kDepthBits;
+	constexpr int kTransparentProgramShift = kTransparentDepthShift - RenderSortKey::kProgramBits;
+	constexpr int kTransparentMaterialShift = kTransparentProgramShift - RenderSortKey::kMaterialBits;
+	constexpr int kTransparentMeshShift = kTransparentMaterialShift - RenderSortKey::kMeshBits;
+	static_assert(kTransparentMeshShift == 0, "The fields of the sort key must fill exactly 64 bits");
+
+	/// The number of bits sorted by each pass of the radix sort.
+	constexpr int kRadixBits = 8;
+	constexpr int kRadixSize = 1 << kRadixBits;
+	constexpr int kNumRadixPasses = 64 / kRadixBits;
+} // namespace
+
+//--------------------------------------------------------------------
+// RenderSortKey
+//--------------------------------------------------------------------
+uint32 RenderSortKey::quantizeDepth(const float depth, const float maxDepth) {
+	const uint32 maxQuantized = uint32(fieldMask(kDepthBits));
+	if (!(depth > 0.f) || !(maxDepth > 0.f)) {
+		return 0;
+	}
+
+	if (depth >= maxDepth) {
+		return maxQuantized;
+	}
+
+	return uint32((depth / maxDepth) * float(maxQuantized));
+}
+
+uint64 RenderSortKey::make(const RenderQueuePass pass, const RenderItemState& state, const float depth, const float maxDepth) {
+	const uint64 depthQuantized = quantizeDepth(depth, maxDepth);
+	const uint64 program = state.program & fieldMask(kProgramBits);
+	const uint64 material = state.material & fieldMask(kMaterialBits);
+	const uint64 mesh = state.mesh & fieldMask(kMeshBits);
+
+	uint64 key = uint64(pass) << kPassShift;
+	if (pass == renderQueuePass_transparent) {
+		// Invert the depth, so the furthest items come first.
+		key |= (fieldMask(kDepthBits) - depthQuantized) << kTransparentDepthShift;
+		key |= program << kTransparentProgramShift;
+		key |= material << kTransparentMaterialShift;
+		key |= mesh << kTransparentMeshShift;
+	} else {
+		key |= program << kOpaqueProgramShift;
+		key |= material << kOpaqueMaterialShift;
+		key |= mesh << kOpaqueMeshShift;
+		key |= depthQuantized;
+	}
+
+	return key;
+}
+
+RenderQueuePass RenderSortKey::getPass(const uint64 key) {
+	return RenderQueuePass(key >> kPassShift);
+}
+
+RenderItemState RenderSortKey::getState(const uint64 key) {
+	if (getPass(key) == renderQueuePass_transparent) {
+		return RenderItemState(uint32((key >> kTransparentProgramShift) & fieldMask(kProgramBits)),
+		                       uint32((key >> kTransparentMaterialShift) & fieldMask(kMaterialBits)),
+		                       uint32((key >> kTransparentMeshShift) & fieldMask(kMeshBits)));
+	}
+
+	return RenderItemState(uint32((key >> kOpaqueProgramShift) & fieldMask(kProgramBits)),
+	                       uint32((key >> kOpaqueMaterialShift) & fieldMask(kMaterialBits)),
+	                       uint32((key >> kOpaqueMeshShift) & fieldMask(kMeshBits)));
+}
+
+uint32 RenderSortKey::getDepth(const uint64 key) {
+	if (getPass(key) == renderQueuePass_transparent) {
+		return uint32(fieldMask(kDepthBits) - ((key >> kTransparentDepthShift) & fieldMask(kDepthBits)));
+	}
+
+	return uint32(key & fieldMask(kDepthBits));
+}
+
+//--------------------------------------------------------------------
+// RenderQueue
+//--------------------------------------------------------------------
+void RenderQueue::clear() {
+	m_items.clear();
+}
+
+void RenderQueue::add(const uint64 sortKey, const int payloadIndex) {
+	RenderItem item;
+	item.sortKey = sortKey;
+	item.payloadIndex = payloadIndex;
+	m_items.push_back(item);
+}
+
+int RenderQueue::countStateChanges(const RenderItem* const items, const int numItems) {
+	int numChanges = 0;
+	RenderItemState prevState;
+	for (int iItem = 0; iItem < numItems; ++iItem) {
+		const RenderItemState state = RenderSortKey::getState(items[iItem].sortKey);
+		if (iItem == 0) {
+			numChanges += 3;
+		} else {
+			numChanges += (state.program != prevState.program) ? 1 : 0;
+			numChanges += (state.material != prevState.material) ? 1 : 0;
+			numChanges += (state.mesh != prevState.mesh) ? 1 : 0;
+		}
+		prevState = state;
+	}
+
+	return numChanges;
+}
+
+void RenderQueue::sort() {
+	const int numItems = int(m_items.size());
+
+	m_stats = RenderQueueStats();
+	m_stats.numItems = numItems;
+	m_stats.numStateChangesUnsorted = countStateChanges(m_items.data(), numItems);
+
+	if (numItems > 1) {
+		// Build the histograms of all passes at once.
+		int histograms[kNumRadixPasses][kRadixSize] = {};
+		for (const RenderItem& item : m_items) {
+			for (int iPass = 0; iPass < kNumRadixPasses; ++iPass) {
+				histograms[iPass][(item.sortKey >> (iPass * kRadixBits)) & (kRadixSize - 1)]++;
+			}
+		}
+
+		m_sortScratch.resize(numItems);
+		RenderItem* src = m_items.data();
+		RenderItem* dst = m_sortScratch.data();
+
+		// Least significant digit first, each pass is stable so the result is sorted by the whole key.
+		for (int iPass = 0; iPass < kNumRadixPasses; ++iPass) {
+			int* const histogram = histograms[iPass];
+			const int shift = iPass * kRadixBits;
+
+			// If all keys have the same digit the pass wouldn't change anything.
+			if (histogram[(src[0].sortKey >> shift) & (kRadixSize - 1)] == numItems) {
+				continue;
+			}
+
+			// Turn the counts into offsets.
+			int offset = 0;
+			for (int iDigit = 0; iDigit < kRadixSize; ++iDigit) {
+				const int count = histogram[iDigit];
+				histogram[iDigit] = offset;
+				offset += count;
+			}
+
+			for (int iItem = 0; iItem < numItems; ++iItem) {
+				const RenderItem& item = src[iItem];
+				dst[histogram[(item.sortKey >> shift) & (kRadixSize - 1)]++] = item;
+			}
+
+			std::swap(src, dst);
+		}
+
+		// After an odd number of passes the result is in the scratch buffer.
+		if (src != m_items.data()) {
+			m_items.swap(m_sortScratch);
+		}
+	}
+
+	m_stats.numStateChangesSorted = countStateChanges(m_items.data(), numItems);
+}
+
+} // namespace sge
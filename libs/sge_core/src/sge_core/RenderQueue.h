@@ -0,0 +1,105 @@
+#pragma once
+
+#include <vector>
+
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+/// The passes of the render queue, the items of the earlier passes get drawn first.
+enum RenderQueuePass : int {
+	renderQueuePass_opaque = 0,      ///< Sorted by state to minimize the state changes, then front to back.
+	renderQueuePass_transparent = 1, ///< Sorted back to front. The state only orders the items at the same depth.
+};
+
+/// @brief The state needed for drawing a render item. The values only need to be equal for equal states,
+/// usually they are hashes of the used resources. Only the lower bits of each value are used, see @RenderSortKey.
+struct RenderItemState {
+	RenderItemState() = default;
+	RenderItemState(const uint32 program, const uint32 material, const uint32 mesh)
+	    : program(program)
+	    , material(material)
+	    , mesh(mesh) {}
+
+	bool operator==(const RenderItemState& other) const {
+		return program == other.program && material == other.material && mesh == other.mesh;
+	}
+
+	uint32 program = 0;  ///< The shading program (permutation) used.
+	uint32 material = 0; ///< The textures and the material parameters.
+	uint32 mesh = 0;     ///< The vertex and index buffers.
+};
+
+/// @brief Packs the pass, the state and the depth of a render item in a 64 bit integer,
+/// so sorting the keys sorts the items in the order they need to be drawn.
+/// The fields, starting from the most significant bits:
+///   opaque:      [pass 2][program 10][material 16][mesh 16][depth 20]
+///   transparent: [pass 2][inverted depth 20][program 10][material 16][mesh 16]
+struct SGE_CORE_API RenderSortKey {
+	static constexpr int kPassBits = 2;
+	static constexpr int kProgramBits = 10;
+	static constexpr int kMaterialBits = 16;
+	static constexpr int kMeshBits = 16;
+	static constexpr int kDepthBits = 20;
+
+	/// @param [in] depth the distance to the camera along its view direction.
+	/// @param [in] maxDepth the depths are quantized in the range [0;maxDepth], usually the far plane distance.
+	static uint64 make(const RenderQueuePass pass, const RenderItemState& state, const float depth, const float maxDepth);
+
+	static RenderQueuePass getPass(const uint64 key);
+
+	/// Returns the state stored in the key, only the lower bits of the original values are preserved.
+	static RenderItemState getState(const uint64 key);
+
+	/// Returns the quantized depth stored in the key.
+	static uint32 getDepth(const uint64 key);
+
+	/// Returns the depth quantized as it is stored in the keys.
+	static uint32 quantizeDepth(const float depth, const float maxDepth);
+};
+
+struct RenderItem {
+	uint64 sortKey = 0;
+	/// The index of the data needed to draw the item, the data is owned by the user of the queue.
+	int payloadIndex = -1;
+};
+
+struct RenderQueueStats {
+	int numItems = 0;
+	/// The number of state changes (program, material or mesh) if the items were drawn in the order they were added.
+	int numStateChangesUnsorted = 0;
+	/// The number of state changes when drawing the sorted items.
+	int numStateChangesSorted = 0;
+};
+
+/// @brief Collects render items and sorts them by their keys (see @RenderSortKey) before they get drawn.
+/// The queue doesn't draw anything, the user draws the items in the order of @getItems after @sort.
+struct SGE_CORE_API RenderQueue {
+	void clear();
+
+	void add(const uint64 sortKey, const int payloadIndex);
+
+	/// @brief Sorts the items by their keys with a radix sort. The sort is stable - items with equal keys keep
+	/// the order they were added in. Updates the statistics returned by @getStats.
+	void sort();
+
+	const std::vector<RenderItem>& getItems() const { return m_items; }
+	int size() const { return int(m_items.size()); }
+	bool isEmpty() const { return m_items.empty(); }
+
+	/// The statistics of the last @sort.
+	const RenderQueueStats& getStats() const { return m_stats; }
+
+	/// Counts how many times the program, the material and the mesh change when drawing the items in order.
+	/// The first item counts as changing all three.
+	static int countStateChanges(const RenderItem* const items, const int numItems);
+
+  private:
+	std::vector<RenderItem> m_items;
+	/// The second buffer used by the radix sort.
+	std::vector<RenderItem> m_sortScratch;
+	RenderQueueStats m_stats;
+};
+
+} // namespace sge
@@ -2,6 +2,8 @@
 
 #include "IconsForkAwesome/IconsForkAwesome.h"
 #include "application/application.h"
+#include "sge_core/AssetLibrary.h"
+#include "sge_core/ICore.h"
 #include "sge_utils/math/transform.h"
 #include "sge_utils/utils/StaticArray.h"
 
@@ -434,6 +436,10 @@ void SGEImGui::renderDrawLists(ImDrawData* imDrawData) {
 
 				Texture* pTexture = ((Texture*)pcmd->TextureId);
 
+				// The images in the UI (asset previews, icons) need to be reported to the texture streaming,
+				// otherwise only their least detailed mips would be resident.
+				getCore()->getAssetLib()->getTextureStreaming().requestMip(pTexture, 0);
+
 				// [HACK] Some resource may die during composing of ImGui Windows,
 				// An examples is a window with a FrameTarget. When the user closes the window
 				// the texture dies with it, but the draw call in ImGui were already submited,
@@ -0,0 +1,95 @@
+#include "ShadowCacheInvalidator.h"
+
+namespace sge {
+
+void ShadowCacheInvalidator::addDirtyBounds(const AABox3f& boundsWs) {
+	if (boundsWs.IsEmpty()) {
+		return;
+	}
+
+	// Too many changes, a single big box is conservative and keeps @beginFrame cheap.
+	if (int(m_dirtyBounds.size()) >= kMaxDirtyBounds) {
+		AABox3f merged = boundsWs;
+		for (const AABox3f& box : m_dirtyBounds) {
+			merged.expand(box);
+		}
+
+		m_dirtyBounds.clear();
+		m_dirtyBounds.push_back(merged);
+		return;
+	}
+
+	m_dirtyBounds.push_back(boundsWs);
+}
+
+void ShadowCacheInvalidator::invalidateAll() {
+	for (auto& itr : m_lights) {
+		itr.second.isValid = false;
+	}
+}
+
+void ShadowCacheInvalidator::beginFrame() {
+	m_stats = ShadowCacheStats();
+
+	if (m_dirtyBounds.empty()) {
+		return;
+	}
+
+	for (auto& itr : m_lights) {
+		LightEntry& light = itr.second;
+		if (light.isValid == false) {
+			continue;
+		}
+
+		// Unbounded lights are affected by every change.
+		if (light.volumeWs.IsEmpty()) {
+			light.isValid = false;
+			continue;
+		}
+
+		for (const AABox3f& dirtyBox : m_dirtyBounds) {
+			if (light.volumeWs.overlaps(dirtyBox)) {
+				light.isValid = false;
+				break;
+			}
+		}
+	}
+
+	m_dirtyBounds.clear();
+}
+
+bool ShadowCacheInvalidator::updateLight(const int lightId, const AABox3f& volumeWs, const uint64 stateHash) {
+	LightEntry& light = m_lights[lightId];
+
+	const bool isVolumeSame = (volumeWs.IsEmpty() && light.volumeWs.IsEmpty()) || volumeWs == light.volumeWs;
+	const bool needsRedraw = light.isValid == false || light.stateHash != stateHash || isVolumeSame == false;
+
+	light.volumeWs = volumeWs;
+	light.stateHash = stateHash;
+	light.isValid = true;
+
+	if (needsRedraw) {
+		m_stats.numStaticRedraws++;
+	} else {
+		m_stats.numCacheHits++;
+	}
+
+	return needsRedraw;
+}
+
+void ShadowCacheInvalidator::removeLight(const int lightId) {
+	m_lights.erase(lightId);
+}
+
+void ShadowCacheInvalidator::clear() {
+	m_lights.clear();
+	m_dirtyBounds.clear();
+	m_stats = ShadowCacheStats();
+}
+
+bool ShadowCacheInvalidator::isLightCached(const int lightId) const {
+	const auto itr = m_lights.find(lightId);
+	return itr != m_lights.end() && itr->second.isValid;
+}
+
+} // namespace sge
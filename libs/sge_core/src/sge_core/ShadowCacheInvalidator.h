@@ -0,0 +1,72 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/math/Box.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+struct ShadowCacheStats {
+	/// The number of lights whose static layer needed to be redrawn in the current frame.
+	int numStaticRedraws = 0;
+	/// The number of lights whose cached static layer was reused in the current frame.
+	int numCacheHits = 0;
+};
+
+/// @brief Decides when the cached shadow maps of the static shadow casters need to be redrawn.
+/// The shadow map of each light is split in two depth layers:
+///   - static: the casters that haven't moved recently, drawn once and cached between the frames;
+///   - dynamic: the moving casters, drawn every frame on top of a copy of the static layer.
+/// The static layer of a light stays valid until the light changes (see @updateLight) or the static casters change
+/// inside the volume of the light (see @addDirtyBounds). The static casters change when a caster starts or stops moving,
+/// gets added or gets removed.
+struct SGE_CORE_API ShadowCacheInvalidator {
+	/// The number of dirty boxes kept between two frames, when more get reported they are merged in a single box.
+	static constexpr int kMaxDirtyBounds = 256;
+
+	/// Reports that the static casters changed inside the box, empty boxes are ignored.
+	/// The lights get tested against the box on the next @beginFrame.
+	void addDirtyBounds(const AABox3f& boundsWs);
+
+	/// Invalidates the static layers of all lights, used when the casters changed in a way that isn't known.
+	void invalidateAll();
+
+	/// Applies the dirty boxes reported since the previous frame to all known lights. Call once per frame before @updateLight.
+	void beginFrame();
+
+	/// @brief Returns true if the static layer of the light needs to be redrawn, after that the layer is considered valid.
+	/// Lights skipped in a frame (for example ones outside of the view) keep their cache and still get invalidated by the dirty boxes.
+	/// @param [in] lightId a unique id of the light.
+	/// @param [in] volumeWs a box containing all casters that could affect the shadow map of the light. Empty means unbounded.
+	/// @param [in] stateHash a hash of everything besides the casters that affects the shadow map, like its cameras and resolution.
+	bool updateLight(const int lightId, const AABox3f& volumeWs, const uint64 stateHash);
+
+	/// Forgets the light, the next @updateLight for it returns true.
+	void removeLight(const int lightId);
+
+	/// Forgets all lights and dirty boxes.
+	void clear();
+
+	/// Returns true if the light has a valid cached static layer.
+	bool isLightCached(const int lightId) const;
+	int getNumLights() const { return int(m_lights.size()); }
+
+	/// The statistics since the last @beginFrame.
+	const ShadowCacheStats& getStats() const { return m_stats; }
+
+  private:
+	struct LightEntry {
+		AABox3f volumeWs;
+		uint64 stateHash = 0;
+		bool isValid = false;
+	};
+
+	std::unordered_map<int, LightEntry> m_lights;
+	std::vector<AABox3f> m_dirtyBounds;
+	ShadowCacheStats m_stats;
+};
+
+} // namespace sge
@@ -0,0 +1,133 @@
+#include "TextureStreamingManager.h"
+#include "sge_core/dds/dds.h"
+
+namespace sge {
+
+bool TextureStreamingManager::createStreamedTexture(SGEDevice& sgedev,
+                                                    GpuHandle<Texture>& outTexture,
+                                                    const char* const ddsPath,
+                                                    const SamplerDesc& samplerDesc) {
+	if (enabled == false) {
+		return false;
+	}
+
+	std::unique_ptr<MemoryMappedFile> file = std::make_unique<MemoryMappedFile>();
+	if (file->open(ddsPath) == false) {
+		return false;
+	}
+
+	DDSLoader loader;
+	TextureDesc desc;
+	std::vector<TextureData> mipsData;
+	if (loader.load(file->data(), file->size(), desc, mipsData) == false) {
+		return false;
+	}
+
+	const int numMips = desc.texture2D.numMips;
+	if (desc.textureType != UniformType::Texture2D || desc.texture2D.arraySize != 1 || desc.texture2D.numSamples > 1 || numMips <= 1 ||
+	    int(mipsData.size()) != numMips) {
+		return false;
+	}
+
+	GpuHandle<Texture> texture = sgedev.requestResource<Texture>();
+	if (texture->isMipStreamingSupported() == false) {
+		return false;
+	}
+
+	int numAlwaysResidentMips = 0;
+	for (int iMip = numMips - 1; iMip >= 0; --iMip) {
+		const int mipSize = maxOf(desc.texture2D.width >> iMip, desc.texture2D.height >> iMip);
+		if (mipSize > alwaysResidentMipSize && numAlwaysResidentMips > 0) {
+			break;
+		}
+		numAlwaysResidentMips++;
+	}
+
+	// Only the always resident mips get created, the rest get streamed in when requested.
+	std::vector<TextureData> initialData = mipsData;
+	for (int iMip = 0; iMip < numMips - numAlwaysResidentMips; ++iMip) {
+		initialData[iMip] = TextureData();
+	}
+
+	if (texture->create(desc, initialData.data(), samplerDesc) == false) {
+		return false;
+	}
+
+	std::vector<size_t> mipSizesBytes(numMips);
+	for (int iMip = 0; iMip < numMips; ++iMip) {
+		mipSizesBytes[iMip] = mipsData[iMip].sliceByteSize;
+	}
+
+	const int id = m_policy.addTexture(mipSizesBytes.data(), numMips, numAlwaysResidentMips, texture->getMostDetailedResidentMip());
+	if (id >= int(m_textures.size())) {
+		m_textures.resize(id + 1);
+	}
+
+	StreamedTexture& streamed = m_textures[id];
+	streamed.texture = texture;
+	streamed.file = std::move(file);
+	streamed.mipsData = std::move(mipsData);
+	m_textureToId[texture.GetPtr()] = id;
+
+	outTexture = texture;
+	return true;
+}
+
+void TextureStreamingManager::requestMip(const Texture* const texture, const int mip) {
+	const auto itr = m_textureToId.find(texture);
+	if (itr != m_textureToId.end()) {
+		const std::lock_guard<std::mutex> lock(m_requestsMutex);
+		m_policy.requestMip(itr->second, mip);
+	}
+}
+
+void TextureStreamingManager::requestFullResidency(const Texture* const texture) {
+	const auto itr = m_textureToId.find(texture);
+	if (itr != m_textureToId.end()) {
+		const std::lock_guard<std::mutex> lock(m_requestsMutex);
+		m_textures[itr->second].isAlwaysRequested = true;
+	}
+}
+
+void TextureStreamingManager::requestForScreenSize(const Texture* const texture, const float screenSizePixels) {
+	const auto itr = m_textureToId.find(texture);
+	if (itr == m_textureToId.end()) {
+		return;
+	}
+
+	int mip = 0;
+	if (screenSizePixels > 0.f) {
+		const TextureDesc& desc = texture->getDesc();
+		const int textureSize = maxOf(desc.texture2D.width, desc.texture2D.height);
+		mip = TextureStreamingPolicy::computeRequiredMip(textureSize, screenSizePixels, desc.texture2D.numMips);
+	}
+
+	const std::lock_guard<std::mutex> lock(m_requestsMutex);
+	m_policy.requestMip(itr->second, mip);
+}
+
+void TextureStreamingManager::update() {
+	// Release the textures that are used only by the manager.
+	for (int iTex = 0; iTex < int(m_textures.size()); ++iTex) {
+		StreamedTexture& streamed = m_textures[iTex];
+		if (streamed.texture.HasResource() && streamed.texture->getRefCount() == 1) {
+			m_textureToId.erase(streamed.texture.GetPtr());
+			m_policy.removeTexture(iTex);
+			streamed = StreamedTexture();
+		}
+	}
+
+	for (int iTex = 0; iTex < int(m_textures.size()); ++iTex) {
+		if (m_textures[iTex].isAlwaysRequested) {
+			m_policy.requestMip(iTex, 0);
+		}
+	}
+
+	m_policy.update(m_changes);
+	for (const TextureStreamingPolicy::ResidencyChange& change : m_changes) {
+		StreamedTexture& streamed = m_textures[change.textureId];
+		streamed.texture->setResidentMips(change.newMostDetailedMip, streamed.mipsData.data());
+	}
+}
+
+} // namespace sge
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "sge_core/TextureStreamingPolicy.h"
+#include "sge_core/sgecore_api.h"
+#include "sge_renderer/renderer/renderer.h"
+#include "sge_utils/utils/MemoryMappedFile.h"
+
+namespace sge {
+
+/// @brief Streams the most detailed mips of DDS textures in and out of the GPU memory.
+/// The textures are created with only their least detailed mips, which stay always resident. The rest get streamed in
+/// when the drawers request them with @requestMip or @requestForScreenSize. The code that uses textures without reporting
+/// them every frame needs to call @requestFullResidency, otherwise it would sample only the least detailed mips.
+/// What is resident is decided by @TextureStreamingPolicy.
+/// The DDS files of the streamed textures are kept memory mapped, so the mips could be uploaded again after eviction.
+struct SGE_CORE_API TextureStreamingManager {
+	TextureStreamingManager() = default;
+
+	TextureStreamingManager(const TextureStreamingManager&) = delete;
+	TextureStreamingManager& operator=(const TextureStreamingManager&) = delete;
+
+	/// @brief Creates a streamed texture from a DDS file. Only the always resident mips are uploaded, see the class description.
+	/// @return false if the file could not be loaded or if the texture cannot be streamed (it isn't a 2D texture with mips,
+	///         or the device doesn't support it). The caller should load the texture in the usual way then.
+	bool createStreamedTexture(SGEDevice& sgedev, GpuHandle<Texture>& outTexture, const char* const ddsPath, const SamplerDesc& samplerDesc);
+
+	/// @brief Reports that the specified mip of the texture is needed this frame. Textures that aren't streamed are ignored.
+	/// The requests could be made from multiple threads, but not while a texture is being created or during @update.
+	void requestMip(const Texture* const texture, const int mip);
+
+	/// @brief Keeps the texture fully resident from now on, as if its most detailed mip got requested every frame.
+	/// Meant for the code that uses the textures without reporting them, like game specific shaders. Like the other requests
+	/// it is still subject to the memory budget. Textures that aren't streamed are ignored.
+	void requestFullResidency(const Texture* const texture);
+
+	/// @brief Reports that the texture is going to cover around @screenSizePixels pixels on the screen this frame.
+	/// A value <= 0 means that the size is unknown and the most detailed mip gets requested.
+	/// Could be called from multiple threads, like @requestMip.
+	void requestForScreenSize(const Texture* const texture, const float screenSizePixels);
+
+	/// @brief Applies the residency changes based on the requests since the last update. Should be called once per frame.
+	/// Textures that are no longer used by anything else than the manager are released.
+	void update();
+
+	TextureStreamingPolicy::Settings& getSettings() { return m_policy.settings; }
+	const TextureStreamingPolicy& getPolicy() const { return m_policy; }
+
+  public:
+	/// If false new textures are created fully resident.
+	bool enabled = true;
+	/// The least detailed mips of the textures with size below or equal to this value are always resident.
+	int alwaysResidentMipSize = 64;
+
+  private:
+	struct StreamedTexture {
+		GpuHandle<Texture> texture;
+		std::unique_ptr<MemoryMappedFile> file;
+		std::vector<TextureData> mipsData; ///< Points in @file.
+		bool isAlwaysRequested = false;    ///< See @requestFullResidency.
+	};
+
+	TextureStreamingPolicy m_policy;
+	std::vector<StreamedTexture> m_textures; ///< Indexed by the texture ids in @m_policy.
+	std::unordered_map<const Texture*, int> m_textureToId;
+	std::vector<TextureStreamingPolicy::ResidencyChange> m_changes;
+	/// Guards the requests made to @m_policy, the drawers could record their draw calls on multiple threads.
+	std::mutex m_requestsMutex;
+};
+
+} // namespace sge
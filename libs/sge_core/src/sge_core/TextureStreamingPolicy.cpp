@@ -0,0 +1,243 @@
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+#include "TextureStreamingPolicy.h"
+
+namespace sge {
+
+int TextureStreamingPolicy::addTexture(const size_t* const mipSizesBytes,
+                                       const int numMips,
+                                       const int numAlwaysResidentMips,
+                                       const int initialMostDetailedMip) {
+	sgeAssert(mipSizesBytes != nullptr && numMips > 0);
+
+	int textureId = -1;
+	if (m_freeIds.empty() == false) {
+		textureId = m_freeIds.back();
+		m_freeIds.pop_back();
+	} else {
+		textureId = int(m_textures.size());
+		m_textures.emplace_back();
+	}
+
+	TextureState& tex = m_textures[textureId];
+	tex = TextureState();
+	tex.isUsed = true;
+	tex.numMips = numMips;
+	tex.alwaysResidentMip = numMips - std::min(std::max(numAlwaysResidentMips, 1), numMips);
+	tex.mostDetailedResidentMip = std::min(std::max(initialMostDetailedMip, 0), tex.alwaysResidentMip);
+	tex.targetMip = tex.mostDetailedResidentMip;
+	tex.targetFrame = m_frame;
+	tex.mipSizesBytes.assign(mipSizesBytes, mipSizesBytes + numMips);
+
+	tex.mipsTailSizesBytes.resize(numMips + 1);
+	tex.mipsTailSizesBytes[numMips] = 0;
+	for (int iMip = numMips - 1; iMip >= 0; --iMip) {
+		tex.mipsTailSizesBytes[iMip] = tex.mipsTailSizesBytes[iMip + 1] + tex.mipSizesBytes[iMip];
+	}
+
+	m_residentBytes += tex.mipsTailSizesBytes[tex.mostDetailedResidentMip];
+
+	return textureId;
+}
+
+void TextureStreamingPolicy::removeTexture(const int textureId) {
+	TextureState& tex = getTexture(textureId);
+	m_residentBytes -= tex.mipsTailSizesBytes[tex.mostDetailedResidentMip];
+	tex = TextureState();
+	m_freeIds.push_back(textureId);
+}
+
+void TextureStreamingPolicy::requestMip(const int textureId, const int mip) {
+	TextureState& tex = getTexture(textureId);
+	const int mipClamped = std::min(std::max(mip, 0), tex.numMips - 1);
+	if (tex.hasRequest == false || mipClamped < tex.requestedMip) {
+		tex.requestedMip = mipClamped;
+		tex.hasRequest = true;
+	}
+}
+
+void TextureStreamingPolicy::update(std::vector<ResidencyChange>& outChanges) {
+	outChanges.clear();
+	m_frame++;
+
+	// Update the targets based on the requests since the last update.
+	m_desiredMips.assign(m_textures.size(), 0);
+	size_t desiredBytes = 0;
+	for (int iTex = 0; iTex < int(m_textures.size()); ++iTex) {
+		TextureState& tex = m_textures[iTex];
+		if (tex.isUsed == false) {
+			continue;
+		}
+
+		if (tex.wasRequested == false && tex.hasRequest == false) {
+			m_desiredMips[iTex] = tex.mostDetailedResidentMip;
+			desiredBytes += tex.mipsTailSizesBytes[tex.mostDetailedResidentMip];
+			continue;
+		}
+		tex.wasRequested = true;
+
+		if (tex.hasRequest && tex.requestedMip <= tex.targetMip) {
+			tex.targetMip = tex.requestedMip;
+			tex.targetFrame = m_frame;
+		} else if (m_frame - tex.targetFrame > sint64(settings.evictionDelayFrames)) {
+			// Nothing needed the target in a while, fall back to what is needed now.
+			tex.targetMip = tex.hasRequest ? tex.requestedMip : tex.alwaysResidentMip;
+			tex.targetFrame = m_frame;
+		}
+
+		tex.targetMip = std::min(tex.targetMip, tex.alwaysResidentMip);
+		tex.hasRequest = false;
+
+		m_desiredMips[iTex] = tex.targetMip;
+		desiredBytes += tex.mipsTailSizesBytes[tex.targetMip];
+	}
+
+	// If the targets do not fit in the budget drop the most detailed mips. Textures that are closest to their target
+	// get degraded first so all textures lose detail evenly, for equal degradation the bigger mip gets dropped.
+	if (desiredBytes > settings.budgetBytes) {
+		struct Candidate {
+			int degradation;
+			size_t bytes;
+			int textureId;
+
+			bool operator<(const Candidate& other) const {
+				// std::priority_queue pops the biggest element, so the "biggest" is the one that should be degraded next.
+				if (degradation != other.degradation) {
+					return degradation > other.degradation;
+				}
+				return bytes < other.bytes;
+			}
+		};
+
+		std::priority_queue<Candidate> candidates;
+		for (int iTex = 0; iTex < int(m_textures.size()); ++iTex) {
+			const TextureState& tex = m_textures[iTex];
+			if (tex.isUsed && tex.wasRequested && m_desiredMips[iTex] < tex.alwaysResidentMip) {
+				candidates.push(Candidate{0, tex.mipSizesBytes[m_desiredMips[iTex]], iTex});
+			}
+		}
+
+		while (desiredBytes > settings.budgetBytes && candidates.empty() == false) {
+			const Candidate candidate = candidates.top();
+			candidates.pop();
+
+			const TextureState& tex = m_textures[candidate.textureId];
+			int& desiredMip = m_desiredMips[candidate.textureId];
+			desiredBytes -= tex.mipSizesBytes[desiredMip];
+			desiredMip++;
+
+			if (desiredMip < tex.alwaysResidentMip) {
+				candidates.push(Candidate{desiredMip - tex.targetMip, tex.mipSizesBytes[desiredMip], candidate.textureId});
+			}
+		}
+	}
+
+	// Evict the mips that aren't needed, this is done first so the stream-ins have the memory available.
+	m_streamInOrder.clear();
+	for (int iTex = 0; iTex < int(m_textures.size()); ++iTex) {
+		TextureState& tex = m_textures[iTex];
+		if (tex.isUsed == false) {
+			continue;
+		}
+
+		const int desiredMip = m_desiredMips[iTex];
+		if (desiredMip > tex.mostDetailedResidentMip) {
+			outChanges.push_back(ResidencyChange{iTex, tex.mostDetailedResidentMip, desiredMip});
+			m_residentBytes -= tex.mipsTailSizesBytes[tex.mostDetailedResidentMip] - tex.mipsTailSizesBytes[desiredMip];
+			tex.mostDetailedResidentMip = desiredMip;
+		} else if (desiredMip < tex.mostDetailedResidentMip) {
+			m_streamInOrder.push_back(iTex);
+		}
+	}
+
+	// Stream-in the missing mips. The textures that miss the most mips go first and the mips are streamed
+	// one level at the time, cycling trough the textures, so a single big texture doesn't delay all the others.
+	std::sort(m_streamInOrder.begin(), m_streamInOrder.end(), [this](const int a, const int b) -> bool {
+		const int missingA = m_textures[a].mostDetailedResidentMip - m_desiredMips[a];
+		const int missingB = m_textures[b].mostDetailedResidentMip - m_desiredMips[b];
+		if (missingA != missingB) {
+			return missingA > missingB;
+		}
+		return a < b;
+	});
+
+	const size_t firstStreamInChange = outChanges.size();
+	for (const int iTex : m_streamInOrder) {
+		const int mip = m_textures[iTex].mostDetailedResidentMip;
+		outChanges.push_back(ResidencyChange{iTex, mip, mip});
+	}
+
+	size_t streamedInBytes = 0;
+	bool isStreamInBudgetExhausted = false;
+	while (isStreamInBudgetExhausted == false) {
+		bool hasProgress = false;
+		for (size_t iChange = firstStreamInChange; iChange < outChanges.size(); ++iChange) {
+			ResidencyChange& change = outChanges[iChange];
+			if (change.newMostDetailedMip <= m_desiredMips[change.textureId]) {
+				continue;
+			}
+
+			const size_t mipBytes = m_textures[change.textureId].mipSizesBytes[change.newMostDetailedMip - 1];
+			if (streamedInBytes > 0 && streamedInBytes + mipBytes > settings.maxStreamInBytesPerUpdate) {
+				isStreamInBudgetExhausted = true;
+				break;
+			}
+
+			change.newMostDetailedMip--;
+			streamedInBytes += mipBytes;
+			hasProgress = true;
+		}
+
+		if (hasProgress == false) {
+			break;
+		}
+	}
+
+	// Apply the stream-ins and remove the ones that could not get any mip this update.
+	size_t numChanges = firstStreamInChange;
+	for (size_t iChange = firstStreamInChange; iChange < outChanges.size(); ++iChange) {
+		const ResidencyChange& change = outChanges[iChange];
+		if (change.newMostDetailedMip != change.oldMostDetailedMip) {
+			TextureState& tex = m_textures[change.textureId];
+			m_residentBytes += tex.mipsTailSizesBytes[change.newMostDetailedMip] - tex.mipsTailSizesBytes[change.oldMostDetailedMip];
+			tex.mostDetailedResidentMip = change.newMostDetailedMip;
+			outChanges[numChanges++] = change;
+		}
+	}
+	outChanges.resize(numChanges);
+}
+
+int TextureStreamingPolicy::getMostDetailedResidentMip(const int textureId) const {
+	return getTexture(textureId).mostDetailedResidentMip;
+}
+
+int TextureStreamingPolicy::computeRequiredMip(const int textureSize, const float screenSizePixels, const int numMips) {
+	if (numMips <= 1) {
+		return 0;
+	}
+
+	if (screenSizePixels <= 0.f) {
+		return numMips - 1;
+	}
+
+	const float texelsPerPixel = float(textureSize) / screenSizePixels;
+	if (texelsPerPixel <= 1.f) {
+		return 0;
+	}
+
+	return std::min(int(log2f(texelsPerPixel)), numMips - 1);
+}
+
+TextureStreamingPolicy::TextureState& TextureStreamingPolicy::getTexture(const int textureId) {
+	sgeAssert(textureId >= 0 && textureId < int(m_textures.size()) && m_textures[textureId].isUsed);
+	return m_textures[textureId];
+}
+
+const TextureStreamingPolicy::TextureState& TextureStreamingPolicy::getTexture(const int textureId) const {
+	sgeAssert(textureId >= 0 && textureId < int(m_textures.size()) && m_textures[textureId].isUsed);
+	return m_textures[textureId];
+}
+
+} // namespace sge
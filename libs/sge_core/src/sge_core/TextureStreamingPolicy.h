@@ -0,0 +1,99 @@
+#pragma once
+
+#include <vector>
+
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+/// @brief Decides which mip levels of the streamed textures should be resident in memory.
+/// The class does not touch any GPU resources, it only tracks the requests and the residency
+/// and produces a list of changes that the user (@TextureStreamingManager) needs to apply.
+///
+/// Each frame the drawer reports the most detailed mip needed for every texture it uses with @requestMip.
+/// When @update is called the policy:
+///   - keeps the most detailed mip requested in the last @Settings::evictionDelayFrames frames as a target, so moving the camera
+///     back and forth doesn't cause the same mips to get streamed in and out repeatedly,
+///   - if the targets do not fit in @Settings::budgetBytes, lowers the detail of the textures, starting with the ones that are
+///     closest to their requested detail, so the quality drops evenly across textures,
+///   - evicts the mips that are no longer needed and streams in the missing ones up to @Settings::maxStreamInBytesPerUpdate.
+/// The least detailed mips of each texture (see @addTexture) are always resident.
+/// Textures that were never requested keep their initial residency and aren't affected by the budget, not every
+/// drawer reports the textures it uses, so a texture without requests might still be in use.
+struct SGE_CORE_API TextureStreamingPolicy {
+	struct Settings {
+		/// The maximum amount of memory that the streamed textures could use, including the always resident mips.
+		size_t budgetBytes = 256 * 1024 * 1024;
+		/// The maximum amount of mip data to be streamed in by a single call to @update.
+		/// At least one mip gets streamed in per update, even if it is bigger than that.
+		size_t maxStreamInBytesPerUpdate = 16 * 1024 * 1024;
+		/// The number of updates a mip level is kept resident after the last request that needed it.
+		int evictionDelayFrames = 60;
+	};
+
+	/// Describes a change in the residency of a texture, all mips in [newMostDetailedMip; numMips) should be resident.
+	struct ResidencyChange {
+		int textureId = -1;
+		int oldMostDetailedMip = 0;
+		int newMostDetailedMip = 0;
+	};
+
+	/// @brief Starts tracking a texture.
+	/// @param [in] mipSizesBytes the memory used by each mip level, starting from the most detailed one.
+	/// @param [in] numAlwaysResidentMips the number of least detailed mips that are always resident.
+	/// @param [in] initialMostDetailedMip the most detailed mip that is currently resident. It cannot be more detailed than the
+	///             always resident mips.
+	/// @return the id of the texture used by the other functions.
+	int addTexture(const size_t* const mipSizesBytes, const int numMips, const int numAlwaysResidentMips, const int initialMostDetailedMip);
+	void removeTexture(const int textureId);
+
+	/// @brief Reports that the specified mip is needed for rendering the texture this frame.
+	/// The most detailed requested mip wins if the texture gets requested multiple times.
+	void requestMip(const int textureId, const int mip);
+
+	/// @brief Updates the residency of the textures based on the requests since the last update.
+	/// @param [out] outChanges the changes that the user needs to apply, all evictions come before the stream-ins.
+	void update(std::vector<ResidencyChange>& outChanges);
+
+	int getMostDetailedResidentMip(const int textureId) const;
+	size_t getResidentBytes() const { return m_residentBytes; }
+	int getNumTextures() const { return int(m_textures.size() - m_freeIds.size()); }
+
+	/// @brief Computes the mip level needed to draw a texture that covers the specified amount of pixels on the screen.
+	/// @param [in] textureSize the size (width or height) of the most detailed mip in texels.
+	/// @param [in] screenSizePixels the size in pixels the texture covers on the screen.
+	static int computeRequiredMip(const int textureSize, const float screenSizePixels, const int numMips);
+
+  public:
+	Settings settings;
+
+  private:
+	struct TextureState {
+		bool isUsed = false;
+		int numMips = 0;
+		int alwaysResidentMip = 0; ///< The most detailed of the always resident mips.
+		int mostDetailedResidentMip = 0;
+		int requestedMip = 0;      ///< The most detailed mip requested since the last update.
+		bool hasRequest = false;   ///< True if @requestedMip is valid.
+		bool wasRequested = false; ///< True if the texture was requested at least once, only then it gets streamed.
+		int targetMip = 0;       ///< The most detailed mip requested in the last @Settings::evictionDelayFrames.
+		sint64 targetFrame = 0;  ///< The frame @targetMip was last requested.
+		std::vector<size_t> mipSizesBytes;
+		std::vector<size_t> mipsTailSizesBytes; ///< [i] is the memory needed for mips [i; numMips).
+	};
+
+	TextureState& getTexture(const int textureId);
+	const TextureState& getTexture(const int textureId) const;
+
+	std::vector<TextureState> m_textures;
+	std::vector<int> m_freeIds;
+	size_t m_residentBytes = 0;
+	sint64 m_frame = 0;
+
+	// Scratch memory used by @update.
+	std::vector<int> m_desiredMips;
+	std::vector<int> m_streamInOrder;
+};
+
+} // namespace sge
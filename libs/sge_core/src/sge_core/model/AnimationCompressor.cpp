@@ -0,0 +1,246 @@
+#include <algorithm>
+#include <cmath>
+
+#include "AnimationCompressor.h"
+#include "Model.h"
+
+namespace sge {
+
+namespace {
+
+	float positionError(const vec3f& a, const vec3f& b) { return (a - b).length(); }
+
+	/// The rotation error is the displacement of a point at @shellDistance rotated by both quaternions.
+	float rotationError(const quatf& a, const quatf& b, const float shellDistance) {
+		const quatf diff = a.normalized() * b.normalized().conjugate();
+		const float angle = 2.f * atan2f(diff.xyz().length(), fabsf(diff.w));
+		return angle * shellDistance;
+	}
+
+	/// @brief Finds the smallest set of keys (always including the first one) that reproduce the @original values within
+	/// @tolerance when the @decoded values of the kept keys are sampled like @KeyFrameChannel::sample does.
+	/// The difference between the original and the reduced piecewise linear curves is largest at the original key times,
+	/// so checking only them is enough.
+	template <typename T, typename TErrorFn>
+	std::vector<int> findKeysToKeep(const std::vector<float>& times,
+	                                const std::vector<T>& original,
+	                                const std::vector<T>& decoded,
+	                                const float tolerance,
+	                                TErrorFn errorFn) {
+		const int numKeys = int(times.size());
+
+		// Channels that do not change need just one key.
+		bool isConstant = true;
+		for (int iKey = 0; iKey < numKeys && isConstant; ++iKey) {
+			isConstant = errorFn(decoded[0], original[iKey]) <= tolerance;
+		}
+
+		if (isConstant) {
+			return std::vector<int>(1, 0);
+		}
+
+		const auto isSegmentWithinTolerance = [&](const int a, const int b) -> bool {
+			const float dt = times[b] - times[a];
+			for (int iKey = a + 1; iKey < b; ++iKey) {
+				const T sampled = dt > 1e-6f ? lerp(decoded[a], decoded[b], (times[iKey] - times[a]) / dt) : decoded[b];
+				if ((errorFn(sampled, original[iKey]) <= tolerance) == false) {
+					return false;
+				}
+			}
+			return true;
+		};
+
+		// Greedily extend each segment as far as possible.
+		std::vector<int> keysToKeep(1, 0);
+		int segmentStart = 0;
+		while (segmentStart < numKeys - 1) {
+			int segmentEnd = segmentStart + 1;
+			while (segmentEnd + 1 < numKeys && isSegmentWithinTolerance(segmentStart, segmentEnd + 1)) {
+				segmentEnd++;
+			}
+
+			keysToKeep.push_back(segmentEnd);
+			segmentStart = segmentEnd;
+		}
+
+		return keysToKeep;
+	}
+
+	/// @brief Compresses a single channel, @quantizeFn quantizes all values of the channel in the compressed channel
+	/// (computing the range if needed). If the quantization error is too big the channel stays in floats with fewer keys.
+	template <typename T, typename TErrorFn, typename TQuantizeFn>
+	bool compressChannel(KeyFrameChannel<T>& channel,
+	                     CompressedKeyFrameChannel<T>& outCompressed,
+	                     const float tolerance,
+	                     TErrorFn errorFn,
+	                     TQuantizeFn quantizeFn) {
+		if (channel.empty() || outCompressed.empty() == false) {
+			return false;
+		}
+
+		const int numKeys = int(channel.size());
+
+		CompressedKeyFrameChannel<T> quantized;
+		quantized.times = channel.times;
+		quantizeFn(quantized, channel.values);
+
+		std::vector<T> decoded(numKeys);
+		float maxQuantizationError = 0.f;
+		for (int iKey = 0; iKey < numKeys; ++iKey) {
+			decoded[iKey] = quantized.getKey(iKey);
+			maxQuantizationError = std::max(maxQuantizationError, errorFn(decoded[iKey], channel.values[iKey]));
+		}
+
+		// Leave at least half of the tolerance for the key reduction.
+		const bool useQuantization = maxQuantizationError <= tolerance * 0.5f;
+		const std::vector<int> keysToKeep =
+		    findKeysToKeep(channel.times, channel.values, useQuantization ? decoded : channel.values, tolerance, errorFn);
+
+		if (useQuantization) {
+			outCompressed.times.clear();
+			outCompressed.quantizedValues.clear();
+			outCompressed.rangeMin = quantized.rangeMin;
+			outCompressed.rangeExtent = quantized.rangeExtent;
+			for (const int iKey : keysToKeep) {
+				outCompressed.times.push_back(quantized.times[iKey]);
+				outCompressed.quantizedValues.insert(outCompressed.quantizedValues.end(), &quantized.quantizedValues[size_t(iKey) * 3],
+				                                     &quantized.quantizedValues[size_t(iKey) * 3] + 3);
+			}
+
+			channel = KeyFrameChannel<T>();
+			return true;
+		}
+
+		if (int(keysToKeep.size()) == numKeys) {
+			return false;
+		}
+
+		KeyFrameChannel<T> reduced;
+		for (const int iKey : keysToKeep) {
+			reduced.setKey(channel.times[iKey], channel.values[iKey]);
+		}
+		channel = std::move(reduced);
+		return true;
+	}
+
+	void quantizeVec3Channel(CompressedKeyFrameChannel<vec3f>& channel, const std::vector<vec3f>& values) {
+		vec3f rangeMin = values[0];
+		vec3f rangeMax = values[0];
+		for (const vec3f& v : values) {
+			rangeMin = rangeMin.pickMin(v);
+			rangeMax = rangeMax.pickMax(v);
+		}
+
+		channel.rangeMin = rangeMin;
+		channel.rangeExtent = rangeMax - rangeMin;
+		channel.quantizedValues.resize(values.size() * 3);
+		for (size_t iKey = 0; iKey < values.size(); ++iKey) {
+			AnimationCompressor::quantizeVec3(&channel.quantizedValues[iKey * 3], values[iKey], channel.rangeMin, channel.rangeExtent);
+		}
+	}
+
+	void quantizeQuatChannel(CompressedKeyFrameChannel<quatf>& channel, const std::vector<quatf>& values) {
+		channel.quantizedValues.resize(values.size() * 3);
+		for (size_t iKey = 0; iKey < values.size(); ++iKey) {
+			AnimationCompressor::quantizeQuat(&channel.quantizedValues[iKey * 3], values[iKey]);
+		}
+	}
+
+} // namespace
+
+void AnimationCompressor::quantizeVec3(uint16 outQ[3], const vec3f& v, const vec3f& rangeMin, const vec3f& rangeExtent) {
+	for (int t = 0; t < 3; ++t) {
+		const float unorm = rangeExtent[t] > 0.f ? (v[t] - rangeMin[t]) / rangeExtent[t] : 0.f;
+		outQ[t] = uint16(lroundf(std::min(std::max(unorm, 0.f), 1.f) * 65535.f));
+	}
+}
+
+void AnimationCompressor::quantizeQuat(uint16 outQ[3], const quatf& q) {
+	const float length = q.length();
+	const quatf qn = length > 1e-6f ? q * (1.f / length) : quatf::getIdentity();
+
+	int droppedIndex = 0;
+	for (int iComp = 1; iComp < 4; ++iComp) {
+		if (fabsf(qn.data[iComp]) > fabsf(qn.data[droppedIndex])) {
+			droppedIndex = iComp;
+		}
+	}
+
+	const uint16 metadataBits[3] = {
+	    uint16(droppedIndex & 1),
+	    uint16((droppedIndex >> 1) & 1),
+	    uint16(qn.data[droppedIndex] < 0.f ? 1 : 0),
+	};
+
+	for (int iComp = 0, iStored = 0; iComp < 4; ++iComp) {
+		if (iComp != droppedIndex) {
+			// The remaining components are in [-1/sqrt(2);1/sqrt(2)].
+			const float unorm = qn.data[iComp] * 0.70710678f + 0.5f;
+			const uint16 q15 = uint16(lroundf(std::min(std::max(unorm, 0.f), 1.f) * 32767.f));
+			outQ[iStored] = uint16((q15 << 1) | metadataBits[iStored]);
+			++iStored;
+		}
+	}
+}
+
+void AnimationCompressor::computeNodesTolerance(std::vector<float>& outTolerances, const Model& model, const Settings& settings) {
+	const int numNodes = model.numNodes();
+	std::vector<int> depths(numNodes, 0);
+
+	// Walk the hierarchy from the root, parents first.
+	std::vector<int> nodesToVisit;
+	if (model.getRootNodeIndex() >= 0 && model.getRootNodeIndex() < numNodes) {
+		nodesToVisit.push_back(model.getRootNodeIndex());
+	}
+
+	int maxDepth = 0;
+	for (size_t iVisit = 0; iVisit < nodesToVisit.size(); ++iVisit) {
+		const int iNode = nodesToVisit[iVisit];
+		for (const int childIndex : model.nodeAt(iNode)->childNodes) {
+			if (childIndex >= 0 && childIndex < numNodes && childIndex != model.getRootNodeIndex() && depths[childIndex] == 0) {
+				depths[childIndex] = depths[iNode] + 1;
+				maxDepth = std::max(maxDepth, depths[childIndex]);
+				nodesToVisit.push_back(childIndex);
+			}
+		}
+	}
+
+	outTolerances.resize(numNodes);
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		outTolerances[iNode] = settings.maxError * float(depths[iNode] + 1) / float(maxDepth + 1);
+	}
+}
+
+bool AnimationCompressor::compressKeyFrames(KeyFrames& keyFrames, const float tolerance, const Settings& settings) {
+	const float shellDistance = settings.shellDistance;
+	const auto vec3ErrorFn = [](const vec3f& a, const vec3f& b) -> float { return positionError(a, b); };
+	const auto scalingErrorFn = [shellDistance](const vec3f& a, const vec3f& b) -> float { return positionError(a, b) * shellDistance; };
+	const auto quatErrorFn = [shellDistance](const quatf& a, const quatf& b) -> float { return rotationError(a, b, shellDistance); };
+
+	bool isModified = false;
+	isModified |= compressChannel(keyFrames.positionKeyFrames, keyFrames.compressedPositionKeyFrames, tolerance, vec3ErrorFn,
+	                              quantizeVec3Channel);
+	isModified |= compressChannel(keyFrames.rotationKeyFrames, keyFrames.compressedRotationKeyFrames, tolerance, quatErrorFn,
+	                              quantizeQuatChannel);
+	isModified |= compressChannel(keyFrames.scalingKeyFrames, keyFrames.compressedScalingKeyFrames, tolerance, scalingErrorFn,
+	                              quantizeVec3Channel);
+	return isModified;
+}
+
+bool AnimationCompressor::compressAnimation(ModelAnimation& animation, const Model& model, const Settings& settings) {
+	std::vector<float> tolerances;
+	computeNodesTolerance(tolerances, model, settings);
+
+	// Tracks of nodes that are not in the model get the smallest tolerance.
+	const float minTolerance = tolerances.empty() ? settings.maxError : *std::min_element(tolerances.begin(), tolerances.end());
+
+	bool isModified = false;
+	for (int iNode = 0; iNode < int(animation.perNodeKeyFrames.size()); ++iNode) {
+		const float tolerance = iNode < int(tolerances.size()) ? tolerances[iNode] : minTolerance;
+		isModified |= compressKeyFrames(animation.perNodeKeyFrames[iNode], tolerance, settings);
+	}
+
+	return isModified;
+}
+
+} // namespace sge
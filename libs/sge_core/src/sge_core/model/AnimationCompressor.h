@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/math/quat.h"
+#include "sge_utils/math/vec3.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+struct Model;
+struct ModelAnimation;
+struct KeyFrames;
+
+/// @brief Offline compression of the animation key frames, reducing the memory, the file size and the memory
+/// touched while sampling. For each channel of each animated node:
+///    - the keys that could be linearly interpolated from the remaining keys within the tolerance of the node are removed,
+///    - rotations are quantized to 48 bits with the "smallest three" encoding,
+///    - positions and scalings are quantized to 3 x 16 bits relative to the range of values of the channel in the clip.
+/// The compressed channels are stored in @KeyFrames::compressedPositionKeyFrames (and the others) and get decoded while sampling.
+/// If the quantization alone would exceed the tolerance of a channel it is kept in floats, only with the keys reduced.
+///
+/// The error of a node moves all of its children, so the tolerance of the nodes closer to the root is smaller:
+///     tolerance = maxError * (depth + 1) / (maxDepth + 1)
+/// The errors of rotations and scalings are measured as the displacement of a point at @Settings::shellDistance from the node.
+struct SGE_CORE_API AnimationCompressor {
+	struct Settings {
+		/// The maximum error allowed (in model units) for the deepest nodes in the hierarchy.
+		float maxError = 0.001f;
+		/// The distance from the node of the point used to measure the rotation and scaling errors (in model units).
+		float shellDistance = 0.5f;
+	};
+
+	/// @brief Quantizes a value in the range [@rangeMin; @rangeMin + @rangeExtent], see @KeyFrameQuantization::dequantizeVec3.
+	static void quantizeVec3(uint16 outQ[3], const vec3f& v, const vec3f& rangeMin, const vec3f& rangeExtent);
+
+	/// @brief Quantizes a rotation, see @KeyFrameQuantization::dequantizeQuat. The quaternion gets normalized.
+	static void quantizeQuat(uint16 outQ[3], const quatf& q);
+
+	/// @brief Computes the tolerance of each node of the model based on its depth in the hierarchy.
+	static void computeNodesTolerance(std::vector<float>& outTolerances, const Model& model, const Settings& settings);
+
+	/// @brief Compresses the key frames of a single node. Channels that are already compressed are left as they are.
+	/// @return true if any of the channels got modified.
+	static bool compressKeyFrames(KeyFrames& keyFrames, const float tolerance, const Settings& settings);
+
+	/// @brief Compresses all animated nodes of the animation. The @model is used for the hierarchy of the nodes.
+	/// @return true if the animation got modified.
+	static bool compressAnimation(ModelAnimation& animation, const Model& model, const Settings& settings);
+};
+
+} // namespace sge
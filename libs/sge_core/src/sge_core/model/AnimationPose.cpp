@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <cmath>
+
+#include "AnimationPose.h"
+
+namespace sge {
+
+//----------------------------------------------------------
+// AnimationPose
+//----------------------------------------------------------
+void AnimationPose::resize(const int numNodes) {
+	positions.resize(numNodes);
+	rotations.resize(numNodes);
+	scalings.resize(numNodes);
+}
+
+void AnimationPose::toMatrices(mat4f* const outMatrices) const {
+	const int numNodes = getNumNodes();
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		outMatrices[iNode] = getNode(iNode).toMatrix();
+	}
+}
+
+//----------------------------------------------------------
+// AnimationPoseBlender
+//----------------------------------------------------------
+void AnimationPoseBlender::begin(const int numNodes) {
+	m_accumulated.resize(numNodes);
+	m_totalWeights.assign(numNodes, 0.f);
+
+	std::fill(m_accumulated.positions.begin(), m_accumulated.positions.end(), vec3f(0.f));
+	std::fill(m_accumulated.rotations.begin(), m_accumulated.rotations.end(), quatf(0.f, 0.f, 0.f, 0.f));
+	std::fill(m_accumulated.scalings.begin(), m_accumulated.scalings.end(), vec3f(0.f));
+}
+
+void AnimationPoseBlender::addPose(const AnimationPose& pose, const float weight, const float* const nodeWeights) {
+	const int numNodes = m_accumulated.getNumNodes();
+	sgeAssert(pose.getNumNodes() == numNodes);
+
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		const float w = nodeWeights ? weight * nodeWeights[iNode] : weight;
+		if (w <= 0.f) {
+			continue;
+		}
+
+		m_accumulated.positions[iNode] += pose.positions[iNode] * w;
+		m_accumulated.scalings[iNode] += pose.scalings[iNode] * w;
+
+		// q and -q are the same rotation, pick the one in the hemisphere of the already accumulated rotations,
+		// so the blend takes the shortest path.
+		const quatf& q = pose.rotations[iNode];
+		quatf& accumulatedRotation = m_accumulated.rotations[iNode];
+		accumulatedRotation += (accumulatedRotation.dot(q) < 0.f) ? q * -w : q * w;
+
+		m_totalWeights[iNode] += w;
+	}
+}
+
+void AnimationPoseBlender::finish(AnimationPose& outPose, const AnimationPose& fallbackPose) const {
+	const int numNodes = m_accumulated.getNumNodes();
+	sgeAssert(fallbackPose.getNumNodes() == numNodes);
+	outPose.resize(numNodes);
+
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		const float totalWeight = m_totalWeights[iNode];
+		const float rotationLengthSqr = m_accumulated.rotations[iNode].lengthSqr();
+		if (totalWeight <= 0.f || rotationLengthSqr <= 1e-12f) {
+			outPose.positions[iNode] = fallbackPose.positions[iNode];
+			outPose.rotations[iNode] = fallbackPose.rotations[iNode];
+			outPose.scalings[iNode] = fallbackPose.scalings[iNode];
+			continue;
+		}
+
+		const float invTotalWeight = 1.f / totalWeight;
+		outPose.positions[iNode] = m_accumulated.positions[iNode] * invTotalWeight;
+		outPose.scalings[iNode] = m_accumulated.scalings[iNode] * invTotalWeight;
+		outPose.rotations[iNode] = m_accumulated.rotations[iNode] / sqrtf(rotationLengthSqr);
+	}
+}
+
+void AnimationPoseBlender::applyAdditive(AnimationPose& pose,
+                                         const AnimationPose& additivePose,
+                                         const AnimationPose& referencePose,
+                                         const float weight,
+                                         const float* const nodeWeights) {
+	const int numNodes = pose.getNumNodes();
+	sgeAssert(additivePose.getNumNodes() == numNodes && referencePose.getNumNodes() == numNodes);
+
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		const float w = nodeWeights ? weight * nodeWeights[iNode] : weight;
+		if (w <= 0.f) {
+			continue;
+		}
+
+		pose.positions[iNode] += (additivePose.positions[iNode] - referencePose.positions[iNode]) * w;
+
+		// The scaling difference is a ratio, zero reference scaling cannot be inverted so it is ignored.
+		const vec3f& refScaling = referencePose.scalings[iNode];
+		const vec3f& addScaling = additivePose.scalings[iNode];
+		for (int t = 0; t < 3; ++t) {
+			if (refScaling[t] != 0.f) {
+				pose.scalings[iNode][t] *= 1.f + (addScaling[t] / refScaling[t] - 1.f) * w;
+			}
+		}
+
+		// The rotation difference, applied in the local space of the node.
+		quatf deltaRotation = referencePose.rotations[iNode].inverse() * additivePose.rotations[iNode];
+		if (deltaRotation.w < 0.f) {
+			deltaRotation = -deltaRotation;
+		}
+		deltaRotation = nlerp(quatf::getIdentity(), deltaRotation, w);
+		pose.rotations[iNode] = (pose.rotations[iNode] * deltaRotation).normalized();
+	}
+}
+
+void AnimationPoseBlender::interpolate(AnimationPose& outPose, const AnimationPose& a, const AnimationPose& b, const float t) {
+	const int numNodes = a.getNumNodes();
+	sgeAssert(b.getNumNodes() == numNodes);
+	outPose.resize(numNodes);
+
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		outPose.positions[iNode] = lerp(a.positions[iNode], b.positions[iNode], t);
+		outPose.scalings[iNode] = lerp(a.scalings[iNode], b.scalings[iNode], t);
+
+		// Take the shortest path, see @addPose.
+		const quatf& qa = a.rotations[iNode];
+		const quatf& qb = b.rotations[iNode];
+		const quatf rotation = qa * (1.f - t) + ((qa.dot(qb) < 0.f) ? qb * -t : qb * t);
+		const float rotationLengthSqr = rotation.lengthSqr();
+		outPose.rotations[iNode] = rotationLengthSqr > 1e-12f ? rotation / sqrtf(rotationLengthSqr) : qb;
+	}
+}
+
+} // namespace sge
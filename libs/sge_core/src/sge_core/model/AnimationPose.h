@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/math/mat4.h"
+#include "sge_utils/math/quat.h"
+#include "sge_utils/math/transform.h"
+
+namespace sge {
+
+/// @brief The local transforms (relative to the parent) of all nodes of a model, stored as separate arrays
+/// for the positions, rotations and scalings, indexed by node.
+struct SGE_CORE_API AnimationPose {
+	void resize(const int numNodes);
+	int getNumNodes() const { return int(positions.size()); }
+
+	void setNode(const int iNode, const transf3d& transform) {
+		positions[iNode] = transform.p;
+		rotations[iNode] = transform.r;
+		scalings[iNode] = transform.s;
+	}
+
+	transf3d getNode(const int iNode) const { return transf3d(positions[iNode], rotations[iNode], scalings[iNode]); }
+
+	/// @brief Converts the transform of each node to a matrix.
+	/// @param [out] outMatrices an array with @getNumNodes elements.
+	void toMatrices(mat4f* const outMatrices) const;
+
+  public:
+	std::vector<vec3f> positions;
+	std::vector<quatf> rotations;
+	std::vector<vec3f> scalings;
+};
+
+/// @brief Blends multiple poses in a single one.
+/// The positions and scalings are blended linearly. The rotations are blended with normalized quaternion lerp
+/// taking the shortest path, this keeps the rotations rigid, unlike blending the transforms as matrices which shears and shrinks them.
+/// Usage:
+///     blender.begin(numNodes);
+///     blender.addPose(walk, 0.3f);
+///     blender.addPose(run, 0.7f);
+///     blender.finish(outPose, bindPose);
+///     AnimationPoseBlender::applyAdditive(outPose, breathing, breathingReference, 1.f);
+struct SGE_CORE_API AnimationPoseBlender {
+	/// @brief Starts a new blend of poses with the specified number of nodes.
+	void begin(const int numNodes);
+
+	/// @brief Adds a pose to the blend.
+	/// @param [in] nodeWeights optional weight for each node, multiplied with @weight. Used for masking parts of the pose,
+	///                         for example the upper body. If nullptr all nodes use @weight.
+	void addPose(const AnimationPose& pose, const float weight, const float* const nodeWeights = nullptr);
+
+	/// @brief Computes the blended pose. The weights are normalized, so they don't need to sum up to 1.
+	/// @param [in] fallbackPose used for the nodes that have no weight in the blend.
+	void finish(AnimationPose& outPose, const AnimationPose& fallbackPose) const;
+
+	/// @brief Applies an additive layer to @pose. The difference between @additivePose and @referencePose
+	/// (what the additive animation was authored relative to) is scaled by the weight and added to @pose.
+	static void applyAdditive(AnimationPose& pose,
+	                          const AnimationPose& additivePose,
+	                          const AnimationPose& referencePose,
+	                          const float weight,
+	                          const float* const nodeWeights = nullptr);
+
+	/// @brief Interpolates two poses, like blending them with weights 1-@t and @t but without normalizing the weights.
+	static void interpolate(AnimationPose& outPose, const AnimationPose& a, const AnimationPose& b, const float t);
+
+  private:
+	AnimationPose m_accumulated;
+	std::vector<float> m_totalWeights;
+};
+
+} // namespace sge
@@ -0,0 +1,85 @@
+#include "AnimationRetarget.h"
+#include "Model.h"
+
+namespace sge {
+
+AnimationRetargetCache& AnimationRetargetCache::getGlobal() {
+	static AnimationRetargetCache globalCache;
+	return globalCache;
+}
+
+std::shared_ptr<const AnimationDonorRemap> AnimationRetargetCache::getRemap(const Model& model, const Model& donor) {
+	// Models without a name lookup cannot be identified, their remaps don't get cached.
+	if (model.isNodesNameLookupComputed() == false || donor.isNodesNameLookupComputed() == false) {
+		std::shared_ptr<AnimationDonorRemap> remap = std::make_shared<AnimationDonorRemap>();
+		computeRemap(*remap, model, donor);
+		return remap;
+	}
+
+	const std::pair<uint32, uint32> key(model.getNodesNameLookupId(), donor.getNodesNameLookupId());
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	const auto itr = m_entries.find(key);
+	if (itr != m_entries.end()) {
+		std::shared_ptr<const AnimationDonorRemap> existingRemap = itr->second.lock();
+		if (existingRemap != nullptr) {
+			return existingRemap;
+		}
+	}
+
+	std::shared_ptr<AnimationDonorRemap> newRemap = std::make_shared<AnimationDonorRemap>();
+	computeRemap(*newRemap, model, donor);
+
+	removeExpiredEntries();
+	m_entries[key] = newRemap;
+
+	return newRemap;
+}
+
+void AnimationRetargetCache::computeRemap(AnimationDonorRemap& outRemap, const Model& model, const Model& donor) {
+	const int numNodes = model.numNodes();
+
+	outRemap.nodeToDonorNode.assign(numNodes, -1);
+	outRemap.translationOffsets.assign(numNodes, vec3f(0.f));
+	outRemap.targetLookupId = model.getNodesNameLookupId();
+	outRemap.donorLookupId = donor.getNodesNameLookupId();
+
+	// Keep in mind that some nodes might not be present in the donor, in that case -1 is written for them.
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		const ModelNode* const node = model.nodeAt(iNode);
+		const int iDonorNode = donor.findFistNodeIndexWithName(node->name);
+		outRemap.nodeToDonorNode[iNode] = iDonorNode;
+
+		if (iDonorNode >= 0) {
+			outRemap.translationOffsets[iNode] = node->staticLocalTransform.p - donor.nodeAt(iDonorNode)->staticLocalTransform.p;
+		}
+	}
+}
+
+void AnimationRetargetCache::clear() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_entries.clear();
+}
+
+int AnimationRetargetCache::getNumAliveEntries() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	int numAlive = 0;
+	for (const auto& itr : m_entries) {
+		numAlive += itr.second.expired() ? 0 : 1;
+	}
+	return numAlive;
+}
+
+void AnimationRetargetCache::removeExpiredEntries() {
+	for (auto itr = m_entries.begin(); itr != m_entries.end();) {
+		if (itr->second.expired()) {
+			itr = m_entries.erase(itr);
+		} else {
+			++itr;
+		}
+	}
+}
+
+} // namespace sge
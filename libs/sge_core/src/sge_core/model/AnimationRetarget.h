@@ -0,0 +1,60 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/math/vec3.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+struct Model;
+
+/// @brief Describes how the nodes of a model are driven by the nodes of an animation donor model.
+struct AnimationDonorRemap {
+	/// For each node of the target model the index of the node with the same name in the donor, -1 if there is none.
+	std::vector<int> nodeToDonorNode;
+
+	/// For each node of the target model the difference between its static translation and the static translation of
+	/// the donor node. Added to the animated translation so skeletons with different proportions keep their own bone lengths.
+	/// Zero for nodes without a donor node.
+	std::vector<vec3f> translationOffsets;
+
+	/// The name lookup ids of the models at the time the remap was computed, see @Model::getNodesNameLookupId.
+	uint32 targetLookupId = 0;
+	uint32 donorLookupId = 0;
+};
+
+/// @brief A cache of the donor to target node remaps, keyed by the pair of (target model, donor model).
+/// Many instances of the same character usually share the same donors, so the remap gets computed once and
+/// every @EvaluatedModel just keeps a reference to it.
+/// The models are identified by their name lookup ids, reloading a model computes a new id so the old remaps aren't used.
+/// Entries that are no longer referenced by any evaluated model are removed when new entries get created.
+/// The cache is thread safe.
+struct SGE_CORE_API AnimationRetargetCache {
+	static AnimationRetargetCache& getGlobal();
+
+	/// @brief Returns the remap between the specified models, computing it if needed.
+	std::shared_ptr<const AnimationDonorRemap> getRemap(const Model& model, const Model& donor);
+
+	/// @brief Computes the remap without looking it up in any cache.
+	static void computeRemap(AnimationDonorRemap& outRemap, const Model& model, const Model& donor);
+
+	/// Removes all entries. The remaps already returned stay valid.
+	void clear();
+
+	/// Returns the number of entries that are still used.
+	int getNumAliveEntries() const;
+
+  private:
+	void removeExpiredEntries();
+
+  private:
+	mutable std::mutex m_mutex;
+	std::map<std::pair<uint32, uint32>, std::weak_ptr<const AnimationDonorRemap>> m_entries;
+};
+
+} // namespace sge
@@ -0,0 +1,404 @@
+#include <algorithm>
+#include <cstring>
+
+#include "CpuSkinning.h"
+#include "MeshQuantizer.h"
+#include "Model.h"
+#include "sge_utils/math/mat4_simd.h"
+
+namespace sge {
+
+namespace {
+
+/// The number of vertices decoded and skinned together.
+const int kBatchSize = 8;
+
+/// Where and in what format are the attributes needed for skinning stored in the vertex buffer of a mesh.
+struct SkinningLayout {
+	const char* vertices = nullptr;
+	int numVertices = 0;
+	int stride = 0;
+	int numBones = 0;
+
+	int positionOffset = -1;
+	UniformType::Enum positionFormat = UniformType::Unknown;
+	int normalOffset = -1;
+	UniformType::Enum normalFormat = UniformType::Unknown;
+	int tangentOffset = -1;
+	UniformType::Enum tangentFormat = UniformType::Unknown;
+	int binormalOffset = -1;
+	UniformType::Enum binormalFormat = UniformType::Unknown;
+	int bonesIdsOffset = -1;
+	int bonesWeightsOffset = -1;
+
+	VertexDequantization dequantization;
+};
+
+const VertexDecl* findVertexDecl(const ModelMesh& mesh, const char* const semantic) {
+	for (const VertexDecl& decl : mesh.vertexDecl) {
+		if (decl.semantic == semantic) {
+			return &decl;
+		}
+	}
+	return nullptr;
+}
+
+/// Directions (normals, tangents and binormals) are stored either as Float3 or octahedral encoded (see @MeshQuantizer).
+bool isDirectionFormatSupported(const VertexDecl* const decl) {
+	return decl != nullptr && (decl->format == UniformType::Float3 || decl->format == UniformType::Short2_Snorm_IA);
+}
+
+vec3f decodeDirection(const char* const vertex, const int offset, const UniformType::Enum format) {
+	if (format == UniformType::Float3) {
+		vec3f result;
+		memcpy(result.data, vertex + offset, sizeof(vec3f));
+		return result;
+	}
+
+	sint16 q[2];
+	memcpy(q, vertex + offset, sizeof(q));
+	return MeshQuantizer::octahedralDecode(vec2f(MeshQuantizer::dequantizeSnorm16(q[0]), MeshQuantizer::dequantizeSnorm16(q[1])));
+}
+
+void encodeDirection(char* const vertex, const int offset, const UniformType::Enum format, const vec3f& direction) {
+	if (format == UniformType::Float3) {
+		memcpy(vertex + offset, direction.data, sizeof(vec3f));
+	} else {
+		const vec2f e = MeshQuantizer::octahedralEncode(direction);
+		const sint16 q[2] = {MeshQuantizer::quantizeSnorm16(e.x), MeshQuantizer::quantizeSnorm16(e.y)};
+		memcpy(vertex + offset, q, sizeof(q));
+	}
+}
+
+bool getSkinningLayout(SkinningLayout& layout, const ModelMesh& mesh) {
+	layout = SkinningLayout();
+
+	if (mesh.bones.empty() || mesh.numVertices <= 0 || mesh.stride <= 0 || mesh.vbByteOffset < 0 ||
+	    mesh.vertexBufferRaw.size() < size_t(mesh.vbByteOffset) + size_t(mesh.numVertices) * size_t(mesh.stride)) {
+		return false;
+	}
+
+	const VertexDecl* const position = findVertexDecl(mesh, "a_position");
+	const VertexDecl* const normal = findVertexDecl(mesh, "a_normal");
+	const VertexDecl* const tangent = findVertexDecl(mesh, "a_tangent");
+	const VertexDecl* const binormal = findVertexDecl(mesh, "a_binormal");
+	const VertexDecl* const bonesIds = findVertexDecl(mesh, "a_bonesIds");
+	const VertexDecl* const bonesWeights = findVertexDecl(mesh, "a_bonesWeights");
+
+	if (position == nullptr || bonesIds == nullptr || bonesWeights == nullptr) {
+		return false;
+	}
+
+	const bool isPositionFormatSupported = position->format == UniformType::Float3 ||
+	                                       (position->format == UniformType::Ushort4_Unorm_IA && mesh.dequantization.hasQuantizedPositions);
+	if (isPositionFormatSupported == false || bonesIds->format != UniformType::Int4 || bonesWeights->format != UniformType::Float4) {
+		return false;
+	}
+
+	layout.vertices = mesh.vertexBufferRaw.data() + mesh.vbByteOffset;
+	layout.numVertices = mesh.numVertices;
+	layout.stride = mesh.stride;
+	layout.numBones = int(mesh.bones.size());
+	layout.positionOffset = position->byteOffset;
+	layout.positionFormat = position->format;
+	layout.bonesIdsOffset = bonesIds->byteOffset;
+	layout.bonesWeightsOffset = bonesWeights->byteOffset;
+	layout.dequantization = mesh.dequantization;
+
+	// Directions in unknown formats are just not skinned.
+	if (isDirectionFormatSupported(normal)) {
+		layout.normalOffset = normal->byteOffset;
+		layout.normalFormat = normal->format;
+	}
+
+	if (isDirectionFormatSupported(tangent)) {
+		layout.tangentOffset = tangent->byteOffset;
+		layout.tangentFormat = tangent->format;
+	}
+
+	if (isDirectionFormatSupported(binormal)) {
+		layout.binormalOffset = binormal->byteOffset;
+		layout.binormalFormat = binormal->format;
+	}
+
+	return true;
+}
+
+/// The decoded attributes of up to @kBatchSize vertices.
+struct VertexBatch {
+	int numVertices = 0;
+	vec3f positions[kBatchSize];
+	vec3f normals[kBatchSize];
+	vec3f tangents[kBatchSize];
+	vec3f binormals[kBatchSize];
+	int bonesIds[kBatchSize][4];
+	float bonesWeights[kBatchSize][4];
+};
+
+void decodeBatch(
+    VertexBatch& batch, const SkinningLayout& layout, const int firstVertex, const bool needNormals, const bool needTangentSpace) {
+	batch.numVertices = std::min(kBatchSize, layout.numVertices - firstVertex);
+
+	for (int iVertex = 0; iVertex < batch.numVertices; ++iVertex) {
+		const char* const vertex = layout.vertices + size_t(firstVertex + iVertex) * size_t(layout.stride);
+
+		if (layout.positionFormat == UniformType::Float3) {
+			memcpy(batch.positions[iVertex].data, vertex + layout.positionOffset, sizeof(vec3f));
+		} else {
+			uint16 q[3];
+			memcpy(q, vertex + layout.positionOffset, sizeof(q));
+			const vec3f unorm(MeshQuantizer::dequantizeUnorm16(q[0]), MeshQuantizer::dequantizeUnorm16(q[1]),
+			                  MeshQuantizer::dequantizeUnorm16(q[2]));
+			batch.positions[iVertex] = unorm * layout.dequantization.positionScale + layout.dequantization.positionOffset;
+		}
+
+		if (needNormals && layout.normalOffset >= 0) {
+			batch.normals[iVertex] = decodeDirection(vertex, layout.normalOffset, layout.normalFormat);
+		}
+
+		if (needTangentSpace && layout.tangentOffset >= 0) {
+			batch.tangents[iVertex] = decodeDirection(vertex, layout.tangentOffset, layout.tangentFormat);
+		}
+
+		if (needTangentSpace && layout.binormalOffset >= 0) {
+			batch.binormals[iVertex] = decodeDirection(vertex, layout.binormalOffset, layout.binormalFormat);
+		}
+
+		memcpy(batch.bonesIds[iVertex], vertex + layout.bonesIdsOffset, sizeof(int) * 4);
+		memcpy(batch.bonesWeights[iVertex], vertex + layout.bonesWeightsOffset, sizeof(float) * 4);
+
+		// Influences with no weight or with invalid bones are ignored.
+		for (int iInfluence = 0; iInfluence < 4; ++iInfluence) {
+			const int boneId = batch.bonesIds[iVertex][iInfluence];
+			if (boneId < 0 || boneId >= layout.numBones) {
+				batch.bonesIds[iVertex][iInfluence] = 0;
+				batch.bonesWeights[iVertex][iInfluence] = 0.f;
+			}
+		}
+	}
+}
+
+/// Skins the batch by blending the bone matrices. The weighted sum of the matrices and the transformation
+/// of the vertex are done with 4-wide SIMD instructions (one matrix column per register) when available.
+/// The normals, tangents and binormals are transformed with the same blended matrix, any of them could be nullptr.
+void skinBatchLinear(vec3f* const outPositions,
+                     vec3f* const outNormals,
+                     vec3f* const outTangents,
+                     vec3f* const outBinormals,
+                     const VertexBatch& batch,
+                     const mat4f* const bones) {
+	for (int iVertex = 0; iVertex < batch.numVertices; ++iVertex) {
+		const vec3f& p = batch.positions[iVertex];
+
+#if defined(SGE_SIMD_SSE)
+		__m128 c0 = _mm_setzero_ps();
+		__m128 c1 = _mm_setzero_ps();
+		__m128 c2 = _mm_setzero_ps();
+		__m128 c3 = _mm_setzero_ps();
+		for (int iInfluence = 0; iInfluence < 4; ++iInfluence) {
+			const float weight = batch.bonesWeights[iVertex][iInfluence];
+			if (weight != 0.f) {
+				const mat4f& bone = bones[batch.bonesIds[iVertex][iInfluence]];
+				const __m128 w = _mm_set1_ps(weight);
+				c0 = _mm_add_ps(c0, _mm_mul_ps(_mm_loadu_ps(bone.data[0].data), w));
+				c1 = _mm_add_ps(c1, _mm_mul_ps(_mm_loadu_ps(bone.data[1].data), w));
+				c2 = _mm_add_ps(c2, _mm_mul_ps(_mm_loadu_ps(bone.data[2].data), w));
+				c3 = _mm_add_ps(c3, _mm_mul_ps(_mm_loadu_ps(bone.data[3].data), w));
+			}
+		}
+
+		float result[4];
+		__m128 r = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(p.x)), _mm_mul_ps(c1, _mm_set1_ps(p.y)));
+		r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(p.z)));
+		r = _mm_add_ps(r, c3);
+		_mm_storeu_ps(result, r);
+		outPositions[iVertex] = vec3f(result[0], result[1], result[2]);
+
+		const auto transformDirection = [&](const vec3f& d) -> vec3f {
+			__m128 rd = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(d.x)), _mm_mul_ps(c1, _mm_set1_ps(d.y)));
+			rd = _mm_add_ps(rd, _mm_mul_ps(c2, _mm_set1_ps(d.z)));
+			_mm_storeu_ps(result, rd);
+			return vec3f(result[0], result[1], result[2]).normalized0();
+		};
+#elif defined(SGE_SIMD_NEON)
+		float32x4_t c0 = vdupq_n_f32(0.f);
+		float32x4_t c1 = vdupq_n_f32(0.f);
+		float32x4_t c2 = vdupq_n_f32(0.f);
+		float32x4_t c3 = vdupq_n_f32(0.f);
+		for (int iInfluence = 0; iInfluence < 4; ++iInfluence) {
+			const float weight = batch.bonesWeights[iVertex][iInfluence];
+			if (weight != 0.f) {
+				const mat4f& bone = bones[batch.bonesIds[iVertex][iInfluence]];
+				c0 = vaddq_f32(c0, vmulq_n_f32(vld1q_f32(bone.data[0].data), weight));
+				c1 = vaddq_f32(c1, vmulq_n_f32(vld1q_f32(bone.data[1].data), weight));
+				c2 = vaddq_f32(c2, vmulq_n_f32(vld1q_f32(bone.data[2].data), weight));
+				c3 = vaddq_f32(c3, vmulq_n_f32(vld1q_f32(bone.data[3].data), weight));
+			}
+		}
+
+		float result[4];
+		float32x4_t r = vaddq_f32(vmulq_n_f32(c0, p.x), vmulq_n_f32(c1, p.y));
+		r = vaddq_f32(r, vmulq_n_f32(c2, p.z));
+		r = vaddq_f32(r, c3);
+		vst1q_f32(result, r);
+		outPositions[iVertex] = vec3f(result[0], result[1], result[2]);
+
+		const auto transformDirection = [&](const vec3f& d) -> vec3f {
+			float32x4_t rd = vaddq_f32(vmulq_n_f32(c0, d.x), vmulq_n_f32(c1, d.y));
+			rd = vaddq_f32(rd, vmulq_n_f32(c2, d.z));
+			vst1q_f32(result, rd);
+			return vec3f(result[0], result[1], result[2]).normalized0();
+		};
+#else
+		vec4f c0(0.f), c1(0.f), c2(0.f), c3(0.f);
+		for (int iInfluence = 0; iInfluence < 4; ++iInfluence) {
+			const float weight = batch.bonesWeights[iVertex][iInfluence];
+			if (weight != 0.f) {
+				const mat4f& bone = bones[batch.bonesIds[iVertex][iInfluence]];
+				c0 += bone.data[0] * weight;
+				c1 += bone.data[1] * weight;
+				c2 += bone.data[2] * weight;
+				c3 += bone.data[3] * weight;
+			}
+		}
+
+		outPositions[iVertex] = (c0 * p.x + c1 * p.y + c2 * p.z + c3).xyz();
+		const auto transformDirection = [&](const vec3f& d) -> vec3f { return (c0 * d.x + c1 * d.y + c2 * d.z).xyz().normalized0(); };
+#endif
+
+		if (outNormals) {
+			outNormals[iVertex] = transformDirection(batch.normals[iVertex]);
+		}
+		if (outTangents) {
+			outTangents[iVertex] = transformDirection(batch.tangents[iVertex]);
+		}
+		if (outBinormals) {
+			outBinormals[iVertex] = transformDirection(batch.binormals[iVertex]);
+		}
+	}
+}
+
+/// Skins the batch by blending the bone dual quaternions, see @dualquatf.
+void skinBatchDualQuaternions(vec3f* const outPositions, vec3f* const outNormals, const VertexBatch& batch, const dualquatf* const bones) {
+	for (int iVertex = 0; iVertex < batch.numVertices; ++iVertex) {
+		dualquatf blended(quatf(0.f, 0.f, 0.f, 0.f), quatf(0.f, 0.f, 0.f, 0.f));
+		const dualquatf* pivot = nullptr;
+		for (int iInfluence = 0; iInfluence < 4; ++iInfluence) {
+			const float weight = batch.bonesWeights[iVertex][iInfluence];
+			if (weight != 0.f) {
+				const dualquatf& bone = bones[batch.bonesIds[iVertex][iInfluence]];
+				// q and -q represent the same rotation, blend the ones in the same hemisphere to take the shortest path.
+				if (pivot == nullptr) {
+					pivot = &bone;
+				}
+				blended = blended + bone * (pivot->real.dot(bone.real) < 0.f ? -weight : weight);
+			}
+		}
+
+		blended = blended.normalized();
+		outPositions[iVertex] = blended.transformPoint(batch.positions[iVertex]);
+		if (outNormals) {
+			outNormals[iVertex] = blended.transformDirection(batch.normals[iVertex]).normalized0();
+		}
+	}
+}
+
+} // namespace
+
+bool CpuSkinning::canSkinMesh(const ModelMesh& mesh) {
+	SkinningLayout layout;
+	return getSkinningLayout(layout, mesh);
+}
+
+bool CpuSkinning::canSkinVertexBuffer(const ModelMesh& mesh) {
+	SkinningLayout layout;
+	return getSkinningLayout(layout, mesh) && layout.positionFormat == UniformType::Float3;
+}
+
+bool CpuSkinning::skinMesh(vec3f* outPositions, vec3f* outNormals, const ModelMesh& mesh, const mat4f* const bonesTransforms) {
+	SkinningLayout layout;
+	if (outPositions == nullptr || bonesTransforms == nullptr || getSkinningLayout(layout, mesh) == false) {
+		return false;
+	}
+
+	const bool needNormals = outNormals != nullptr && layout.normalOffset >= 0;
+
+	VertexBatch batch;
+	for (int firstVertex = 0; firstVertex < layout.numVertices; firstVertex += kBatchSize) {
+		decodeBatch(batch, layout, firstVertex, needNormals, false);
+		skinBatchLinear(outPositions + firstVertex, needNormals ? outNormals + firstVertex : nullptr, nullptr, nullptr, batch, bonesTransforms);
+	}
+
+	return true;
+}
+
+bool CpuSkinning::skinMeshDualQuaternions(vec3f* outPositions,
+                                          vec3f* outNormals,
+                                          const ModelMesh& mesh,
+                                          const dualquatf* const bonesTransforms) {
+	SkinningLayout layout;
+	if (outPositions == nullptr || bonesTransforms == nullptr || getSkinningLayout(layout, mesh) == false) {
+		return false;
+	}
+
+	const bool needNormals = outNormals != nullptr && layout.normalOffset >= 0;
+
+	VertexBatch batch;
+	for (int firstVertex = 0; firstVertex < layout.numVertices; firstVertex += kBatchSize) {
+		decodeBatch(batch, layout, firstVertex, needNormals, false);
+		skinBatchDualQuaternions(outPositions + firstVertex, needNormals ? outNormals + firstVertex : nullptr, batch, bonesTransforms);
+	}
+
+	return true;
+}
+
+bool CpuSkinning::skinVertexBuffer(std::vector<char>& outVertices, const ModelMesh& mesh, const mat4f* const bonesTransforms) {
+	SkinningLayout layout;
+	if (bonesTransforms == nullptr || getSkinningLayout(layout, mesh) == false || layout.positionFormat != UniformType::Float3) {
+		return false;
+	}
+
+	const size_t stride = size_t(layout.stride);
+	outVertices.resize(size_t(layout.numVertices) * stride);
+	memcpy(outVertices.data(), layout.vertices, outVertices.size());
+
+	const bool needNormals = layout.normalOffset >= 0;
+	const bool needTangents = layout.tangentOffset >= 0;
+	const bool needBinormals = layout.binormalOffset >= 0;
+
+	VertexBatch batch;
+	vec3f positions[kBatchSize];
+	vec3f normals[kBatchSize];
+	vec3f tangents[kBatchSize];
+	vec3f binormals[kBatchSize];
+	for (int firstVertex = 0; firstVertex < layout.numVertices; firstVertex += kBatchSize) {
+		decodeBatch(batch, layout, firstVertex, needNormals, needTangents || needBinormals);
+		skinBatchLinear(positions, needNormals ? normals : nullptr, needTangents ? tangents : nullptr, needBinormals ? binormals : nullptr,
+		                batch, bonesTransforms);
+
+		for (int iVertex = 0; iVertex < batch.numVertices; ++iVertex) {
+			char* const vertex = outVertices.data() + size_t(firstVertex + iVertex) * stride;
+			memcpy(vertex + layout.positionOffset, positions[iVertex].data, sizeof(vec3f));
+
+			if (needNormals) {
+				encodeDirection(vertex, layout.normalOffset, layout.normalFormat, normals[iVertex]);
+			}
+			if (needTangents) {
+				encodeDirection(vertex, layout.tangentOffset, layout.tangentFormat, tangents[iVertex]);
+			}
+			if (needBinormals) {
+				encodeDirection(vertex, layout.binormalOffset, layout.binormalFormat, binormals[iVertex]);
+			}
+		}
+	}
+
+	return true;
+}
+
+void CpuSkinning::convertToDualQuaternions(dualquatf* const outDualQuats, const mat4f* const matrices, const int numMatrices) {
+	for (int t = 0; t < numMatrices; ++t) {
+		outDualQuats[t] = dualquatf::fromMatrix(matrices[t]);
+	}
+}
+
+} // namespace sge
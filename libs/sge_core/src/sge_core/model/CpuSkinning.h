@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/math/dualquat.h"
+#include "sge_utils/math/mat4.h"
+#include "sge_utils/math/vec3.h"
+
+namespace sge {
+
+struct ModelMesh;
+
+/// @brief Deforms the vertices of skinned meshes on the CPU, the same way the vertex shaders do it with the bones texture.
+/// Useful for targets where fetching the bones texture in the vertex shader is slow, and for picking or collision
+/// against the deformed mesh.
+/// Every vertex is affected by up to 4 bones (the "a_bonesIds" and "a_bonesWeights" attributes). The vertices are
+/// processed in batches of 8: the attributes of the batch are decoded first and then the whole batch gets skinned.
+/// The bone transforms are the ones computed by @EvaluatedModel::computeSkinningPalette for the mesh.
+struct SGE_CORE_API CpuSkinning {
+	/// Returns true if the mesh has bones, positions, bone ids and weights in a format that could be skinned.
+	/// Quantized positions and octahedral normals (see @MeshQuantizer) are supported.
+	static bool canSkinMesh(const ModelMesh& mesh);
+
+	/// Returns true if @skinVertexBuffer could be used with that mesh. The positions must not be quantized, as
+	/// the deformed positions might be outside of the range used for the quantization.
+	static bool canSkinVertexBuffer(const ModelMesh& mesh);
+
+	/// @brief Computes the deformed positions and normals of the mesh by blending the bone matrices (linear blend skinning).
+	/// @param [out] outPositions an array of @ModelMesh::numVertices elements.
+	/// @param [out] outNormals an array of @ModelMesh::numVertices elements, or nullptr if not needed.
+	///              If the mesh has no normals this isn't written.
+	/// @param [in] bonesTransforms the skinning matrices of the bones, indexed like @ModelMesh::bones.
+	static bool skinMesh(vec3f* outPositions, vec3f* outNormals, const ModelMesh& mesh, const mat4f* const bonesTransforms);
+
+	/// @brief Same as @skinMesh but blends dual quaternions instead of matrices, which preserves the volume around
+	/// twisting joints. The scaling of the bones is ignored. See @convertToDualQuaternions.
+	static bool
+	    skinMeshDualQuaternions(vec3f* outPositions, vec3f* outNormals, const ModelMesh& mesh, const dualquatf* const bonesTransforms);
+
+	/// @brief Makes a copy of the vertices of the mesh (in the layout of the mesh) with the positions and normals
+	/// deformed by @skinMesh. The tangents and binormals (if any) are transformed with the same blended matrices as the normals.
+	/// The result could be uploaded to a vertex buffer and drawn without skinning.
+	static bool skinVertexBuffer(std::vector<char>& outVertices, const ModelMesh& mesh, const mat4f* const bonesTransforms);
+
+	/// Converts the skinning matrices to dual quaternions to be used with @skinMeshDualQuaternions.
+	static void convertToDualQuaternions(dualquatf* const outDualQuats, const mat4f* const matrices, const int numMatrices);
+};
+
+} // namespace sge
@@ -1,9 +1,9 @@
-#include <functional>
-
 #include "sge_core/AssetLibrary.h"
+#include "sge_utils/math/mat4_simd.h"
 #include "sge_utils/math/transform.h"
 #include "sge_utils/utils/range_loop.h"
 
+#include "CpuSkinning.h"
 #include "EvaluatedModel.h"
 #include "Model.h"
 
@@ -16,6 +16,19 @@ void EvaluatedModel::initialize(AssetLibrary* const assetLibrary, Model* model)
 	*this = EvaluatedModel();
 	m_assetLibrary = assetLibrary;
 	m_model = model;
+
+	// Models created in code might not have called this.
+	if (m_model->isNodesOrderComputed() == false) {
+		m_model->computeNodesOrder();
+	}
+
+	if (m_model->isNodesImportanceComputed() == false) {
+		m_model->computeNodesImportance();
+	}
+
+	if (m_model->isNodesNameLookupComputed() == false) {
+		m_model->computeNodesNameLookup();
+	}
 }
 
 int EvaluatedModel::addAnimationDonor(const std::shared_ptr<Asset>& donorAsset) {
@@ -31,39 +44,64 @@ int EvaluatedModel::addAnimationDonor(const std::shared_ptr<Asset>& donorAsset)
 
 	AnimationDonor animDonor;
 
-	animDonor.donorModel = donorAsset;
-	animDonor.originalNodeId_to_donorNodeId.resize(m_model->numNodes(), -1);
-
-	// Build the node-to-node remapping, Keep in mind that some nodes might not be present in the donor.
-	// in that case -1 should be written for that node index.
-	for (const int iOrigNode : range_int(m_model->numNodes())) {
-		const std::string& originalNodeName = m_model->nodeAt(iOrigNode)->name;
-		animDonor.originalNodeId_to_donorNodeId[iOrigNode] =
-		    animDonor.donorModel->asModel()->model.findFistNodeIndexWithName(originalNodeName);
+	Model& donorModel = donorAsset->asModel()->model;
+	if (donorModel.isNodesNameLookupComputed() == false) {
+		donorModel.computeNodesNameLookup();
 	}
 
+	animDonor.donorModel = donorAsset;
+	animDonor.remap = AnimationRetargetCache::getGlobal().getRemap(*m_model, donorModel);
+
 	m_donors.emplace_back(std::move(animDonor));
 
 	return int(m_donors.size()) - 1;
 }
 
 bool EvaluatedModel::evaluateFromMoments(const EvalMomentSets evalMoments[], int numMoments) {
-	if (numMoments != 0 && evalMoments != nullptr) {
-		evaluateFromMomentsInternal(evalMoments, numMoments);
-	} else {
-		EvalMomentSets staticMoment;
-		evaluateFromMomentsInternal(&staticMoment, 1);
-	}
+	evaluateNodes(evalMoments, numMoments);
+	computeSkinningPalette();
+	finishEvaluation();
+
+	return true;
+}
+
+void EvaluatedModel::finishEvaluation() {
 	evaluateMaterials();
 	evaluateSkinning();
+}
 
+bool EvaluatedModel::evaluateNodes(const EvalMomentSets evalMoments[], int numMoments, const ubyte* nodesMask) {
+	if (evaluateLocalPose(evalMoments, numMoments, nodesMask) == false) {
+		return false;
+	}
+
+	return evaluateNodesFromPose(m_blendedPose);
+}
+
+bool EvaluatedModel::evaluateLocalPose(const EvalMomentSets evalMoments[], int numMoments, const ubyte* nodesMask) {
+	if (numMoments != 0 && evalMoments != nullptr) {
+		return sampleLocalPoseInternal(evalMoments, numMoments, nodesMask);
+	}
+
+	const EvalMomentSets staticMoment;
+	return sampleLocalPoseInternal(&staticMoment, 1, nodesMask);
+}
+
+bool EvaluatedModel::evaluateNodesFromPose(const AnimationPose& localPose) {
+	if (localPose.getNumNodes() != m_model->numNodes()) {
+		sgeAssert(false && "The pose must have a transform for every node of the model");
+		return false;
+	}
+
+	evaluateNodes_common();
+	evaluateNodesGlobalTransforms(localPose);
 	return true;
 }
 
 bool EvaluatedModel::evaluateFromNodesGlobalTransform(const std::vector<mat4f>& boneGlobalTrasnformOverrides) {
 	evaluateNodesFromExternalBones(boneGlobalTrasnformOverrides);
-	evaluateMaterials();
-	evaluateSkinning();
+	computeSkinningPalette();
+	finishEvaluation();
 	return true;
 }
 
@@ -78,71 +116,131 @@ bool EvaluatedModel::evaluateNodes_common() {
 		// [EVAL_MESH_NODE_DEFAULT_ZERO]
 		evalNode.evalLocalTransform = mat4f::getZero();
 		evalNode.evalGlobalTransform = mat4f::getZero();
+		evalNode.aabbGlobalSpace.setEmpty();
 	}
 
 	return true;
 }
 
-bool EvaluatedModel::evaluateFromMomentsInternal(const EvalMomentSets evalMoments[], int numMoments) {
-	evaluateNodes_common();
+bool EvaluatedModel::sampleLocalPoseInternal(const EvalMomentSets evalMoments[], int numMoments, const ubyte* nodesMask) {
+	const int numNodes = m_model->numNodes();
+	if (m_keyFramesCursors.size() < size_t(numMoments * numNodes)) {
+		m_keyFramesCursors.resize(size_t(numMoments * numNodes));
+	}
 
-	// Evaluates the nodes. They may be effecte by multiple models (stealing animations and blending them)
-	for (int const iMoment : range_int(numMoments)) {
+	// The pose of the model when not animated, used for the nodes that no moment affects.
+	if (m_staticPose.getNumNodes() != numNodes) {
+		m_staticPose.resize(numNodes);
+		for (int iNode = 0; iNode < numNodes; ++iNode) {
+			m_staticPose.setNode(iNode, m_model->nodeAt(iNode)->staticLocalTransform);
+		}
+	}
+
+	// Samples the specified moment for every node of @m_model in @outPose.
+	// If @isReferencePose is true the static pose of the donor nodes is sampled instead of the animation.
+	const auto sampleMoment = [&](AnimationPose& outPose, const int iMoment, const bool isReferencePose) -> bool {
 		const EvalMomentSets& moment = evalMoments[iMoment];
 
 		// Find the animation donor.
-		const AnimationDonor* donor = nullptr;
+		AnimationDonor* donor = nullptr;
 		if (moment.donorIndex >= 0) {
 			if (moment.donorIndex < int(m_donors.size())) {
 				donor = &m_donors[moment.donorIndex];
 			} else {
 				sgeAssert(false && "Animation donor with the specified index could not be found!");
-				continue;
+				return false;
 			}
 		}
 
 		const Model& donorModel = (donor != nullptr) ? donor->donorModel->asModel()->model : *m_model;
-		const ModelAnimation* const donorAnimation = donorModel.animationAt(moment.animationIndex);
+
+		// The donor asset might have been reloaded since the remap was computed.
+		if (donor != nullptr && (donor->remap->donorLookupId != donorModel.getNodesNameLookupId() ||
+		                         donor->remap->nodeToDonorNode.size() != size_t(numNodes))) {
+			donor->remap = AnimationRetargetCache::getGlobal().getRemap(*m_model, donorModel);
+		}
+		const ModelAnimation* const donorAnimation = isReferencePose ? nullptr : donorModel.animationAt(moment.animationIndex);
 
 		const float evalTime = moment.time;
 
-		for (int iOrigNode = 0; iOrigNode < m_model->numNodes(); ++iOrigNode) {
+		outPose.resize(numNodes);
+		for (int iOrigNode = 0; iOrigNode < numNodes; ++iOrigNode) {
 			// Use the node form the specified Model in the node, if such node doesn't exists, fallback to the originalNode.
-			const int donorNodeIndex = (donor != nullptr) ? donor->originalNodeId_to_donorNodeId[iOrigNode] : iOrigNode;
+			const int donorNodeIndex = (donor != nullptr) ? donor->remap->nodeToDonorNode[iOrigNode] : iOrigNode;
 
 			// Find the node that is equvalent to the node in @m_model and evaluate its transform.
 			// If no such node was found use the default transformation from @m_model.
 			transf3d nodeLocalTransform;
-			if (donorNodeIndex >= 0) {
+			if (nodesMask != nullptr && nodesMask[iOrigNode] == 0) {
+				nodeLocalTransform = m_model->nodeAt(iOrigNode)->staticLocalTransform;
+			} else if (donorNodeIndex >= 0) {
 				nodeLocalTransform = donorModel.nodeAt(donorNodeIndex)->staticLocalTransform;
 				if (donorAnimation != nullptr) {
-					donorAnimation->evaluateForNode(nodeLocalTransform, donorNodeIndex, evalTime);
+					KeyFramesCursor& cursor = m_keyFramesCursors[size_t(iMoment * numNodes + iOrigNode)];
+					donorAnimation->evaluateForNode(nodeLocalTransform, donorNodeIndex, evalTime, cursor);
+				}
+
+				// Keep the proportions of @m_model when the donor skeleton is differently sized.
+				if (donor != nullptr) {
+					nodeLocalTransform.p += donor->remap->translationOffsets[iOrigNode];
 				}
 			} else {
 				nodeLocalTransform = m_model->nodeAt(iOrigNode)->staticLocalTransform;
 			}
 
-			// Caution: [EVAL_MESH_NODE_DEFAULT_ZERO]
-			// It is assumed that all transforms in evalNode are initialized to zero!
-			m_evaluatedNodes[iOrigNode].evalLocalTransform += nodeLocalTransform.toMatrix() * moment.weight;
+			outPose.setNode(iOrigNode, nodeLocalTransform);
+		}
+
+		return true;
+	};
+
+	// Evaluates the nodes. They may be effecte by multiple models (stealing animations and blending them).
+	// First all regular moments are blended together, then the additive ones are applied on top.
+	m_poseBlender.begin(numNodes);
+	for (int const iMoment : range_int(numMoments)) {
+		if (evalMoments[iMoment].isAdditive == false && sampleMoment(m_momentPose, iMoment, false)) {
+			m_poseBlender.addPose(m_momentPose, evalMoments[iMoment].weight, evalMoments[iMoment].nodeWeights);
+		}
+	}
+	m_poseBlender.finish(m_blendedPose, m_staticPose);
+
+	for (int const iMoment : range_int(numMoments)) {
+		if (evalMoments[iMoment].isAdditive && sampleMoment(m_momentPose, iMoment, false) &&
+		    sampleMoment(m_referencePose, iMoment, true)) {
+			AnimationPoseBlender::applyAdditive(m_blendedPose, m_momentPose, m_referencePose, evalMoments[iMoment].weight,
+			                                    evalMoments[iMoment].nodeWeights);
 		}
 	}
 
-	// Evaluate the node global transform by traversing the node hierarchy using the local transform computed above.
-	// Evaluate attached meshes to the evaluated nodes.
-	std::function<void(int, mat4f)> traverseGlobalTransform;
-	traverseGlobalTransform = [&](int iNode, const mat4f& parentTransfrom) -> void {
+	return true;
+}
+
+void EvaluatedModel::evaluateNodesGlobalTransforms(const AnimationPose& localPose) {
+	// Compute the global transforms and the bounding boxes of the nodes. The order guarantees that
+	// the parent of each node is already evaluated.
+	for (const int iNode : m_model->getNodesParentFirstOrder()) {
 		EvaluatedNode& evalNode = m_evaluatedNodes[iNode];
-		evalNode.evalGlobalTransform = parentTransfrom * evalNode.evalLocalTransform;
-		evalNode.aabbGlobalSpace = evalNode.aabbGlobalSpace.getTransformed(evalNode.evalGlobalTransform);
+		evalNode.evalLocalTransform = localPose.getNode(iNode).toMatrix();
 
-		for (const int childNodeIndex : m_model->nodeAt(iNode)->childNodes) {
-			traverseGlobalTransform(childNodeIndex, evalNode.evalGlobalTransform);
+		const int parentIndex = m_model->getNodeParentIndex(iNode);
+		if (parentIndex >= 0) {
+			evalNode.evalGlobalTransform = m_evaluatedNodes[parentIndex].evalGlobalTransform * evalNode.evalLocalTransform;
+		} else {
+			evalNode.evalGlobalTransform = evalNode.evalLocalTransform;
 		}
-	};
 
-	traverseGlobalTransform(m_model->getRootNodeIndex(), mat4f::getIdentity());
-	return true;
+		evaluateNodeBoundingBox(iNode);
+	}
+}
+
+void EvaluatedModel::evaluateNodeBoundingBox(const int iNode) {
+	EvaluatedNode& evalNode = m_evaluatedNodes[iNode];
+	evalNode.aabbGlobalSpace.setEmpty();
+	for (const MeshAttachment& att : m_model->nodeAt(iNode)->meshAttachments) {
+		const ModelMesh* const mesh = m_model->meshAt(att.attachedMeshIndex);
+		evalNode.aabbGlobalSpace.expand(mesh->aabox.getTransformed(evalNode.evalGlobalTransform));
+	}
+	aabox.expand(evalNode.aabbGlobalSpace);
 }
 
 bool EvaluatedModel::evaluateNodesFromExternalBones(const std::vector<mat4f>& boneGlobalTrasnformOverrides) {
@@ -157,6 +255,7 @@ bool EvaluatedModel::evaluateNodesFromExternalBones(const std::vector<mat4f>& bo
 		EvaluatedNode& evalNode = m_evaluatedNodes[iNode];
 		// evalNode.evalLocalTransform is not computed as it isn't needed by anything at the moment.
 		evalNode.evalGlobalTransform = boneGlobalTrasnformOverrides[iNode];
+		evaluateNodeBoundingBox(iNode);
 	}
 
 	return true;
@@ -208,38 +307,61 @@ bool EvaluatedModel::evaluateMaterials() {
 	return true;
 }
 
-bool EvaluatedModel::evaluateSkinning() {
-	SGEContext* const context = m_assetLibrary->getDevice()->getContext();
-
-	m_evaluatedMeshes.resize(m_model->numMeshes());
+void EvaluatedModel::computeSkinningPalette() {
 	m_perMeshSkinningBonesTransformOFfsetInTex.resize(m_model->numMeshes(), -1);
-	bonesTransformTexDataForAllMeshes.clear();
+	m_cpuSkinnedVertices.resize(m_model->numMeshes());
 
-	// Evaluate the meshes.
+	// Place the bones of each mesh one after another.
+	int numBonesTotal = 0;
 	for (int iMesh = 0; iMesh < m_model->numMeshes(); ++iMesh) {
 		const ModelMesh& rawMesh = *m_model->meshAt(iMesh);
+		m_perMeshSkinningBonesTransformOFfsetInTex[iMesh] = rawMesh.bones.empty() ? -1 : numBonesTotal;
+		numBonesTotal += int(rawMesh.bones.size());
+	}
 
-		m_perMeshSkinningBonesTransformOFfsetInTex[iMesh] = -1;
-
-		if (rawMesh.bones.empty() == false) {
-			m_perMeshSkinningBonesTransformOFfsetInTex[iMesh] = int(bonesTransformTexDataForAllMeshes.size());
+	bonesTransformTexDataForAllMeshes.resize(numBonesTotal);
 
-			// Compute the tansform of the bone, it combines the binding offset matrix of the bone and
-			// the evaluated position of the node that represents the bone in the scene.
-			std::vector<mat4f> bonesTransformTexData(rawMesh.bones.size());
-			for (int iBone = 0; iBone < rawMesh.bones.size(); ++iBone) {
-				const ModelMeshBone& bone = rawMesh.bones[iBone];
+	for (int iMesh = 0; iMesh < m_model->numMeshes(); ++iMesh) {
+		const ModelMesh& rawMesh = *m_model->meshAt(iMesh);
+		if (rawMesh.bones.empty()) {
+			continue;
+		}
 
-				const mat4f boneTransformWithOffsetModelObjectSpace =
-				    m_evaluatedNodes[bone.nodeIdx].evalGlobalTransform * bone.offsetMatrix;
+		// Compute the tansform of the bone, it combines the binding offset matrix of the bone and
+		// the evaluated position of the node that represents the bone in the scene.
+		mat4f* const meshBones = &bonesTransformTexDataForAllMeshes[m_perMeshSkinningBonesTransformOFfsetInTex[iMesh]];
+		for (int iBone = 0; iBone < int(rawMesh.bones.size()); ++iBone) {
+			const ModelMeshBone& bone = rawMesh.bones[iBone];
+			mat4f_mul_simd(meshBones[iBone], m_evaluatedNodes[bone.nodeIdx].evalGlobalTransform, bone.offsetMatrix);
+		}
 
-				bonesTransformTexDataForAllMeshes.push_back(boneTransformWithOffsetModelObjectSpace);
-			}
+		// Meshes that cannot be skinned on the CPU fallback to the GPU skinning.
+		std::vector<char>& cpuSkinnedVertices = m_cpuSkinnedVertices[iMesh];
+		cpuSkinnedVertices.clear();
+		if (useCpuSkinning && CpuSkinning::canSkinVertexBuffer(rawMesh)) {
+			CpuSkinning::skinVertexBuffer(cpuSkinnedVertices, rawMesh, meshBones);
 		}
 	}
+}
+
+bool EvaluatedModel::evaluateSkinning() {
+	m_evaluatedMeshes.resize(m_model->numMeshes());
+
+	// Without a device (for example in a dedicated server or in tests) only the nodes get evaluated.
+	SGEDevice* const device = m_assetLibrary->getDevice();
+	if (device == nullptr) {
+		return false;
+	}
+	SGEContext* const context = device->getContext();
+
+	// The bones texture is needed only if there are meshes skinned on the GPU.
+	bool needsBonesTexture = false;
+	for (int iMesh = 0; iMesh < m_model->numMeshes(); ++iMesh) {
+		needsBonesTexture |= m_perMeshSkinningBonesTransformOFfsetInTex[iMesh] >= 0 && m_cpuSkinnedVertices[iMesh].empty();
+	}
 
 	// Compute the bones skinning matrix texture for the whole model.
-	if (bonesTransformTexDataForAllMeshes.empty() == false) {
+	if (needsBonesTexture) {
 		int neededTexWidth = 4;
 		int neededTexHeight = int(bonesTransformTexDataForAllMeshes.size());
 
@@ -275,24 +397,45 @@ bool EvaluatedModel::evaluateSkinning() {
 		EvaluatedMesh& evalMesh = m_evaluatedMeshes[iMesh];
 		const ModelMesh& rawMesh = *m_model->meshAt(iMesh);
 
-		const int firstBoneOffset = m_perMeshSkinningBonesTransformOFfsetInTex[iMesh];
-
-		evalMesh.geometry =
-		    Geometry(rawMesh.vertexBuffer.GetPtr(), rawMesh.indexBuffer.GetPtr(), m_skinningBoneTransfsTex.GetPtr(), firstBoneOffset,
-		             rawMesh.vertexDeclIndex, rawMesh.vbVertexColorOffsetBytes >= 0, rawMesh.vbUVOffsetBytes >= 0,
-		             rawMesh.vbNormalOffsetBytes >= 0, rawMesh.hasUsableTangetSpace, rawMesh.primitiveTopology, rawMesh.vbByteOffset,
-		             rawMesh.ibByteOffset, rawMesh.stride, rawMesh.ibFmt, rawMesh.numElements);
-	}
+		// The meshes skinned on the CPU are drawn from their own dynamic vertex buffer with no skinning in the shaders.
+		const std::vector<char>& cpuSkinnedVertices = m_cpuSkinnedVertices[iMesh];
+		const bool isCpuSkinned = cpuSkinnedVertices.empty() == false;
+		if (isCpuSkinned) {
+			Buffer* const existingBuffer = evalMesh.cpuSkinnedVertexBuffer.GetPtr();
+			if (existingBuffer == nullptr || existingBuffer->getDesc().sizeBytes != cpuSkinnedVertices.size()) {
+				evalMesh.cpuSkinnedVertexBuffer = context->getDevice()->requestResource<Buffer>();
+				evalMesh.cpuSkinnedVertexBuffer->create(BufferDesc::GetDefaultVertexBuffer(cpuSkinnedVertices.size(), ResourceUsage::Dynamic),
+				                                        cpuSkinnedVertices.data());
+			} else if (void* const mappedVertices = context->map(existingBuffer, Map::WriteDiscard)) {
+				memcpy(mappedVertices, cpuSkinnedVertices.data(), cpuSkinnedVertices.size());
+				context->unMap(existingBuffer);
+			}
+		} else {
+			evalMesh.cpuSkinnedVertexBuffer.Release();
+		}
 
+		Buffer* const vertexBuffer = isCpuSkinned ? evalMesh.cpuSkinnedVertexBuffer.GetPtr() : rawMesh.vertexBuffer.GetPtr();
+		Texture* const bonesTexture = isCpuSkinned ? nullptr : m_skinningBoneTransfsTex.GetPtr();
+		const int firstBoneOffset = isCpuSkinned ? -1 : m_perMeshSkinningBonesTransformOFfsetInTex[iMesh];
+		const int vbByteOffset = isCpuSkinned ? 0 : rawMesh.vbByteOffset;
+
+		evalMesh.geometry = Geometry(vertexBuffer, rawMesh.indexBuffer.GetPtr(), bonesTexture, firstBoneOffset, rawMesh.vertexDeclIndex,
+		                             rawMesh.vbVertexColorOffsetBytes >= 0, rawMesh.vbUVOffsetBytes >= 0, rawMesh.vbNormalOffsetBytes >= 0,
+		                             rawMesh.hasUsableTangetSpace, rawMesh.primitiveTopology, vbByteOffset, rawMesh.ibByteOffset,
+		                             rawMesh.stride, rawMesh.ibFmt, rawMesh.numElements);
+		evalMesh.geometry.dequantization = rawMesh.dequantization;
+
+		evalMesh.lodGeometries.clear();
+		for (const ModelMeshLod& lod : rawMesh.lods) {
+			if (lod.indexBuffer.HasResource() == false) {
+				break;
+			}
 
-	aabox.setEmpty();
-	for (int iNode = 0; iNode < this->getNumEvalNodes(); ++iNode) {
-		ModelNode* node = m_model->nodeAt(iNode);
-		m_evaluatedNodes[iNode].aabbGlobalSpace.setEmpty();
-		for (const MeshAttachment& att : node->meshAttachments) {
-			ModelMesh* mesh = m_model->meshAt(att.attachedMeshIndex);
-			m_evaluatedNodes[iNode].aabbGlobalSpace.expand(mesh->aabox.getTransformed(m_evaluatedNodes[iNode].evalGlobalTransform));
-			aabox.expand(m_evaluatedNodes[iNode].aabbGlobalSpace);
+			Geometry lodGeometry = evalMesh.geometry;
+			lodGeometry.indexBuffer = lod.indexBuffer.GetPtr();
+			lodGeometry.ibByteOffset = 0;
+			lodGeometry.numElements = lod.numElements;
+			evalMesh.lodGeometries.push_back(lodGeometry);
 		}
 	}
 
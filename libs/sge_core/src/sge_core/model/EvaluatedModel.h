@@ -1,9 +1,12 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 #include "sge_core/Geometry.h"
+#include "sge_core/model/AnimationPose.h"
+#include "sge_core/model/AnimationRetarget.h"
 #include "sge_core/model/Model.h"
 #include "sge_core/sgecore_api.h"
 #include "sge_renderer/renderer/renderer.h"
@@ -37,6 +40,21 @@ struct EvaluatedNode {
 struct EvaluatedMesh {
 	//std::vector<mat4f> boneTransformMatrices;
 	Geometry geometry;
+
+	/// The deformed vertices of the mesh, used only when the mesh is skinned on the CPU. See @EvaluatedModel::useCpuSkinning.
+	GpuHandle<Buffer> cpuSkinnedVertexBuffer;
+
+	/// The geometry of each @ModelMesh::lods, they are the same as @geometry but with lower detail index buffers.
+	std::vector<Geometry> lodGeometries;
+
+	/// Returns the geometry to be used for the specified level of detail, 0 is the full detail mesh.
+	/// If the mesh doesn't have that many LODs the lowest detail one is returned.
+	const Geometry& getGeometryForLod(const int lod) const {
+		if (lod <= 0 || lodGeometries.empty()) {
+			return geometry;
+		}
+		return lodGeometries[std::min(lod, int(lodGeometries.size())) - 1];
+	}
 };
 
 struct EvalMomentSets {
@@ -61,9 +79,18 @@ struct EvalMomentSets {
 	/// during transitions. For example if our character was idle and now it has just started running,
 	/// we want to smoothly blend for a few miliseconds between the idle animation and the run animation.
 	/// If we do not then the animation transition will not be smooth.
-	/// Usually, we want the sum of all weights for all EvalMomentSets passed to EvaluatedModel::evaluateFromMoments
-	/// to be 1, otherwise the whole animation will not look right.
+	/// The weights of the non-additive moments are normalized per node, so they do not need to sum up to 1.
 	float weight = 1.f;
+
+	/// If true the moment is an additive layer. The difference between the animation and the static pose of the donor nodes
+	/// is scaled by @weight and added on top of the blend of all non-additive moments.
+	/// Useful for breathing, aiming or hit reactions over the base locomotion.
+	bool isAdditive = false;
+
+	/// Optional weight for each node of the evaluated model, multiplied with @weight. Used for masking a moment to a part of
+	/// the model, for example playing a wave animation only on the upper body. If nullptr all nodes use @weight.
+	/// The array must stay valid until the evaluation is done.
+	const float* nodeWeights = nullptr;
 };
 
 struct SGE_CORE_API EvaluatedModel {
@@ -92,6 +119,38 @@ struct SGE_CORE_API EvaluatedModel {
 	/// be used.
 	bool evaluateFromNodesGlobalTransform(const std::vector<mat4f>& boneGlobalTrasnformOverrides);
 
+	/// @brief Evaluates only the transforms and the bounding boxes of the nodes, the materials and the skinning are not touched.
+	/// The function does not use the GPU and, after the first evaluation, does not allocate memory.
+	/// Different instances could be evaluated on different threads, even if they share the same model or animation donors.
+	/// The parameters are the same as in @evaluateFromMoments.
+	/// @param nodesMask optional array with a value for each node of the model. The nodes with 0 are not sampled and use
+	/// their static local transform, used to skip the less important nodes of distant models (see @AnimationLodState).
+	bool evaluateNodes(const EvalMomentSets evalMoments[], int numMoments, const ubyte* nodesMask = nullptr);
+
+	/// @brief Evaluates the transforms and the bounding boxes of the nodes from the specified local transforms of each node.
+	/// The pose must have a transform for every node of the model. Like @evaluateNodes it doesn't use the GPU.
+	bool evaluateNodesFromPose(const AnimationPose& localPose);
+
+	/// @brief Samples and blends the moments into @getLocalPose, without computing the global transforms of the nodes.
+	/// The parameters are the same as in @evaluateNodes.
+	bool evaluateLocalPose(const EvalMomentSets evalMoments[], int numMoments, const ubyte* nodesMask = nullptr);
+
+	/// The local transforms of the nodes computed by the last @evaluateNodes or @evaluateLocalPose.
+	const AnimationPose& getLocalPose() const { return m_blendedPose; }
+
+	/// @brief Computes the skinning matrices of all meshes (see @getSkinningPalette) from the already evaluated nodes.
+	/// The function does not use the GPU and, after the first evaluation, does not allocate memory.
+	void computeSkinningPalette();
+
+	/// The skinning matrices of all meshes, the bones of each mesh start at @getMeshBonesOffsetInSkinningBonesTexture.
+	const std::vector<mat4f>& getSkinningPalette() const { return bonesTransformTexDataForAllMeshes; }
+
+	/// @brief Evaluates the materials (only the first time, might load textures) and uploads the skinning palette
+	/// computed by @computeSkinningPalette to the GPU.
+	/// Together with @evaluateNodes and @computeSkinningPalette it does the same as @evaluateFromMoments. The split
+	/// allows evaluating many models on multiple threads, as only this function needs to be called on the main thread.
+	void finishEvaluation();
+
 	int getNumEvalMeshes() const { return int(m_evaluatedMeshes.size()); }
 	const EvaluatedMesh& getEvalMesh(const int iMesh) const { return m_evaluatedMeshes[iMesh]; }
 
@@ -117,17 +176,21 @@ struct SGE_CORE_API EvaluatedModel {
   private:
 
 	bool evaluateNodes_common();
-	bool evaluateFromMomentsInternal(const EvalMomentSets evalMoments[], int numMoments);
+	bool sampleLocalPoseInternal(const EvalMomentSets evalMoments[], int numMoments, const ubyte* nodesMask);
+	/// Computes the global transforms and the bounding boxes of the nodes from their local transforms in @localPose.
+	void evaluateNodesGlobalTransforms(const AnimationPose& localPose);
 	bool evaluateNodesFromExternalBones(const std::vector<mat4f>& boneGlobalTrasnformOverrides);
+	/// Computes the bounding box of the node from its global transform and expands @aabox with it.
+	void evaluateNodeBoundingBox(const int iNode);
 	bool evaluateMaterials();
 	bool evaluateSkinning();
 
   private:
 	struct AnimationDonor {
-		/// TODO: handle asset changeing. In that case the asset will still be valid,
-		/// but the data in it bill be different and @originalNodeId_to_donorNodeId will be wrong and we will crash.
 		std::shared_ptr<Asset> donorModel;
-		std::vector<int> originalNodeId_to_donorNodeId;
+		/// Shared between all evaluated models using the same donor, see @AnimationRetargetCache.
+		/// If the donor asset gets reloaded the remap is obtained again when the donor gets sampled.
+		std::shared_ptr<const AnimationDonorRemap> remap;
 	};
 
   public:
@@ -162,8 +225,27 @@ struct SGE_CORE_API EvaluatedModel {
 	AABox3f aabox;
 
 
+	/// If true the skinned meshes get deformed on the CPU (see @CpuSkinning) and drawn from a dynamic vertex buffer,
+	/// instead of using the bones texture in the vertex shader. Useful on targets where the texture fetch in the vertex
+	/// shader is slow. Meshes that cannot be skinned on the CPU (for example ones with quantized positions) still use the GPU.
+	bool useCpuSkinning = false;
+
 	// Temporaries used to avoid allocating memory again and again for each evaluation.
 	std::vector<mat4f> bonesTransformTexDataForAllMeshes;
+
+	/// The deformed vertices of each mesh skinned on the CPU, empty for the other meshes.
+	std::vector<std::vector<char>> m_cpuSkinnedVertices;
+
+	/// The key frame sampling hints, [iMoment * numNodes + iNode]. The moments usually keep their order between
+	/// evaluations, so when the animations move forward the key frames are found without searching.
+	std::vector<KeyFramesCursor> m_keyFramesCursors;
+
+	/// The local poses used while blending the moments, see @AnimationPoseBlender.
+	AnimationPose m_staticPose;
+	AnimationPose m_momentPose;
+	AnimationPose m_referencePose;
+	AnimationPose m_blendedPose;
+	AnimationPoseBlender m_poseBlender;
 };
 
 } // namespace sge
@@ -0,0 +1,479 @@
+#include <algorithm>
+#include <vector>
+
+#include "MeshOptimizer.h"
+#include "Model.h"
+
+namespace sge {
+
+namespace {
+	/// Simulates a FIFO vertex cache. A vertex is in the cache if less than @cacheSize misses happened after it was added.
+	struct FifoCacheSimulator {
+		FifoCacheSimulator(const size_t numVertices, const int cacheSize)
+		    : timestamps(numVertices, 0)
+		    , cacheSize(uint32(cacheSize))
+		    , time(uint32(cacheSize) + 1) {}
+
+		/// Returns true if the vertex was not in the cache.
+		bool access(const uint32 vertex) {
+			if (time - timestamps[vertex] > cacheSize) {
+				timestamps[vertex] = time;
+				time++;
+				return true;
+			}
+			return false;
+		}
+
+		int accessTriangle(const uint32* const triangle) {
+			return int(access(triangle[0])) + int(access(triangle[1])) + int(access(triangle[2]));
+		}
+
+		/// Evicts every vertex from the cache.
+		void flush() { time += cacheSize + 1; }
+
+		std::vector<uint32> timestamps;
+		uint32 cacheSize;
+		uint32 time;
+	};
+
+	/// For each vertex stores the list of triangles using it.
+	struct TriangleAdjacency {
+		TriangleAdjacency(const uint32* const indices, const size_t numIndices, const size_t numVertices)
+		    : counts(numVertices, 0)
+		    , offsets(numVertices, 0)
+		    , triangles(numIndices) {
+			for (size_t t = 0; t < numIndices; ++t) {
+				counts[indices[t]]++;
+			}
+
+			uint32 offset = 0;
+			for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+				offsets[iVertex] = offset;
+				offset += counts[iVertex];
+			}
+
+			std::vector<uint32> fillCounts(numVertices, 0);
+			for (size_t t = 0; t < numIndices; ++t) {
+				const uint32 vertex = indices[t];
+				triangles[offsets[vertex] + fillCounts[vertex]] = uint32(t / 3);
+				fillCounts[vertex]++;
+			}
+		}
+
+		std::vector<uint32> counts;
+		std::vector<uint32> offsets;
+		std::vector<uint32> triangles;
+	};
+
+	bool areIndicesValid(const uint32* const indices, const size_t numIndices, const size_t numVertices) {
+		for (size_t t = 0; t < numIndices; ++t) {
+			if (indices[t] >= numVertices) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	vec3f loadPosition(const char* const positions, const size_t positionsStrideBytes, const uint32 vertex) {
+		const float* const p = (const float*)(positions + positionsStrideBytes * vertex);
+		return vec3f(p[0], p[1], p[2]);
+	}
+} // namespace
+
+MeshOptimizer::VertexCacheStatistics
+    MeshOptimizer::analyzeVertexCache(const uint32* const indices, const size_t numIndices, const size_t numVertices, const int cacheSize) {
+	VertexCacheStatistics result;
+	if (numIndices < 3 || numIndices % 3 != 0 || areIndicesValid(indices, numIndices, numVertices) == false) {
+		sgeAssert(numIndices == 0 && "Invalid index buffer passed");
+		return result;
+	}
+
+	FifoCacheSimulator cache(numVertices, cacheSize);
+	std::vector<bool> isVertexReferenced(numVertices, false);
+
+	for (size_t t = 0; t < numIndices; ++t) {
+		const uint32 vertex = indices[t];
+		if (cache.access(vertex)) {
+			result.numVerticesTransformed++;
+		}
+
+		if (isVertexReferenced[vertex] == false) {
+			isVertexReferenced[vertex] = true;
+			result.numUniqueVertices++;
+		}
+	}
+
+	result.numTriangles = int(numIndices / 3);
+	result.acmr = float(result.numVerticesTransformed) / float(result.numTriangles);
+	result.atvr = float(result.numVerticesTransformed) / float(result.numUniqueVertices);
+
+	return result;
+}
+
+void MeshOptimizer::optimizeVertexCache(
+    uint32* const outIndices, const uint32* const indices, const size_t numIndices, const size_t numVertices, const int cacheSize) {
+	if (numIndices % 3 != 0 || areIndicesValid(indices, numIndices, numVertices) == false) {
+		sgeAssert(false && "Invalid index buffer passed");
+		return;
+	}
+
+	if (numIndices == 0) {
+		return;
+	}
+
+	// Keep a copy of the input as the output might be the same array.
+	const std::vector<uint32> inputIndices(indices, indices + numIndices);
+	const size_t numTriangles = numIndices / 3;
+	const TriangleAdjacency adjacency(inputIndices.data(), numIndices, numVertices);
+
+	std::vector<uint32> numLiveTriangles = adjacency.counts;
+	std::vector<bool> isTriangleEmitted(numTriangles, false);
+	std::vector<uint32> deadEndStack;
+	std::vector<uint32> candidates;
+	FifoCacheSimulator cache(numVertices, cacheSize);
+	const uint32 k = uint32(cacheSize);
+
+	size_t numOutputIndices = 0;
+	uint32 nextVertexCursor = 0; // Used to find a new fanning vertex when we hit a dead end.
+	sint64 fanningVertex = 0;
+
+	while (fanningVertex >= 0) {
+		candidates.clear();
+
+		// Emit all not yet emitted triangles around the fanning vertex.
+		const uint32 firstAdjacent = adjacency.offsets[fanningVertex];
+		const uint32 numAdjacent = adjacency.counts[fanningVertex];
+		for (uint32 iAdj = 0; iAdj < numAdjacent; ++iAdj) {
+			const uint32 triangle = adjacency.triangles[firstAdjacent + iAdj];
+			if (isTriangleEmitted[triangle]) {
+				continue;
+			}
+
+			for (int iCorner = 0; iCorner < 3; ++iCorner) {
+				const uint32 vertex = inputIndices[triangle * 3 + iCorner];
+				outIndices[numOutputIndices++] = vertex;
+				deadEndStack.push_back(vertex);
+				candidates.push_back(vertex);
+				numLiveTriangles[vertex]--;
+				cache.access(vertex);
+			}
+
+			isTriangleEmitted[triangle] = true;
+		}
+
+		// Pick the next fanning vertex. Prefer vertices that are going to stay in the cache after emitting all of their triangles.
+		fanningVertex = -1;
+		int bestPriority = -1;
+		for (const uint32 vertex : candidates) {
+			if (numLiveTriangles[vertex] == 0) {
+				continue;
+			}
+
+			int priority = 0;
+			const uint32 age = cache.time - cache.timestamps[vertex];
+			if (age + 2 * numLiveTriangles[vertex] <= k) {
+				priority = int(age);
+			}
+
+			if (priority > bestPriority) {
+				bestPriority = priority;
+				fanningVertex = vertex;
+			}
+		}
+
+		// Dead end, try the recently used vertices first and then any vertex that still has triangles left.
+		if (fanningVertex < 0) {
+			while (deadEndStack.empty() == false) {
+				const uint32 vertex = deadEndStack.back();
+				deadEndStack.pop_back();
+				if (numLiveTriangles[vertex] > 0) {
+					fanningVertex = vertex;
+					break;
+				}
+			}
+		}
+
+		if (fanningVertex < 0) {
+			while (nextVertexCursor < numVertices) {
+				if (numLiveTriangles[nextVertexCursor] > 0) {
+					fanningVertex = nextVertexCursor;
+					break;
+				}
+				nextVertexCursor++;
+			}
+		}
+	}
+
+	sgeAssert(numOutputIndices == numIndices);
+}
+
+void MeshOptimizer::optimizeOverdraw(uint32* const outIndices,
+                                     const uint32* const indices,
+                                     const size_t numIndices,
+                                     const char* const positions,
+                                     const size_t positionsStrideBytes,
+                                     const size_t numVertices,
+                                     const float threshold,
+                                     const int cacheSize) {
+	if (numIndices % 3 != 0 || positions == nullptr || areIndicesValid(indices, numIndices, numVertices) == false) {
+		sgeAssert(false && "Invalid index buffer passed");
+		return;
+	}
+
+	if (numIndices == 0) {
+		return;
+	}
+
+	const std::vector<uint32> inputIndices(indices, indices + numIndices);
+	const size_t numTriangles = numIndices / 3;
+
+	// Hard boundaries are the places where the vertex cache optimization started a new fan with no shared vertices.
+	// Reordering the clusters between them doesn't change the cache efficiency much.
+	std::vector<size_t> hardBoundaries;
+	{
+		FifoCacheSimulator cache(numVertices, cacheSize);
+		for (size_t iTri = 0; iTri < numTriangles; ++iTri) {
+			if (cache.accessTriangle(&inputIndices[iTri * 3]) == 3) {
+				hardBoundaries.push_back(iTri);
+			}
+		}
+		hardBoundaries.push_back(numTriangles);
+	}
+
+	// Soft boundaries split the hard clusters further, while keeping the ACMR of each piece within the threshold.
+	std::vector<size_t> clusterStarts;
+	{
+		FifoCacheSimulator cache(numVertices, cacheSize);
+		for (size_t iHard = 0; iHard + 1 < hardBoundaries.size(); ++iHard) {
+			const size_t start = hardBoundaries[iHard];
+			const size_t end = hardBoundaries[iHard + 1];
+
+			cache.flush();
+			int clusterMisses = 0;
+			for (size_t iTri = start; iTri < end; ++iTri) {
+				clusterMisses += cache.accessTriangle(&inputIndices[iTri * 3]);
+			}
+			const float maxAcmr = threshold * float(clusterMisses) / float(end - start);
+
+			cache.flush();
+			clusterStarts.push_back(start);
+			size_t softStart = start;
+			int softMisses = 0;
+			for (size_t iTri = start; iTri < end; ++iTri) {
+				softMisses += cache.accessTriangle(&inputIndices[iTri * 3]);
+
+				const bool isLast = iTri + 1 == end;
+				if (!isLast && float(softMisses) / float(iTri + 1 - softStart) <= maxAcmr) {
+					softStart = iTri + 1;
+					softMisses = 0;
+					clusterStarts.push_back(softStart);
+					cache.flush();
+				}
+			}
+		}
+	}
+
+	// Compute the area weighted centroid of the whole mesh.
+	vec3f meshCentroid(0.f);
+	float meshArea = 0.f;
+	for (size_t iTri = 0; iTri < numTriangles; ++iTri) {
+		const vec3f a = loadPosition(positions, positionsStrideBytes, inputIndices[iTri * 3 + 0]);
+		const vec3f b = loadPosition(positions, positionsStrideBytes, inputIndices[iTri * 3 + 1]);
+		const vec3f c = loadPosition(positions, positionsStrideBytes, inputIndices[iTri * 3 + 2]);
+		const float area = cross(b - a, c - a).length();
+		meshCentroid += (a + b + c) * (area / 3.f);
+		meshArea += area;
+	}
+
+	if (meshArea > 0.f) {
+		meshCentroid /= meshArea;
+	}
+
+	// Clusters that are further away from the center in the direction of their normal are more likely to occlude other clusters.
+	struct ClusterSortKey {
+		float sortKey;
+		size_t clusterIndex;
+	};
+
+	const size_t numClusters = clusterStarts.size();
+	std::vector<ClusterSortKey> sortKeys(numClusters);
+
+	for (size_t iCluster = 0; iCluster < numClusters; ++iCluster) {
+		const size_t start = clusterStarts[iCluster];
+		const size_t end = (iCluster + 1 < numClusters) ? clusterStarts[iCluster + 1] : numTriangles;
+
+		vec3f clusterCentroid(0.f);
+		vec3f clusterNormal(0.f);
+		float clusterArea = 0.f;
+
+		for (size_t iTri = start; iTri < end; ++iTri) {
+			const vec3f a = loadPosition(positions, positionsStrideBytes, inputIndices[iTri * 3 + 0]);
+			const vec3f b = loadPosition(positions, positionsStrideBytes, inputIndices[iTri * 3 + 1]);
+			const vec3f c = loadPosition(positions, positionsStrideBytes, inputIndices[iTri * 3 + 2]);
+			const vec3f areaNormal = cross(b - a, c - a);
+			const float area = areaNormal.length();
+
+			clusterCentroid += (a + b + c) * (area / 3.f);
+			clusterNormal += areaNormal;
+			clusterArea += area;
+		}
+
+		if (clusterArea > 0.f) {
+			clusterCentroid /= clusterArea;
+		}
+
+		const float normalLength = clusterNormal.length();
+		if (normalLength > 0.f) {
+			clusterNormal /= normalLength;
+		}
+
+		sortKeys[iCluster].sortKey = dot(clusterCentroid - meshCentroid, clusterNormal);
+		sortKeys[iCluster].clusterIndex = iCluster;
+	}
+
+	std::stable_sort(sortKeys.begin(), sortKeys.end(), [](const ClusterSortKey& a, const ClusterSortKey& b) { return a.sortKey > b.sortKey; });
+
+	size_t numOutputIndices = 0;
+	for (const ClusterSortKey& key : sortKeys) {
+		const size_t start = clusterStarts[key.clusterIndex];
+		const size_t end = (key.clusterIndex + 1 < numClusters) ? clusterStarts[key.clusterIndex + 1] : numTriangles;
+
+		for (size_t t = start * 3; t < end * 3; ++t) {
+			outIndices[numOutputIndices++] = inputIndices[t];
+		}
+	}
+
+	sgeAssert(numOutputIndices == numIndices);
+}
+
+size_t MeshOptimizer::optimizeVertexFetchRemap(uint32* const outRemap, const uint32* const indices, const size_t numIndices, const size_t numVertices) {
+	for (size_t t = 0; t < numVertices; ++t) {
+		outRemap[t] = kUnusedVertex;
+	}
+
+	uint32 numUsedVertices = 0;
+	for (size_t t = 0; t < numIndices; ++t) {
+		const uint32 vertex = indices[t];
+		if (vertex >= numVertices) {
+			sgeAssert(false && "Invalid index buffer passed");
+			continue;
+		}
+
+		if (outRemap[vertex] == kUnusedVertex) {
+			outRemap[vertex] = numUsedVertices;
+			numUsedVertices++;
+		}
+	}
+
+	return numUsedVertices;
+}
+
+void MeshOptimizer::remapIndexBuffer(uint32* const outIndices, const uint32* const indices, const size_t numIndices, const uint32* const remap) {
+	for (size_t t = 0; t < numIndices; ++t) {
+		sgeAssert(remap[indices[t]] != kUnusedVertex);
+		outIndices[t] = remap[indices[t]];
+	}
+}
+
+void MeshOptimizer::remapVertexBuffer(
+    void* const outVertices, const void* const vertices, const size_t numVertices, const size_t vertexStrideBytes, const uint32* const remap) {
+	sgeAssert(outVertices != vertices);
+
+	for (size_t t = 0; t < numVertices; ++t) {
+		if (remap[t] != kUnusedVertex) {
+			memcpy((char*)outVertices + remap[t] * vertexStrideBytes, (const char*)vertices + t * vertexStrideBytes, vertexStrideBytes);
+		}
+	}
+}
+
+bool MeshOptimizer::optimizeMesh(ModelMesh& mesh) {
+	if (mesh.primitiveTopology != PrimitiveTopology::TriangleList) {
+		return false;
+	}
+
+	if (mesh.ibFmt != UniformType::Uint16 && mesh.ibFmt != UniformType::Uint) {
+		return false;
+	}
+
+	const size_t indexSizeBytes = UniformType::GetSizeBytes(mesh.ibFmt);
+	const size_t numIndices = size_t(mesh.numElements);
+	const size_t numVertices = size_t(mesh.numVertices);
+	const size_t stride = size_t(mesh.stride);
+
+	// The buffers might be shared with other meshes or have some additional data, we cannot reorder them.
+	if (mesh.vbByteOffset != 0 || mesh.ibByteOffset != 0 || stride == 0 || mesh.vertexBufferRaw.size() != numVertices * stride ||
+	    mesh.indexBufferRaw.size() != numIndices * indexSizeBytes || numIndices % 3 != 0 || mesh.vbPositionOffsetBytes < 0) {
+		return false;
+	}
+
+	// The overdraw optimization needs the positions as floats.
+	if (mesh.dequantization.hasQuantizedPositions) {
+		return false;
+	}
+
+	// Convert the indices to 32bit.
+	std::vector<uint32> indices(numIndices);
+	if (mesh.ibFmt == UniformType::Uint16) {
+		const uint16* const indices16 = (const uint16*)mesh.indexBufferRaw.data();
+		for (size_t t = 0; t < numIndices; ++t) {
+			indices[t] = indices16[t];
+		}
+	} else {
+		memcpy(indices.data(), mesh.indexBufferRaw.data(), numIndices * sizeof(uint32));
+	}
+
+	if (areIndicesValid(indices.data(), numIndices, numVertices) == false) {
+		return false;
+	}
+
+	for (const ModelMeshLod& lod : mesh.lods) {
+		if (lod.indexBufferRaw.size() != size_t(lod.numElements) * indexSizeBytes) {
+			return false;
+		}
+	}
+
+	optimizeVertexCache(indices.data(), indices.data(), numIndices, numVertices);
+	optimizeOverdraw(indices.data(), indices.data(), numIndices, mesh.vertexBufferRaw.data() + mesh.vbPositionOffsetBytes, stride,
+	                 numVertices);
+
+	std::vector<uint32> remap(numVertices);
+	const size_t numUsedVertices = optimizeVertexFetchRemap(remap.data(), indices.data(), numIndices, numVertices);
+	remapIndexBuffer(indices.data(), indices.data(), numIndices, remap.data());
+
+	std::vector<char> newVertexBuffer(numUsedVertices * stride);
+	remapVertexBuffer(newVertexBuffer.data(), mesh.vertexBufferRaw.data(), numVertices, stride, remap.data());
+
+	std::vector<char> newIndexBuffer(numIndices * indexSizeBytes);
+	if (mesh.ibFmt == UniformType::Uint16) {
+		uint16* const indices16 = (uint16*)newIndexBuffer.data();
+		for (size_t t = 0; t < numIndices; ++t) {
+			indices16[t] = uint16(indices[t]);
+		}
+	} else {
+		memcpy(newIndexBuffer.data(), indices.data(), numIndices * sizeof(uint32));
+	}
+
+	// The LODs reference the same vertices, remap them as well. Vertices used only by the LODs are never removed,
+	// as every LOD uses a subset of the vertices of the full detail mesh.
+	for (ModelMeshLod& lod : mesh.lods) {
+		std::vector<char> newLodIndexBuffer(lod.indexBufferRaw.data(), lod.indexBufferRaw.data() + lod.indexBufferRaw.size());
+		for (int t = 0; t < lod.numElements; ++t) {
+			if (mesh.ibFmt == UniformType::Uint16) {
+				uint16& index = ((uint16*)newLodIndexBuffer.data())[t];
+				index = uint16(remap[index]);
+			} else {
+				uint32& index = ((uint32*)newLodIndexBuffer.data())[t];
+				index = remap[index];
+			}
+		}
+		lod.indexBufferRaw = std::move(newLodIndexBuffer);
+	}
+
+	mesh.vertexBufferRaw = std::move(newVertexBuffer);
+	mesh.indexBufferRaw = std::move(newIndexBuffer);
+	mesh.numVertices = int(numUsedVertices);
+
+	return true;
+}
+
+} // namespace sge
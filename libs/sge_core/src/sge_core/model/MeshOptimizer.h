@@ -0,0 +1,85 @@
+#pragma once
+
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+struct ModelMesh;
+
+/// @brief A set of functions for reordering triangle list meshes so they are faster to render on the GPU.
+/// The usual order of optimizations is:
+///    - @optimizeVertexCache - reorders the triangles so the post-transform vertex cache is used better,
+///    - @optimizeOverdraw - reorders clusters of triangles so the ones facing outwards are drawn first, reducing overdraw,
+///    - @optimizeVertexFetchRemap - reorders the vertices in the order of their first use, improving the vertex fetch locality.
+/// @optimizeMesh does all of the above on a @ModelMesh.
+struct SGE_CORE_API MeshOptimizer {
+	/// The size of the FIFO cache used for simulating the post-transform vertex cache.
+	static constexpr int kDefaultCacheSize = 16;
+
+	/// Used in the vertex remap tables for vertices that are not referenced by any triangle.
+	static constexpr uint32 kUnusedVertex = 0xFFFFFFFF;
+
+	struct VertexCacheStatistics {
+		int numVerticesTransformed = 0;
+		int numTriangles = 0;
+		int numUniqueVertices = 0;
+
+		/// Average cache miss ratio - the number of transformed vertices per triangle.
+		/// 3 is the worst possible value, ~0.5 is the best for big regular meshes.
+		float acmr = 0.f;
+
+		/// Average transformed vertex ratio - the number of transformed vertices per referenced vertex. 1 is the best possible value.
+		float atvr = 0.f;
+	};
+
+	/// @brief Simulates a FIFO post-transform vertex cache with the specified size over the triangle list.
+	static VertexCacheStatistics
+	    analyzeVertexCache(const uint32* const indices, const size_t numIndices, const size_t numVertices, const int cacheSize = kDefaultCacheSize);
+
+	/// @brief Reorders the triangles for better post-transform vertex cache usage. Uses the Tipsify algorithm
+	/// by Sander, Nehab and Barczak - "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw".
+	/// @param [out] outIndices the reordered indices, could be the same as @indices.
+	static void optimizeVertexCache(uint32* const outIndices,
+	                                const uint32* const indices,
+	                                const size_t numIndices,
+	                                const size_t numVertices,
+	                                const int cacheSize = kDefaultCacheSize);
+
+	/// @brief Splits the triangle list in clusters and sorts them so the clusters facing away from the center of the mesh
+	/// are drawn first. The input should already be optimized with @optimizeVertexCache. The clusters are made such that
+	/// the ACMR of the result is not worse than the ACMR of the input multiplied by @threshold.
+	/// @param [out] outIndices the reordered indices, could be the same as @indices.
+	/// @param [in] positions points to the position (3 floats) of the 1st vertex.
+	/// @param [in] positionsStrideBytes the byte distance between the positions of two consecutive vertices.
+	static void optimizeOverdraw(uint32* const outIndices,
+	                             const uint32* const indices,
+	                             const size_t numIndices,
+	                             const char* const positions,
+	                             const size_t positionsStrideBytes,
+	                             const size_t numVertices,
+	                             const float threshold = 1.05f,
+	                             const int cacheSize = kDefaultCacheSize);
+
+	/// @brief Generates a vertex remap table that orders the vertices in the order of their first use in the index buffer.
+	/// Vertices that aren't used are marked with @kUnusedVertex.
+	/// @param [out] outRemap an array of @numVertices elements, for each old vertex index contains the new index.
+	/// @return the number of referenced vertices, that is the number of vertices after the remap.
+	static size_t optimizeVertexFetchRemap(uint32* const outRemap, const uint32* const indices, const size_t numIndices, const size_t numVertices);
+
+	/// @brief Applies the remap table generated by @optimizeVertexFetchRemap to the index buffer.
+	static void remapIndexBuffer(uint32* const outIndices, const uint32* const indices, const size_t numIndices, const uint32* const remap);
+
+	/// @brief Applies the remap table generated by @optimizeVertexFetchRemap to the vertex buffer.
+	/// @param [out] outVertices should have space for the number of vertices returned by @optimizeVertexFetchRemap. Should not
+	/// overlap with @vertices.
+	static void remapVertexBuffer(
+	    void* const outVertices, const void* const vertices, const size_t numVertices, const size_t vertexStrideBytes, const uint32* const remap);
+
+	/// @brief Applies all the optimizations above to the vertex and index buffers of the mesh.
+	/// Only indexed triangle lists, that own the whole vertex and index buffers are supported.
+	/// @return true if the mesh was optimized.
+	static bool optimizeMesh(ModelMesh& mesh);
+};
+
+} // namespace sge
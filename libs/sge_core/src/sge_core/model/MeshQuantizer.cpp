@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "MeshQuantizer.h"
+#include "Model.h"
+
+namespace sge {
+
+vec2f MeshQuantizer::octahedralEncode(const vec3f& n) {
+	const float l1Norm = fabsf(n.x) + fabsf(n.y) + fabsf(n.z);
+	if (l1Norm <= 0.f) {
+		return vec2f(0.f);
+	}
+
+	vec2f e(n.x / l1Norm, n.y / l1Norm);
+
+	// Fold the lower hemisphere over the diagonals.
+	if (n.z < 0.f) {
+		const float ex = (1.f - fabsf(e.y)) * (e.x >= 0.f ? 1.f : -1.f);
+		const float ey = (1.f - fabsf(e.x)) * (e.y >= 0.f ? 1.f : -1.f);
+		e = vec2f(ex, ey);
+	}
+
+	return e;
+}
+
+vec3f MeshQuantizer::octahedralDecode(const vec2f& e) {
+	// Keep in sync with libQuantization_octahedralDecode in lib_quantization.shader.
+	vec3f n(e.x, e.y, 1.f - fabsf(e.x) - fabsf(e.y));
+	const float t = std::max(-n.z, 0.f);
+	n.x += (n.x >= 0.f) ? -t : t;
+	n.y += (n.y >= 0.f) ? -t : t;
+	return n.normalized0();
+}
+
+sint16 MeshQuantizer::quantizeSnorm16(const float v) {
+	const float clamped = std::min(std::max(v, -1.f), 1.f);
+	return sint16(lroundf(clamped * 32767.f));
+}
+
+float MeshQuantizer::dequantizeSnorm16(const sint16 v) {
+	return std::max(float(v) / 32767.f, -1.f);
+}
+
+uint16 MeshQuantizer::quantizeUnorm16(const float v) {
+	const float clamped = std::min(std::max(v, 0.f), 1.f);
+	return uint16(lroundf(clamped * 65535.f));
+}
+
+float MeshQuantizer::dequantizeUnorm16(const uint16 v) {
+	return float(v) / 65535.f;
+}
+
+bool MeshQuantizer::quantizeMesh(ModelMesh& mesh, const bool quantizePositions) {
+	const size_t numVertices = size_t(mesh.numVertices);
+	const size_t stride = size_t(mesh.stride);
+	if (numVertices == 0 || stride == 0 || mesh.vbByteOffset < 0 || mesh.vertexBufferRaw.size() < size_t(mesh.vbByteOffset) + numVertices * stride) {
+		return false;
+	}
+
+	const char* const srcVertices = mesh.vertexBufferRaw.data() + mesh.vbByteOffset;
+
+	const auto isDirection = [](const VertexDecl& decl) -> bool {
+		return decl.format == UniformType::Float3 && (decl.semantic == "a_normal" || decl.semantic == "a_tangent" || decl.semantic == "a_binormal");
+	};
+	const auto isUV = [](const VertexDecl& decl) -> bool { return decl.format == UniformType::Float2 && decl.semantic == "a_uv"; };
+	const auto isPosition = [&](const VertexDecl& decl) -> bool {
+		return quantizePositions && decl.format == UniformType::Float3 && decl.semantic == "a_position";
+	};
+
+	// Only the normals, tangents and binormals could be octahedral encoded, if the mesh has some of them already
+	// in another format we cannot encode the rest.
+	bool hasDirections = false;
+	for (const VertexDecl& decl : mesh.vertexDecl) {
+		if (decl.semantic == "a_normal" || decl.semantic == "a_tangent" || decl.semantic == "a_binormal") {
+			if (isDirection(decl) == false) {
+				return false;
+			}
+			hasDirections = true;
+		}
+	}
+
+	// Compute the range of the uvs and the positions, those get quantized relative to it.
+	AABox3f positionsBox;
+	vec2f uvMin(FLT_MAX);
+	vec2f uvMax(-FLT_MAX);
+	for (const VertexDecl& decl : mesh.vertexDecl) {
+		for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+			const float* const v = (const float*)(srcVertices + iVertex * stride + decl.byteOffset);
+			if (isPosition(decl)) {
+				positionsBox.expand(vec3f(v[0], v[1], v[2]));
+			} else if (isUV(decl)) {
+				uvMin = vec2f(std::min(uvMin.x, v[0]), std::min(uvMin.y, v[1]));
+				uvMax = vec2f(std::max(uvMax.x, v[0]), std::max(uvMax.y, v[1]));
+			}
+		}
+	}
+
+	// Compute the new vertex layout.
+	std::vector<VertexDecl> newVertexDecl;
+	int newStride = 0;
+	bool hasChanges = false;
+	for (const VertexDecl& decl : mesh.vertexDecl) {
+		VertexDecl newDecl = decl;
+		if (isDirection(decl)) {
+			newDecl.format = UniformType::Short2_Snorm_IA;
+		} else if (isUV(decl)) {
+			newDecl.format = UniformType::Ushort2_Unorm_IA;
+		} else if (isPosition(decl)) {
+			newDecl.format = UniformType::Ushort4_Unorm_IA;
+		}
+
+		hasChanges |= newDecl.format != decl.format;
+		newDecl.byteOffset = newStride;
+		newStride += UniformType::GetSizeBytes(newDecl.format);
+		newVertexDecl.push_back(newDecl);
+	}
+
+	if (hasChanges == false) {
+		return false;
+	}
+
+	// Compute the dequantization parameters, degenerate ranges use a scale of 1 so the decoding is still valid.
+	VertexDequantization dequantization = mesh.dequantization;
+	dequantization.hasOctahedralNormals = hasDirections;
+	if (uvMin.x <= uvMax.x) {
+		const vec2f uvRange = uvMax - uvMin;
+		dequantization.uvScale = vec2f(uvRange.x > 0.f ? uvRange.x : 1.f, uvRange.y > 0.f ? uvRange.y : 1.f);
+		dequantization.uvOffset = uvMin;
+	}
+
+	if (positionsBox.IsEmpty() == false) {
+		const vec3f size = positionsBox.size();
+		dequantization.positionScale = vec3f(size.x > 0.f ? size.x : 1.f, size.y > 0.f ? size.y : 1.f, size.z > 0.f ? size.z : 1.f);
+		dequantization.positionOffset = positionsBox.min;
+		dequantization.hasQuantizedPositions = true;
+	}
+
+	// Convert the vertices.
+	std::vector<char> newVertexBuffer(numVertices * newStride, 0);
+	for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+		const char* const srcVertex = srcVertices + iVertex * stride;
+		char* const dstVertex = newVertexBuffer.data() + iVertex * newStride;
+
+		for (size_t iDecl = 0; iDecl < mesh.vertexDecl.size(); ++iDecl) {
+			const VertexDecl& srcDecl = mesh.vertexDecl[iDecl];
+			const VertexDecl& dstDecl = newVertexDecl[iDecl];
+			const float* const src = (const float*)(srcVertex + srcDecl.byteOffset);
+			char* const dst = dstVertex + dstDecl.byteOffset;
+
+			if (isDirection(srcDecl)) {
+				const vec2f e = octahedralEncode(vec3f(src[0], src[1], src[2]));
+				const sint16 q[2] = {quantizeSnorm16(e.x), quantizeSnorm16(e.y)};
+				memcpy(dst, q, sizeof(q));
+			} else if (isUV(srcDecl)) {
+				const uint16 q[2] = {
+				    quantizeUnorm16((src[0] - dequantization.uvOffset.x) / dequantization.uvScale.x),
+				    quantizeUnorm16((src[1] - dequantization.uvOffset.y) / dequantization.uvScale.y),
+				};
+				memcpy(dst, q, sizeof(q));
+			} else if (isPosition(srcDecl)) {
+				const uint16 q[4] = {
+				    quantizeUnorm16((src[0] - dequantization.positionOffset.x) / dequantization.positionScale.x),
+				    quantizeUnorm16((src[1] - dequantization.positionOffset.y) / dequantization.positionScale.y),
+				    quantizeUnorm16((src[2] - dequantization.positionOffset.z) / dequantization.positionScale.z),
+				    0,
+				};
+				memcpy(dst, q, sizeof(q));
+			} else {
+				memcpy(dst, src, UniformType::GetSizeBytes(srcDecl.format));
+			}
+		}
+	}
+
+	// Update the mesh to point to the new layout.
+	const auto findOffset = [&newVertexDecl](const char* const semantic) -> int {
+		for (const VertexDecl& decl : newVertexDecl) {
+			if (decl.semantic == semantic) {
+				return decl.byteOffset;
+			}
+		}
+		return -1;
+	};
+
+	const auto remapOffset = [&](const int oldOffset) -> int {
+		for (size_t iDecl = 0; iDecl < mesh.vertexDecl.size(); ++iDecl) {
+			if (mesh.vertexDecl[iDecl].byteOffset == oldOffset) {
+				return newVertexDecl[iDecl].byteOffset;
+			}
+		}
+		return -1;
+	};
+
+	mesh.vbPositionOffsetBytes = findOffset("a_position");
+	mesh.vbNormalOffsetBytes = findOffset("a_normal");
+	mesh.vbTangetOffsetBytes = findOffset("a_tangent");
+	mesh.vbBinormalOffsetBytes = findOffset("a_binormal");
+	mesh.vbUVOffsetBytes = findOffset("a_uv");
+	mesh.vbVertexColorOffsetBytes = (mesh.vbVertexColorOffsetBytes >= 0) ? remapOffset(mesh.vbVertexColorOffsetBytes) : -1;
+	mesh.vbBonesIdsBytesOffset = (mesh.vbBonesIdsBytesOffset >= 0) ? remapOffset(mesh.vbBonesIdsBytesOffset) : -1;
+	mesh.vbBonesWeightsByteOffset = (mesh.vbBonesWeightsByteOffset >= 0) ? remapOffset(mesh.vbBonesWeightsByteOffset) : -1;
+
+	mesh.vertexDecl = std::move(newVertexDecl);
+	mesh.stride = newStride;
+	mesh.vbByteOffset = 0;
+	mesh.vertexBufferRaw = std::move(newVertexBuffer);
+	mesh.dequantization = dequantization;
+
+	return true;
+}
+
+} // namespace sge
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/math/vec2.h"
+#include "sge_utils/math/vec3.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+struct ModelMesh;
+
+/// @brief Converts the vertex attributes of meshes to smaller formats, reducing the memory, the file size and
+/// the vertex fetch bandwidth.
+///    - normals, tangents and binormals are octahedral encoded in two signed 16bit integers (@UniformType::Short2_Snorm_IA),
+///    - uvs are stored as two unsigned 16bit integers relative to the uv range of the mesh (@UniformType::Ushort2_Unorm_IA),
+///    - optionally, positions are stored as unsigned 16bit integers relative to the mesh bounding box (@UniformType::Ushort4_Unorm_IA).
+/// The values needed to decode the attributes are stored in @ModelMesh::dequantization.
+struct SGE_CORE_API MeshQuantizer {
+	/// @brief Encodes the unit vector @n in two components in [-1;1] using octahedral mapping.
+	/// See Cigolle et al. - "A Survey of Efficient Representations for Independent Unit Vectors".
+	static vec2f octahedralEncode(const vec3f& n);
+
+	/// @brief Decodes a unit vector encoded with @octahedralEncode.
+	static vec3f octahedralDecode(const vec2f& e);
+
+	/// @brief Converts a float in [-1;1] to signed normalized 16bit integer and back, matching the GPU conversion rules.
+	static sint16 quantizeSnorm16(const float v);
+	static float dequantizeSnorm16(const sint16 v);
+
+	/// @brief Converts a float in [0;1] to unsigned normalized 16bit integer and back, matching the GPU conversion rules.
+	static uint16 quantizeUnorm16(const float v);
+	static float dequantizeUnorm16(const uint16 v);
+
+	/// @brief Quantizes the vertex buffer of the mesh. Attributes that are already quantized or are not
+	/// in a known format are kept as they are.
+	/// @param [in] quantizePositions if true the positions are also quantized. The precision of the positions
+	///             is (bounding box size / 65535) which might not be enough for big meshes.
+	/// @return true if the mesh was quantized.
+	static bool quantizeMesh(ModelMesh& mesh, const bool quantizePositions);
+};
+
+} // namespace sge
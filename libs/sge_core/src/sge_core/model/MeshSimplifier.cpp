@@ -0,0 +1,400 @@
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "Model.h"
+
+namespace sge {
+
+namespace {
+	/// A symmetric 4x4 matrix representing the sum of squared distances to a set of planes.
+	struct Quadric {
+		double a2 = 0.0, b2 = 0.0, c2 = 0.0, d2 = 0.0;
+		double ab = 0.0, ac = 0.0, ad = 0.0;
+		double bc = 0.0, bd = 0.0, cd = 0.0;
+		double weight = 0.0;
+
+		static Quadric fromPlane(const double a, const double b, const double c, const double d, const double weight) {
+			Quadric q;
+			q.a2 = a * a * weight;
+			q.b2 = b * b * weight;
+			q.c2 = c * c * weight;
+			q.d2 = d * d * weight;
+			q.ab = a * b * weight;
+			q.ac = a * c * weight;
+			q.ad = a * d * weight;
+			q.bc = b * c * weight;
+			q.bd = b * d * weight;
+			q.cd = c * d * weight;
+			q.weight = weight;
+			return q;
+		}
+
+		void add(const Quadric& o) {
+			a2 += o.a2;
+			b2 += o.b2;
+			c2 += o.c2;
+			d2 += o.d2;
+			ab += o.ab;
+			ac += o.ac;
+			ad += o.ad;
+			bc += o.bc;
+			bd += o.bd;
+			cd += o.cd;
+			weight += o.weight;
+		}
+
+		/// Returns the weighted average distance of the point to the planes.
+		double distance(const vec3f& p) const {
+			const double x = p.x, y = p.y, z = p.z;
+			const double sqDist = a2 * x * x + b2 * y * y + c2 * z * z + 2.0 * (ab * x * y + ac * x * z + bc * y * z) +
+			                      2.0 * (ad * x + bd * y + cd * z) + d2;
+			if (weight <= 0.0 || sqDist <= 0.0) {
+				return 0.0;
+			}
+			return sqrt(sqDist / weight);
+		}
+	};
+
+	struct Collapse {
+		uint32 from;
+		uint32 to;
+		float error;
+	};
+
+	vec3f loadPosition(const char* const positions, const size_t positionsStrideBytes, const uint32 vertex) {
+		const float* const p = (const float*)(positions + positionsStrideBytes * vertex);
+		return vec3f(p[0], p[1], p[2]);
+	}
+
+	struct PositionHash {
+		size_t operator()(const vec3f& p) const {
+			uint32 bits[3];
+			memcpy(bits, p.data, sizeof(bits));
+			return size_t(bits[0] * 73856093u ^ bits[1] * 19349663u ^ bits[2] * 83492791u);
+		}
+	};
+
+	struct PositionEqual {
+		bool operator()(const vec3f& a, const vec3f& b) const { return memcmp(a.data, b.data, sizeof(a.data)) == 0; }
+	};
+
+	/// Finds the vertices that must not be removed: the ones on open borders, non-manifold edges
+	/// and on attribute seams (multiple vertices with the same position).
+	std::vector<bool> findLockedVertices(const uint32* const indices,
+	                                     const size_t numIndices,
+	                                     const char* const positions,
+	                                     const size_t positionsStrideBytes,
+	                                     const size_t numVertices) {
+		std::vector<uint32> positionIds(numVertices);
+		std::vector<int> numVerticesPerPositionId;
+		{
+			std::unordered_map<vec3f, uint32, PositionHash, PositionEqual> positionToId;
+			for (uint32 iVertex = 0; iVertex < numVertices; ++iVertex) {
+				const auto itr = positionToId.emplace(loadPosition(positions, positionsStrideBytes, iVertex), uint32(positionToId.size()));
+				positionIds[iVertex] = itr.first->second;
+				if (itr.second) {
+					numVerticesPerPositionId.push_back(0);
+				}
+				numVerticesPerPositionId[itr.first->second]++;
+			}
+		}
+
+		std::vector<bool> isPositionLocked(numVerticesPerPositionId.size(), false);
+		for (size_t t = 0; t < numVerticesPerPositionId.size(); ++t) {
+			isPositionLocked[t] = numVerticesPerPositionId[t] > 1;
+		}
+
+		// Count the triangles using each edge, manifold edges inside the surface are used by exactly two triangles.
+		std::unordered_map<uint64, int> edgeUseCount;
+		for (size_t t = 0; t < numIndices; t += 3) {
+			for (int iEdge = 0; iEdge < 3; ++iEdge) {
+				const uint64 a = positionIds[indices[t + iEdge]];
+				const uint64 b = positionIds[indices[t + (iEdge + 1) % 3]];
+				edgeUseCount[(std::min(a, b) << 32) | std::max(a, b)]++;
+			}
+		}
+
+		for (const auto& itr : edgeUseCount) {
+			if (itr.second != 2) {
+				isPositionLocked[itr.first >> 32] = true;
+				isPositionLocked[itr.first & 0xFFFFFFFF] = true;
+			}
+		}
+
+		std::vector<bool> isLocked(numVertices);
+		for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+			isLocked[iVertex] = isPositionLocked[positionIds[iVertex]];
+		}
+
+		return isLocked;
+	}
+} // namespace
+
+size_t MeshSimplifier::simplify(uint32* const outIndices,
+                                const uint32* const indices,
+                                const size_t numIndices,
+                                const char* const positions,
+                                const size_t positionsStrideBytes,
+                                const size_t numVertices,
+                                const size_t targetNumIndices,
+                                const float maxError,
+                                float* const outError) {
+	if (outError) {
+		*outError = 0.f;
+	}
+
+	if (numIndices % 3 != 0 || positions == nullptr) {
+		sgeAssert(false && "Invalid index buffer passed");
+		return 0;
+	}
+
+	for (size_t t = 0; t < numIndices; ++t) {
+		if (indices[t] >= numVertices) {
+			sgeAssert(false && "Invalid index buffer passed");
+			return 0;
+		}
+	}
+
+	std::vector<uint32> result(indices, indices + numIndices);
+	const std::vector<bool> isLocked = findLockedVertices(indices, numIndices, positions, positionsStrideBytes, numVertices);
+
+	// Every vertex starts with the planes of the triangles around it.
+	std::vector<Quadric> quadrics(numVertices);
+	for (size_t t = 0; t < numIndices; t += 3) {
+		const vec3f a = loadPosition(positions, positionsStrideBytes, indices[t + 0]);
+		const vec3f b = loadPosition(positions, positionsStrideBytes, indices[t + 1]);
+		const vec3f c = loadPosition(positions, positionsStrideBytes, indices[t + 2]);
+
+		vec3f normal = cross(b - a, c - a);
+		const float doubleArea = normal.length();
+		if (doubleArea <= 0.f) {
+			continue;
+		}
+		normal /= doubleArea;
+
+		const Quadric q = Quadric::fromPlane(normal.x, normal.y, normal.z, -dot(normal, a), doubleArea * 0.5);
+		quadrics[indices[t + 0]].add(q);
+		quadrics[indices[t + 1]].add(q);
+		quadrics[indices[t + 2]].add(q);
+	}
+
+	const size_t targetNumTriangles = targetNumIndices / 3;
+	float resultError = 0.f;
+
+	std::vector<uint32> adjacencyOffsets(numVertices + 1);
+	std::vector<uint32> adjacency;
+	std::vector<Collapse> collapses;
+	std::vector<uint32> remap(numVertices);
+	std::vector<bool> isTouched(numVertices);
+
+	// Each pass collapses a set of independent edges with the lowest error.
+	while (result.size() / 3 > targetNumTriangles) {
+		const size_t numTriangles = result.size() / 3;
+
+		// Build the vertex to triangles adjacency.
+		std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+		for (const uint32 vertex : result) {
+			adjacencyOffsets[vertex + 1]++;
+		}
+		for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+			adjacencyOffsets[iVertex + 1] += adjacencyOffsets[iVertex];
+		}
+
+		adjacency.resize(result.size());
+		{
+			std::vector<uint32> fillOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for (size_t t = 0; t < result.size(); ++t) {
+				adjacency[fillOffsets[result[t]]++] = uint32(t / 3);
+			}
+		}
+
+		// Find the cost of every possible collapse.
+		collapses.clear();
+		for (size_t t = 0; t < result.size(); t += 3) {
+			for (int iEdge = 0; iEdge < 3; ++iEdge) {
+				const uint32 from = result[t + iEdge];
+				const uint32 to = result[t + (iEdge + 1) % 3];
+
+				for (const auto& edge : {std::make_pair(from, to), std::make_pair(to, from)}) {
+					if (isLocked[edge.first]) {
+						continue;
+					}
+
+					Quadric q = quadrics[edge.first];
+					q.add(quadrics[edge.second]);
+					const float error = float(q.distance(loadPosition(positions, positionsStrideBytes, edge.second)));
+					if (error <= maxError) {
+						collapses.push_back(Collapse{edge.first, edge.second, error});
+					}
+				}
+			}
+		}
+
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.error < b.error; });
+
+		for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+			remap[iVertex] = uint32(iVertex);
+		}
+		std::fill(isTouched.begin(), isTouched.end(), false);
+
+		size_t numRemovedTriangles = 0;
+		size_t numAppliedCollapses = 0;
+		for (const Collapse& collapse : collapses) {
+			if (numTriangles - numRemovedTriangles <= targetNumTriangles) {
+				break;
+			}
+
+			if (isTouched[collapse.from] || isTouched[collapse.to]) {
+				continue;
+			}
+
+			const vec3f toPosition = loadPosition(positions, positionsStrideBytes, collapse.to);
+
+			// Reject the collapse if it flips any of the remaining triangles.
+			bool isValid = true;
+			size_t numTrianglesToRemove = 0;
+			for (uint32 iAdj = adjacencyOffsets[collapse.from]; iAdj < adjacencyOffsets[collapse.from + 1]; ++iAdj) {
+				const uint32* const tri = &result[adjacency[iAdj] * 3];
+				if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to) {
+					numTrianglesToRemove++;
+					continue;
+				}
+
+				vec3f p[3];
+				vec3f pNew[3];
+				for (int iCorner = 0; iCorner < 3; ++iCorner) {
+					p[iCorner] = loadPosition(positions, positionsStrideBytes, tri[iCorner]);
+					pNew[iCorner] = (tri[iCorner] == collapse.from) ? toPosition : p[iCorner];
+				}
+
+				const vec3f normal = cross(p[1] - p[0], p[2] - p[0]);
+				const vec3f normalNew = cross(pNew[1] - pNew[0], pNew[2] - pNew[0]);
+				if (dot(normal, normalNew) <= 0.f) {
+					isValid = false;
+					break;
+				}
+			}
+
+			if (!isValid) {
+				continue;
+			}
+
+			// Apply the collapse. Lock the whole neighbourhood, as the triangles around it have changed.
+			remap[collapse.from] = collapse.to;
+			quadrics[collapse.to].add(quadrics[collapse.from]);
+			for (uint32 iAdj = adjacencyOffsets[collapse.from]; iAdj < adjacencyOffsets[collapse.from + 1]; ++iAdj) {
+				const uint32* const tri = &result[adjacency[iAdj] * 3];
+				isTouched[tri[0]] = true;
+				isTouched[tri[1]] = true;
+				isTouched[tri[2]] = true;
+			}
+
+			numRemovedTriangles += numTrianglesToRemove;
+			numAppliedCollapses++;
+			resultError = std::max(resultError, collapse.error);
+		}
+
+		if (numAppliedCollapses == 0) {
+			break;
+		}
+
+		// Apply the collapses and remove the degenerate triangles.
+		size_t numResultIndices = 0;
+		for (size_t t = 0; t < result.size(); t += 3) {
+			const uint32 a = remap[result[t + 0]];
+			const uint32 b = remap[result[t + 1]];
+			const uint32 c = remap[result[t + 2]];
+
+			if (a != b && b != c && a != c) {
+				result[numResultIndices++] = a;
+				result[numResultIndices++] = b;
+				result[numResultIndices++] = c;
+			}
+		}
+		result.resize(numResultIndices);
+	}
+
+	std::copy(result.begin(), result.end(), outIndices);
+
+	if (outError) {
+		*outError = resultError;
+	}
+
+	return result.size();
+}
+
+int MeshSimplifier::generateLods(ModelMesh& mesh, const int maxLods, const float triangleRatio, const float maxRelativeError) {
+	mesh.lods.clear();
+
+	if (mesh.primitiveTopology != PrimitiveTopology::TriangleList || mesh.vbPositionOffsetBytes < 0 || mesh.stride <= 0 ||
+	    mesh.dequantization.hasQuantizedPositions) {
+		return 0;
+	}
+
+	if (mesh.ibFmt != UniformType::Uint16 && mesh.ibFmt != UniformType::Uint) {
+		return 0;
+	}
+
+	const size_t indexSizeBytes = UniformType::GetSizeBytes(mesh.ibFmt);
+	const size_t numIndices = size_t(mesh.numElements);
+	const size_t numVertices = size_t(mesh.numVertices);
+	if (mesh.indexBufferRaw.size() < mesh.ibByteOffset + numIndices * indexSizeBytes ||
+	    mesh.vertexBufferRaw.size() < mesh.vbByteOffset + numVertices * mesh.stride) {
+		return 0;
+	}
+
+	std::vector<uint32> indices(numIndices);
+	const char* const indexData = mesh.indexBufferRaw.data() + mesh.ibByteOffset;
+	for (size_t t = 0; t < numIndices; ++t) {
+		indices[t] = (mesh.ibFmt == UniformType::Uint16) ? ((const uint16*)indexData)[t] : ((const uint32*)indexData)[t];
+	}
+
+	const char* const positions = mesh.vertexBufferRaw.data() + mesh.vbByteOffset + mesh.vbPositionOffsetBytes;
+	const float maxError = maxRelativeError * mesh.aabox.diagonal().length();
+
+	std::vector<uint32> lodIndices(numIndices);
+	size_t prevNumIndices = numIndices;
+	for (int iLod = 0; iLod < maxLods; ++iLod) {
+		const size_t targetNumIndices = size_t(float(prevNumIndices / 3) * triangleRatio) * 3;
+		if (targetNumIndices == 0) {
+			break;
+		}
+
+		// Every LOD is generated from the original mesh, so the error is relative to it.
+		float lodError = 0.f;
+		const size_t numLodIndices = simplify(lodIndices.data(), indices.data(), numIndices, positions, mesh.stride, numVertices,
+		                                      targetNumIndices, maxError, &lodError);
+
+		// Stop if the mesh could not be simplified enough to be worth it.
+		if (numLodIndices == 0 || float(numLodIndices) > float(prevNumIndices) * (1.f + triangleRatio) * 0.5f) {
+			break;
+		}
+
+		MeshOptimizer::optimizeVertexCache(lodIndices.data(), lodIndices.data(), numLodIndices, numVertices);
+
+		std::vector<char> lodIndexBuffer(numLodIndices * indexSizeBytes);
+		for (size_t t = 0; t < numLodIndices; ++t) {
+			if (mesh.ibFmt == UniformType::Uint16) {
+				((uint16*)lodIndexBuffer.data())[t] = uint16(lodIndices[t]);
+			} else {
+				((uint32*)lodIndexBuffer.data())[t] = lodIndices[t];
+			}
+		}
+
+		ModelMeshLod lod;
+		lod.indexBufferRaw = std::move(lodIndexBuffer);
+		lod.numElements = int(numLodIndices);
+		lod.error = lodError;
+		mesh.lods.emplace_back(std::move(lod));
+
+		prevNumIndices = numLodIndices;
+	}
+
+	return int(mesh.lods.size());
+}
+
+} // namespace sge
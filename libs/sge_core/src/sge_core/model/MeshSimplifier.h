@@ -0,0 +1,46 @@
+#pragma once
+
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+struct ModelMesh;
+
+/// @brief Reduces the number of triangles of triangle list meshes using edge collapses ordered by
+/// the quadric error metric (Garland and Heckbert - "Surface Simplification Using Quadric Error Metrics").
+/// Edges are collapsed into one of their existing vertices, so the simplified meshes reference the same vertex buffer
+/// as the original one and only a new index buffer is needed.
+struct SGE_CORE_API MeshSimplifier {
+	/// @brief Simplifies the specified triangle list.
+	/// Vertices on open borders and on attribute seams (different vertices sharing the same position) are never removed.
+	/// @param [out] outIndices the simplified triangle list, should have space for @numIndices elements. Could be the same as @indices.
+	/// @param [in] positions points to the position (3 floats) of the 1st vertex.
+	/// @param [in] positionsStrideBytes the byte distance between the positions of two consecutive vertices.
+	/// @param [in] targetNumIndices the desired number of indices of the result. The result might have more indices if reaching the
+	///                              target would need an error bigger than @maxError.
+	/// @param [in] maxError the maximum allowed error, measured as a distance in the units of the positions. The error of a vertex is
+	///                      its area weighted RMS distance to the planes of the original triangles merged in it, so the actual
+	///                      deviation of the surface could be slightly bigger.
+	/// @param [out] outError if not nullptr, receives the error of the result, measured as a distance.
+	/// @return the number of indices written in @outIndices.
+	static size_t simplify(uint32* const outIndices,
+	                       const uint32* const indices,
+	                       const size_t numIndices,
+	                       const char* const positions,
+	                       const size_t positionsStrideBytes,
+	                       const size_t numVertices,
+	                       const size_t targetNumIndices,
+	                       const float maxError,
+	                       float* const outError = nullptr);
+
+	/// @brief Generates the @ModelMesh::lods of the mesh. Every LOD has roughly @triangleRatio of the triangles of the previous one.
+	/// The generation stops when the mesh could not be simplified further, without exceeding the error.
+	/// Only indexed triangle lists are supported.
+	/// @param [in] maxLods the maximum number of LODs to be generated (not counting the original mesh).
+	/// @param [in] maxRelativeError the maximum error allowed for the last LOD, relative to the size of the mesh bounding box.
+	/// @return the number of generated LODs.
+	static int generateLods(ModelMesh& mesh, const int maxLods, const float triangleRatio = 0.5f, const float maxRelativeError = 0.05f);
+};
+
+} // namespace sge
@@ -1,3 +1,4 @@
+#include <atomic>
 #include <functional>
 
 #include "Model.h"
@@ -26,6 +27,14 @@ void Model::createRenderingResources(SGEDevice& sgedev) {
 				const BufferDesc ibd = BufferDesc::GetDefaultIndexBuffer((uint32)mesh->indexBufferRaw.size(), usage);
 				mesh->indexBuffer->create(ibd, mesh->indexBufferRaw.data());
 			}
+
+			for (ModelMeshLod& lod : mesh->lods) {
+				if (lod.indexBufferRaw.size() != 0) {
+					lod.indexBuffer = sgedev.requestResource<Buffer>();
+					const BufferDesc ibd = BufferDesc::GetDefaultIndexBuffer((uint32)lod.indexBufferRaw.size(), usage);
+					lod.indexBuffer->create(ibd, lod.indexBufferRaw.data());
+				}
+			}
 		}
 	}
 }
@@ -58,7 +67,7 @@ int Model::makeNewAnim() {
 	return animIndex;
 }
 
-inline void Model::setRootNodeIndex(const int newRootNodeIndex) {
+void Model::setRootNodeIndex(const int newRootNodeIndex) {
 	if (newRootNodeIndex >= 0 && newRootNodeIndex < numNodes()) {
 		m_rootNodeIndex = newRootNodeIndex;
 	} else {
@@ -83,7 +92,122 @@ const ModelNode* Model::nodeAt(int nodeIndex) const {
 	return nullptr;
 }
 
+void Model::computeNodesOrder() {
+	m_nodesParentFirstOrder.clear();
+	m_nodesParent.assign(m_nodes.size(), -1);
+
+	if (m_rootNodeIndex < 0 || m_rootNodeIndex >= numNodes()) {
+		return;
+	}
+
+	// Breadth first traversal, every node gets added after its parent.
+	// A node referenced by multiple parents (which shouldn't happen) is evaluated only for the first one.
+	std::vector<bool> isVisited(m_nodes.size(), false);
+	m_nodesParentFirstOrder.push_back(m_rootNodeIndex);
+	isVisited[m_rootNodeIndex] = true;
+
+	for (size_t iOrder = 0; iOrder < m_nodesParentFirstOrder.size(); ++iOrder) {
+		const int iNode = m_nodesParentFirstOrder[iOrder];
+		for (const int childNodeIndex : m_nodes[iNode]->childNodes) {
+			if (childNodeIndex >= 0 && childNodeIndex < numNodes() && isVisited[childNodeIndex] == false) {
+				isVisited[childNodeIndex] = true;
+				m_nodesParent[childNodeIndex] = iNode;
+				m_nodesParentFirstOrder.push_back(childNodeIndex);
+			}
+		}
+	}
+}
+
+void Model::computeNodesImportance() {
+	sgeAssert(isNodesOrderComputed());
+	m_nodesImportance.assign(m_nodes.size(), 0.f);
+
+	const auto findVertexDecl = [](const ModelMesh& mesh, const char* const semantic) -> const VertexDecl* {
+		for (const VertexDecl& decl : mesh.vertexDecl) {
+			if (decl.semantic == semantic) {
+				return &decl;
+			}
+		}
+		return nullptr;
+	};
+
+	// The weight of each node alone.
+	for (const ModelMesh* const mesh : m_meshes) {
+		const VertexDecl* const bonesIds = findVertexDecl(*mesh, "a_bonesIds");
+		const VertexDecl* const bonesWeights = findVertexDecl(*mesh, "a_bonesWeights");
+		const bool isVertexBufferValid = mesh->numVertices > 0 && mesh->stride > 0 && mesh->vbByteOffset >= 0 &&
+		                                 mesh->vertexBufferRaw.size() >= size_t(mesh->vbByteOffset) + size_t(mesh->numVertices) * size_t(mesh->stride);
+
+		if (mesh->bones.empty() || bonesIds == nullptr || bonesWeights == nullptr || bonesIds->format != UniformType::Int4 ||
+		    bonesWeights->format != UniformType::Float4 || isVertexBufferValid == false) {
+			continue;
+		}
+
+		for (int iVertex = 0; iVertex < mesh->numVertices; ++iVertex) {
+			const char* const vertex = mesh->vertexBufferRaw.data() + mesh->vbByteOffset + size_t(iVertex) * size_t(mesh->stride);
+
+			int ids[4];
+			float weights[4];
+			memcpy(ids, vertex + bonesIds->byteOffset, sizeof(ids));
+			memcpy(weights, vertex + bonesWeights->byteOffset, sizeof(weights));
+
+			for (int iInfluence = 0; iInfluence < 4; ++iInfluence) {
+				if (ids[iInfluence] >= 0 && ids[iInfluence] < int(mesh->bones.size()) && weights[iInfluence] > 0.f) {
+					const int nodeIndex = mesh->bones[ids[iInfluence]].nodeIdx;
+					if (nodeIndex >= 0 && nodeIndex < numNodes()) {
+						m_nodesImportance[nodeIndex] += weights[iInfluence];
+					}
+				}
+			}
+		}
+	}
+
+	for (int iNode = 0; iNode < numNodes(); ++iNode) {
+		for (const MeshAttachment& attachment : m_nodes[iNode]->meshAttachments) {
+			const ModelMesh* const mesh = meshAt(attachment.attachedMeshIndex);
+			if (mesh != nullptr && mesh->bones.empty()) {
+				m_nodesImportance[iNode] += float(mesh->numVertices);
+			}
+		}
+	}
+
+	// Add the weights of the children to their parents, children first.
+	float totalWeight = 0.f;
+	for (auto itr = m_nodesParentFirstOrder.rbegin(); itr != m_nodesParentFirstOrder.rend(); ++itr) {
+		const int parentIndex = m_nodesParent[*itr];
+		if (parentIndex >= 0) {
+			m_nodesImportance[parentIndex] += m_nodesImportance[*itr];
+		} else {
+			totalWeight += m_nodesImportance[*itr];
+		}
+	}
+
+	// Models without any geometry (for example animation donors) have all nodes important.
+	for (float& importance : m_nodesImportance) {
+		importance = totalWeight > 0.f ? std::min(importance / totalWeight, 1.f) : 1.f;
+	}
+}
+
+void Model::computeNodesNameLookup() {
+	static std::atomic<uint32> nextLookupId(1);
+
+	m_nodeIndexByName.clear();
+	m_nodeIndexByName.reserve(m_nodes.size());
+	for (int iNode = 0; iNode < int(m_nodes.size()); ++iNode) {
+		// Keeps the first node with the name.
+		m_nodeIndexByName.emplace(m_nodes[iNode]->name, iNode);
+	}
+
+	m_nodesNameLookupNumNodes = m_nodes.size();
+	m_nodesNameLookupId = nextLookupId++;
+}
+
 int Model::findFistNodeIndexWithName(const std::string& name) const {
+	if (isNodesNameLookupComputed()) {
+		const auto itr = m_nodeIndexByName.find(name);
+		return itr != m_nodeIndexByName.end() ? itr->second : -1;
+	}
+
 	for (int t = 0; t < int(m_nodes.size()); ++t) {
 		if (m_nodes[t]->name == name) {
 			return t;
@@ -155,79 +279,4 @@ int Model::getAnimationIndexByName(const std::string& name) const {
 	return -1;
 }
 
-void KeyFrames::evaluate(transf3d& result, const float t) const {
-	// Evaluate the translation.
-	if (positionKeyFrames.empty() == false) {
-		const auto& keyItr = positionKeyFrames.upper_bound(t);
-		if (keyItr == positionKeyFrames.end()) {
-			result.p = positionKeyFrames.rbegin()->second;
-		} else {
-			const auto& prevKeyItr = std::prev(keyItr);
-
-			if (prevKeyItr == positionKeyFrames.end()) {
-				result.p = keyItr->second;
-			} else {
-				const float t0 = prevKeyItr->first;
-				const float t1 = keyItr->first;
-				const float dt = t1 - t0;
-
-				if (dt > 1e-6f) {
-					result.p = lerp(prevKeyItr->second, keyItr->second, (t - t0) / dt);
-				} else {
-					result.p = keyItr->second;
-				}
-			}
-		}
-	}
-
-	// Evaluate the translation.
-	if (rotationKeyFrames.empty() == false) {
-		const auto& keyItr = rotationKeyFrames.upper_bound(t);
-		if (keyItr == rotationKeyFrames.end()) {
-			result.r = rotationKeyFrames.rbegin()->second;
-		} else {
-			const auto& prevKeyItr = std::prev(keyItr);
-
-			if (prevKeyItr == rotationKeyFrames.end()) {
-				result.r = keyItr->second;
-			} else {
-				const float t0 = prevKeyItr->first;
-				const float t1 = keyItr->first;
-				const float dt = t1 - t0;
-
-				if (dt > 1e-6f) {
-					result.r = lerp(prevKeyItr->second, keyItr->second, (t - t0) / dt);
-				} else {
-					result.r = keyItr->second;
-				}
-			}
-		}
-	}
-
-
-	// Evaluate the scaling.
-	if (scalingKeyFrames.empty() == false) {
-		const auto& keyItr = scalingKeyFrames.upper_bound(t);
-		if (keyItr == scalingKeyFrames.end()) {
-			result.s = scalingKeyFrames.rbegin()->second;
-		} else {
-			const auto& prevKeyItr = std::prev(keyItr);
-
-			if (prevKeyItr == scalingKeyFrames.end()) {
-				result.s = keyItr->second;
-			} else {
-				const float t0 = prevKeyItr->first;
-				const float t1 = keyItr->first;
-				const float dt = t1 - t0;
-
-				if (dt > 1e-6f) {
-					result.s = lerp(prevKeyItr->second, keyItr->second, (t - t0) / dt);
-				} else {
-					result.s = keyItr->second;
-				}
-			}
-		}
-	}
-}
-
 } // namespace sge
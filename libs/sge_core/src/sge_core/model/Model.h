@@ -1,7 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "sge_core/Geometry.h"
 #include "sge_core/sgecore_api.h"
 #include "sge_renderer/renderer/renderer.h"
 #include "sge_utils/math/Box.h"
@@ -9,6 +13,7 @@
 #include "sge_utils/math/primitives.h"
 #include "sge_utils/math/transform.h"
 #include "sge_utils/utils/ChunkContainer.h"
+#include "sge_utils/utils/RawBuffer.h"
 
 #include "CollisionMesh.h"
 
@@ -98,6 +103,16 @@ struct ModelMeshBone {
 	int nodeIdx = -1;                          ///< The index of the node representing this bone transformation.
 };
 
+/// A lower detail version of a @ModelMesh. It uses the vertices of the mesh with its own smaller index buffer.
+struct ModelMeshLod {
+	RawBuffer indexBufferRaw; ///< The indices of the LOD in the format of the mesh index buffer, might point directly in the model file.
+	int numElements = 0;      ///< The number of indices used by this LOD.
+	float error = 0.f;        ///< The geometric error compared to the original mesh, a distance in the units of the mesh.
+
+	// The member below is available only if @Model::createRenderingResources gets called:
+	GpuHandle<Buffer> indexBuffer;
+};
+
 struct SGE_CORE_API ModelMesh {
 	std::string name; ///< The name of the mesh.
 
@@ -119,13 +134,17 @@ struct SGE_CORE_API ModelMesh {
 	int vbBonesIdsBytesOffset = -1;
 	int vbBonesWeightsByteOffset = -1;
 
-	std::vector<char> vertexBufferRaw; ///< The raw data containing all vertices in the vertex buffer,
-	std::vector<char> indexBufferRaw;  ///< The raw data containing all indices in the vertex buffer,
+	RawBuffer vertexBufferRaw; ///< The raw data containing all vertices in the vertex buffer, might point directly in the model file.
+	RawBuffer indexBufferRaw;  ///< The raw data containing all indices in the vertex buffer, might point directly in the model file.
 
 	AABox3f aabox; ///< The bounding box around the vertices of the mesh, without any deformation by skinning or anything else.
 
+	VertexDequantization dequantization; ///< Describes how to decode the vertex attributes if they are quantized. See @MeshQuantizer.
+
 	std::vector<ModelMeshBone> bones; ///< A list of bones affecting the mesh.
 
+	std::vector<ModelMeshLod> lods; ///< Lower detail versions of the mesh, ordered from the most detailed one. See @MeshSimplifier.
+
 	// The member below are available only if @Model::createRenderingResources gets called:
 
 	GpuHandle<Buffer> vertexBuffer;    ///< The vertex buffer to be used for rendering of that mesh.
@@ -145,26 +164,255 @@ struct MeshAttachment {
 	int attachedMaterialIndex = -1;
 };
 
+/// @brief Returns the index of the first key with time bigger than @t (just like std::upper_bound) in the sorted key @times.
+/// @param [in,out] cursor a hint from the previous sampling of the channel. When the time moves forward
+///                 (the usual animation playback) the key is found in O(1), otherwise a binary search is used.
+inline int findNextKeyFrame(const std::vector<float>& times, const float t, int& cursor) {
+	const int numKeys = int(times.size());
+	int nextKey;
+	if (cursor >= 0 && cursor < numKeys && times[cursor] <= t) {
+		if (cursor + 1 >= numKeys || t < times[cursor + 1]) {
+			nextKey = cursor + 1;
+		} else if (cursor + 2 >= numKeys || t < times[cursor + 2]) {
+			nextKey = cursor + 2;
+		} else {
+			nextKey = int(std::upper_bound(times.begin() + cursor + 2, times.end(), t) - times.begin());
+		}
+	} else {
+		nextKey = int(std::upper_bound(times.begin(), times.end(), t) - times.begin());
+	}
+
+	cursor = maxOf(nextKey - 1, 0);
+	return nextKey;
+}
+
+/// @brief The key frames of a single animated property (position, rotation or scaling) of a node.
+/// The times and the values are stored in separate arrays sorted by time, so sampling touches only the memory it needs.
+template <typename T>
+struct KeyFrameChannel {
+	bool empty() const { return times.empty(); }
+	size_t size() const { return times.size(); }
+
+	/// @brief Adds a key frame keeping the keys sorted, if there is already a key at that time it gets replaced.
+	/// Adding the keys in increasing time order is the fast path.
+	void setKey(const float time, const T& value) {
+		if (times.empty() || time > times.back()) {
+			times.push_back(time);
+			values.push_back(value);
+			return;
+		}
+
+		const size_t idx = size_t(std::lower_bound(times.begin(), times.end(), time) - times.begin());
+		if (times[idx] == time) {
+			values[idx] = value;
+		} else {
+			times.insert(times.begin() + idx, time);
+			values.insert(values.begin() + idx, value);
+		}
+	}
+
+	/// @brief Returns the index of the first key with time bigger than @t (just like std::upper_bound).
+	/// See @findNextKeyFrame.
+	int findNextKey(const float t, int& cursor) const { return findNextKeyFrame(times, t, cursor); }
+
+	/// @brief Samples the channel at the specified time. The channel must not be empty.
+	/// Times outside of the key frames range use the first or the last key.
+	T sample(const float t, int& cursor) const {
+		sgeAssert(empty() == false);
+		const int nextKey = findNextKey(t, cursor);
+		if (nextKey >= int(times.size())) {
+			return values.back();
+		}
+
+		if (nextKey == 0) {
+			return values[0];
+		}
+
+		const float t0 = times[nextKey - 1];
+		const float t1 = times[nextKey];
+		const float dt = t1 - t0;
+
+		if (dt > 1e-6f) {
+			return lerp(values[nextKey - 1], values[nextKey], (t - t0) / dt);
+		}
+
+		return values[nextKey];
+	}
+
+  public:
+	std::vector<float> times; ///< The time of each key frame, sorted in increasing order.
+	std::vector<T> values;    ///< The value of each key frame, matching @times.
+};
+
+/// @brief Decoding of the key frame values quantized by @AnimationCompressor. Every key is stored in 3 x 16 bits.
+struct KeyFrameQuantization {
+	/// Positions and scalings are stored as unsigned normalized integers relative to the range of values in the channel.
+	static vec3f dequantizeVec3(const uint16* const q, const vec3f& rangeMin, const vec3f& rangeExtent) {
+		const vec3f unorm = vec3f(float(q[0]), float(q[1]), float(q[2]));
+		return rangeMin + unorm * (1.f / 65535.f) * rangeExtent;
+	}
+
+	/// @brief Rotations use the "smallest three" encoding in 48 bits: the largest component of the quaternion is dropped and
+	/// recomputed from the other three, which are in [-1/sqrt(2);1/sqrt(2)] and get stored in 15 bits each.
+	/// The lowest bit of each 16 bit value holds the index of the dropped component (2 bits) and its sign,
+	/// so the decoded quaternion is in the same hemisphere as the original.
+	static quatf dequantizeQuat(const uint16* const q) {
+		const int droppedIndex = (q[0] & 1) | ((q[1] & 1) << 1);
+		const bool isDroppedNegative = (q[2] & 1) != 0;
+
+		quatf result;
+		float sumSq = 0.f;
+		for (int iComp = 0, iStored = 0; iComp < 4; ++iComp) {
+			if (iComp != droppedIndex) {
+				const float unorm = float(q[iStored] >> 1) * (1.f / 32767.f);
+				result.data[iComp] = (unorm * 2.f - 1.f) * 0.70710678f;
+				sumSq += result.data[iComp] * result.data[iComp];
+				++iStored;
+			}
+		}
+
+		const float dropped = sqrtf(maxOf(1.f - sumSq, 0.f));
+		result.data[droppedIndex] = isDroppedNegative ? -dropped : dropped;
+		return result;
+	}
+};
+
+/// @brief The key frames of a channel compressed with @AnimationCompressor.
+/// The values stay quantized in memory (see @KeyFrameQuantization) and get decoded when the channel gets sampled.
+/// T is vec3f for positions and scalings and quatf for rotations.
+template <typename T>
+struct CompressedKeyFrameChannel {
+	bool empty() const { return times.empty(); }
+	size_t size() const { return times.size(); }
+
+	/// Decodes the value of the specified key.
+	T getKey(const int iKey) const;
+
+	/// @brief Samples the channel exactly like @KeyFrameChannel::sample. The channel must not be empty.
+	T sample(const float t, int& cursor) const {
+		sgeAssert(empty() == false);
+		const int nextKey = findNextKeyFrame(times, t, cursor);
+		if (nextKey >= int(times.size())) {
+			return getKey(int(times.size()) - 1);
+		}
+
+		if (nextKey == 0) {
+			return getKey(0);
+		}
+
+		const float t0 = times[nextKey - 1];
+		const float t1 = times[nextKey];
+		const float dt = t1 - t0;
+
+		if (dt > 1e-6f) {
+			return lerp(getKey(nextKey - 1), getKey(nextKey), (t - t0) / dt);
+		}
+
+		return getKey(nextKey);
+	}
+
+  public:
+	std::vector<float> times;            ///< The time of each key frame, sorted in increasing order.
+	std::vector<uint16> quantizedValues; ///< 3 values per key frame, matching @times.
+	vec3f rangeMin = vec3f(0.f);         ///< The smallest value in the channel, unused for rotations.
+	vec3f rangeExtent = vec3f(0.f);      ///< The size of the range of values in the channel, unused for rotations.
+};
+
+template <>
+inline vec3f CompressedKeyFrameChannel<vec3f>::getKey(const int iKey) const {
+	return KeyFrameQuantization::dequantizeVec3(&quantizedValues[size_t(iKey) * 3], rangeMin, rangeExtent);
+}
+
+template <>
+inline quatf CompressedKeyFrameChannel<quatf>::getKey(const int iKey) const {
+	return KeyFrameQuantization::dequantizeQuat(&quantizedValues[size_t(iKey) * 3]);
+}
+
+/// @brief The sampling hints for @KeyFrames, one per channel. Each playback of an animation
+/// should have its own cursors for each node, see @KeyFrameChannel::findNextKey.
+struct KeyFramesCursor {
+	int position = 0;
+	int rotation = 0;
+	int scaling = 0;
+};
+
+/// @brief The key frames of a node in an animation. Each channel is stored either in full floats
+/// or compressed (see @AnimationCompressor), never both.
 struct KeyFrames {
-	std::map<float, vec3f> positionKeyFrames;
-	std::map<float, quatf> rotationKeyFrames;
-	std::map<float, vec3f> scalingKeyFrames;
+	KeyFrameChannel<vec3f> positionKeyFrames;
+	KeyFrameChannel<quatf> rotationKeyFrames;
+	KeyFrameChannel<vec3f> scalingKeyFrames;
+
+	CompressedKeyFrameChannel<vec3f> compressedPositionKeyFrames;
+	CompressedKeyFrameChannel<quatf> compressedRotationKeyFrames;
+	CompressedKeyFrameChannel<vec3f> compressedScalingKeyFrames;
+
+	bool empty() const {
+		return positionKeyFrames.empty() && rotationKeyFrames.empty() && scalingKeyFrames.empty() &&
+		       compressedPositionKeyFrames.empty() && compressedRotationKeyFrames.empty() && compressedScalingKeyFrames.empty();
+	}
+
+	/// @brief Evaluates the animated channels, the channels without key frames are left unchanged in @result.
+	void evaluate(transf3d& result, const float t, KeyFramesCursor& cursor) const {
+		if (positionKeyFrames.empty() == false) {
+			result.p = positionKeyFrames.sample(t, cursor.position);
+		} else if (compressedPositionKeyFrames.empty() == false) {
+			result.p = compressedPositionKeyFrames.sample(t, cursor.position);
+		}
+
+		if (rotationKeyFrames.empty() == false) {
+			result.r = rotationKeyFrames.sample(t, cursor.rotation);
+		} else if (compressedRotationKeyFrames.empty() == false) {
+			result.r = compressedRotationKeyFrames.sample(t, cursor.rotation);
+		}
+
+		if (scalingKeyFrames.empty() == false) {
+			result.s = scalingKeyFrames.sample(t, cursor.scaling);
+		} else if (compressedScalingKeyFrames.empty() == false) {
+			result.s = compressedScalingKeyFrames.sample(t, cursor.scaling);
+		}
+	}
 
-	void evaluate(transf3d& result, const float t) const;
+	void evaluate(transf3d& result, const float t) const {
+		KeyFramesCursor cursor;
+		evaluate(result, t, cursor);
+	}
 };
 
 struct ModelAnimation {
 	ModelAnimation() = default;
 
-	ModelAnimation(std::string animationName, float durationSec, std::map<int, KeyFrames> perNodeKeyFrames)
+	ModelAnimation(std::string animationName, float durationSec, std::vector<KeyFrames> perNodeKeyFrames)
 	    : animationName(std::move(animationName))
 	    , durationSec(durationSec)
 	    , perNodeKeyFrames(std::move(perNodeKeyFrames)) {}
 
+	/// Returns the key frames of the specified node or nullptr if the node isn't animated.
+	const KeyFrames* getKeyFramesForNode(const int nodeIndex) const {
+		if (nodeIndex >= 0 && nodeIndex < int(perNodeKeyFrames.size()) && perNodeKeyFrames[nodeIndex].empty() == false) {
+			return &perNodeKeyFrames[nodeIndex];
+		}
+		return nullptr;
+	}
+
+	/// Returns the key frames of the specified node, used when building the animation.
+	KeyFrames& getOrAddKeyFramesForNode(const int nodeIndex) {
+		sgeAssert(nodeIndex >= 0);
+		if (nodeIndex >= int(perNodeKeyFrames.size())) {
+			perNodeKeyFrames.resize(nodeIndex + 1);
+		}
+		return perNodeKeyFrames[nodeIndex];
+	}
+
 	bool evaluateForNode(transf3d& outTransform, const int nodeIndex, const float time) const {
-		auto itr = perNodeKeyFrames.find(nodeIndex);
-		if (itr != perNodeKeyFrames.end()) {
-			itr->second.evaluate(outTransform, time);
+		KeyFramesCursor cursor;
+		return evaluateForNode(outTransform, nodeIndex, time, cursor);
+	}
+
+	/// @brief Evaluates the node with a sampling hint, see @KeyFramesCursor. Returns false if the node isn't animated.
+	bool evaluateForNode(transf3d& outTransform, const int nodeIndex, const float time, KeyFramesCursor& cursor) const {
+		if (const KeyFrames* const keyFrames = getKeyFramesForNode(nodeIndex)) {
+			keyFrames->evaluate(outTransform, time, cursor);
 			return true;
 		}
 		return false;
@@ -178,8 +426,9 @@ struct ModelAnimation {
 	/// The artist might need them for interpolation purposes.
 	float durationSec = 0;
 
-	/// The keyframes of all affected nodes in their local space (relative to their parents).
-	std::map<int, KeyFrames> perNodeKeyFrames;
+	/// The keyframes of all affected nodes in their local space (relative to their parents), indexed by node index.
+	/// Nodes that are not animated have empty key frames, the array might be smaller than the number of nodes.
+	std::vector<KeyFrames> perNodeKeyFrames;
 };
 
 struct ModelNode {
@@ -213,8 +462,52 @@ struct SGE_CORE_API Model {
 	const ModelNode* getRootNode() const { return nodeAt(getRootNodeIndex()); }
 
 	int numNodes() const { return int(m_nodes.size()); }
+
+	/// @brief Computes @getNodesParentFirstOrder and @getNodeParentIndex from the current node hierarchy.
+	/// Needs to be called when the hierarchy changes, the model readers call it after loading.
+	void computeNodesOrder();
+
+	/// Returns the nodes reachable from the root, ordered so that every node comes after its parent.
+	/// Evaluating the nodes in that order needs no recursion. See @computeNodesOrder.
+	const std::vector<int>& getNodesParentFirstOrder() const { return m_nodesParentFirstOrder; }
+
+	/// Returns the index of the parent of the specified node, -1 for the root or for nodes not reachable from it.
+	int getNodeParentIndex(const int nodeIndex) const { return m_nodesParent[nodeIndex]; }
+
+	/// Returns true if @computeNodesOrder was called after the last added node.
+	bool isNodesOrderComputed() const { return m_nodesParent.size() == m_nodes.size(); }
+
+	/// @brief Computes @getNodesImportance from the skinning weights of the meshes. Needs @computeNodesOrder to be called first.
+	/// The model readers call it after loading.
+	void computeNodesImportance();
+
+	/// @brief Returns how much of the model each node moves, in [0;1]. It is the sum of the skinning weights of all vertices
+	/// affected by the node and its children (vertices of non-skinned meshes count for the node they are attached to),
+	/// divided by the total for the whole model. Parents are always at least as important as their children.
+	/// Nodes that move no vertices at all (sockets, attachment points) have 0 importance.
+	/// Used to skip the sampling of the less important nodes of distant models, see @AnimationLodState.
+	const std::vector<float>& getNodesImportance() const { return m_nodesImportance; }
+
+	/// Returns true if @computeNodesImportance was called after the last added node.
+	bool isNodesImportanceComputed() const { return m_nodesImportance.size() == m_nodes.size(); }
+
+	/// @brief Computes the hashed table used by @findFistNodeIndexWithName. The model readers call it after loading.
+	/// Needs to be called again when nodes get added or renamed.
+	void computeNodesNameLookup();
+
+	/// Returns true if @computeNodesNameLookup was called after the last added node.
+	bool isNodesNameLookupComputed() const { return m_nodesNameLookupId != 0 && m_nodesNameLookupNumNodes == m_nodes.size(); }
+
+	/// Returns a unique id of the last @computeNodesNameLookup, 0 if it was never called. As the id changes every time the lookup
+	/// gets computed, it identifies the current names of the nodes. Used as a key for caching the data based on them,
+	/// see @AnimationRetargetCache.
+	uint32 getNodesNameLookupId() const { return m_nodesNameLookupId; }
+
 	ModelNode* nodeAt(int nodeIndex);
 	const ModelNode* nodeAt(int nodeIndex) const;
+
+	/// Returns the index of the first node with the specified name, -1 if there isn't one.
+	/// Uses the table computed by @computeNodesNameLookup if it is up to date, otherwise searches all nodes.
 	int findFistNodeIndexWithName(const std::string& name) const;
 
 	int numMaterials() const { return int(m_materials.size()); }
@@ -245,6 +538,18 @@ struct SGE_CORE_API Model {
 	std::vector<ModelMesh*> m_meshes;
 	std::vector<ModelMaterial*> m_materials;
 
+	/// See @computeNodesOrder.
+	std::vector<int> m_nodesParentFirstOrder;
+	std::vector<int> m_nodesParent;
+
+	/// See @computeNodesImportance.
+	std::vector<float> m_nodesImportance;
+
+	/// See @computeNodesNameLookup.
+	std::unordered_map<std::string, int> m_nodeIndexByName;
+	size_t m_nodesNameLookupNumNodes = 0;
+	uint32 m_nodesNameLookupId = 0;
+
 	/// The actual storage for the model data.
 	ChunkContainer<ModelMesh> m_containerMesh;
 	ChunkContainer<ModelMaterial> m_containerMaterial;
@@ -0,0 +1,346 @@
+#pragma once
+
+#include "sge_renderer/renderer/GraphicsCommon.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+/// @brief Describes the binary layout of the version 2 *.mdl files.
+///
+/// The file consists of:
+///    - a fixed size @FileHeader,
+///    - a chunk table of @FileHeader::numChunks @ChunkDesc elements,
+///    - the chunks data, each chunk starts at an offset aligned to @kChunkAlignment.
+///
+/// Chunks are referenced by their index in the chunk table.
+/// Everything describing the model (nodes, meshes, materials, animations) is stored as plain arrays of the structs below,
+/// so the file could be memory mapped and used directly without any parsing.
+/// All strings are stored in a single @chunkType_strings chunk, and they are referenced by their byte offset in it.
+/// All indices to chunks are -1 if the chunk is missing.
+///
+/// Version 1 files (a json header followed by the raw data) are still supported by @ModelReader.
+namespace ModelFileV2 {
+
+	static constexpr char kMagic[8] = {'S', 'G', 'E', 'M', 'D', 'L', '\0', '2'};
+	static constexpr uint32 kVersion = 2;
+	static constexpr size_t kChunkAlignment = 16;
+	static constexpr uint32 kNoString = 0xFFFFFFFF;
+
+	enum ChunkType : uint32 {
+		chunkType_raw, ///< Vertex/index buffers, key frames and any other data referenced by index from the other chunks.
+		chunkType_strings,
+		chunkType_nodes,
+		chunkType_nodeMeshAttachments,
+		chunkType_nodeChildren,
+		chunkType_materials,
+		chunkType_meshes,
+		chunkType_vertexDecls,
+		chunkType_bones,
+		chunkType_animations,
+		chunkType_animationTracks,
+		chunkType_convexHulls,
+		chunkType_concaveHulls,
+		chunkType_collisionBoxes,
+		chunkType_collisionCapsules,
+		chunkType_collisionCylinders,
+		chunkType_collisionSpheres,
+		chunkType_meshLods,
+		chunkType_quantizedKeyFrames, ///< The values of a compressed animation channel, see @QuantizedKeyFramesHeader.
+
+		chunkType_count,
+	};
+
+	/// Formats of the vertex attributes and indices. These values are written to the file so do not reorder them.
+	enum DataFormat : sint32 {
+		dataFormat_unknown = 0,
+		dataFormat_float = 1,
+		dataFormat_float2 = 2,
+		dataFormat_float3 = 3,
+		dataFormat_float4 = 4,
+		dataFormat_int = 5,
+		dataFormat_int2 = 6,
+		dataFormat_int3 = 7,
+		dataFormat_int4 = 8,
+		dataFormat_uint16 = 9,
+		dataFormat_uint32 = 10,
+		dataFormat_short2Snorm = 11,  ///< Quantized values, see @MeshQuantizer.
+		dataFormat_ushort2Unorm = 12, ///< Quantized values, see @MeshQuantizer.
+		dataFormat_ushort4Unorm = 13, ///< Quantized values, see @MeshQuantizer.
+	};
+
+	/// Flags describing which vertex attributes of a mesh are quantized. See @MeshQuantizer.
+	enum QuantizationFlags : uint32 {
+		quantizationFlags_positions = 1 << 0,
+		quantizationFlags_octahedralNormals = 1 << 1,
+	};
+
+	/// Primitive topologies. These values are written to the file so do not reorder them.
+	enum Topology : sint32 {
+		topology_unknown = 0,
+		topology_triangleList = 1,
+		topology_triangleStrip = 2,
+		topology_lineList = 3,
+		topology_lineStrip = 4,
+		topology_pointList = 5,
+	};
+
+	struct FileHeader {
+		char magic[8];
+		uint32 version;
+		uint32 numChunks;
+		uint64 chunkTableByteOffset;
+		sint32 rootNodeIndex;
+		uint32 reserved;
+	};
+	static_assert(sizeof(FileHeader) == 32, "The file header must be 32 bytes");
+
+	struct ChunkDesc {
+		uint32 type;
+		uint32 reserved;
+		uint64 byteOffset; ///< The offset from the begining of the file.
+		uint64 sizeBytes;
+		uint64 reserved2;
+	};
+	static_assert(sizeof(ChunkDesc) == 32, "The chunk desc must be 32 bytes");
+
+	struct Transform {
+		float p[3];
+		float r[4];
+		float s[3];
+	};
+
+	struct Node {
+		uint32 name;
+		Transform staticLocalTransform;
+		float limbLength;
+		uint32 firstMeshAttachment;
+		uint32 numMeshAttachments;
+		uint32 firstChild;
+		uint32 numChildren;
+	};
+
+	struct NodeMeshAttachment {
+		sint32 meshIndex;
+		sint32 materialIndex;
+	};
+
+	struct Material {
+		uint32 name;
+		float diffuseColor[4];
+		float emissionColor[4];
+		float metallic;
+		float roughness;
+		uint32 diffuseTextureName;
+		uint32 emissionTextureName;
+		uint32 normalTextureName;
+		uint32 metallicTextureName;
+		uint32 roughnessTextureName;
+	};
+
+	struct Mesh {
+		uint32 name;
+		sint32 primitiveTopology;
+		sint32 vbByteOffset;
+		sint32 ibByteOffset;
+		sint32 ibFormat;
+		sint32 numElements;
+		sint32 numVertices;
+		sint32 vertexDataChunk;
+		sint32 indexDataChunk;
+		uint32 firstVertexDecl;
+		uint32 numVertexDecls;
+		uint32 firstBone;
+		uint32 numBones;
+		float aaboxMin[3];
+		float aaboxMax[3];
+		uint32 firstLod;
+		uint32 numLods;
+		float positionDequantScale[3];
+		float positionDequantOffset[3];
+		float uvDequantScale[2];
+		float uvDequantOffset[2];
+		uint32 quantizationFlags; ///< A combination of @QuantizationFlags.
+	};
+
+	/// A lower detail index buffer of a mesh, using the vertices and the index format of the mesh.
+	struct MeshLod {
+		sint32 indexDataChunk;
+		sint32 numElements;
+		float error;
+		uint32 reserved;
+	};
+
+	struct VertexDecl {
+		uint32 semantic;
+		sint32 byteOffset;
+		sint32 format;
+	};
+
+	struct Bone {
+		float offsetMatrix[16]; ///< Column major, as in @mat4f.
+		sint32 nodeIndex;
+	};
+
+	struct Animation {
+		uint32 name;
+		float durationSec;
+		uint32 firstTrack;
+		uint32 numTracks;
+	};
+
+	/// The key frames of a single node in an animation.
+	/// Each channel is stored in two chunks, a sorted array of key times followed by an array of values.
+	/// The values of channels compressed with @AnimationCompressor are stored in a @chunkType_quantizedKeyFrames chunk.
+	struct AnimationTrack {
+		sint32 nodeIndex;
+		sint32 positionTimesChunk;
+		sint32 positionValuesChunk; ///< vec3f values.
+		sint32 rotationTimesChunk;
+		sint32 rotationValuesChunk; ///< quatf values.
+		sint32 scalingTimesChunk;
+		sint32 scalingValuesChunk; ///< vec3f values.
+	};
+
+	/// The header of a @chunkType_quantizedKeyFrames chunk, followed by 3 uint16 values per key frame.
+	/// See @KeyFrameQuantization for the encoding, the range is not used for rotations.
+	struct QuantizedKeyFramesHeader {
+		float rangeMin[3];
+		float rangeExtent[3];
+		uint32 numKeys;
+		uint32 reserved;
+	};
+	static_assert(sizeof(QuantizedKeyFramesHeader) == 32, "The quantized key frames header must be 32 bytes");
+
+	struct CollisionHull {
+		sint32 verticesChunk; ///< vec3f values.
+		sint32 indicesChunk;  ///< int values.
+	};
+
+	struct CollisionBox {
+		uint32 name;
+		Transform transform;
+		float halfDiagonal[3];
+	};
+
+	struct CollisionCapsule {
+		uint32 name;
+		Transform transform;
+		float halfHeight;
+		float radius;
+	};
+
+	struct CollisionCylinder {
+		uint32 name;
+		Transform transform;
+		float halfDiagonal[3];
+	};
+
+	struct CollisionSphere {
+		uint32 name;
+		Transform transform;
+		float radius;
+	};
+
+	inline DataFormat dataFormatFromUniformType(const UniformType::Enum type) {
+		switch (type) {
+			case UniformType::Float:
+				return dataFormat_float;
+			case UniformType::Float2:
+				return dataFormat_float2;
+			case UniformType::Float3:
+				return dataFormat_float3;
+			case UniformType::Float4:
+				return dataFormat_float4;
+			case UniformType::Int:
+				return dataFormat_int;
+			case UniformType::Int2:
+				return dataFormat_int2;
+			case UniformType::Int3:
+				return dataFormat_int3;
+			case UniformType::Int4:
+				return dataFormat_int4;
+			case UniformType::Uint16:
+				return dataFormat_uint16;
+			case UniformType::Uint:
+				return dataFormat_uint32;
+			case UniformType::Short2_Snorm_IA:
+				return dataFormat_short2Snorm;
+			case UniformType::Ushort2_Unorm_IA:
+				return dataFormat_ushort2Unorm;
+			case UniformType::Ushort4_Unorm_IA:
+				return dataFormat_ushort4Unorm;
+			default:
+				return dataFormat_unknown;
+		}
+	}
+
+	inline UniformType::Enum uniformTypeFromDataFormat(const sint32 format) {
+		switch (format) {
+			case dataFormat_float:
+				return UniformType::Float;
+			case dataFormat_float2:
+				return UniformType::Float2;
+			case dataFormat_float3:
+				return UniformType::Float3;
+			case dataFormat_float4:
+				return UniformType::Float4;
+			case dataFormat_int:
+				return UniformType::Int;
+			case dataFormat_int2:
+				return UniformType::Int2;
+			case dataFormat_int3:
+				return UniformType::Int3;
+			case dataFormat_int4:
+				return UniformType::Int4;
+			case dataFormat_uint16:
+				return UniformType::Uint16;
+			case dataFormat_uint32:
+				return UniformType::Uint;
+			case dataFormat_short2Snorm:
+				return UniformType::Short2_Snorm_IA;
+			case dataFormat_ushort2Unorm:
+				return UniformType::Ushort2_Unorm_IA;
+			case dataFormat_ushort4Unorm:
+				return UniformType::Ushort4_Unorm_IA;
+			default:
+				return UniformType::Unknown;
+		}
+	}
+
+	inline Topology topologyFromPrimitiveTopology(const PrimitiveTopology::Enum topology) {
+		switch (topology) {
+			case PrimitiveTopology::TriangleList:
+				return topology_triangleList;
+			case PrimitiveTopology::TriangleStrip:
+				return topology_triangleStrip;
+			case PrimitiveTopology::LineList:
+				return topology_lineList;
+			case PrimitiveTopology::LineStrip:
+				return topology_lineStrip;
+			case PrimitiveTopology::PointList:
+				return topology_pointList;
+			default:
+				return topology_unknown;
+		}
+	}
+
+	inline PrimitiveTopology::Enum primitiveTopologyFromTopology(const sint32 topology) {
+		switch (topology) {
+			case topology_triangleList:
+				return PrimitiveTopology::TriangleList;
+			case topology_triangleStrip:
+				return PrimitiveTopology::TriangleStrip;
+			case topology_lineList:
+				return PrimitiveTopology::LineList;
+			case topology_lineStrip:
+				return PrimitiveTopology::LineStrip;
+			case topology_pointList:
+				return PrimitiveTopology::PointList;
+			default:
+				return PrimitiveTopology::Unknown;
+		}
+	}
+
+} // namespace ModelFileV2
+
+} // namespace sge
@@ -1,9 +1,11 @@
+#include "sge_utils/utils/MemoryMappedFile.h"
 #include "sge_utils/utils/vector_map.h"
 #include <sge_utils/utils/FileStream.h>
 #include <sge_utils/utils/json.h>
 #include <stdexcept>
 
 #include "Model.h"
+#include "ModelFileFormat.h"
 #include "ModelReader.h"
 
 namespace sge {
@@ -123,7 +125,7 @@ const ModelReader::DataChunkDesc& ModelReader::FindDataChunkDesc(const int chunk
 	throw ModelParseExcept("Chunk desc not found!");
 }
 
-bool ModelReader::loadModel(const ModelLoadSettings loadSets, IReadStream* const iReadStream, Model& model) {
+bool ModelReader::loadModelV1(const ModelLoadSettings& loadSets, IReadStream* const iReadStream, Model& model) {
 	try {
 		dataChunksDesc.clear();
 		irs = iReadStream;
@@ -146,6 +148,11 @@ bool ModelReader::loadModel(const ModelLoadSettings loadSets, IReadStream* const
 
 		const JsonValue* const jRoot = jsonParser.getRoot();
 
+		// Older files have a different layout that we no longer support.
+		if (jRoot->getMember("dataChunksDesc") == nullptr || jRoot->getMember("rootNodeIndex") == nullptr) {
+			throw ModelParseExcept("Unsupported model file layout!");
+		}
+
 		// Load the data chunk desc.
 		{
 			const JsonValue* const jDataChunksDesc = jRoot->getMember("dataChunksDesc");
@@ -192,7 +199,7 @@ bool ModelReader::loadModel(const ModelLoadSettings loadSets, IReadStream* const
 						std::vector<char> chunkMemory(chunkDesc.sizeBytes);
 						loadDataChunkRaw(chunkMemory.data(), chunkMemory.size() * sizeof(chunkMemory[0]), chunkId);
 
-						const int valueTypeSizeBytes = sizeof(animation.perNodeKeyFrames[0].positionKeyFrames[0.f]);
+						const int valueTypeSizeBytes = sizeof(vec3f);
 
 						const int numPairsInChunk = int(chunkDesc.sizeBytes / (sizeof(float) + valueTypeSizeBytes));
 						const char* readPtr = chunkMemory.data();
@@ -202,7 +209,7 @@ bool ModelReader::loadModel(const ModelLoadSettings loadSets, IReadStream* const
 							const vec3f keyData = *(vec3f*)(readPtr);
 							readPtr += valueTypeSizeBytes;
 
-							animation.perNodeKeyFrames[nodeIndex].positionKeyFrames[keyTime] = keyData;
+							animation.getOrAddKeyFramesForNode(nodeIndex).positionKeyFrames.setKey(keyTime, keyData);
 						}
 					}
 
@@ -214,7 +221,7 @@ bool ModelReader::loadModel(const ModelLoadSettings loadSets, IReadStream* const
 						std::vector<char> chunkMemory(chunkDesc.sizeBytes);
 						loadDataChunkRaw(chunkMemory.data(), chunkMemory.size() * sizeof(chunkMemory[0]), chunkId);
 
-						const int valueTypeSizeBytes = sizeof(animation.perNodeKeyFrames[0].rotationKeyFrames[0.f]);
+						const int valueTypeSizeBytes = sizeof(quatf);
 
 						const int numPairsInChunk = int(chunkDesc.sizeBytes / (sizeof(float) + valueTypeSizeBytes));
 						const char* readPtr = chunkMemory.data();
@@ -224,7 +231,7 @@ bool ModelReader::loadModel(const ModelLoadSettings loadSets, IReadStream* const
 							const quatf keyData = *(quatf*)(readPtr);
 							readPtr += valueTypeSizeBytes;
 
-							animation.perNodeKeyFrames[nodeIndex].rotationKeyFrames[keyTime] = keyData;
+							animation.getOrAddKeyFramesForNode(nodeIndex).rotationKeyFrames.setKey(keyTime, keyData);
 						}
 					}
 
@@ -238,7 +245,7 @@ bool ModelReader::loadModel(const ModelLoadSettings loadSets, IReadStream* const
 						std::vector<char> chunkMemory(chunkDesc.sizeBytes);
 						loadDataChunkRaw(chunkMemory.data(), chunkMemory.size() * sizeof(chunkMemory[0]), chunkId);
 
-						const int valueTypeSizeBytes = sizeof(animation.perNodeKeyFrames[0].scalingKeyFrames[0.f]);
+						const int valueTypeSizeBytes = sizeof(vec3f);
 
 						const int numPairsInChunk = int(chunkDesc.sizeBytes / (sizeof(float) + valueTypeSizeBytes));
 						const char* readPtr = chunkMemory.data();
@@ -248,7 +255,7 @@ bool ModelReader::loadModel(const ModelLoadSettings loadSets, IReadStream* const
 							const vec3f keyData = *(vec3f*)(readPtr);
 							readPtr += valueTypeSizeBytes;
 
-							animation.perNodeKeyFrames[nodeIndex].scalingKeyFrames[keyTime] = keyData;
+							animation.getOrAddKeyFramesForNode(nodeIndex).scalingKeyFrames.setKey(keyTime, keyData);
 						}
 					}
 				}
@@ -299,10 +306,15 @@ bool ModelReader::loadModel(const ModelLoadSettings loadSets, IReadStream* const
 				const int vertexDataChunkID = jMesh->getMember("vertexDataChunkId")->getNumberAs<int>();
 				const JsonValue* jIndexBufferChunkID = jMesh->getMember("indexDataChunkId");
 
-				loadDataChunk(mesh->vertexBufferRaw, vertexDataChunkID);
+				std::vector<char> vertexBufferRaw;
+				loadDataChunk(vertexBufferRaw, vertexDataChunkID);
+				mesh->vertexBufferRaw = std::move(vertexBufferRaw);
+
 				const int indexDataChunkID = jIndexBufferChunkID ? jIndexBufferChunkID->getNumberAs<int>() : -1;
 				if (indexDataChunkID > 0) {
-					loadDataChunk(mesh->indexBufferRaw, indexDataChunkID);
+					std::vector<char> indexBufferRaw;
+					loadDataChunk(indexBufferRaw, indexDataChunkID);
+					mesh->indexBufferRaw = std::move(indexBufferRaw);
 				}
 
 				mesh->name = jMesh->getMember("name")->GetString();
@@ -567,6 +579,462 @@ bool ModelReader::loadModel(const ModelLoadSettings loadSets, IReadStream* const
 		return false;
 	}
 
+	model.computeNodesOrder();
+	model.computeNodesImportance();
+	model.computeNodesNameLookup();
+
+	return true;
+}
+
+bool ModelReader::loadModel(const ModelLoadSettings loadSets, IReadStream* const iReadStream, Model& model) {
+	if (iReadStream == nullptr) {
+		return false;
+	}
+
+	// Peek at the begining of the stream to find out the version of the file.
+	const size_t streamStartOffset = iReadStream->pointerOffset();
+	char magic[sizeof(ModelFileV2::kMagic)] = {0};
+	const size_t magicBytesRead = iReadStream->read(magic, sizeof(magic));
+
+	if (isModelFileV2(magic, magicBytesRead) == false) {
+		iReadStream->seek(SeekOrigin::Begining, streamStartOffset);
+		return loadModelV1(loadSets, iReadStream, model);
+	}
+
+	// Version 2 files are parsed in memory, read the whole stream.
+	std::shared_ptr<std::vector<char>> fileData = std::make_shared<std::vector<char>>(magic, magic + magicBytesRead);
+	char readBuffer[4096];
+	for (size_t bytesRead = iReadStream->read(readBuffer, sizeof(readBuffer)); bytesRead != 0;
+	     bytesRead = iReadStream->read(readBuffer, sizeof(readBuffer))) {
+		fileData->insert(fileData->end(), readBuffer, readBuffer + bytesRead);
+	}
+
+	return loadModelFromMemory(loadSets, fileData->data(), fileData->size(), fileData, model);
+}
+
+bool ModelReader::loadModel(const ModelLoadSettings loadSets, const char* const filename, Model& model) {
+	std::shared_ptr<MemoryMappedFile> mappedFile = std::make_shared<MemoryMappedFile>();
+	if (mappedFile->open(filename) && isModelFileV2(mappedFile->data(), mappedFile->size())) {
+		return loadModelFromMemory(loadSets, mappedFile->data(), mappedFile->size(), mappedFile, model);
+	}
+
+	// Not a version 2 file, fallback to the stream based loading.
+	mappedFile.reset();
+	FileReadStream frs(filename);
+	if (frs.isOpened() == false) {
+		return false;
+	}
+
+	return loadModelV1(loadSets, &frs, model);
+}
+
+bool ModelReader::isModelFileV2(const char* const data, const size_t sizeBytes) {
+	return data != nullptr && sizeBytes >= sizeof(ModelFileV2::kMagic) &&
+	       memcmp(data, ModelFileV2::kMagic, sizeof(ModelFileV2::kMagic)) == 0;
+}
+
+namespace {
+	/// A bounds checked view to an array of elements stored in a chunk of a version 2 model file.
+	template <typename T>
+	struct ChunkArrayView {
+		const T* elements = nullptr;
+		size_t numElements = 0;
+
+		const T& operator[](const size_t index) const {
+			if (index >= numElements) {
+				throw ModelParseExcept("Index out of the chunk bounds!");
+			}
+			return elements[index];
+		}
+
+		/// Validates that the specified range is inside the array and returns a pointer to its 1st element.
+		const T* range(const size_t first, const size_t count) const {
+			if (first > numElements || count > numElements - first) {
+				throw ModelParseExcept("Range out of the chunk bounds!");
+			}
+			return elements + first;
+		}
+	};
+
+	transf3d fromFileTransform(const ModelFileV2::Transform& tr) {
+		transf3d result;
+		result.p = vec3f(tr.p[0], tr.p[1], tr.p[2]);
+		result.r = quatf(tr.r[0], tr.r[1], tr.r[2], tr.r[3]);
+		result.s = vec3f(tr.s[0], tr.s[1], tr.s[2]);
+		return result;
+	}
+} // namespace
+
+bool ModelReader::loadModelFromMemory(const ModelLoadSettings loadSets,
+                                      const char* const data,
+                                      const size_t sizeBytes,
+                                      std::shared_ptr<const void> keepAlive,
+                                      Model& model) {
+	using namespace ModelFileV2;
+
+	try {
+		model = Model();
+		model.setModelLoadSettings(loadSets);
+
+		if (isModelFileV2(data, sizeBytes) == false || sizeBytes < sizeof(FileHeader)) {
+			throw ModelParseExcept("Not a version 2 model file!");
+		}
+
+		FileHeader header;
+		memcpy(&header, data, sizeof(header));
+
+		if (header.version != kVersion) {
+			throw ModelParseExcept("Unsupported model file version!");
+		}
+
+		// Validate the chunk table.
+		if (header.chunkTableByteOffset > sizeBytes || header.chunkTableByteOffset % alignof(ChunkDesc) != 0 ||
+		    (sizeBytes - header.chunkTableByteOffset) / sizeof(ChunkDesc) < header.numChunks) {
+			throw ModelParseExcept("The chunk table is outside of the file!");
+		}
+
+		const ChunkDesc* const chunkTable = (const ChunkDesc*)(data + header.chunkTableByteOffset);
+		int chunkIndexPerType[chunkType_count];
+		for (int& idx : chunkIndexPerType) {
+			idx = -1;
+		}
+
+		for (uint32 iChunk = 0; iChunk < header.numChunks; ++iChunk) {
+			const ChunkDesc& desc = chunkTable[iChunk];
+			if (desc.byteOffset > sizeBytes || desc.sizeBytes > sizeBytes - desc.byteOffset || desc.byteOffset % kChunkAlignment != 0) {
+				throw ModelParseExcept("Invalid chunk description!");
+			}
+
+			// There are many raw and quantized key frames chunks, they are referenced by index from the other chunks.
+			if (desc.type != chunkType_raw && desc.type != chunkType_quantizedKeyFrames && desc.type < chunkType_count) {
+				chunkIndexPerType[desc.type] = int(iChunk);
+			}
+		}
+
+		const auto getChunk = [&](const int chunkIndex) -> const ChunkDesc& {
+			if (chunkIndex < 0 || uint32(chunkIndex) >= header.numChunks) {
+				throw ModelParseExcept("Chunk index is out of range!");
+			}
+			return chunkTable[chunkIndex];
+		};
+
+		// Chunks are aligned to @kChunkAlignment so the elements could be accessed in-place.
+		const auto getArray = [&](auto& outArray, const int chunkIndex) -> void {
+			using ElementType = std::remove_cv_t<std::remove_pointer_t<decltype(outArray.elements)>>;
+			static_assert(alignof(ElementType) <= kChunkAlignment, "");
+
+			outArray.elements = nullptr;
+			outArray.numElements = 0;
+			if (chunkIndex < 0) {
+				return;
+			}
+
+			const ChunkDesc& desc = getChunk(chunkIndex);
+			if (desc.sizeBytes % sizeof(ElementType) != 0) {
+				throw ModelParseExcept("Chunk size is not a multiple of the element size!");
+			}
+
+			outArray.elements = (const ElementType*)(data + desc.byteOffset);
+			outArray.numElements = size_t(desc.sizeBytes / sizeof(ElementType));
+		};
+
+		const auto getTypedArray = [&](auto& outArray, const ChunkType type) -> void { getArray(outArray, chunkIndexPerType[type]); };
+
+		ChunkArrayView<char> strings;
+		getTypedArray(strings, chunkType_strings);
+
+		const auto getString = [&](const uint32 offset) -> std::string {
+			if (offset == kNoString) {
+				return std::string();
+			}
+
+			const char* const str = strings.range(offset, 1);
+			const size_t maxLength = strings.numElements - offset;
+			const size_t length = strnlen(str, maxLength);
+			if (length == maxLength) {
+				throw ModelParseExcept("Unterminated string!");
+			}
+
+			return std::string(str, length);
+		};
+
+		// Nodes.
+		ChunkArrayView<Node> nodes;
+		ChunkArrayView<NodeMeshAttachment> nodeMeshAttachments;
+		ChunkArrayView<sint32> nodeChildren;
+		getTypedArray(nodes, chunkType_nodes);
+		getTypedArray(nodeMeshAttachments, chunkType_nodeMeshAttachments);
+		getTypedArray(nodeChildren, chunkType_nodeChildren);
+
+		for (size_t iNode = 0; iNode < nodes.numElements; ++iNode) {
+			const Node& fileNode = nodes[iNode];
+			ModelNode* node = model.nodeAt(model.makeNewNode());
+
+			node->name = getString(fileNode.name);
+			node->staticLocalTransform = fromFileTransform(fileNode.staticLocalTransform);
+			node->limbLength = fileNode.limbLength;
+
+			const NodeMeshAttachment* attachments = nodeMeshAttachments.range(fileNode.firstMeshAttachment, fileNode.numMeshAttachments);
+			for (uint32 t = 0; t < fileNode.numMeshAttachments; ++t) {
+				node->meshAttachments.emplace_back(MeshAttachment(attachments[t].meshIndex, attachments[t].materialIndex));
+			}
+
+			const sint32* childNodes = nodeChildren.range(fileNode.firstChild, fileNode.numChildren);
+			node->childNodes.assign(childNodes, childNodes + fileNode.numChildren);
+		}
+
+		model.setRootNodeIndex(header.rootNodeIndex);
+
+		// Materials.
+		ChunkArrayView<ModelFileV2::Material> materials;
+		getTypedArray(materials, chunkType_materials);
+		for (size_t iMtl = 0; iMtl < materials.numElements; ++iMtl) {
+			const ModelFileV2::Material& fileMtl = materials[iMtl];
+			ModelMaterial* material = model.materialAt(model.makeNewMaterial());
+
+			material->name = getString(fileMtl.name);
+			material->diffuseColor = vec4f(fileMtl.diffuseColor[0], fileMtl.diffuseColor[1], fileMtl.diffuseColor[2], fileMtl.diffuseColor[3]);
+			material->emissionColor =
+			    vec4f(fileMtl.emissionColor[0], fileMtl.emissionColor[1], fileMtl.emissionColor[2], fileMtl.emissionColor[3]);
+			material->metallic = fileMtl.metallic;
+			material->roughness = fileMtl.roughness;
+			material->diffuseTextureName = getString(fileMtl.diffuseTextureName);
+			material->emissionTextureName = getString(fileMtl.emissionTextureName);
+			material->normalTextureName = getString(fileMtl.normalTextureName);
+			material->metallicTextureName = getString(fileMtl.metallicTextureName);
+			material->roughnessTextureName = getString(fileMtl.roughnessTextureName);
+		}
+
+		// Meshes.
+		ChunkArrayView<Mesh> meshes;
+		ChunkArrayView<ModelFileV2::VertexDecl> vertexDecls;
+		ChunkArrayView<Bone> bones;
+		ChunkArrayView<MeshLod> meshLods;
+		getTypedArray(meshes, chunkType_meshes);
+		getTypedArray(vertexDecls, chunkType_vertexDecls);
+		getTypedArray(bones, chunkType_bones);
+		getTypedArray(meshLods, chunkType_meshLods);
+
+		for (size_t iMesh = 0; iMesh < meshes.numElements; ++iMesh) {
+			const Mesh& fileMesh = meshes[iMesh];
+			ModelMesh* mesh = model.meshAt(model.makeNewMesh());
+
+			mesh->name = getString(fileMesh.name);
+			mesh->primitiveTopology = primitiveTopologyFromTopology(fileMesh.primitiveTopology);
+			mesh->vbByteOffset = fileMesh.vbByteOffset;
+			mesh->ibByteOffset = fileMesh.ibByteOffset;
+			mesh->ibFmt = uniformTypeFromDataFormat(fileMesh.ibFormat);
+			mesh->numElements = fileMesh.numElements;
+			mesh->numVertices = fileMesh.numVertices;
+			mesh->aabox.min = vec3f(fileMesh.aaboxMin[0], fileMesh.aaboxMin[1], fileMesh.aaboxMin[2]);
+			mesh->aabox.max = vec3f(fileMesh.aaboxMax[0], fileMesh.aaboxMax[1], fileMesh.aaboxMax[2]);
+
+			const float* const dqPosScale = fileMesh.positionDequantScale;
+			const float* const dqPosOffset = fileMesh.positionDequantOffset;
+			mesh->dequantization.positionScale = vec3f(dqPosScale[0], dqPosScale[1], dqPosScale[2]);
+			mesh->dequantization.positionOffset = vec3f(dqPosOffset[0], dqPosOffset[1], dqPosOffset[2]);
+			mesh->dequantization.uvScale = vec2f(fileMesh.uvDequantScale[0], fileMesh.uvDequantScale[1]);
+			mesh->dequantization.uvOffset = vec2f(fileMesh.uvDequantOffset[0], fileMesh.uvDequantOffset[1]);
+			mesh->dequantization.hasQuantizedPositions = (fileMesh.quantizationFlags & quantizationFlags_positions) != 0;
+			mesh->dequantization.hasOctahedralNormals = (fileMesh.quantizationFlags & quantizationFlags_octahedralNormals) != 0;
+
+			// The vertex and index buffers point directly in the file memory.
+			if (fileMesh.vertexDataChunk >= 0) {
+				const ChunkDesc& desc = getChunk(fileMesh.vertexDataChunk);
+				mesh->vertexBufferRaw.setView(data + desc.byteOffset, size_t(desc.sizeBytes), keepAlive);
+			}
+
+			if (fileMesh.indexDataChunk >= 0) {
+				const ChunkDesc& desc = getChunk(fileMesh.indexDataChunk);
+				mesh->indexBufferRaw.setView(data + desc.byteOffset, size_t(desc.sizeBytes), keepAlive);
+			}
+
+			// The vertex declaration.
+			const ModelFileV2::VertexDecl* const decls = vertexDecls.range(fileMesh.firstVertexDecl, fileMesh.numVertexDecls);
+			for (uint32 iDecl = 0; iDecl < fileMesh.numVertexDecls; ++iDecl) {
+				sge::VertexDecl decl;
+				decl.bufferSlot = 0;
+				decl.semantic = getString(decls[iDecl].semantic);
+				decl.byteOffset = decls[iDecl].byteOffset;
+				decl.format = uniformTypeFromDataFormat(decls[iDecl].format);
+
+				if (decl.format == UniformType::Unknown) {
+					throw ModelParseExcept("Unknown vertex attribute format!");
+				}
+
+				mesh->vertexDecl.push_back(decl);
+
+				// Cache some commonly used semantics offsets.
+				if (decl.semantic == "a_position") {
+					mesh->vbPositionOffsetBytes = (int)decl.byteOffset;
+				} else if (decl.semantic == "a_normal") {
+					mesh->vbNormalOffsetBytes = (int)decl.byteOffset;
+				} else if (decl.semantic == "a_uv") {
+					mesh->vbUVOffsetBytes = (int)decl.byteOffset;
+				}
+			}
+
+			// Bake the vertex stride.
+			if (mesh->vertexDecl.empty() == false) {
+				mesh->stride = int(mesh->vertexDecl.back().byteOffset) + UniformType::GetSizeBytes(mesh->vertexDecl.back().format);
+			}
+
+			// The bones.
+			const Bone* const meshBones = bones.range(fileMesh.firstBone, fileMesh.numBones);
+			mesh->bones.resize(fileMesh.numBones);
+			for (uint32 iBone = 0; iBone < fileMesh.numBones; ++iBone) {
+				memcpy(mesh->bones[iBone].offsetMatrix.data, meshBones[iBone].offsetMatrix, sizeof(meshBones[iBone].offsetMatrix));
+				mesh->bones[iBone].nodeIdx = meshBones[iBone].nodeIndex;
+			}
+
+			// The lower detail index buffers, they also point directly in the file memory.
+			const MeshLod* const fileLods = meshLods.range(fileMesh.firstLod, fileMesh.numLods);
+			mesh->lods.resize(fileMesh.numLods);
+			for (uint32 iLod = 0; iLod < fileMesh.numLods; ++iLod) {
+				ModelMeshLod& lod = mesh->lods[iLod];
+				const ChunkDesc& desc = getChunk(fileLods[iLod].indexDataChunk);
+				lod.indexBufferRaw.setView(data + desc.byteOffset, size_t(desc.sizeBytes), keepAlive);
+				lod.numElements = fileLods[iLod].numElements;
+				lod.error = fileLods[iLod].error;
+			}
+		}
+
+		// Animations.
+		ChunkArrayView<Animation> animations;
+		ChunkArrayView<AnimationTrack> animationTracks;
+		getTypedArray(animations, chunkType_animations);
+		getTypedArray(animationTracks, chunkType_animationTracks);
+
+		const auto readKeyFrames = [&](auto& outChannel, auto& outCompressedChannel, const int timesChunk, const int valuesChunk) -> void {
+			using ValueType = typename std::decay_t<decltype(outChannel.values)>::value_type;
+
+			ChunkArrayView<float> times;
+			getArray(times, timesChunk);
+
+			// Compressed channels stay quantized in memory, they are decoded while sampling.
+			if (valuesChunk >= 0 && getChunk(valuesChunk).type == chunkType_quantizedKeyFrames) {
+				const ChunkDesc& desc = getChunk(valuesChunk);
+
+				QuantizedKeyFramesHeader quantizedHeader;
+				if (desc.sizeBytes < sizeof(quantizedHeader)) {
+					throw ModelParseExcept("Invalid quantized key frames chunk!");
+				}
+				memcpy(&quantizedHeader, data + desc.byteOffset, sizeof(quantizedHeader));
+
+				const size_t numQuantizedValues = size_t(quantizedHeader.numKeys) * 3;
+				if (quantizedHeader.numKeys != times.numElements ||
+				    (desc.sizeBytes - sizeof(quantizedHeader)) / sizeof(uint16) != numQuantizedValues) {
+					throw ModelParseExcept("Key frame times and values count do not match!");
+				}
+
+				const uint16* const quantizedValues = (const uint16*)(data + desc.byteOffset + sizeof(quantizedHeader));
+				outCompressedChannel.times.assign(times.elements, times.elements + times.numElements);
+				outCompressedChannel.quantizedValues.assign(quantizedValues, quantizedValues + numQuantizedValues);
+				outCompressedChannel.rangeMin = vec3f(quantizedHeader.rangeMin[0], quantizedHeader.rangeMin[1], quantizedHeader.rangeMin[2]);
+				outCompressedChannel.rangeExtent =
+				    vec3f(quantizedHeader.rangeExtent[0], quantizedHeader.rangeExtent[1], quantizedHeader.rangeExtent[2]);
+				return;
+			}
+
+			ChunkArrayView<ValueType> values;
+			getArray(values, valuesChunk);
+
+			if (times.numElements != values.numElements) {
+				throw ModelParseExcept("Key frame times and values count do not match!");
+			}
+
+			// The keys are written sorted by time, setKey only appends them.
+			for (size_t iKey = 0; iKey < times.numElements; ++iKey) {
+				outChannel.setKey(times[iKey], values[iKey]);
+			}
+		};
+
+		for (size_t iAnim = 0; iAnim < animations.numElements; ++iAnim) {
+			const Animation& fileAnim = animations[iAnim];
+			ModelAnimation& animation = *model.animationAt(model.makeNewAnim());
+
+			animation.animationName = getString(fileAnim.name);
+			animation.durationSec = fileAnim.durationSec;
+
+			const AnimationTrack* const tracks = animationTracks.range(fileAnim.firstTrack, fileAnim.numTracks);
+			for (uint32 iTrack = 0; iTrack < fileAnim.numTracks; ++iTrack) {
+				const AnimationTrack& track = tracks[iTrack];
+				if (track.nodeIndex < 0 || track.nodeIndex >= model.numNodes()) {
+					throw ModelParseExcept("Invalid animation track node index!");
+				}
+
+				KeyFrames& keyFrames = animation.getOrAddKeyFramesForNode(track.nodeIndex);
+
+				readKeyFrames(keyFrames.positionKeyFrames, keyFrames.compressedPositionKeyFrames, track.positionTimesChunk,
+				              track.positionValuesChunk);
+				readKeyFrames(keyFrames.rotationKeyFrames, keyFrames.compressedRotationKeyFrames, track.rotationTimesChunk,
+				              track.rotationValuesChunk);
+				readKeyFrames(keyFrames.scalingKeyFrames, keyFrames.compressedScalingKeyFrames, track.scalingTimesChunk,
+				              track.scalingValuesChunk);
+			}
+		}
+
+		// Collision geometry.
+		const auto readHulls = [&](std::vector<ModelCollisionMesh>& outHulls, const ChunkType type) -> void {
+			ChunkArrayView<CollisionHull> hulls;
+			getTypedArray(hulls, type);
+
+			for (size_t iHull = 0; iHull < hulls.numElements; ++iHull) {
+				ChunkArrayView<vec3f> vertices;
+				ChunkArrayView<int> indices;
+				getArray(vertices, hulls[iHull].verticesChunk);
+				getArray(indices, hulls[iHull].indicesChunk);
+
+				outHulls.emplace_back(ModelCollisionMesh(std::vector<vec3f>(vertices.elements, vertices.elements + vertices.numElements),
+				                                         std::vector<int>(indices.elements, indices.elements + indices.numElements)));
+			}
+		};
+
+		readHulls(model.m_convexHulls, chunkType_convexHulls);
+		readHulls(model.m_concaveHulls, chunkType_concaveHulls);
+
+		ChunkArrayView<CollisionBox> collisionBoxes;
+		getTypedArray(collisionBoxes, chunkType_collisionBoxes);
+		for (size_t t = 0; t < collisionBoxes.numElements; ++t) {
+			const CollisionBox& shape = collisionBoxes[t];
+			model.m_collisionBoxes.emplace_back(Model_CollisionShapeBox(
+			    getString(shape.name), fromFileTransform(shape.transform), vec3f(shape.halfDiagonal[0], shape.halfDiagonal[1], shape.halfDiagonal[2])));
+		}
+
+		ChunkArrayView<CollisionCapsule> collisionCapsules;
+		getTypedArray(collisionCapsules, chunkType_collisionCapsules);
+		for (size_t t = 0; t < collisionCapsules.numElements; ++t) {
+			const CollisionCapsule& shape = collisionCapsules[t];
+			model.m_collisionCapsules.emplace_back(
+			    Model_CollisionShapeCapsule(getString(shape.name), fromFileTransform(shape.transform), shape.halfHeight, shape.radius));
+		}
+
+		ChunkArrayView<CollisionCylinder> collisionCylinders;
+		getTypedArray(collisionCylinders, chunkType_collisionCylinders);
+		for (size_t t = 0; t < collisionCylinders.numElements; ++t) {
+			const CollisionCylinder& shape = collisionCylinders[t];
+			model.m_collisionCylinders.emplace_back(Model_CollisionShapeCylinder(
+			    getString(shape.name), fromFileTransform(shape.transform), vec3f(shape.halfDiagonal[0], shape.halfDiagonal[1], shape.halfDiagonal[2])));
+		}
+
+		ChunkArrayView<CollisionSphere> collisionSpheres;
+		getTypedArray(collisionSpheres, chunkType_collisionSpheres);
+		for (size_t t = 0; t < collisionSpheres.numElements; ++t) {
+			const CollisionSphere& shape = collisionSpheres[t];
+			model.m_collisionSpheres.emplace_back(Model_CollisionShapeSphere(getString(shape.name), fromFileTransform(shape.transform), shape.radius));
+		}
+	} catch (const ModelParseExcept& UNUSED(except)) {
+		model = Model();
+		return false;
+	} catch (...) {
+		model = Model();
+		return false;
+	}
+
+	model.computeNodesOrder();
+	model.computeNodesImportance();
+	model.computeNodesNameLookup();
+
 	return true;
 }
 
@@ -1,17 +1,37 @@
 #pragma once
 
+#include <memory>
+
 #include "Model.h"
 #include "sge_core/sgecore_api.h"
 #include "sge_utils/utils/IStream.h"
 
 namespace sge {
 
+/// @brief Loads *.mdl files. Both the version 2 (see @ModelFileV2) and the older json based version 1 files are supported.
 struct SGE_CORE_API ModelReader {
 	ModelReader() = default;
 	~ModelReader() {}
 
 	bool loadModel(const ModelLoadSettings loadSets, IReadStream* const irs, Model& model);
 
+	/// @brief Loads the model from the specified file. Version 2 files get memory mapped and the vertex and index buffers
+	/// of the meshes point directly in the mapped file, avoiding any copies.
+	bool loadModel(const ModelLoadSettings loadSets, const char* const filename, Model& model);
+
+	/// @brief Loads a version 2 model file that is already in memory.
+	/// The vertex and index buffers of the loaded meshes point directly in @data.
+	/// @param [in] keepAlive an object owning @data, the loaded model keeps a reference to it.
+	///                       Could be nullptr if @data is going to outlive the model.
+	bool loadModelFromMemory(const ModelLoadSettings loadSets,
+	                         const char* const data,
+	                         const size_t sizeBytes,
+	                         std::shared_ptr<const void> keepAlive,
+	                         Model& model);
+
+	/// Returns true if the specified memory starts like a version 2 model file.
+	static bool isModelFileV2(const char* const data, const size_t sizeBytes);
+
   private:
 	struct DataChunkDesc {
 		int chunkId = 0;
@@ -20,6 +40,8 @@ struct SGE_CORE_API ModelReader {
 	};
 
   private:
+	bool loadModelV1(const ModelLoadSettings& loadSets, IReadStream* const irs, Model& model);
+
 	IReadStream* irs;
 	std::vector<DataChunkDesc> dataChunksDesc;
 
@@ -1,392 +1,396 @@
 #include "ModelWriter.h"
+#include "AnimationCompressor.h"
+#include "MeshOptimizer.h"
+#include "MeshQuantizer.h"
+#include "MeshSimplifier.h"
 #include "Model.h"
 #include "sge_utils/utils/FileStream.h"
-#include "sge_utils/utils/json.h"
 #include "sge_utils/utils/range_loop.h"
+#include <cstdio>
+#include <cstring>
 
 namespace sge {
 
-int ModelWriter::newDataChunkFromPtr(const void* const ptr, const size_t sizeBytes) {
-	const int newChunkId = (dataChunks.size() == 0) ? 0 : dataChunks.back().id + 1;
+using namespace ModelFileV2;
 
-	dataChunks.emplace_back(DataChunk(newChunkId, ptr, sizeBytes));
-	return newChunkId;
-}
-
-char* ModelWriter::newDataChunkWithSize(size_t sizeBytes, int& outChunkId) {
-	const int newChunkId = (dataChunks.size() == 0) ? 0 : dataChunks.back().id + 1;
-
-	std::vector<char> memory(sizeBytes);
-	DataChunk chunk;
-	chunk.data = memory.data();
-	chunk.id = newChunkId;
-	chunk.sizeBytes = sizeBytes;
-
-	dataChunks.push_back(chunk);
-
-	// [MODERL_WRITER_MOVE_ASSUME]
-	m_dynamicallyAlocatedPointersToDelete.emplace_back(std::move(memory));
-	// memory is now empty becuase of the move.
-	sgeAssert(memory.empty());
-	sgeAssert(m_dynamicallyAlocatedPointersToDelete.back().data() == chunk.data);
+namespace {
+	Transform toFileTransform(const transf3d& tr) {
+		Transform result;
+		for (int t = 0; t < 3; ++t) {
+			result.p[t] = tr.p[t];
+			result.s[t] = tr.s[t];
+		}
+		for (int t = 0; t < 4; ++t) {
+			result.r[t] = tr.r.data[t];
+		}
+		return result;
+	}
 
-	outChunkId = newChunkId;
-	return (char*)chunk.data;
+	void copyFloats(float* const dest, const float* const src, const int count) {
+		for (int t = 0; t < count; ++t) {
+			dest[t] = src[t];
+		}
+	}
+} // namespace
+
+ModelWriter::ModelWriter() = default;
+ModelWriter::~ModelWriter() = default;
+
+void ModelWriter::resetState() {
+	model = nullptr;
+	dataChunks.clear();
+	m_strings.clear();
+	m_stringOffsets.clear();
+	m_nodes.clear();
+	m_nodeMeshAttachments.clear();
+	m_nodeChildren.clear();
+	m_materials.clear();
+	m_meshes.clear();
+	m_vertexDecls.clear();
+	m_bones.clear();
+	m_animations.clear();
+	m_animationTracks.clear();
+	m_convexHulls.clear();
+	m_concaveHulls.clear();
+	m_collisionBoxes.clear();
+	m_collisionCapsules.clear();
+	m_collisionCylinders.clear();
+	m_collisionSpheres.clear();
+	m_meshLods.clear();
+	m_processedMeshes.clear();
+	m_processedAnimations.clear();
+	m_dynamicallyAlocatedPointersToDelete.clear();
 }
 
-JsonValue* ModelWriter::generateKeyFrames(const KeyFrames& keyfames) {
-	JsonValue* jKeyFrames = jvb(JID_MAP);
+int ModelWriter::newDataChunkFromPtr(const void* const ptr, const size_t sizeBytes, ChunkType type) {
+	const int newChunkIndex = int(dataChunks.size());
+	dataChunks.emplace_back(DataChunk(type, ptr, sizeBytes));
+	return newChunkIndex;
+}
 
-	if (!keyfames.positionKeyFrames.empty()) {
-		const int numKeyFrames = int(keyfames.positionKeyFrames.size());
-		const size_t chunkSizeBytes = numKeyFrames * (sizeof(float) + sizeof(vec3f));
+char* ModelWriter::newDataChunkWithSize(size_t sizeBytes, int& outChunkIndex, ChunkType type) {
+	m_dynamicallyAlocatedPointersToDelete.emplace_back(new char[sizeBytes]);
+	char* const memory = m_dynamicallyAlocatedPointersToDelete.back().get();
+	outChunkIndex = newDataChunkFromPtr(memory, sizeBytes, type);
+	return memory;
+}
 
-		int chunkId = -1;
-		char* chunkData = newDataChunkWithSize(chunkSizeBytes, chunkId);
+uint32 ModelWriter::addString(const std::string& str) {
+	const auto itr = m_stringOffsets.find(str);
+	if (itr != m_stringOffsets.end()) {
+		return itr->second;
+	}
 
-		for (const auto& itr : keyfames.positionKeyFrames) {
-			*(float*)(chunkData) = itr.first;
-			chunkData += sizeof(float);
+	const uint32 offset = uint32(m_strings.size());
+	m_strings.insert(m_strings.end(), str.c_str(), str.c_str() + str.size() + 1); // +1 for the null terminator.
+	m_stringOffsets[str] = offset;
+	return offset;
+}
 
-			*(vec3f*)(chunkData) = itr.second;
-			chunkData += sizeof(itr.second);
+AnimationTrack ModelWriter::generateKeyFrames(int nodeIndex, const KeyFrames& keyfames) {
+	AnimationTrack track;
+	track.nodeIndex = nodeIndex;
+	track.positionTimesChunk = -1;
+	track.positionValuesChunk = -1;
+	track.rotationTimesChunk = -1;
+	track.rotationValuesChunk = -1;
+	track.scalingTimesChunk = -1;
+	track.scalingValuesChunk = -1;
+
+	// Splits the key frames in two chunks, one for the key times and one for the values.
+	const auto writeChannel = [this](const auto& channel, sint32& outTimesChunk, sint32& outValuesChunk) -> void {
+		if (channel.empty()) {
+			return;
 		}
 
-		jKeyFrames->setMember("positionKeyFrames_chunkId", jvb(chunkId));
-	}
+		using ValueType = typename std::decay_t<decltype(channel.values)>::value_type;
+		const size_t numKeys = channel.size();
 
-	if (!keyfames.rotationKeyFrames.empty()) {
-		const int numKeyFrames = int(keyfames.rotationKeyFrames.size());
-		const size_t chunkSizeBytes = numKeyFrames * (sizeof(float) + sizeof(quatf));
+		int timesChunk = -1;
+		int valuesChunk = -1;
+		float* const times = (float*)newDataChunkWithSize(numKeys * sizeof(float), timesChunk);
+		ValueType* const values = (ValueType*)newDataChunkWithSize(numKeys * sizeof(ValueType), valuesChunk);
 
-		int chunkId = -1;
-		char* chunkData = newDataChunkWithSize(chunkSizeBytes, chunkId);
+		memcpy(times, channel.times.data(), numKeys * sizeof(float));
+		memcpy(values, channel.values.data(), numKeys * sizeof(ValueType));
 
-		for (const auto& itr : keyfames.rotationKeyFrames) {
-			*(float*)(chunkData) = itr.first;
-			chunkData += sizeof(float);
+		outTimesChunk = timesChunk;
+		outValuesChunk = valuesChunk;
+	};
 
-			*(quatf*)(chunkData) = itr.second;
-			chunkData += sizeof(itr.second);
+	// The compressed channels store the quantized values after a small header.
+	const auto writeCompressedChannel = [this](const auto& channel, sint32& outTimesChunk, sint32& outValuesChunk) -> void {
+		if (channel.empty()) {
+			return;
 		}
 
-		jKeyFrames->setMember("rotationKeyFrames_chunkId", jvb(chunkId));
-	}
+		const size_t numKeys = channel.size();
 
-	if (!keyfames.scalingKeyFrames.empty()) {
-		const int numKeyFrames = int(keyfames.scalingKeyFrames.size());
-		const size_t chunkSizeBytes = numKeyFrames * (sizeof(float) + sizeof(vec3f));
+		QuantizedKeyFramesHeader header;
+		copyFloats(header.rangeMin, channel.rangeMin.data, 3);
+		copyFloats(header.rangeExtent, channel.rangeExtent.data, 3);
+		header.numKeys = uint32(numKeys);
+		header.reserved = 0;
 
-		int chunkId = -1;
-		char* chunkData = newDataChunkWithSize(chunkSizeBytes, chunkId);
+		int timesChunk = -1;
+		int valuesChunk = -1;
+		float* const times = (float*)newDataChunkWithSize(numKeys * sizeof(float), timesChunk);
+		char* const values =
+		    newDataChunkWithSize(sizeof(header) + channel.quantizedValues.size() * sizeof(uint16), valuesChunk, chunkType_quantizedKeyFrames);
 
-		for (const auto& itr : keyfames.scalingKeyFrames) {
-			*(float*)(chunkData) = itr.first;
-			chunkData += sizeof(float);
+		memcpy(times, channel.times.data(), numKeys * sizeof(float));
+		memcpy(values, &header, sizeof(header));
+		memcpy(values + sizeof(header), channel.quantizedValues.data(), channel.quantizedValues.size() * sizeof(uint16));
 
-			*(vec3f*)(chunkData) = itr.second;
-			chunkData += sizeof(itr.second);
-		}
+		outTimesChunk = timesChunk;
+		outValuesChunk = valuesChunk;
+	};
 
-		jKeyFrames->setMember("scalingKeyFrames_chunkId", jvb(chunkId));
+	writeChannel(keyfames.positionKeyFrames, track.positionTimesChunk, track.positionValuesChunk);
+	writeChannel(keyfames.rotationKeyFrames, track.rotationTimesChunk, track.rotationValuesChunk);
+	writeChannel(keyfames.scalingKeyFrames, track.scalingTimesChunk, track.scalingValuesChunk);
+
+	if (keyfames.positionKeyFrames.empty()) {
+		writeCompressedChannel(keyfames.compressedPositionKeyFrames, track.positionTimesChunk, track.positionValuesChunk);
+	}
+
+	if (keyfames.rotationKeyFrames.empty()) {
+		writeCompressedChannel(keyfames.compressedRotationKeyFrames, track.rotationTimesChunk, track.rotationValuesChunk);
 	}
 
+	if (keyfames.scalingKeyFrames.empty()) {
+		writeCompressedChannel(keyfames.compressedScalingKeyFrames, track.scalingTimesChunk, track.scalingValuesChunk);
+	}
 
-	return jKeyFrames;
+	return track;
 }
 
 void ModelWriter::writeAnimations() {
-	if (model->numAnimations() == 0) {
-		return;
-	}
-
-	auto jAnimations = root->setMember("animations", jvb(JID_ARRAY_BEGIN));
+	// The processed animations are referenced by the data chunks, make sure they don't get reallocated.
+	m_processedAnimations.reserve(model->numAnimations());
 
 	for (int iAnim : range_int(model->numAnimations())) {
-		const ModelAnimation& animation = *model->animationAt(iAnim);
-
-		auto jAnim = jAnimations->arrPush(jvb(JID_MAP_BEGIN));
-
-		jAnim->setMember("animationName", jvb(animation.animationName));
-		jAnim->setMember("durationSec", jvb(animation.durationSec)); // will be used in the future
-
-		// Serialize the actual key frames.
-		JsonValue* jAllNodesKeyFrames = jAnim->setMember("perNodeKeyFrames", jvb(JID_ARRAY));
+		const ModelAnimation* animationToWrite = model->animationAt(iAnim);
+		if (compressAnimations) {
+			m_processedAnimations.push_back(*animationToWrite);
+			AnimationCompressor::compressAnimation(m_processedAnimations.back(), *model, animationCompression);
+			animationToWrite = &m_processedAnimations.back();
+		}
 
-		for (const auto& itrPerNodeKeyframes : animation.perNodeKeyFrames) {
-			JsonValue* jNodeKeyFrames = jvb(JID_MAP);
+		const ModelAnimation& animation = *animationToWrite;
 
-			jNodeKeyFrames->setMember("nodeIndex", jvb(itrPerNodeKeyframes.first));
-			JsonValue* jKeyFrames = generateKeyFrames(itrPerNodeKeyframes.second);
-			jNodeKeyFrames->setMember("keyFrames", jKeyFrames);
+		Animation fileAnim;
+		fileAnim.name = addString(animation.animationName);
+		fileAnim.durationSec = animation.durationSec;
+		fileAnim.firstTrack = uint32(m_animationTracks.size());
+		fileAnim.numTracks = 0;
 
-			jAllNodesKeyFrames->arrPush(jNodeKeyFrames);
+		// Only the animated nodes have tracks in the file.
+		for (int iNode : range_int(int(animation.perNodeKeyFrames.size()))) {
+			if (animation.perNodeKeyFrames[iNode].empty() == false) {
+				m_animationTracks.push_back(generateKeyFrames(iNode, animation.perNodeKeyFrames[iNode]));
+				fileAnim.numTracks++;
+			}
 		}
+
+		m_animations.push_back(fileAnim);
 	}
 }
 
 void ModelWriter::writeNodes() {
-	JsonValue* jNodes = root->setMember("nodes", jvb(JID_ARRAY));
-	root->setMember("rootNodeIndex", jvb(model->getRootNodeIndex()));
-
 	for (int iNode : range_int(model->numNodes())) {
 		const ModelNode* node = model->nodeAt(iNode);
 
-		JsonValue* jNode = jNodes->arrPush(jvb(JID_MAP));
-
-		jNode->setMember("name", jvb(node->name));
-
-		if (node->staticLocalTransform.p != vec3f(0.f)) {
-			jNode->setMember("translation", jvb(node->staticLocalTransform.p.data, 3)); // An array of 3 floats.
-		}
-
-		if (node->staticLocalTransform.r != quatf::getIdentity()) {
-			jNode->setMember("rotation", jvb(node->staticLocalTransform.r.data, 4)); // An array of 4 floats.
-		}
-
-		if (node->staticLocalTransform.s != vec3f(1.f)) {
-			jNode->setMember("scaling", jvb(node->staticLocalTransform.s.data, 3)); // An array of 3 floats.
-		}
+		Node fileNode;
+		fileNode.name = addString(node->name);
+		fileNode.staticLocalTransform = toFileTransform(node->staticLocalTransform);
+		fileNode.limbLength = node->limbLength;
 
-		if (node->limbLength > 0.f) {
-				jNode->setMember("limbLength", jvb(node->limbLength));
+		fileNode.firstMeshAttachment = uint32(m_nodeMeshAttachments.size());
+		fileNode.numMeshAttachments = uint32(node->meshAttachments.size());
+		for (const MeshAttachment& attachmentMesh : node->meshAttachments) {
+			m_nodeMeshAttachments.push_back(NodeMeshAttachment{attachmentMesh.attachedMeshIndex, attachmentMesh.attachedMaterialIndex});
 		}
 
-		// Attached meshes.
-		if (!node->meshAttachments.empty()) {
-			auto jMeshes = jNode->setMember("meshes", jvb(JID_ARRAY));
-
-			for (const MeshAttachment attachmentMesh : node->meshAttachments) {
-				JsonValue* const jAttachmentMesh = jvb(JID_MAP);
-				jAttachmentMesh->setMember("meshIndex", jvb(attachmentMesh.attachedMeshIndex));
-				jAttachmentMesh->setMember("materialIndex", jvb(attachmentMesh.attachedMaterialIndex));
-
-				jMeshes->arrPush(jAttachmentMesh);
-			}
+		fileNode.firstChild = uint32(m_nodeChildren.size());
+		fileNode.numChildren = uint32(node->childNodes.size());
+		for (int childIndex : node->childNodes) {
+			m_nodeChildren.push_back(childIndex);
 		}
 
-		// Child indices.
-		if (!node->childNodes.empty()) {
-			JsonValue* const jChildNode = jNode->setMember("childNodes", jvb(JID_ARRAY));
-			for (int childIndex : node->childNodes) {
-				jChildNode->arrPush(jvb(childIndex));
-			}
-		}
+		m_nodes.push_back(fileNode);
 	}
 }
 
 void ModelWriter::writeMaterials() {
-	JsonValue* const jMaterials = root->setMember("materials", jvb(JID_ARRAY));
+	const auto optionalString = [this](const std::string& str) -> uint32 { return str.empty() ? kNoString : addString(str); };
 
 	for (const int iMtl : range_int(model->numMaterials())) {
-		JsonValue* const jMaterial = jMaterials->arrPush(jvb(JID_MAP));
-
 		const ModelMaterial* mtl = model->materialAt(iMtl);
 
-		jMaterial->setMember("name", jvb(mtl->name));
-
-		static_assert(sizeof(mtl->diffuseColor) == sizeof(vec4f));
-		jMaterial->setMember("diffuseColor", jvb(mtl->diffuseColor.data, 4)); // An array of 4 floats rgba.
-		static_assert(sizeof(mtl->emissionColor) == sizeof(vec4f));
-		jMaterial->setMember("emissionColor", jvb(mtl->emissionColor.data, 4)); // An array of 4 floats rgba.
-		jMaterial->setMember("metallic", jvb(mtl->metallic));
-		jMaterial->setMember("roughness", jvb(mtl->roughness));
-
-		if (mtl->diffuseTextureName.empty() == false)
-			jMaterial->setMember("diffuseTextureName", jvb(mtl->diffuseTextureName));
-
-		if (mtl->emissionTextureName.empty() == false)
-			jMaterial->setMember("emissionTextureName", jvb(mtl->emissionTextureName));
-
-		if (mtl->metallicTextureName.empty() == false)
-			jMaterial->setMember("metallicTextureName", jvb(mtl->metallicTextureName));
-
-		if (mtl->roughnessTextureName.empty() == false)
-			jMaterial->setMember("roughnessTextureName", jvb(mtl->roughnessTextureName));
+		ModelFileV2::Material fileMtl;
+		fileMtl.name = addString(mtl->name);
+		copyFloats(fileMtl.diffuseColor, mtl->diffuseColor.data, 4);
+		copyFloats(fileMtl.emissionColor, mtl->emissionColor.data, 4);
+		fileMtl.metallic = mtl->metallic;
+		fileMtl.roughness = mtl->roughness;
+		fileMtl.diffuseTextureName = optionalString(mtl->diffuseTextureName);
+		fileMtl.emissionTextureName = optionalString(mtl->emissionTextureName);
+		fileMtl.normalTextureName = optionalString(mtl->normalTextureName);
+		fileMtl.metallicTextureName = optionalString(mtl->metallicTextureName);
+		fileMtl.roughnessTextureName = optionalString(mtl->roughnessTextureName);
+
+		m_materials.push_back(fileMtl);
 	}
-
-	return;
 }
 
 void ModelWriter::writeMeshes() {
-	auto UnformType2String = [](const UniformType::Enum ut) -> const char* {
-		switch (ut) {
-			case UniformType::Uint16:
-				return "uint16";
-			case UniformType::Uint:
-				return "uint32";
-			case UniformType::Float2:
-				return "float2";
-			case UniformType::Float3:
-				return "float3";
-			case UniformType::Float4:
-				return "float4";
-			case UniformType::Int4:
-				return "int4";
-		}
+	// The processed meshes are referenced by the data chunks, make sure they don't get reallocated.
+	m_processedMeshes.reserve(model->numMeshes());
 
-		sgeAssert(false);
-		return nullptr;
-	};
-
-	auto PrimitiveTopology2String = [](const PrimitiveTopology::Enum ut) -> const char* {
-		switch (ut) {
-			case PrimitiveTopology::TriangleList:
-				return "TriangleList";
-		}
+	for (const int iMesh : range_int(model->numMeshes())) {
+		const ModelMesh* mesh = model->meshAt(iMesh);
 
-		sgeAssert(false);
-		return nullptr;
-	};
+		const bool shouldGenerateLods =
+		    numLodsToGenerate > 0 && mesh->lods.empty() && mesh->primitiveTopology == PrimitiveTopology::TriangleList &&
+		    mesh->ibFmt != UniformType::Unknown && mesh->numElements / 3 >= minTrianglesForLodGeneration;
 
-	JsonValue* const jMeshes = root->setMember("meshes", jvb(JID_ARRAY));
+		if (optimizeMeshes || shouldGenerateLods || quantizeVertices) {
+			m_processedMeshes.push_back(*mesh);
+			ModelMesh& processedMesh = m_processedMeshes.back();
 
-	for (const int iMesh : range_int(model->numMeshes())) {
-		JsonValue* jMesh = jMeshes->arrPush(jvb(JID_MAP));
+			bool isModified = false;
+			if (optimizeMeshes) {
+				isModified |= MeshOptimizer::optimizeMesh(processedMesh);
+			}
 
-		const ModelMesh* mesh = model->meshAt(iMesh);
+			if (shouldGenerateLods) {
+				isModified |= MeshSimplifier::generateLods(processedMesh, numLodsToGenerate) > 0;
+			}
 
-		// Write the vertex/index buffers chunks.
-		if (mesh->vertexBufferRaw.size()) {
-			const int vertexBufferChunkId = newChunkFromStdVector(mesh->vertexBufferRaw);
-			jMesh->setMember("vertexDataChunkId", jvb(vertexBufferChunkId));
-		}
+			// The optimizer and the simplifier need the float positions, so the quantization is done last.
+			if (quantizeVertices) {
+				isModified |= MeshQuantizer::quantizeMesh(processedMesh, quantizePositions);
+			}
 
-		if (mesh->indexBufferRaw.size()) {
-			const int indexBufferChunkId = newChunkFromStdVector(mesh->indexBufferRaw);
-			jMesh->setMember("indexDataChunkId", jvb(indexBufferChunkId));
+			if (isModified) {
+				mesh = &processedMesh;
+			} else {
+				m_processedMeshes.pop_back();
+			}
 		}
 
-		// Write the meshes that are described in this mesh data.
+		Mesh fileMesh;
+		fileMesh.name = addString(mesh->name);
+		fileMesh.primitiveTopology = topologyFromPrimitiveTopology(mesh->primitiveTopology);
+		fileMesh.vbByteOffset = mesh->vbByteOffset;
+		fileMesh.ibByteOffset = mesh->ibByteOffset;
+		fileMesh.ibFormat = dataFormatFromUniformType(mesh->ibFmt);
+		fileMesh.numElements = mesh->numElements;
+		fileMesh.numVertices = mesh->numVertices;
 
-		// Draw call settings.
-		jMesh->setMember("name", jvb(mesh->name));
-		jMesh->setMember("primitiveTopology", jvb(PrimitiveTopology2String(mesh->primitiveTopology)));
-		jMesh->setMember("vbByteOffset", jvb((int)mesh->vbByteOffset));
-		jMesh->setMember("numElements", jvb((int)mesh->numElements));
-		jMesh->setMember("numVertices", jvb((int)mesh->numVertices));
+		// Write the vertex/index buffers chunks.
+		fileMesh.vertexDataChunk = -1;
+		if (mesh->vertexBufferRaw.empty() == false) {
+			fileMesh.vertexDataChunk = newDataChunkFromPtr(mesh->vertexBufferRaw.data(), mesh->vertexBufferRaw.size());
+		}
 
-		if (mesh->ibFmt != UniformType::Unknown) {
-			jMesh->setMember("ibByteOffset", jvb((int)mesh->ibByteOffset));
-			jMesh->setMember("ibFormat", jvb(UnformType2String(mesh->ibFmt)));
+		fileMesh.indexDataChunk = -1;
+		if (mesh->indexBufferRaw.empty() == false) {
+			fileMesh.indexDataChunk = newDataChunkFromPtr(mesh->indexBufferRaw.data(), mesh->indexBufferRaw.size());
 		}
 
 		// Vertex declaration.
-		JsonValue* jVertexDecl = jMesh->setMember("vertexDecl", jvb(JID_ARRAY));
-		for (auto& v : mesh->vertexDecl) {
-			JsonValue* jDecl = jVertexDecl->arrPush(jvb(JID_MAP));
-			jDecl->setMember("semantic", jvb(v.semantic.c_str()));
-			jDecl->setMember("byteOffset", jvb((int)v.byteOffset));
-			jDecl->setMember("format", jvb(UnformType2String(v.format)));
+		fileMesh.firstVertexDecl = uint32(m_vertexDecls.size());
+		fileMesh.numVertexDecls = uint32(mesh->vertexDecl.size());
+		for (const sge::VertexDecl& decl : mesh->vertexDecl) {
+			ModelFileV2::VertexDecl fileDecl;
+			fileDecl.semantic = addString(decl.semantic);
+			fileDecl.byteOffset = decl.byteOffset;
+			fileDecl.format = dataFormatFromUniformType(decl.format);
+			sgeAssert(fileDecl.format != dataFormat_unknown);
+			m_vertexDecls.push_back(fileDecl);
 		}
 
 		// Bones(if any).
-		if (mesh->bones.size() != 0) {
-			auto jBones = jMesh->setMember("bones", jvb(JID_ARRAY_BEGIN));
-			for (const auto& bone : mesh->bones) {
-				const int boneOffsetChunkId = newDataChunkFromPtr(&bone.offsetMatrix, sizeof(bone.offsetMatrix));
-
-				auto jBone = jBones->arrPush(jvb(JID_MAP_BEGIN));
-				jBone->setMember("boneIndex", jvb(bone.nodeIdx));
-				jBone->setMember("offsetMatrixChunkId", jvb(boneOffsetChunkId));
-			}
+		fileMesh.firstBone = uint32(m_bones.size());
+		fileMesh.numBones = uint32(mesh->bones.size());
+		for (const ModelMeshBone& bone : mesh->bones) {
+			Bone fileBone;
+			copyFloats(fileBone.offsetMatrix, bone.offsetMatrix.data[0].data, 16);
+			fileBone.nodeIndex = bone.nodeIdx;
+			m_bones.push_back(fileBone);
+		}
+
+		// Lower detail index buffers.
+		fileMesh.firstLod = uint32(m_meshLods.size());
+		fileMesh.numLods = uint32(mesh->lods.size());
+		for (const ModelMeshLod& lod : mesh->lods) {
+			MeshLod fileLod;
+			fileLod.indexDataChunk = newDataChunkFromPtr(lod.indexBufferRaw.data(), lod.indexBufferRaw.size());
+			fileLod.numElements = lod.numElements;
+			fileLod.error = lod.error;
+			fileLod.reserved = 0;
+			m_meshLods.push_back(fileLod);
 		}
 
 		// Axis aligned bounding box.
-		jMesh->setMember("AABoxMin", jvb((float*)&mesh->aabox.min.x, 3));
-		jMesh->setMember("AABoxMax", jvb((float*)&mesh->aabox.max.x, 3));
+		copyFloats(fileMesh.aaboxMin, mesh->aabox.min.data, 3);
+		copyFloats(fileMesh.aaboxMax, mesh->aabox.max.data, 3);
+
+		// Vertex attributes dequantization.
+		copyFloats(fileMesh.positionDequantScale, mesh->dequantization.positionScale.data, 3);
+		copyFloats(fileMesh.positionDequantOffset, mesh->dequantization.positionOffset.data, 3);
+		copyFloats(fileMesh.uvDequantScale, mesh->dequantization.uvScale.data, 2);
+		copyFloats(fileMesh.uvDequantOffset, mesh->dequantization.uvOffset.data, 2);
+		fileMesh.quantizationFlags = 0;
+		fileMesh.quantizationFlags |= mesh->dequantization.hasQuantizedPositions ? quantizationFlags_positions : 0;
+		fileMesh.quantizationFlags |= mesh->dequantization.hasOctahedralNormals ? quantizationFlags_octahedralNormals : 0;
+
+		m_meshes.push_back(fileMesh);
 	}
-
-	return;
 }
 
 void ModelWriter::writeCollisionData() {
-	const auto transf3dToJson = [&](const transf3d& tr) -> JsonValue* {
-		JsonValue* j = jvb(JID_MAP);
-		j->setMember("p", jvb(tr.p.data, 3));
-		j->setMember("r", jvb(tr.r.data, 4));
-		j->setMember("s", jvb(tr.s.data, 3));
-
-		return j;
-	};
-
-	// Write the convex hull that are evaluated at the static moment.
-	if (model->m_convexHulls.size()) {
-		JsonValue* jStaticConvecHulls = root->setMember("staticConvexHulls", jvb(JID_ARRAY));
-
-		for (int t = 0; t < model->m_convexHulls.size(); ++t) {
-			JsonValue* const jHull = jStaticConvecHulls->arrPush(jvb(JID_MAP));
-			const int hullVertsChunkId = newChunkFromStdVector(model->m_convexHulls[t].vertices);
-			const int hullIndsChunkId = newChunkFromStdVector(model->m_convexHulls[t].indices);
-			jHull->setMember("vertsChunkId", jvb(hullVertsChunkId));
-			jHull->setMember("indicesChunkId", jvb(hullIndsChunkId));
-		}
+	for (const ModelCollisionMesh& hull : model->m_convexHulls) {
+		m_convexHulls.push_back(CollisionHull{newChunkFromStdVector(hull.vertices), newChunkFromStdVector(hull.indices)});
 	}
 
-	// Write the conave hull that are evaluated at the static moment.
-	if (model->m_concaveHulls.size()) {
-		JsonValue* jStaticConvecHulls = root->setMember("staticConcaveHulls", jvb(JID_ARRAY));
-
-		for (int t = 0; t < model->m_concaveHulls.size(); ++t) {
-			JsonValue* const jHull = jStaticConvecHulls->arrPush(jvb(JID_MAP));
-			const int hullVertsChunkId = newChunkFromStdVector(model->m_concaveHulls[t].vertices);
-			const int hullIndsChunkId = newChunkFromStdVector(model->m_concaveHulls[t].indices);
-			jHull->setMember("vertsChunkId", jvb(hullVertsChunkId));
-			jHull->setMember("indicesChunkId", jvb(hullIndsChunkId));
-		}
+	for (const ModelCollisionMesh& hull : model->m_concaveHulls) {
+		m_concaveHulls.push_back(CollisionHull{newChunkFromStdVector(hull.vertices), newChunkFromStdVector(hull.indices)});
 	}
 
-	// Write the boxes
-	if (model->m_collisionBoxes.size()) {
-		JsonValue* const jShapes = root->setMember("collisionBoxes", jvb(JID_ARRAY));
-		for (int t = 0; t < model->m_collisionBoxes.size(); ++t) {
-			const auto& shape = model->m_collisionBoxes[t];
-			JsonValue* const jShape = jShapes->arrPush(jvb(JID_MAP));
-
-			jShape->setMember("name", jvb(shape.name.c_str()));
-			jShape->setMember("transform", transf3dToJson(shape.transform));
-			jShape->setMember("halfDiagonal", jvb(shape.halfDiagonal.data, 3));
-		}
+	for (const Model_CollisionShapeBox& shape : model->m_collisionBoxes) {
+		CollisionBox fileShape;
+		fileShape.name = addString(shape.name);
+		fileShape.transform = toFileTransform(shape.transform);
+		copyFloats(fileShape.halfDiagonal, shape.halfDiagonal.data, 3);
+		m_collisionBoxes.push_back(fileShape);
 	}
 
-	// Write the capsules
-	if (model->m_collisionCapsules.size()) {
-		JsonValue* const jShapes = root->setMember("collisionCapsules", jvb(JID_ARRAY));
-		for (int t = 0; t < model->m_collisionCapsules.size(); ++t) {
-			const auto& shape = model->m_collisionCapsules[t];
-			JsonValue* const jShape = jShapes->arrPush(jvb(JID_MAP));
-
-			jShape->setMember("name", jvb(shape.name.c_str()));
-			jShape->setMember("transform", transf3dToJson(shape.transform));
-			jShape->setMember("halfHeight", jvb(shape.halfHeight));
-			jShape->setMember("radius", jvb(shape.radius));
-		}
+	for (const Model_CollisionShapeCapsule& shape : model->m_collisionCapsules) {
+		CollisionCapsule fileShape;
+		fileShape.name = addString(shape.name);
+		fileShape.transform = toFileTransform(shape.transform);
+		fileShape.halfHeight = shape.halfHeight;
+		fileShape.radius = shape.radius;
+		m_collisionCapsules.push_back(fileShape);
 	}
 
-	// Write the cylinders
-	if (model->m_collisionCylinders.size()) {
-		JsonValue* const jShapes = root->setMember("collisionCylinders", jvb(JID_ARRAY));
-		for (int t = 0; t < model->m_collisionCylinders.size(); ++t) {
-			const auto& shape = model->m_collisionCylinders[t];
-			JsonValue* const jShape = jShapes->arrPush(jvb(JID_MAP));
-
-			jShape->setMember("name", jvb(shape.name.c_str()));
-			jShape->setMember("transform", transf3dToJson(shape.transform));
-			jShape->setMember("halfDiagonal", jvb(shape.halfDiagonal.data, 3));
-		}
+	for (const Model_CollisionShapeCylinder& shape : model->m_collisionCylinders) {
+		CollisionCylinder fileShape;
+		fileShape.name = addString(shape.name);
+		fileShape.transform = toFileTransform(shape.transform);
+		copyFloats(fileShape.halfDiagonal, shape.halfDiagonal.data, 3);
+		m_collisionCylinders.push_back(fileShape);
 	}
 
-	// Write the spheres.
-	if (model->m_collisionSpheres.size()) {
-		JsonValue* const jShapes = root->setMember("collisionSpheres", jvb(JID_ARRAY));
-		for (int t = 0; t < model->m_collisionSpheres.size(); ++t) {
-			const auto& shape = model->m_collisionSpheres[t];
-			JsonValue* const jShape = jShapes->arrPush(jvb(JID_MAP));
-
-			jShape->setMember("name", jvb(shape.name.c_str()));
-			jShape->setMember("transform", transf3dToJson(shape.transform));
-			jShape->setMember("radius", jvb(shape.radius));
-		}
+	for (const Model_CollisionShapeSphere& shape : model->m_collisionSpheres) {
+		CollisionSphere fileShape;
+		fileShape.name = addString(shape.name);
+		fileShape.transform = toFileTransform(shape.transform);
+		fileShape.radius = shape.radius;
+		m_collisionSpheres.push_back(fileShape);
 	}
 }
 
@@ -395,43 +399,87 @@ bool ModelWriter::write(const Model& modelToWrite, IWriteStream* iws) {
 		return false;
 	}
 
+	resetState();
 	this->model = &modelToWrite;
 
-	root = jvb(JID_MAP);
-
-	// The version of the file format.
-	// 0 is the starting version.
-	root->setMember("version", jvb(0));
-
 	writeNodes();
 	writeMaterials();
 	writeMeshes();
 	writeAnimations();
 	writeCollisionData();
 
-	// Generate the json that describes the data chunks.
-	JsonValue* const jDataChunkDesc = root->setMember("dataChunksDesc", jvb(JID_ARRAY));
+	// Now that all arrays are filled (and will no longer get reallocated) add them as chunks.
+	newChunkFromStdVector(m_strings, chunkType_strings);
+	newChunkFromStdVector(m_nodes, chunkType_nodes);
+	newChunkFromStdVector(m_nodeMeshAttachments, chunkType_nodeMeshAttachments);
+	newChunkFromStdVector(m_nodeChildren, chunkType_nodeChildren);
+	newChunkFromStdVector(m_materials, chunkType_materials);
+	newChunkFromStdVector(m_meshes, chunkType_meshes);
+	newChunkFromStdVector(m_vertexDecls, chunkType_vertexDecls);
+	newChunkFromStdVector(m_bones, chunkType_bones);
+	newChunkFromStdVector(m_animations, chunkType_animations);
+	newChunkFromStdVector(m_animationTracks, chunkType_animationTracks);
+	newChunkFromStdVector(m_convexHulls, chunkType_convexHulls);
+	newChunkFromStdVector(m_concaveHulls, chunkType_concaveHulls);
+	newChunkFromStdVector(m_collisionBoxes, chunkType_collisionBoxes);
+	newChunkFromStdVector(m_collisionCapsules, chunkType_collisionCapsules);
+	newChunkFromStdVector(m_collisionCylinders, chunkType_collisionCylinders);
+	newChunkFromStdVector(m_collisionSpheres, chunkType_collisionSpheres);
+	newChunkFromStdVector(m_meshLods, chunkType_meshLods);
+
+	const auto alignUp = [](const uint64 offset) -> uint64 { return (offset + kChunkAlignment - 1) & ~uint64(kChunkAlignment - 1); };
+
+	// Compute the layout of the file.
+	FileHeader header;
+	memcpy(header.magic, kMagic, sizeof(header.magic));
+	header.version = kVersion;
+	header.numChunks = uint32(dataChunks.size());
+	header.chunkTableByteOffset = sizeof(FileHeader);
+	header.rootNodeIndex = model->getRootNodeIndex();
+	header.reserved = 0;
+
+	std::vector<ChunkDesc> chunkTable(dataChunks.size());
+	const uint64 firstChunkByteOffset = alignUp(header.chunkTableByteOffset + sizeof(ChunkDesc) * chunkTable.size());
+	uint64 offsetBytesAccum = firstChunkByteOffset;
+	for (size_t iChunk = 0; iChunk < dataChunks.size(); ++iChunk) {
+		ChunkDesc& desc = chunkTable[iChunk];
+		desc.type = dataChunks[iChunk].type;
+		desc.reserved = 0;
+		desc.byteOffset = offsetBytesAccum;
+		desc.sizeBytes = dataChunks[iChunk].sizeBytes;
+		desc.reserved2 = 0;
+
+		offsetBytesAccum = alignUp(offsetBytesAccum + desc.sizeBytes);
+	}
 
-	size_t offsetBytesAccum = 0;
-	for (const DataChunk& chunk : dataChunks) {
-		// Output layout [ ... id, offset, size, ... ]
-		jDataChunkDesc->arrPush(jvb(chunk.id));
-		jDataChunkDesc->arrPush(jvb((int)offsetBytesAccum));
-		jDataChunkDesc->arrPush(jvb((int)chunk.sizeBytes));
+	// Write the header, the chunk table and then the chunks.
+	uint64 bytesWritten = 0;
+	const char zeroes[kChunkAlignment] = {0};
+	const auto writePaddingTo = [&](const uint64 offset) -> void {
+		sgeAssert(offset >= bytesWritten && offset - bytesWritten <= kChunkAlignment);
+		bytesWritten += iws->write(zeroes, size_t(offset - bytesWritten));
+	};
 
-		offsetBytesAccum += chunk.sizeBytes;
+	bytesWritten += iws->write((const char*)&header, sizeof(header));
+	if (chunkTable.empty() == false) {
+		bytesWritten += iws->write((const char*)chunkTable.data(), sizeof(ChunkDesc) * chunkTable.size());
 	}
 
-	// Now write the json header.
-	JsonWriter jsonWriter;
-	jsonWriter.write(iws, root, true);
+	for (size_t iChunk = 0; iChunk < dataChunks.size(); ++iChunk) {
+		writePaddingTo(chunkTable[iChunk].byteOffset);
+		bytesWritten += iws->write((const char*)dataChunks[iChunk].data, dataChunks[iChunk].sizeBytes);
+	}
 
-	// And now write the data chunks data.
-	for (const DataChunk& chunk : dataChunks) {
-		iws->write((char*)chunk.data, chunk.sizeBytes);
+	// A model without any data has no chunks, the file is just the padded header.
+	if (chunkTable.empty()) {
+		writePaddingTo(firstChunkByteOffset);
 	}
 
-	return true;
+	const uint64 expectedBytesWritten =
+	    chunkTable.empty() ? firstChunkByteOffset : chunkTable.back().byteOffset + chunkTable.back().sizeBytes;
+	const bool succeeded = bytesWritten == expectedBytesWritten;
+	resetState();
+	return succeeded;
 }
 
 bool ModelWriter::write(const Model& modelToWrite, const char* const filename) {
@@ -439,12 +487,25 @@ bool ModelWriter::write(const Model& modelToWrite, const char* const filename) {
 		return false;
 	}
 
+	// Loaded models might be memory mapping the file that we are about to overwrite.
+	// Write to a temporary file and then replace the old one, so existing mappings keep seeing the old contents.
+	const std::string tempFilename = std::string(filename) + ".tmp";
+
 	FileWriteStream fws;
-	if (!fws.open(filename)) {
+	if (!fws.open(tempFilename.c_str())) {
 		sgeAssert(false);
 		return false;
 	}
 
-	return write(modelToWrite, &fws);
+	const bool succeeded = write(modelToWrite, &fws);
+	fws.close();
+
+	if (!succeeded) {
+		std::remove(tempFilename.c_str());
+		return false;
+	}
+
+	std::remove(filename);
+	return std::rename(tempFilename.c_str(), filename) == 0;
 }
 } // namespace sge
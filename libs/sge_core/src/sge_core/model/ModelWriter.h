@@ -1,65 +1,135 @@
 #pragma once
 
-#include "sge_core/sgecore_api.h"
-#include "sge_utils/utils/json.h"
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sge_core/model/AnimationCompressor.h"
+#include "sge_core/model/ModelFileFormat.h"
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/utils/IStream.h"
 
 namespace sge {
 
 struct Model;
+struct ModelMesh;
 struct KeyFrames;
+struct ModelAnimation;
+struct transf3d;
 
+/// @brief Writes a @Model in the version 2 *.mdl format. See @ModelFileV2 for a description of the format.
 class SGE_CORE_API ModelWriter {
   public:
 	struct DataChunk {
 		DataChunk() = default;
 
-		DataChunk(int id, const void* data, size_t sizeBytes)
-		    : id(id)
+		DataChunk(ModelFileV2::ChunkType type, const void* data, size_t sizeBytes)
+		    : type(type)
 		    , data(data)
 		    , sizeBytes(sizeBytes) {}
 
-		int id;
-		const void* data;
-		size_t sizeBytes;
+		ModelFileV2::ChunkType type = ModelFileV2::chunkType_raw;
+		const void* data = nullptr;
+		size_t sizeBytes = 0;
 	};
 
-	ModelWriter() = default;
-	~ModelWriter() {}
+	ModelWriter();
+	~ModelWriter();
 
 	bool write(const Model& modelToWrite, IWriteStream* iws);
 	bool write(const Model& modelToWrite, const char* const filename);
 
+  public:
+	/// If true the vertex and index buffers of the meshes get reordered for faster rendering before being written.
+	/// See @MeshOptimizer for details.
+	bool optimizeMeshes = true;
+
+	/// The number of lower detail versions to be generated for meshes that do not have any. 0 disables the generation.
+	/// See @MeshSimplifier for details.
+	int numLodsToGenerate = 3;
+
+	/// Meshes with fewer triangles are too cheap to render for LODs to be worth it.
+	int minTrianglesForLodGeneration = 256;
+
+	/// If true the normals, tangents, binormals and uvs of the meshes get stored in 16bit formats.
+	/// See @MeshQuantizer for details.
+	bool quantizeVertices = true;
+
+	/// If true (and @quantizeVertices is true) the positions are also stored in 16bit format relative to the mesh bounding box.
+	/// Disabled by default as the precision might not be enough for big meshes.
+	bool quantizePositions = false;
+
+	/// If true the animations get compressed with an error bound specified by @animationCompression.
+	/// See @AnimationCompressor for details.
+	bool compressAnimations = true;
+	AnimationCompressor::Settings animationCompression;
 
   private:
-	// Returns the chunk id.
-	int newDataChunkFromPtr(const void* const ptr, const size_t sizeBytes);
-	char* newDataChunkWithSize(size_t sizeBytes, int& outChunkId);
+	/// Resets the state of the writer (but not the settings), so it could be used to write another model.
+	void resetState();
+
+	// Returns the chunk index in the chunk table.
+	int newDataChunkFromPtr(const void* const ptr, const size_t sizeBytes, ModelFileV2::ChunkType type = ModelFileV2::chunkType_raw);
+
+	// Allocates memory owned by the writer and makes a chunk out of it.
+	// The returned pointer is valid until the end of the write() call.
+	char* newDataChunkWithSize(size_t sizeBytes, int& outChunkIndex, ModelFileV2::ChunkType type = ModelFileV2::chunkType_raw);
 
 	// This function assumes that the vector wont be resized(aka. the data pointer won't change).
 	template <typename T>
-	int newChunkFromStdVector(const std::vector<T>& data) {
-		return newDataChunkFromPtr(data.data(), data.size() * sizeof(T));
+	int newChunkFromStdVector(const std::vector<T>& data, ModelFileV2::ChunkType type = ModelFileV2::chunkType_raw) {
+		if (data.empty()) {
+			return -1;
+		}
+		return newDataChunkFromPtr(data.data(), data.size() * sizeof(T), type);
 	}
 
-	// The actiual writer is implemented in those functions.
-	void writeAnimations();
-	void writeNodes();     // Add the "nodes" to the root.
-	void writeMaterials(); // Add the "materials" to the root.
+	/// Adds the string to the strings table (if not already there) and returns its offset.
+	uint32 addString(const std::string& str);
+
+	// The actual writer is implemented in those functions.
+	void writeNodes();
+	void writeMaterials();
 	void writeMeshes();
+	void writeAnimations();
 	void writeCollisionData();
 
-	/// @brief Generates the json and allocated a data chunks for the specified keyframes.
-	JsonValue* generateKeyFrames(const KeyFrames& keyfames);
-
-	JsonValueBuffer jvb;
-	std::vector<DataChunk> dataChunks; // A list of the data chunks that will end up written to the file.
-	JsonValue* root;                   // The file header json element.
-	const Model* model;                // The working model
-
-	/// Ultra ugly, we assume that these elements are going to get moved.
-	/// [MODERL_WRITER_MOVE_ASSUME]
-	std::vector<std::vector<char>> m_dynamicallyAlocatedPointersToDelete;
+	/// @brief Allocates the data chunks for the specified keyframes.
+	ModelFileV2::AnimationTrack generateKeyFrames(int nodeIndex, const KeyFrames& keyfames);
+
+	const Model* model = nullptr; // The working model
+	std::vector<DataChunk> dataChunks;
+
+	std::vector<char> m_strings;
+	std::unordered_map<std::string, uint32> m_stringOffsets;
+
+	std::vector<ModelFileV2::Node> m_nodes;
+	std::vector<ModelFileV2::NodeMeshAttachment> m_nodeMeshAttachments;
+	std::vector<sint32> m_nodeChildren;
+	std::vector<ModelFileV2::Material> m_materials;
+	std::vector<ModelFileV2::Mesh> m_meshes;
+	std::vector<ModelFileV2::VertexDecl> m_vertexDecls;
+	std::vector<ModelFileV2::Bone> m_bones;
+	std::vector<ModelFileV2::Animation> m_animations;
+	std::vector<ModelFileV2::AnimationTrack> m_animationTracks;
+	std::vector<ModelFileV2::CollisionHull> m_convexHulls;
+	std::vector<ModelFileV2::CollisionHull> m_concaveHulls;
+	std::vector<ModelFileV2::CollisionBox> m_collisionBoxes;
+	std::vector<ModelFileV2::CollisionCapsule> m_collisionCapsules;
+	std::vector<ModelFileV2::CollisionCylinder> m_collisionCylinders;
+	std::vector<ModelFileV2::CollisionSphere> m_collisionSpheres;
+	std::vector<ModelFileV2::MeshLod> m_meshLods;
+
+	/// Copies of the meshes that were optimized or got LODs generated before writing them,
+	/// see @optimizeMeshes, @numLodsToGenerate and @quantizeVertices.
+	std::vector<ModelMesh> m_processedMeshes;
+
+	/// Copies of the animations that were compressed before writing them, see @compressAnimations.
+	std::vector<ModelAnimation> m_processedAnimations;
+
+	/// Memory allocated by @newDataChunkWithSize, it is freed when the writer is destroyed.
+	std::vector<std::unique_ptr<char[]>> m_dynamicallyAlocatedPointersToDelete;
 };
 
 } // namespace sge
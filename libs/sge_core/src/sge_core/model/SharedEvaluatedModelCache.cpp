@@ -0,0 +1,148 @@
+#include <algorithm>
+
+#include "EvaluatedModel.h"
+#include "SharedEvaluatedModelCache.h"
+#include "sge_utils/utils/hash_combine.h"
+
+namespace sge {
+
+namespace {
+
+	bool isMaterialEqual(const Material& a, const Material& b) {
+		return a.uvwTransform == b.uvwTransform && a.diffuseColor == b.diffuseColor && a.texNormalMap == b.texNormalMap &&
+		       a.diffuseTexture == b.diffuseTexture && a.diffuseTextureX == b.diffuseTextureX && a.diffuseTextureY == b.diffuseTextureY &&
+		       a.diffuseTextureZ == b.diffuseTextureZ && a.texMetalness == b.texMetalness && a.texRoughness == b.texRoughness &&
+		       a.diffuseTexXYZScaling == b.diffuseTexXYZScaling && a.fluidColor0 == b.fluidColor0 && a.fluidColor1 == b.fluidColor1 &&
+		       a.metalness == b.metalness && a.roughness == b.roughness && a.disableCulling == b.disableCulling;
+	}
+
+	/// Hashes only the fields that usually differ, the equal materials still get equal hashes.
+	size_t hashMaterialOverride(const MaterialOverride& ovr) {
+		size_t hash = hashCString_djb2(ovr.name.c_str());
+		hash = hash_combine(hash, size_t(hash_djb2((const char*)ovr.mtl.diffuseColor.data, sizeof(ovr.mtl.diffuseColor))));
+		hash = hash_combine(hash, size_t(ovr.mtl.diffuseTexture));
+		hash = hash_combine(hash, size_t(ovr.mtl.texNormalMap));
+		hash = hash_combine(hash, size_t(hash_djb2((const char*)&ovr.mtl.metalness, sizeof(float))));
+		hash = hash_combine(hash, size_t(hash_djb2((const char*)&ovr.mtl.roughness, sizeof(float))));
+		return hash;
+	}
+
+} // namespace
+
+void SharedEvaluatedModelCache::initialize(const EvaluatedModel* evalModel) {
+	clear();
+	m_evalModel = evalModel;
+}
+
+std::shared_ptr<const SharedEvaluatedModel> SharedEvaluatedModelCache::acquire(const std::vector<MaterialOverride>& overrides,
+                                                                               const std::shared_ptr<const SharedEvaluatedModel>& current) {
+	const size_t overridesHash = hashMaterialOverrides(overrides);
+
+	if (current != nullptr && isMatching(*current, overrides, overridesHash)) {
+		return current;
+	}
+
+	std::vector<std::weak_ptr<const SharedEvaluatedModel>>& bucket = m_entries[overridesHash];
+	for (const std::weak_ptr<const SharedEvaluatedModel>& weakEntry : bucket) {
+		std::shared_ptr<const SharedEvaluatedModel> entry = weakEntry.lock();
+		if (entry != nullptr && isMatching(*entry, overrides, overridesHash)) {
+			return entry;
+		}
+	}
+
+	// Create a new entry, the overrides get resolved once for all instances that use them.
+	std::shared_ptr<SharedEvaluatedModel> newEntry = std::make_shared<SharedEvaluatedModel>();
+	newEntry->evalModel = m_evalModel;
+	newEntry->materialOverrides = overrides;
+	newEntry->overridesHash = overridesHash;
+	newEntry->cache = this;
+	newEntry->cacheGeneration = m_generation;
+
+	std::sort(newEntry->materialOverrides.begin(), newEntry->materialOverrides.end(),
+	          [](const MaterialOverride& a, const MaterialOverride& b) -> bool { return a.name < b.name; });
+
+	const Model* const model = (m_evalModel != nullptr) ? m_evalModel->m_model : nullptr;
+	const int numMaterials = (model != nullptr) ? model->numMaterials() : 0;
+	newEntry->overrideIndexPerMaterial.assign(numMaterials, -1);
+	for (int iMaterial = 0; iMaterial < numMaterials; ++iMaterial) {
+		const std::string& materialName = model->materialAt(iMaterial)->name;
+		for (int iOverride = 0; iOverride < int(newEntry->materialOverrides.size()); ++iOverride) {
+			if (newEntry->materialOverrides[iOverride].name == materialName) {
+				newEntry->overrideIndexPerMaterial[iMaterial] = iOverride;
+				break;
+			}
+		}
+	}
+
+	// New combinations of overrides are rare, a good moment to forget the unused ones.
+	removeExpiredEntries();
+	m_entries[overridesHash].push_back(newEntry);
+
+	return newEntry;
+}
+
+void SharedEvaluatedModelCache::clear() {
+	m_entries.clear();
+	m_generation++;
+}
+
+int SharedEvaluatedModelCache::getNumAliveEntries() const {
+	int numAlive = 0;
+	for (const auto& itr : m_entries) {
+		for (const std::weak_ptr<const SharedEvaluatedModel>& weakEntry : itr.second) {
+			numAlive += weakEntry.expired() ? 0 : 1;
+		}
+	}
+	return numAlive;
+}
+
+size_t SharedEvaluatedModelCache::hashMaterialOverrides(const std::vector<MaterialOverride>& overrides) {
+	// The sum doesn't depend on the order of the overrides.
+	size_t hash = overrides.size();
+	for (const MaterialOverride& ovr : overrides) {
+		hash += hashMaterialOverride(ovr);
+	}
+	return hash;
+}
+
+bool SharedEvaluatedModelCache::areMaterialOverridesEqual(const std::vector<MaterialOverride>& a, const std::vector<MaterialOverride>& b) {
+	if (a.size() != b.size()) {
+		return false;
+	}
+
+	for (const MaterialOverride& ovrA : a) {
+		const auto itr = std::find_if(b.begin(), b.end(), [&ovrA](const MaterialOverride& ovrB) -> bool {
+			return ovrA.name == ovrB.name && isMaterialEqual(ovrA.mtl, ovrB.mtl);
+		});
+
+		if (itr == b.end()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool SharedEvaluatedModelCache::isMatching(const SharedEvaluatedModel& entry,
+                                           const std::vector<MaterialOverride>& overrides,
+                                           const size_t overridesHash) const {
+	return entry.cache == this && entry.cacheGeneration == m_generation && entry.overridesHash == overridesHash &&
+	       areMaterialOverridesEqual(entry.materialOverrides, overrides);
+}
+
+void SharedEvaluatedModelCache::removeExpiredEntries() {
+	for (auto itr = m_entries.begin(); itr != m_entries.end();) {
+		std::vector<std::weak_ptr<const SharedEvaluatedModel>>& bucket = itr->second;
+		bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+		                            [](const std::weak_ptr<const SharedEvaluatedModel>& weakEntry) -> bool { return weakEntry.expired(); }),
+		             bucket.end());
+
+		if (bucket.empty()) {
+			itr = m_entries.erase(itr);
+		} else {
+			++itr;
+		}
+	}
+}
+
+} // namespace sge
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "sge_core/Geometry.h"
+#include "sge_core/sgecore_api.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+struct EvaluatedModel;
+struct SharedEvaluatedModelCache;
+
+struct MaterialOverride {
+	std::string name;
+	Material mtl;
+};
+
+/// @brief A static evaluation of a model together with a set of material overrides. It is shared between all instances
+/// of the model that use the same overrides, see @SharedEvaluatedModelCache.
+struct SharedEvaluatedModel {
+	const EvaluatedModel* evalModel = nullptr;
+
+	/// The overrides sorted by name.
+	std::vector<MaterialOverride> materialOverrides;
+
+	/// For each material of the model the index of its override in @materialOverrides, -1 if the material isn't overridden.
+	std::vector<int> overrideIndexPerMaterial;
+
+	size_t overridesHash = 0;
+
+	const SharedEvaluatedModelCache* cache = nullptr;
+	uint32 cacheGeneration = 0;
+};
+
+/// @brief A cache of @SharedEvaluatedModel for a single model, keyed by the material overrides of the instances.
+/// Many instances of the same static model (trees, rocks, props) share the node transforms, the bounding boxes and the
+/// evaluated materials of the model. Only the overrides make them look different, so the instances with the same overrides
+/// also share the resolved overrides and the per-instance state is just a reference counted pointer.
+/// Entries that are no longer referenced by any instance are removed when new entries get created.
+struct SGE_CORE_API SharedEvaluatedModelCache {
+	/// @brief Clears the cache and sets the evaluation of the model to be shared. It must outlive the cache.
+	void initialize(const EvaluatedModel* evalModel);
+
+	/// @brief Returns the shared evaluation with the specified overrides (the order doesn't matter), creating it if needed.
+	/// @param [in] current the entry used by the instance so far. If it still matches the overrides it gets returned without a lookup.
+	std::shared_ptr<const SharedEvaluatedModel> acquire(const std::vector<MaterialOverride>& overrides,
+	                                                    const std::shared_ptr<const SharedEvaluatedModel>& current = nullptr);
+
+	/// Removes all entries. The entries already acquired stay valid but are no longer returned by @acquire.
+	void clear();
+
+	/// Returns the number of entries that are still used by some instance.
+	int getNumAliveEntries() const;
+
+	/// @brief Computes a hash of the overrides that doesn't depend on their order.
+	static size_t hashMaterialOverrides(const std::vector<MaterialOverride>& overrides);
+
+	/// @brief Returns true if both arrays have the same overrides, the order doesn't matter.
+	static bool areMaterialOverridesEqual(const std::vector<MaterialOverride>& a, const std::vector<MaterialOverride>& b);
+
+  private:
+	bool isMatching(const SharedEvaluatedModel& entry, const std::vector<MaterialOverride>& overrides, const size_t overridesHash) const;
+	void removeExpiredEntries();
+
+  private:
+	const EvaluatedModel* m_evalModel = nullptr;
+	uint32 m_generation = 0;
+	std::unordered_map<size_t, std::vector<std::weak_ptr<const SharedEvaluatedModel>>> m_entries;
+};
+
+} // namespace sge
@@ -27,6 +27,8 @@ void ConstantColorWireShader::drawGeometry(
 		uProjView,
 		uSkinningBones,
 		uSkinningFirstBoneOffsetInTex,
+		uPositionDequantScale,
+		uPositionDequantOffset,
 	};
 
 	if (shadingPermut.isValid() == false) {
@@ -44,6 +46,8 @@ void ConstantColorWireShader::drawGeometry(
 		    {uProjView, "uProjView", ShaderType::VertexShader},
 			{uSkinningBones, "uSkinningBones", ShaderType::VertexShader},
 			{uSkinningFirstBoneOffsetInTex, "uSkinningFirstBoneOffsetInTex", ShaderType::VertexShader},
+			{uPositionDequantScale, "uPositionDequantScale", ShaderType::VertexShader},
+			{uPositionDequantOffset, "uPositionDequantOffset", ShaderType::VertexShader},
 		};
 		// clang-format on
 
@@ -98,6 +102,8 @@ void ConstantColorWireShader::drawGeometry(
 	shaderPerm.bind<24>(uniforms, uWorld, (void*)&world);
 	shaderPerm.bind<24>(uniforms, uProjView, (void*)&projView);
 	shaderPerm.bind<24>(uniforms, uColor, (void*)&shadingColor);
+	shaderPerm.bind<24>(uniforms, uPositionDequantScale, (void*)&geometry.dequantization.positionScale);
+	shaderPerm.bind<24>(uniforms, uPositionDequantOffset, (void*)&geometry.dequantization.positionOffset);
 
 	if (optHasVertexSkinning == kHasVertexSkinning_Yes) {
 		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uSkinningBones], (geometry.skinningBoneTransforms)));
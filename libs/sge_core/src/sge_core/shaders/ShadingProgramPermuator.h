@@ -25,7 +25,7 @@ struct SGE_CORE_API ShadingProgramPermuator {
 
 		/// Using the cached bind locations for each uniforms, binds the input data to the specified uniform
 		/// in in the @uniforms.
-		template <size_t N>
+		template <int N>
 		void bind(StaticArray<BoundUniform, N>& uniforms, const int uniformEnumId, void* const dataPointer) const {
 			if (uniformLUT[uniformEnumId].isNull() == false) {
 				[[maybe_unused]] bool bindSucceeded = uniforms.push_back(BoundUniform(uniformLUT[uniformEnumId], (dataPointer)));
@@ -1,4 +1,5 @@
 #include "SkyShader.h"
+#include "sge_core/AssetLibrary.h"
 #include "sge_core/GeomGen.h"
 #include "sge_core/ICore.h"
 #include "sge_utils/math/Frustum.h"
@@ -106,6 +107,8 @@ void SkyShader::draw(const RenderDestination& rdest, const vec3f&, const mat4f v
 	shaderPerm.bind(uniforms, uParamsCb_vertex, cbParms.GetPtr());
 	shaderPerm.bind(uniforms, uParamsCb_pixel, cbParms.GetPtr());
 	shaderPerm.bind(uniforms, uSkyTexture, sets.texture);
+	// The sky covers the whole screen.
+	getCore()->getAssetLib()->getTextureStreaming().requestMip(sets.texture, 0);
 
 	stateGroup.setProgram(shaderPerm.shadingProgram.GetPtr());
 	stateGroup.setPrimitiveTopology(PrimitiveTopology::TriangleList);
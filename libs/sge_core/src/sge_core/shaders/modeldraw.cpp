@@ -1,10 +1,14 @@
 #include "modeldraw.h"
 #include "sge_core/AssetLibrary.h"
 #include "sge_core/ICore.h"
+#include "sge_core/LightClusters.h"
 #include "sge_core/model/EvaluatedModel.h"
 #include "sge_core/model/Model.h"
 #include "sge_renderer/renderer/renderer.h"
 #include "sge_utils/utils/FileStream.h"
+#include "sge_utils/utils/ThreadPool.h"
+#include "sge_utils/utils/hash_combine.h"
+#include <algorithm>
 #include <sge_utils/math/mat4.h>
 
 // Caution:
@@ -46,47 +50,203 @@ struct ParamsCbFWDDefaultShading {
 
 	// Skinning.
 	int uSkinningFirstBoneOffsetInTex; ///< The row (integer) in @uSkinningBones of the fist bone for the mesh that is being drawn.
-	int uSkinningFirstBoneOffsetInTex_padding[3];
+
+	// Instancing.
+	int uInstancingFirstRowInTex; ///< The row (integer) in @uInstanceData of the 1st instance that is being drawn.
+
+	// Clustered lighting.
+	int uEvalClusteredLights;
+	int uEvalClusteredLights_padding[1];
+
+	// Vertex attributes dequantization.
+	vec4f uPositionDequantScale;
+	vec4f uPositionDequantOffset;
+	vec4f uUvDequantScaleOffset;
+
+	// Clustered lighting.
+	vec4f uLightClustersGridSize;
+	vec4f uLightClustersDepthParams;
+
+	// Cascaded shadow maps.
+	vec4f uShadowCascades[kMaxShadowCascades];
 };
 
+static_assert(kMaxShadowCascades == 4, "The shaders have a uniform for each shadow map cascade");
+
+static_assert(InstanceBatcher::kNumTexelsPerInstance == kInstanceDataNumTexels, "The instance data layout must match the shaders");
+
+namespace {
+	/// The maximum number of geometries drawn by a single instanced draw call.
+	constexpr int kMaxInstancesPerDraw = 512;
+	/// The maximum number of rows in the instance data texture, the remaining geometries get drawn without instancing.
+	constexpr int kMaxInstanceDataRows = 4096;
+	/// The height of the instance data texture is a multiple of this.
+	constexpr int kInstanceDataRowsGranularity = 256;
+	/// The minimum number of draw calls (instance batches) recorded by a single thread when flushing the queue,
+	/// smaller queues are drawn directly on the calling thread.
+	constexpr int kMinBatchesPerRecordingChunk = 32;
+
+	/// The compile time options and the cached uniforms of FWDDefault_buildShadowMaps.shader.
+	namespace FWDBuildShadowMapsProgram {
+		enum : int {
+			OPT_LightType,
+			OPT_HasVertexSkinning,
+			OPT_Instancing,
+			kNumOptions,
+		};
+
+		enum : int {
+			uWorld,
+			uProjView,
+			uPointLightPositionWs,
+			uPointLightFarPlaneDistance,
+			uSkinningBones,
+			uSkinningFirstBoneOffsetInTex,
+			uPositionDequantScale,
+			uPositionDequantOffset,
+			uInstanceData,
+			uInstancingFirstRowInTex,
+		};
+	} // namespace FWDBuildShadowMapsProgram
+
+	/// The compile time options and the cached uniforms of FWDDefault_shading.shader.
+	namespace FWDShadingProgram {
+		enum : int {
+			OPT_UseNormalMap,
+			OPT_DiffuseColorSrc,
+			OPT_Lighting,
+			OPT_HasVertexSkinning,
+			OPT_NormalEncoding,
+			OPT_Instancing,
+			kNumOptions,
+		};
+
+		enum : int {
+			uTexDiffuse,
+			uTexDiffuseSampler,
+			uTexNormalMap,
+			uTexNormalMapSampler,
+			uTexDiffuseX,
+			uTexDiffuseXSampler,
+			uTexDiffuseY,
+			uTexDiffuseYSampler,
+			uTexDiffuseZ,
+			uTexDiffuseZSampler,
+			uTexDiffuseXYZScaling,
+			uLightShadowMap,
+			uPointLightShadowMap,
+			uTexMetalness,
+			uTexMetalnessSampler,
+			uTexRoughness,
+			uTexRoughnessSampler,
+			uTexSkinningBones,
+			uInstanceData,
+			uLightClusters,
+			uLightClusterIndices,
+			uClusteredLights,
+			uParamsCbFWDDefaultShading_vertex,
+			uParamsCbFWDDefaultShading_pixel,
+		};
+	} // namespace FWDShadingProgram
+
+	/// The compile time options of the forward shading program used for a geometry.
+	struct FWDShadingOptions {
+		int diffuseColorSrc = kDiffuseColorSrcConstant;
+		int lighting = kLightingShaded;
+		int useNormalMap = 0;
+		int hasVertexSkinning = kHasVertexSkinning_No;
+		int normalEncoding = kNormalEncoding_Float3;
+	};
+
+	FWDShadingOptions computeFWDShadingOptions(const GeneralDrawMod& generalMods,
+	                                           const Geometry* geometry,
+	                                           const Material& material,
+	                                           const InstanceDrawMods& mods) {
+		FWDShadingOptions options;
+
+		if (!material.diffuseTexture) {
+			if (geometry->vertexDeclHasVertexColor) {
+				options.diffuseColorSrc = kDiffuseColorSrcVertex;
+			}
+		}
+		if (material.diffuseTexture)
+			options.diffuseColorSrc = kDiffuseColorSrcTexture;
+		if (material.diffuseTextureX && material.diffuseTextureY && material.diffuseTextureZ) {
+			options.diffuseColorSrc = kDiffuseColorSrcTriplanarTex;
+		}
+
+		if (mods.forceNoLighting) {
+			options.lighting = kLightingForceNoLighting;
+		} else {
+			options.lighting = generalMods.lightClusters ? kLightingClustered : kLightingShaded;
+		}
+
+		options.useNormalMap = !!(geometry->vertexDeclHasTangentSpace && material.texNormalMap);
+		options.hasVertexSkinning = (geometry->hasVertexSkinning()) ? kHasVertexSkinning_Yes : kHasVertexSkinning_No;
+		options.normalEncoding = geometry->dequantization.hasOctahedralNormals ? kNormalEncoding_Octahedral : kNormalEncoding_Float3;
+
+		return options;
+	}
+
+	uint32 hashPointer(const void* const ptr) {
+		uint64 x = uint64(uintptr_t(ptr));
+		x ^= x >> 33;
+		x *= 0xff51afd7ed558ccdull;
+		x ^= x >> 33;
+		return uint32(x);
+	}
+
+	/// Computes the state used for sorting the geometry in the render queue.
+	RenderItemState computeRenderItemState(const GeneralDrawMod& generalMods,
+	                                       const Geometry* geometry,
+	                                       const Material& material,
+	                                       const InstanceDrawMods& mods) {
+		RenderItemState state;
+
+		// The program is identified by the compile time options of the shader.
+		if (generalMods.isRenderingShadowMap) {
+			state.program = 1u;
+			state.program |= uint32(generalMods.isShadowMapForPointLight) << 1;
+			state.program |= uint32(geometry->hasVertexSkinning()) << 2;
+		} else {
+			const FWDShadingOptions options = computeFWDShadingOptions(generalMods, geometry, material, mods);
+			state.program |= uint32(options.diffuseColorSrc) << 1;
+			state.program |= uint32(options.lighting) << 4;
+			state.program |= uint32(options.useNormalMap) << 6;
+			state.program |= uint32(options.hasVertexSkinning) << 7;
+			state.program |= uint32(options.normalEncoding) << 8;
+
+			state.material = hashPointer(material.diffuseTexture);
+			state.material = hash_combine(state.material, hashPointer(material.texNormalMap));
+			state.material = hash_combine(state.material, hashPointer(material.texMetalness));
+			state.material = hash_combine(state.material, hashPointer(material.texRoughness));
+			state.material = hash_combine(state.material, hashPointer(material.diffuseTextureX));
+		}
+
+		state.mesh = hash_combine(hashPointer(geometry->vertexBuffer), hashPointer(geometry->indexBuffer));
+		return state;
+	}
+} // namespace
+
 //-----------------------------------------------------------------------------
 // BasicModelDraw
 //-----------------------------------------------------------------------------
-void BasicModelDraw::drawGeometry(const RenderDestination& rdest,
-                                  const vec3f& camPos,
-                                  const vec3f& camLookDir,
-                                  const mat4f& projView,
-                                  const mat4f& world,
-                                  const GeneralDrawMod& generalMods,
-                                  const Geometry* geometry,
-                                  const Material& material,
-                                  const InstanceDrawMods& mods) {
-	if (generalMods.isRenderingShadowMap) {
-		drawGeometry_FWDBuildShadowMap(rdest, camPos, camLookDir, projView, world, generalMods, geometry, material, mods);
-	} else {
-		drawGeometry_FWDShading(rdest, camPos, camLookDir, projView, world, generalMods, geometry, material, mods);
-	}
+void BasicModelDraw::beginQueue(ThreadPool* const threadPool) {
+	sgeAssert(m_isQueueing == false && "The previous queue wasn't ended");
+	m_isQueueing = true;
+	m_queueThreadPool = threadPool;
 }
 
+void BasicModelDraw::endQueue() {
+	flushQueue();
+	m_isQueueing = false;
+	m_queueThreadPool = nullptr;
+}
 
-void BasicModelDraw::drawGeometry_FWDBuildShadowMap(const RenderDestination& rdest,
-                                                    const vec3f& camPos,
-                                                    const vec3f& UNUSED(camLookDir),
-                                                    const mat4f& projView,
-                                                    const mat4f& world,
-                                                    const GeneralDrawMod& generalMods,
-                                                    const Geometry* geometry,
-                                                    const Material& UNUSED(material),
-                                                    const InstanceDrawMods& mods) {
-	enum {
-		OPT_LightType,
-		OPT_HasVertexSkinning,
-		kNumOptions,
-	};
-
-	enum : int { uWorld, uProjView, uPointLightPositionWs, uPointLightFarPlaneDistance, uSkinningBones, uSkinningFirstBoneOffsetInTex };
-
+void BasicModelDraw::createResources(SGEDevice* const sgedev) {
 	if (shadingPermutFWDBuildShadowMaps.isValid() == false) {
+		using namespace FWDBuildShadowMapsProgram;
+
 		shadingPermutFWDBuildShadowMaps = ShadingProgramPermuator();
 
 		const std::vector<OptionPermuataor::OptionDesc> compileTimeOptions = {
@@ -94,6 +254,7 @@ void BasicModelDraw::drawGeometry_FWDBuildShadowMap(const RenderDestination& rde
 		     "OPT_LightType",
 		     {SGE_MACRO_STR(FWDDBSM_OPT_LightType_SpotOrDirectional), SGE_MACRO_STR(FWDDBSM_OPT_LightType_Point)}},
 		    {OPT_HasVertexSkinning, "OPT_HasVertexSkinning", {SGE_MACRO_STR(kHasVertexSkinning_No), SGE_MACRO_STR(kHasVertexSkinning_Yes)}},
+		    {OPT_Instancing, "OPT_Instancing", {SGE_MACRO_STR(kInstancing_No), SGE_MACRO_STR(kInstancing_Yes)}},
 		};
 
 		const std::vector<ShadingProgramPermuator::Unform> uniformsToCache = {
@@ -102,33 +263,462 @@ void BasicModelDraw::drawGeometry_FWDBuildShadowMap(const RenderDestination& rde
 		    {uPointLightPositionWs, "uPointLightPositionWs"},
 		    {uPointLightFarPlaneDistance, "uPointLightFarPlaneDistance"},
 		    {uSkinningBones, "uSkinningBones"},
-		    {uSkinningFirstBoneOffsetInTex, "uSkinningFirstBoneOffsetInTex"}};
+		    {uSkinningFirstBoneOffsetInTex, "uSkinningFirstBoneOffsetInTex"},
+		    {uPositionDequantScale, "uPositionDequantScale"},
+		    {uPositionDequantOffset, "uPositionDequantOffset"},
+		    {uInstanceData, "uInstanceData"},
+		    {uInstancingFirstRowInTex, "uInstancingFirstRowInTex"}};
 
-		SGEDevice* const sgedev = rdest.getDevice();
 		shadingPermutFWDBuildShadowMaps->createFromFile(sgedev, "core_shaders/FWDDefault_buildShadowMaps.shader", compileTimeOptions,
 		                                                uniformsToCache);
 	}
 
+	if (shadingPermutFWDShading.isValid() == false) {
+		using namespace FWDShadingProgram;
+
+		shadingPermutFWDShading = ShadingProgramPermuator();
+
+		const std::vector<OptionPermuataor::OptionDesc> compileTimeOptions = {
+		    {OPT_UseNormalMap, "OPT_UseNormalMap", {"0", "1"}},
+		    {OPT_DiffuseColorSrc, "OPT_DiffuseColorSrc", {"0", "1", "2", "3", "4"}},
+		    {OPT_Lighting,
+		     "OPT_Lighting",
+		     {SGE_MACRO_STR(kLightingShaded), SGE_MACRO_STR(kLightingForceNoLighting), SGE_MACRO_STR(kLightingClustered)}},
+		    {OPT_HasVertexSkinning, "OPT_HasVertexSkinning", {SGE_MACRO_STR(kHasVertexSkinning_No), SGE_MACRO_STR(kHasVertexSkinning_Yes)}},
+		    {OPT_NormalEncoding,
+		     "OPT_NormalEncoding",
+		     {SGE_MACRO_STR(kNormalEncoding_Float3), SGE_MACRO_STR(kNormalEncoding_Octahedral)}},
+		    {OPT_Instancing, "OPT_Instancing", {SGE_MACRO_STR(kInstancing_No), SGE_MACRO_STR(kInstancing_Yes)}},
+		};
+
+		// Caution: It is important that the order of the elements here MATCHES the order in the enum in FWDShadingProgram.
+		const std::vector<ShadingProgramPermuator::Unform> uniformsToCache = {
+		    {uTexDiffuse, "texDiffuse", ShaderType::PixelShader},
+		    {uTexDiffuseSampler, "texDiffuse_sampler", ShaderType::PixelShader},
+		    {uTexNormalMap, "uTexNormalMap", ShaderType::PixelShader},
+		    {uTexNormalMapSampler, "uTexNormalMap_sampler", ShaderType::PixelShader},
+		    {uTexDiffuseX, "texDiffuseX", ShaderType::PixelShader},
+		    {uTexDiffuseXSampler, "texDiffuseX_sampler", ShaderType::PixelShader},
+		    {uTexDiffuseY, "texDiffuseY", ShaderType::PixelShader},
+		    {uTexDiffuseYSampler, "texDiffuseY_sampler", ShaderType::PixelShader},
+		    {uTexDiffuseZ, "texDiffuseZ", ShaderType::PixelShader},
+		    {uTexDiffuseZSampler, "texDiffuseZ_sampler", ShaderType::PixelShader},
+		    {uTexDiffuseXYZScaling, "texDiffuseXYZScaling", ShaderType::PixelShader},
+		    {uLightShadowMap, "lightShadowMap", ShaderType::PixelShader},
+		    {uPointLightShadowMap, "uPointLightShadowMap", ShaderType::PixelShader},
+		    {uTexMetalness, "uTexMetalness", ShaderType::PixelShader},
+		    {uTexMetalnessSampler, "uTexMetalness_sampler", ShaderType::PixelShader},
+		    {uTexRoughness, "uTexRoughness", ShaderType::PixelShader},
+		    {uTexRoughnessSampler, "uTexRoughness_sampler", ShaderType::PixelShader},
+		    {uTexSkinningBones, "uSkinningBones", ShaderType::VertexShader},
+		    {uInstanceData, "uInstanceData", ShaderType::VertexShader},
+		    {uLightClusters, "uLightClusters", ShaderType::PixelShader},
+		    {uLightClusterIndices, "uLightClusterIndices", ShaderType::PixelShader},
+		    {uClusteredLights, "uClusteredLights", ShaderType::PixelShader},
+		    {uParamsCbFWDDefaultShading_vertex, "ParamsCbFWDDefaultShading", ShaderType::VertexShader},
+		    {uParamsCbFWDDefaultShading_pixel, "ParamsCbFWDDefaultShading", ShaderType::PixelShader},
+		};
+
+		shadingPermutFWDShading->createFromFile(sgedev, "core_shaders/FWDDefault_shading.shader", compileTimeOptions, uniformsToCache);
+	}
+
+	if (!paramsBuffer.IsResourceValid()) {
+		BufferDesc bd = BufferDesc::GetDefaultConstantBuffer(1024, ResourceUsage::Dynamic);
+		paramsBuffer = sgedev->requestResource<Buffer>();
+		paramsBuffer->create(bd, nullptr);
+	}
+
+	if (emptyCubeShadowMap.IsResourceValid() == false) {
+		TextureDesc texDesc;
+		texDesc.textureType = UniformType::TextureCube;
+		texDesc.format = TextureFormat::D24_UNORM_S8_UINT;
+		texDesc.usage = TextureUsage::DepthStencilResource;
+		texDesc.textureCube.width = 16;
+		texDesc.textureCube.height = 16;
+		texDesc.textureCube.arraySize = 1;
+		texDesc.textureCube.numMips = 1;
+		texDesc.textureCube.sampleQuality = 0;
+		texDesc.textureCube.numSamples = 1;
+
+		emptyCubeShadowMap = sgedev->requestResource<Texture>();
+		[[maybe_unused]] const bool succeeded = emptyCubeShadowMap->create(texDesc, nullptr);
+	}
+}
+
+void BasicModelDraw::queueGeometry(const RenderDestination& rdest,
+                                   const vec3f& camPos,
+                                   const vec3f& camLookDir,
+                                   const mat4f& projView,
+                                   const mat4f& world,
+                                   const GeneralDrawMod& generalMods,
+                                   const Geometry* geometry,
+                                   const Material& material,
+                                   const InstanceDrawMods& mods,
+                                   const vec3f& sortingPosWs) {
+	m_queuedGeometries.emplace_back();
+	QueuedGeometry& queued = m_queuedGeometries.back();
+
+	queued.rdest = rdest;
+	queued.camPos = camPos;
+	queued.camLookDir = camLookDir;
+	queued.projView = projView;
+	queued.world = world;
+	queued.generalMods = generalMods;
+	queued.geometry = *geometry;
+	queued.material = material;
+	queued.mods = mods;
+
+	// The array of lights is usually reused for the next object, keep a copy.
+	queued.firstLight = int(m_queuedLights.size());
+	for (int iLight = 0; iLight < generalMods.lightsCount; ++iLight) {
+		m_queuedLights.push_back(generalMods.ppLightData[iLight]);
+	}
+	queued.generalMods.ppLightData = nullptr;
+
+	const bool isBlended = generalMods.isAlphaZSorted || mods.forceAdditiveBlending;
+	queued.pass = isBlended ? renderQueuePass_transparent : renderQueuePass_opaque;
+	queued.state = computeRenderItemState(generalMods, geometry, material, mods);
+	queued.depth = dot(sortingPosWs - camPos, camLookDir);
+}
+
+bool BasicModelDraw::isInstanceable(const QueuedGeometry& queued) {
+	// The blended geometries are drawn back to front, the skinned ones have their own bones.
+	return queued.pass == renderQueuePass_opaque && queued.geometry.hasVertexSkinning() == false && queued.geometry.hasData();
+}
+
+bool BasicModelDraw::canDrawInstancedTogether(const QueuedGeometry& a, const QueuedGeometry& b) const {
+	// The destination and the camera.
+	if (a.rdest.sgecon != b.rdest.sgecon || a.rdest.frameTarget != b.rdest.frameTarget || a.rdest.viewport.x != b.rdest.viewport.x ||
+	    a.rdest.viewport.y != b.rdest.viewport.y || a.rdest.viewport.width != b.rdest.viewport.width ||
+	    a.rdest.viewport.height != b.rdest.viewport.height) {
+		return false;
+	}
+
+	if (a.camPos != b.camPos || a.camLookDir != b.camLookDir || a.projView != b.projView) {
+		return false;
+	}
+
+	// The lighting and the general modifications.
+	const GeneralDrawMod& agm = a.generalMods;
+	const GeneralDrawMod& bgm = b.generalMods;
+	if (agm.isRenderingShadowMap != bgm.isRenderingShadowMap || agm.isShadowMapForPointLight != bgm.isShadowMapForPointLight ||
+	    agm.shadowMapPointLightDepthRange != bgm.shadowMapPointLightDepthRange || agm.selectionTint != bgm.selectionTint ||
+	    agm.ambientLightColor != bgm.ambientLightColor || agm.uRimLightColorWWidth != bgm.uRimLightColorWWidth ||
+	    agm.lightsCount != bgm.lightsCount || agm.lightClusters != bgm.lightClusters) {
+		return false;
+	}
+
+	const auto aLightsBegin = m_queuedLights.begin() + a.firstLight;
+	if (std::equal(aLightsBegin, aLightsBegin + agm.lightsCount, m_queuedLights.begin() + b.firstLight) == false) {
+		return false;
+	}
+
+	// The mesh.
+	const Geometry& ag = a.geometry;
+	const Geometry& bg = b.geometry;
+	if (ag.vertexBuffer != bg.vertexBuffer || ag.indexBuffer != bg.indexBuffer || ag.vertexDeclIndex != bg.vertexDeclIndex ||
+	    ag.vertexDeclHasVertexColor != bg.vertexDeclHasVertexColor || ag.vertexDeclHasTangentSpace != bg.vertexDeclHasTangentSpace ||
+	    ag.topology != bg.topology || ag.vbByteOffset != bg.vbByteOffset || ag.ibByteOffset != bg.ibByteOffset || ag.stride != bg.stride ||
+	    ag.ibFmt != bg.ibFmt || ag.numElements != bg.numElements || ag.dequantization.positionScale != bg.dequantization.positionScale ||
+	    ag.dequantization.positionOffset != bg.dequantization.positionOffset || ag.dequantization.uvScale != bg.dequantization.uvScale ||
+	    ag.dequantization.uvOffset != bg.dequantization.uvOffset ||
+	    ag.dequantization.hasOctahedralNormals != bg.dequantization.hasOctahedralNormals) {
+		return false;
+	}
+
+	// The material, the diffuse color is the tint of the instance, so it could differ.
+	const Material& am = a.material;
+	const Material& bm = b.material;
+	if (am.uvwTransform != bm.uvwTransform || am.texNormalMap != bm.texNormalMap || am.diffuseTexture != bm.diffuseTexture ||
+	    am.diffuseTextureX != bm.diffuseTextureX || am.diffuseTextureY != bm.diffuseTextureY || am.diffuseTextureZ != bm.diffuseTextureZ ||
+	    am.texMetalness != bm.texMetalness || am.texRoughness != bm.texRoughness || am.diffuseTexXYZScaling != bm.diffuseTexXYZScaling ||
+	    am.metalness != bm.metalness || am.roughness != bm.roughness || am.disableCulling != bm.disableCulling) {
+		return false;
+	}
+
+	// The instance modifications.
+	if (a.mods.uvwTransform != b.mods.uvwTransform || a.mods.forceNoLighting != b.mods.forceNoLighting ||
+	    a.mods.forceAdditiveBlending != b.mods.forceAdditiveBlending || a.mods.forceNoCulling != b.mods.forceNoCulling) {
+		return false;
+	}
+
+	// Mirrored transforms flip the culling of the triangles.
+	if ((determinant(a.world) > 0.f) != (determinant(b.world) > 0.f)) {
+		return false;
+	}
+
+	return true;
+}
+
+void BasicModelDraw::uploadInstanceData(const RenderDestination& rdest) {
+	const int numRows = m_instanceBatcher.getNumInstanceRows();
+	if (numRows == 0) {
+		return;
+	}
+
+	const int neededTexHeight = ((numRows + kInstanceDataRowsGranularity - 1) / kInstanceDataRowsGranularity) * kInstanceDataRowsGranularity;
+	const bool doesBigEnoughTextureExists =
+	    m_instanceDataTex.HasResource() && m_instanceDataTex->getDesc().texture2D.height >= neededTexHeight;
+	const int texHeight = doesBigEnoughTextureExists ? m_instanceDataTex->getDesc().texture2D.height : neededTexHeight;
+
+	// The whole texture gets updated, pad the data to its height.
+	const std::vector<vec4f>& instanceTexels = m_instanceBatcher.getInstanceTexels();
+	m_instanceDataTexels.resize(size_t(texHeight) * kInstanceDataNumTexels);
+	std::copy(instanceTexels.begin(), instanceTexels.end(), m_instanceDataTexels.begin());
+	const TextureData data(m_instanceDataTexels.data(), sizeof(vec4f) * kInstanceDataNumTexels);
+
+	if (doesBigEnoughTextureExists == false) {
+		TextureDesc td;
+		td.textureType = UniformType::Texture2D;
+		td.usage = TextureUsage::DynamicResource;
+		td.format = TextureFormat::R32G32B32A32_FLOAT;
+		td.texture2D.arraySize = 1;
+		td.texture2D = Texture2DDesc(kInstanceDataNumTexels, texHeight);
+
+		SamplerDesc sd;
+		sd.filter = TextureFilter::Min_Mag_Mip_Point;
+
+		m_instanceDataTex = rdest.getDevice()->requestResource<Texture>();
+		m_instanceDataTex->create(td, &data, sd);
+	} else {
+		rdest.sgecon->updateTextureData(m_instanceDataTex.GetPtr(), data);
+	}
+}
+
+void BasicModelDraw::flushQueue() {
+	if (m_queuedGeometries.empty()) {
+		return;
+	}
+
+	// The depths are quantized relative to the furthest geometry.
+	float maxDepth = 0.f;
+	for (const QueuedGeometry& queued : m_queuedGeometries) {
+		maxDepth = maxOf(maxDepth, queued.depth);
+	}
+
+	m_renderQueue.clear();
+	for (int iQueued = 0; iQueued < int(m_queuedGeometries.size()); ++iQueued) {
+		const QueuedGeometry& queued = m_queuedGeometries[iQueued];
+		m_renderQueue.add(RenderSortKey::make(queued.pass, queued.state, queued.depth, maxDepth), iQueued);
+	}
+	m_renderQueue.sort();
+
+	// The sorting puts the geometries with the same state next to each other,
+	// each geometry that could be instanced with the previous one gets its id.
+	const std::vector<RenderItem>& sortedItems = m_renderQueue.getItems();
+	m_queuedInstancingIds.resize(m_queuedGeometries.size());
+	m_queuedInstanceData.resize(m_queuedGeometries.size());
+	for (int iItem = 0; iItem < int(sortedItems.size()); ++iItem) {
+		const int iQueued = sortedItems[iItem].payloadIndex;
+		const QueuedGeometry& queued = m_queuedGeometries[iQueued];
+
+		m_queuedInstanceData[iQueued].world = queued.world;
+		m_queuedInstanceData[iQueued].tint = queued.material.diffuseColor;
+
+		int instancingId = -1;
+		if (isInstanceable(queued)) {
+			instancingId = iItem;
+
+			if (iItem > 0) {
+				const int iPrevQueued = sortedItems[iItem - 1].payloadIndex;
+				const QueuedGeometry& prevQueued = m_queuedGeometries[iPrevQueued];
+				if (m_queuedInstancingIds[iPrevQueued] >= 0 && canDrawInstancedTogether(prevQueued, queued)) {
+					instancingId = m_queuedInstancingIds[iPrevQueued];
+				}
+			}
+		}
+
+		m_queuedInstancingIds[iQueued] = instancingId;
+	}
+
+	m_instanceBatcher.setLimits(kMaxInstancesPerDraw, kMaxInstanceDataRows);
+	m_instanceBatcher.build(sortedItems, m_queuedInstancingIds.data(), m_queuedInstanceData.data());
+	uploadInstanceData(m_queuedGeometries[0].rdest);
+	createResources(m_queuedGeometries[0].rdest.getDevice());
+
+	const std::vector<InstanceBatch>& batches = m_instanceBatcher.getBatches();
+	const auto getBatchContext = [&](const int iBatch) -> SGEContext* {
+		return m_queuedGeometries[sortedItems[batches[iBatch].firstItem].payloadIndex].rdest.sgecon;
+	};
+
+	// Draws a batch on the specified context, called from multiple threads when the queue is recorded in parallel.
+	const auto drawBatch = [&](const int iBatch, SGEContext* const sgecon, StateGroup& batchStateGroup) -> void {
+		const InstanceBatch& batch = batches[iBatch];
+		const QueuedGeometry& queued = m_queuedGeometries[sortedItems[batch.firstItem].payloadIndex];
+
+		RenderDestination rdest = queued.rdest;
+		rdest.sgecon = sgecon;
+
+		GeneralDrawMod generalMods = queued.generalMods;
+		generalMods.ppLightData = generalMods.lightsCount > 0 ? &m_queuedLights[queued.firstLight] : nullptr;
+
+		InstancingDesc instancing;
+		InstanceDrawMods mods = queued.mods;
+		if (batch.isInstanced()) {
+			instancing.firstInstanceRow = batch.firstInstanceRow;
+			instancing.numInstances = batch.numItems;
+
+			// Request the texture mips needed by the biggest instance on the screen.
+			for (int iItem = batch.firstItem; iItem < batch.firstItem + batch.numItems; ++iItem) {
+				mods.screenSizePixels = maxOf(mods.screenSizePixels, m_queuedGeometries[sortedItems[iItem].payloadIndex].mods.screenSizePixels);
+			}
+		}
+
+		drawGeometryImmediate(rdest, queued.camPos, queued.camLookDir, queued.projView, queued.world, generalMods, &queued.geometry,
+		                      queued.material, mods, instancing, batchStateGroup);
+	};
+
+	const int numWorkers = m_queueThreadPool ? m_queueThreadPool->getNumWorkers() : 0;
+	const int numChunks = minOf(numWorkers + 1, int(batches.size()) / kMinBatchesPerRecordingChunk);
+	if (numChunks <= 1) {
+		for (int iBatch = 0; iBatch < int(batches.size()); ++iBatch) {
+			drawBatch(iBatch, getBatchContext(iBatch), stateGroup);
+		}
+	} else {
+		// Split the batches into contiguous chunks, each recorded by one thread in its own recording context,
+		// then replay the chunks in order, so the draw calls are executed exactly as if they were drawn here.
+		// A chunk never spans geometries drawn on different contexts.
+		const int batchesPerChunk = (int(batches.size()) + numChunks - 1) / numChunks;
+		SGEDevice* const sgedev = m_queuedGeometries[0].rdest.getDevice();
+
+		int numUsedChunks = 0;
+		for (int iBatch = 0; iBatch < int(batches.size()); ++iBatch) {
+			SGEContext* const sgecon = getBatchContext(iBatch);
+
+			RecordingChunk* chunk = numUsedChunks > 0 ? m_recordingChunks[numUsedChunks - 1].get() : nullptr;
+			if (chunk == nullptr || chunk->numBatches >= batchesPerChunk || chunk->targetContext != sgecon) {
+				if (numUsedChunks == int(m_recordingChunks.size())) {
+					m_recordingChunks.push_back(std::make_unique<RecordingChunk>(sgedev));
+				}
+
+				chunk = m_recordingChunks[numUsedChunks].get();
+				chunk->targetContext = sgecon;
+				chunk->firstBatch = iBatch;
+				chunk->numBatches = 0;
+				numUsedChunks++;
+			}
+
+			chunk->numBatches++;
+		}
+
+		m_queueThreadPool->parallelFor(numUsedChunks, [&](const int iChunk) -> void {
+			RecordingChunk& chunk = *m_recordingChunks[iChunk];
+			for (int iBatch = chunk.firstBatch; iBatch < chunk.firstBatch + chunk.numBatches; ++iBatch) {
+				drawBatch(iBatch, &chunk.recording, chunk.stateGroup);
+			}
+		});
+
+		for (int iChunk = 0; iChunk < numUsedChunks; ++iChunk) {
+			RecordingChunk& chunk = *m_recordingChunks[iChunk];
+			chunk.recording.execute(chunk.targetContext);
+			chunk.recording.reset();
+		}
+	}
+
+	FrameStatistics& frameStats = m_queuedGeometries[0].rdest.getDevice()->getFrameStatistics();
+	const RenderQueueStats& queueStats = m_renderQueue.getStats();
+	frameStats.numRenderQueueItems += queueStats.numItems;
+	frameStats.numStateChangesUnsorted += queueStats.numStateChangesUnsorted;
+	frameStats.numStateChangesSorted += queueStats.numStateChangesSorted;
+	frameStats.numInstancedDrawCalls += m_instanceBatcher.getStats().numInstancedBatches;
+	frameStats.numInstancedGeometries += m_instanceBatcher.getStats().numInstancedItems;
+
+	m_renderQueue.clear();
+	m_queuedGeometries.clear();
+	m_queuedLights.clear();
+}
+
+void BasicModelDraw::drawGeometry(const RenderDestination& rdest,
+                                  const vec3f& camPos,
+                                  const vec3f& camLookDir,
+                                  const mat4f& projView,
+                                  const mat4f& world,
+                                  const GeneralDrawMod& generalMods,
+                                  const Geometry* geometry,
+                                  const Material& material,
+                                  const InstanceDrawMods& mods,
+                                  const AABox3f* const bboxWs) {
+	if (m_isQueueing) {
+		if (mods.drawImmediately == false) {
+			const vec3f sortingPosWs = bboxWs != nullptr && bboxWs->IsEmpty() == false ? bboxWs->center() : world.extractTranslation();
+			queueGeometry(rdest, camPos, camLookDir, projView, world, generalMods, geometry, material, mods, sortingPosWs);
+			return;
+		}
+
+		// Blended geometries need to be drawn after everything that was drawn before them.
+		if (generalMods.isAlphaZSorted || mods.forceAdditiveBlending) {
+			flushQueue();
+		}
+	}
+
+	createResources(rdest.getDevice());
+	drawGeometryImmediate(rdest, camPos, camLookDir, projView, world, generalMods, geometry, material, mods, InstancingDesc(), stateGroup);
+}
+
+void BasicModelDraw::drawGeometryImmediate(const RenderDestination& rdest,
+                                           const vec3f& camPos,
+                                           const vec3f& camLookDir,
+                                           const mat4f& projView,
+                                           const mat4f& world,
+                                           const GeneralDrawMod& generalMods,
+                                           const Geometry* geometry,
+                                           const Material& material,
+                                           const InstanceDrawMods& mods,
+                                           const InstancingDesc& instancing,
+                                           StateGroup& stateGroup) {
+	if (generalMods.isRenderingShadowMap) {
+		drawGeometry_FWDBuildShadowMap(rdest, camPos, camLookDir, projView, world, generalMods, geometry, material, mods, instancing,
+		                               stateGroup);
+	} else {
+		drawGeometry_FWDShading(rdest, camPos, camLookDir, projView, world, generalMods, geometry, material, mods, instancing, stateGroup);
+	}
+}
+
+
+void BasicModelDraw::drawGeometry_FWDBuildShadowMap(const RenderDestination& rdest,
+                                                    const vec3f& camPos,
+                                                    const vec3f& UNUSED(camLookDir),
+                                                    const mat4f& projView,
+                                                    const mat4f& world,
+                                                    const GeneralDrawMod& generalMods,
+                                                    const Geometry* geometry,
+                                                    const Material& UNUSED(material),
+                                                    const InstanceDrawMods& mods,
+                                                    const InstancingDesc& instancing,
+                                                    StateGroup& stateGroup) {
+	using namespace FWDBuildShadowMapsProgram;
+
 	const int optHasVertexSkinning = (geometry->hasVertexSkinning()) ? kHasVertexSkinning_Yes : kHasVertexSkinning_No;
+	const int optInstancing = instancing.isInstanced() ? kInstancing_Yes : kInstancing_No;
 
 	const OptionPermuataor::OptionChoice optionChoice[kNumOptions] = {
 	    {OPT_LightType, generalMods.isShadowMapForPointLight ? FWDDBSM_OPT_LightType_Point : FWDDBSM_OPT_LightType_SpotOrDirectional},
 	    {OPT_HasVertexSkinning, optHasVertexSkinning},
+	    {OPT_Instancing, optInstancing},
 	};
 
 	const int iShaderPerm =
 	    shadingPermutFWDBuildShadowMaps->getCompileTimeOptionsPerm().computePermutationIndex(optionChoice, SGE_ARRSZ(optionChoice));
 	const ShadingProgramPermuator::Permutation& shaderPerm = shadingPermutFWDBuildShadowMaps->getShadersPerPerm()[iShaderPerm];
 
-	StaticArray<BoundUniform, 8> uniforms;
+	StaticArray<BoundUniform, 10> uniforms;
 
-	shaderPerm.bind<8>(uniforms, (int)uWorld, (void*)&world);
-	shaderPerm.bind<8>(uniforms, (int)uProjView, (void*)&projView);
+	shaderPerm.bind<10>(uniforms, (int)uWorld, (void*)&world);
+	shaderPerm.bind<10>(uniforms, (int)uProjView, (void*)&projView);
+	shaderPerm.bind<10>(uniforms, (int)uPositionDequantScale, (void*)&geometry->dequantization.positionScale);
+	shaderPerm.bind<10>(uniforms, (int)uPositionDequantOffset, (void*)&geometry->dequantization.positionOffset);
 
+	vec3f pointLightPositionWs = camPos;
 	if (generalMods.isShadowMapForPointLight) {
-		vec3f pointLightPositionWs = camPos;
-		shaderPerm.bind<8>(uniforms, uPointLightPositionWs, (void*)&pointLightPositionWs);
-		shaderPerm.bind<8>(uniforms, uPointLightFarPlaneDistance, (void*)&generalMods.shadowMapPointLightDepthRange);
+		shaderPerm.bind<10>(uniforms, uPointLightPositionWs, (void*)&pointLightPositionWs);
+		shaderPerm.bind<10>(uniforms, uPointLightFarPlaneDistance, (void*)&generalMods.shadowMapPointLightDepthRange);
+	}
+
+	if (optInstancing == kInstancing_Yes) {
+		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uInstanceData], m_instanceDataTex.GetPtr()));
+		sgeAssert(uniforms.back().bindLocation.isNull() == false && uniforms.back().bindLocation.uniformType != 0);
+		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uInstancingFirstRowInTex], (void*)&instancing.firstInstanceRow));
+		sgeAssert(uniforms.back().bindLocation.isNull() == false && uniforms.back().bindLocation.uniformType != 0);
 	}
 
 	if (optHasVertexSkinning == kHasVertexSkinning_Yes) {
@@ -176,9 +766,9 @@ void BasicModelDraw::drawGeometry_FWDBuildShadowMap(const RenderDestination& rde
 	dc.setStateGroup(&stateGroup);
 
 	if (geometry->ibFmt != UniformType::Unknown) {
-		dc.drawIndexed(geometry->numElements, 0, 0);
+		dc.drawIndexed(geometry->numElements, 0, 0, instancing.numInstances);
 	} else {
-		dc.draw(geometry->numElements, 0);
+		dc.draw(geometry->numElements, 0, instancing.numInstances);
 	}
 
 	// Exexute the draw call.
@@ -193,114 +783,47 @@ void BasicModelDraw::drawGeometry_FWDShading(const RenderDestination& rdest,
                                              const GeneralDrawMod& generalMods,
                                              const Geometry* geometry,
                                              const Material& material,
-                                             const InstanceDrawMods& mods) {
-	SGEDevice* const sgedev = rdest.getDevice();
-	if (!paramsBuffer.IsResourceValid()) {
-		BufferDesc bd = BufferDesc::GetDefaultConstantBuffer(1024, ResourceUsage::Dynamic);
-		paramsBuffer = sgedev->requestResource<Buffer>();
-		paramsBuffer->create(bd, nullptr);
-	}
-
-	enum : int {
-		OPT_UseNormalMap,
-		OPT_DiffuseColorSrc,
-		OPT_Lighting,
-		OPT_HasVertexSkinning,
-		kNumOptions,
-	};
-
-	enum : int {
-		uTexDiffuse,
-		uTexDiffuseSampler,
-		uTexNormalMap,
-		uTexNormalMapSampler,
-		uTexDiffuseX,
-		uTexDiffuseXSampler,
-		uTexDiffuseY,
-		uTexDiffuseYSampler,
-		uTexDiffuseZ,
-		uTexDiffuseZSampler,
-		uTexDiffuseXYZScaling,
-		uLightShadowMap,
-		uPointLightShadowMap,
-		uTexMetalness,
-		uTexMetalnessSampler,
-		uTexRoughness,
-		uTexRoughnessSampler,
-		uTexSkinningBones,
-		uParamsCbFWDDefaultShading_vertex,
-		uParamsCbFWDDefaultShading_pixel,
-	};
+                                             const InstanceDrawMods& mods,
+                                             const InstancingDesc& instancing,
+                                             StateGroup& stateGroup) {
+	using namespace FWDShadingProgram;
 
 	ParamsCbFWDDefaultShading paramsCb;
 	memset(&paramsCb, 0, sizeof(paramsCb));
 
-	if (shadingPermutFWDShading.isValid() == false) {
-		shadingPermutFWDShading = ShadingProgramPermuator();
-
-		const std::vector<OptionPermuataor::OptionDesc> compileTimeOptions = {
-		    {OPT_UseNormalMap, "OPT_UseNormalMap", {"0", "1"}},
-		    {OPT_DiffuseColorSrc, "OPT_DiffuseColorSrc", {"0", "1", "2", "3", "4"}},
-		    {OPT_Lighting, "OPT_Lighting", {SGE_MACRO_STR(kLightingShaded), SGE_MACRO_STR(kLightingForceNoLighting)}},
-		    {OPT_HasVertexSkinning, "OPT_HasVertexSkinning", {SGE_MACRO_STR(kHasVertexSkinning_No), SGE_MACRO_STR(kHasVertexSkinning_Yes)}},
-		};
-
-		// Caution: It is important that the order of the elements here MATCHES the order in the enum above.
-		const std::vector<ShadingProgramPermuator::Unform> uniformsToCache = {
-		    {uTexDiffuse, "texDiffuse", ShaderType::PixelShader},
-		    {uTexDiffuseSampler, "texDiffuse_sampler", ShaderType::PixelShader},
-		    {uTexNormalMap, "uTexNormalMap", ShaderType::PixelShader},
-		    {uTexNormalMapSampler, "uTexNormalMap_sampler", ShaderType::PixelShader},
-		    {uTexDiffuseX, "texDiffuseX", ShaderType::PixelShader},
-		    {uTexDiffuseXSampler, "texDiffuseX_sampler", ShaderType::PixelShader},
-		    {uTexDiffuseY, "texDiffuseY", ShaderType::PixelShader},
-		    {uTexDiffuseYSampler, "texDiffuseY_sampler", ShaderType::PixelShader},
-		    {uTexDiffuseZ, "texDiffuseZ", ShaderType::PixelShader},
-		    {uTexDiffuseZSampler, "texDiffuseZ_sampler", ShaderType::PixelShader},
-		    {uTexDiffuseXYZScaling, "texDiffuseXYZScaling", ShaderType::PixelShader},
-		    {uLightShadowMap, "lightShadowMap", ShaderType::PixelShader},
-		    {uPointLightShadowMap, "uPointLightShadowMap", ShaderType::PixelShader},
-		    {uTexMetalness, "uTexMetalness", ShaderType::PixelShader},
-		    {uTexMetalnessSampler, "uTexMetalness_sampler", ShaderType::PixelShader},
-		    {uTexRoughness, "uTexRoughness", ShaderType::PixelShader},
-		    {uTexRoughnessSampler, "uTexRoughness_sampler", ShaderType::PixelShader},
-		    {uTexSkinningBones, "uSkinningBones", ShaderType::VertexShader},
-		    {uParamsCbFWDDefaultShading_vertex, "ParamsCbFWDDefaultShading", ShaderType::VertexShader},
-		    {uParamsCbFWDDefaultShading_pixel, "ParamsCbFWDDefaultShading", ShaderType::PixelShader},
-		};
-
-
-		shadingPermutFWDShading->createFromFile(sgedev, "core_shaders/FWDDefault_shading.shader", compileTimeOptions, uniformsToCache);
-	}
-
-	int optDiffuseColorSrc = kDiffuseColorSrcConstant;
-	{
-		if (!material.diffuseTexture) {
-			if (geometry->vertexDeclHasVertexColor) {
-				optDiffuseColorSrc = kDiffuseColorSrcVertex;
-			}
-		}
-		if (material.diffuseTexture)
-			optDiffuseColorSrc = kDiffuseColorSrcTexture;
-		if (material.diffuseTextureX && material.diffuseTextureY && material.diffuseTextureZ) {
-			optDiffuseColorSrc = kDiffuseColorSrcTriplanarTex;
-		}
-	}
-
-	const int optLighting = (mods.forceNoLighting ? kLightingForceNoLighting : kLightingShaded);
-
-	const int optUseNormalMap = !!(geometry->vertexDeclHasTangentSpace && material.texNormalMap);
-	const int optHasVertexSkinning = (geometry->hasVertexSkinning()) ? kHasVertexSkinning_Yes : kHasVertexSkinning_No;
+	const FWDShadingOptions options = computeFWDShadingOptions(generalMods, geometry, material, mods);
+	const int optDiffuseColorSrc = options.diffuseColorSrc;
+	const int optLighting = options.lighting;
+	const int optUseNormalMap = options.useNormalMap;
+	const int optHasVertexSkinning = options.hasVertexSkinning;
+	const int optNormalEncoding = options.normalEncoding;
+	const int optInstancing = instancing.isInstanced() ? kInstancing_Yes : kInstancing_No;
 
 	const OptionPermuataor::OptionChoice optionChoice[kNumOptions] = {{OPT_UseNormalMap, optUseNormalMap},
 	                                                                  {OPT_DiffuseColorSrc, optDiffuseColorSrc},
 	                                                                  {OPT_Lighting, optLighting},
-	                                                                  {OPT_HasVertexSkinning, optHasVertexSkinning}};
+	                                                                  {OPT_HasVertexSkinning, optHasVertexSkinning},
+	                                                                  {OPT_NormalEncoding, optNormalEncoding},
+	                                                                  {OPT_Instancing, optInstancing}};
 
 	const int iShaderPerm =
 	    shadingPermutFWDShading->getCompileTimeOptionsPerm().computePermutationIndex(optionChoice, SGE_ARRSZ(optionChoice));
 	const ShadingProgramPermuator::Permutation& shaderPerm = shadingPermutFWDShading->getShadersPerPerm()[iShaderPerm];
 
+	// Report the texture mips needed for this draw call, the streaming will make them resident in the next frames.
+	{
+		TextureStreamingManager& texStreaming = getCore()->getAssetLib()->getTextureStreaming();
+		texStreaming.requestForScreenSize(material.diffuseTexture, mods.screenSizePixels);
+		texStreaming.requestForScreenSize(material.texNormalMap, mods.screenSizePixels);
+		texStreaming.requestForScreenSize(material.texMetalness, mods.screenSizePixels);
+		texStreaming.requestForScreenSize(material.texRoughness, mods.screenSizePixels);
+
+		// The triplanar textures are not mapped on the object uv, their size on the screen is unknown.
+		texStreaming.requestMip(material.diffuseTextureX, 0);
+		texStreaming.requestMip(material.diffuseTextureY, 0);
+		texStreaming.requestMip(material.diffuseTextureZ, 0);
+	}
+
 	DrawCall dc;
 
 	stateGroup.setProgram(shaderPerm.shadingProgram.GetPtr());
@@ -347,6 +870,10 @@ void BasicModelDraw::drawGeometry_FWDShading(const RenderDestination& rdest,
 	paramsCb.uMetalness = material.metalness;
 	paramsCb.uRoughness = material.roughness;
 	paramsCb.uSkinningFirstBoneOffsetInTex = geometry->firstBoneOffset;
+	paramsCb.uInstancingFirstRowInTex = instancing.firstInstanceRow;
+	paramsCb.uPositionDequantScale = vec4f(geometry->dequantization.positionScale, 0.f);
+	paramsCb.uPositionDequantOffset = vec4f(geometry->dequantization.positionOffset, 0.f);
+	paramsCb.uUvDequantScaleOffset = vec4f(geometry->dequantization.uvScale, geometry->dequantization.uvOffset);
 
 	if (optDiffuseColorSrc == kDiffuseColorSrcConstant) {
 		// Nothing, uColor is used here.
@@ -398,22 +925,6 @@ void BasicModelDraw::drawGeometry_FWDShading(const RenderDestination& rdest,
 #endif
 	}
 
-	if (emptyCubeShadowMap.IsResourceValid() == false) {
-		TextureDesc texDesc;
-		texDesc.textureType = UniformType::TextureCube;
-		texDesc.format = TextureFormat::D24_UNORM_S8_UINT;
-		texDesc.usage = TextureUsage::DepthStencilResource;
-		texDesc.textureCube.width = 16;
-		texDesc.textureCube.height = 16;
-		texDesc.textureCube.arraySize = 1;
-		texDesc.textureCube.numMips = 1;
-		texDesc.textureCube.sampleQuality = 0;
-		texDesc.textureCube.numSamples = 1;
-
-		emptyCubeShadowMap = getCore()->getDevice()->requestResource<Texture>();
-		[[maybe_unused]] const bool succeeded = emptyCubeShadowMap->create(texDesc, nullptr);
-	}
-
 	if (shaderPerm.uniformLUT[uPointLightShadowMap].isNull() == false) {
 		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uPointLightShadowMap], (emptyCubeShadowMap.GetPtr())));
 		sgeAssert(uniforms.back().bindLocation.isNull() == false && uniforms.back().bindLocation.uniformType != 0);
@@ -424,6 +935,24 @@ void BasicModelDraw::drawGeometry_FWDShading(const RenderDestination& rdest,
 		sgeAssert(uniforms.back().bindLocation.isNull() == false && uniforms.back().bindLocation.uniformType != 0);
 	}
 
+	if (optInstancing == kInstancing_Yes) {
+		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uInstanceData], m_instanceDataTex.GetPtr()));
+		sgeAssert(uniforms.back().bindLocation.isNull() == false && uniforms.back().bindLocation.uniformType != 0);
+	}
+
+	if (optLighting == kLightingClustered) {
+		const LightClusters& lightClusters = *generalMods.lightClusters;
+		paramsCb.uLightClustersGridSize = lightClusters.getShaderGridSize();
+		paramsCb.uLightClustersDepthParams = lightClusters.getShaderDepthParams();
+
+		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uLightClusters], lightClusters.getClustersTexture()));
+		sgeAssert(uniforms.back().bindLocation.isNull() == false && uniforms.back().bindLocation.uniformType != 0);
+		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uLightClusterIndices], lightClusters.getLightIndicesTexture()));
+		sgeAssert(uniforms.back().bindLocation.isNull() == false && uniforms.back().bindLocation.uniformType != 0);
+		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uClusteredLights], lightClusters.getLightsTexture()));
+		sgeAssert(uniforms.back().bindLocation.isNull() == false && uniforms.back().bindLocation.uniformType != 0);
+	}
+
 	// Lights and draw call.
 	const int preLightsNumUnuforms = uniforms.size();
 	for (int iLight = 0; iLight < generalMods.lightsCount; ++iLight) {
@@ -431,8 +960,9 @@ void BasicModelDraw::drawGeometry_FWDShading(const RenderDestination& rdest,
 		// Delete the uniforms form the previous light.
 		uniforms.resize(preLightsNumUnuforms);
 
-		// Do the ambient lighting only with the 1st light.
-		if (optLighting == kLightingShaded) {
+		// Do the ambient lighting and the clustered lights only with the 1st light.
+		paramsCb.uEvalClusteredLights = (iLight == 0) ? 1 : 0;
+		if (optLighting != kLightingForceNoLighting) {
 			if (iLight == 0) {
 				paramsCb.ambientLightColor = generalMods.ambientLightColor;
 				paramsCb.uRimLightColorWWidth = generalMods.uRimLightColorWWidth;
@@ -460,6 +990,9 @@ void BasicModelDraw::drawGeometry_FWDShading(const RenderDestination& rdest,
 
 			paramsCb.lightShadowMapProjView = shadingLight.shadowMapProjView;
 			paramsCb.lightShadowRange = shadingLight.lightXShadowRange;
+			for (int iCascade = 0; iCascade < kMaxShadowCascades; ++iCascade) {
+				paramsCb.uShadowCascades[iCascade] = shadingLight.shadowCascades[iCascade];
+			}
 		}
 
 		if (mods.forceAdditiveBlending) {
@@ -471,9 +1004,9 @@ void BasicModelDraw::drawGeometry_FWDShading(const RenderDestination& rdest,
 			                                        : getCore()->getGraphicsResources().BS_addativeColor);
 		}
 
-		void* paramsMappedData = sgedev->getContext()->map(paramsBuffer, Map::WriteDiscard);
+		void* paramsMappedData = rdest.sgecon->map(paramsBuffer, Map::WriteDiscard);
 		memcpy(paramsMappedData, &paramsCb, sizeof(paramsCb));
-		sgedev->getContext()->unMap(paramsBuffer);
+		rdest.sgecon->unMap(paramsBuffer);
 
 		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uParamsCbFWDDefaultShading_vertex], paramsBuffer.GetPtr()));
 		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uParamsCbFWDDefaultShading_pixel], paramsBuffer.GetPtr()));
@@ -482,9 +1015,9 @@ void BasicModelDraw::drawGeometry_FWDShading(const RenderDestination& rdest,
 		dc.setStateGroup(&stateGroup);
 
 		if (geometry->ibFmt != UniformType::Unknown) {
-			dc.drawIndexed(geometry->numElements, 0, 0);
+			dc.drawIndexed(geometry->numElements, 0, 0, instancing.numInstances);
 		} else {
-			dc.draw(geometry->numElements, 0);
+			dc.draw(geometry->numElements, 0, instancing.numInstances);
 		}
 
 		rdest.sgecon->executeDrawCall(dc, rdest.frameTarget, &rdest.viewport);
@@ -500,10 +1033,11 @@ void BasicModelDraw::drawGeometry_FWDShading(const RenderDestination& rdest,
 		vec4f colorWFlags(0.f);
 		colorWFlags.w = float(kLightFlt_DontLight);
 		paramsCb.lightColorWFlag = colorWFlags;
+		paramsCb.uEvalClusteredLights = 1;
 
-		void* paramsMappedData = sgedev->getContext()->map(paramsBuffer, Map::WriteDiscard);
+		void* paramsMappedData = rdest.sgecon->map(paramsBuffer, Map::WriteDiscard);
 		memcpy(paramsMappedData, &paramsCb, sizeof(paramsCb));
-		sgedev->getContext()->unMap(paramsBuffer);
+		rdest.sgecon->unMap(paramsBuffer);
 
 		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uParamsCbFWDDefaultShading_vertex], paramsBuffer.GetPtr()));
 		uniforms.push_back(BoundUniform(shaderPerm.uniformLUT[uParamsCbFWDDefaultShading_pixel], paramsBuffer.GetPtr()));
@@ -516,9 +1050,9 @@ void BasicModelDraw::drawGeometry_FWDShading(const RenderDestination& rdest,
 		dc.setStateGroup(&stateGroup);
 
 		if (geometry->ibFmt != UniformType::Unknown) {
-			dc.drawIndexed(geometry->numElements, 0, 0);
+			dc.drawIndexed(geometry->numElements, 0, 0, instancing.numInstances);
 		} else {
-			dc.draw(geometry->numElements, 0);
+			dc.draw(geometry->numElements, 0, instancing.numInstances);
 		}
 
 		rdest.sgecon->executeDrawCall(dc, rdest.frameTarget, &rdest.viewport);
@@ -534,6 +1068,35 @@ void BasicModelDraw::draw(const RenderDestination& rdest,
                           const EvaluatedModel& evalModel,
                           const InstanceDrawMods& mods,
                           const std::vector<MaterialOverride>* mtlOverrides) {
+	drawInternal(rdest, camPos, camLookDir, projView, preRoot, generalMods, evalModel, mods, mtlOverrides, nullptr);
+}
+
+void BasicModelDraw::draw(const RenderDestination& rdest,
+                          const vec3f& camPos,
+                          const vec3f& camLookDir,
+                          const mat4f& projView,
+                          const mat4f& preRoot,
+                          const GeneralDrawMod& generalMods,
+                          const SharedEvaluatedModel& sharedModel,
+                          const InstanceDrawMods& mods) {
+	if (sharedModel.evalModel == nullptr) {
+		return;
+	}
+
+	drawInternal(rdest, camPos, camLookDir, projView, preRoot, generalMods, *sharedModel.evalModel, mods, &sharedModel.materialOverrides,
+	             sharedModel.overrideIndexPerMaterial.data());
+}
+
+void BasicModelDraw::drawInternal(const RenderDestination& rdest,
+                                  const vec3f& camPos,
+                                  const vec3f& camLookDir,
+                                  const mat4f& projView,
+                                  const mat4f& preRoot,
+                                  const GeneralDrawMod& generalMods,
+                                  const EvaluatedModel& evalModel,
+                                  const InstanceDrawMods& mods,
+                                  const std::vector<MaterialOverride>* mtlOverrides,
+                                  const int* overrideIndexPerMaterial) {
 	for (int iNode = 0; iNode < evalModel.getNumEvalNodes(); ++iNode) {
 		const EvaluatedNode& evalNode = evalModel.getEvalNode(iNode);
 		const ModelNode* rawNode = evalModel.m_model->nodeAt(iNode);
@@ -547,13 +1110,22 @@ void BasicModelDraw::draw(const RenderDestination& rdest,
 
 			if (meshAttachment.attachedMaterialIndex >= 0) {
 				const EvaluatedMaterial& mtl = evalModel.getEvalMaterial(meshAttachment.attachedMaterialIndex);
-				const std::string mtlName = evalModel.m_model->materialAt(meshAttachment.attachedMaterialIndex)->name;
 
-				auto itr = mtlOverrides ? std::find_if(mtlOverrides->begin(), mtlOverrides->end(),
-				                                       [&mtlName](const MaterialOverride& v) -> bool { return v.name == mtlName; })
-				                        : std::vector<MaterialOverride>::iterator();
+				const MaterialOverride* mtlOverride = nullptr;
+				if (mtlOverrides != nullptr && overrideIndexPerMaterial != nullptr) {
+					const int overrideIndex = overrideIndexPerMaterial[meshAttachment.attachedMaterialIndex];
+					mtlOverride = overrideIndex >= 0 ? &(*mtlOverrides)[overrideIndex] : nullptr;
+				} else if (mtlOverrides != nullptr) {
+					const std::string& mtlName = evalModel.m_model->materialAt(meshAttachment.attachedMaterialIndex)->name;
+					for (const MaterialOverride& ovr : *mtlOverrides) {
+						if (ovr.name == mtlName) {
+							mtlOverride = &ovr;
+							break;
+						}
+					}
+				}
 
-				if (!mtlOverrides || itr == mtlOverrides->end()) {
+				if (mtlOverride == nullptr) {
 					material.diffuseColor = mtl.diffuseColor;
 					material.metalness = mtl.metallic;
 					material.roughness = mtl.roughness;
@@ -574,11 +1146,17 @@ void BasicModelDraw::draw(const RenderDestination& rdest,
 					                            ? mtl.texRoughness->asTextureView()->tex.GetPtr()
 					                            : nullptr;
 				} else {
-					material = itr->mtl;
+					material = mtlOverride->mtl;
 				}
 			}
 
-			drawGeometry(rdest, camPos, camLookDir, projView, finalTrasform, generalMods, &evalMesh.geometry, material, mods);
+			// The skinned meshes are deformed by the nodes, their bounding box is the one of the whole evaluated model.
+			const ModelMesh* const rawMesh = evalModel.m_model->meshAt(meshAttachment.attachedMeshIndex);
+			const AABox3f bboxWs =
+			    rawMesh->bones.empty() ? rawMesh->aabox.getTransformed(finalTrasform) : evalModel.aabox.getTransformed(preRoot);
+
+			drawGeometry(rdest, camPos, camLookDir, projView, finalTrasform, generalMods, &evalMesh.getGeometryForLod(mods.meshLod), material,
+			             mods, &bboxWs);
 		}
 	}
 }
@@ -1,8 +1,13 @@
 #pragma once
 
 #include "ShadingProgramPermuator.h"
+#include "sge_core/InstanceBatcher.h"
+#include "sge_core/RenderQueue.h"
 #include "sge_core/model/EvaluatedModel.h"
+#include "sge_core/model/SharedEvaluatedModelCache.h"
 #include "sge_core/sgecore_api.h"
+#include "sge_renderer/renderer/RecordingContext.h"
+#include "sge_utils/math/ShadowCascades.h"
 #include "sge_utils/math/mat4.h"
 #include "sge_utils/utils/OptionPermutator.h"
 #include "sge_utils/utils/optional.h"
@@ -11,11 +16,8 @@ namespace sge {
 
 struct EvaluatedModel;
 struct ModelMesh;
-
-struct MaterialOverride {
-	std::string name;
-	Material mtl;
-};
+struct LightClusters;
+struct ThreadPool;
 
 //------------------------------------------------------------
 // ShadingLightData
@@ -32,8 +34,11 @@ struct ShadingLightData {
 
 	Texture* shadowMap = nullptr;
 	mat4f shadowMapProjView = mat4f::getIdentity();
-	// x is the light shadow range, (y,z,w) unused.
+	// x is the light shadow range, y is the number of shadow map cascades (0 if not cascaded),
+	// z is the part of each cascade blended with the next one, w unused.
 	vec4f lightXShadowRange = vec4f(0.f);
+	/// For cascaded shadow maps, see @computeShadowCascadeNdcTransform.
+	vec4f shadowCascades[kMaxShadowCascades] = {vec4f(0.f), vec4f(0.f), vec4f(0.f), vec4f(0.f)};
 
 	AABox3f lightBoxWs;
 };
@@ -63,6 +68,14 @@ struct GeneralDrawMod {
 
 	/// An array of all lights that affect the object. The size of the array is @lightsCount.
 	const ShadingLightData** ppLightData = nullptr;
+
+	/// If not nullptr, the point and spot lights without shadows come from these clusters instead of @ppLightData.
+	/// The clusters must be built and uploaded for the camera used for drawing, see @LightClusters.
+	const LightClusters* lightClusters = nullptr;
+
+	/// True if the object needs to be drawn after the opaque objects, sorted back to front.
+	/// Used only when the draws go through the render queue, see @BasicModelDraw::beginQueue.
+	bool isAlphaZSorted = false;
 };
 
 struct InstanceDrawMods {
@@ -71,6 +84,17 @@ struct InstanceDrawMods {
 	bool forceNoLighting = false;
 	bool forceAdditiveBlending = false;
 	bool forceNoCulling = false;
+
+	/// The level of detail of the meshes to be drawn, 0 is the full detail. See @ModelMesh::lods.
+	int meshLod = 0;
+
+	/// The approximate size in pixels the drawn object covers on the screen, used to request the needed texture mips.
+	/// 0 if unknown, in that case the most detailed mips get requested. See @TextureStreamingManager.
+	float screenSizePixels = 0.f;
+
+	/// True if the draw can't wait in the render queue (see @BasicModelDraw::beginQueue),
+	/// because the data it uses (like the vertex buffer or the skinning) changes before the queue gets flushed.
+	bool drawImmediately = false;
 };
 
 //------------------------------------------------------------
@@ -90,6 +114,18 @@ struct SGE_CORE_API BasicModelDraw {
 	          const InstanceDrawMods& mods,
 	          const std::vector<MaterialOverride>* mtlOverrides = nullptr);
 
+	/// Draws a static model shared between many instances, see @SharedEvaluatedModelCache.
+	void draw(const RenderDestination& rdest,
+	          const vec3f& camPos,
+	          const vec3f& camLookDir,
+	          const mat4f& projView,
+	          const mat4f& preRoot,
+	          const GeneralDrawMod& generalMods,
+	          const SharedEvaluatedModel& sharedModel,
+	          const InstanceDrawMods& mods);
+
+	/// @param [in] bboxWs the world space bounding box of the geometry, if known. The blended geometries are sorted back to front
+	///             by its center (when queueing), otherwise by the origin of @world.
 	void drawGeometry(const RenderDestination& rdest,
 	                  const vec3f& camPos,
 	                  const vec3f& camLookDir,
@@ -98,9 +134,122 @@ struct SGE_CORE_API BasicModelDraw {
 	                  const GeneralDrawMod& generalMods,
 	                  const Geometry* geometry,
 	                  const Material& material,
-	                  const InstanceDrawMods& mods);
+	                  const InstanceDrawMods& mods,
+	                  const AABox3f* const bboxWs = nullptr);
+
+	/// @brief Starts recording the drawn geometries in a render queue instead of drawing them immediately.
+	/// The recorded geometries get sorted by their state, to minimize the state changes, and drawn by @flushQueue.
+	/// Opaque static geometries that end up next to each other with the same mesh, material and shading program
+	/// get drawn with a single instanced draw call, see @InstanceBatcher.
+	/// Caution: the resources and the lights referenced by the draws must stay alive until @flushQueue.
+	/// @param [in] threadPool if not nullptr, big queues get recorded on it in parallel, see @flushQueue.
+	void beginQueue(ThreadPool* const threadPool = nullptr);
+
+	/// Sorts and draws the geometries recorded since @beginQueue and stops recording.
+	/// The statistics of the queue are added to the @FrameStatistics of the device.
+	void endQueue();
+
+	bool isQueueing() const { return m_isQueueing; }
 
   private:
+	/// A geometry recorded by @drawGeometry while queueing, it has everything needed to draw it later.
+	struct QueuedGeometry {
+		RenderDestination rdest;
+		vec3f camPos;
+		vec3f camLookDir;
+		mat4f projView;
+		mat4f world;
+		GeneralDrawMod generalMods;
+		/// The index in @m_queuedLights of the first light of @generalMods.
+		int firstLight = 0;
+		Geometry geometry;
+		Material material;
+		InstanceDrawMods mods;
+
+		RenderQueuePass pass = renderQueuePass_opaque;
+		RenderItemState state;
+		/// The distance along the camera look direction used to sort the blended geometries.
+		float depth = 0.f;
+	};
+
+	/// Describes the instances drawn by a single draw call.
+	struct InstancingDesc {
+		/// The row in @m_instanceDataTex of the 1st instance, -1 if the draw call isn't instanced.
+		int firstInstanceRow = -1;
+		int numInstances = 1;
+
+		bool isInstanced() const { return firstInstanceRow >= 0; }
+	};
+
+	/// A part of the instance batches of the queue, recorded by a single thread, see @flushQueue.
+	struct RecordingChunk {
+		explicit RecordingChunk(SGEDevice* const sgedev)
+		    : recording(sgedev) {}
+
+		SGERecordingContext recording;
+		/// The state group used by the draw calls of the chunk, each thread needs its own.
+		StateGroup stateGroup;
+		/// The context that executes the recorded commands.
+		SGEContext* targetContext = nullptr;
+		int firstBatch = 0;
+		int numBatches = 0;
+	};
+
+	/// Returns true if the queued geometry could be drawn with other geometries in a single instanced draw call.
+	static bool isInstanceable(const QueuedGeometry& queued);
+
+	/// Returns true if everything, besides the world transform and the tint, needed to draw the two geometries is the same.
+	bool canDrawInstancedTogether(const QueuedGeometry& a, const QueuedGeometry& b) const;
+
+	/// Uploads the data of the instances batched by @m_instanceBatcher to @m_instanceDataTex.
+	void uploadInstanceData(const RenderDestination& rdest);
+
+	/// @param [in] sortingPosWs the world space point whose depth is used to sort the geometry, see @drawGeometry.
+	void queueGeometry(const RenderDestination& rdest,
+	                   const vec3f& camPos,
+	                   const vec3f& camLookDir,
+	                   const mat4f& projView,
+	                   const mat4f& world,
+	                   const GeneralDrawMod& generalMods,
+	                   const Geometry* geometry,
+	                   const Material& material,
+	                   const InstanceDrawMods& mods,
+	                   const vec3f& sortingPosWs);
+
+	/// Creates the shading programs and the buffers used for drawing, if they aren't created yet.
+	/// Called before drawing anything, so that the draws could be recorded on multiple threads.
+	void createResources(SGEDevice* const sgedev);
+
+	/// Sorts and draws the queued geometries and clears the queue.
+	/// If the queue has a thread pool, the draw calls are split into chunks, recorded in parallel with @SGERecordingContext
+	/// and then executed in order on the context of the queued geometries.
+	void flushQueue();
+
+	void drawGeometryImmediate(const RenderDestination& rdest,
+	                           const vec3f& camPos,
+	                           const vec3f& camLookDir,
+	                           const mat4f& projView,
+	                           const mat4f& world,
+	                           const GeneralDrawMod& generalMods,
+	                           const Geometry* geometry,
+	                           const Material& material,
+	                           const InstanceDrawMods& mods,
+	                           const InstancingDesc& instancing,
+	                           StateGroup& stateGroup);
+
+	/// @param [in] overrideIndexPerMaterial if not nullptr, the index in @mtlOverrides for each material of the model,
+	///             otherwise the overrides are matched by name.
+	void drawInternal(const RenderDestination& rdest,
+	                  const vec3f& camPos,
+	                  const vec3f& camLookDir,
+	                  const mat4f& projView,
+	                  const mat4f& preRoot,
+	                  const GeneralDrawMod& generalMods,
+	                  const EvaluatedModel& evalModel,
+	                  const InstanceDrawMods& mods,
+	                  const std::vector<MaterialOverride>* mtlOverrides,
+	                  const int* overrideIndexPerMaterial);
+
 	void drawGeometry_FWDShading(const RenderDestination& rdest,
 	                             const vec3f& camPos,
 	                             const vec3f& camLookDir,
@@ -109,7 +258,9 @@ struct SGE_CORE_API BasicModelDraw {
 	                             const GeneralDrawMod& generalMods,
 	                             const Geometry* geometry,
 	                             const Material& material,
-	                             const InstanceDrawMods& mods);
+	                             const InstanceDrawMods& mods,
+	                             const InstancingDesc& instancing,
+	                             StateGroup& stateGroup);
 
 	void drawGeometry_FWDBuildShadowMap(const RenderDestination& rdest,
 	                                    const vec3f& camPos,
@@ -119,14 +270,36 @@ struct SGE_CORE_API BasicModelDraw {
 	                                    const GeneralDrawMod& generalMods,
 	                                    const Geometry* geometry,
 	                                    const Material& material,
-	                                    const InstanceDrawMods& mods);
+	                                    const InstanceDrawMods& mods,
+	                                    const InstancingDesc& instancing,
+	                                    StateGroup& stateGroup);
 
   private:
 	Optional<ShadingProgramPermuator> shadingPermutFWDShading;
 	Optional<ShadingProgramPermuator> shadingPermutFWDBuildShadowMaps;
 	GpuHandle<Texture> emptyCubeShadowMap;
 	GpuHandle<Buffer> paramsBuffer;
+	/// The state group of the draw calls made on the calling thread.
 	StateGroup stateGroup;
+
+	bool m_isQueueing = false;
+	/// The thread pool used to record the current queue, see @beginQueue.
+	ThreadPool* m_queueThreadPool = nullptr;
+	RenderQueue m_renderQueue;
+	std::vector<QueuedGeometry> m_queuedGeometries;
+	/// The lights of all queued geometries.
+	std::vector<const ShadingLightData*> m_queuedLights;
+
+	InstanceBatcher m_instanceBatcher;
+	/// For each queued geometry, the id used to batch it with the other geometries, see @InstanceBatcher::build.
+	std::vector<int> m_queuedInstancingIds;
+	std::vector<InstanceData> m_queuedInstanceData;
+	/// The instance data of all instanced draw calls of the queue, see @InstanceBatcher::getInstanceTexels.
+	GpuHandle<Texture> m_instanceDataTex;
+	/// The texels uploaded to @m_instanceDataTex, the instance data padded to the height of the texture.
+	std::vector<vec4f> m_instanceDataTexels;
+	/// Reused between the flushes, so the recording contexts keep their memory.
+	std::vector<std::unique_ptr<RecordingChunk>> m_recordingChunks;
 };
 
 } // namespace sge
@@ -0,0 +1,27 @@
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+std::atomic<bool> g_countAllocations(false);
+std::atomic<int> g_numAllocations(0);
+
+void* operator new(std::size_t size) {
+	if (g_countAllocations) {
+		g_numAllocations++;
+	}
+
+	void* const ptr = std::malloc(size > 0 ? size : 1);
+	if (ptr == nullptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
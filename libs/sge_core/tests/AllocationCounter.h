@@ -0,0 +1,8 @@
+#pragma once
+
+#include <atomic>
+
+/// When true every call to the global operator new is counted in @g_numAllocations.
+/// The operator is replaced in AllocationCounter.cpp for the whole test executable.
+extern std::atomic<bool> g_countAllocations;
+extern std::atomic<int> g_numAllocations;
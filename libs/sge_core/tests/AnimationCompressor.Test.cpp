@@ -0,0 +1,169 @@
+#include "sge_core/model/AnimationCompressor.h"
+#include "sge_core/model/Model.h"
+#include "sge_core/model/ModelReader.h"
+#include "sge_core/model/ModelWriter.h"
+#include "sge_utils/utils/FileStream.h"
+#include "doctest/doctest.h"
+
+#include "TestModels.h"
+
+#include <cmath>
+#include <random>
+
+using namespace sge;
+
+namespace {
+
+float rotationErrorRad(const quatf& a, const quatf& b) {
+	const quatf diff = a.normalized() * b.normalized().conjugate();
+	return 2.f * atan2f(diff.xyz().length(), fabsf(diff.w));
+}
+
+size_t countKeys(const ModelAnimation& anim) {
+	size_t numKeys = 0;
+	for (const KeyFrames& keyFrames : anim.perNodeKeyFrames) {
+		numKeys += keyFrames.positionKeyFrames.size() + keyFrames.rotationKeyFrames.size() + keyFrames.scalingKeyFrames.size();
+		numKeys += keyFrames.compressedPositionKeyFrames.size() + keyFrames.compressedRotationKeyFrames.size() +
+		           keyFrames.compressedScalingKeyFrames.size();
+	}
+	return numKeys;
+}
+
+/// Samples both animations between and on the key frames and checks that the errors are within the tolerance of each node.
+void checkErrorBounds(const Model& model, const ModelAnimation& original, const ModelAnimation& compressed, const AnimationCompressor::Settings& settings) {
+	std::vector<float> tolerances;
+	AnimationCompressor::computeNodesTolerance(tolerances, model, settings);
+
+	// The errors between the keys are not exactly linear for the rotations, allow a small slack.
+	const float slack = 1.05f;
+	const int numSamples = int(original.durationSec * 30.f * 4.f);
+
+	for (int iNode = 0; iNode < model.numNodes(); ++iNode) {
+		KeyFramesCursor originalCursor;
+		KeyFramesCursor compressedCursor;
+		for (int iSample = 0; iSample <= numSamples + 8; ++iSample) {
+			const float t = float(iSample) / float(numSamples) * original.durationSec;
+
+			transf3d originalTransform = transf3d::getIdentity();
+			transf3d compressedTransform = transf3d::getIdentity();
+			REQUIRE(original.evaluateForNode(originalTransform, iNode, t, originalCursor));
+			REQUIRE(compressed.evaluateForNode(compressedTransform, iNode, t, compressedCursor));
+
+			CHECK((originalTransform.p - compressedTransform.p).length() <= tolerances[iNode] * slack);
+			CHECK(rotationErrorRad(originalTransform.r, compressedTransform.r) * settings.shellDistance <= tolerances[iNode] * slack);
+			CHECK((originalTransform.s - compressedTransform.s).length() * settings.shellDistance <= tolerances[iNode] * slack);
+		}
+	}
+}
+
+} // namespace
+
+TEST_CASE("AnimationCompressor Quantization round-trip") {
+	std::mt19937 rng(3);
+	std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+	for (int t = 0; t < 1000; ++t) {
+		quatf q(dist(rng), dist(rng), dist(rng), dist(rng));
+		if (q.length() < 1e-3f) {
+			continue;
+		}
+		q = q.normalized();
+
+		uint16 quantized[3];
+		AnimationCompressor::quantizeQuat(quantized, q);
+		const quatf decoded = KeyFrameQuantization::dequantizeQuat(quantized);
+
+		// The sign is kept so the decoded quaternion could be interpolated with the neighbouring keys.
+		CHECK(q.dot(decoded) > 0.f);
+		CHECK(fabsf(decoded.length() - 1.f) < 1e-5f);
+		CHECK(rotationErrorRad(q, decoded) < 2e-4f);
+	}
+
+	const vec3f rangeMin(-3.f, 0.f, 10.f);
+	const vec3f rangeExtent(6.f, 0.f, 100.f);
+	for (int t = 0; t < 1000; ++t) {
+		const vec3f v = rangeMin + vec3f(dist(rng) + 1.f, dist(rng) + 1.f, dist(rng) + 1.f) * 0.5f * rangeExtent;
+
+		uint16 quantized[3];
+		AnimationCompressor::quantizeVec3(quantized, v, rangeMin, rangeExtent);
+		const vec3f decoded = KeyFrameQuantization::dequantizeVec3(quantized, rangeMin, rangeExtent);
+		for (int iComp = 0; iComp < 3; ++iComp) {
+			CHECK(fabsf(decoded[iComp] - v[iComp]) <= rangeExtent[iComp] / 65535.f + 1e-5f);
+		}
+	}
+}
+
+TEST_CASE("AnimationCompressor Errors are within the tolerance") {
+	Model model;
+	makeAnimatedChainModel(model, 12, 4.f);
+	const ModelAnimation& original = *model.animationAt(0);
+
+	AnimationCompressor::Settings settings;
+	ModelAnimation compressed = original;
+	REQUIRE(AnimationCompressor::compressAnimation(compressed, model, settings));
+
+	checkErrorBounds(model, original, compressed, settings);
+
+	// The smooth curves need fewer keys and most channels get quantized.
+	CHECK(countKeys(compressed) * 2 < countKeys(original));
+	CHECK(compressed.perNodeKeyFrames[5].compressedRotationKeyFrames.empty() == false);
+	CHECK(compressed.perNodeKeyFrames[5].rotationKeyFrames.empty());
+
+	// Constant channels need a single key.
+	CHECK(compressed.perNodeKeyFrames[5].compressedPositionKeyFrames.size() == 1);
+
+	// The root moves too far for the 16bit quantization to be within its tolerance, it stays in floats.
+	CHECK(compressed.perNodeKeyFrames[0].positionKeyFrames.empty() == false);
+	CHECK(compressed.perNodeKeyFrames[0].compressedPositionKeyFrames.empty());
+
+	// Compressing again does nothing.
+	ModelAnimation compressedTwice = compressed;
+	AnimationCompressor::compressAnimation(compressedTwice, model, settings);
+	CHECK(countKeys(compressedTwice) <= countKeys(compressed));
+	checkErrorBounds(model, original, compressedTwice, settings);
+
+	SUBCASE("Smaller tolerance") {
+		AnimationCompressor::Settings preciseSettings;
+		preciseSettings.maxError = 0.0001f;
+		ModelAnimation precise = original;
+		AnimationCompressor::compressAnimation(precise, model, preciseSettings);
+		checkErrorBounds(model, original, precise, preciseSettings);
+		CHECK(countKeys(precise) >= countKeys(compressed));
+	}
+}
+
+TEST_CASE("AnimationCompressor Compressed animations are written in the model file") {
+	Model model;
+	makeAnimatedChainModel(model, 6, 2.f);
+
+	WriteByteStream wbs;
+	ModelWriter writer;
+	REQUIRE(writer.compressAnimations);
+	REQUIRE(writer.write(model, &wbs));
+
+	Model loaded;
+	ReadByteStream rbs(wbs.serializedData);
+	REQUIRE(ModelReader().loadModel(ModelLoadSettings(), &rbs, loaded));
+	REQUIRE(loaded.numAnimations() == 1);
+
+	ModelAnimation compressed = *model.animationAt(0);
+	AnimationCompressor::compressAnimation(compressed, model, writer.animationCompression);
+
+	// The loaded animation must be exactly the compressed one.
+	const ModelAnimation& loadedAnim = *loaded.animationAt(0);
+	REQUIRE(loadedAnim.perNodeKeyFrames.size() == compressed.perNodeKeyFrames.size());
+	for (size_t iNode = 0; iNode < compressed.perNodeKeyFrames.size(); ++iNode) {
+		const KeyFrames& a = compressed.perNodeKeyFrames[iNode];
+		const KeyFrames& b = loadedAnim.perNodeKeyFrames[iNode];
+		CHECK(a.positionKeyFrames.times == b.positionKeyFrames.times);
+		CHECK(a.compressedPositionKeyFrames.times == b.compressedPositionKeyFrames.times);
+		CHECK(a.compressedPositionKeyFrames.quantizedValues == b.compressedPositionKeyFrames.quantizedValues);
+		CHECK(a.compressedPositionKeyFrames.rangeMin == b.compressedPositionKeyFrames.rangeMin);
+		CHECK(a.compressedPositionKeyFrames.rangeExtent == b.compressedPositionKeyFrames.rangeExtent);
+		CHECK(a.compressedRotationKeyFrames.times == b.compressedRotationKeyFrames.times);
+		CHECK(a.compressedRotationKeyFrames.quantizedValues == b.compressedRotationKeyFrames.quantizedValues);
+		CHECK(a.compressedScalingKeyFrames.quantizedValues == b.compressedScalingKeyFrames.quantizedValues);
+	}
+
+	checkErrorBounds(model, *model.animationAt(0), loadedAnim, writer.animationCompression);
+}
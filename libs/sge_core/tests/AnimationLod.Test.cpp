@@ -0,0 +1,255 @@
+#include "sge_core/AnimationLod.h"
+#include "sge_core/AnimationSystem.h"
+#include "sge_core/AssetLibrary.h"
+#include "sge_core/model/Model.h"
+#include "sge_utils/utils/timer.h"
+#include "doctest/doctest.h"
+
+#include "TestModels.h"
+
+using namespace sge;
+
+namespace {
+
+void checkSameNodes(const EvaluatedModel& a, const EvaluatedModel& b) {
+	REQUIRE(a.getNumEvalNodes() == b.getNumEvalNodes());
+	for (int iNode = 0; iNode < a.getNumEvalNodes(); ++iNode) {
+		CHECK(a.getEvalNode(iNode).evalGlobalTransform == b.getEvalNode(iNode).evalGlobalTransform);
+	}
+}
+
+AnimationLodSettings makeSingleLevelSettings(const int updateInterval, const bool useBonesMask) {
+	AnimationLodSettings settings;
+	settings.levels.push_back(AnimationLodLevel(0.f, updateInterval, useBonesMask));
+	return settings;
+}
+
+} // namespace
+
+TEST_CASE("AnimationLod Nodes importance") {
+	Model model;
+	makeHandModel(model);
+	REQUIRE(model.isNodesImportanceComputed());
+
+	const std::vector<float>& importance = model.getNodesImportance();
+	CHECK(importance[0] == doctest::Approx(1.f));
+	CHECK(importance[3] == doctest::Approx(104.f / 404.f));
+	CHECK(importance[5] == doctest::Approx(1.f / 404.f));
+
+	for (int iNode = 0; iNode < model.numNodes(); ++iNode) {
+		const int parent = model.getNodeParentIndex(iNode);
+		if (parent >= 0) {
+			CHECK(importance[parent] >= importance[iNode]);
+		}
+	}
+}
+
+TEST_CASE("AnimationLod Full detail matches the regular evaluation") {
+	Model model;
+	makeHandModel(model);
+	AssetLibrary assetLibrary(nullptr);
+
+	EvaluatedModel reference;
+	reference.initialize(&assetLibrary, &model);
+	EvaluatedModel lodModel;
+	lodModel.initialize(&assetLibrary, &model);
+
+	AnimationSystem animSystem;
+	AnimationLodState lodState;
+	const AnimationLodSettings settings = makeSingleLevelSettings(1, false);
+
+	for (int iFrame = 0; iFrame < 5; ++iFrame) {
+		const EvalMomentSets moment(-1, 0, float(iFrame) / 30.f);
+		reference.evaluateNodes(&moment, 1);
+
+		lodState.update(settings, 100.f, true);
+		animSystem.addModel(&lodModel, &moment, 1, &lodState);
+		animSystem.evaluateNodesAndPalettes();
+		animSystem.clear();
+
+		checkSameNodes(reference, lodModel);
+	}
+}
+
+TEST_CASE("AnimationLod Distant models interpolate between sampled poses") {
+	Model model;
+	makeHandModel(model);
+	AssetLibrary assetLibrary(nullptr);
+
+	const auto getMoment = [](const uint32 frameIndex) -> EvalMomentSets { return EvalMomentSets(-1, 0, float(frameIndex) / 30.f); };
+
+	EvaluatedModel sampledAtFrame1;
+	sampledAtFrame1.initialize(&assetLibrary, &model);
+	EvalMomentSets moment = getMoment(1);
+	sampledAtFrame1.evaluateNodes(&moment, 1);
+
+	EvaluatedModel sampledAtFrame4;
+	sampledAtFrame4.initialize(&assetLibrary, &model);
+	moment = getMoment(4);
+	sampledAtFrame4.evaluateNodes(&moment, 1);
+
+	EvaluatedModel lodModel;
+	lodModel.initialize(&assetLibrary, &model);
+	AnimationLodState lodState;
+	lodState.update(makeSingleLevelSettings(4, false), 100.f, true);
+
+	// The first evaluation always samples. The interval starts at frames divisible by 4 (the phase is 0).
+	for (uint32 frameIndex = 1; frameIndex <= 3; ++frameIndex) {
+		moment = getMoment(frameIndex);
+		REQUIRE(lodState.evaluateNodes(lodModel, &moment, 1, frameIndex));
+		checkSameNodes(lodModel, sampledAtFrame1);
+	}
+
+	// Frame 4 samples again and the displayed pose moves towards the new pose over the interval.
+	for (uint32 frameIndex = 4; frameIndex <= 7; ++frameIndex) {
+		moment = getMoment(frameIndex);
+		REQUIRE(lodState.evaluateNodes(lodModel, &moment, 1, frameIndex));
+
+		const float t = float(frameIndex - 3) / 4.f;
+		const vec3f expectedPosition = lerp(sampledAtFrame1.getLocalPose().positions[0], sampledAtFrame4.getLocalPose().positions[0], t);
+		CHECK((lodModel.getEvalNode(0).evalLocalTransform.data[3].xyz() - expectedPosition).length() < 1e-5f);
+	}
+	checkSameNodes(lodModel, sampledAtFrame4);
+
+	// Skipping frames (for example while the model was frozen) snaps to the current animation.
+	moment = getMoment(20);
+	REQUIRE(lodState.evaluateNodes(lodModel, &moment, 1, 20));
+	EvaluatedModel sampledAtFrame20;
+	sampledAtFrame20.initialize(&assetLibrary, &model);
+	sampledAtFrame20.evaluateNodes(&moment, 1);
+	checkSameNodes(lodModel, sampledAtFrame20);
+}
+
+TEST_CASE("AnimationLod Bones mask skips the unimportant nodes") {
+	Model model;
+	makeHandModel(model);
+	AssetLibrary assetLibrary(nullptr);
+
+	const EvalMomentSets moment(-1, 0, 0.5f);
+	EvaluatedModel reference;
+	reference.initialize(&assetLibrary, &model);
+	reference.evaluateNodes(&moment, 1);
+
+	EvaluatedModel lodModel;
+	lodModel.initialize(&assetLibrary, &model);
+	AnimationLodState lodState;
+	lodState.update(makeSingleLevelSettings(1, true), 100.f, true);
+	REQUIRE(lodState.evaluateNodes(lodModel, &moment, 1, 1));
+
+	for (int iNode = 0; iNode < model.numNodes(); ++iNode) {
+		const transf3d localTransform = lodModel.getLocalPose().getNode(iNode);
+		if (iNode < 4) {
+			CHECK(localTransform.p == reference.getLocalPose().positions[iNode]);
+			CHECK(localTransform.r == reference.getLocalPose().rotations[iNode]);
+		} else {
+			CHECK(localTransform.p == model.nodeAt(iNode)->staticLocalTransform.p);
+			CHECK(localTransform.r == model.nodeAt(iNode)->staticLocalTransform.r);
+		}
+	}
+}
+
+TEST_CASE("AnimationLod Bones mask keeps the nodes that move no vertices") {
+	Model model;
+	makeHandModel(model);
+
+	// A socket attached to the tip of a finger, used to hold a weapon.
+	const int socketNode = model.makeNewNode();
+	model.nodeAt(socketNode)->staticLocalTransform = transf3d(vec3f(0.f, 0.1f, 0.f), quatf::getIdentity(), vec3f(1.f));
+	model.nodeAt(5)->childNodes.push_back(socketNode);
+	KeyFrames& socketKeyFrames = model.animationAt(0)->getOrAddKeyFramesForNode(socketNode);
+	socketKeyFrames.positionKeyFrames.setKey(0.f, vec3f(0.f, 0.1f, 0.f));
+	socketKeyFrames.positionKeyFrames.setKey(1.f, vec3f(0.f, 0.2f, 0.f));
+	model.computeNodesOrder();
+	model.computeNodesImportance();
+	CHECK(model.getNodesImportance()[socketNode] == 0.f);
+
+	AssetLibrary assetLibrary(nullptr);
+	const EvalMomentSets moment(-1, 0, 0.5f);
+	EvaluatedModel reference;
+	reference.initialize(&assetLibrary, &model);
+	reference.evaluateNodes(&moment, 1);
+
+	EvaluatedModel lodModel;
+	lodModel.initialize(&assetLibrary, &model);
+	AnimationLodState lodState;
+	lodState.update(makeSingleLevelSettings(1, true), 100.f, true);
+	REQUIRE(lodState.evaluateNodes(lodModel, &moment, 1, 1));
+
+	// The socket follows the animation, so does the finger holding it. The other fingers are skipped.
+	CHECK(lodModel.getEvalNode(socketNode).evalGlobalTransform == reference.getEvalNode(socketNode).evalGlobalTransform);
+	CHECK(lodModel.getEvalNode(5).evalGlobalTransform == reference.getEvalNode(5).evalGlobalTransform);
+	CHECK(lodModel.getLocalPose().getNode(4).p == model.nodeAt(4)->staticLocalTransform.p);
+}
+
+TEST_CASE("AnimationLod Culled models are frozen") {
+	Model model;
+	makeHandModel(model);
+	AssetLibrary assetLibrary(nullptr);
+
+	EvaluatedModel evalModel;
+	evalModel.initialize(&assetLibrary, &model);
+
+	AnimationSystem animSystem;
+	AnimationLodState lodState;
+	const AnimationLodSettings settings = AnimationLodSettings::getDefault();
+	const EvalMomentSets moment(-1, 0, 0.5f);
+
+	// Models that were never evaluated are evaluated even if culled, so they have a valid pose.
+	lodState.update(settings, 10.f, false);
+	CHECK(lodState.isFrozen() == false);
+	animSystem.addModel(&evalModel, &moment, 1, &lodState);
+	CHECK(animSystem.getNumModels() == 1);
+	animSystem.evaluateNodesAndPalettes();
+	animSystem.clear();
+
+	lodState.update(settings, 10.f, false);
+	CHECK(lodState.isFrozen());
+	animSystem.addModel(&evalModel, &moment, 1, &lodState);
+	CHECK(animSystem.getNumModels() == 0);
+
+	lodState.update(settings, 10.f, true);
+	CHECK(lodState.isFrozen() == false);
+
+	CHECK(settings.findLevel(0.f).updateInterval == 1);
+	CHECK(settings.findLevel(1000.f).updateInterval > 1);
+	CHECK(settings.findLevel(1000.f).useBonesMask);
+}
+
+TEST_CASE("AnimationLod Benchmark 1000 agents" * doctest::skip()) {
+	const int numAgents = 1000;
+	const int numFrames = 60;
+
+	Model model;
+	makeHandModel(model, 56);
+	AssetLibrary assetLibrary(nullptr);
+
+	std::vector<EvaluatedModel> agents(numAgents);
+	std::vector<AnimationLodState> lodStates(numAgents);
+	for (EvaluatedModel& agent : agents) {
+		agent.initialize(&assetLibrary, &model);
+	}
+
+	const auto evaluateAgents = [&](const bool useLod) -> float {
+		const AnimationLodSettings settings = AnimationLodSettings::getDefault();
+		AnimationSystem animSystem;
+		Timer timer;
+		for (int iFrame = 0; iFrame < numFrames; ++iFrame) {
+			for (int iAgent = 0; iAgent < numAgents; ++iAgent) {
+				const EvalMomentSets moment(-1, 0, float(iFrame) / 30.f + float(iAgent) * 0.01f);
+				// The agents are spread evenly from the camera up to 100 units, one in ten is out of the view.
+				lodStates[iAgent].update(settings, float(iAgent) * 0.1f, iAgent % 10 != 0);
+				animSystem.addModel(&agents[iAgent], &moment, 1, useLod ? &lodStates[iAgent] : nullptr);
+			}
+			animSystem.evaluateNodesAndPalettes();
+			animSystem.clear();
+		}
+		timer.tick();
+		return timer.diff_seconds();
+	};
+
+	const float fullSeconds = evaluateAgents(false);
+	const float lodSeconds = evaluateAgents(true);
+
+	MESSAGE(numAgents << " agents, " << numFrames << " frames. Full evaluation: " << fullSeconds * 1000.f
+	                  << "ms, with animation LOD: " << lodSeconds * 1000.f << "ms");
+}
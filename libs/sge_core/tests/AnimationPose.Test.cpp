@@ -0,0 +1,220 @@
+#include "sge_core/model/AnimationPose.h"
+#include "sge_utils/utils/timer.h"
+#include "doctest/doctest.h"
+
+#include <cmath>
+#include <random>
+
+using namespace sge;
+
+namespace {
+
+/// The angle in radians between two rotations.
+float rotationAngleBetween(const quatf& a, const quatf& b) {
+	const float d = fabsf(a.normalized().dot(b.normalized()));
+	return 2.f * acosf(std::min(d, 1.f));
+}
+
+quatf randomRotation(std::mt19937& rng, const float maxAngle) {
+	std::uniform_real_distribution<float> dist(-1.f, 1.f);
+	vec3f axis(dist(rng), dist(rng), dist(rng));
+	if (axis.lengthSqr() < 1e-6f) {
+		axis = vec3f::getAxis(1);
+	}
+	return quatf::getAxisAngle(axis.normalized(), dist(rng) * maxAngle);
+}
+
+AnimationPose makeRandomPose(std::mt19937& rng, const int numNodes, const float maxAngle) {
+	std::uniform_real_distribution<float> dist(-1.f, 1.f);
+	AnimationPose pose;
+	pose.resize(numNodes);
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		pose.setNode(iNode, transf3d(vec3f(dist(rng), dist(rng), dist(rng)), randomRotation(rng, maxAngle), vec3f(1.f + dist(rng) * 0.25f)));
+	}
+	return pose;
+}
+
+} // namespace
+
+TEST_CASE("AnimationPose Single pose blend matches the matrix evaluation") {
+	std::mt19937 rng(1);
+	const AnimationPose pose = makeRandomPose(rng, 16, 3.f);
+	const AnimationPose fallback = makeRandomPose(rng, 16, 3.f);
+
+	AnimationPoseBlender blender;
+	blender.begin(16);
+	blender.addPose(pose, 1.f);
+
+	AnimationPose blended;
+	blender.finish(blended, fallback);
+
+	std::vector<mat4f> matrices(16);
+	blended.toMatrices(matrices.data());
+
+	for (int iNode = 0; iNode < 16; ++iNode) {
+		// This is what the model evaluation computed when blending the moments as matrices with a single moment.
+		const mat4f expected = pose.getNode(iNode).toMatrix() * 1.f;
+		for (int c = 0; c < 4; ++c) {
+			for (int r = 0; r < 4; ++r) {
+				CHECK(matrices[iNode].data[c][r] == doctest::Approx(expected.data[c][r]).epsilon(1e-5f));
+			}
+		}
+	}
+}
+
+TEST_CASE("AnimationPose Two pose blend is close to slerp") {
+	std::mt19937 rng(2);
+
+	for (int iTest = 0; iTest < 100; ++iTest) {
+		AnimationPose a;
+		AnimationPose b;
+		a.resize(1);
+		b.resize(1);
+		a.setNode(0, transf3d(vec3f(0.f), randomRotation(rng, 3.f)));
+
+		// Flip the sign of the rotation sometimes, q and -q are the same rotation and the blend should take the shortest path.
+		const quatf delta = randomRotation(rng, 0.5f);
+		const quatf rotationB = (iTest % 2) ? a.rotations[0] * delta : -(a.rotations[0] * delta);
+		b.setNode(0, transf3d(vec3f(1.f), rotationB, vec3f(2.f)));
+
+		for (float t = 0.f; t <= 1.f; t += 0.125f) {
+			AnimationPoseBlender blender;
+			blender.begin(1);
+			blender.addPose(a, 1.f - t);
+			blender.addPose(b, t);
+
+			AnimationPose blended;
+			blender.finish(blended, a);
+
+			// The rotation difference is at most 0.5 radians, nlerp should be within a fraction of a degree from slerp.
+			const quatf reference = slerp(a.rotations[0], rotationB, t);
+			CHECK(rotationAngleBetween(blended.rotations[0], reference) < 0.01f);
+			CHECK(fabsf(blended.rotations[0].length() - 1.f) < 1e-5f);
+			CHECK(blended.positions[0].x == doctest::Approx(t));
+			CHECK(blended.scalings[0].x == doctest::Approx(1.f + t));
+		}
+	}
+}
+
+TEST_CASE("AnimationPose Weights are normalized and masks limit the blend") {
+	AnimationPose a;
+	AnimationPose b;
+	AnimationPose fallback;
+	a.resize(3);
+	b.resize(3);
+	fallback.resize(3);
+	for (int iNode = 0; iNode < 3; ++iNode) {
+		a.setNode(iNode, transf3d(vec3f(0.f)));
+		b.setNode(iNode, transf3d(vec3f(4.f), quatf::getAxisAngle(vec3f::getAxis(1), 1.f)));
+		fallback.setNode(iNode, transf3d(vec3f(-1.f)));
+	}
+
+	// Node 0 is affected only by a, node 1 by both, node 2 by nothing.
+	const float maskA[3] = {1.f, 1.f, 0.f};
+	const float maskB[3] = {0.f, 1.f, 0.f};
+
+	AnimationPoseBlender blender;
+	blender.begin(3);
+	blender.addPose(a, 0.25f, maskA);
+	blender.addPose(b, 0.25f, maskB);
+
+	AnimationPose blended;
+	blender.finish(blended, fallback);
+
+	CHECK(blended.positions[0] == vec3f(0.f));
+	CHECK(blended.positions[1].x == doctest::Approx(2.f));
+	CHECK(rotationAngleBetween(blended.rotations[1], quatf::getAxisAngle(vec3f::getAxis(1), 0.5f)) < 1e-3f);
+	CHECK(blended.positions[2] == vec3f(-1.f));
+}
+
+TEST_CASE("AnimationPose Additive layers") {
+	std::mt19937 rng(3);
+	const AnimationPose base = makeRandomPose(rng, 8, 3.f);
+	const AnimationPose reference = makeRandomPose(rng, 8, 3.f);
+
+	// Adding the reference pose to itself doesn't change anything.
+	{
+		AnimationPose pose = base;
+		AnimationPoseBlender::applyAdditive(pose, reference, reference, 1.f);
+		for (int iNode = 0; iNode < 8; ++iNode) {
+			CHECK((pose.positions[iNode] - base.positions[iNode]).length() < 1e-5f);
+			CHECK((pose.scalings[iNode] - base.scalings[iNode]).length() < 1e-5f);
+			CHECK(rotationAngleBetween(pose.rotations[iNode], base.rotations[iNode]) < 1e-3f);
+		}
+	}
+
+	// The delta between the additive and the reference pose is applied scaled by the weight.
+	{
+		AnimationPose additive = reference;
+		const quatf deltaRotation = quatf::getAxisAngle(vec3f::getAxis(2), 0.8f);
+		for (int iNode = 0; iNode < 8; ++iNode) {
+			additive.positions[iNode] += vec3f(1.f, 2.f, 3.f);
+			additive.rotations[iNode] = reference.rotations[iNode] * deltaRotation;
+			additive.scalings[iNode] = reference.scalings[iNode] * 2.f;
+		}
+
+		const float nodeWeights[8] = {1.f, 1.f, 1.f, 1.f, 0.f, 0.f, 0.f, 0.f};
+
+		AnimationPose pose = base;
+		AnimationPoseBlender::applyAdditive(pose, additive, reference, 0.5f, nodeWeights);
+		for (int iNode = 0; iNode < 8; ++iNode) {
+			if (nodeWeights[iNode] > 0.f) {
+				CHECK((pose.positions[iNode] - (base.positions[iNode] + vec3f(0.5f, 1.f, 1.5f))).length() < 1e-5f);
+				CHECK((pose.scalings[iNode] - base.scalings[iNode] * 1.5f).length() < 1e-5f);
+				const quatf expected = base.rotations[iNode] * quatf::getAxisAngle(vec3f::getAxis(2), 0.4f);
+				CHECK(rotationAngleBetween(pose.rotations[iNode], expected) < 0.01f);
+			} else {
+				CHECK(pose.getNode(iNode) == base.getNode(iNode));
+			}
+		}
+	}
+}
+
+// Compares blending 4 poses as matrices (the previous approach) with the quaternion pose blending.
+// Run with --no-skip to see the timings.
+TEST_CASE("AnimationPose Benchmark 4-way blend" * doctest::skip()) {
+	const int kNumCharacters = 1000;
+	const int kNumNodes = 80;
+
+	std::mt19937 rng(4);
+	AnimationPose poses[4];
+	for (AnimationPose& pose : poses) {
+		pose = makeRandomPose(rng, kNumNodes, 3.f);
+	}
+	const float weights[4] = {0.1f, 0.2f, 0.3f, 0.4f};
+
+	std::vector<mat4f> matrices(kNumNodes);
+	float checksum = 0.f;
+
+	Timer timer;
+	for (int iChar = 0; iChar < kNumCharacters; ++iChar) {
+		std::fill(matrices.begin(), matrices.end(), mat4f::getZero());
+		for (int iPose = 0; iPose < 4; ++iPose) {
+			for (int iNode = 0; iNode < kNumNodes; ++iNode) {
+				matrices[iNode] += poses[iPose].getNode(iNode).toMatrix() * weights[iPose];
+			}
+		}
+		checksum += matrices[0].data[3][0];
+	}
+	timer.tick();
+	const float matrixSeconds = timer.diff_seconds();
+
+	AnimationPoseBlender blender;
+	AnimationPose blended;
+	timer.reset();
+	for (int iChar = 0; iChar < kNumCharacters; ++iChar) {
+		blender.begin(kNumNodes);
+		for (int iPose = 0; iPose < 4; ++iPose) {
+			blender.addPose(poses[iPose], weights[iPose]);
+		}
+		blender.finish(blended, poses[0]);
+		blended.toMatrices(matrices.data());
+		checksum -= matrices[0].data[3][0];
+	}
+	timer.tick();
+	const float poseSeconds = timer.diff_seconds();
+
+	CHECK(fabsf(checksum) < 1e-2f);
+	MESSAGE("Matrix blending: " << matrixSeconds * 1000.f << "ms for " << kNumCharacters << " characters");
+	MESSAGE("Quaternion pose blending: " << poseSeconds * 1000.f << "ms for " << kNumCharacters << " characters");
+}
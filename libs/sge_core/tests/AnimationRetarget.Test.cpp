@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <random>
+
+#include "sge_core/AssetLibrary.h"
+#include "sge_core/model/AnimationRetarget.h"
+#include "sge_core/model/EvaluatedModel.h"
+#include "sge_core/model/Model.h"
+#include "sge_utils/utils/timer.h"
+#include "doctest/doctest.h"
+
+#include "TestModels.h"
+
+using namespace sge;
+
+namespace {
+
+std::vector<std::string> makeBoneNames(const int numBones) {
+	std::vector<std::string> names;
+	for (int iBone = 0; iBone < numBones; ++iBone) {
+		names.push_back("mixamorig:Bone_" + std::to_string(iBone));
+	}
+	return names;
+}
+
+} // namespace
+
+TEST_CASE("AnimationRetarget Node name lookup") {
+	Model model;
+	makeNamedChainModel(model, {"hips", "spine", "head", "spine"}, 1.f);
+	REQUIRE(model.isNodesNameLookupComputed());
+	CHECK(model.getNodesNameLookupId() != 0);
+
+	CHECK(model.findFistNodeIndexWithName("hips") == 0);
+	CHECK(model.findFistNodeIndexWithName("head") == 2);
+	CHECK(model.findFistNodeIndexWithName("spine") == 1);
+	CHECK(model.findFistNodeIndexWithName("tail") == -1);
+
+	// Adding a node invalidates the lookup, the search falls back to the linear one.
+	const int tail = model.makeNewNode();
+	model.nodeAt(tail)->name = "tail";
+	CHECK(model.isNodesNameLookupComputed() == false);
+	CHECK(model.findFistNodeIndexWithName("tail") == tail);
+	CHECK(model.findFistNodeIndexWithName("spine") == 1);
+
+	const uint32 oldLookupId = model.getNodesNameLookupId();
+	model.computeNodesNameLookup();
+	CHECK(model.isNodesNameLookupComputed());
+	CHECK(model.getNodesNameLookupId() != oldLookupId);
+	CHECK(model.findFistNodeIndexWithName("tail") == tail);
+}
+
+TEST_CASE("AnimationRetarget Donor remap") {
+	Model model;
+	makeNamedChainModel(model, {"hips", "spine", "neck", "head"}, 2.f);
+
+	// The donor has the nodes in a different order, misses "neck" and has some extra nodes.
+	Model donor;
+	makeNamedChainModel(donor, {"root", "head", "spine", "hips", "tail"}, 1.f);
+
+	AnimationRetargetCache cache;
+	std::shared_ptr<const AnimationDonorRemap> remap = cache.getRemap(model, donor);
+	CHECK(remap->nodeToDonorNode == std::vector<int>{3, 2, -1, 1});
+	CHECK(remap->translationOffsets[0] == vec3f(0.f, 1.f, 0.f));
+	CHECK(remap->translationOffsets[2] == vec3f(0.f));
+
+	// The same pair of models shares the remap.
+	CHECK((cache.getRemap(model, donor) == remap));
+	CHECK(cache.getNumAliveEntries() == 1);
+
+	// The remap in the opposite direction is a different one.
+	std::shared_ptr<const AnimationDonorRemap> reverseRemap = cache.getRemap(donor, model);
+	CHECK(reverseRemap->nodeToDonorNode == std::vector<int>{-1, 3, 1, 0, -1});
+	CHECK(cache.getNumAliveEntries() == 2);
+
+	// Renaming the nodes requires a new lookup, which produces a new remap.
+	model.nodeAt(2)->name = "tail";
+	model.computeNodesNameLookup();
+	std::shared_ptr<const AnimationDonorRemap> renamedRemap = cache.getRemap(model, donor);
+	CHECK((renamedRemap != remap));
+	CHECK(renamedRemap->nodeToDonorNode == std::vector<int>{3, 2, 4, 1});
+
+	// Unused remaps get removed.
+	remap.reset();
+	reverseRemap.reset();
+	cache.getRemap(donor, donor);
+	CHECK(cache.getNumAliveEntries() == 1);
+}
+
+TEST_CASE("AnimationRetarget Donors with different proportions") {
+	AssetLibrary assetLibrary(nullptr);
+
+	// The target is twice as tall as the donor.
+	Model model;
+	makeNamedChainModel(model, {"hips", "spine", "head"}, 2.f);
+
+	AssetModel donorAssetModel;
+	Model& donor = donorAssetModel.model;
+	makeNamedChainModel(donor, {"hips", "spine", "head"}, 1.f);
+	ModelAnimation& anim = *donor.animationAt(donor.makeNewAnim());
+	anim.durationSec = 1.f;
+	anim.getOrAddKeyFramesForNode(0).rotationKeyFrames.setKey(0.f, quatf::getAxisAngle(vec3f::getAxis(2), half_pi<float>()));
+	anim.getOrAddKeyFramesForNode(1).positionKeyFrames.setKey(0.f, vec3f(0.5f, 1.f, 0.f));
+
+	std::shared_ptr<Asset> donorAsset = std::make_shared<Asset>(&donorAssetModel, AssetType::Model, AssetStatus::Loaded, "donor");
+
+	EvaluatedModel evalModel;
+	evalModel.initialize(&assetLibrary, &model);
+	const int donorIndex = evalModel.addAnimationDonor(donorAsset);
+	REQUIRE(donorIndex == 0);
+
+	const EvalMomentSets moment(donorIndex, 0, 0.f);
+	evalModel.evaluateNodes(&moment, 1);
+
+	// The rotations come from the donor, the bone lengths stay the ones of the target.
+	const mat4f expectedHips = transf3d(vec3f(0.f, 2.f, 0.f), quatf::getAxisAngle(vec3f::getAxis(2), half_pi<float>()), vec3f(1.f)).toMatrix();
+	const mat4f expectedSpine = transf3d(vec3f(0.5f, 2.f, 0.f), quatf::getIdentity(), vec3f(1.f)).toMatrix();
+	const mat4f expectedHead = transf3d(vec3f(0.f, 2.f, 0.f), quatf::getIdentity(), vec3f(1.f)).toMatrix();
+	for (int i = 0; i < 16; ++i) {
+		CHECK(evalModel.getEvalNode(0).evalLocalTransform.data[i / 4][i % 4] == doctest::Approx(expectedHips.data[i / 4][i % 4]));
+		CHECK(evalModel.getEvalNode(1).evalLocalTransform.data[i / 4][i % 4] == doctest::Approx(expectedSpine.data[i / 4][i % 4]));
+		CHECK(evalModel.getEvalNode(2).evalLocalTransform.data[i / 4][i % 4] == doctest::Approx(expectedHead.data[i / 4][i % 4]));
+	}
+
+	// Skeletons with the same proportions play the donor animation as it is.
+	Model sameSizeModel;
+	makeNamedChainModel(sameSizeModel, {"hips", "spine", "head"}, 1.f);
+	EvaluatedModel sameSizeEval;
+	sameSizeEval.initialize(&assetLibrary, &sameSizeModel);
+	sameSizeEval.addAnimationDonor(donorAsset);
+	sameSizeEval.evaluateNodes(&moment, 1);
+	CHECK(sameSizeEval.getEvalNode(1).evalLocalTransform == transf3d(vec3f(0.5f, 1.f, 0.f)).toMatrix());
+}
+
+TEST_CASE("AnimationRetarget Benchmark attaching 50 donors to a 150 bone rig" * doctest::skip()) {
+	const int numBones = 150;
+	const int numDonors = 50;
+	const int numInstances = 100;
+
+	AssetLibrary assetLibrary(nullptr);
+	const std::vector<std::string> boneNames = makeBoneNames(numBones);
+
+	Model model;
+	makeNamedChainModel(model, boneNames, 1.f);
+
+	// Every donor has the bones in a different order.
+	std::mt19937 rng(42);
+	std::vector<std::unique_ptr<AssetModel>> donorAssetModels;
+	std::vector<std::shared_ptr<Asset>> donorAssets;
+	for (int iDonor = 0; iDonor < numDonors; ++iDonor) {
+		std::vector<std::string> donorBoneNames = boneNames;
+		std::shuffle(donorBoneNames.begin(), donorBoneNames.end(), rng);
+		donorAssetModels.emplace_back(new AssetModel());
+		makeNamedChainModel(donorAssetModels.back()->model, donorBoneNames, 1.f);
+		donorAssets.push_back(std::make_shared<Asset>(donorAssetModels.back().get(), AssetType::Model, AssetStatus::Loaded, "donor"));
+	}
+
+	// The remaps computed with linear searches.
+	Timer timer;
+	AnimationDonorRemap remap;
+	for (int iInstance = 0; iInstance < numInstances; ++iInstance) {
+		for (int iDonor = 0; iDonor < numDonors; ++iDonor) {
+			const Model& donor = donorAssetModels[iDonor]->model;
+			remap.nodeToDonorNode.assign(numBones, -1);
+			for (int iNode = 0; iNode < numBones; ++iNode) {
+				for (int iDonorNode = 0; iDonorNode < donor.numNodes(); ++iDonorNode) {
+					if (donor.nodeAt(iDonorNode)->name == model.nodeAt(iNode)->name) {
+						remap.nodeToDonorNode[iNode] = iDonorNode;
+						break;
+					}
+				}
+			}
+		}
+	}
+	timer.tick();
+	const float linearSeconds = timer.diff_seconds();
+
+	// The remaps computed with the hashed lookup.
+	for (int iInstance = 0; iInstance < numInstances; ++iInstance) {
+		for (int iDonor = 0; iDonor < numDonors; ++iDonor) {
+			AnimationRetargetCache::computeRemap(remap, model, donorAssetModels[iDonor]->model);
+		}
+	}
+	timer.tick();
+	const float hashedSeconds = timer.diff_seconds();
+
+	// The instances attaching the donors through the cache.
+	AnimationRetargetCache::getGlobal().clear();
+	std::vector<EvaluatedModel> instances(numInstances);
+	timer.tick();
+	for (EvaluatedModel& evalModel : instances) {
+		evalModel.initialize(&assetLibrary, &model);
+		for (const std::shared_ptr<Asset>& donorAsset : donorAssets) {
+			evalModel.addAnimationDonor(donorAsset);
+		}
+	}
+	timer.tick();
+	const float cachedSeconds = timer.diff_seconds();
+
+	CHECK(AnimationRetargetCache::getGlobal().getNumAliveEntries() == numDonors);
+	MESSAGE(numInstances << " instances attaching " << numDonors << " donors to a " << numBones
+	                     << " bone rig. Linear search: " << linearSeconds * 1000.f << "ms, hashed lookup: " << hashedSeconds * 1000.f
+	                     << "ms, hashed lookup with cached remaps: " << cachedSeconds * 1000.f << "ms");
+}
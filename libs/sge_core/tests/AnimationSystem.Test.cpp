@@ -0,0 +1,114 @@
+#include "sge_core/AnimationSystem.h"
+#include "sge_core/AssetLibrary.h"
+#include "sge_core/model/Model.h"
+#include "sge_utils/utils/timer.h"
+#include "doctest/doctest.h"
+
+#include "TestModels.h"
+
+
+using namespace sge;
+
+namespace {
+
+/// A crowd of characters sharing the same model, each one playing the animations at a different time.
+struct Crowd {
+	Crowd(const int numCharacters, const int numNodes)
+	    : assetLibrary(nullptr) {
+		makeRandomCharacterModel(model, numNodes);
+		characters.resize(numCharacters);
+		for (EvaluatedModel& character : characters) {
+			character.initialize(&assetLibrary, &model);
+		}
+	}
+
+	void getMoments(const int iCharacter, const float time, EvalMomentSets outMoments[2]) const {
+		const float characterTime = time + float(iCharacter) * 0.013f;
+		outMoments[0] = EvalMomentSets(-1, 0, characterTime, 0.7f);
+		outMoments[1] = EvalMomentSets(-1, 1, characterTime * 1.3f, 0.3f);
+	}
+
+	AssetLibrary assetLibrary;
+	Model model;
+	std::vector<EvaluatedModel> characters;
+};
+
+void checkSameEvaluation(const EvaluatedModel& a, const EvaluatedModel& b) {
+	REQUIRE(a.getNumEvalNodes() == b.getNumEvalNodes());
+	for (int iNode = 0; iNode < a.getNumEvalNodes(); ++iNode) {
+		CHECK(a.getEvalNode(iNode).evalGlobalTransform == b.getEvalNode(iNode).evalGlobalTransform);
+	}
+
+	REQUIRE(a.getSkinningPalette().size() == b.getSkinningPalette().size());
+	for (size_t iBone = 0; iBone < a.getSkinningPalette().size(); ++iBone) {
+		CHECK(a.getSkinningPalette()[iBone] == b.getSkinningPalette()[iBone]);
+	}
+
+	CHECK(a.aabox.min == b.aabox.min);
+	CHECK(a.aabox.max == b.aabox.max);
+}
+
+} // namespace
+
+TEST_CASE("AnimationSystem Parallel evaluation matches the serial one") {
+	const int numCharacters = 40;
+	Crowd serialCrowd(numCharacters, 30);
+	Crowd parallelCrowd(numCharacters, 30);
+
+	AnimationSystem animSystem;
+	animSystem.numWorkerThreads = 3;
+
+	for (const float time : {0.f, 0.33f, 0.9f}) {
+		for (int iCharacter = 0; iCharacter < numCharacters; ++iCharacter) {
+			EvalMomentSets moments[2];
+			serialCrowd.getMoments(iCharacter, time, moments);
+			serialCrowd.characters[iCharacter].evaluateNodes(moments, 2);
+			serialCrowd.characters[iCharacter].computeSkinningPalette();
+
+			parallelCrowd.getMoments(iCharacter, time, moments);
+			animSystem.addModel(&parallelCrowd.characters[iCharacter], moments, 2);
+		}
+
+		CHECK(animSystem.getNumModels() == numCharacters);
+		animSystem.evaluateNodesAndPalettes();
+
+		for (int iCharacter = 0; iCharacter < numCharacters; ++iCharacter) {
+			checkSameEvaluation(serialCrowd.characters[iCharacter], parallelCrowd.characters[iCharacter]);
+		}
+
+		// There is no device to upload the skinning to, so the evaluation cannot be finished.
+		animSystem.clear();
+		CHECK(animSystem.getNumModels() == 0);
+	}
+}
+
+TEST_CASE("AnimationSystem Benchmark evaluating a crowd" * doctest::skip()) {
+	const int numCharacters = 300;
+	const int numFrames = 30;
+	Crowd crowd(numCharacters, 60);
+
+	const auto evaluateCrowd = [&](AnimationSystem& animSystem) -> float {
+		Timer timer;
+		for (int iFrame = 0; iFrame < numFrames; ++iFrame) {
+			for (int iCharacter = 0; iCharacter < numCharacters; ++iCharacter) {
+				EvalMomentSets moments[2];
+				crowd.getMoments(iCharacter, float(iFrame) / 30.f, moments);
+				animSystem.addModel(&crowd.characters[iCharacter], moments, 2);
+			}
+			animSystem.evaluateNodesAndPalettes();
+			animSystem.clear();
+		}
+		timer.tick();
+		return timer.diff_seconds();
+	};
+
+	AnimationSystem serialSystem;
+	serialSystem.useWorkerThreads = false;
+	AnimationSystem parallelSystem;
+
+	const float serialSeconds = evaluateCrowd(serialSystem);
+	const float parallelSeconds = evaluateCrowd(parallelSystem);
+
+	MESSAGE(numCharacters << " characters, " << numFrames << " frames. Serial: " << serialSeconds * 1000.f
+	                      << "ms, parallel: " << parallelSeconds * 1000.f << "ms, worker threads: " << ThreadPool::getDefaultNumWorkers());
+}
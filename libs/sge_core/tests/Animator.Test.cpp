@@ -0,0 +1,338 @@
+#include "sge_core/Animator.h"
+#include "sge_core/AssetLibrary.h"
+#include "sge_core/model/Model.h"
+#include "sge_utils/utils/timer.h"
+#include "doctest/doctest.h"
+
+#include "AllocationCounter.h"
+#include "TestModels.h"
+
+using namespace sge;
+
+namespace {
+
+enum : int {
+	track_idle = 100,
+	track_walk = 7,
+	track_jump = 42,
+};
+
+/// The character, evaluated and animated by a @ModelAnimator.
+struct TestCharacter {
+	TestCharacter()
+	    : assetLibrary(nullptr) {
+		makeCharacterModel(assetModel.model);
+		asset = std::make_shared<Asset>(&assetModel, AssetType::Model, AssetStatus::Loaded, "character");
+		evalModel.initialize(&assetLibrary, &assetModel.model);
+	}
+
+	void addTracks(ModelAnimator& animator) {
+		animator.addTrack_begin(evalModel);
+		animator.addTrack(track_idle, 0.5f, trackTransition_loop);
+		animator.addTrack(track_walk, 0.5f, trackTransition_loop);
+		animator.addTrack(track_jump, 0.1f, trackTransition_stop);
+		animator.addAnimationToTrack(track_idle, asset, "idle");
+		animator.addAnimationToTrack(track_walk, asset, "walk");
+		animator.addAnimationToTrack(track_jump, asset, "jump");
+		animator.addTrack_finish();
+	}
+
+	AssetLibrary assetLibrary;
+	AssetModel assetModel;
+	std::shared_ptr<Asset> asset;
+	EvaluatedModel evalModel;
+};
+
+/// The states and the parameters of the locomotion state machine.
+struct Locomotion {
+	void setup(ModelAnimator& animator) {
+		idle = animator.addState(track_idle);
+		walk = animator.addState(track_walk);
+		jump = animator.addState(track_jump);
+		speed = animator.addParameter(0.f);
+		jumpRequested = animator.addParameter(0.f);
+
+		// The transitions are checked in order, so the jump is first to be possible from any state.
+		AnimatorStateTransition transition;
+		transition.fromState = -1;
+		transition.toState = jump;
+		transition.condition = animatorCondition_greater;
+		transition.parameterIndex = jumpRequested;
+		transition.threshold = 0.5f;
+		transition.crossfadeSeconds = 0.1f;
+		transition.crossfadeCurve = crossfadeCurve_easeOut;
+		animator.addTransition(transition);
+
+		transition.fromState = idle;
+		transition.toState = walk;
+		transition.condition = animatorCondition_greater;
+		transition.parameterIndex = speed;
+		transition.threshold = 0.5f;
+		transition.crossfadeSeconds = 0.25f;
+		transition.crossfadeCurve = crossfadeCurve_smoothStep;
+		animator.addTransition(transition);
+
+		transition.fromState = walk;
+		transition.toState = idle;
+		transition.condition = animatorCondition_less;
+		animator.addTransition(transition);
+
+		transition.fromState = jump;
+		transition.toState = idle;
+		transition.condition = animatorCondition_animationEnded;
+		transition.parameterIndex = -1;
+		animator.addTransition(transition);
+
+		animator.setState(idle);
+	}
+
+	int idle = -1;
+	int walk = -1;
+	int jump = -1;
+	int speed = -1;
+	int jumpRequested = -1;
+};
+
+} // namespace
+
+TEST_CASE("ModelAnimator Tracks are stored densely") {
+	TestCharacter character;
+	ModelAnimator animator;
+	character.addTracks(animator);
+
+	CHECK(animator.getNumTracks() == 3);
+	CHECK(animator.findTrackIndex(track_idle) == 0);
+	CHECK(animator.findTrackIndex(track_walk) == 1);
+	CHECK(animator.findTrackIndex(track_jump) == 2);
+	CHECK(animator.findTrackIndex(-5) == -1);
+
+	// Adding an existing track changes it instead of adding a new one.
+	CHECK(animator.addTrack(track_walk, 1.f, trackTransition_loop) == 1);
+	CHECK(animator.getNumTracks() == 3);
+
+	// Without any track played the model is evaluated at its static moment.
+	AnimatorEvalMoments moments;
+	animator.computeEvalMoments(moments);
+	REQUIRE(moments.size() == 1);
+	CHECK(moments[0].animationIndex == -1);
+
+	animator.playTrack(track_walk);
+	animator.update(0.25f);
+	animator.computeEvalMoments(moments);
+	REQUIRE(moments.size() == 1);
+	CHECK(moments[0].donorIndex == 0);
+	CHECK(moments[0].animationIndex == 1);
+	CHECK(moments[0].time == doctest::Approx(0.25f));
+	CHECK(moments[0].weight == doctest::Approx(1.f));
+}
+
+TEST_CASE("ModelAnimator Crossfading between tracks") {
+	TestCharacter character;
+	ModelAnimator animator;
+	character.addTracks(animator);
+
+	animator.playTrack(track_idle);
+	animator.update(0.1f);
+	animator.playTrack(track_walk, 1.f);
+	animator.update(0.25f);
+
+	AnimatorEvalMoments moments;
+	animator.computeEvalMoments(moments);
+	REQUIRE(moments.size() == 2);
+	CHECK(moments[0].animationIndex == 0);
+	CHECK(moments[1].animationIndex == 1);
+	CHECK(moments[0].weight == doctest::Approx(0.75f));
+	CHECK(moments[1].weight == doctest::Approx(0.25f));
+
+	// The std::vector overload produces the same moments.
+	std::vector<EvalMomentSets> momentsVector;
+	animator.computeEvalMoments(momentsVector);
+	REQUIRE(momentsVector.size() == 2);
+	CHECK(momentsVector[0].weight == moments[0].weight);
+	CHECK(momentsVector[1].animationIndex == moments[1].animationIndex);
+
+	// Once faded in only the new track is left.
+	animator.update(1.f);
+	animator.computeEvalMoments(moments);
+	REQUIRE(moments.size() == 1);
+	CHECK(moments[0].animationIndex == 1);
+
+	CHECK(ModelAnimator::evaluateCrossfadeCurve(crossfadeCurve_linear, 0.25f) == doctest::Approx(0.25f));
+	CHECK(ModelAnimator::evaluateCrossfadeCurve(crossfadeCurve_smoothStep, 0.25f) == doctest::Approx(0.15625f));
+	CHECK(ModelAnimator::evaluateCrossfadeCurve(crossfadeCurve_easeIn, 0.25f) == doctest::Approx(0.0625f));
+	CHECK(ModelAnimator::evaluateCrossfadeCurve(crossfadeCurve_easeOut, 0.25f) == doctest::Approx(0.4375f));
+	for (const AnimatorCrossfadeCurve curve : {crossfadeCurve_linear, crossfadeCurve_smoothStep, crossfadeCurve_easeIn, crossfadeCurve_easeOut}) {
+		CHECK(ModelAnimator::evaluateCrossfadeCurve(curve, 0.f) == 0.f);
+		CHECK(ModelAnimator::evaluateCrossfadeCurve(curve, 1.f) == 1.f);
+	}
+}
+
+TEST_CASE("ModelAnimator State machine") {
+	TestCharacter character;
+	ModelAnimator animator;
+	character.addTracks(animator);
+	Locomotion locomotion;
+	locomotion.setup(animator);
+
+	CHECK(animator.getState() == locomotion.idle);
+	animator.update(0.1f);
+	CHECK(animator.getState() == locomotion.idle);
+
+	animator.setParameter(locomotion.speed, 1.f);
+	animator.update(0.1f);
+	CHECK(animator.getState() == locomotion.walk);
+
+	// The smooth step curve is used while fading to the walk animation, the fade starts in the frame of the transition.
+	AnimatorEvalMoments moments;
+	animator.computeEvalMoments(moments);
+	REQUIRE(moments.size() == 2);
+	const float walkWeight = ModelAnimator::evaluateCrossfadeCurve(crossfadeCurve_smoothStep, 0.4f);
+	const float idleWeight = ModelAnimator::evaluateCrossfadeCurve(crossfadeCurve_smoothStep, 0.6f);
+	CHECK(moments[1].animationIndex == 1);
+	CHECK(moments[1].weight == doctest::Approx(walkWeight / (walkWeight + idleWeight)));
+
+	// The jump could happen from any state and returns to idle once it ends.
+	animator.setParameter(locomotion.speed, 0.f);
+	animator.setParameter(locomotion.jumpRequested, 1.f);
+	animator.update(0.1f);
+	CHECK(animator.getState() == locomotion.jump);
+	animator.setParameter(locomotion.jumpRequested, 0.f);
+
+	animator.update(0.5f);
+	CHECK(animator.getState() == locomotion.jump);
+	animator.update(0.6f);
+	CHECK(animator.getState() == locomotion.idle);
+}
+
+TEST_CASE("ModelAnimator Playbacks keep the crossfade curve of their transition") {
+	TestCharacter character;
+	ModelAnimator animator;
+	character.addTracks(animator);
+	Locomotion locomotion;
+	locomotion.setup(animator);
+
+	// Idle starts fading out and walk fading in with the smooth step curve.
+	animator.setParameter(locomotion.speed, 1.f);
+	animator.update(0.1f);
+	REQUIRE(animator.getState() == locomotion.walk);
+
+	// The linear fade to the jump doesn't change the curve of the idle, only walk starts fading out linearly.
+	animator.playTrack(track_jump, 1.f);
+	animator.update(0.05f);
+
+	AnimatorEvalMoments moments;
+	animator.computeEvalMoments(moments);
+	REQUIRE(moments.size() == 3);
+	const float idleWeight = ModelAnimator::evaluateCrossfadeCurve(crossfadeCurve_smoothStep, 0.55f);
+	const float walkWeight = 0.35f;
+	const float jumpWeight = 0.05f;
+	const float totalWeight = idleWeight + walkWeight + jumpWeight;
+	CHECK(moments[0].animationIndex == 0);
+	CHECK(moments[0].weight == doctest::Approx(idleWeight / totalWeight));
+	CHECK(moments[1].animationIndex == 1);
+	CHECK(moments[1].weight == doctest::Approx(walkWeight / totalWeight));
+	CHECK(moments[2].animationIndex == 2);
+	CHECK(moments[2].weight == doctest::Approx(jumpWeight / totalWeight));
+}
+
+TEST_CASE("ModelAnimator The oldest playback is folded into the next one when there are too many") {
+	TestCharacter character;
+	ModelAnimator animator;
+	character.addTracks(animator);
+
+	// The fades get shorter and shorter, so none of the playbacks fades out completely.
+	animator.playTrack(track_idle);
+	for (int iPlayback = 1; iPlayback < kAnimatorMaxPlaybacks; ++iPlayback) {
+		animator.update(0.4f / float(1 << iPlayback));
+		animator.playTrack(iPlayback % 2 ? track_walk : track_idle, 1.f);
+	}
+	animator.update(0.4f / float(1 << kAnimatorMaxPlaybacks));
+
+	AnimatorEvalMoments before;
+	animator.computeEvalMoments(before);
+	REQUIRE(before.size() == kAnimatorMaxPlaybacks);
+
+	animator.playTrack(track_jump, 1.f);
+
+	// The new playback starts with no weight, the weights of the others must not change.
+	AnimatorEvalMoments after;
+	animator.computeEvalMoments(after);
+	REQUIRE(after.size() == kAnimatorMaxPlaybacks);
+	CHECK(after[0].animationIndex == before[1].animationIndex);
+	CHECK(after[0].weight == doctest::Approx(before[0].weight + before[1].weight));
+	for (int iMoment = 1; iMoment + 1 < kAnimatorMaxPlaybacks; ++iMoment) {
+		CHECK(after[iMoment].weight == doctest::Approx(before[iMoment + 1].weight));
+	}
+	CHECK(after.back().animationIndex == 2);
+	CHECK(after.back().weight == 0.f);
+}
+
+TEST_CASE("ModelAnimator Updating does not allocate after the setup") {
+	TestCharacter character;
+	ModelAnimator animator;
+	character.addTracks(animator);
+	Locomotion locomotion;
+	locomotion.setup(animator);
+
+	AnimatorEvalMoments moments;
+
+	// Warm-up, the evaluated model allocates its scratch buffers for the largest number of moments.
+	const EvalMomentSets warmUpMoments[kAnimatorMaxPlaybacks];
+	character.evalModel.evaluateNodes(warmUpMoments, kAnimatorMaxPlaybacks);
+	for (int iFrame = 0; iFrame < 10; ++iFrame) {
+		animator.setParameter(locomotion.speed, float(iFrame % 2));
+		animator.update(1.f / 30.f);
+		animator.computeEvalMoments(moments);
+		character.evalModel.evaluateNodes(moments.data(), moments.size());
+	}
+
+	g_numAllocations = 0;
+	g_countAllocations = true;
+	for (int iFrame = 0; iFrame < 1000; ++iFrame) {
+		animator.setParameter(locomotion.speed, (iFrame / 20) % 2 == 0 ? 1.f : 0.f);
+		animator.setParameter(locomotion.jumpRequested, iFrame % 97 == 0 ? 1.f : 0.f);
+		animator.update(1.f / 30.f);
+		if (iFrame % 300 == 0) {
+			animator.playTrack(iFrame % 600 == 0 ? track_walk : track_idle, 0.2f);
+		}
+		animator.computeEvalMoments(moments);
+		character.evalModel.evaluateNodes(moments.data(), moments.size());
+	}
+	g_countAllocations = false;
+
+	CHECK(g_numAllocations == 0);
+}
+
+TEST_CASE("ModelAnimator Benchmark 1000 animators" * doctest::skip()) {
+	const int numAnimators = 1000;
+	const int numFrames = 1000;
+
+	TestCharacter character;
+	std::vector<ModelAnimator> animators(numAnimators);
+	std::vector<Locomotion> locomotions(numAnimators);
+	for (int iAnimator = 0; iAnimator < numAnimators; ++iAnimator) {
+		character.addTracks(animators[iAnimator]);
+		locomotions[iAnimator].setup(animators[iAnimator]);
+	}
+
+	AnimatorEvalMoments moments;
+	int numMoments = 0;
+
+	Timer timer;
+	for (int iFrame = 0; iFrame < numFrames; ++iFrame) {
+		for (int iAnimator = 0; iAnimator < numAnimators; ++iAnimator) {
+			ModelAnimator& animator = animators[iAnimator];
+			const Locomotion& locomotion = locomotions[iAnimator];
+			animator.setParameter(locomotion.speed, ((iFrame + iAnimator) / 40) % 2 == 0 ? 1.f : 0.f);
+			animator.setParameter(locomotion.jumpRequested, (iFrame + iAnimator) % 151 == 0 ? 1.f : 0.f);
+			animator.update(1.f / 60.f);
+			animator.computeEvalMoments(moments);
+			numMoments += moments.size();
+		}
+	}
+	timer.tick();
+
+	CHECK(numMoments >= numAnimators * numFrames);
+	MESSAGE(numAnimators << " animators, " << numFrames << " frames: " << timer.diff_seconds() * 1000.f / float(numFrames)
+	                     << "ms per frame, " << float(numMoments) / float(numAnimators * numFrames) << " moments per animator");
+}
@@ -0,0 +1,288 @@
+#include "sge_core/model/CpuSkinning.h"
+#include "sge_core/model/MeshQuantizer.h"
+#include "sge_core/model/Model.h"
+#include "sge_utils/math/mat4_simd.h"
+#include "sge_utils/math/transform.h"
+#include "doctest/doctest.h"
+
+#include <cmath>
+#include <cstring>
+#include <random>
+
+using namespace sge;
+
+namespace {
+
+struct SkinnedVertex {
+	vec3f position;
+	vec3f normal;
+	int bonesIds[4];
+	float bonesWeights[4];
+};
+
+/// Random vertices, each affected by up to 4 of the @numBones bones. Some of the vertices use invalid bone ids with zero weight,
+/// like the importer does for vertices affected by less than 4 bones.
+std::vector<SkinnedVertex> makeSkinnedVertices(const int numVertices, const int numBones) {
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<float> dist(-1.f, 1.f);
+	std::uniform_int_distribution<int> boneDist(0, numBones - 1);
+
+	std::vector<SkinnedVertex> vertices(numVertices);
+	for (int iVertex = 0; iVertex < numVertices; ++iVertex) {
+		SkinnedVertex& v = vertices[iVertex];
+		v.position = vec3f(dist(rng), dist(rng), dist(rng)) * 2.f;
+		v.normal = vec3f(dist(rng), dist(rng), dist(rng) + 2.f).normalized0();
+
+		const int numInfluences = 1 + iVertex % 4;
+		float weightsSum = 0.f;
+		for (int iInfluence = 0; iInfluence < 4; ++iInfluence) {
+			const bool isUsed = iInfluence < numInfluences;
+			v.bonesIds[iInfluence] = isUsed ? boneDist(rng) : -1;
+			v.bonesWeights[iInfluence] = isUsed ? 0.1f + (dist(rng) + 1.f) : 0.f;
+			weightsSum += v.bonesWeights[iInfluence];
+		}
+
+		for (float& w : v.bonesWeights) {
+			w /= weightsSum;
+		}
+	}
+
+	return vertices;
+}
+
+ModelMesh makeSkinnedMesh(const std::vector<SkinnedVertex>& vertices, const int numBones) {
+	ModelMesh mesh;
+	mesh.name = "skinned";
+	mesh.primitiveTopology = PrimitiveTopology::PointList;
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_position", UniformType::Float3, 0));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_normal", UniformType::Float3, 12));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_bonesIds", UniformType::Int4, 24));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_bonesWeights", UniformType::Float4, 40));
+	mesh.stride = sizeof(SkinnedVertex);
+	mesh.vbPositionOffsetBytes = 0;
+	mesh.vbNormalOffsetBytes = 12;
+	mesh.vbBonesIdsBytesOffset = 24;
+	mesh.vbBonesWeightsByteOffset = 40;
+	mesh.numVertices = int(vertices.size());
+	mesh.numElements = int(vertices.size());
+	mesh.vertexBufferRaw = std::vector<char>((const char*)vertices.data(), (const char*)(vertices.data() + vertices.size()));
+	for (const SkinnedVertex& v : vertices) {
+		mesh.aabox.expand(v.position);
+	}
+
+	for (int iBone = 0; iBone < numBones; ++iBone) {
+		mesh.bones.push_back(ModelMeshBone(mat4f::getIdentity(), iBone));
+	}
+
+	return mesh;
+}
+
+std::vector<mat4f> makeBonesTransforms(const int numBones, const bool withScaling) {
+	std::mt19937 rng(13);
+	std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+	std::vector<mat4f> bones(numBones);
+	for (mat4f& bone : bones) {
+		const vec3f scaling = withScaling ? vec3f(1.f + 0.5f * dist(rng), 1.f + 0.5f * dist(rng), 1.f) : vec3f(1.f);
+		const quatf rotation = quatf::getAxisAngle(vec3f(dist(rng), dist(rng), dist(rng) + 2.f).normalized0(), dist(rng) * 3.f);
+		bone = transf3d(vec3f(dist(rng), dist(rng), dist(rng)) * 3.f, rotation, scaling).toMatrix();
+	}
+
+	return bones;
+}
+
+/// The linear blend skinning as done in the vertex shader.
+void skinVertexReference(vec3f& outPosition, vec3f& outNormal, const SkinnedVertex& v, const std::vector<mat4f>& bones) {
+	mat4f skinMtx = mat4f::getZero();
+	for (int iInfluence = 0; iInfluence < 4; ++iInfluence) {
+		if (v.bonesIds[iInfluence] >= 0) {
+			const mat4f& bone = bones[v.bonesIds[iInfluence]];
+			for (int iCol = 0; iCol < 4; ++iCol) {
+				skinMtx.data[iCol] += bone.data[iCol] * v.bonesWeights[iInfluence];
+			}
+		}
+	}
+
+	outPosition = (skinMtx * vec4f(v.position, 1.f)).xyz();
+	outNormal = (skinMtx * vec4f(v.normal, 0.f)).xyz().normalized0();
+}
+
+bool isClose(const vec3f& a, const vec3f& b, const float epsilon) {
+	return (a - b).length() <= epsilon;
+}
+
+} // namespace
+
+TEST_CASE("CpuSkinning SIMD matrix multiplication matches the scalar one") {
+	const std::vector<mat4f> matrices = makeBonesTransforms(16, true);
+	for (size_t t = 0; t + 1 < matrices.size(); ++t) {
+		mat4f result;
+		mat4f_mul_simd(result, matrices[t], matrices[t + 1]);
+		CHECK(result == matrices[t] * matrices[t + 1]);
+	}
+}
+
+TEST_CASE("CpuSkinning Linear blend skinning matches the reference") {
+	const int numBones = 12;
+	// Not a multiple of the batch size on purpose.
+	const std::vector<SkinnedVertex> vertices = makeSkinnedVertices(101, numBones);
+	const std::vector<mat4f> bones = makeBonesTransforms(numBones, true);
+	const ModelMesh mesh = makeSkinnedMesh(vertices, numBones);
+
+	REQUIRE(CpuSkinning::canSkinMesh(mesh));
+	REQUIRE(CpuSkinning::canSkinVertexBuffer(mesh));
+
+	std::vector<vec3f> positions(vertices.size());
+	std::vector<vec3f> normals(vertices.size());
+	REQUIRE(CpuSkinning::skinMesh(positions.data(), normals.data(), mesh, bones.data()));
+
+	for (size_t iVertex = 0; iVertex < vertices.size(); ++iVertex) {
+		vec3f expectedPosition, expectedNormal;
+		skinVertexReference(expectedPosition, expectedNormal, vertices[iVertex], bones);
+		CHECK(isClose(positions[iVertex], expectedPosition, 1e-4f));
+		CHECK(isClose(normals[iVertex], expectedNormal, 1e-4f));
+	}
+
+	SUBCASE("Skinned vertex buffer") {
+		std::vector<char> skinnedVertices;
+		REQUIRE(CpuSkinning::skinVertexBuffer(skinnedVertices, mesh, bones.data()));
+		REQUIRE(skinnedVertices.size() == mesh.vertexBufferRaw.size());
+
+		for (size_t iVertex = 0; iVertex < vertices.size(); ++iVertex) {
+			SkinnedVertex v;
+			memcpy(&v, skinnedVertices.data() + iVertex * sizeof(SkinnedVertex), sizeof(SkinnedVertex));
+			CHECK(v.position == positions[iVertex]);
+			CHECK(v.normal == normals[iVertex]);
+			// Everything else is copied as it is.
+			CHECK(memcmp(v.bonesIds, vertices[iVertex].bonesIds, sizeof(v.bonesIds)) == 0);
+			CHECK(memcmp(v.bonesWeights, vertices[iVertex].bonesWeights, sizeof(v.bonesWeights)) == 0);
+		}
+	}
+
+	SUBCASE("Quantized mesh") {
+		ModelMesh quantizedMesh = mesh;
+		REQUIRE(MeshQuantizer::quantizeMesh(quantizedMesh, true));
+		CHECK(CpuSkinning::canSkinMesh(quantizedMesh));
+		CHECK(CpuSkinning::canSkinVertexBuffer(quantizedMesh) == false);
+
+		std::vector<vec3f> quantizedPositions(vertices.size());
+		std::vector<vec3f> quantizedNormals(vertices.size());
+		REQUIRE(CpuSkinning::skinMesh(quantizedPositions.data(), quantizedNormals.data(), quantizedMesh, bones.data()));
+
+		for (size_t iVertex = 0; iVertex < vertices.size(); ++iVertex) {
+			CHECK(isClose(quantizedPositions[iVertex], positions[iVertex], 1e-3f));
+			CHECK(isClose(quantizedNormals[iVertex], normals[iVertex], 1e-3f));
+		}
+	}
+}
+
+TEST_CASE("CpuSkinning Skinned vertex buffer transforms the tangent space") {
+	struct TangentSpaceVertex {
+		vec3f position;
+		vec3f normal;
+		vec3f tangent;
+		vec3f binormal;
+		int bonesIds[4];
+		float bonesWeights[4];
+	};
+
+	const int numBones = 6;
+	const std::vector<SkinnedVertex> skinnedVertices = makeSkinnedVertices(21, numBones);
+	const std::vector<mat4f> bones = makeBonesTransforms(numBones, false);
+
+	std::vector<TangentSpaceVertex> vertices(skinnedVertices.size());
+	for (size_t iVertex = 0; iVertex < vertices.size(); ++iVertex) {
+		const SkinnedVertex& src = skinnedVertices[iVertex];
+		TangentSpaceVertex& v = vertices[iVertex];
+		v.position = src.position;
+		v.normal = src.normal;
+		v.tangent = src.normal.cross(vec3f::getAxis(0)).normalized0();
+		v.binormal = src.normal.cross(v.tangent).normalized0();
+		memcpy(v.bonesIds, src.bonesIds, sizeof(v.bonesIds));
+		memcpy(v.bonesWeights, src.bonesWeights, sizeof(v.bonesWeights));
+	}
+
+	ModelMesh mesh = makeSkinnedMesh(skinnedVertices, numBones);
+	mesh.vertexDecl.clear();
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_position", UniformType::Float3, 0));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_normal", UniformType::Float3, 12));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_tangent", UniformType::Float3, 24));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_binormal", UniformType::Float3, 36));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_bonesIds", UniformType::Int4, 48));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_bonesWeights", UniformType::Float4, 64));
+	mesh.stride = sizeof(TangentSpaceVertex);
+	mesh.vbTangetOffsetBytes = 24;
+	mesh.vbBinormalOffsetBytes = 36;
+	mesh.vbBonesIdsBytesOffset = 48;
+	mesh.vbBonesWeightsByteOffset = 64;
+	mesh.vertexBufferRaw = std::vector<char>((const char*)vertices.data(), (const char*)(vertices.data() + vertices.size()));
+
+	std::vector<char> skinned;
+	REQUIRE(CpuSkinning::skinVertexBuffer(skinned, mesh, bones.data()));
+	REQUIRE(skinned.size() == mesh.vertexBufferRaw.size());
+
+	for (size_t iVertex = 0; iVertex < vertices.size(); ++iVertex) {
+		TangentSpaceVertex v;
+		memcpy(&v, skinned.data() + iVertex * sizeof(TangentSpaceVertex), sizeof(TangentSpaceVertex));
+
+		// The tangent and the binormal are transformed with the same matrix as the normal.
+		SkinnedVertex reference = skinnedVertices[iVertex];
+		vec3f expectedPosition, expectedNormal, expectedTangent, expectedBinormal;
+		skinVertexReference(expectedPosition, expectedNormal, reference, bones);
+		reference.normal = vertices[iVertex].tangent;
+		skinVertexReference(expectedPosition, expectedTangent, reference, bones);
+		reference.normal = vertices[iVertex].binormal;
+		skinVertexReference(expectedPosition, expectedBinormal, reference, bones);
+
+		CHECK(isClose(v.position, expectedPosition, 1e-4f));
+		CHECK(isClose(v.normal, expectedNormal, 1e-4f));
+		CHECK(isClose(v.tangent, expectedTangent, 1e-4f));
+		CHECK(isClose(v.binormal, expectedBinormal, 1e-4f));
+	}
+}
+
+TEST_CASE("CpuSkinning Dual quaternions") {
+	const int numBones = 8;
+	const std::vector<mat4f> bones = makeBonesTransforms(numBones, false);
+
+	std::vector<dualquatf> dualQuats(numBones);
+	CpuSkinning::convertToDualQuaternions(dualQuats.data(), bones.data(), numBones);
+
+	// Rigid transforms are represented exactly.
+	const vec3f p(0.3f, -1.2f, 2.f);
+	for (int iBone = 0; iBone < numBones; ++iBone) {
+		CHECK(isClose(dualQuats[iBone].getTranslation(), bones[iBone].data[3].xyz(), 1e-4f));
+		CHECK(isClose(dualQuats[iBone].transformPoint(p), mat_mul_pos(bones[iBone], p), 1e-4f));
+	}
+
+	// Vertices affected by a single bone are transformed like with matrices.
+	std::vector<SkinnedVertex> vertices = makeSkinnedVertices(40, numBones);
+	for (SkinnedVertex& v : vertices) {
+		v.bonesIds[1] = v.bonesIds[2] = v.bonesIds[3] = -1;
+		v.bonesWeights[0] = 1.f;
+		v.bonesWeights[1] = v.bonesWeights[2] = v.bonesWeights[3] = 0.f;
+	}
+	const ModelMesh mesh = makeSkinnedMesh(vertices, numBones);
+
+	std::vector<vec3f> positions(vertices.size());
+	std::vector<vec3f> normals(vertices.size());
+	REQUIRE(CpuSkinning::skinMeshDualQuaternions(positions.data(), normals.data(), mesh, dualQuats.data()));
+
+	for (size_t iVertex = 0; iVertex < vertices.size(); ++iVertex) {
+		vec3f expectedPosition, expectedNormal;
+		skinVertexReference(expectedPosition, expectedNormal, vertices[iVertex], bones);
+		CHECK(isClose(positions[iVertex], expectedPosition, 1e-4f));
+		CHECK(isClose(normals[iVertex], expectedNormal, 1e-4f));
+	}
+
+	// Blending two bones with opposite signs of the same rotation must not collapse the vertex.
+	SkinnedVertex v = vertices[0];
+	v.bonesIds[0] = 0;
+	v.bonesIds[1] = 1;
+	v.bonesWeights[0] = v.bonesWeights[1] = 0.5f;
+	const ModelMesh blendMesh = makeSkinnedMesh({v}, 2);
+	const dualquatf flippedBones[2] = {dualQuats[0], dualQuats[0] * -1.f};
+	vec3f blendedPosition;
+	REQUIRE(CpuSkinning::skinMeshDualQuaternions(&blendedPosition, nullptr, blendMesh, flippedBones));
+	CHECK(isClose(blendedPosition, mat_mul_pos(bones[0], v.position), 1e-4f));
+}
@@ -0,0 +1,112 @@
+#include "sge_core/AssetLibrary.h"
+#include "sge_core/model/EvaluatedModel.h"
+#include "sge_core/model/Model.h"
+#include "doctest/doctest.h"
+
+#include "AllocationCounter.h"
+#include "TestModels.h"
+
+#include <algorithm>
+
+using namespace sge;
+
+namespace {
+
+/// The recursive evaluation of the global transforms, used before the models had precomputed evaluation order.
+void evaluateGlobalTransformsRecursive(const Model& model,
+                                       const EvaluatedModel& evalModel,
+                                       const int iNode,
+                                       const mat4f& parentGlobalTransform,
+                                       std::vector<mat4f>& outGlobalTransforms) {
+	outGlobalTransforms[iNode] = parentGlobalTransform * evalModel.getEvalNode(iNode).evalLocalTransform;
+	for (const int childNode : model.nodeAt(iNode)->childNodes) {
+		evaluateGlobalTransformsRecursive(model, evalModel, childNode, outGlobalTransforms[iNode], outGlobalTransforms);
+	}
+}
+
+} // namespace
+
+TEST_CASE("EvaluatedModel Parent first order matches the recursive evaluation") {
+	Model model;
+	makeArmModel(model);
+	model.computeNodesOrder();
+
+	const std::vector<int>& order = model.getNodesParentFirstOrder();
+	REQUIRE(order.size() == size_t(model.numNodes()));
+	CHECK(order[0] == model.getRootNodeIndex());
+	CHECK(model.getNodeParentIndex(model.getRootNodeIndex()) == -1);
+	for (size_t iOrder = 1; iOrder < order.size(); ++iOrder) {
+		const int parent = model.getNodeParentIndex(order[iOrder]);
+		REQUIRE(parent >= 0);
+		const auto parentPos = std::find(order.begin(), order.end(), parent);
+		CHECK(parentPos < order.begin() + iOrder);
+	}
+
+	AssetLibrary assetLibrary(nullptr);
+	EvaluatedModel evalModel;
+	evalModel.initialize(&assetLibrary, &model);
+
+	for (const float time : {0.f, 0.25f, 0.6f, 1.f}) {
+		const EvalMomentSets moment(-1, 0, time, 1.f);
+		REQUIRE(evalModel.evaluateNodes(&moment, 1));
+
+		std::vector<mat4f> expectedGlobalTransforms(model.numNodes(), mat4f::getZero());
+		evaluateGlobalTransformsRecursive(model, evalModel, model.getRootNodeIndex(), mat4f::getIdentity(), expectedGlobalTransforms);
+
+		AABox3f expectedAABox;
+		for (int iNode = 0; iNode < model.numNodes(); ++iNode) {
+			const EvaluatedNode& evalNode = evalModel.getEvalNode(iNode);
+			CHECK(evalNode.evalGlobalTransform == expectedGlobalTransforms[iNode]);
+
+			AABox3f expectedNodeAABox;
+			for (const MeshAttachment& att : model.nodeAt(iNode)->meshAttachments) {
+				expectedNodeAABox.expand(model.meshAt(att.attachedMeshIndex)->aabox.getTransformed(expectedGlobalTransforms[iNode]));
+			}
+			CHECK(evalNode.aabbGlobalSpace.min == expectedNodeAABox.min);
+			CHECK(evalNode.aabbGlobalSpace.max == expectedNodeAABox.max);
+			expectedAABox.expand(expectedNodeAABox);
+		}
+		CHECK(evalModel.aabox.min == expectedAABox.min);
+		CHECK(evalModel.aabox.max == expectedAABox.max);
+
+		evalModel.computeSkinningPalette();
+		const ModelMesh& skinnedMesh = *model.meshAt(0);
+		const std::vector<mat4f>& palette = evalModel.getSkinningPalette();
+		REQUIRE(palette.size() == skinnedMesh.bones.size());
+		CHECK(evalModel.getMeshBonesOffsetInSkinningBonesTexture(0) == 0);
+		CHECK(evalModel.getMeshBonesOffsetInSkinningBonesTexture(1) == -1);
+		for (size_t iBone = 0; iBone < skinnedMesh.bones.size(); ++iBone) {
+			const ModelMeshBone& bone = skinnedMesh.bones[iBone];
+			CHECK(palette[iBone] == expectedGlobalTransforms[bone.nodeIdx] * bone.offsetMatrix);
+		}
+	}
+}
+
+TEST_CASE("EvaluatedModel Evaluating the nodes does not allocate after warm-up") {
+	Model model;
+	makeArmModel(model);
+	model.computeNodesOrder();
+
+	AssetLibrary assetLibrary(nullptr);
+	EvaluatedModel evalModel;
+	evalModel.initialize(&assetLibrary, &model);
+
+	// Warm-up, the first evaluation allocates the scratch buffers.
+	const EvalMomentSets moments[2] = {EvalMomentSets(-1, 0, 0.1f, 1.f), EvalMomentSets(-1, 0, 0.7f, 0.5f)};
+	evalModel.evaluateNodes(moments, 2);
+	evalModel.computeSkinningPalette();
+
+	g_numAllocations = 0;
+	g_countAllocations = true;
+	for (int iFrame = 0; iFrame < 100; ++iFrame) {
+		const EvalMomentSets frameMoments[2] = {EvalMomentSets(-1, 0, float(iFrame) / 100.f, 1.f),
+		                                        EvalMomentSets(-1, 0, 1.f - float(iFrame) / 100.f, 0.5f)};
+		evalModel.evaluateNodes(frameMoments, 2);
+		evalModel.computeSkinningPalette();
+		evalModel.evaluateNodes(nullptr, 0);
+		evalModel.computeSkinningPalette();
+	}
+	g_countAllocations = false;
+
+	CHECK(g_numAllocations == 0);
+}
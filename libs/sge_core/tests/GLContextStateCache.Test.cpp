@@ -0,0 +1,245 @@
+// The state cache exists only when the renderer is built with SGE_REND_API=OpenGL.
+#if defined(SGE_RENDERER_GL) && !defined(__EMSCRIPTEN__)
+
+#include "sge_renderer/gl/GLContextStateCache.h"
+#include "doctest/doctest.h"
+
+#include <map>
+
+using namespace sge;
+
+namespace {
+
+/// Records the calls made to the mocked OpenGL functions.
+struct MockGL {
+	int numUseProgramCalls = 0;
+	int numUniformCalls = 0;
+	int numBindBufferBaseCalls = 0;
+	int numGenVertexArraysCalls = 0;
+	int numBindVertexArrayCalls = 0;
+	int numDeleteVertexArraysCalls = 0;
+	int numVertexAttribPointerCalls = 0;
+
+	GLuint nextVertexArray = 1;
+	GLuint boundVertexArray = 0;
+	// The GL_ELEMENT_ARRAY_BUFFER binding of each vertex array.
+	std::map<GLuint, GLuint> elementArrayBuffers;
+	float lastUniformValue = 0.f;
+};
+
+MockGL g_mockGL;
+
+GLenum GLAPIENTRY mockGetError() {
+	return GL_NO_ERROR;
+}
+
+void GLAPIENTRY mockUseProgram(GLuint) {
+	g_mockGL.numUseProgramCalls++;
+}
+
+void GLAPIENTRY mockDeleteProgram(GLuint) {
+}
+
+void GLAPIENTRY mockUniform1i(GLint, GLint) {
+	g_mockGL.numUniformCalls++;
+}
+
+void GLAPIENTRY mockUniform4fv(GLint, GLsizei, const GLfloat* value) {
+	g_mockGL.numUniformCalls++;
+	g_mockGL.lastUniformValue = value[0];
+}
+
+void GLAPIENTRY mockBindBuffer(GLenum target, GLuint buffer) {
+	if (target == GL_ELEMENT_ARRAY_BUFFER) {
+		g_mockGL.elementArrayBuffers[g_mockGL.boundVertexArray] = buffer;
+	}
+}
+
+void GLAPIENTRY mockBindBufferBase(GLenum, GLuint, GLuint) {
+	g_mockGL.numBindBufferBaseCalls++;
+}
+
+void GLAPIENTRY mockDeleteBuffers(GLsizei, const GLuint*) {
+}
+
+void GLAPIENTRY mockGenVertexArrays(GLsizei n, GLuint* arrays) {
+	for (GLsizei t = 0; t < n; ++t) {
+		g_mockGL.numGenVertexArraysCalls++;
+		arrays[t] = g_mockGL.nextVertexArray++;
+	}
+}
+
+void GLAPIENTRY mockBindVertexArray(GLuint array) {
+	g_mockGL.numBindVertexArrayCalls++;
+	g_mockGL.boundVertexArray = array;
+}
+
+void GLAPIENTRY mockDeleteVertexArrays(GLsizei n, const GLuint* arrays) {
+	for (GLsizei t = 0; t < n; ++t) {
+		g_mockGL.numDeleteVertexArraysCalls++;
+		g_mockGL.elementArrayBuffers.erase(arrays[t]);
+	}
+}
+
+void GLAPIENTRY mockEnableVertexAttribArray(GLuint) {
+}
+
+void GLAPIENTRY mockDisableVertexAttribArray(GLuint) {
+}
+
+void GLAPIENTRY mockVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*) {
+	g_mockGL.numVertexAttribPointerCalls++;
+}
+
+void GLAPIENTRY mockVertexAttribIPointer(GLuint, GLint, GLenum, GLsizei, const void*) {
+	g_mockGL.numVertexAttribPointerCalls++;
+}
+
+/// Creates a state cache that calls the mocked functions. The functions used by the tests must be in the table.
+void initializeWithMockGL(GLContextStateCache& glcon, FrameStatistics& frameStatistics) {
+	g_mockGL = MockGL();
+
+	GLFunctionTable table;
+	table.GetError = mockGetError;
+	table.UseProgram = mockUseProgram;
+	table.DeleteProgram = mockDeleteProgram;
+	table.Uniform1i = mockUniform1i;
+	table.Uniform4fv = mockUniform4fv;
+	table.BindBuffer = mockBindBuffer;
+	table.BindBufferBase = mockBindBufferBase;
+	table.DeleteBuffers = mockDeleteBuffers;
+	table.GenVertexArrays = mockGenVertexArrays;
+	table.BindVertexArray = mockBindVertexArray;
+	table.DeleteVertexArrays = mockDeleteVertexArrays;
+	table.EnableVertexAttribArray = mockEnableVertexAttribArray;
+	table.DisableVertexAttribArray = mockDisableVertexAttribArray;
+	table.VertexAttribPointer = mockVertexAttribPointer;
+	table.VertexAttribIPointer = mockVertexAttribIPointer;
+
+	glcon.Initialize(table, &frameStatistics);
+}
+
+GLContextStateCache::VertexArrayKey makeVertexArrayKey(GLuint program, GLuint vertexBuffer, GLuint indexBuffer, GLuint baseVertex) {
+	GLContextStateCache::VertexArrayKey key;
+	key.program = program;
+	key.vertexDeclIndex = 1;
+	key.indexBuffer = indexBuffer;
+	key.baseVertex = baseVertex;
+	key.vertexBuffers[0] = vertexBuffer;
+	key.vertexBufferStrides[0] = 20;
+	return key;
+}
+
+} // namespace
+
+TEST_CASE("GLContextStateCache Skips the redundant program and uniform changes") {
+	GLContextStateCache glcon;
+	FrameStatistics stats;
+	initializeWithMockGL(glcon, stats);
+
+	const float red[4] = {1.f, 0.f, 0.f, 1.f};
+	const float green[4] = {0.f, 1.f, 0.f, 1.f};
+
+	glcon.UseProgram(1);
+	glcon.UseProgram(1);
+	CHECK(g_mockGL.numUseProgramCalls == 1);
+
+	glcon.SetUniform(0, UniformType::Float4, 1, red);
+	glcon.SetUniform(0, UniformType::Float4, 1, red);
+	CHECK(g_mockGL.numUniformCalls == 1);
+
+	glcon.SetUniform(0, UniformType::Float4, 1, green);
+	CHECK(g_mockGL.numUniformCalls == 2);
+	CHECK(g_mockGL.lastUniformValue == 0.f);
+
+	// The uniform values are a part of the program state, the other program doesn't have them.
+	glcon.UseProgram(2);
+	glcon.SetUniform(0, UniformType::Float4, 1, green);
+	CHECK(g_mockGL.numUniformCalls == 3);
+
+	// ... and the first program still has its value.
+	glcon.UseProgram(1);
+	glcon.SetUniform(0, UniformType::Float4, 1, green);
+	CHECK(g_mockGL.numUniformCalls == 3);
+
+	// A new program could get the id of a deleted one.
+	glcon.DeleteProgram(1);
+	glcon.UseProgram(1);
+	glcon.SetUniform(0, UniformType::Float4, 1, green);
+	CHECK(g_mockGL.numUniformCalls == 4);
+
+	// Uniforms without a location or with a huge one are always uploaded.
+	const int textureUnit = 3;
+	glcon.SetUniform(-1, UniformType::Int, 1, &textureUnit);
+	glcon.SetUniform(-1, UniformType::Int, 1, &textureUnit);
+	glcon.SetUniform(GLContextStateCache::kMaxCachedUniformLocation, UniformType::Int, 1, &textureUnit);
+	glcon.SetUniform(GLContextStateCache::kMaxCachedUniformLocation, UniformType::Int, 1, &textureUnit);
+	CHECK(g_mockGL.numUniformCalls == 8);
+
+	glcon.BindUniformBuffer(0, 5);
+	glcon.BindUniformBuffer(0, 5);
+	CHECK(g_mockGL.numBindBufferBaseCalls == 1);
+
+	CHECK(stats.numProgramChanges == 4);
+	CHECK(stats.numUniformChanges == 8);
+	CHECK(stats.numBufferChanges == 1);
+}
+
+TEST_CASE("GLContextStateCache Caches the vertex arrays") {
+	GLContextStateCache glcon;
+	FrameStatistics stats;
+	initializeWithMockGL(glcon, stats);
+
+	// The default vertex array is created and bound by Initialize.
+	const GLuint defaultVertexArray = g_mockGL.boundVertexArray;
+	CHECK(g_mockGL.numGenVertexArraysCalls == 1);
+
+	const GLContextStateCache::VertexArrayKey keyA = makeVertexArrayKey(1, 10, 11, 0);
+	const GLContextStateCache::VertexArrayKey keyB = makeVertexArrayKey(1, 10, 11, 64);
+
+	// The first draw with some state creates a vertex array and records the attributes in it.
+	REQUIRE(glcon.BindVertexArray(keyA));
+	glcon.SetVertexAttribSlotState(true, 0, 10, 3, GL_FLOAT, GL_FALSE, 20, 0);
+	const GLuint vertexArrayA = g_mockGL.boundVertexArray;
+	CHECK(vertexArrayA != defaultVertexArray);
+	CHECK(g_mockGL.elementArrayBuffers[vertexArrayA] == 11);
+	CHECK(g_mockGL.numVertexAttribPointerCalls == 1);
+
+	// The draws with the same state just bind it.
+	CHECK(glcon.BindVertexArray(keyA) == false);
+	CHECK(g_mockGL.numBindVertexArrayCalls == 2);
+
+	// A different base vertex changes the attribute offsets.
+	CHECK(glcon.BindVertexArray(keyB));
+	CHECK(glcon.BindVertexArray(keyA) == false);
+	CHECK(g_mockGL.boundVertexArray == vertexArrayA);
+	CHECK(g_mockGL.numGenVertexArraysCalls == 3);
+	CHECK(glcon.getNumCachedVertexArrays() == 2);
+	CHECK(stats.numBufferChanges == 3);
+
+	// Binding an index buffer outside of the draw calls must not modify the cached vertex arrays.
+	glcon.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 12);
+	CHECK(g_mockGL.boundVertexArray == defaultVertexArray);
+	CHECK(g_mockGL.elementArrayBuffers[defaultVertexArray] == 12);
+	CHECK(g_mockGL.elementArrayBuffers[vertexArrayA] == 11);
+
+	// Deleting a buffer deletes the vertex arrays that read from it.
+	GLuint buffer = 10;
+	glcon.DeleteBuffers(1, &buffer);
+	CHECK(glcon.getNumCachedVertexArrays() == 0);
+	CHECK(g_mockGL.numDeleteVertexArraysCalls == 2);
+
+	// Deleting a program deletes the vertex arrays that use it.
+	REQUIRE(glcon.BindVertexArray(makeVertexArrayKey(2, 20, 0, 0)));
+	glcon.DeleteProgram(2);
+	CHECK(glcon.getNumCachedVertexArrays() == 0);
+	CHECK(g_mockGL.boundVertexArray == defaultVertexArray);
+
+	// The cache doesn't grow without a bound.
+	for (int t = 0; t <= GLContextStateCache::kMaxCachedVertexArrays; ++t) {
+		glcon.BindVertexArray(makeVertexArrayKey(3, 30, 31, GLuint(t)));
+	}
+	CHECK(glcon.getNumCachedVertexArrays() == 1);
+}
+
+#endif
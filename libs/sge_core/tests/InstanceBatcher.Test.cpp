@@ -0,0 +1,154 @@
+#include "sge_core/InstanceBatcher.h"
+#include "sge_core/RenderQueue.h"
+#include "doctest/doctest.h"
+
+#include <vector>
+
+using namespace sge;
+
+namespace {
+
+/// Makes items that are already sorted, the payload indices are the same as the indices of the items.
+std::vector<RenderItem> makeSortedItems(const int numItems) {
+	std::vector<RenderItem> items(numItems);
+	for (int t = 0; t < numItems; ++t) {
+		items[t].sortKey = uint64(t);
+		items[t].payloadIndex = t;
+	}
+	return items;
+}
+
+/// Returns the number of items in each batch, negative for the batches that aren't instanced.
+std::vector<int> getBatchSizes(const InstanceBatcher& batcher) {
+	std::vector<int> sizes;
+	for (const InstanceBatch& batch : batcher.getBatches()) {
+		sizes.push_back(batch.isInstanced() ? batch.numItems : -batch.numItems);
+	}
+	return sizes;
+}
+
+} // namespace
+
+TEST_CASE("InstanceBatcher Groups the neighbouring items with the same id") {
+	const std::vector<RenderItem> items = makeSortedItems(10);
+	const std::vector<InstanceData> instanceData(items.size());
+
+	// Items with equal ids that aren't neighbours are not batched, -1 is never batched.
+	const int ids[] = {0, 0, 0, -1, -1, 4, 4, 7, 0, 0};
+
+	InstanceBatcher batcher;
+	batcher.build(items, ids, instanceData.data());
+
+	CHECK(getBatchSizes(batcher) == std::vector<int>{3, -1, -1, 2, -1, 2});
+	CHECK(batcher.getBatches()[0].firstItem == 0);
+	CHECK(batcher.getBatches()[0].firstInstanceRow == 0);
+	CHECK(batcher.getBatches()[3].firstItem == 5);
+	CHECK(batcher.getBatches()[3].firstInstanceRow == 3);
+	CHECK(batcher.getBatches()[4].firstItem == 7);
+	CHECK(batcher.getBatches()[5].firstItem == 8);
+	CHECK(batcher.getBatches()[5].firstInstanceRow == 5);
+	CHECK(batcher.getNumInstanceRows() == 7);
+
+	CHECK(batcher.getStats().numBatches == 6);
+	CHECK(batcher.getStats().numInstancedBatches == 3);
+	CHECK(batcher.getStats().numInstancedItems == 7);
+
+	// Building again starts from scratch.
+	batcher.build(std::vector<RenderItem>(), ids, instanceData.data());
+	CHECK(batcher.getBatches().empty());
+	CHECK(batcher.getNumInstanceRows() == 0);
+	CHECK(batcher.getStats().numBatches == 0);
+}
+
+TEST_CASE("InstanceBatcher Respects the limits") {
+	const std::vector<RenderItem> items = makeSortedItems(7);
+	const std::vector<InstanceData> instanceData(items.size());
+	const std::vector<int> ids(items.size(), 0);
+
+	InstanceBatcher batcher;
+
+	// The last batch gets only a single item, it is drawn without instancing.
+	batcher.setLimits(3, 100);
+	batcher.build(items, ids.data(), instanceData.data());
+	CHECK(getBatchSizes(batcher) == std::vector<int>{3, 3, -1});
+	CHECK(batcher.getNumInstanceRows() == 6);
+
+	// When there are no rows left the remaining items get drawn without instancing.
+	batcher.setLimits(3, 4);
+	batcher.build(items, ids.data(), instanceData.data());
+	CHECK(getBatchSizes(batcher) == std::vector<int>{3, -1, -1, -1, -1});
+	CHECK(batcher.getNumInstanceRows() == 3);
+
+	batcher.setLimits(3, 5);
+	batcher.build(items, ids.data(), instanceData.data());
+	CHECK(getBatchSizes(batcher) == std::vector<int>{3, 2, -1, -1});
+	CHECK(batcher.getNumInstanceRows() == 5);
+}
+
+TEST_CASE("InstanceBatcher Packs the instance data in the order of the items") {
+	// The payloads are in reverse order.
+	std::vector<RenderItem> items = makeSortedItems(4);
+	for (int t = 0; t < 4; ++t) {
+		items[t].payloadIndex = 3 - t;
+	}
+
+	std::vector<InstanceData> instanceData(4);
+	for (int t = 0; t < 4; ++t) {
+		instanceData[t].world = mat4f::getTranslation(float(t), 2.f * float(t), 3.f) * mat4f::getScaling(float(t + 1));
+		instanceData[t].tint = vec4f(float(t), 0.5f, 0.25f, 1.f);
+	}
+
+	// Payload 0 is alone.
+	const int ids[] = {-1, 5, 5, 5};
+
+	InstanceBatcher batcher;
+	batcher.build(items, ids, instanceData.data());
+	REQUIRE(getBatchSizes(batcher) == std::vector<int>{3, -1});
+
+	const std::vector<vec4f>& texels = batcher.getInstanceTexels();
+	REQUIRE(texels.size() == 3 * InstanceBatcher::kNumTexelsPerInstance);
+	for (int iRow = 0; iRow < 3; ++iRow) {
+		const InstanceData& expected = instanceData[items[iRow].payloadIndex];
+		const vec4f* const row = &texels[iRow * InstanceBatcher::kNumTexelsPerInstance];
+
+		// The columns of the matrix followed by the tint.
+		CHECK(row[0] == expected.world.data[0]);
+		CHECK(row[1] == expected.world.data[1]);
+		CHECK(row[2] == expected.world.data[2]);
+		CHECK(row[3] == expected.world.data[3]);
+		CHECK(row[4] == expected.tint);
+	}
+}
+
+TEST_CASE("InstanceBatcher Batches the items sorted by the render queue") {
+	// A forest of two kinds of trees added in random order, drawn after sorting with two instanced draw calls.
+	const RenderItemState treeA(1, 10, 100);
+	const RenderItemState treeB(1, 10, 200);
+	const RenderItemState rock(2, 20, 300);
+
+	const int numTrees = 5000;
+	RenderQueue queue;
+	std::vector<int> ids;
+	for (int t = 0; t < numTrees; ++t) {
+		const bool isTreeA = (t % 3) != 0;
+		queue.add(RenderSortKey::make(renderQueuePass_opaque, isTreeA ? treeA : treeB, float(t % 97), 100.f), t);
+		ids.push_back(isTreeA ? 0 : 1);
+	}
+
+	// A single rock and a transparent tree that can't be instanced.
+	queue.add(RenderSortKey::make(renderQueuePass_opaque, rock, 1.f, 100.f), numTrees);
+	ids.push_back(2);
+	queue.add(RenderSortKey::make(renderQueuePass_transparent, treeA, 1.f, 100.f), numTrees + 1);
+	ids.push_back(-1);
+
+	queue.sort();
+
+	const std::vector<InstanceData> instanceData(queue.size());
+	InstanceBatcher batcher;
+	batcher.setLimits(numTrees, numTrees);
+	batcher.build(queue.getItems(), ids.data(), instanceData.data());
+
+	CHECK(getBatchSizes(batcher) == std::vector<int>{3333, 1667, -1, -1});
+	CHECK(batcher.getStats().numBatches == 4);
+	CHECK(batcher.getStats().numInstancedItems == numTrees);
+}
@@ -0,0 +1,216 @@
+#include "sge_core/model/Model.h"
+#include "sge_utils/utils/timer.h"
+#include "doctest/doctest.h"
+
+#include <map>
+#include <random>
+
+using namespace sge;
+
+namespace {
+
+/// The key frames storage and sampling used before the SoA key frames, kept as a reference implementation.
+struct ReferenceKeyFrames {
+	std::map<float, vec3f> positionKeyFrames;
+	std::map<float, quatf> rotationKeyFrames;
+	std::map<float, vec3f> scalingKeyFrames;
+
+	template <typename T>
+	static void evaluateChannel(T& result, const std::map<float, T>& keyFrames, const float t) {
+		if (keyFrames.empty()) {
+			return;
+		}
+
+		const auto& keyItr = keyFrames.upper_bound(t);
+		if (keyItr == keyFrames.end()) {
+			result = keyFrames.rbegin()->second;
+		} else if (keyItr == keyFrames.begin()) {
+			result = keyItr->second;
+		} else {
+			const auto& prevKeyItr = std::prev(keyItr);
+			const float t0 = prevKeyItr->first;
+			const float t1 = keyItr->first;
+			const float dt = t1 - t0;
+
+			if (dt > 1e-6f) {
+				result = lerp(prevKeyItr->second, keyItr->second, (t - t0) / dt);
+			} else {
+				result = keyItr->second;
+			}
+		}
+	}
+
+	void evaluate(transf3d& result, const float t) const {
+		evaluateChannel(result.p, positionKeyFrames, t);
+		evaluateChannel(result.r, rotationKeyFrames, t);
+		evaluateChannel(result.s, scalingKeyFrames, t);
+	}
+};
+
+/// Generates random key frames in [0;duration] and stores them in both representations.
+void generateKeyFrames(std::mt19937& rng, const float duration, const int numKeys, KeyFrames& outKeyFrames, ReferenceKeyFrames& outRef) {
+	std::uniform_real_distribution<float> timeDist(0.f, duration);
+	std::uniform_real_distribution<float> valueDist(-1.f, 1.f);
+
+	for (int iKey = 0; iKey < numKeys; ++iKey) {
+		const float tp = timeDist(rng);
+		const vec3f p(valueDist(rng), valueDist(rng), valueDist(rng));
+		outKeyFrames.positionKeyFrames.setKey(tp, p);
+		outRef.positionKeyFrames[tp] = p;
+
+		const float tr = timeDist(rng);
+		const quatf r = quatf::getAxisAngle(vec3f(valueDist(rng), valueDist(rng), valueDist(rng)).normalized0(), valueDist(rng) * 3.f);
+		outKeyFrames.rotationKeyFrames.setKey(tr, r);
+		outRef.rotationKeyFrames[tr] = r;
+
+		const float ts = timeDist(rng);
+		const vec3f s(1.f + valueDist(rng) * 0.5f);
+		outKeyFrames.scalingKeyFrames.setKey(ts, s);
+		outRef.scalingKeyFrames[ts] = s;
+	}
+}
+
+bool transformsEqual(const transf3d& a, const transf3d& b) {
+	return a.p == b.p && a.s == b.s && a.r.x == b.r.x && a.r.y == b.r.y && a.r.z == b.r.z && a.r.w == b.r.w;
+}
+
+} // namespace
+
+TEST_CASE("KeyFrames Keys are kept sorted") {
+	KeyFrameChannel<vec3f> channel;
+	channel.setKey(1.f, vec3f(1.f));
+	channel.setKey(3.f, vec3f(3.f));
+	channel.setKey(2.f, vec3f(2.f));
+	channel.setKey(0.f, vec3f(0.f));
+	channel.setKey(2.f, vec3f(5.f)); // Replaces the existing key.
+
+	REQUIRE(channel.size() == 4);
+	CHECK(channel.times == std::vector<float>{0.f, 1.f, 2.f, 3.f});
+	CHECK(channel.values[2] == vec3f(5.f));
+
+	int cursor = 0;
+	CHECK(channel.sample(-1.f, cursor) == vec3f(0.f));
+	CHECK(channel.sample(0.5f, cursor) == vec3f(0.5f));
+	CHECK(channel.sample(10.f, cursor) == vec3f(3.f));
+	CHECK(channel.sample(1.f, cursor) == vec3f(1.f));
+}
+
+TEST_CASE("KeyFrames Cursor sampling matches the reference") {
+	std::mt19937 rng(42);
+	const float kDuration = 4.f;
+
+	for (int iTest = 0; iTest < 20; ++iTest) {
+		KeyFrames keyFrames;
+		ReferenceKeyFrames ref;
+		generateKeyFrames(rng, kDuration, 1 + iTest * 3, keyFrames, ref);
+
+		// Forward playback with a few loops, this is the path that uses the cursor the most.
+		KeyFramesCursor cursor;
+		for (float t = -0.5f; t < kDuration * 3.f; t += 1.f / 60.f) {
+			const float time = t > 0.f ? fmodf(t, kDuration + 0.5f) : t;
+
+			transf3d expected = transf3d::getIdentity();
+			ref.evaluate(expected, time);
+
+			transf3d actual = transf3d::getIdentity();
+			keyFrames.evaluate(actual, time, cursor);
+			CHECK(transformsEqual(expected, actual));
+
+			transf3d actualNoCursor = transf3d::getIdentity();
+			keyFrames.evaluate(actualNoCursor, time);
+			CHECK(transformsEqual(expected, actualNoCursor));
+		}
+
+		// Random seeks and backward playback.
+		std::uniform_real_distribution<float> timeDist(-1.f, kDuration + 1.f);
+		for (int iSeek = 0; iSeek < 200; ++iSeek) {
+			const float time = (iSeek % 2 == 0) ? timeDist(rng) : kDuration - float(iSeek) * 0.01f;
+
+			transf3d expected = transf3d::getIdentity();
+			ref.evaluate(expected, time);
+
+			transf3d actual = transf3d::getIdentity();
+			keyFrames.evaluate(actual, time, cursor);
+			CHECK(transformsEqual(expected, actual));
+		}
+	}
+}
+
+TEST_CASE("KeyFrames Animation nodes without key frames") {
+	ModelAnimation animation;
+	animation.getOrAddKeyFramesForNode(3).positionKeyFrames.setKey(0.f, vec3f(1.f, 2.f, 3.f));
+
+	transf3d transform = transf3d::getIdentity();
+	CHECK(animation.evaluateForNode(transform, 0, 0.f) == false);
+	CHECK(animation.evaluateForNode(transform, 10, 0.f) == false);
+	CHECK(transformsEqual(transform, transf3d::getIdentity()));
+
+	REQUIRE(animation.evaluateForNode(transform, 3, 0.f));
+	CHECK(transform.p == vec3f(1.f, 2.f, 3.f));
+}
+
+// Compares the evaluation of 1000 characters with 80 bones each, between the std::map based key frames and the SoA key frames.
+// Run with --no-skip to see the timings.
+TEST_CASE("KeyFrames Benchmark 1000 characters with 80 bones" * doctest::skip()) {
+	const int kNumCharacters = 1000;
+	const int kNumBones = 80;
+	const int kNumFrames = 30;
+	const float kDuration = 2.f;
+
+	std::mt19937 rng(7);
+	ModelAnimation animation;
+	std::vector<ReferenceKeyFrames> refAnimation(kNumBones);
+	for (int iBone = 0; iBone < kNumBones; ++iBone) {
+		generateKeyFrames(rng, kDuration, 60, animation.getOrAddKeyFramesForNode(iBone), refAnimation[iBone]);
+	}
+
+	std::map<int, ReferenceKeyFrames> refPerNodeKeyFrames;
+	for (int iBone = 0; iBone < kNumBones; ++iBone) {
+		refPerNodeKeyFrames[iBone] = refAnimation[iBone];
+	}
+
+	std::vector<float> characterTimeOffsets(kNumCharacters);
+	std::uniform_real_distribution<float> offsetDist(0.f, kDuration);
+	for (float& offset : characterTimeOffsets) {
+		offset = offsetDist(rng);
+	}
+
+	std::vector<transf3d> pose(kNumBones);
+	float checksumMap = 0.f;
+	float checksumSoA = 0.f;
+
+	Timer timer;
+	for (int iFrame = 0; iFrame < kNumFrames; ++iFrame) {
+		for (int iChar = 0; iChar < kNumCharacters; ++iChar) {
+			const float t = fmodf(characterTimeOffsets[iChar] + float(iFrame) / 60.f, kDuration);
+			for (int iBone = 0; iBone < kNumBones; ++iBone) {
+				auto itr = refPerNodeKeyFrames.find(iBone);
+				if (itr != refPerNodeKeyFrames.end()) {
+					itr->second.evaluate(pose[iBone], t);
+				}
+			}
+			checksumMap += pose[0].p.x;
+		}
+	}
+	timer.tick();
+	const float mapSeconds = timer.diff_seconds();
+
+	std::vector<KeyFramesCursor> cursors(kNumCharacters * kNumBones);
+	timer.reset();
+	for (int iFrame = 0; iFrame < kNumFrames; ++iFrame) {
+		for (int iChar = 0; iChar < kNumCharacters; ++iChar) {
+			const float t = fmodf(characterTimeOffsets[iChar] + float(iFrame) / 60.f, kDuration);
+			KeyFramesCursor* const charCursors = &cursors[iChar * kNumBones];
+			for (int iBone = 0; iBone < kNumBones; ++iBone) {
+				animation.evaluateForNode(pose[iBone], iBone, t, charCursors[iBone]);
+			}
+			checksumSoA += pose[0].p.x;
+		}
+	}
+	timer.tick();
+	const float soaSeconds = timer.diff_seconds();
+
+	CHECK(checksumMap == checksumSoA);
+	MESSAGE("std::map key frames: " << mapSeconds * 1000.f / kNumFrames << "ms per frame");
+	MESSAGE("SoA key frames with cursors: " << soaSeconds * 1000.f / kNumFrames << "ms per frame");
+}
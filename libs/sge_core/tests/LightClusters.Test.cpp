@@ -0,0 +1,249 @@
+#include "sge_core/LightClusters.h"
+#include "sge_core/shaders/modeldraw.h"
+#include "sge_utils/utils/ThreadPool.h"
+#include "sge_utils/utils/timer.h"
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "../core_shaders/ShadeCommon.h"
+
+using namespace sge;
+
+namespace {
+
+const float kNear = 0.1f;
+const float kFar = 200.f;
+
+mat4f makeView() {
+	return mat4f::getLookAtRH(vec3f(3.f, 5.f, 10.f), vec3f(0.f, 0.f, -40.f), vec3f(0.f, 1.f, 0.f));
+}
+
+mat4f makeProj() {
+	return mat4f::getPerspectiveFovRH(deg2rad(60.f), 16.f / 9.f, kNear, kFar, true);
+}
+
+/// Makes random point and spot lights in front of the camera (see @makeView), some of them with shadows.
+std::vector<ShadingLightData> makeLights(const int numLights, const unsigned seed) {
+	std::mt19937 rng(seed);
+	std::uniform_real_distribution<float> posXY(-60.f, 60.f);
+	std::uniform_real_distribution<float> posZ(-180.f, 20.f);
+	std::uniform_real_distribution<float> rangeDist(0.5f, 12.f);
+	std::uniform_real_distribution<float> dirDist(-1.f, 1.f);
+	std::uniform_real_distribution<float> angleDist(deg2rad(5.f), deg2rad(80.f));
+
+	std::vector<ShadingLightData> lights(numLights);
+	for (int iLight = 0; iLight < numLights; ++iLight) {
+		ShadingLightData& light = lights[iLight];
+		const bool isSpot = (iLight % 3) == 1;
+		const bool hasShadow = (iLight % 17) == 5;
+
+		light.lightPositionAndType = vec4f(posXY(rng), posXY(rng) * 0.25f, posZ(rng), isSpot ? 2.f : 0.f);
+		light.lightSpotDirAndCosAngle =
+		    vec4f(vec3f(dirDist(rng), dirDist(rng), dirDist(rng)).normalized0(), cosf(angleDist(rng)));
+		light.lightColorWFlags = vec4f(1.f, 1.f, 1.f, hasShadow ? float(kLightFlg_HasShadowMap) : 0.f);
+		light.lightXShadowRange = vec4f(rangeDist(rng), 0.f, 0.f, 0.f);
+	}
+
+	return lights;
+}
+
+/// Tests every clusterable light against every cluster.
+std::vector<std::vector<int>> computeReferenceClusters(const LightClusters& clusters, const mat4f& view, const std::vector<ShadingLightData>& lights) {
+	const LightClustersSettings& sets = clusters.getSettings();
+	std::vector<std::vector<int>> result(clusters.getNumClusters());
+
+	for (int iz = 0; iz < sets.numSlices; ++iz) {
+		for (int iy = 0; iy < sets.numTilesY; ++iy) {
+			for (int ix = 0; ix < sets.numTilesX; ++ix) {
+				const AABox3f box = clusters.computeClusterBoxVs(ix, iy, iz);
+				for (int iLight = 0; iLight < int(lights.size()); ++iLight) {
+					const ShadingLightData& light = lights[iLight];
+					if (LightClusters::isLightClusterable(light) == false) {
+						continue;
+					}
+
+					const vec3f posVs = view.transfPos(light.lightPositionAndType.xyz());
+					const vec3f dirVs = view.transfDir(light.lightSpotDirAndCosAngle.xyz()).normalized0();
+					if (LightClusters::doesLightAffectBox(posVs, light.lightXShadowRange.x, light.lightPositionAndType.w == 2.f, dirVs,
+					                                      light.lightSpotDirAndCosAngle.w, box)) {
+						result[clusters.getClusterIndex(ix, iy, iz)].push_back(iLight);
+					}
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+std::vector<int> getClusterLights(const LightClusters& clusters, const int iCluster) {
+	const LightClusterRange range = clusters.getClusterLights(iCluster);
+	const auto begin = clusters.getLightIndices().begin() + range.firstIndex;
+	return std::vector<int>(begin, begin + range.numLights);
+}
+
+/// Returns true if the light illuminates the point, matches the attenuation in FWDDefault_shading.shader.
+bool isPointLit(const ShadingLightData& light, const vec3f& pointWs) {
+	const vec3f toPoint = pointWs - light.lightPositionAndType.xyz();
+	const float range = light.lightXShadowRange.x;
+	if (toPoint.lengthSqr() >= range * range) {
+		return false;
+	}
+
+	if (light.lightPositionAndType.w == 2.f) {
+		return dot(toPoint.normalized0(), light.lightSpotDirAndCosAngle.xyz()) > light.lightSpotDirAndCosAngle.w;
+	}
+
+	return true;
+}
+
+} // namespace
+
+TEST_CASE("LightClusters Matches the brute force reference") {
+	const mat4f view = makeView();
+	const mat4f proj = makeProj();
+	const std::vector<ShadingLightData> lights = makeLights(300, 11);
+
+	LightClusters clusters;
+	clusters.build(view, proj, kNear, kFar, lights.data(), int(lights.size()), nullptr);
+	const std::vector<std::vector<int>> reference = computeReferenceClusters(clusters, view, lights);
+
+	int numMismatches = 0;
+	size_t numReferenceIndices = 0;
+	for (int iCluster = 0; iCluster < clusters.getNumClusters(); ++iCluster) {
+		numReferenceIndices += reference[iCluster].size();
+		if (getClusterLights(clusters, iCluster) != reference[iCluster]) {
+			numMismatches++;
+		}
+	}
+
+	CHECK(numMismatches == 0);
+	CHECK(clusters.getLightIndices().size() == numReferenceIndices);
+	CHECK(numReferenceIndices > 0);
+}
+
+TEST_CASE("LightClusters Is deterministic when binning in parallel") {
+	const std::vector<ShadingLightData> lights = makeLights(500, 3);
+
+	LightClustersSettings settings;
+	settings.numTilesX = 8;
+	settings.numTilesY = 5;
+	settings.numSlices = 16;
+
+	LightClusters serial;
+	serial.setSettings(settings);
+	serial.build(makeView(), makeProj(), kNear, kFar, lights.data(), int(lights.size()), nullptr);
+
+	ThreadPool threadPool(4);
+	LightClusters parallel;
+	parallel.setSettings(settings);
+
+	// Build more than once to check that the reused memory doesn't affect the result.
+	for (int iBuild = 0; iBuild < 2; ++iBuild) {
+		parallel.build(makeView(), makeProj(), kNear, kFar, lights.data(), int(lights.size()), &threadPool);
+
+		CHECK(parallel.getLightIndices() == serial.getLightIndices());
+		for (int iCluster = 0; iCluster < serial.getNumClusters(); ++iCluster) {
+			CHECK(parallel.getClusterLights(iCluster).firstIndex == serial.getClusterLights(iCluster).firstIndex);
+			CHECK(parallel.getClusterLights(iCluster).numLights == serial.getClusterLights(iCluster).numLights);
+		}
+	}
+}
+
+TEST_CASE("LightClusters The cluster of a lit point has the light") {
+	const mat4f view = makeView();
+	const mat4f proj = makeProj();
+	const std::vector<ShadingLightData> lights = makeLights(200, 5);
+
+	LightClusters clusters;
+	clusters.build(view, proj, kNear, kFar, lights.data(), int(lights.size()), nullptr);
+
+	// Random points around each light.
+	std::mt19937 rng(9);
+	std::uniform_real_distribution<float> offsetDist(-1.f, 1.f);
+	int numLitPoints = 0;
+	int numMissingLights = 0;
+	for (int iLight = 0; iLight < int(lights.size()); ++iLight) {
+		const ShadingLightData& light = lights[iLight];
+		for (int iPoint = 0; iPoint < 200; ++iPoint) {
+			const vec3f offset = vec3f(offsetDist(rng), offsetDist(rng), offsetDist(rng)) * light.lightXShadowRange.x;
+			const vec3f point = light.lightPositionAndType.xyz() + offset;
+			const int iCluster = clusters.findCluster(point);
+			if (iCluster < 0 || isPointLit(light, point) == false) {
+				continue;
+			}
+
+			numLitPoints++;
+			const std::vector<int> clusterLights = getClusterLights(clusters, iCluster);
+			const bool hasLight = std::find(clusterLights.begin(), clusterLights.end(), iLight) != clusterLights.end();
+			if (hasLight != LightClusters::isLightClusterable(light)) {
+				numMissingLights++;
+			}
+		}
+	}
+
+	CHECK(numLitPoints > 1000);
+	CHECK(numMissingLights == 0);
+}
+
+TEST_CASE("LightClusters Orthographic projection") {
+	const mat4f view = makeView();
+	const mat4f proj = mat4f::getOrthoRHCentered(80.f, 45.f, kNear, kFar, false);
+	const std::vector<ShadingLightData> lights = makeLights(100, 17);
+
+	LightClusters clusters;
+	clusters.build(view, proj, kNear, kFar, lights.data(), int(lights.size()), nullptr);
+	const std::vector<std::vector<int>> reference = computeReferenceClusters(clusters, view, lights);
+
+	int numMismatches = 0;
+	for (int iCluster = 0; iCluster < clusters.getNumClusters(); ++iCluster) {
+		if (getClusterLights(clusters, iCluster) != reference[iCluster]) {
+			numMismatches++;
+		}
+	}
+
+	CHECK(numMismatches == 0);
+}
+
+TEST_CASE("LightClusters Benchmark 1024 lights" * doctest::skip()) {
+	const mat4f view = makeView();
+	const mat4f proj = makeProj();
+	const std::vector<ShadingLightData> lights = makeLights(1024, 1);
+	const int kNumBuilds = 20;
+
+	LightClusters clusters;
+	Timer timer;
+
+	// The brute force reference, every light against every cluster.
+	clusters.build(view, proj, kNear, kFar, lights.data(), int(lights.size()), nullptr);
+	timer.tick();
+	const std::vector<std::vector<int>> reference = computeReferenceClusters(clusters, view, lights);
+	timer.tick();
+	const float bruteForceSeconds = timer.diff_seconds();
+
+	for (int t = 0; t < kNumBuilds; ++t) {
+		clusters.build(view, proj, kNear, kFar, lights.data(), int(lights.size()), nullptr);
+	}
+	timer.tick();
+	const float serialSeconds = timer.diff_seconds() / float(kNumBuilds);
+
+	ThreadPool threadPool(ThreadPool::getDefaultNumWorkers());
+	for (int t = 0; t < kNumBuilds; ++t) {
+		clusters.build(view, proj, kNear, kFar, lights.data(), int(lights.size()), &threadPool);
+	}
+	timer.tick();
+	const float parallelSeconds = timer.diff_seconds() / float(kNumBuilds);
+
+	size_t numReferenceIndices = 0;
+	for (const std::vector<int>& clusterLights : reference) {
+		numReferenceIndices += clusterLights.size();
+	}
+
+	CHECK(clusters.getLightIndices().size() == numReferenceIndices);
+	MESSAGE(lights.size() << " lights, " << clusters.getNumClusters() << " clusters, " << clusters.getLightIndices().size()
+	                      << " light indices. Brute force: " << bruteForceSeconds * 1000.f << "ms. Binned: " << serialSeconds * 1000.f
+	                      << "ms. Binned with " << threadPool.getNumWorkers() + 1 << " threads: " << parallelSeconds * 1000.f << "ms");
+}
@@ -0,0 +1,209 @@
+#include "sge_core/GeomGen.h"
+#include "sge_core/model/MeshOptimizer.h"
+#include "sge_core/model/Model.h"
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+using namespace sge;
+
+namespace {
+
+/// Returns the triangles with their indices rotated so the smallest is first (keeping the winding), sorted.
+std::vector<std::array<uint32, 3>> canonicalTriangles(const std::vector<uint32>& indices) {
+	std::vector<std::array<uint32, 3>> result;
+	for (size_t t = 0; t < indices.size(); t += 3) {
+		std::array<uint32, 3> tri = {indices[t], indices[t + 1], indices[t + 2]};
+		while (tri[0] > tri[1] || tri[0] > tri[2]) {
+			std::rotate(tri.begin(), tri.begin() + 1, tri.end());
+		}
+		result.push_back(tri);
+	}
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+void shuffleTriangles(std::vector<uint32>& indices) {
+	std::vector<std::array<uint32, 3>> triangles;
+	for (size_t t = 0; t < indices.size(); t += 3) {
+		triangles.push_back({indices[t], indices[t + 1], indices[t + 2]});
+	}
+
+	std::mt19937 rng(42);
+	std::shuffle(triangles.begin(), triangles.end(), rng);
+
+	indices.clear();
+	for (const auto& tri : triangles) {
+		indices.insert(indices.end(), tri.begin(), tri.end());
+	}
+}
+
+void checkVertexCacheOptimization(const std::vector<vec3f>& vertices, const std::vector<uint32>& indices, const float maxOptimizedAcmr) {
+	const MeshOptimizer::VertexCacheStatistics statsBefore =
+	    MeshOptimizer::analyzeVertexCache(indices.data(), indices.size(), vertices.size());
+
+	std::vector<uint32> optimized(indices.size());
+	MeshOptimizer::optimizeVertexCache(optimized.data(), indices.data(), indices.size(), vertices.size());
+
+	CHECK(canonicalTriangles(optimized) == canonicalTriangles(indices));
+
+	const MeshOptimizer::VertexCacheStatistics statsAfter =
+	    MeshOptimizer::analyzeVertexCache(optimized.data(), optimized.size(), vertices.size());
+
+	CHECK(statsAfter.numTriangles == statsBefore.numTriangles);
+	CHECK(statsAfter.numUniqueVertices == statsBefore.numUniqueVertices);
+	CHECK(statsAfter.acmr <= statsBefore.acmr);
+	CHECK(statsAfter.acmr < maxOptimizedAcmr);
+	CHECK(statsAfter.atvr >= 1.f);
+
+	// The overdraw optimization should keep the cache efficiency close to the input.
+	std::vector<uint32> overdrawOptimized(optimized.size());
+	const float threshold = 1.05f;
+	MeshOptimizer::optimizeOverdraw(overdrawOptimized.data(), optimized.data(), optimized.size(), (const char*)vertices.data(),
+	                                sizeof(vec3f), vertices.size(), threshold);
+
+	CHECK(canonicalTriangles(overdrawOptimized) == canonicalTriangles(indices));
+
+	const MeshOptimizer::VertexCacheStatistics statsOverdraw =
+	    MeshOptimizer::analyzeVertexCache(overdrawOptimized.data(), overdrawOptimized.size(), vertices.size());
+	CHECK(statsOverdraw.acmr <= statsAfter.acmr * threshold + 0.05f);
+}
+
+} // namespace
+
+TEST_CASE("MeshOptimizer Analyze vertex cache") {
+	// Two triangles sharing an edge, the 2nd triangle transforms only one new vertex.
+	const uint32 indices[] = {0, 1, 2, 2, 1, 3};
+	const MeshOptimizer::VertexCacheStatistics stats = MeshOptimizer::analyzeVertexCache(indices, SGE_ARRSZ(indices), 4);
+
+	CHECK(stats.numTriangles == 2);
+	CHECK(stats.numVerticesTransformed == 4);
+	CHECK(stats.numUniqueVertices == 4);
+	CHECK(stats.acmr == doctest::Approx(2.f));
+	CHECK(stats.atvr == doctest::Approx(1.f));
+
+	// With a cache of 3 vertices, the 1st vertex gets evicted.
+	const uint32 indicesEvict[] = {0, 1, 2, 3, 4, 5, 0, 1, 2};
+	const MeshOptimizer::VertexCacheStatistics statsEvict = MeshOptimizer::analyzeVertexCache(indicesEvict, SGE_ARRSZ(indicesEvict), 6, 3);
+	CHECK(statsEvict.numVerticesTransformed == 9);
+	CHECK(statsEvict.atvr == doctest::Approx(1.5f));
+}
+
+TEST_CASE("MeshOptimizer Vertex cache optimization on a grid") {
+	std::vector<vec3f> vertices;
+	std::vector<uint32> indices;
+	GeomGen::indexedGrid(vertices, indices, 64, 64);
+
+	checkVertexCacheOptimization(vertices, indices, 0.8f);
+
+	shuffleTriangles(indices);
+	checkVertexCacheOptimization(vertices, indices, 0.8f);
+}
+
+TEST_CASE("MeshOptimizer Vertex cache optimization on a sphere") {
+	std::vector<vec3f> vertices;
+	std::vector<uint32> indices;
+	GeomGen::indexedSphere(vertices, indices, 32, 64);
+
+	checkVertexCacheOptimization(vertices, indices, 0.8f);
+
+	shuffleTriangles(indices);
+	checkVertexCacheOptimization(vertices, indices, 0.8f);
+}
+
+TEST_CASE("MeshOptimizer Vertex fetch remap") {
+	// Vertex 1 is not used, the remaining ones should be sorted in the order of their 1st use.
+	const uint32 indices[] = {4, 2, 0, 0, 2, 3};
+	uint32 remap[5];
+	const size_t numUsedVertices = MeshOptimizer::optimizeVertexFetchRemap(remap, indices, SGE_ARRSZ(indices), SGE_ARRSZ(remap));
+
+	CHECK(numUsedVertices == 4);
+	CHECK(remap[4] == 0);
+	CHECK(remap[2] == 1);
+	CHECK(remap[0] == 2);
+	CHECK(remap[3] == 3);
+	CHECK(remap[1] == MeshOptimizer::kUnusedVertex);
+
+	uint32 remappedIndices[SGE_ARRSZ(indices)];
+	MeshOptimizer::remapIndexBuffer(remappedIndices, indices, SGE_ARRSZ(indices), remap);
+	const uint32 expectedIndices[] = {0, 1, 2, 2, 1, 3};
+	CHECK(std::equal(remappedIndices, remappedIndices + SGE_ARRSZ(indices), expectedIndices));
+
+	const float vertices[] = {0.f, 1.f, 2.f, 3.f, 4.f};
+	float remappedVertices[4];
+	MeshOptimizer::remapVertexBuffer(remappedVertices, vertices, SGE_ARRSZ(vertices), sizeof(float), remap);
+	const float expectedVertices[] = {4.f, 2.f, 0.f, 3.f};
+	CHECK(std::equal(remappedVertices, remappedVertices + 4, expectedVertices));
+}
+
+TEST_CASE("MeshOptimizer Optimize ModelMesh") {
+	std::vector<vec3f> positions;
+	std::vector<uint32> indices;
+	GeomGen::indexedSphere(positions, indices, 16, 32);
+	shuffleTriangles(indices);
+
+	// Use a vertex with a position and a per-vertex id, so we could validate that the vertices got moved correctly.
+	struct Vertex {
+		vec3f position;
+		int id;
+	};
+
+	std::vector<Vertex> vertices;
+	for (const vec3f& p : positions) {
+		vertices.push_back(Vertex{p, int(vertices.size())});
+	}
+
+	std::vector<uint16> indices16(indices.begin(), indices.end());
+
+	ModelMesh mesh;
+	mesh.primitiveTopology = PrimitiveTopology::TriangleList;
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_position", UniformType::Float3, 0));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_id", UniformType::Int, sizeof(vec3f)));
+	mesh.stride = sizeof(Vertex);
+	mesh.vbPositionOffsetBytes = 0;
+	mesh.numVertices = int(vertices.size());
+	mesh.numElements = int(indices16.size());
+	mesh.ibFmt = UniformType::Uint16;
+	mesh.vertexBufferRaw = std::vector<char>((const char*)vertices.data(), (const char*)(vertices.data() + vertices.size()));
+	mesh.indexBufferRaw = std::vector<char>((const char*)indices16.data(), (const char*)(indices16.data() + indices16.size()));
+
+	const float acmrBefore = MeshOptimizer::analyzeVertexCache(indices.data(), indices.size(), vertices.size()).acmr;
+
+	REQUIRE(MeshOptimizer::optimizeMesh(mesh));
+	REQUIRE(mesh.numVertices == int(vertices.size()));
+	REQUIRE(mesh.indexBufferRaw.size() == indices16.size() * sizeof(uint16));
+	REQUIRE(mesh.vertexBufferRaw.size() == vertices.size() * sizeof(Vertex));
+
+	// Map back the new indices to the original vertex ids and compare the triangles.
+	const Vertex* const newVertices = (const Vertex*)mesh.vertexBufferRaw.data();
+	const uint16* const newIndices = (const uint16*)mesh.indexBufferRaw.data();
+
+	std::vector<uint32> newIndices32;
+	std::vector<uint32> originalIndices;
+	for (int t = 0; t < mesh.numElements; ++t) {
+		REQUIRE(newIndices[t] < mesh.numVertices);
+		newIndices32.push_back(newIndices[t]);
+		originalIndices.push_back(uint32(newVertices[newIndices[t]].id));
+	}
+
+	CHECK(canonicalTriangles(originalIndices) == canonicalTriangles(indices));
+
+	const float acmrAfter = MeshOptimizer::analyzeVertexCache(newIndices32.data(), newIndices32.size(), mesh.numVertices).acmr;
+	CHECK(acmrAfter < acmrBefore);
+
+	// The vertices should be in the order of their first use.
+	uint32 nextExpectedVertex = 0;
+	for (const uint32 index : newIndices32) {
+		CHECK(index <= nextExpectedVertex);
+		if (index == nextExpectedVertex) {
+			nextExpectedVertex++;
+		}
+	}
+
+	// Non indexed meshes are not supported.
+	ModelMesh nonIndexed;
+	nonIndexed.primitiveTopology = PrimitiveTopology::TriangleList;
+	CHECK(MeshOptimizer::optimizeMesh(nonIndexed) == false);
+}
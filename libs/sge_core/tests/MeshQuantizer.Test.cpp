@@ -0,0 +1,223 @@
+#include "sge_core/GeomGen.h"
+#include "sge_core/model/MeshQuantizer.h"
+#include "sge_core/model/Model.h"
+#include "sge_core/model/ModelReader.h"
+#include "sge_core/model/ModelWriter.h"
+#include "sge_utils/utils/FileStream.h"
+#include "doctest/doctest.h"
+
+#include <cmath>
+#include <cstring>
+#include <random>
+
+using namespace sge;
+
+namespace {
+
+/// The angle in degrees between two unit vectors. acos isn't precise enough for small angles.
+float angleBetweenDeg(const vec3f& a, const vec3f& b) {
+	return atan2f(cross(a, b).length(), dot(a, b)) * (180.f / 3.14159265f);
+}
+
+vec3f decodeQuantizedDirection(const char* const data) {
+	sint16 q[2];
+	memcpy(q, data, sizeof(q));
+	return MeshQuantizer::octahedralDecode(vec2f(MeshQuantizer::dequantizeSnorm16(q[0]), MeshQuantizer::dequantizeSnorm16(q[1])));
+}
+
+struct TestVertex {
+	vec3f position;
+	vec3f normal;
+	vec2f uv;
+};
+
+/// A sphere with normals and uvs, the uvs are intentionally outside of [0;1] to test the uv range.
+std::vector<TestVertex> makeSphereVertices(std::vector<uint32>& outIndices) {
+	std::vector<vec3f> positions;
+	GeomGen::indexedSphere(positions, outIndices, 16, 32);
+
+	std::vector<TestVertex> vertices;
+	for (const vec3f& p : positions) {
+		TestVertex v;
+		v.position = p * 3.f + vec3f(10.f, -2.f, 5.f);
+		v.normal = p.normalized0();
+		v.uv = vec2f(p.x * 2.f + 1.f, p.y * -4.f);
+		vertices.push_back(v);
+	}
+
+	return vertices;
+}
+
+ModelMesh makeSphereMesh(const std::vector<TestVertex>& vertices, const std::vector<uint32>& indices) {
+	std::vector<uint16> indices16(indices.begin(), indices.end());
+
+	ModelMesh mesh;
+	mesh.name = "sphere";
+	mesh.primitiveTopology = PrimitiveTopology::TriangleList;
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_position", UniformType::Float3, 0));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_normal", UniformType::Float3, 12));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_uv", UniformType::Float2, 24));
+	mesh.stride = sizeof(TestVertex);
+	mesh.vbPositionOffsetBytes = 0;
+	mesh.vbNormalOffsetBytes = 12;
+	mesh.vbUVOffsetBytes = 24;
+	mesh.numVertices = int(vertices.size());
+	mesh.numElements = int(indices16.size());
+	mesh.ibFmt = UniformType::Uint16;
+	mesh.vertexBufferRaw = std::vector<char>((const char*)vertices.data(), (const char*)(vertices.data() + vertices.size()));
+	mesh.indexBufferRaw = std::vector<char>((const char*)indices16.data(), (const char*)(indices16.data() + indices16.size()));
+	for (const TestVertex& v : vertices) {
+		mesh.aabox.expand(v.position);
+	}
+
+	return mesh;
+}
+
+/// Decodes the quantized vertices of the mesh and checks them against the original ones.
+void checkQuantizedVertices(const ModelMesh& mesh, const std::vector<TestVertex>& vertices) {
+	const VertexDequantization& dq = mesh.dequantization;
+	const vec3f positionsExtent = mesh.aabox.size();
+	const vec2f uvExtent(2.f * 2.f, 4.f * 2.f);
+
+	for (size_t iVertex = 0; iVertex < vertices.size(); ++iVertex) {
+		const char* const vertex = mesh.vertexBufferRaw.data() + iVertex * mesh.stride;
+
+		vec3f position;
+		if (dq.hasQuantizedPositions) {
+			uint16 q[4];
+			memcpy(q, vertex + mesh.vbPositionOffsetBytes, sizeof(q));
+			for (int t = 0; t < 3; ++t) {
+				position[t] = MeshQuantizer::dequantizeUnorm16(q[t]) * dq.positionScale[t] + dq.positionOffset[t];
+				CHECK(fabsf(position[t] - vertices[iVertex].position[t]) <= positionsExtent[t] / 65535.f + 1e-5f);
+			}
+		} else {
+			memcpy(position.data, vertex + mesh.vbPositionOffsetBytes, sizeof(vec3f));
+			CHECK(position == vertices[iVertex].position);
+		}
+
+		const vec3f normal = decodeQuantizedDirection(vertex + mesh.vbNormalOffsetBytes);
+		CHECK(angleBetweenDeg(normal, vertices[iVertex].normal) < 0.02f);
+
+		uint16 uvq[2];
+		memcpy(uvq, vertex + mesh.vbUVOffsetBytes, sizeof(uvq));
+		for (int t = 0; t < 2; ++t) {
+			const float uv = MeshQuantizer::dequantizeUnorm16(uvq[t]) * dq.uvScale[t] + dq.uvOffset[t];
+			CHECK(fabsf(uv - vertices[iVertex].uv[t]) <= uvExtent[t] / 65535.f + 1e-5f);
+		}
+	}
+}
+
+} // namespace
+
+TEST_CASE("MeshQuantizer Octahedral encoding round-trip") {
+	std::vector<vec3f> directions = {
+	    vec3f(1.f, 0.f, 0.f), vec3f(-1.f, 0.f, 0.f), vec3f(0.f, 1.f, 0.f), vec3f(0.f, -1.f, 0.f),
+	    vec3f(0.f, 0.f, 1.f), vec3f(0.f, 0.f, -1.f), vec3f(1.f, 1.f, -1.f).normalized0(),
+	};
+
+	std::mt19937 rng(42);
+	std::uniform_real_distribution<float> dist(-1.f, 1.f);
+	while (directions.size() < 10000) {
+		const vec3f v(dist(rng), dist(rng), dist(rng));
+		if (v.lengthSqr() > 1e-4f) {
+			directions.push_back(v.normalized0());
+		}
+	}
+
+	float maxAngleDeg = 0.f;
+	for (const vec3f& n : directions) {
+		const vec2f e = MeshQuantizer::octahedralEncode(n);
+		CHECK(fabsf(e.x) <= 1.f);
+		CHECK(fabsf(e.y) <= 1.f);
+
+		// Without quantization the encoding is exact up to floating point errors.
+		CHECK(angleBetweenDeg(MeshQuantizer::octahedralDecode(e), n) < 0.01f);
+
+		const vec2f eq(MeshQuantizer::dequantizeSnorm16(MeshQuantizer::quantizeSnorm16(e.x)),
+		               MeshQuantizer::dequantizeSnorm16(MeshQuantizer::quantizeSnorm16(e.y)));
+		maxAngleDeg = std::max(maxAngleDeg, angleBetweenDeg(MeshQuantizer::octahedralDecode(eq), n));
+	}
+
+	CHECK(maxAngleDeg < 0.02f);
+}
+
+TEST_CASE("MeshQuantizer Normalized integers") {
+	CHECK(MeshQuantizer::quantizeSnorm16(-1.f) == -32767);
+	CHECK(MeshQuantizer::quantizeSnorm16(1.f) == 32767);
+	CHECK(MeshQuantizer::quantizeSnorm16(0.f) == 0);
+	CHECK(MeshQuantizer::quantizeSnorm16(5.f) == 32767);
+	CHECK(MeshQuantizer::dequantizeSnorm16(-32768) == -1.f);
+
+	CHECK(MeshQuantizer::quantizeUnorm16(0.f) == 0);
+	CHECK(MeshQuantizer::quantizeUnorm16(1.f) == 65535);
+	CHECK(MeshQuantizer::quantizeUnorm16(-1.f) == 0);
+	CHECK(MeshQuantizer::dequantizeUnorm16(65535) == 1.f);
+}
+
+TEST_CASE("MeshQuantizer Quantize a mesh") {
+	std::vector<uint32> indices;
+	const std::vector<TestVertex> vertices = makeSphereVertices(indices);
+
+	SUBCASE("Normals and uvs only") {
+		ModelMesh mesh = makeSphereMesh(vertices, indices);
+		REQUIRE(MeshQuantizer::quantizeMesh(mesh, false));
+
+		CHECK(mesh.stride == 12 + 4 + 4);
+		CHECK(mesh.vertexBufferRaw.size() == vertices.size() * mesh.stride);
+		CHECK(mesh.dequantization.hasOctahedralNormals);
+		CHECK(mesh.dequantization.hasQuantizedPositions == false);
+		CHECK(mesh.vertexDecl[0].format == UniformType::Float3);
+		CHECK(mesh.vertexDecl[1].format == UniformType::Short2_Snorm_IA);
+		CHECK(mesh.vertexDecl[2].format == UniformType::Ushort2_Unorm_IA);
+		checkQuantizedVertices(mesh, vertices);
+
+		// Already quantized meshes are left as they are.
+		CHECK(MeshQuantizer::quantizeMesh(mesh, false) == false);
+	}
+
+	SUBCASE("With positions") {
+		ModelMesh mesh = makeSphereMesh(vertices, indices);
+		REQUIRE(MeshQuantizer::quantizeMesh(mesh, true));
+
+		CHECK(mesh.stride == 8 + 4 + 4);
+		CHECK(mesh.dequantization.hasQuantizedPositions);
+		CHECK(mesh.vertexDecl[0].format == UniformType::Ushort4_Unorm_IA);
+		checkQuantizedVertices(mesh, vertices);
+	}
+}
+
+TEST_CASE("MeshQuantizer Quantized meshes are written in the model file") {
+	std::vector<uint32> indices;
+	const std::vector<TestVertex> vertices = makeSphereVertices(indices);
+
+	Model model;
+	const int rootNode = model.makeNewNode();
+	model.setRootNodeIndex(rootNode);
+	model.nodeAt(rootNode)->name = "root";
+
+	const int iMesh = model.makeNewMesh();
+	*model.meshAt(iMesh) = makeSphereMesh(vertices, indices);
+	model.nodeAt(rootNode)->meshAttachments.push_back(MeshAttachment(iMesh, -1));
+
+	WriteByteStream wbs;
+	ModelWriter writer;
+	writer.optimizeMeshes = false;
+	writer.numLodsToGenerate = 0;
+	writer.quantizeVertices = true;
+	writer.quantizePositions = true;
+	REQUIRE(writer.write(model, &wbs));
+
+	Model loaded;
+	ReadByteStream rbs(wbs.serializedData);
+	REQUIRE(ModelReader().loadModel(ModelLoadSettings(), &rbs, loaded));
+	REQUIRE(loaded.numMeshes() == 1);
+
+	const ModelMesh& loadedMesh = *loaded.meshAt(0);
+	CHECK(loadedMesh.stride == 16);
+	CHECK(loadedMesh.vertexDecl[0].format == UniformType::Ushort4_Unorm_IA);
+	CHECK(loadedMesh.vertexDecl[1].format == UniformType::Short2_Snorm_IA);
+	CHECK(loadedMesh.vertexDecl[2].format == UniformType::Ushort2_Unorm_IA);
+	CHECK(loadedMesh.dequantization.hasQuantizedPositions);
+	CHECK(loadedMesh.dequantization.hasOctahedralNormals);
+	checkQuantizedVertices(loadedMesh, vertices);
+}
@@ -0,0 +1,314 @@
+#include "sge_core/GeomGen.h"
+#include "sge_core/model/MeshSimplifier.h"
+#include "sge_core/model/Model.h"
+#include "sge_core/model/ModelReader.h"
+#include "sge_core/model/ModelWriter.h"
+#include "sge_utils/utils/FileStream.h"
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <array>
+#include <set>
+
+using namespace sge;
+
+namespace {
+
+/// Returns the distance between the point @p and the triangle @a, @b, @c.
+/// See Christer Ericson - "Real-Time Collision Detection", 5.1.5.
+float distancePointTriangle(const vec3f& p, const vec3f& a, const vec3f& b, const vec3f& c) {
+	const vec3f ab = b - a;
+	const vec3f ac = c - a;
+	const vec3f ap = p - a;
+	const float d1 = dot(ab, ap);
+	const float d2 = dot(ac, ap);
+	if (d1 <= 0.f && d2 <= 0.f) {
+		return (p - a).length();
+	}
+
+	const vec3f bp = p - b;
+	const float d3 = dot(ab, bp);
+	const float d4 = dot(ac, bp);
+	if (d3 >= 0.f && d4 <= d3) {
+		return (p - b).length();
+	}
+
+	const float vc = d1 * d4 - d3 * d2;
+	if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f) {
+		return (p - (a + ab * (d1 / (d1 - d3)))).length();
+	}
+
+	const vec3f cp = p - c;
+	const float d5 = dot(ab, cp);
+	const float d6 = dot(ac, cp);
+	if (d6 >= 0.f && d5 <= d6) {
+		return (p - c).length();
+	}
+
+	const float vb = d5 * d2 - d1 * d6;
+	if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f) {
+		return (p - (a + ac * (d2 / (d2 - d6)))).length();
+	}
+
+	const float va = d3 * d6 - d5 * d4;
+	if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f) {
+		return (p - (b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))))).length();
+	}
+
+	const float denom = 1.f / (va + vb + vc);
+	return (p - (a + ab * (vb * denom) + ac * (vc * denom))).length();
+}
+
+/// Returns the maximum distance from the vertices of the original mesh to the simplified surface.
+float measureMaxDistance(const std::vector<vec3f>& vertices, const std::vector<uint32>& simplifiedIndices) {
+	float maxDistance = 0.f;
+	for (const vec3f& p : vertices) {
+		float minDistance = FLT_MAX;
+		for (size_t t = 0; t < simplifiedIndices.size(); t += 3) {
+			const float d = distancePointTriangle(p, vertices[simplifiedIndices[t]], vertices[simplifiedIndices[t + 1]],
+			                                      vertices[simplifiedIndices[t + 2]]);
+			minDistance = std::min(minDistance, d);
+		}
+		maxDistance = std::max(maxDistance, minDistance);
+	}
+	return maxDistance;
+}
+
+std::vector<uint32> simplify(const std::vector<vec3f>& vertices,
+                             const std::vector<uint32>& indices,
+                             const size_t targetNumIndices,
+                             const float maxError,
+                             float* outError) {
+	std::vector<uint32> result(indices.size());
+	const size_t numIndices = MeshSimplifier::simplify(result.data(), indices.data(), indices.size(), (const char*)vertices.data(),
+	                                                   sizeof(vec3f), vertices.size(), targetNumIndices, maxError, outError);
+	result.resize(numIndices);
+	return result;
+}
+
+ModelMesh makeSphereMesh() {
+	std::vector<vec3f> vertices;
+	std::vector<uint32> indices;
+	GeomGen::indexedSphere(vertices, indices, 32, 64);
+
+	std::vector<uint16> indices16(indices.begin(), indices.end());
+
+	ModelMesh mesh;
+	mesh.name = "sphere";
+	mesh.primitiveTopology = PrimitiveTopology::TriangleList;
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_position", UniformType::Float3, 0));
+	mesh.stride = sizeof(vec3f);
+	mesh.vbPositionOffsetBytes = 0;
+	mesh.numVertices = int(vertices.size());
+	mesh.numElements = int(indices16.size());
+	mesh.ibFmt = UniformType::Uint16;
+	mesh.vertexBufferRaw = std::vector<char>((const char*)vertices.data(), (const char*)(vertices.data() + vertices.size()));
+	mesh.indexBufferRaw = std::vector<char>((const char*)indices16.data(), (const char*)(indices16.data() + indices16.size()));
+	for (const vec3f& p : vertices) {
+		mesh.aabox.expand(p);
+	}
+
+	return mesh;
+}
+
+/// Returns the triangles of the LOD as triplets of positions, so they could be compared after the vertices get reordered.
+std::multiset<std::array<float, 9>> lodTrianglePositions(const ModelMesh& mesh, const ModelMeshLod& lod) {
+	const vec3f* const vertices = (const vec3f*)mesh.vertexBufferRaw.data();
+	const uint16* const indices = (const uint16*)lod.indexBufferRaw.data();
+
+	std::multiset<std::array<float, 9>> result;
+	for (int t = 0; t < lod.numElements; t += 3) {
+		// Rotate the triangle so the smallest index is first, keeping the winding.
+		std::array<vec3f, 3> tri = {vertices[indices[t]], vertices[indices[t + 1]], vertices[indices[t + 2]]};
+		const auto less = [](const vec3f& a, const vec3f& b) { return std::lexicographical_compare(a.data, a.data + 3, b.data, b.data + 3); };
+		while (less(tri[1], tri[0]) || less(tri[2], tri[0])) {
+			std::rotate(tri.begin(), tri.begin() + 1, tri.end());
+		}
+
+		std::array<float, 9> key;
+		for (int iCorner = 0; iCorner < 3; ++iCorner) {
+			std::copy(tri[iCorner].data, tri[iCorner].data + 3, key.begin() + iCorner * 3);
+		}
+		result.insert(key);
+	}
+	return result;
+}
+
+} // namespace
+
+TEST_CASE("MeshSimplifier Triangle count targets on a sphere") {
+	std::vector<vec3f> vertices;
+	std::vector<uint32> indices;
+	GeomGen::indexedSphere(vertices, indices, 32, 64);
+
+	const float maxError = 0.05f;
+	for (const float ratio : {0.5f, 0.25f, 0.1f}) {
+		CAPTURE(ratio);
+		const size_t targetNumIndices = size_t(float(indices.size() / 3) * ratio) * 3;
+
+		float error = -1.f;
+		const std::vector<uint32> simplified = simplify(vertices, indices, targetNumIndices, maxError, &error);
+
+		// Every collapse on a closed mesh removes 2 triangles, so the target should be reached almost exactly.
+		CHECK(simplified.size() <= targetNumIndices);
+		CHECK(simplified.size() >= targetNumIndices - 6);
+		CHECK(error >= 0.f);
+		CHECK(error <= maxError);
+
+		for (const uint32 index : simplified) {
+			REQUIRE(index < vertices.size());
+		}
+
+		// The simplified surface should stay close to the original one. The error is an average distance to the
+		// original planes, so the actual deviation might be a bit bigger.
+		CHECK(measureMaxDistance(vertices, simplified) <= 3.f * maxError);
+	}
+}
+
+TEST_CASE("MeshSimplifier Error bound stops the simplification") {
+	std::vector<vec3f> vertices;
+	std::vector<uint32> indices;
+	GeomGen::indexedSphere(vertices, indices, 32, 64);
+
+	// Reaching 1% of the triangles of a sphere is not possible without a big error.
+	const float maxError = 0.01f;
+	const size_t targetNumIndices = size_t(float(indices.size() / 3) * 0.01f) * 3;
+
+	float error = -1.f;
+	const std::vector<uint32> simplified = simplify(vertices, indices, targetNumIndices, maxError, &error);
+
+	CHECK(simplified.size() > targetNumIndices);
+	CHECK(simplified.size() < indices.size());
+	CHECK(error <= maxError);
+	CHECK(measureMaxDistance(vertices, simplified) <= 3.f * maxError);
+
+	// With no error allowed a curved surface cannot be simplified.
+	const std::vector<uint32> unchanged = simplify(vertices, indices, targetNumIndices, 0.f, &error);
+	CHECK(unchanged.size() == indices.size());
+	CHECK(error == 0.f);
+}
+
+TEST_CASE("MeshSimplifier Borders are kept on a grid") {
+	std::vector<vec3f> vertices;
+	std::vector<uint32> indices;
+	GeomGen::indexedGrid(vertices, indices, 16, 16);
+
+	// The grid is flat so only the border vertices are needed to represent it without any error.
+	float error = -1.f;
+	const std::vector<uint32> simplified = simplify(vertices, indices, 0, 0.f, &error);
+
+	CHECK(simplified.size() < indices.size() / 4);
+	CHECK(error == 0.f);
+
+	AABox3f box;
+	for (const vec3f& p : vertices) {
+		box.expand(p);
+	}
+
+	const std::set<uint32> usedVertices(simplified.begin(), simplified.end());
+	for (uint32 iVertex = 0; iVertex < vertices.size(); ++iVertex) {
+		const vec3f& p = vertices[iVertex];
+		const bool isOnBorder = p.x == box.min.x || p.x == box.max.x || p.z == box.min.z || p.z == box.max.z;
+		if (isOnBorder) {
+			CHECK(usedVertices.count(iVertex) == 1);
+		}
+	}
+
+	// The area of the grid must be the same.
+	float areaOriginal = 0.f;
+	float areaSimplified = 0.f;
+	for (size_t t = 0; t < indices.size(); t += 3) {
+		areaOriginal += cross(vertices[indices[t + 1]] - vertices[indices[t]], vertices[indices[t + 2]] - vertices[indices[t]]).length();
+	}
+	for (size_t t = 0; t < simplified.size(); t += 3) {
+		areaSimplified +=
+		    cross(vertices[simplified[t + 1]] - vertices[simplified[t]], vertices[simplified[t + 2]] - vertices[simplified[t]]).length();
+	}
+	CHECK(areaSimplified == doctest::Approx(areaOriginal).epsilon(0.001f));
+}
+
+TEST_CASE("MeshSimplifier Generate LODs of a ModelMesh") {
+	ModelMesh mesh = makeSphereMesh();
+	const float maxRelativeError = 0.05f;
+
+	const int numLods = MeshSimplifier::generateLods(mesh, 3, 0.5f, maxRelativeError);
+	REQUIRE(numLods == 3);
+	REQUIRE(mesh.lods.size() == 3);
+
+	int prevNumElements = mesh.numElements;
+	for (const ModelMeshLod& lod : mesh.lods) {
+		CHECK(lod.numElements <= prevNumElements / 2 + 3);
+		CHECK(lod.numElements % 3 == 0);
+		CHECK(lod.error <= maxRelativeError * mesh.aabox.diagonal().length());
+		REQUIRE(lod.indexBufferRaw.size() == size_t(lod.numElements) * sizeof(uint16));
+
+		const uint16* const indices = (const uint16*)lod.indexBufferRaw.data();
+		for (int t = 0; t < lod.numElements; ++t) {
+			REQUIRE(indices[t] < mesh.numVertices);
+		}
+
+		prevNumElements = lod.numElements;
+	}
+
+	// Small meshes cannot be simplified without a big error.
+	ModelMesh tetrahedron;
+	tetrahedron.primitiveTopology = PrimitiveTopology::TriangleList;
+	const vec3f tetrahedronVertices[] = {vec3f(0.f, 0.f, 0.f), vec3f(1.f, 0.f, 0.f), vec3f(0.f, 1.f, 0.f), vec3f(0.f, 0.f, 1.f)};
+	const uint16 tetrahedronIndices[] = {0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3};
+	tetrahedron.stride = sizeof(vec3f);
+	tetrahedron.vbPositionOffsetBytes = 0;
+	tetrahedron.numVertices = 4;
+	tetrahedron.numElements = 12;
+	tetrahedron.ibFmt = UniformType::Uint16;
+	tetrahedron.vertexBufferRaw = std::vector<char>((const char*)tetrahedronVertices, (const char*)(tetrahedronVertices + 4));
+	tetrahedron.indexBufferRaw = std::vector<char>((const char*)tetrahedronIndices, (const char*)(tetrahedronIndices + 12));
+	tetrahedron.aabox = AABox3f(vec3f(0.f), vec3f(1.f));
+	CHECK(MeshSimplifier::generateLods(tetrahedron, 3) == 0);
+	CHECK(tetrahedron.lods.empty());
+}
+
+TEST_CASE("MeshSimplifier LODs are written in the model file") {
+	Model model;
+	const int rootNode = model.makeNewNode();
+	model.setRootNodeIndex(rootNode);
+	model.nodeAt(rootNode)->name = "root";
+
+	const int iMesh = model.makeNewMesh();
+	*model.meshAt(iMesh) = makeSphereMesh();
+	model.nodeAt(rootNode)->meshAttachments.push_back(MeshAttachment(iMesh, -1));
+
+	// The writer generates the LODs for meshes without any.
+	{
+		WriteByteStream wbs;
+		ModelWriter writer;
+		writer.optimizeMeshes = false;
+		REQUIRE(writer.write(model, &wbs));
+
+		Model loaded;
+		ReadByteStream rbs(wbs.serializedData);
+		REQUIRE(ModelReader().loadModel(ModelLoadSettings(), &rbs, loaded));
+		CHECK(loaded.meshAt(0)->lods.size() == size_t(writer.numLodsToGenerate));
+	}
+
+	// Existing LODs are kept and reordered along with the vertices of the optimized mesh.
+	REQUIRE(MeshSimplifier::generateLods(*model.meshAt(iMesh), 2) == 2);
+	{
+		WriteByteStream wbs;
+		ModelWriter writer;
+		writer.optimizeMeshes = true;
+		REQUIRE(writer.write(model, &wbs));
+
+		Model loaded;
+		ReadByteStream rbs(wbs.serializedData);
+		REQUIRE(ModelReader().loadModel(ModelLoadSettings(), &rbs, loaded));
+
+		const ModelMesh& original = *model.meshAt(iMesh);
+		const ModelMesh& optimized = *loaded.meshAt(0);
+		REQUIRE(optimized.lods.size() == 2);
+		for (size_t iLod = 0; iLod < original.lods.size(); ++iLod) {
+			CHECK(optimized.lods[iLod].numElements == original.lods[iLod].numElements);
+			CHECK(optimized.lods[iLod].error == original.lods[iLod].error);
+			CHECK(lodTrianglePositions(optimized, optimized.lods[iLod]) == lodTrianglePositions(original, original.lods[iLod]));
+		}
+	}
+}
@@ -0,0 +1,336 @@
+#include "sge_core/model/Model.h"
+#include "sge_core/model/ModelReader.h"
+#include "sge_core/model/ModelWriter.h"
+#include "sge_utils/utils/FileStream.h"
+#include "doctest/doctest.h"
+
+#include <filesystem>
+#include <string>
+
+using namespace sge;
+
+namespace {
+
+bool transformsEqual(const transf3d& a, const transf3d& b) {
+	return a.p == b.p && a.s == b.s && memcmp(a.r.data, b.r.data, sizeof(a.r.data)) == 0;
+}
+
+template <typename T>
+bool keyFramesEqual(const KeyFrameChannel<T>& a, const KeyFrameChannel<T>& b) {
+	if (a.size() != b.size() || a.times != b.times) {
+		return false;
+	}
+
+	return a.values.empty() || memcmp(a.values.data(), b.values.data(), a.values.size() * sizeof(T)) == 0;
+}
+
+void checkModelsEqual(const Model& a, const Model& b) {
+	REQUIRE(a.getRootNodeIndex() == b.getRootNodeIndex());
+
+	REQUIRE(a.numNodes() == b.numNodes());
+	for (int iNode = 0; iNode < a.numNodes(); ++iNode) {
+		const ModelNode* nodeA = a.nodeAt(iNode);
+		const ModelNode* nodeB = b.nodeAt(iNode);
+
+		CHECK(nodeA->name == nodeB->name);
+		CHECK(transformsEqual(nodeA->staticLocalTransform, nodeB->staticLocalTransform));
+		CHECK(nodeA->limbLength == nodeB->limbLength);
+		CHECK(nodeA->childNodes == nodeB->childNodes);
+
+		REQUIRE(nodeA->meshAttachments.size() == nodeB->meshAttachments.size());
+		for (size_t t = 0; t < nodeA->meshAttachments.size(); ++t) {
+			CHECK(nodeA->meshAttachments[t].attachedMeshIndex == nodeB->meshAttachments[t].attachedMeshIndex);
+			CHECK(nodeA->meshAttachments[t].attachedMaterialIndex == nodeB->meshAttachments[t].attachedMaterialIndex);
+		}
+	}
+
+	REQUIRE(a.numMaterials() == b.numMaterials());
+	for (int iMtl = 0; iMtl < a.numMaterials(); ++iMtl) {
+		const ModelMaterial* mtlA = a.materialAt(iMtl);
+		const ModelMaterial* mtlB = b.materialAt(iMtl);
+
+		CHECK(mtlA->name == mtlB->name);
+		CHECK(mtlA->diffuseColor == mtlB->diffuseColor);
+		CHECK(mtlA->emissionColor == mtlB->emissionColor);
+		CHECK(mtlA->metallic == mtlB->metallic);
+		CHECK(mtlA->roughness == mtlB->roughness);
+		CHECK(mtlA->diffuseTextureName == mtlB->diffuseTextureName);
+		CHECK(mtlA->emissionTextureName == mtlB->emissionTextureName);
+		CHECK(mtlA->normalTextureName == mtlB->normalTextureName);
+		CHECK(mtlA->metallicTextureName == mtlB->metallicTextureName);
+		CHECK(mtlA->roughnessTextureName == mtlB->roughnessTextureName);
+	}
+
+	REQUIRE(a.numMeshes() == b.numMeshes());
+	for (int iMesh = 0; iMesh < a.numMeshes(); ++iMesh) {
+		const ModelMesh* meshA = a.meshAt(iMesh);
+		const ModelMesh* meshB = b.meshAt(iMesh);
+
+		CHECK(meshA->name == meshB->name);
+		CHECK(meshA->primitiveTopology == meshB->primitiveTopology);
+		CHECK(meshA->vbByteOffset == meshB->vbByteOffset);
+		CHECK(meshA->ibByteOffset == meshB->ibByteOffset);
+		CHECK(meshA->ibFmt == meshB->ibFmt);
+		CHECK(meshA->numElements == meshB->numElements);
+		CHECK(meshA->numVertices == meshB->numVertices);
+		CHECK(meshA->stride == meshB->stride);
+		CHECK(meshA->vbPositionOffsetBytes == meshB->vbPositionOffsetBytes);
+		CHECK(meshA->vbNormalOffsetBytes == meshB->vbNormalOffsetBytes);
+		CHECK(meshA->vbUVOffsetBytes == meshB->vbUVOffsetBytes);
+		CHECK(meshA->aabox.min == meshB->aabox.min);
+		CHECK(meshA->aabox.max == meshB->aabox.max);
+
+		REQUIRE(meshA->vertexDecl.size() == meshB->vertexDecl.size());
+		for (size_t t = 0; t < meshA->vertexDecl.size(); ++t) {
+			CHECK(meshA->vertexDecl[t].semantic == meshB->vertexDecl[t].semantic);
+			CHECK(meshA->vertexDecl[t].byteOffset == meshB->vertexDecl[t].byteOffset);
+			CHECK(meshA->vertexDecl[t].format == meshB->vertexDecl[t].format);
+		}
+
+		REQUIRE(meshA->vertexBufferRaw.size() == meshB->vertexBufferRaw.size());
+		CHECK(memcmp(meshA->vertexBufferRaw.data(), meshB->vertexBufferRaw.data(), meshA->vertexBufferRaw.size()) == 0);
+		REQUIRE(meshA->indexBufferRaw.size() == meshB->indexBufferRaw.size());
+		CHECK(memcmp(meshA->indexBufferRaw.data(), meshB->indexBufferRaw.data(), meshA->indexBufferRaw.size()) == 0);
+
+		REQUIRE(meshA->lods.size() == meshB->lods.size());
+		for (size_t t = 0; t < meshA->lods.size(); ++t) {
+			CHECK(meshA->lods[t].numElements == meshB->lods[t].numElements);
+			CHECK(meshA->lods[t].error == meshB->lods[t].error);
+			REQUIRE(meshA->lods[t].indexBufferRaw.size() == meshB->lods[t].indexBufferRaw.size());
+			CHECK(memcmp(meshA->lods[t].indexBufferRaw.data(), meshB->lods[t].indexBufferRaw.data(), meshA->lods[t].indexBufferRaw.size()) ==
+			      0);
+		}
+
+		REQUIRE(meshA->bones.size() == meshB->bones.size());
+		for (size_t t = 0; t < meshA->bones.size(); ++t) {
+			CHECK(meshA->bones[t].nodeIdx == meshB->bones[t].nodeIdx);
+			CHECK(memcmp(&meshA->bones[t].offsetMatrix, &meshB->bones[t].offsetMatrix, sizeof(mat4f)) == 0);
+		}
+	}
+
+	REQUIRE(a.numAnimations() == b.numAnimations());
+	for (int iAnim = 0; iAnim < a.numAnimations(); ++iAnim) {
+		const ModelAnimation* animA = a.animationAt(iAnim);
+		const ModelAnimation* animB = b.animationAt(iAnim);
+
+		CHECK(animA->animationName == animB->animationName);
+		CHECK(animA->durationSec == animB->durationSec);
+		const int numAnimatedNodes = int(std::max(animA->perNodeKeyFrames.size(), animB->perNodeKeyFrames.size()));
+		for (int iNode = 0; iNode < numAnimatedNodes; ++iNode) {
+			const KeyFrames* const keyFramesA = animA->getKeyFramesForNode(iNode);
+			const KeyFrames* const keyFramesB = animB->getKeyFramesForNode(iNode);
+			REQUIRE((keyFramesA == nullptr) == (keyFramesB == nullptr));
+			if (keyFramesA != nullptr) {
+				CHECK(keyFramesEqual(keyFramesA->positionKeyFrames, keyFramesB->positionKeyFrames));
+				CHECK(keyFramesEqual(keyFramesA->rotationKeyFrames, keyFramesB->rotationKeyFrames));
+				CHECK(keyFramesEqual(keyFramesA->scalingKeyFrames, keyFramesB->scalingKeyFrames));
+			}
+		}
+	}
+
+	REQUIRE(a.m_convexHulls.size() == b.m_convexHulls.size());
+	for (size_t t = 0; t < a.m_convexHulls.size(); ++t) {
+		CHECK(a.m_convexHulls[t].vertices == b.m_convexHulls[t].vertices);
+		CHECK(a.m_convexHulls[t].indices == b.m_convexHulls[t].indices);
+	}
+
+	REQUIRE(a.m_concaveHulls.size() == b.m_concaveHulls.size());
+	for (size_t t = 0; t < a.m_concaveHulls.size(); ++t) {
+		CHECK(a.m_concaveHulls[t].vertices == b.m_concaveHulls[t].vertices);
+		CHECK(a.m_concaveHulls[t].indices == b.m_concaveHulls[t].indices);
+	}
+
+	REQUIRE(a.m_collisionBoxes.size() == b.m_collisionBoxes.size());
+	for (size_t t = 0; t < a.m_collisionBoxes.size(); ++t) {
+		CHECK(a.m_collisionBoxes[t].name == b.m_collisionBoxes[t].name);
+		CHECK(transformsEqual(a.m_collisionBoxes[t].transform, b.m_collisionBoxes[t].transform));
+		CHECK(a.m_collisionBoxes[t].halfDiagonal == b.m_collisionBoxes[t].halfDiagonal);
+	}
+
+	REQUIRE(a.m_collisionCapsules.size() == b.m_collisionCapsules.size());
+	for (size_t t = 0; t < a.m_collisionCapsules.size(); ++t) {
+		CHECK(a.m_collisionCapsules[t].name == b.m_collisionCapsules[t].name);
+		CHECK(transformsEqual(a.m_collisionCapsules[t].transform, b.m_collisionCapsules[t].transform));
+		CHECK(a.m_collisionCapsules[t].halfHeight == b.m_collisionCapsules[t].halfHeight);
+		CHECK(a.m_collisionCapsules[t].radius == b.m_collisionCapsules[t].radius);
+	}
+
+	REQUIRE(a.m_collisionCylinders.size() == b.m_collisionCylinders.size());
+	for (size_t t = 0; t < a.m_collisionCylinders.size(); ++t) {
+		CHECK(a.m_collisionCylinders[t].name == b.m_collisionCylinders[t].name);
+		CHECK(transformsEqual(a.m_collisionCylinders[t].transform, b.m_collisionCylinders[t].transform));
+		CHECK(a.m_collisionCylinders[t].halfDiagonal == b.m_collisionCylinders[t].halfDiagonal);
+	}
+
+	REQUIRE(a.m_collisionSpheres.size() == b.m_collisionSpheres.size());
+	for (size_t t = 0; t < a.m_collisionSpheres.size(); ++t) {
+		CHECK(a.m_collisionSpheres[t].name == b.m_collisionSpheres[t].name);
+		CHECK(transformsEqual(a.m_collisionSpheres[t].transform, b.m_collisionSpheres[t].transform));
+		CHECK(a.m_collisionSpheres[t].radius == b.m_collisionSpheres[t].radius);
+	}
+}
+
+} // namespace
+
+TEST_CASE("ModelFileV2 Round-trip the Demo models") {
+	int numTestedModels = 0;
+
+	for (const auto& entry : std::filesystem::directory_iterator(SGE_TESTS_DEMO_ASSETS_DIR "/models")) {
+		if (entry.path().extension() != ".mdl") {
+			continue;
+		}
+
+		const std::string path = entry.path().string();
+		CAPTURE(path);
+
+		// Load the version 1 file, some of the models are in an even older format, skip them.
+		Model modelV1;
+		{
+			FileReadStream frs(path.c_str());
+			REQUIRE(frs.isOpened());
+			if (ModelReader().loadModel(ModelLoadSettings(), &frs, modelV1) == false) {
+				continue;
+			}
+		}
+
+		// Write it as a version 2 file. Do not optimize, quantize the meshes, generate LODs or compress the animations so we could compare them.
+		WriteByteStream wbs;
+		ModelWriter writer;
+		writer.optimizeMeshes = false;
+		writer.numLodsToGenerate = 0;
+		writer.quantizeVertices = false;
+		writer.compressAnimations = false;
+		REQUIRE(writer.write(modelV1, &wbs));
+		REQUIRE(ModelReader::isModelFileV2(wbs.serializedData.data(), wbs.serializedData.size()));
+
+		// Load it back as a stream, this copies the whole file in memory.
+		{
+			Model modelV2;
+			ReadByteStream rbs(wbs.serializedData);
+			REQUIRE(ModelReader().loadModel(ModelLoadSettings(), &rbs, modelV2));
+			checkModelsEqual(modelV1, modelV2);
+		}
+
+		// Load it from a file, this should memory map it.
+		{
+			const std::string tempPath = (std::filesystem::temp_directory_path() / entry.path().filename()).string() + ".v2";
+			{
+				FileWriteStream fws;
+				REQUIRE(fws.open(tempPath.c_str()));
+				fws.write(wbs.serializedData.data(), wbs.serializedData.size());
+			}
+
+			Model modelV2;
+			REQUIRE(ModelReader().loadModel(ModelLoadSettings(), tempPath.c_str(), modelV2));
+			std::filesystem::remove(tempPath);
+
+			for (int iMesh = 0; iMesh < modelV2.numMeshes(); ++iMesh) {
+				CHECK(modelV2.meshAt(iMesh)->vertexBufferRaw.isView());
+			}
+
+			// The mapping must be kept alive by the model, even when the file is deleted.
+			checkModelsEqual(modelV1, modelV2);
+		}
+
+		numTestedModels++;
+	}
+
+	CHECK(numTestedModels > 0);
+}
+
+TEST_CASE("ModelFileV2 Chunks are aligned") {
+	Model model;
+	const int rootNode = model.makeNewNode();
+	model.setRootNodeIndex(rootNode);
+	model.nodeAt(rootNode)->name = "root";
+
+	const int iMesh = model.makeNewMesh();
+	ModelMesh& mesh = *model.meshAt(iMesh);
+	mesh.name = "odd";
+	mesh.primitiveTopology = PrimitiveTopology::TriangleList;
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_position", UniformType::Float3, 0));
+	mesh.numVertices = 3;
+	mesh.numElements = 3;
+	mesh.stride = sizeof(vec3f);
+	mesh.vbPositionOffsetBytes = 0;
+	mesh.vertexBufferRaw = std::vector<char>(sizeof(vec3f) * 3, 1);
+	mesh.indexBufferRaw = std::vector<char>{0, 0, 1, 0, 2, 0}; // 6 bytes, breaks the alignment of the following chunk.
+	mesh.ibFmt = UniformType::Uint16;
+	model.nodeAt(rootNode)->meshAttachments.push_back(MeshAttachment(iMesh, -1));
+
+	WriteByteStream wbs;
+	REQUIRE(ModelWriter().write(model, &wbs));
+
+	ModelFileV2::FileHeader header;
+	REQUIRE(wbs.serializedData.size() >= sizeof(header));
+	memcpy(&header, wbs.serializedData.data(), sizeof(header));
+	CHECK(header.version == ModelFileV2::kVersion);
+
+	const ModelFileV2::ChunkDesc* chunks = (const ModelFileV2::ChunkDesc*)(wbs.serializedData.data() + header.chunkTableByteOffset);
+	for (uint32 t = 0; t < header.numChunks; ++t) {
+		CHECK(chunks[t].byteOffset % ModelFileV2::kChunkAlignment == 0);
+		CHECK(chunks[t].byteOffset + chunks[t].sizeBytes <= wbs.serializedData.size());
+	}
+
+	Model loaded;
+	ReadByteStream rbs(wbs.serializedData);
+	REQUIRE(ModelReader().loadModel(ModelLoadSettings(), &rbs, loaded));
+	checkModelsEqual(model, loaded);
+
+	// Truncated files must fail to load.
+	ReadByteStream rbsTruncated(wbs.serializedData.data(), wbs.serializedData.size() - 1);
+	CHECK(ModelReader().loadModel(ModelLoadSettings(), &rbsTruncated, loaded) == false);
+}
+
+TEST_CASE("ModelFileV2 Empty model") {
+	const Model model;
+
+	WriteByteStream wbs;
+	REQUIRE(ModelWriter().write(model, &wbs));
+
+	ModelFileV2::FileHeader header;
+	REQUIRE(wbs.serializedData.size() >= sizeof(header));
+	memcpy(&header, wbs.serializedData.data(), sizeof(header));
+	CHECK(header.numChunks == 0);
+	CHECK(wbs.serializedData.size() % ModelFileV2::kChunkAlignment == 0);
+
+	Model loaded;
+	ReadByteStream rbs(wbs.serializedData);
+	REQUIRE(ModelReader().loadModel(ModelLoadSettings(), &rbs, loaded));
+	checkModelsEqual(model, loaded);
+}
+
+TEST_CASE("ModelFileV2 Animation tracks of missing nodes fail to load") {
+	Model model;
+	const int rootNode = model.makeNewNode();
+	model.setRootNodeIndex(rootNode);
+	model.nodeAt(rootNode)->name = "root";
+
+	ModelAnimation& anim = *model.animationAt(model.makeNewAnim());
+	anim.animationName = "move";
+	anim.durationSec = 1.f;
+	anim.getOrAddKeyFramesForNode(rootNode).positionKeyFrames.setKey(0.f, vec3f(1.f));
+
+	WriteByteStream wbs;
+	REQUIRE(ModelWriter().write(model, &wbs));
+
+	ModelFileV2::FileHeader header;
+	memcpy(&header, wbs.serializedData.data(), sizeof(header));
+	const ModelFileV2::ChunkDesc* chunks = (const ModelFileV2::ChunkDesc*)(wbs.serializedData.data() + header.chunkTableByteOffset);
+	ModelFileV2::AnimationTrack* track = nullptr;
+	for (uint32 t = 0; t < header.numChunks; ++t) {
+		if (chunks[t].type == ModelFileV2::chunkType_animationTracks) {
+			REQUIRE(chunks[t].sizeBytes == sizeof(ModelFileV2::AnimationTrack));
+			track = (ModelFileV2::AnimationTrack*)(wbs.serializedData.data() + chunks[t].byteOffset);
+		}
+	}
+	REQUIRE(track != nullptr);
+	REQUIRE(track->nodeIndex == rootNode);
+
+	Model loaded;
+	for (const sint32 invalidNodeIndex : {-1, 1, 1000}) {
+		track->nodeIndex = invalidNodeIndex;
+		ReadByteStream rbs(wbs.serializedData);
+		CHECK(ModelReader().loadModel(ModelLoadSettings(), &rbs, loaded) == false);
+	}
+}
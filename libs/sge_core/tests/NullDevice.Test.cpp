@@ -0,0 +1,302 @@
+// The null device exists only when the renderer is built with SGE_REND_API=Null.
+#ifdef SGE_RENDERER_NULL
+
+#include "sge_renderer/null/GraphicsInterface_null.h"
+#include "doctest/doctest.h"
+
+#include <memory>
+
+using namespace sge;
+
+namespace {
+
+const char* const kTestVertexShader = R"(
+#version 150
+#define OpenGL
+#line 1 "test.shader"
+in vec3 a_position;
+in vec2 a_uv;
+out vec2 v_uv;
+
+uniform mat4 projViewWorld; // A comment with uniform float notAUniform;
+uniform vec4 colors[3];
+
+/* uniform float alsoNotAUniform; */
+layout (std140) uniform ParamsCb {
+	vec3 tint;
+	float alpha;
+	mat4 bones[2];
+};
+
+struct Light {
+	vec3 position;
+};
+
+vec4 transform(in vec3 p) {
+	uniform float notAUniformEither;
+	return projViewWorld * vec4(p, 1.0);
+}
+
+void main() {
+	v_uv = a_uv;
+	gl_Position = transform(a_position);
+}
+)";
+
+const char* const kTestPixelShader = R"(
+#version 150
+in vec2 v_uv;
+out vec4 outColor;
+
+uniform mat4 projViewWorld;
+uniform sampler2D texDiffuse;
+uniform samplerCube texEnv;
+
+void main() {
+	outColor = texture(texDiffuse, v_uv);
+}
+)";
+
+/// Creates a null device with a shading program and a triangle, ready to be drawn.
+struct NullDeviceFixture {
+	NullDeviceFixture() {
+		MainFrameTargetDesc mainFrameTargetDesc = {};
+		mainFrameTargetDesc.width = 64;
+		mainFrameTargetDesc.height = 64;
+		mainFrameTargetDesc.numBuffers = 2;
+		device.reset(static_cast<SGEDeviceNull*>(SGEDevice::create(mainFrameTargetDesc)));
+
+		program = device->requestResource<ShadingProgram>();
+		programCreated = program->createFromNativeCode(kTestVertexShader, kTestPixelShader).succeeded;
+
+		const float vertices[] = {0.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f};
+		vertexBuffer = device->requestResource<Buffer>();
+		vertexBuffer->create(BufferDesc::GetDefaultVertexBuffer(sizeof(vertices)), vertices);
+
+		cbuffer = device->requestResource<Buffer>();
+		cbuffer->create(BufferDesc::GetDefaultConstantBuffer(160, ResourceUsage::Dynamic), nullptr);
+
+		const VertexDecl vertexDecl[] = {
+		    VertexDecl(0, "a_position", UniformType::Float3, 0),
+		    VertexDecl(0, "a_uv", UniformType::Float2, 12),
+		};
+
+		stateGroup.setProgram(program);
+		stateGroup.setVB(0, vertexBuffer, 0, sizeof(float) * 5);
+		stateGroup.setVBDeclIndex(device->getVertexDeclIndex(vertexDecl, SGE_ARRSZ(vertexDecl)));
+		stateGroup.setPrimitiveTopology(PrimitiveTopology::TriangleList);
+	}
+
+	~NullDeviceFixture() {
+		program.Release();
+		vertexBuffer.Release();
+		cbuffer.Release();
+	}
+
+	/// Draws the triangle with the specified uniforms.
+	void draw(BoundUniform* const uniforms, const int numUniforms, FrameTarget* frameTarget = nullptr) {
+		DrawCall dc;
+		dc.setStateGroup(&stateGroup);
+		dc.setUniforms(uniforms, numUniforms);
+		dc.draw(3, 0);
+		device->getContext()->executeDrawCall(dc, frameTarget ? frameTarget : device->getWindowFrameTarget());
+	}
+
+	std::unique_ptr<SGEDeviceNull> device;
+	GpuHandle<ShadingProgram> program;
+	GpuHandle<Buffer> vertexBuffer;
+	GpuHandle<Buffer> cbuffer;
+	StateGroup stateGroup;
+	bool programCreated = false;
+};
+
+} // namespace
+
+TEST_CASE("SGEDeviceNull Reflects the GLSL declarations") {
+	NullDeviceFixture fixture;
+	REQUIRE(fixture.programCreated);
+
+	const ShadingProgramRefl& refl = fixture.program->getReflection();
+
+	REQUIRE(refl.inputVertices.size() == 2);
+	CHECK(refl.inputVertices[0].name == "a_position");
+	CHECK(refl.inputVertices[0].type == UniformType::Float3);
+	CHECK(refl.inputVertices[1].name == "a_uv");
+	CHECK(refl.inputVertices[1].type == UniformType::Float2);
+
+	// Uniforms declared in both shaders are the same uniform, the ones in comments and functions aren't uniforms.
+	CHECK(refl.numericUnforms.m_uniforms.size() == 2);
+	const BindLocation projViewWorld = refl.findUniform("projViewWorld", ShaderType::PixelShader);
+	CHECK(projViewWorld.uniformType == UniformType::Float4x4);
+	CHECK(projViewWorld.glArraySize == 1);
+
+	const BindLocation colors = refl.findUniform("colors", ShaderType::VertexShader);
+	CHECK(colors.uniformType == UniformType::Float4);
+	CHECK(colors.glArraySize == 3);
+	CHECK(refl.findUniform("notAUniform", ShaderType::VertexShader).isNull());
+	CHECK(refl.findUniform("alsoNotAUniform", ShaderType::VertexShader).isNull());
+	CHECK(refl.findUniform("notAUniformEither", ShaderType::VertexShader).isNull());
+
+	// Textures get their own texture units.
+	const BindLocation texDiffuse = refl.findUniform("texDiffuse", ShaderType::PixelShader);
+	const BindLocation texEnv = refl.findUniform("texEnv", ShaderType::PixelShader);
+	CHECK(texDiffuse.uniformType == UniformType::Texture2D);
+	CHECK(texEnv.uniformType == UniformType::TextureCube);
+	CHECK(texDiffuse.glTextureUnit != texEnv.glTextureUnit);
+
+	// The uniform block uses the std140 layout.
+	REQUIRE(refl.cbuffers.m_uniforms.size() == 1);
+	const CBufferRefl& paramsCb = refl.cbuffers.m_uniforms[0].second;
+	CHECK(paramsCb.name == "ParamsCb");
+	REQUIRE(paramsCb.variables.size() == 3);
+	CHECK(paramsCb.variables[0].offset == 0);
+	CHECK(paramsCb.variables[1].offset == 12);
+	CHECK(paramsCb.variables[2].offset == 16);
+	CHECK(paramsCb.variables[2].arraySize == 2);
+	CHECK(paramsCb.sizeBytes == 144);
+}
+
+TEST_CASE("SGEDeviceNull Counts the draw calls and the state changes") {
+	NullDeviceFixture fixture;
+	REQUIRE(fixture.programCreated);
+
+	const ShadingProgramRefl& refl = fixture.program->getReflection();
+	mat4f projViewWorld = mat4f::getScaling(1.f);
+
+	BoundUniform uniforms[] = {
+	    BoundUniform(refl.findUniform("projViewWorld", ShaderType::VertexShader), (void*)&projViewWorld),
+	    BoundUniform(refl.findUniform("ParamsCb", ShaderType::VertexShader), fixture.cbuffer.GetPtr()),
+	};
+
+	fixture.draw(uniforms, SGE_ARRSZ(uniforms));
+	fixture.draw(uniforms, SGE_ARRSZ(uniforms));
+	projViewWorld = mat4f::getScaling(2.f);
+	fixture.draw(uniforms, SGE_ARRSZ(uniforms));
+
+	const FrameStatistics& stats = fixture.device->getFrameStatistics();
+	CHECK(fixture.device->getNumValidationErrors() == 0);
+	CHECK(stats.numDrawCalls == 3);
+	CHECK(stats.numPrimitiveDrawn == 9);
+	CHECK(stats.numProgramChanges == 1);
+	// The vertex buffer and the uniform block are bound once.
+	CHECK(stats.numBufferChanges == 2);
+	// The matrix is set by the first draw and changed by the third one.
+	CHECK(stats.numUniformChanges == 2);
+
+	fixture.device->present();
+	CHECK(fixture.device->getFrameStatistics().numDrawCalls == 0);
+}
+
+TEST_CASE("SGEDeviceNull Validates the draw calls") {
+	NullDeviceFixture fixture;
+	REQUIRE(fixture.programCreated);
+
+	const ShadingProgramRefl& refl = fixture.program->getReflection();
+	const FrameStatistics& stats = fixture.device->getFrameStatistics();
+
+	// Reading past the end of the vertex buffer.
+	{
+		DrawCall dc;
+		dc.setStateGroup(&fixture.stateGroup);
+		dc.draw(4, 0);
+		fixture.device->getContext()->executeDrawCall(dc, fixture.device->getWindowFrameTarget());
+		CHECK(fixture.device->getNumValidationErrors() == 1);
+		CHECK(stats.numDrawCalls == 0);
+	}
+
+	// Constant buffer smaller than the uniform block.
+	{
+		GpuHandle<Buffer> smallCBuffer = fixture.device->requestResource<Buffer>();
+		smallCBuffer->create(BufferDesc::GetDefaultConstantBuffer(16, ResourceUsage::Dynamic), nullptr);
+
+		BoundUniform uniform(refl.findUniform("ParamsCb", ShaderType::VertexShader), smallCBuffer.GetPtr());
+		fixture.draw(&uniform, 1);
+		CHECK(fixture.device->getNumValidationErrors() == 2);
+	}
+
+	// Mapped buffers cannot be used for drawing.
+	{
+		void* const mappedData = fixture.device->getContext()->map(fixture.cbuffer, Map::WriteDiscard);
+		CHECK(mappedData != nullptr);
+		CHECK(fixture.device->getContext()->map(fixture.cbuffer, Map::WriteDiscard) == nullptr);
+		CHECK(fixture.device->getNumValidationErrors() == 3);
+
+		BoundUniform uniform(refl.findUniform("ParamsCb", ShaderType::VertexShader), fixture.cbuffer.GetPtr());
+		fixture.draw(&uniform, 1);
+		CHECK(fixture.device->getNumValidationErrors() == 4);
+
+		fixture.device->getContext()->unMap(fixture.cbuffer);
+		fixture.draw(&uniform, 1);
+		CHECK(fixture.device->getNumValidationErrors() == 4);
+		CHECK(stats.numDrawCalls == 1);
+	}
+
+	// Sampling a texture while rendering to it.
+	{
+		GpuHandle<FrameTarget> frameTarget = fixture.device->requestResource<FrameTarget>();
+		frameTarget->create2D(16, 16);
+
+		BoundUniform uniform(refl.findUniform("texDiffuse", ShaderType::PixelShader), (void*)frameTarget->getRenderTarget(0));
+		fixture.draw(&uniform, 1, frameTarget);
+		CHECK(fixture.device->getNumValidationErrors() == 5);
+
+		// A texture of wrong type.
+		BoundUniform uniformEnv(refl.findUniform("texEnv", ShaderType::PixelShader), (void*)frameTarget->getRenderTarget(0));
+		fixture.draw(&uniformEnv, 1);
+		CHECK(fixture.device->getNumValidationErrors() == 6);
+	}
+
+	CHECK(stats.numDrawCalls == 1);
+}
+
+TEST_CASE("SGEDeviceNull Tracks the memory of the resources") {
+	NullDeviceFixture fixture;
+
+	const size_t bufferBytesBefore = fixture.device->getNumBytesAllocated(ResourceType::Buffer);
+	const int numBuffersBefore = fixture.device->getNumLiveResources(ResourceType::Buffer);
+	{
+		GpuHandle<Buffer> buffer = fixture.device->requestResource<Buffer>();
+		buffer->create(BufferDesc::GetDefaultVertexBuffer(1000), nullptr);
+		CHECK(fixture.device->getNumBytesAllocated(ResourceType::Buffer) == bufferBytesBefore + 1000);
+		CHECK(fixture.device->getNumLiveResources(ResourceType::Buffer) == numBuffersBefore + 1);
+	}
+	CHECK(fixture.device->getNumBytesAllocated(ResourceType::Buffer) == bufferBytesBefore);
+	CHECK(fixture.device->getNumLiveResources(ResourceType::Buffer) == numBuffersBefore);
+
+	// A 64x64 RGBA texture with all the mips, only the last 3 mips (4x4, 2x2 and 1x1) are resident.
+	{
+		TextureDesc td;
+		td.textureType = UniformType::Texture2D;
+		td.format = TextureFormat::R8G8B8A8_UNORM;
+		td.usage = TextureUsage::ImmutableResource;
+		td.texture2D = Texture2DDesc(64, 64, 7);
+
+		std::vector<char> texels(16 * 4, 0);
+		TextureData mipsData[7];
+		for (int iMip = 4; iMip < 7; ++iMip) {
+			mipsData[iMip] = TextureData(texels.data(), 4 * (64 >> iMip));
+		}
+
+		GpuHandle<Texture> texture = fixture.device->requestResource<Texture>();
+		REQUIRE(texture->create(td, mipsData));
+		CHECK(texture->getMostDetailedResidentMip() == 4);
+		CHECK(fixture.device->getNumBytesAllocated(ResourceType::Texture) == (16 + 4 + 1) * 4);
+
+		// Stream-in all mips.
+		std::vector<char> allTexels(64 * 64 * 4, 0);
+		for (int iMip = 0; iMip < 7; ++iMip) {
+			mipsData[iMip] = TextureData(allTexels.data(), 4 * (64 >> iMip));
+		}
+		CHECK(texture->setResidentMips(0, mipsData));
+		CHECK(fixture.device->getNumBytesAllocated(ResourceType::Texture) == (4096 + 1024 + 256 + 64 + 16 + 4 + 1) * 4);
+
+		// Evict the two most detailed mips, no data is needed for that.
+		CHECK(texture->setResidentMips(2, nullptr));
+		CHECK(texture->getMostDetailedResidentMip() == 2);
+		CHECK(fixture.device->getNumBytesAllocated(ResourceType::Texture) == (256 + 64 + 16 + 4 + 1) * 4);
+	}
+	CHECK(fixture.device->getNumBytesAllocated(ResourceType::Texture) == 0);
+	CHECK(fixture.device->getNumValidationErrors() == 0);
+}
+
+#endif
@@ -0,0 +1,291 @@
+#include "sge_renderer/renderer/RecordingContext.h"
+#include "sge_utils/utils/ThreadPool.h"
+#include "doctest/doctest.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace sge;
+
+namespace {
+
+/// A buffer that only exists in memory, used for the mapping commands.
+struct MockBuffer : public Buffer {
+	explicit MockBuffer(const size_t sizeBytes) {
+		m_desc = BufferDesc::GetDefaultConstantBuffer(sizeBytes, ResourceUsage::Dynamic);
+		contents.resize(sizeBytes, 0);
+	}
+
+	bool create(const BufferDesc& desc, const void* const UNUSED(pInitalData)) override {
+		m_desc = desc;
+		return true;
+	}
+	const BufferDesc& getDesc() const override { return m_desc; }
+	void destroy() override {}
+	bool isValid() const override { return true; }
+
+	BufferDesc m_desc;
+	std::vector<char> contents;
+};
+
+/// The state of a draw call as seen by the context executing it.
+struct MockDraw {
+	PrimitiveTopology::Enum primTopology = PrimitiveTopology::Unknown;
+	ShadingProgram* program = nullptr;
+	vec4f color = vec4f(0.f);
+	Buffer* cbuffer = nullptr;
+	FrameTarget* frameTarget = nullptr;
+	Rect2s viewport;
+	uint32 numVerts = 0;
+};
+
+/// A context that executes nothing and only logs what it was asked to do.
+struct MockContext : public SGEContext {
+	SGEDevice* getDevice() override { return nullptr; }
+
+	void executeDrawCall(DrawCall& drawCall,
+	                     FrameTarget* frameTarget,
+	                     const Rect2s* const pViewport = nullptr,
+	                     const Rect2s* const UNUSED(pScissorsRect) = nullptr) override {
+		MockDraw draw;
+		draw.primTopology = drawCall.m_pStateGroup->m_primTopology;
+		draw.program = drawCall.m_pStateGroup->m_shadingProg;
+		for (int t = 0; t < drawCall.numUniforms; ++t) {
+			const BoundUniform& uniform = drawCall.uniforms[t];
+			if (uniform.bindLocation.uniformType == UniformType::Float4) {
+				memcpy(draw.color.data, uniform.data, sizeof(vec4f));
+			} else if (uniform.bindLocation.uniformType == UniformType::ConstantBuffer) {
+				draw.cbuffer = uniform.buffer;
+			}
+		}
+		draw.frameTarget = frameTarget;
+		if (pViewport) {
+			draw.viewport = *pViewport;
+		}
+		draw.numVerts = drawCall.m_drawExec.LinearCall().numVerts;
+
+		draws.push_back(draw);
+		log.push_back("draw");
+	}
+
+	void* map(Buffer* buffer, const Map::Enum UNUSED(map)) override {
+		log.push_back("map");
+		return static_cast<MockBuffer*>(buffer)->contents.data();
+	}
+	void unMap(Buffer* UNUSED(buffer)) override { log.push_back("unmap"); }
+
+	void updateTextureData(Texture* UNUSED(texture), const TextureData& UNUSED(td)) override { log.push_back("updateTexture"); }
+
+	void clearColor(FrameTarget* UNUSED(target), int UNUSED(index), const float rgba[4]) override {
+		log.push_back("clearColor " + std::to_string(rgba[0]));
+	}
+	void clearDepth(FrameTarget* UNUSED(target), float UNUSED(depth)) override { log.push_back("clearDepth"); }
+	void copyDepth(FrameTarget* UNUSED(dest), FrameTarget* UNUSED(src)) override { log.push_back("copyDepth"); }
+
+	void beginQuery(Query* const UNUSED(query)) override { log.push_back("beginQuery"); }
+	void endQuery(Query* const UNUSED(query)) override { log.push_back("endQuery"); }
+	bool isQueryReady(Query* const UNUSED(query)) override { return true; }
+	bool getQueryData(Query* const UNUSED(query), uint64& queryData) override {
+		queryData = 0;
+		return true;
+	}
+
+	std::vector<std::string> log;
+	std::vector<MockDraw> draws;
+};
+
+BindLocation makeBindLocation(const short location, const UniformType::Enum type) {
+	BindLocation result;
+	result.bindLocation = location;
+	result.uniformType = short(type);
+#ifdef SGE_RENDERER_D3D11
+	result.texArraySize_or_numericUniformSizeBytes = UniformType::isNumeric(type) ? short(UniformType::GetSizeBytes(type)) : 1;
+#else
+	result.glArraySize = 1;
+#endif
+	return result;
+}
+
+/// The fake resources are never dereferenced by the recording context or the mock.
+template <typename T>
+T* makeFakeResource(const uintptr_t id) {
+	return reinterpret_cast<T*>(id * 64);
+}
+
+/// Records a draw call with its own color, the way the engine does it: the draw call, the state group and the uniform
+/// values live on the stack and get reused right after the call.
+void recordDraw(SGEContext* const context, const vec4f& color, const PrimitiveTopology::Enum primTopology, const uint32 numVerts) {
+	StateGroup stateGroup;
+	stateGroup.setPrimitiveTopology(primTopology);
+	stateGroup.setProgram(makeFakeResource<ShadingProgram>(1));
+
+	vec4f colorUniform = color;
+	BoundUniform uniforms[1] = {BoundUniform(makeBindLocation(3, UniformType::Float4), &colorUniform)};
+
+	DrawCall dc;
+	dc.setStateGroup(&stateGroup);
+	dc.setUniforms(uniforms, 1);
+	dc.draw(numVerts, 0);
+
+	const Rect2s viewport(64, 32, 16, 0);
+	context->executeDrawCall(dc, makeFakeResource<FrameTarget>(2), &viewport);
+
+	// Trash the memory of the caller, the recorded commands must not depend on it.
+	colorUniform = vec4f(-1.f);
+	stateGroup.setPrimitiveTopology(PrimitiveTopology::Unknown);
+}
+
+} // namespace
+
+TEST_CASE("SGERecordingContext Replays the commands in order") {
+	SGERecordingContext recorder(nullptr);
+	MockBuffer cbuffer(sizeof(vec4f));
+
+	const float clearRgba[4] = {0.5f, 0.f, 0.f, 1.f};
+	recorder.clearColor(makeFakeResource<FrameTarget>(2), 0, clearRgba);
+	recorder.clearDepth(makeFakeResource<FrameTarget>(2), 1.f);
+
+	// Write the buffer for the 1st draw.
+	vec4f* mapped = static_cast<vec4f*>(recorder.map(&cbuffer, Map::WriteDiscard));
+	REQUIRE(mapped != nullptr);
+	*mapped = vec4f(1.f, 2.f, 3.f, 4.f);
+	recorder.unMap(&cbuffer);
+
+	StateGroup stateGroup;
+	stateGroup.setPrimitiveTopology(PrimitiveTopology::TriangleList);
+	vec4f color(0.25f);
+	BoundUniform uniforms[2] = {
+	    BoundUniform(makeBindLocation(0, UniformType::Float4), &color),
+	    BoundUniform(makeBindLocation(1, UniformType::ConstantBuffer), &cbuffer),
+	};
+	DrawCall dc;
+	dc.setStateGroup(&stateGroup);
+	dc.setUniforms(uniforms, 2);
+	dc.draw(3, 0);
+	recorder.executeDrawCall(dc, makeFakeResource<FrameTarget>(2));
+
+	// The same buffer gets rewritten for the 2nd draw.
+	mapped = static_cast<vec4f*>(recorder.map(&cbuffer, Map::WriteDiscard));
+	*mapped = vec4f(5.f, 6.f, 7.f, 8.f);
+	recorder.unMap(&cbuffer);
+
+	color = vec4f(0.75f);
+	dc.draw(6, 0);
+	recorder.executeDrawCall(dc, makeFakeResource<FrameTarget>(2));
+
+	recorder.copyDepth(makeFakeResource<FrameTarget>(3), makeFakeResource<FrameTarget>(2));
+
+	// Nothing gets executed while recording.
+	CHECK(cbuffer.contents == std::vector<char>(sizeof(vec4f), 0));
+	CHECK(recorder.getNumDrawCalls() == 2);
+
+	MockContext immediate;
+	recorder.execute(&immediate);
+
+	const std::vector<std::string> expectedLog = {
+	    "clearColor 0.500000", "clearDepth", "map", "unmap", "draw", "map", "unmap", "draw", "copyDepth",
+	};
+	CHECK(immediate.log == expectedLog);
+
+	REQUIRE(immediate.draws.size() == 2);
+	CHECK(immediate.draws[0].color == vec4f(0.25f));
+	CHECK(immediate.draws[0].numVerts == 3);
+	CHECK(immediate.draws[0].cbuffer == &cbuffer);
+	CHECK(immediate.draws[0].primTopology == PrimitiveTopology::TriangleList);
+	CHECK(immediate.draws[1].color == vec4f(0.75f));
+	CHECK(immediate.draws[1].numVerts == 6);
+
+	// The last write to the buffer wins, as it would on the immediate context.
+	vec4f cbufferValue;
+	memcpy(cbufferValue.data, cbuffer.contents.data(), sizeof(vec4f));
+	CHECK(cbufferValue == vec4f(5.f, 6.f, 7.f, 8.f));
+}
+
+TEST_CASE("SGERecordingContext Copies the data of the caller") {
+	SGERecordingContext recorder(nullptr);
+	recordDraw(&recorder, vec4f(1.f, 0.f, 0.f, 1.f), PrimitiveTopology::TriangleList, 3);
+	recordDraw(&recorder, vec4f(0.f, 1.f, 0.f, 1.f), PrimitiveTopology::TriangleList, 6);
+	recordDraw(&recorder, vec4f(0.f, 0.f, 1.f, 1.f), PrimitiveTopology::LineList, 2);
+
+	// The 2nd draw reuses the state group of the 1st one.
+	CHECK(recorder.getNumDrawCalls() == 3);
+	CHECK(recorder.getNumCommands() == 2 * 3 + 2);
+
+	MockContext immediate;
+	recorder.execute(&immediate);
+
+	REQUIRE(immediate.draws.size() == 3);
+	CHECK(immediate.draws[0].color == vec4f(1.f, 0.f, 0.f, 1.f));
+	CHECK(immediate.draws[1].color == vec4f(0.f, 1.f, 0.f, 1.f));
+	CHECK(immediate.draws[2].color == vec4f(0.f, 0.f, 1.f, 1.f));
+	CHECK(immediate.draws[0].primTopology == PrimitiveTopology::TriangleList);
+	CHECK(immediate.draws[1].primTopology == PrimitiveTopology::TriangleList);
+	CHECK(immediate.draws[2].primTopology == PrimitiveTopology::LineList);
+	CHECK(immediate.draws[2].program == makeFakeResource<ShadingProgram>(1));
+	CHECK(immediate.draws[2].frameTarget == makeFakeResource<FrameTarget>(2));
+	CHECK(immediate.draws[2].viewport.width == 64);
+	CHECK(immediate.draws[2].viewport.x == 16);
+}
+
+TEST_CASE("SGERecordingContext Reset keeps the memory") {
+	SGERecordingContext recorder(nullptr);
+	for (int t = 0; t < 1000; ++t) {
+		recordDraw(&recorder, vec4f(float(t)), PrimitiveTopology::TriangleList, 3);
+	}
+
+	const size_t numBytesReserved = recorder.getAllocator().getNumBytesReserved();
+	CHECK(numBytesReserved >= recorder.getAllocator().getNumBytesUsed());
+
+	recorder.reset();
+	CHECK(recorder.getNumCommands() == 0);
+	CHECK(recorder.getAllocator().getNumBytesUsed() == 0);
+
+	MockContext immediate;
+	recorder.execute(&immediate);
+	CHECK(immediate.log.empty());
+
+	for (int t = 0; t < 1000; ++t) {
+		recordDraw(&recorder, vec4f(float(t)), PrimitiveTopology::TriangleList, 3);
+	}
+	CHECK(recorder.getAllocator().getNumBytesReserved() == numBytesReserved);
+
+	recorder.execute(&immediate);
+	REQUIRE(immediate.draws.size() == 1000);
+	CHECK(immediate.draws[999].color == vec4f(999.f));
+}
+
+TEST_CASE("SGERecordingContext Recording on multiple threads") {
+	const int kNumPasses = 8;
+	const int kNumDrawsPerPass = 500;
+
+	std::vector<std::unique_ptr<SGERecordingContext>> recorders;
+	for (int t = 0; t < kNumPasses; ++t) {
+		recorders.emplace_back(new SGERecordingContext(nullptr));
+	}
+
+	// Each pass gets recorded by its own context, the order of the threads doesn't matter.
+	ThreadPool threadPool(3);
+	threadPool.parallelFor(kNumPasses, [&](const int iPass) -> void {
+		for (int iDraw = 0; iDraw < kNumDrawsPerPass; ++iDraw) {
+			recordDraw(recorders[iPass].get(), vec4f(float(iPass), float(iDraw), 0.f, 0.f), PrimitiveTopology::TriangleList,
+			           uint32(iDraw));
+		}
+	});
+
+	// Executing the passes in order gives the same result as drawing them one after another.
+	MockContext immediate;
+	for (const auto& recorder : recorders) {
+		recorder->execute(&immediate);
+	}
+
+	REQUIRE(immediate.draws.size() == kNumPasses * kNumDrawsPerPass);
+	bool areAllDrawsInOrder = true;
+	for (int iPass = 0; iPass < kNumPasses; ++iPass) {
+		for (int iDraw = 0; iDraw < kNumDrawsPerPass; ++iDraw) {
+			const MockDraw& draw = immediate.draws[iPass * kNumDrawsPerPass + iDraw];
+			areAllDrawsInOrder &= draw.color == vec4f(float(iPass), float(iDraw), 0.f, 0.f) && draw.numVerts == uint32(iDraw);
+		}
+	}
+	CHECK(areAllDrawsInOrder);
+}
@@ -0,0 +1,157 @@
+#include "sge_core/RenderQueue.h"
+#include "sge_utils/math/Random.h"
+#include "sge_utils/utils/timer.h"
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace sge;
+
+namespace {
+
+std::vector<int> getPayloadOrder(const RenderQueue& queue) {
+	std::vector<int> order;
+	for (const RenderItem& item : queue.getItems()) {
+		order.push_back(item.payloadIndex);
+	}
+	return order;
+}
+
+} // namespace
+
+TEST_CASE("RenderQueue Sort keys store the pass, the state and the depth") {
+	const RenderItemState state(0x2AB, 0xBEEF, 0x1234);
+
+	const uint64 opaqueKey = RenderSortKey::make(renderQueuePass_opaque, state, 25.f, 100.f);
+	CHECK(RenderSortKey::getPass(opaqueKey) == renderQueuePass_opaque);
+	CHECK(RenderSortKey::getState(opaqueKey) == state);
+	CHECK(RenderSortKey::getDepth(opaqueKey) == RenderSortKey::quantizeDepth(25.f, 100.f));
+
+	const uint64 transparentKey = RenderSortKey::make(renderQueuePass_transparent, state, 25.f, 100.f);
+	CHECK(RenderSortKey::getPass(transparentKey) == renderQueuePass_transparent);
+	CHECK(RenderSortKey::getState(transparentKey) == state);
+	CHECK(RenderSortKey::getDepth(transparentKey) == RenderSortKey::quantizeDepth(25.f, 100.f));
+
+	// Only the lower bits of the state get stored.
+	const uint64 wideKey = RenderSortKey::make(renderQueuePass_opaque, RenderItemState(0xFFFFF, 0xFFFFF, 0xFFFFF), 0.f, 1.f);
+	CHECK(RenderSortKey::getState(wideKey) == RenderItemState(0x3FF, 0xFFFF, 0xFFFF));
+
+	// Depths outside of the range get clamped.
+	CHECK(RenderSortKey::quantizeDepth(-5.f, 100.f) == 0);
+	CHECK(RenderSortKey::quantizeDepth(500.f, 100.f) == RenderSortKey::quantizeDepth(100.f, 100.f));
+	CHECK(RenderSortKey::quantizeDepth(50.f, 100.f) < RenderSortKey::quantizeDepth(51.f, 100.f));
+}
+
+TEST_CASE("RenderQueue Sorting the items") {
+	RenderQueue queue;
+	const RenderItemState stateA(1, 10, 100);
+	const RenderItemState stateB(2, 10, 100);
+
+	// Added interleaved, the opaque ones get grouped by state and drawn front to back,
+	// the transparent ones go last and back to front.
+	queue.add(RenderSortKey::make(renderQueuePass_transparent, stateA, 10.f, 100.f), 0);
+	queue.add(RenderSortKey::make(renderQueuePass_opaque, stateB, 10.f, 100.f), 1);
+	queue.add(RenderSortKey::make(renderQueuePass_opaque, stateA, 50.f, 100.f), 2);
+	queue.add(RenderSortKey::make(renderQueuePass_transparent, stateB, 90.f, 100.f), 3);
+	queue.add(RenderSortKey::make(renderQueuePass_opaque, stateB, 5.f, 100.f), 4);
+	queue.add(RenderSortKey::make(renderQueuePass_opaque, stateA, 20.f, 100.f), 5);
+	queue.sort();
+
+	CHECK(getPayloadOrder(queue) == std::vector<int>{5, 2, 4, 1, 3, 0});
+
+	// Unsorted: 3 for the first item and a program change between all neighbours except items 3 and 4.
+	CHECK(queue.getStats().numItems == 6);
+	CHECK(queue.getStats().numStateChangesUnsorted == 3 + 4);
+	// Sorted: 3 for the first, then a program change A->B, and the two transparent ones B->A.
+	CHECK(queue.getStats().numStateChangesSorted == 3 + 2);
+
+	// Equal keys keep the order they were added in.
+	queue.clear();
+	for (int t = 0; t < 5; ++t) {
+		queue.add(RenderSortKey::make(renderQueuePass_opaque, stateA, 1.f, 100.f), t);
+	}
+	queue.sort();
+	CHECK(getPayloadOrder(queue) == std::vector<int>{0, 1, 2, 3, 4});
+}
+
+TEST_CASE("RenderQueue Radix sort matches std::stable_sort") {
+	Random rnd(17);
+	RenderQueue queue;
+
+	for (const int numItems : {0, 1, 2, 33, 5000}) {
+		queue.clear();
+		std::vector<RenderItem> expected;
+		for (int t = 0; t < numItems; ++t) {
+			// A few distinct values per field, so there are many equal keys.
+			const RenderItemState state(rnd.nextInt() % 4, rnd.nextInt() % 8, rnd.nextInt() % 16);
+			const RenderQueuePass pass = (rnd.nextInt() % 4 == 0) ? renderQueuePass_transparent : renderQueuePass_opaque;
+			const uint64 key = RenderSortKey::make(pass, state, float(rnd.nextInt() % 32), 32.f);
+
+			queue.add(key, t);
+			RenderItem item;
+			item.sortKey = key;
+			item.payloadIndex = t;
+			expected.push_back(item);
+		}
+
+		std::stable_sort(expected.begin(), expected.end(), [](const RenderItem& a, const RenderItem& b) -> bool { return a.sortKey < b.sortKey; });
+		queue.sort();
+
+		REQUIRE(queue.size() == numItems);
+		for (int t = 0; t < numItems; ++t) {
+			CHECK(queue.getItems()[t].sortKey == expected[t].sortKey);
+			CHECK(queue.getItems()[t].payloadIndex == expected[t].payloadIndex);
+		}
+
+		CHECK(queue.getStats().numStateChangesSorted <= queue.getStats().numStateChangesUnsorted);
+	}
+}
+
+TEST_CASE("RenderQueue Benchmark sorting 100k items" * doctest::skip()) {
+	const int numItems = 100000;
+	const int numRepeats = 20;
+
+	Random rnd(3);
+	std::vector<uint64> keys;
+	for (int t = 0; t < numItems; ++t) {
+		// About 40 programs, 500 materials and 2000 meshes.
+		const RenderItemState state(rnd.nextInt() % 40, rnd.nextInt() % 500, rnd.nextInt() % 2000);
+		keys.push_back(RenderSortKey::make(renderQueuePass_opaque, state, rnd.nextInRange(0.f, 1000.f), 1000.f));
+	}
+
+	RenderQueue queue;
+	Timer timer;
+	float radixSeconds = 0.f;
+	for (int iRepeat = 0; iRepeat < numRepeats; ++iRepeat) {
+		queue.clear();
+		for (int t = 0; t < numItems; ++t) {
+			queue.add(keys[t], t);
+		}
+		timer.tick();
+		queue.sort();
+		timer.tick();
+		radixSeconds += timer.diff_seconds();
+	}
+
+	std::vector<RenderItem> items;
+	float stdSortSeconds = 0.f;
+	for (int iRepeat = 0; iRepeat < numRepeats; ++iRepeat) {
+		items.clear();
+		for (int t = 0; t < numItems; ++t) {
+			RenderItem item;
+			item.sortKey = keys[t];
+			item.payloadIndex = t;
+			items.push_back(item);
+		}
+		timer.tick();
+		std::stable_sort(items.begin(), items.end(), [](const RenderItem& a, const RenderItem& b) -> bool { return a.sortKey < b.sortKey; });
+		timer.tick();
+		stdSortSeconds += timer.diff_seconds();
+	}
+
+	CHECK(queue.getItems()[0].sortKey == items[0].sortKey);
+	MESSAGE(numItems << " items, radix sort: " << radixSeconds * 1000.f / numRepeats << "ms, std::stable_sort: "
+	                 << stdSortSeconds * 1000.f / numRepeats << "ms. State changes unsorted: " << queue.getStats().numStateChangesUnsorted
+	                 << ", sorted: " << queue.getStats().numStateChangesSorted);
+}
@@ -0,0 +1,237 @@
+#include "sge_core/ShadowCacheInvalidator.h"
+#include "doctest/doctest.h"
+
+#include <vector>
+
+using namespace sge;
+
+namespace {
+
+/// A scripted scene, the casters get split in static and dynamic ones the same way the engine does it:
+/// a caster becomes dynamic when it moves and returns to the static casters after it stays still for a few frames.
+struct TestScene {
+	static constexpr int kFramesToBecomeStatic = 3;
+
+	struct Caster {
+		AABox3f boundsWs;
+		bool isDynamic = false;
+		int lastMoveFrame = 0;
+	};
+
+	struct Light {
+		AABox3f volumeWs;
+		uint64 stateHash = 0;
+		bool isVisible = true;
+	};
+
+	int addCaster(const vec3f& position) {
+		Caster caster;
+		caster.boundsWs = AABox3f::getFromHalfDiagonal(vec3f(0.5f), position);
+		casters.push_back(caster);
+		invalidator.addDirtyBounds(caster.boundsWs);
+		return int(casters.size()) - 1;
+	}
+
+	void moveCaster(const int iCaster, const vec3f& offset) {
+		Caster& caster = casters[iCaster];
+		if (caster.isDynamic == false) {
+			// The caster leaves the static casters.
+			invalidator.addDirtyBounds(caster.boundsWs);
+			caster.isDynamic = true;
+		}
+
+		caster.boundsWs.min += offset;
+		caster.boundsWs.max += offset;
+		caster.lastMoveFrame = frameIndex;
+	}
+
+	int addLight(const vec3f& position, const float range) {
+		Light light;
+		light.volumeWs = AABox3f::getFromHalfDiagonal(vec3f(range), position);
+		lights.push_back(light);
+		return int(lights.size()) - 1;
+	}
+
+	void moveLight(const int iLight, const vec3f& offset) {
+		lights[iLight].volumeWs.min += offset;
+		lights[iLight].volumeWs.max += offset;
+		lights[iLight].stateHash++;
+	}
+
+	/// Advances a frame, returns which lights redrew their static layer.
+	std::vector<bool> update() {
+		frameIndex++;
+		for (Caster& caster : casters) {
+			if (caster.isDynamic && frameIndex - caster.lastMoveFrame >= kFramesToBecomeStatic) {
+				// The caster joins the static casters.
+				caster.isDynamic = false;
+				invalidator.addDirtyBounds(caster.boundsWs);
+			}
+		}
+
+		invalidator.beginFrame();
+
+		std::vector<bool> redraws;
+		for (int iLight = 0; iLight < int(lights.size()); ++iLight) {
+			const Light& light = lights[iLight];
+			redraws.push_back(light.isVisible && invalidator.updateLight(iLight, light.volumeWs, light.stateHash));
+		}
+
+		return redraws;
+	}
+
+	ShadowCacheInvalidator invalidator;
+	std::vector<Caster> casters;
+	std::vector<Light> lights;
+	int frameIndex = 0;
+};
+
+} // namespace
+
+TEST_CASE("ShadowCacheInvalidator Static scene is drawn once") {
+	TestScene scene;
+	scene.addCaster(vec3f(0.f));
+	scene.addCaster(vec3f(20.f, 0.f, 0.f));
+	scene.addLight(vec3f(0.f, 2.f, 0.f), 5.f);
+	scene.addLight(vec3f(20.f, 2.f, 0.f), 5.f);
+
+	CHECK(scene.update() == std::vector<bool>{true, true});
+	CHECK(scene.invalidator.getStats().numStaticRedraws == 2);
+
+	for (int t = 0; t < 10; ++t) {
+		CHECK(scene.update() == std::vector<bool>{false, false});
+	}
+
+	CHECK(scene.invalidator.getStats().numCacheHits == 2);
+	CHECK(scene.invalidator.isLightCached(0));
+}
+
+TEST_CASE("ShadowCacheInvalidator A moving caster redraws only the lights around it") {
+	TestScene scene;
+	const int crate = scene.addCaster(vec3f(0.f));
+	scene.addCaster(vec3f(20.f, 0.f, 0.f));
+	scene.addLight(vec3f(0.f, 2.f, 0.f), 5.f);
+	scene.addLight(vec3f(20.f, 2.f, 0.f), 5.f);
+	scene.update();
+
+	// The crate starts moving, it leaves the static layer of the near light.
+	scene.moveCaster(crate, vec3f(0.5f, 0.f, 0.f));
+	CHECK(scene.update() == std::vector<bool>{true, false});
+
+	// While moving it is only drawn in the dynamic layer.
+	scene.moveCaster(crate, vec3f(0.5f, 0.f, 0.f));
+	CHECK(scene.update() == std::vector<bool>{false, false});
+	scene.moveCaster(crate, vec3f(0.5f, 0.f, 0.f));
+	CHECK(scene.update() == std::vector<bool>{false, false});
+
+	// The crate stops and after a while returns to the static layer.
+	CHECK(scene.update() == std::vector<bool>{false, false});
+	CHECK(scene.update() == std::vector<bool>{true, false});
+	CHECK(scene.update() == std::vector<bool>{false, false});
+}
+
+TEST_CASE("ShadowCacheInvalidator A caster moving between lights") {
+	TestScene scene;
+	const int crate = scene.addCaster(vec3f(0.f));
+	scene.addLight(vec3f(0.f, 2.f, 0.f), 5.f);
+	scene.addLight(vec3f(20.f, 2.f, 0.f), 5.f);
+	scene.update();
+
+	// The crate gets thrown from the first light to the second one where it stops.
+	for (int t = 0; t < 4; ++t) {
+		scene.moveCaster(crate, vec3f(5.f, 0.f, 0.f));
+		const std::vector<bool> redraws = scene.update();
+		CHECK(redraws[0] == (t == 0));
+		CHECK(redraws[1] == false);
+	}
+
+	std::vector<int> numRedraws(2, 0);
+	for (int t = 0; t < 10; ++t) {
+		const std::vector<bool> redraws = scene.update();
+		numRedraws[0] += redraws[0] ? 1 : 0;
+		numRedraws[1] += redraws[1] ? 1 : 0;
+	}
+
+	CHECK(numRedraws == std::vector<int>{0, 1});
+}
+
+TEST_CASE("ShadowCacheInvalidator A moving light redraws only itself") {
+	TestScene scene;
+	scene.addCaster(vec3f(0.f));
+	scene.addLight(vec3f(0.f, 2.f, 0.f), 5.f);
+	const int movingLight = scene.addLight(vec3f(1.f, 2.f, 0.f), 5.f);
+	scene.update();
+
+	for (int t = 0; t < 3; ++t) {
+		scene.moveLight(movingLight, vec3f(0.f, 0.1f, 0.f));
+		CHECK(scene.update() == std::vector<bool>{false, true});
+	}
+
+	CHECK(scene.update() == std::vector<bool>{false, false});
+}
+
+TEST_CASE("ShadowCacheInvalidator Lights skipped in a frame still get invalidated") {
+	TestScene scene;
+	const int crate = scene.addCaster(vec3f(0.f));
+	scene.addLight(vec3f(0.f, 2.f, 0.f), 5.f);
+	scene.update();
+
+	// The light isn't drawn (for example it is outside of the view) while the crate moves and stops.
+	scene.lights[0].isVisible = false;
+	scene.moveCaster(crate, vec3f(1.f, 0.f, 0.f));
+	for (int t = 0; t < TestScene::kFramesToBecomeStatic + 1; ++t) {
+		scene.update();
+		CHECK(scene.invalidator.isLightCached(0) == false);
+	}
+
+	// All the changes get picked up with a single redraw.
+	scene.lights[0].isVisible = true;
+	CHECK(scene.update() == std::vector<bool>{true});
+	CHECK(scene.update() == std::vector<bool>{false});
+}
+
+TEST_CASE("ShadowCacheInvalidator Removing and invalidating") {
+	ShadowCacheInvalidator invalidator;
+	const AABox3f volume = AABox3f::getFromHalfDiagonal(vec3f(5.f));
+
+	invalidator.beginFrame();
+	CHECK(invalidator.updateLight(7, volume, 1));
+	CHECK(invalidator.updateLight(7, volume, 1) == false);
+	CHECK(invalidator.updateLight(7, volume, 2));
+	CHECK(invalidator.getNumLights() == 1);
+
+	// Unbounded lights get invalidated by any change.
+	CHECK(invalidator.updateLight(8, AABox3f(), 1));
+	invalidator.addDirtyBounds(AABox3f::getFromHalfDiagonal(vec3f(1.f), vec3f(100.f)));
+	invalidator.beginFrame();
+	CHECK(invalidator.isLightCached(7));
+	CHECK(invalidator.isLightCached(8) == false);
+
+	invalidator.invalidateAll();
+	CHECK(invalidator.isLightCached(7) == false);
+	CHECK(invalidator.updateLight(7, volume, 2));
+
+	invalidator.removeLight(7);
+	CHECK(invalidator.isLightCached(7) == false);
+	CHECK(invalidator.updateLight(7, volume, 2));
+}
+
+TEST_CASE("ShadowCacheInvalidator Too many changes get merged") {
+	ShadowCacheInvalidator invalidator;
+	const AABox3f volume = AABox3f::getFromHalfDiagonal(vec3f(1.f), vec3f(50.f, 0.f, 0.f));
+	invalidator.updateLight(0, volume, 0);
+
+	// Changes away from the light keep its cache while they fit.
+	for (int t = 0; t < ShadowCacheInvalidator::kMaxDirtyBounds; ++t) {
+		invalidator.addDirtyBounds(AABox3f::getFromHalfDiagonal(vec3f(0.5f), vec3f(0.f, 0.f, float(t + 10))));
+	}
+	invalidator.beginFrame();
+	CHECK(invalidator.isLightCached(0));
+
+	// Changes on both sides of the light, once merged they cover it.
+	for (int t = 0; t <= ShadowCacheInvalidator::kMaxDirtyBounds; ++t) {
+		invalidator.addDirtyBounds(AABox3f::getFromHalfDiagonal(vec3f(0.5f), vec3f(t % 2 == 0 ? 0.f : 100.f, 0.f, 0.f)));
+	}
+	invalidator.beginFrame();
+	CHECK(invalidator.isLightCached(0) == false);
+}
@@ -0,0 +1,151 @@
+#include "sge_core/AssetLibrary.h"
+#include "sge_core/model/EvaluatedModel.h"
+#include "sge_core/model/Model.h"
+#include "sge_core/model/SharedEvaluatedModelCache.h"
+#include "sge_utils/utils/timer.h"
+#include "doctest/doctest.h"
+
+#include "TestModels.h"
+
+using namespace sge;
+
+namespace {
+
+MaterialOverride makeOverride(const char* const name, const vec4f& color) {
+	MaterialOverride ovr;
+	ovr.name = name;
+	ovr.mtl.diffuseColor = color;
+	return ovr;
+}
+
+/// The memory owned by an evaluated model, excluding the GPU resources.
+size_t getEvaluatedModelMemory(const EvaluatedModel& evalModel) {
+	size_t bytes = sizeof(EvaluatedModel);
+	bytes += evalModel.m_evaluatedNodes.capacity() * sizeof(EvaluatedNode);
+	bytes += evalModel.m_evaluatedMeshes.capacity() * sizeof(EvaluatedMesh);
+	bytes += evalModel.m_evaluatedMaterials.capacity() * sizeof(EvaluatedMaterial);
+	bytes += evalModel.m_keyFramesCursors.capacity() * sizeof(KeyFramesCursor);
+	for (const AnimationPose* pose : {&evalModel.m_staticPose, &evalModel.m_momentPose, &evalModel.m_blendedPose}) {
+		bytes += pose->positions.capacity() * sizeof(vec3f) * 2 + pose->rotations.capacity() * sizeof(quatf);
+	}
+	return bytes;
+}
+
+} // namespace
+
+TEST_CASE("SharedEvaluatedModelCache Instances with the same overrides share the evaluation") {
+	Model model;
+	makeTreeModel(model);
+	AssetLibrary assetLibrary(nullptr);
+	EvaluatedModel staticEval;
+	staticEval.initialize(&assetLibrary, &model);
+	staticEval.evaluateNodes(nullptr, 0);
+
+	SharedEvaluatedModelCache cache;
+	cache.initialize(&staticEval);
+
+	const std::vector<MaterialOverride> noOverrides;
+	const std::vector<MaterialOverride> redLeaves = {makeOverride("leaves", vec4f(1.f, 0.f, 0.f, 1.f))};
+	const std::vector<MaterialOverride> greenLeaves = {makeOverride("leaves", vec4f(0.f, 1.f, 0.f, 1.f))};
+	const std::vector<MaterialOverride> redLeavesDarkBark = {makeOverride("leaves", vec4f(1.f, 0.f, 0.f, 1.f)),
+	                                                         makeOverride("bark", vec4f(0.1f, 0.1f, 0.1f, 1.f))};
+	const std::vector<MaterialOverride> darkBarkRedLeaves = {redLeavesDarkBark[1], redLeavesDarkBark[0]};
+
+	std::shared_ptr<const SharedEvaluatedModel> plainA = cache.acquire(noOverrides);
+	std::shared_ptr<const SharedEvaluatedModel> plainB = cache.acquire(noOverrides);
+	CHECK((plainA == plainB));
+	CHECK((plainA->evalModel == &staticEval));
+	CHECK(plainA->overrideIndexPerMaterial == std::vector<int>{-1, -1});
+
+	// Different overrides produce distinct evaluations.
+	std::shared_ptr<const SharedEvaluatedModel> red = cache.acquire(redLeaves);
+	std::shared_ptr<const SharedEvaluatedModel> green = cache.acquire(greenLeaves);
+	CHECK((red != plainA));
+	CHECK((red != green));
+	CHECK(red->overrideIndexPerMaterial == std::vector<int>{-1, 0});
+	CHECK(red->materialOverrides[0].mtl.diffuseColor == vec4f(1.f, 0.f, 0.f, 1.f));
+	CHECK(green->materialOverrides[0].mtl.diffuseColor == vec4f(0.f, 1.f, 0.f, 1.f));
+
+	// The order of the overrides doesn't matter.
+	std::shared_ptr<const SharedEvaluatedModel> both = cache.acquire(redLeavesDarkBark);
+	CHECK((cache.acquire(darkBarkRedLeaves) == both));
+	CHECK(both->materialOverrides[both->overrideIndexPerMaterial[0]].name == "bark");
+	CHECK(both->materialOverrides[both->overrideIndexPerMaterial[1]].name == "leaves");
+	CHECK(cache.getNumAliveEntries() == 4);
+
+	// The entry of the instance is returned as it is while the overrides do not change.
+	CHECK((cache.acquire(redLeaves, red) == red));
+	CHECK((cache.acquire(greenLeaves, red) == green));
+
+	// Entries not used by any instance get removed.
+	red.reset();
+	green.reset();
+	CHECK(cache.getNumAliveEntries() == 2);
+	std::shared_ptr<const SharedEvaluatedModel> redAgain = cache.acquire(redLeaves);
+	CHECK(redAgain->materialOverrides[0].mtl.diffuseColor == vec4f(1.f, 0.f, 0.f, 1.f));
+	CHECK(cache.getNumAliveEntries() == 3);
+
+	// After clearing, the old entries are not returned anymore.
+	cache.clear();
+	std::shared_ptr<const SharedEvaluatedModel> plainAfterClear = cache.acquire(noOverrides, plainA);
+	CHECK((plainAfterClear != plainA));
+	CHECK(cache.getNumAliveEntries() == 1);
+}
+
+TEST_CASE("SharedEvaluatedModelCache Benchmark 10k instanced trees" * doctest::skip()) {
+	const int numInstances = 10000;
+
+	Model model;
+	makeTreeModel(model);
+	AssetLibrary assetLibrary(nullptr);
+
+	// Every tree with its own evaluation.
+	Timer timer;
+	std::vector<EvaluatedModel> perInstanceEvals(numInstances);
+	for (EvaluatedModel& evalModel : perInstanceEvals) {
+		evalModel.initialize(&assetLibrary, &model);
+		evalModel.evaluateNodes(nullptr, 0);
+		evalModel.computeSkinningPalette();
+	}
+	timer.tick();
+	const float perInstanceSeconds = timer.diff_seconds();
+
+	size_t perInstanceBytes = 0;
+	for (const EvaluatedModel& evalModel : perInstanceEvals) {
+		perInstanceBytes += getEvaluatedModelMemory(evalModel);
+	}
+
+	// The trees sharing the evaluation, one in ten with autumn leaves.
+	const std::vector<MaterialOverride> noOverrides;
+	const std::vector<MaterialOverride> autumnLeaves = {makeOverride("leaves", vec4f(0.9f, 0.5f, 0.1f, 1.f))};
+
+	timer.tick();
+	EvaluatedModel staticEval;
+	staticEval.initialize(&assetLibrary, &model);
+	staticEval.evaluateNodes(nullptr, 0);
+	SharedEvaluatedModelCache cache;
+	cache.initialize(&staticEval);
+
+	std::vector<std::shared_ptr<const SharedEvaluatedModel>> sharedEvals(numInstances);
+	for (int iInstance = 0; iInstance < numInstances; ++iInstance) {
+		sharedEvals[iInstance] = cache.acquire(iInstance % 10 == 0 ? autumnLeaves : noOverrides);
+	}
+	timer.tick();
+	const float sharedSeconds = timer.diff_seconds();
+
+	// Reacquiring every frame with the entry of the instance as a hint.
+	for (int iInstance = 0; iInstance < numInstances; ++iInstance) {
+		sharedEvals[iInstance] = cache.acquire(iInstance % 10 == 0 ? autumnLeaves : noOverrides, sharedEvals[iInstance]);
+	}
+	timer.tick();
+	const float reacquireSeconds = timer.diff_seconds();
+
+	const size_t sharedBytes =
+	    getEvaluatedModelMemory(staticEval) + size_t(cache.getNumAliveEntries()) * sizeof(SharedEvaluatedModel) +
+	    sizeof(std::shared_ptr<const SharedEvaluatedModel>) * numInstances;
+
+	CHECK(cache.getNumAliveEntries() == 2);
+	MESSAGE(numInstances << " trees. Per instance evaluation: " << perInstanceSeconds * 1000.f << "ms, " << perInstanceBytes / 1024
+	                     << "KiB. Shared evaluation: " << sharedSeconds * 1000.f << "ms, " << sharedBytes / 1024
+	                     << "KiB. Reacquiring with hints: " << reacquireSeconds * 1000.f << "ms");
+}
@@ -0,0 +1,250 @@
+#include "TestModels.h"
+
+#include "sge_core/model/Model.h"
+
+#include <cmath>
+#include <random>
+
+using namespace sge;
+
+namespace {
+
+/// The vertex layout of the mesh of @makeHandModel.
+struct SkinnedVertex {
+	vec3f position;
+	int bonesIds[4];
+	float bonesWeights[4];
+};
+
+} // namespace
+
+void makeNamedChainModel(Model& model, const std::vector<std::string>& nodeNames, const float boneLength) {
+	for (int iNode = 0; iNode < int(nodeNames.size()); ++iNode) {
+		const int newNode = model.makeNewNode();
+		model.nodeAt(newNode)->name = nodeNames[iNode];
+		model.nodeAt(newNode)->staticLocalTransform = transf3d(vec3f(0.f, boneLength, 0.f), quatf::getIdentity(), vec3f(1.f));
+		if (iNode > 0) {
+			model.nodeAt(iNode - 1)->childNodes.push_back(newNode);
+		}
+	}
+	model.setRootNodeIndex(0);
+	model.computeNodesOrder();
+	model.computeNodesNameLookup();
+}
+
+void makeAnimatedChainModel(Model& model, const int numNodes, const float durationSec) {
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		const int newNode = model.makeNewNode();
+		if (iNode > 0) {
+			model.nodeAt(iNode - 1)->childNodes.push_back(newNode);
+		}
+	}
+	model.setRootNodeIndex(0);
+
+	ModelAnimation& anim = *model.animationAt(model.makeNewAnim());
+	anim.animationName = "walk";
+	anim.durationSec = durationSec;
+
+	const int numKeys = int(durationSec * 30.f) + 1;
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		KeyFrames& keyFrames = anim.getOrAddKeyFramesForNode(iNode);
+		const float phase = float(iNode) * 0.7f;
+		for (int iKey = 0; iKey < numKeys; ++iKey) {
+			const float t = float(iKey) / 30.f;
+			if (iNode == 0) {
+				keyFrames.positionKeyFrames.setKey(t, vec3f(t * 40.f, 0.9f + 0.05f * sinf(t * 12.f), 0.f));
+			} else {
+				keyFrames.positionKeyFrames.setKey(t, vec3f(0.f, 0.3f, 0.f));
+			}
+
+			const vec3f axis = vec3f(sinf(phase), 1.f, cosf(phase)).normalized0();
+			keyFrames.rotationKeyFrames.setKey(t, quatf::getAxisAngle(axis, 0.8f * sinf(t * 3.f + phase)));
+
+			if (iNode % 3 == 0) {
+				keyFrames.scalingKeyFrames.setKey(t, vec3f(1.f + 0.1f * sinf(t * 2.f + phase)));
+			}
+		}
+	}
+}
+
+void makeCharacterModel(Model& model) {
+	const int root = model.makeNewNode();
+	const int head = model.makeNewNode();
+	model.nodeAt(root)->name = "root";
+	model.nodeAt(head)->name = "head";
+	model.nodeAt(root)->childNodes.push_back(head);
+	model.setRootNodeIndex(root);
+
+	const char* const animationNames[3] = {"idle", "walk", "jump"};
+	for (int iAnim = 0; iAnim < 3; ++iAnim) {
+		ModelAnimation& anim = *model.animationAt(model.makeNewAnim());
+		anim.animationName = animationNames[iAnim];
+		anim.durationSec = 1.f;
+		for (int iNode = 0; iNode < 2; ++iNode) {
+			KeyFrames& keyFrames = anim.getOrAddKeyFramesForNode(iNode);
+			keyFrames.positionKeyFrames.setKey(0.f, vec3f(0.f, 1.f, 0.f));
+			keyFrames.positionKeyFrames.setKey(1.f, vec3f(float(iAnim), 1.f, 0.f));
+		}
+	}
+
+	model.computeNodesOrder();
+}
+
+void makeRandomCharacterModel(Model& model, const int numNodes) {
+	std::mt19937 rng(42);
+	std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		const int newNode = model.makeNewNode();
+		model.nodeAt(newNode)->staticLocalTransform =
+		    transf3d(vec3f(dist(rng), 1.f, dist(rng)), quatf::getAxisAngle(vec3f::getAxis(iNode % 3), dist(rng)), vec3f(1.f));
+
+		// Attach every node to one of the previous nodes.
+		if (iNode > 0) {
+			const int parent = std::uniform_int_distribution<int>(0, iNode - 1)(rng);
+			model.nodeAt(parent)->childNodes.push_back(newNode);
+		}
+	}
+	model.setRootNodeIndex(0);
+
+	const int iMesh = model.makeNewMesh();
+	model.meshAt(iMesh)->aabox = AABox3f(vec3f(-1.f), vec3f(1.f));
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		model.meshAt(iMesh)->bones.push_back(ModelMeshBone(mat4f::getTranslation(0.f, -float(iNode), 0.f), iNode));
+	}
+	model.nodeAt(0)->meshAttachments.push_back(MeshAttachment(iMesh, -1));
+
+	for (int iAnim = 0; iAnim < 2; ++iAnim) {
+		ModelAnimation& anim = *model.animationAt(model.makeNewAnim());
+		anim.durationSec = 1.f;
+		for (int iNode = 0; iNode < numNodes; ++iNode) {
+			KeyFrames& keyFrames = anim.getOrAddKeyFramesForNode(iNode);
+			for (int iKey = 0; iKey <= 30; ++iKey) {
+				const float time = float(iKey) / 30.f;
+				keyFrames.positionKeyFrames.setKey(time, vec3f(dist(rng), 1.f, dist(rng)));
+				keyFrames.rotationKeyFrames.setKey(time, quatf::getAxisAngle(vec3f::getAxis((iNode + iAnim) % 3), dist(rng)));
+			}
+		}
+	}
+
+	model.computeNodesOrder();
+}
+
+void makeHandModel(Model& model, const int numFingers) {
+	const int numNodes = 4 + numFingers;
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		const int newNode = model.makeNewNode();
+		model.nodeAt(newNode)->staticLocalTransform = transf3d(vec3f(0.f, 1.f, 0.f), quatf::getIdentity(), vec3f(1.f));
+		const int parent = iNode < 4 ? iNode - 1 : 3;
+		if (parent >= 0) {
+			model.nodeAt(parent)->childNodes.push_back(newNode);
+		}
+	}
+	model.setRootNodeIndex(0);
+
+	std::vector<SkinnedVertex> vertices;
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		const int numVertices = iNode < 4 ? 100 : 1;
+		for (int iVertex = 0; iVertex < numVertices; ++iVertex) {
+			SkinnedVertex v;
+			v.position = vec3f(0.f, float(iNode), 0.f);
+			v.bonesIds[0] = iNode;
+			v.bonesIds[1] = v.bonesIds[2] = v.bonesIds[3] = -1;
+			v.bonesWeights[0] = 1.f;
+			v.bonesWeights[1] = v.bonesWeights[2] = v.bonesWeights[3] = 0.f;
+			vertices.push_back(v);
+		}
+	}
+
+	ModelMesh& mesh = *model.meshAt(model.makeNewMesh());
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_position", UniformType::Float3, 0));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_bonesIds", UniformType::Int4, 12));
+	mesh.vertexDecl.push_back(VertexDecl(0, "a_bonesWeights", UniformType::Float4, 28));
+	mesh.stride = sizeof(SkinnedVertex);
+	mesh.vbPositionOffsetBytes = 0;
+	mesh.vbBonesIdsBytesOffset = 12;
+	mesh.vbBonesWeightsByteOffset = 28;
+	mesh.numVertices = int(vertices.size());
+	mesh.numElements = int(vertices.size());
+	mesh.vertexBufferRaw = std::vector<char>((const char*)vertices.data(), (const char*)(vertices.data() + vertices.size()));
+	mesh.aabox = AABox3f(vec3f(-1.f), vec3f(1.f, float(numNodes), 1.f));
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		mesh.bones.push_back(ModelMeshBone(mat4f::getTranslation(0.f, -float(iNode), 0.f), iNode));
+	}
+	model.nodeAt(0)->meshAttachments.push_back(MeshAttachment(0, -1));
+
+	ModelAnimation& anim = *model.animationAt(model.makeNewAnim());
+	anim.durationSec = 1.f;
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		KeyFrames& keyFrames = anim.getOrAddKeyFramesForNode(iNode);
+		for (int iKey = 0; iKey <= 30; ++iKey) {
+			const float time = float(iKey) / 30.f;
+			keyFrames.positionKeyFrames.setKey(time, vec3f(time, 1.f, float(iNode) * 0.1f));
+			keyFrames.rotationKeyFrames.setKey(time, quatf::getAxisAngle(vec3f::getAxis(iNode % 3), time * 2.f));
+		}
+	}
+
+	model.computeNodesOrder();
+	model.computeNodesImportance();
+}
+
+void makeArmModel(Model& model) {
+	const int hand = model.makeNewNode();
+	const int root = model.makeNewNode();
+	const int forearm = model.makeNewNode();
+	const int head = model.makeNewNode();
+	const int arm = model.makeNewNode();
+
+	model.setRootNodeIndex(root);
+	model.nodeAt(root)->childNodes = {arm, head};
+	model.nodeAt(arm)->childNodes = {forearm};
+	model.nodeAt(forearm)->childNodes = {hand};
+
+	model.nodeAt(root)->staticLocalTransform = transf3d(vec3f(0.f, 1.f, 0.f), quatf::getIdentity(), vec3f(2.f));
+	model.nodeAt(arm)->staticLocalTransform = transf3d(vec3f(1.f, 0.f, 0.f), quatf::getAxisAngle(vec3f::getAxis(2), 0.3f), vec3f(1.f));
+	model.nodeAt(forearm)->staticLocalTransform = transf3d(vec3f(1.f, 0.f, 0.f), quatf::getAxisAngle(vec3f::getAxis(1), 0.5f), vec3f(1.f));
+	model.nodeAt(hand)->staticLocalTransform = transf3d(vec3f(0.5f, 0.f, 0.f), quatf::getIdentity(), vec3f(0.5f));
+	model.nodeAt(head)->staticLocalTransform = transf3d(vec3f(0.f, 1.f, 0.f), quatf::getIdentity(), vec3f(1.f));
+
+	// A skinned mesh attached to the root and a rigid one attached to the head.
+	const int skinnedMesh = model.makeNewMesh();
+	model.meshAt(skinnedMesh)->aabox = AABox3f(vec3f(-1.f), vec3f(1.f));
+	model.meshAt(skinnedMesh)->bones.push_back(ModelMeshBone(mat4f::getTranslation(-1.f, 0.f, 0.f), arm));
+	model.meshAt(skinnedMesh)->bones.push_back(ModelMeshBone(mat4f::getTranslation(-2.f, 0.f, 0.f), forearm));
+	model.meshAt(skinnedMesh)->bones.push_back(ModelMeshBone(mat4f::getTranslation(-2.5f, 0.f, 0.f), hand));
+	model.nodeAt(root)->meshAttachments.push_back(MeshAttachment(skinnedMesh, -1));
+
+	const int rigidMesh = model.makeNewMesh();
+	model.meshAt(rigidMesh)->aabox = AABox3f(vec3f(-0.25f), vec3f(0.25f));
+	model.nodeAt(head)->meshAttachments.push_back(MeshAttachment(rigidMesh, -1));
+
+	const int iAnim = model.makeNewAnim();
+	ModelAnimation& anim = *model.animationAt(iAnim);
+	anim.durationSec = 1.f;
+	KeyFrames& armKeys = anim.getOrAddKeyFramesForNode(arm);
+	armKeys.rotationKeyFrames.setKey(0.f, quatf::getAxisAngle(vec3f::getAxis(2), 0.f));
+	armKeys.rotationKeyFrames.setKey(1.f, quatf::getAxisAngle(vec3f::getAxis(2), 1.f));
+	KeyFrames& headKeys = anim.getOrAddKeyFramesForNode(head);
+	headKeys.positionKeyFrames.setKey(0.f, vec3f(0.f, 1.f, 0.f));
+	headKeys.positionKeyFrames.setKey(1.f, vec3f(0.f, 2.f, 1.f));
+	headKeys.scalingKeyFrames.setKey(0.f, vec3f(1.f));
+	headKeys.scalingKeyFrames.setKey(1.f, vec3f(3.f));
+}
+
+void makeTreeModel(Model& model) {
+	const int trunk = model.makeNewNode();
+	const int crown = model.makeNewNode();
+	model.nodeAt(trunk)->childNodes.push_back(crown);
+	model.nodeAt(crown)->staticLocalTransform = transf3d(vec3f(0.f, 2.f, 0.f), quatf::getIdentity(), vec3f(1.f));
+	model.setRootNodeIndex(trunk);
+
+	const char* const materialNames[2] = {"bark", "leaves"};
+	for (int iPart = 0; iPart < 2; ++iPart) {
+		const int iMaterial = model.makeNewMaterial();
+		model.materialAt(iMaterial)->name = materialNames[iPart];
+
+		const int iMesh = model.makeNewMesh();
+		model.meshAt(iMesh)->aabox = AABox3f(vec3f(-1.f), vec3f(1.f));
+		model.nodeAt(iPart == 0 ? trunk : crown)->meshAttachments.push_back(MeshAttachment(iMesh, iMaterial));
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace sge {
+struct Model;
+} // namespace sge
+
+// The models used by the tests of the animation and the evaluation of the models.
+// They are built in code, so the tests do not depend on the assets.
+
+/// A chain of nodes named from @nodeNames, each one @boneLength above its parent.
+void makeNamedChainModel(sge::Model& model, const std::vector<std::string>& nodeNames, const float boneLength);
+
+/// A chain of nodes with an animation sampled at 30fps, like the ones coming from the importer.
+/// The root moves far away, the other nodes have smooth curves with a few constant channels.
+void makeAnimatedChainModel(sge::Model& model, const int numNodes, const float durationSec);
+
+/// A model of two nodes with an "idle", "walk" and "jump" animation, each one second long.
+void makeCharacterModel(sge::Model& model);
+
+/// Creates a character-like skinned model, with a tree of @numNodes nodes and two animations affecting all nodes.
+void makeRandomCharacterModel(sge::Model& model, const int numNodes);
+
+/// A body of 4 nodes in a chain (0-1-2-3) moving most of the vertices and @numFingers small fingers attached to the last one,
+/// each moving a single vertex. All nodes are animated.
+void makeHandModel(sge::Model& model, const int numFingers = 4);
+
+/// Creates a model with the following hierarchy and an animation affecting some of the nodes:
+///   root
+///     - arm
+///        - forearm
+///           - hand
+///     - head
+/// The nodes are created in an order different from the hierarchy, so the evaluation order isn't the trivial one.
+void makeArmModel(sge::Model& model);
+
+/// A tree with a trunk and a crown node, each with its own mesh and material.
+void makeTreeModel(sge::Model& model);
@@ -0,0 +1,246 @@
+#include "sge_core/TextureStreamingPolicy.h"
+#include "doctest/doctest.h"
+
+#include <vector>
+
+using namespace sge;
+
+namespace {
+
+/// Fills the mip sizes of a square RGBA8 texture with the specified size of its most detailed mip.
+std::vector<size_t> makeMipSizes(const int textureSize, int& outNumMips) {
+	std::vector<size_t> mipSizes;
+	for (int size = textureSize; size >= 1; size /= 2) {
+		mipSizes.push_back(size_t(size) * size_t(size) * 4);
+	}
+	outNumMips = int(mipSizes.size());
+	return mipSizes;
+}
+
+/// Simulates a camera at the specified distance from an object with a texture, the object covers 1024 pixels at distance 1.
+void simulateFrame(TextureStreamingPolicy& policy, const int textureId, const int textureSize, const int numMips, const float distance) {
+	const float screenSizePixels = 1024.f / distance;
+	policy.requestMip(textureId, TextureStreamingPolicy::computeRequiredMip(textureSize, screenSizePixels, numMips));
+
+	std::vector<TextureStreamingPolicy::ResidencyChange> changes;
+	policy.update(changes);
+}
+
+} // namespace
+
+TEST_CASE("TextureStreamingPolicy Required mip from screen size") {
+	CHECK(TextureStreamingPolicy::computeRequiredMip(1024, 1024.f, 11) == 0);
+	CHECK(TextureStreamingPolicy::computeRequiredMip(1024, 2048.f, 11) == 0);
+	CHECK(TextureStreamingPolicy::computeRequiredMip(1024, 512.f, 11) == 1);
+	CHECK(TextureStreamingPolicy::computeRequiredMip(1024, 300.f, 11) == 1);
+	CHECK(TextureStreamingPolicy::computeRequiredMip(1024, 256.f, 11) == 2);
+	CHECK(TextureStreamingPolicy::computeRequiredMip(1024, 0.1f, 11) == 10);
+	CHECK(TextureStreamingPolicy::computeRequiredMip(1024, 0.f, 11) == 10);
+	CHECK(TextureStreamingPolicy::computeRequiredMip(1024, 1.f, 1) == 0);
+}
+
+TEST_CASE("TextureStreamingPolicy Camera approaching and moving away") {
+	int numMips = 0;
+	const std::vector<size_t> mipSizes = makeMipSizes(1024, numMips);
+
+	TextureStreamingPolicy policy;
+	policy.settings.maxStreamInBytesPerUpdate = 64 * 1024 * 1024;
+	policy.settings.evictionDelayFrames = 10;
+
+	// Only the 64x64 and smaller mips are always resident.
+	const int textureId = policy.addTexture(mipSizes.data(), numMips, 7, numMips - 7);
+	CHECK(policy.getMostDetailedResidentMip(textureId) == 4);
+	const size_t initialBytes = policy.getResidentBytes();
+
+	// Far away the always resident mips are enough.
+	simulateFrame(policy, textureId, 1024, numMips, 100.f);
+	CHECK(policy.getMostDetailedResidentMip(textureId) == 4);
+
+	// The camera approaches the object, the more detailed mips get streamed in.
+	int lastMip = policy.getMostDetailedResidentMip(textureId);
+	for (float distance = 100.f; distance >= 1.f; distance *= 0.8f) {
+		simulateFrame(policy, textureId, 1024, numMips, distance);
+		const int mip = policy.getMostDetailedResidentMip(textureId);
+		CHECK(mip <= lastMip);
+		lastMip = mip;
+	}
+	simulateFrame(policy, textureId, 1024, numMips, 1.f);
+	CHECK(policy.getMostDetailedResidentMip(textureId) == 0);
+
+	size_t totalBytes = 0;
+	for (const size_t size : mipSizes) {
+		totalBytes += size;
+	}
+	CHECK(policy.getResidentBytes() == totalBytes);
+
+	// The camera moves away quickly, the mips are kept for the eviction delay and then they get evicted.
+	for (int iFrame = 0; iFrame < 10; ++iFrame) {
+		simulateFrame(policy, textureId, 1024, numMips, 100.f);
+		CHECK(policy.getMostDetailedResidentMip(textureId) == 0);
+	}
+
+	for (int iFrame = 0; iFrame < 2; ++iFrame) {
+		simulateFrame(policy, textureId, 1024, numMips, 100.f);
+	}
+	CHECK(policy.getMostDetailedResidentMip(textureId) == 4);
+	CHECK(policy.getResidentBytes() == initialBytes);
+}
+
+TEST_CASE("TextureStreamingPolicy Camera going back and forth does not cause streaming") {
+	int numMips = 0;
+	const std::vector<size_t> mipSizes = makeMipSizes(512, numMips);
+
+	TextureStreamingPolicy policy;
+	policy.settings.evictionDelayFrames = 30;
+	const int textureId = policy.addTexture(mipSizes.data(), numMips, 4, numMips - 4);
+
+	// Get the texture fully resident.
+	for (int iFrame = 0; iFrame < 10; ++iFrame) {
+		simulateFrame(policy, textureId, 512, numMips, 1.f);
+	}
+	REQUIRE(policy.getMostDetailedResidentMip(textureId) == 0);
+
+	// Oscillate between close and far, faster than the eviction delay. Nothing should change.
+	std::vector<TextureStreamingPolicy::ResidencyChange> changes;
+	for (int iFrame = 0; iFrame < 200; ++iFrame) {
+		const float distance = ((iFrame / 20) % 2 == 0) ? 50.f : 1.f;
+		policy.requestMip(textureId, TextureStreamingPolicy::computeRequiredMip(512, 1024.f / distance, numMips));
+		policy.update(changes);
+		CHECK(changes.empty());
+	}
+}
+
+TEST_CASE("TextureStreamingPolicy Budget pressure degrades evenly") {
+	int numMips = 0;
+	const std::vector<size_t> mipSizes = makeMipSizes(1024, numMips);
+
+	TextureStreamingPolicy policy;
+	policy.settings.maxStreamInBytesPerUpdate = 1024 * 1024 * 1024;
+
+	const int kNumTextures = 8;
+	std::vector<int> textureIds;
+	for (int t = 0; t < kNumTextures; ++t) {
+		textureIds.push_back(policy.addTexture(mipSizes.data(), numMips, 5, numMips - 5));
+	}
+
+	// The full texture is ~5.6MB, all of them do not fit in the budget, but all of them fit with mip 1 (~1.4MB) as most detailed.
+	policy.settings.budgetBytes = 12 * 1024 * 1024;
+
+	// The camera is close to all objects.
+	for (int iFrame = 0; iFrame < 5; ++iFrame) {
+		for (const int id : textureIds) {
+			policy.requestMip(id, 0);
+		}
+		std::vector<TextureStreamingPolicy::ResidencyChange> changes;
+		policy.update(changes);
+		CHECK(policy.getResidentBytes() <= policy.settings.budgetBytes);
+	}
+
+	// All textures should have lost around the same amount of detail.
+	int minMip = numMips;
+	int maxMip = 0;
+	for (const int id : textureIds) {
+		minMip = std::min(minMip, policy.getMostDetailedResidentMip(id));
+		maxMip = std::max(maxMip, policy.getMostDetailedResidentMip(id));
+	}
+	CHECK(minMip >= 1);
+	CHECK(maxMip - minMip <= 1);
+
+	// The textures that need less detail should keep it while the rest gets degraded.
+	for (int iFrame = 0; iFrame < 5; ++iFrame) {
+		for (int t = 0; t < kNumTextures; ++t) {
+			policy.requestMip(textureIds[t], t == 0 ? 0 : 3);
+		}
+		std::vector<TextureStreamingPolicy::ResidencyChange> changes;
+		policy.update(changes);
+	}
+
+	for (int iFrame = 0; iFrame < 100; ++iFrame) {
+		for (int t = 0; t < kNumTextures; ++t) {
+			policy.requestMip(textureIds[t], t == 0 ? 0 : 3);
+		}
+		std::vector<TextureStreamingPolicy::ResidencyChange> changes;
+		policy.update(changes);
+		CHECK(policy.getResidentBytes() <= policy.settings.budgetBytes);
+	}
+
+	CHECK(policy.getMostDetailedResidentMip(textureIds[0]) == 0);
+	for (int t = 1; t < kNumTextures; ++t) {
+		CHECK(policy.getMostDetailedResidentMip(textureIds[t]) == 3);
+	}
+}
+
+TEST_CASE("TextureStreamingPolicy Stream in limit per update") {
+	int numMips = 0;
+	const std::vector<size_t> mipSizes = makeMipSizes(1024, numMips);
+
+	TextureStreamingPolicy policy;
+	policy.settings.maxStreamInBytesPerUpdate = 1024 * 1024; // Mip 1 is exactly that big.
+
+	const int textureA = policy.addTexture(mipSizes.data(), numMips, 1, numMips - 1);
+	const int textureB = policy.addTexture(mipSizes.data(), numMips, 1, numMips - 1);
+
+	std::vector<TextureStreamingPolicy::ResidencyChange> changes;
+	int numUpdates = 0;
+	while (policy.getMostDetailedResidentMip(textureA) != 0 || policy.getMostDetailedResidentMip(textureB) != 0) {
+		policy.requestMip(textureA, 0);
+		policy.requestMip(textureB, 0);
+
+		const size_t bytesBefore = policy.getResidentBytes();
+		policy.update(changes);
+		const size_t streamedIn = policy.getResidentBytes() - bytesBefore;
+
+		// At least one mip gets streamed in, even if it is bigger than the limit.
+		CHECK(streamedIn > 0);
+		CHECK((streamedIn <= policy.settings.maxStreamInBytesPerUpdate || changes.size() == 1));
+
+		// The evictions and stream-ins are always towards the target.
+		for (const TextureStreamingPolicy::ResidencyChange& change : changes) {
+			CHECK(change.newMostDetailedMip < change.oldMostDetailedMip);
+		}
+
+		numUpdates++;
+		REQUIRE(numUpdates < 100);
+	}
+
+	// The 4MB mip 0 of each texture needs its own update, and the rest fit in an update per texture.
+	CHECK(numUpdates >= 4);
+
+	// Removing a texture releases its memory.
+	const size_t bytesWithBoth = policy.getResidentBytes();
+	policy.removeTexture(textureB);
+	CHECK(policy.getNumTextures() == 1);
+	CHECK(policy.getResidentBytes() == bytesWithBoth / 2);
+}
+
+TEST_CASE("TextureStreamingPolicy Textures that were never requested keep their detail") {
+	int numMips = 0;
+	const std::vector<size_t> mipSizes = makeMipSizes(1024, numMips);
+
+	TextureStreamingPolicy policy;
+	policy.settings.evictionDelayFrames = 10;
+
+	// Both textures are fully resident, but only the first one fits in the budget.
+	const int textureRequested = policy.addTexture(mipSizes.data(), numMips, 5, 0);
+	const int textureNotRequested = policy.addTexture(mipSizes.data(), numMips, 5, 0);
+	policy.settings.budgetBytes = 6 * 1024 * 1024;
+
+	std::vector<TextureStreamingPolicy::ResidencyChange> changes;
+	for (int iFrame = 0; iFrame < 20; ++iFrame) {
+		policy.requestMip(textureRequested, 0);
+		policy.update(changes);
+	}
+
+	// Only the requested texture is affected by the budget.
+	CHECK(policy.getMostDetailedResidentMip(textureNotRequested) == 0);
+	CHECK(policy.getMostDetailedResidentMip(textureRequested) > 0);
+
+	// After the first request the texture gets streamed like any other.
+	for (int iFrame = 0; iFrame < 20; ++iFrame) {
+		policy.requestMip(textureRequested, 0);
+		policy.requestMip(textureNotRequested, numMips - 1);
+		policy.update(changes);
+	}
+	CHECK(policy.getMostDetailedResidentMip(textureNotRequested) == numMips - 5);
+	CHECK(policy.getMostDetailedResidentMip(textureRequested) == 0);
+}
@@ -68,10 +68,17 @@ void Actor::setOrientation(const quatf& r, bool killVelocity) {
 	setTransform(newTr, killVelocity);
 }
 
+void Actor::markBBoxDirty() {
+	if (getWorld()) {
+		getWorld()->m_actorsSpatialIndex.markActorDirty(getId());
+	}
+}
+
 void Actor::setTransformEx(const transf3d& newTransform, bool killVelocity, bool recomputeBinding, bool shouldChangeRigidBodyTransform) {
 	transf3d oldTransform = m_logicTransform;
 	m_isTrasformAsMtxValid = false;
 	m_logicTransform = newTransform;
+	getWorld()->m_actorsSpatialIndex.markActorDirty(getId());
 
 	if (shouldChangeRigidBodyTransform) {
 		TraitRigidBody* const traitRB = getTrait<TraitRigidBody>(this);
@@ -48,6 +48,10 @@ struct SGE_ENGINE_API Actor : public GameObject {
 	// This should be used for the editor and the rendering.
 	virtual AABox3f getBBoxOS() const = 0;
 
+	// Should be called when the bounding box changes without the transform changing (for example the 3D model has changed),
+	// so the spatial index of the world recomputes the box in its next update.
+	void markBBoxDirty();
+
 	virtual int getNumItemsInMode(EditMode const mode) const {
 		if (mode == editMode_actors)
 			return 1;
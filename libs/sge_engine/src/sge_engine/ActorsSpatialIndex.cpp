@@ -0,0 +1,267 @@
+#include <algorithm>
+
+#include "ActorsSpatialIndex.h"
+#include "sge_engine/Actor.h"
+#include "sge_engine/GameWorld.h"
+
+namespace sge {
+
+namespace {
+	/// The number of updates an actor needs to stay still in order to return to the static partition.
+	const int kUpdatesToBecomeStatic = 120;
+
+	/// The number of actors whose boxes get recomputed on every update even if no change was reported for them.
+	const int kNumActorsToRevalidatePerUpdate = 64;
+
+	/// The maximum number of changes of the static partition kept between the flushes, the rest get merged.
+	const int kMaxStaticChanges = 1024;
+
+	bool areBoxesEqual(const AABox3f& a, const AABox3f& b) {
+		if (a.IsEmpty() || b.IsEmpty()) {
+			return a.IsEmpty() == b.IsEmpty();
+		}
+		return a.min == b.min && a.max == b.max;
+	}
+} // namespace
+
+void ActorsSpatialIndex::clear() {
+	m_entries.clear();
+	m_allActors.clear();
+	m_nextActorToRevalidate = 0;
+	m_dirtyActors.clear();
+	m_dynamicActors.clear();
+	m_unboundedActors.clear();
+	m_staticTree.clear();
+	m_dynamicTree.clear();
+	m_numUpdates = 0;
+	m_staticChangesWs.clear();
+	m_areAllStaticChanged = true;
+}
+
+AABox3f ActorsSpatialIndex::computeActorBoundsWs(const Actor* const actor) {
+	const AABox3f bboxOS = actor->getBBoxOS();
+	if (bboxOS.IsEmpty()) {
+		return AABox3f();
+	}
+
+	return bboxOS.getTransformed(actor->getTransformMtx());
+}
+
+void ActorsSpatialIndex::addActor(Actor* const actor) {
+	const ObjectId actorId = actor->getId();
+	if (m_entries.count(actorId) != 0) {
+		markActorDirty(actorId);
+		return;
+	}
+
+	Entry& entry = m_entries[actorId];
+	entry.boundsWs = computeActorBoundsWs(actor);
+	entry.lastChangeUpdate = m_numUpdates;
+	entry.indexInAllActors = int(m_allActors.size());
+	m_allActors.push_back(actorId);
+
+	addToPartition(actorId, entry, false);
+}
+
+void ActorsSpatialIndex::removeActor(const ObjectId& actorId) {
+	const auto itr = m_entries.find(actorId);
+	if (itr == m_entries.end()) {
+		return;
+	}
+
+	Entry& entry = itr->second;
+	removeFromPartition(actorId, entry);
+
+	// Swap-remove from the list of all actors.
+	const ObjectId lastActorId = m_allActors.back();
+	m_allActors[entry.indexInAllActors] = lastActorId;
+	m_entries[lastActorId].indexInAllActors = entry.indexInAllActors;
+	m_allActors.pop_back();
+
+	// The dirty list may still reference the actor, @update skips the ids that aren't in the index anymore.
+	m_entries.erase(itr);
+}
+
+void ActorsSpatialIndex::markActorDirty(const ObjectId& actorId) {
+	const auto itr = m_entries.find(actorId);
+	if (itr != m_entries.end() && itr->second.isDirty == false) {
+		itr->second.isDirty = true;
+		m_dirtyActors.push_back(actorId);
+	}
+}
+
+bool ActorsSpatialIndex::isActorDynamic(const ObjectId& actorId) const {
+	const auto itr = m_entries.find(actorId);
+	return itr != m_entries.end() && itr->second.isDynamic;
+}
+
+bool ActorsSpatialIndex::isActorStatic(const ObjectId& actorId) const {
+	const auto itr = m_entries.find(actorId);
+	return itr != m_entries.end() && itr->second.isDynamic == false && itr->second.proxyId != DynamicAABBTree::kNullNode;
+}
+
+void ActorsSpatialIndex::addStaticChange(const AABox3f& boundsWs) {
+	if (m_areAllStaticChanged) {
+		return;
+	}
+
+	if (int(m_staticChangesWs.size()) >= kMaxStaticChanges) {
+		AABox3f merged = boundsWs;
+		for (const AABox3f& box : m_staticChangesWs) {
+			merged.expand(box);
+		}
+		m_staticChangesWs.clear();
+		m_staticChangesWs.push_back(merged);
+		return;
+	}
+
+	m_staticChangesWs.push_back(boundsWs);
+}
+
+void ActorsSpatialIndex::flushStaticChanges(ShadowCacheInvalidator& invalidator) {
+	if (m_areAllStaticChanged) {
+		invalidator.invalidateAll();
+	} else {
+		for (const AABox3f& box : m_staticChangesWs) {
+			invalidator.addDirtyBounds(box);
+		}
+	}
+
+	m_staticChangesWs.clear();
+	m_areAllStaticChanged = false;
+}
+
+void ActorsSpatialIndex::removeFromPartition(const ObjectId& actorId, Entry& entry) {
+	if (entry.proxyId == DynamicAABBTree::kNullNode) {
+		m_unboundedActors.eraseKey(actorId);
+		return;
+	}
+
+	if (entry.isDynamic) {
+		m_dynamicTree.destroyProxy(entry.proxyId);
+		const auto itrDynamic = std::find(m_dynamicActors.begin(), m_dynamicActors.end(), actorId);
+		if (itrDynamic != m_dynamicActors.end()) {
+			*itrDynamic = m_dynamicActors.back();
+			m_dynamicActors.pop_back();
+		}
+	} else {
+		m_staticTree.destroyProxy(entry.proxyId);
+		addStaticChange(entry.boundsWs);
+	}
+
+	entry.proxyId = DynamicAABBTree::kNullNode;
+	entry.isDynamic = false;
+}
+
+void ActorsSpatialIndex::addToPartition(const ObjectId& actorId, Entry& entry, const bool isDynamic) {
+	if (entry.boundsWs.IsEmpty()) {
+		entry.proxyId = DynamicAABBTree::kNullNode;
+		entry.isDynamic = false;
+		m_unboundedActors.add(actorId);
+		return;
+	}
+
+	entry.isDynamic = isDynamic;
+	if (isDynamic) {
+		entry.proxyId = m_dynamicTree.createProxy(entry.boundsWs, actorId.id);
+		m_dynamicActors.push_back(actorId);
+	} else {
+		entry.proxyId = m_staticTree.createProxy(entry.boundsWs, actorId.id);
+		addStaticChange(entry.boundsWs);
+	}
+}
+
+void ActorsSpatialIndex::refreshActor(const ObjectId& actorId, Entry& entry, const Actor* const actor, const bool isReportedChange) {
+	const AABox3f newBoundsWs = computeActorBoundsWs(actor);
+	const bool isBoxSame = areBoxesEqual(newBoundsWs, entry.boundsWs);
+	if (isBoxSame && (isReportedChange == false || entry.proxyId == DynamicAABBTree::kNullNode)) {
+		return;
+	}
+
+	entry.lastChangeUpdate = m_numUpdates;
+
+	// Moving actors keep their proxy in the dynamic tree, the fat boxes make most of the moves free.
+	if (entry.isDynamic && newBoundsWs.IsEmpty() == false) {
+		if (isBoxSame == false) {
+			entry.boundsWs = newBoundsWs;
+			m_dynamicTree.moveProxy(entry.proxyId, newBoundsWs);
+		}
+		return;
+	}
+
+	// The actor has just started moving (or got/lost its bounding box).
+	// The old box is still needed for reporting the change of the static partition.
+	removeFromPartition(actorId, entry);
+	entry.boundsWs = newBoundsWs;
+	addToPartition(actorId, entry, true);
+}
+
+void ActorsSpatialIndex::update(GameWorld& world) {
+	m_numUpdates++;
+
+	// The actors reported as changed.
+	for (const ObjectId& actorId : m_dirtyActors) {
+		const auto itr = m_entries.find(actorId);
+		if (itr == m_entries.end()) {
+			continue;
+		}
+
+		itr->second.isDirty = false;
+		if (const Actor* const actor = world.getActorById(actorId)) {
+			refreshActor(actorId, itr->second, actor, true);
+		}
+	}
+	m_dirtyActors.clear();
+
+	// A few actors on every update, so changes of the bounding boxes that weren't reported still get picked up.
+	const int numToRevalidate = std::min(kNumActorsToRevalidatePerUpdate, int(m_allActors.size()));
+	for (int t = 0; t < numToRevalidate; ++t) {
+		if (m_nextActorToRevalidate >= int(m_allActors.size())) {
+			m_nextActorToRevalidate = 0;
+		}
+
+		const ObjectId actorId = m_allActors[m_nextActorToRevalidate++];
+		if (const Actor* const actor = world.getActorById(actorId)) {
+			refreshActor(actorId, m_entries[actorId], actor, false);
+		}
+	}
+
+	// Actors that stopped moving return to the static partition with their exact boxes.
+	for (int iDynamic = 0; iDynamic < int(m_dynamicActors.size());) {
+		const ObjectId actorId = m_dynamicActors[iDynamic];
+		Entry& entry = m_entries[actorId];
+		if (m_numUpdates - entry.lastChangeUpdate >= kUpdatesToBecomeStatic) {
+			// Removes the actor from @m_dynamicActors by swapping it with the last one.
+			removeFromPartition(actorId, entry);
+			addToPartition(actorId, entry, false);
+		} else {
+			++iDynamic;
+		}
+	}
+}
+
+void ActorsSpatialIndex::queryFrustum(const Frustum& frustum,
+                                      std::vector<ObjectId>& outActors,
+                                      const bool includeStatic,
+                                      const bool includeDynamic) {
+	m_queryResult.clear();
+	if (includeStatic) {
+		m_staticTree.queryFrustum(frustum, m_queryResult);
+	}
+
+	if (includeDynamic) {
+		m_dynamicTree.queryFrustum(frustum, m_queryResult);
+	}
+
+	for (const int id : m_queryResult) {
+		outActors.push_back(ObjectId(id));
+	}
+
+	if (includeDynamic) {
+		for (const ObjectId& actorId : m_unboundedActors) {
+			outActors.push_back(actorId);
+		}
+	}
+}
+
+} // namespace sge
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "sge_core/ShadowCacheInvalidator.h"
+#include "sge_engine/GameObject.h"
+#include "sge_engine/sge_engine_api.h"
+#include "sge_utils/math/DynamicAABBTree.h"
+#include "sge_utils/utils/vector_set.h"
+
+namespace sge {
+
+struct Actor;
+struct GameWorld;
+
+/// @brief Keeps the world space bounding boxes of all playing actors in bounding volume hierarchies, so the drawing
+/// could visit only the actors in the view instead of all actors in the world.
+/// The actors are split in two partitions:
+///   - static: actors that haven't moved recently, stored with their exact boxes.
+///   - dynamic: actors that moved recently, stored with fat boxes so small moves don't change the tree.
+/// An actor moves to the dynamic partition when its box changes and returns to the static one after it stays still for a while.
+/// Actors without a bounding box are always considered visible.
+///
+/// The boxes get updated from the transform changes (see @markActorDirty), the box changes reported by the actors and their traits
+/// (see @Actor::markBBoxDirty) and the evaluation of animated models. A few actors are also revalidated on every update,
+/// only as a safety net for changes that weren't reported.
+/// The reported changes move the actor to the dynamic partition even if its box stayed the same, as the actor might look different
+/// (for example an animated model). This way the static partition could be used for caching the shadow maps (see @flushStaticChanges).
+struct SGE_ENGINE_API ActorsSpatialIndex {
+	/// Removes all actors.
+	void clear();
+
+	/// Adds a playing actor to the index.
+	void addActor(Actor* const actor);
+
+	/// Removes an actor that is no longer playing.
+	void removeActor(const ObjectId& actorId);
+
+	/// @brief Marks the actor as changed, its bounding box gets recomputed in the next @update.
+	/// Ids of actors that aren't in the index are ignored.
+	void markActorDirty(const ObjectId& actorId);
+
+	/// Updates the boxes of the changed actors and moves the actors between the partitions.
+	void update(GameWorld& world);
+
+	/// @brief Appends the ids of the actors whose box isn't outside of the frustum and the ids of all actors without a box.
+	/// @param [in] includeStatic, includeDynamic which partitions to visit, the actors without a box are part of the dynamic one.
+	void queryFrustum(const Frustum& frustum,
+	                  std::vector<ObjectId>& outActors,
+	                  const bool includeStatic = true,
+	                  const bool includeDynamic = true);
+
+	int getNumActors() const { return int(m_allActors.size()); }
+	int getNumStaticActors() const { return m_staticTree.getNumProxies(); }
+	int getNumDynamicActors() const { return m_dynamicTree.getNumProxies(); }
+	int getNumUnboundedActors() const { return int(m_unboundedActors.size()); }
+
+	/// Returns true if the actor is in the dynamic partition.
+	bool isActorDynamic(const ObjectId& actorId) const;
+
+	/// Returns true if the actor has a bounding box and is in the static partition.
+	bool isActorStatic(const ObjectId& actorId) const;
+
+	/// Reports the boxes where the static partition changed since the last call to the invalidator.
+	/// The static partition changes when actors get added, removed or move between the partitions.
+	void flushStaticChanges(ShadowCacheInvalidator& invalidator);
+
+	/// Computes the world space bounding box of the actor, empty if the actor has no bounding box.
+	static AABox3f computeActorBoundsWs(const Actor* const actor);
+
+  private:
+	struct Entry {
+		/// The exact bounding box in world space used the last time the actor was updated.
+		AABox3f boundsWs;
+		int proxyId = DynamicAABBTree::kNullNode;
+		bool isDynamic = false;
+		bool isDirty = false;
+		/// The value of @m_numUpdates when the box of the actor changed the last time.
+		int lastChangeUpdate = 0;
+		/// The index of the actor in @m_allActors.
+		int indexInAllActors = -1;
+	};
+
+	/// @param [in] isReportedChange true if the change was reported via @markActorDirty, the actor becomes dynamic
+	///             even if its box is the same.
+	void refreshActor(const ObjectId& actorId, Entry& entry, const Actor* const actor, const bool isReportedChange);
+	void addStaticChange(const AABox3f& boundsWs);
+	void removeFromPartition(const ObjectId& actorId, Entry& entry);
+	void addToPartition(const ObjectId& actorId, Entry& entry, const bool isDynamic);
+
+  private:
+	std::unordered_map<ObjectId, Entry> m_entries;
+
+	/// All actors in the index, used for revalidating a few of them on every update.
+	std::vector<ObjectId> m_allActors;
+	int m_nextActorToRevalidate = 0;
+
+	std::vector<ObjectId> m_dirtyActors;
+	std::vector<ObjectId> m_dynamicActors;
+	vector_set<ObjectId> m_unboundedActors;
+
+	DynamicAABBTree m_staticTree = DynamicAABBTree(0.f);
+	DynamicAABBTree m_dynamicTree = DynamicAABBTree(0.5f);
+
+	int m_numUpdates = 0;
+	std::vector<int> m_queryResult;
+
+	/// The boxes where the static partition changed since the last @flushStaticChanges.
+	std::vector<AABox3f> m_staticChangesWs;
+	/// True if everything in the static partition should be considered changed, for example after @clear.
+	bool m_areAllStaticChanged = true;
+};
+
+} // namespace sge
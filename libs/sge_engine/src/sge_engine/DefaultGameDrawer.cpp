@@ -26,6 +26,7 @@
 #include "sge_utils/math/Frustum.h"
 #include "sge_utils/math/color.h"
 #include "sge_utils/utils/FileStream.h"
+#include "sge_utils/utils/hash_combine.h"
 
 // Caution:
 // this include is an exception do not include anything else like it.
@@ -47,6 +48,98 @@ struct AInvisibleRigidObstacle;
 
 void DefaultGameDrawer::prepareForNewFrame() {
 	m_shadingLights.clear();
+	m_clusteredLights.clear();
+	m_lightClustersCamera = nullptr;
+}
+
+/// Computes a box containing all casters that could affect the shadow map.
+static AABox3f computeShadowCastersVolumeWs(const ShadowMapBuildInfo& buildInfo) {
+	if (buildInfo.isPointLight) {
+		return AABox3f::getFromHalfDiagonal(vec3f(buildInfo.pointLightFarPlaneDistance),
+		                                    buildInfo.pointLightShadowMapCameras[0].getCameraPosition());
+	}
+
+	AABox3f result;
+	const auto expandWithCamera = [&result](const RawCamera& camera) -> void {
+		vec3f frustumCornersWs[8];
+		camera.getFrustumWS()->getCorners(frustumCornersWs);
+		for (const vec3f& corner : frustumCornersWs) {
+			result.expand(corner);
+		}
+	};
+
+	if (buildInfo.numCascades > 0) {
+		for (int iCascade = 0; iCascade < buildInfo.numCascades; ++iCascade) {
+			expandWithCamera(buildInfo.cascadeCameras[iCascade]);
+		}
+	} else {
+		expandWithCamera(buildInfo.shadowMapCamera);
+	}
+
+	return result;
+}
+
+/// Computes a hash of everything besides the casters that affects the shadow map.
+static uint64 computeShadowMapStateHash(const ShadowMapBuildInfo& buildInfo, const int resolution) {
+	uint64 hash = uint64(resolution);
+	const auto hashCamera = [&hash](const RawCamera& camera) -> void {
+		const mat4f projView = camera.getProjView();
+		hash = hash_combine(hash, uint64(hash_djb2(reinterpret_cast<const char*>(&projView), int(sizeof(projView)))));
+		// The frustum used for culling the casters could differ from the projection.
+		const Frustum& frustum = *camera.getFrustumWS();
+		hash = hash_combine(hash, uint64(hash_djb2(reinterpret_cast<const char*>(&frustum), int(sizeof(frustum)))));
+	};
+
+	if (buildInfo.isPointLight) {
+		for (const RawCamera& camera : buildInfo.pointLightShadowMapCameras) {
+			hashCamera(camera);
+		}
+	} else if (buildInfo.numCascades > 0) {
+		for (int iCascade = 0; iCascade < buildInfo.numCascades; ++iCascade) {
+			hashCamera(buildInfo.cascadeCameras[iCascade]);
+		}
+	} else {
+		hashCamera(buildInfo.shadowMapCamera);
+	}
+
+	return hash;
+}
+
+void DefaultGameDrawer::createPointLightShadowMap(const int resolution,
+                                                  GpuHandle<Texture>& outTexture,
+                                                  GpuHandle<FrameTarget> outFaceTargets[]) {
+	TextureDesc texDesc;
+	texDesc.textureType = UniformType::TextureCube;
+	texDesc.format = TextureFormat::D24_UNORM_S8_UINT;
+	texDesc.usage = TextureUsage::DepthStencilResource;
+	texDesc.textureCube.width = resolution;
+	texDesc.textureCube.height = resolution;
+	texDesc.textureCube.arraySize = 1;
+	texDesc.textureCube.numMips = 1;
+	texDesc.textureCube.sampleQuality = 0;
+	texDesc.textureCube.numSamples = 1;
+
+	outTexture = getCore()->getDevice()->requestResource<Texture>();
+	[[maybe_unused]] const bool succeeded = outTexture->create(texDesc, nullptr);
+	sgeAssert(succeeded);
+
+	for (int iSignedAxis = 0; iSignedAxis < signedAxis_numElements; ++iSignedAxis) {
+		// Destroy the prevously existing frame target for the face.
+		outFaceTargets[iSignedAxis].Release();
+
+		// Create the new one.
+		GpuHandle<FrameTarget>& faceFrameTarget = outFaceTargets[iSignedAxis];
+		faceFrameTarget = getCore()->getDevice()->requestResource<FrameTarget>();
+
+		TargetDesc faceTargetDesc;
+		faceTargetDesc.baseTextureType = UniformType::TextureCube;
+		faceTargetDesc.textureCube.face = SignedAxis(iSignedAxis);
+		faceTargetDesc.textureCube.mipLevel = 0;
+
+		[[maybe_unused]] const bool targetSucceeded = faceFrameTarget->create(0, nullptr, nullptr, outTexture, faceTargetDesc);
+
+		sgeAssert(targetSucceeded);
+	}
 }
 
 void DefaultGameDrawer::updateShadowMaps(const GameDrawSets& drawSets) {
@@ -55,9 +148,17 @@ void DefaultGameDrawer::updateShadowMaps(const GameDrawSets& drawSets) {
 		return;
 	}
 
+	// Invalidate the cached static layers of the shadow maps affected by the changes of the static casters.
+	getWorld()->m_actorsSpatialIndex.flushStaticChanges(m_shadowCacheInvalidator);
+	m_shadowCacheInvalidator.beginFrame();
+
 	ICamera* const gameCamera = drawSets.gameCamera;
 	const Frustum* const gameCameraFrustumWs = drawSets.gameCamera->getFrustumWS();
 
+	float gameCameraNear = 0.f;
+	float gameCameraFar = 0.f;
+	computeNearFarPlanes(gameCamera->getProj(), gameCameraNear, gameCameraFar);
+
 	// Compute All shadow maps.
 	for (const GameObject* const actorLight : *allLights) {
 		const ALight* const light = static_cast<const ALight*>(actorLight);
@@ -84,7 +185,7 @@ void DefaultGameDrawer::updateShadowMaps(const GameDrawSets& drawSets) {
 		}
 
 		// Retrieve the ShadowMapBuildInfo which tells us the cameras to be used for rendering the shadow map.
-		Optional<ShadowMapBuildInfo> shadowMapBuildInfoOpt = lightDesc.buildShadowMapInfo(light->getTransform(), *gameCameraFrustumWs);
+		Optional<ShadowMapBuildInfo> shadowMapBuildInfoOpt = lightDesc.buildShadowMapInfo(light->getTransform(), *gameCameraFrustumWs, gameCameraNear);
 		if (shadowMapBuildInfoOpt.isValid() == false) {
 			continue;
 		}
@@ -97,87 +198,69 @@ void DefaultGameDrawer::updateShadowMaps(const GameDrawSets& drawSets) {
 
 		lsi.buildInfo = shadowMapBuildInfoOpt.get();
 
+		const int shadowMapRes = lightDesc.shadowMapRes;
+		bool areShadowMapsRecreated = false;
+
 		// Create the appropriatley sized frame target for the shadow map.
 		if (isPointLight) {
 			// No regular shadow maps are needed so relese them.
 			lsi.frameTarget.Release();
-
-			const int shadowMapWidth = lightDesc.shadowMapRes;
-			const int shadowMapHegiht = lightDesc.shadowMapRes;
-
+			lsi.staticFrameTarget.Release();
 
 			const bool shouldCreateNewShadowMapTexture = lsi.pointLightDepthTexture.IsResourceValid() == false ||
 			                                             lsi.pointLightDepthTexture->getDesc().textureType != UniformType::TextureCube ||
-			                                             lsi.pointLightDepthTexture->getDesc().textureCube.width != shadowMapWidth ||
-			                                             lsi.pointLightDepthTexture->getDesc().textureCube.height != shadowMapHegiht;
+			                                             lsi.pointLightDepthTexture->getDesc().textureCube.width != shadowMapRes ||
+			                                             lsi.pointLightDepthTexture->getDesc().textureCube.height != shadowMapRes;
 
 			if (shouldCreateNewShadowMapTexture) {
-				TextureDesc texDesc;
-				texDesc.textureType = UniformType::TextureCube;
-				texDesc.format = TextureFormat::D24_UNORM_S8_UINT;
-				texDesc.usage = TextureUsage::DepthStencilResource;
-				texDesc.textureCube.width = shadowMapWidth;
-				texDesc.textureCube.height = shadowMapHegiht;
-				texDesc.textureCube.arraySize = 1;
-				texDesc.textureCube.numMips = 1;
-				texDesc.textureCube.sampleQuality = 0;
-				texDesc.textureCube.numSamples = 1;
-
-				lsi.pointLightDepthTexture = getCore()->getDevice()->requestResource<Texture>();
-				[[maybe_unused]] const bool succeeded = lsi.pointLightDepthTexture->create(texDesc, nullptr);
-				sgeAssert(succeeded);
-
-
-				for (int iSignedAxis = 0; iSignedAxis < SGE_ARRSZ(lsi.pointLightFrameTargets); ++iSignedAxis) {
-					// Destroy the prevously existing frame target for the face.
-					lsi.pointLightFrameTargets[iSignedAxis].Release();
-
-					// Create the new one.
-					GpuHandle<FrameTarget>& faceFrameTarget = lsi.pointLightFrameTargets[iSignedAxis];
-					faceFrameTarget = getCore()->getDevice()->requestResource<FrameTarget>();
-
-					TargetDesc faceTargetDesc;
-					faceTargetDesc.baseTextureType = UniformType::TextureCube;
-					faceTargetDesc.textureCube.face = SignedAxis(iSignedAxis);
-					faceTargetDesc.textureCube.mipLevel = 0;
-
-					[[maybe_unused]] const bool targetSucceeded =
-					    faceFrameTarget->create(0, nullptr, nullptr, lsi.pointLightDepthTexture, faceTargetDesc);
-
-					sgeAssert(targetSucceeded);
-				}
+				createPointLightShadowMap(shadowMapRes, lsi.pointLightDepthTexture, lsi.pointLightFrameTargets);
+				createPointLightShadowMap(shadowMapRes, lsi.staticPointLightDepthTexture, lsi.staticPointLightFrameTargets);
+				areShadowMapsRecreated = true;
 			}
 
 		} else {
 			// No point light frame targets are going to be needed so release them.
 			for (int t = 0; t < SGE_ARRSZ(lsi.pointLightFrameTargets); ++t) {
 				lsi.pointLightFrameTargets[t].Release();
+				lsi.staticPointLightFrameTargets[t].Release();
 			}
 
 			lsi.pointLightDepthTexture.Release();
+			lsi.staticPointLightDepthTexture.Release();
 
 			// Create the shadow map frame target (with texture) for the shadow map.
-			const int shadowMapWidth = lightDesc.shadowMapRes;
-			const int shadowMapHegiht = lightDesc.shadowMapRes;
-
+			// The cascades of the cascaded shadow maps are placed next to each other in the texture.
 			GpuHandle<FrameTarget>& shadowFrameTarget = lsi.frameTarget;
+			const int shadowMapWidth = shadowMapRes * maxOf(lsi.buildInfo.numCascades, 1);
 
 			const bool shouldCreateNewShadowMapTexture = shadowFrameTarget.IsResourceValid() == false ||
 			                                             shadowFrameTarget->getWidth() != shadowMapWidth ||
-			                                             shadowFrameTarget->getHeight() != shadowMapHegiht;
+			                                             shadowFrameTarget->getHeight() != shadowMapRes;
 
 			if (shouldCreateNewShadowMapTexture) {
 				// Caution, TODO: On Safari (the web browser) I've read that it needs a color render target.
 				// Keep that in mind when testing and developing.
 				shadowFrameTarget = getCore()->getDevice()->requestResource<FrameTarget>();
-				shadowFrameTarget->create2D(shadowMapWidth, shadowMapHegiht, TextureFormat::Unknown, TextureFormat::D24_UNORM_S8_UINT);
+				shadowFrameTarget->create2D(shadowMapWidth, shadowMapRes, TextureFormat::Unknown, TextureFormat::D24_UNORM_S8_UINT);
+
+				lsi.staticFrameTarget = getCore()->getDevice()->requestResource<FrameTarget>();
+				lsi.staticFrameTarget->create2D(shadowMapWidth, shadowMapRes, TextureFormat::Unknown, TextureFormat::D24_UNORM_S8_UINT);
+				areShadowMapsRecreated = true;
 			}
 		}
 
+		// The static casters are cached, find if they need to be drawn again.
+		const int lightIdForCache = light->getId().id;
+		if (areShadowMapsRecreated) {
+			m_shadowCacheInvalidator.removeLight(lightIdForCache);
+		}
+
+		const bool needsStaticRedraw = m_shadowCacheInvalidator.updateLight(
+		    lightIdForCache, computeShadowCastersVolumeWs(lsi.buildInfo), computeShadowMapStateHash(lsi.buildInfo, shadowMapRes));
 
 		// Draw the shadow map to the created frame target.
-		const auto drawShadowMapFromCamera = [this, &lsi](const RenderDestination& rendDest, ICamera* gameCamera,
-		                                                  ICamera* drawCamera) -> void {
+		const auto drawShadowMapFromCamera = [this, &lsi](const RenderDestination& rendDest, ICamera* gameCamera, ICamera* drawCamera,
+		                                                  const ShadowCasterLayer casterLayer) -> void {
 			GameDrawSets drawShadowSets;
 
 			drawShadowSets.gameCamera = gameCamera;
@@ -185,29 +268,58 @@ void DefaultGameDrawer::updateShadowMaps(const GameDrawSets& drawSets) {
 			drawShadowSets.rdest = rendDest;        // RenderDestination(getCore()->getDevice()->getContext(), resultFrameTarget);
 			drawShadowSets.quickDraw = &getCore()->getQuickDraw();
 			drawShadowSets.shadowMapBuildInfo = &lsi.buildInfo;
+			drawShadowSets.shadowCasterLayer = casterLayer;
 
 			drawWorld(drawShadowSets, drawReason_gameplayShadow);
 		};
 
+		// Draws the static casters in their cache if needed, copies it to the shadow map and draws the dynamic casters on top.
+		// Each camera draws in its own part of the frame targets, placed next to each other horizontally.
+		const auto drawShadowMapLayers = [&](FrameTarget* const shadowMapTarget, FrameTarget* const staticTarget,
+		                                     ICamera* const* const drawCameras, const int numDrawCameras) -> void {
+			SGEContext* const sgecon = getCore()->getDevice()->getContext();
+
+			const short viewportWidth = short(shadowMapTarget->getWidth() / numDrawCameras);
+			const short viewportHeight = short(shadowMapTarget->getHeight());
+			const auto getViewport = [&](const int iCamera) -> Rect2s {
+				return Rect2s(viewportWidth, viewportHeight, short(viewportWidth * iCamera), 0);
+			};
+
+			if (needsStaticRedraw) {
+				sgecon->clearColor(staticTarget, 0, vec4f(0.f).data);
+				sgecon->clearDepth(staticTarget, 1.f);
+				for (int iCamera = 0; iCamera < numDrawCameras; ++iCamera) {
+					drawShadowMapFromCamera(RenderDestination(sgecon, staticTarget, getViewport(iCamera)), gameCamera,
+					                        drawCameras[iCamera], shadowCasterLayer_static);
+				}
+			}
+
+			sgecon->clearColor(shadowMapTarget, 0, vec4f(0.f).data);
+			sgecon->copyDepth(shadowMapTarget, staticTarget);
+			for (int iCamera = 0; iCamera < numDrawCameras; ++iCamera) {
+				drawShadowMapFromCamera(RenderDestination(sgecon, shadowMapTarget, getViewport(iCamera)), gameCamera,
+				                        drawCameras[iCamera], shadowCasterLayer_dynamic);
+			}
+		};
+
 		if (shadowMapBuildInfoOpt->isPointLight) {
 			for (int iSignedAxis = 0; iSignedAxis < signedAxis_numElements; ++iSignedAxis) {
-				// Clear the pre-existing state.
-				GpuHandle<FrameTarget>& faceFrameTarget = lsi.pointLightFrameTargets[iSignedAxis];
-				getCore()->getDevice()->getContext()->clearColor(faceFrameTarget, 0, vec4f(0.f).data);
-				getCore()->getDevice()->getContext()->clearDepth(faceFrameTarget, 1.f);
-
 				// Render the scene for the current face of the cube map.
-				RenderDestination rdest(getCore()->getDevice()->getContext(), faceFrameTarget);
-				drawShadowMapFromCamera(rdest, gameCamera, &shadowMapBuildInfoOpt->pointLightShadowMapCameras[iSignedAxis]);
+				ICamera* const faceCamera = &lsi.buildInfo.pointLightShadowMapCameras[iSignedAxis];
+				drawShadowMapLayers(lsi.pointLightFrameTargets[iSignedAxis], lsi.staticPointLightFrameTargets[iSignedAxis], &faceCamera, 1);
+			}
+		} else if (lsi.buildInfo.numCascades > 0) {
+			// Directional lights draw each cascade with its own camera, the casters get culled separately for each cascade.
+			ICamera* cascadeCameras[kMaxShadowCascades];
+			for (int iCascade = 0; iCascade < lsi.buildInfo.numCascades; ++iCascade) {
+				cascadeCameras[iCascade] = &lsi.buildInfo.cascadeCameras[iCascade];
 			}
-		} else {
-			// Clear the pre-existing state.
-			getCore()->getDevice()->getContext()->clearColor(lsi.frameTarget, 0, vec4f(0.f).data);
-			getCore()->getDevice()->getContext()->clearDepth(lsi.frameTarget, 1.f);
 
-			// Non-point lights have only one camera that uses the whole texture for storing the shadow map.
-			RenderDestination rdest(getCore()->getDevice()->getContext(), lsi.frameTarget);
-			drawShadowMapFromCamera(rdest, gameCamera, &shadowMapBuildInfoOpt->shadowMapCamera);
+			drawShadowMapLayers(lsi.frameTarget, lsi.staticFrameTarget, cascadeCameras, lsi.buildInfo.numCascades);
+		} else {
+			// Spot lights have only one camera that uses the whole texture for storing the shadow map.
+			ICamera* const shadowMapCamera = &lsi.buildInfo.shadowMapCamera;
+			drawShadowMapLayers(lsi.frameTarget, lsi.staticFrameTarget, &shadowMapCamera, 1);
 		}
 
 		lsi.isCorrectlyUpdated = true;
@@ -252,6 +364,10 @@ void DefaultGameDrawer::updateShadowMaps(const GameDrawSets& drawSets) {
 					shadingLight.shadowMap = lsi.frameTarget->getDepthStencil();
 					shadingLight.shadowMapProjView = lsi.buildInfo.shadowMapCamera.getProjView();
 					flags |= kLightFlg_HasShadowMap;
+
+					for (int iCascade = 0; iCascade < lsi.buildInfo.numCascades; ++iCascade) {
+						shadingLight.shadowCascades[iCascade] = lsi.buildInfo.cascadeNdcTransforms[iCascade];
+					}
 				}
 			}
 		}
@@ -260,32 +376,50 @@ void DefaultGameDrawer::updateShadowMaps(const GameDrawSets& drawSets) {
 		shadingLight.lightColorWFlags = vec4f(color, float(flags));
 		shadingLight.lightSpotDirAndCosAngle = vec4f(light->getTransformMtx().c0.xyz().normalized0(), spotLightCosAngle);
 		shadingLight.lightXShadowRange = vec4f(lightDesc.range, 0.f, 0.f, 0.f);
+		if ((flags & kLightFlg_HasShadowMap) != 0 && lsi.buildInfo.numCascades > 0) {
+			shadingLight.lightXShadowRange.y = float(lsi.buildInfo.numCascades);
+			shadingLight.lightXShadowRange.z = lsi.buildInfo.cascadesBlendFraction;
+		}
 
 		shadingLight.lightBoxWs = light->getBBoxOS().getTransformed(light->getTransformMtx());
 
-		m_shadingLights.push_back(shadingLight);
+		if (LightClusters::isLightClusterable(shadingLight)) {
+			m_clusteredLights.push_back(shadingLight);
+		} else {
+			m_shadingLights.push_back(shadingLight);
+		}
 	}
 
 	m_shadingLightPerObject.reserve(m_shadingLights.size());
 }
 
+bool DefaultGameDrawer::computeBoundingSphereWs(Actor* actor, vec3f& outPosition, float& outRadius) {
+	const AABox3f bboxOS = actor->getBBoxOS();
+	if (bboxOS.IsEmpty()) {
+		return false;
+	}
+
+	const transf3d& tr = actor->getTransform();
+
+	// We can technically transform the box in world space and then take the bounding sphere, however
+	// transforming 8 verts is a perrty costly operation (and we do not need all the data).
+	// So instead of that we "manually compute the sphere here.
+	// Note: is that really faster?!
+	vec3f const bboxCenterOS = bboxOS.center();
+	quatf const bbSpherePosQ = tr.r * quatf(bboxCenterOS * tr.s, 0.f) * conjugate(tr.r);
+	outPosition = bbSpherePosQ.xyz() + tr.p;
+	outRadius = bboxOS.halfDiagonal().length() * tr.s.componentMaxAbs();
+
+	return true;
+}
+
 bool DefaultGameDrawer::isInFrustum(const GameDrawSets& drawSets, Actor* actor) const {
 	// If the camera frustum is present, try to clip the object.
 	const Frustum* const pFrustum = drawSets.drawCamera->getFrustumWS();
-	const AABox3f bboxOS = actor->getBBoxOS();
 	if (pFrustum != nullptr) {
-		if (!bboxOS.IsEmpty()) {
-			const transf3d& tr = actor->getTransform();
-
-			// We can technically transform the box in world space and then take the bounding sphere, however
-			// transforming 8 verts is a perrty costly operation (and we do not need all the data).
-			// So instead of that we "manually compute the sphere here.
-			// Note: is that really faster?!
-			vec3f const bboxCenterOS = bboxOS.center();
-			quatf const bbSpherePosQ = tr.r * quatf(bboxCenterOS * tr.s, 0.f) * conjugate(tr.r);
-			vec3f const bbSpherePos = bbSpherePosQ.xyz() + tr.p;
-			float const bbSphereRadius = bboxOS.halfDiagonal().length() * tr.s.componentMaxAbs();
-
+		vec3f bbSpherePos;
+		float bbSphereRadius = 0.f;
+		if (computeBoundingSphereWs(actor, bbSpherePos, bbSphereRadius)) {
 			if (pFrustum->isSphereOutside(bbSpherePos, bbSphereRadius)) {
 				return false;
 			}
@@ -295,6 +429,47 @@ bool DefaultGameDrawer::isInFrustum(const GameDrawSets& drawSets, Actor* actor)
 	return true;
 }
 
+float DefaultGameDrawer::computeScreenSize(const GameDrawSets& drawSets, Actor* actor) const {
+	vec3f bbSpherePos;
+	float bbSphereRadius = 0.f;
+	if (computeBoundingSphereWs(actor, bbSpherePos, bbSphereRadius) == false) {
+		return -1.f;
+	}
+
+	// The shadow casters use the level of detail they have in the main view, the light camera would pick
+	// a different one, making the shadows not match the drawn meshes.
+	const bool isDrawingShadowMap = drawSets.shadowMapBuildInfo != nullptr && drawSets.gameCamera != nullptr;
+	const ICamera* const camera = isDrawingShadowMap ? drawSets.gameCamera : drawSets.drawCamera;
+
+	// The projected radius in normalized device coordinates [-1;1], which is also the projected diameter
+	// as a fraction of the viewport height.
+	const mat4f proj = camera->getProj();
+	float projectedRadius = bbSphereRadius * fabsf(proj.data[1][1]);
+	const bool isPerspective = proj.data[3][3] == 0.f;
+	if (isPerspective) {
+		const float distance = (bbSpherePos - camera->getCameraPosition()).length();
+		if (distance <= bbSphereRadius) {
+			// The camera is inside the sphere, the object covers the whole screen.
+			return 1.f;
+		}
+		projectedRadius /= distance;
+	}
+
+	return projectedRadius;
+}
+
+int DefaultGameDrawer::computeMeshLod(const MeshLodSettings& settings, const float screenSize) {
+	if (screenSize < 0.f || screenSize >= settings.fullDetailScreenSize) {
+		return 0;
+	}
+
+	if (screenSize == 0.f) {
+		return settings.maxLod;
+	}
+
+	return std::min(int(log2f(settings.fullDetailScreenSize / screenSize)), settings.maxLod);
+}
+
 void DefaultGameDrawer::fillGeneralModsWithLights(Actor* actor, GeneralDrawMod& generalMods) {
 	// Find all the lights that can affect this object.
 	m_shadingLightPerObject.clear();
@@ -310,6 +485,60 @@ void DefaultGameDrawer::fillGeneralModsWithLights(Actor* actor, GeneralDrawMod&
 	generalMods.lightsCount = int(m_shadingLightPerObject.size());
 }
 
+void DefaultGameDrawer::computeNearFarPlanes(const mat4f& proj, float& outNear, float& outFar) {
+	const float m22 = proj.data[2][2];
+	const float m32 = proj.data[3][2];
+	const bool isPerspective = proj.data[2][3] != 0.f;
+
+	if (isPerspective) {
+		outNear = kIsTexcoordStyleD3D ? m32 / m22 : m32 / (m22 + 1.f);
+		outFar = kIsTexcoordStyleD3D ? m32 / (m22 + 1.f) : m32 / (m22 - 1.f);
+	} else {
+		outNear = kIsTexcoordStyleD3D ? m32 / m22 : (m32 + 1.f) / m22;
+		outFar = (m32 - 1.f) / m22;
+	}
+}
+
+void DefaultGameDrawer::updateLightClusters(const GameDrawSets& drawSets) {
+	m_lightClustersCamera = nullptr;
+	if (m_clusteredLights.empty()) {
+		return;
+	}
+
+	const mat4f view = drawSets.drawCamera->getView();
+	const mat4f proj = drawSets.drawCamera->getProj();
+
+	float nearPlane = 0.f;
+	float farPlane = 0.f;
+	computeNearFarPlanes(proj, nearPlane, farPlane);
+
+	// Nothing past the furthest light is lit by the clusters, spend the slices only where they are needed.
+	float maxLightDepth = 0.f;
+	for (const ShadingLightData& light : m_clusteredLights) {
+		const float lightDepth = -view.transfPos(light.lightPositionAndType.xyz()).z;
+		maxLightDepth = maxOf(maxLightDepth, lightDepth + light.lightXShadowRange.x);
+	}
+
+	nearPlane = maxOf(nearPlane, 1e-3f);
+	farPlane = minOf(farPlane, maxLightDepth);
+	if (farPlane <= nearPlane) {
+		// All lights are behind the camera.
+		return;
+	}
+
+	m_lightClusters.build(view, proj, nearPlane, farPlane, m_clusteredLights.data(), int(m_clusteredLights.size()), getThreadPool());
+	m_lightClusters.upload(drawSets.rdest.sgecon);
+	m_lightClustersCamera = drawSets.drawCamera;
+}
+
+ThreadPool* DefaultGameDrawer::getThreadPool() {
+	if (m_threadPool == nullptr) {
+		m_threadPool = std::make_unique<ThreadPool>(ThreadPool::getDefaultNumWorkers());
+	}
+
+	return m_threadPool.get();
+}
+
 
 void DefaultGameDrawer::drawWorld(const GameDrawSets& drawSets, const DrawReason drawReason) {
 	// Draw the sky
@@ -340,9 +569,28 @@ void DefaultGameDrawer::drawWorld(const GameDrawSets& drawSets, const DrawReason
 		}
 	}
 
+	// The clusters are needed only for the shaded passes, the others reuse them if the camera is the same.
+	if (drawReason == drawReason_editing || drawReason == drawReason_gameplay) {
+		updateLightClusters(drawSets);
+	}
+
 	IGameDrawer::drawWorld(drawSets, drawReason);
 }
 
+void DefaultGameDrawer::beginDrawActors(const GameDrawSets& UNUSED(drawSets), const DrawReason drawReason) {
+	// The editing and the selection draws mix the models with many helpers drawn immediately, keep their order.
+	// The queue of each pass (the shadow maps, the opaque and the transparent geometries) gets recorded on the thread pool.
+	if (drawReason_IsGameplay(drawReason)) {
+		m_modeldraw.beginQueue(getThreadPool());
+	}
+}
+
+void DefaultGameDrawer::endDrawActors(const GameDrawSets& UNUSED(drawSets), const DrawReason UNUSED(drawReason)) {
+	if (m_modeldraw.isQueueing()) {
+		m_modeldraw.endQueue();
+	}
+}
+
 void DefaultGameDrawer::drawActor(
     const GameDrawSets& drawSets, EditMode const editMode, Actor* actor, int const itemIndex, DrawReason const drawReason) {
 	const bool useWireframe = drawReason_IsVisualizeSelection(drawReason);
@@ -360,14 +608,18 @@ void DefaultGameDrawer::drawActor(
 	generalMods.isRenderingShadowMap = (drawReason == drawReason_gameplayShadow);
 	generalMods.ambientLightColor = getWorld()->m_ambientLight;
 	generalMods.uRimLightColorWWidth = vec4f(getWorld()->m_rimLight, getWorld()->m_rimCosineWidth);
+	generalMods.isAlphaZSorted = actor->m_forceAlphaZSort;
 
 	// If the camera frustum is present, try to clip the object.
 	if (isInFrustum(drawSets, actor) == false) {
 		return;
 	}
 
-	// Find all the lights that can affect this object.
+	// Find all the lights that can affect this object, the clustered lights are found per pixel.
 	fillGeneralModsWithLights(actor, generalMods);
+	if (generalMods.isRenderingShadowMap == false && m_lightClustersCamera == drawSets.drawCamera) {
+		generalMods.lightClusters = &m_lightClusters;
+	}
 
 	if (TraitParticles* const particlesTrait = getTrait<TraitParticles>(actor); editMode == editMode_actors && particlesTrait) {
 		drawTraitParticles(particlesTrait, drawSets, generalMods);
@@ -472,6 +724,11 @@ void DefaultGameDrawer::drawTraitStaticModel(TraitModel* modelTrait,
 	if (isAssetLoaded(asset) && asset->getType() == AssetType::Model) {
 		AssetModel* const model = modelTrait->getAssetProperty().getAssetModel();
 
+		InstanceDrawMods instanceDrawMods = modelTrait->instanceDrawMods;
+		const float screenSize = computeScreenSize(drawSets, actor);
+		instanceDrawMods.meshLod = computeMeshLod(m_meshLodSettings, screenSize);
+		instanceDrawMods.screenSizePixels = (screenSize >= 0.f) ? screenSize * float(drawSets.rdest.viewport.height) : 0.f;
+
 		std::vector<MaterialOverride> mtlOverrides;
 		for (auto& mtlOverride : modelTrait->m_materialOverrides) {
 			GameObject* const mtlProvider = getWorld()->getObjectById(mtlOverride.materialObjId);
@@ -494,18 +751,21 @@ void DefaultGameDrawer::drawTraitStaticModel(TraitModel* modelTrait,
 					// Draw
 					const mat4f n2w = actor->getTransformMtx() * modelTrait->m_additionalTransform;
 					model->sharedEval.evaluateFromNodesGlobalTransform(boneOverrides);
+					// The shared evaluation gets overwritten by the next actor using the same model.
+					instanceDrawMods.drawImmediately = true;
 					m_modeldraw.draw(drawSets.rdest, camPos, camLookDir, drawSets.drawCamera->getProjView(), n2w, generalMods,
-					                 model->sharedEval, modelTrait->instanceDrawMods, &mtlOverrides);
+					                 model->sharedEval, instanceDrawMods, &mtlOverrides);
 				}
 			} else {
 				if (modelTrait->m_evalModel) {
 					const mat4f n2w = actor->getTransformMtx() * modelTrait->m_additionalTransform;
 					m_modeldraw.draw(drawSets.rdest, camPos, camLookDir, drawSets.drawCamera->getProjView(), n2w, generalMods,
-					                 *modelTrait->m_evalModel, modelTrait->instanceDrawMods, &mtlOverrides);
+					                 *modelTrait->m_evalModel, instanceDrawMods, &mtlOverrides);
 				} else if (model && model->staticEval.isInitialized()) {
 					const mat4f n2w = actor->getTransformMtx() * modelTrait->m_additionalTransform;
+					modelTrait->m_sharedStaticEval = model->sharedStaticEvals.acquire(mtlOverrides, modelTrait->m_sharedStaticEval);
 					m_modeldraw.draw(drawSets.rdest, camPos, camLookDir, drawSets.drawCamera->getProjView(), n2w, generalMods,
-					                 model->staticEval, modelTrait->instanceDrawMods, &mtlOverrides);
+					                 *modelTrait->m_sharedStaticEval, instanceDrawMods);
 				}
 			}
 		} else {
@@ -662,6 +922,8 @@ void DefaultGameDrawer::drawTraitParticles2(TraitParticles2* particlesTrait, con
 				InstanceDrawMods mods;
 				mods.forceNoLighting = true;
 				mods.forceAdditiveBlending = true;
+				// The geometry gets regenerated for the next particle group.
+				mods.drawImmediately = true;
 
 				const mat4f identity = mat4f::getIdentity();
 				m_modeldraw.drawGeometry(drawSets.rdest, camPos, camLookDir, drawSets.drawCamera->getProjView(), identity, generalMods,
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "sge_core/LightClusters.h"
+#include "sge_core/ShadowCacheInvalidator.h"
 #include "sge_core/shaders/ConstantColorShader.h"
 #include "sge_core/shaders/modeldraw.h"
 #include "sge_core/shaders/SkyShader.h"
@@ -10,6 +12,8 @@
 #include "sge_engine/traits/TraitParticles.h"
 #include "sge_renderer/renderer/renderer.h"
 #include "sge_utils/math/mat4.h"
+#include "sge_utils/utils/ThreadPool.h"
+#include <memory>
 
 namespace sge {
 
@@ -28,9 +32,25 @@ struct LightShadowInfo {
 	GpuHandle<Texture> pointLightDepthTexture; // This could be a single 2D or a Cube texture depending on the light source.
 	GpuHandle<FrameTarget> pointLightFrameTargets[signedAxis_numElements];
 	GpuHandle<FrameTarget> frameTarget; // Regular frame target for spot and directional lights.
+
+	// The cached shadow map of the static casters, with the same layout as the ones above.
+	// Each frame it gets copied to the shadow map and the dynamic casters get drawn on top of it.
+	GpuHandle<Texture> staticPointLightDepthTexture;
+	GpuHandle<FrameTarget> staticPointLightFrameTargets[signedAxis_numElements];
+	GpuHandle<FrameTarget> staticFrameTarget;
+
 	bool isCorrectlyUpdated = false;
 };
 
+/// Describes how the level of detail of the meshes gets picked from the projected size of the actors, see @ModelMesh::lods.
+struct MeshLodSettings {
+	/// The projected bounding sphere height as a fraction of the viewport height at which the full detail mesh is used.
+	/// Every time the projected size halves, the next LOD is used.
+	float fullDetailScreenSize = 0.25f;
+	/// The least detailed LOD that could be used, the meshes with fewer LODs use their last one.
+	int maxLod = 8;
+};
+
 struct SGE_ENGINE_API DefaultGameDrawer : public IGameDrawer {
 	void prepareForNewFrame() final;
 	void updateShadowMaps(const GameDrawSets& drawSets) final;
@@ -39,6 +59,8 @@ struct SGE_ENGINE_API DefaultGameDrawer : public IGameDrawer {
 	    const GameDrawSets& drawSets, EditMode const editMode, Actor* actor, int const itemIndex, DrawReason const drawReason) override;
 
 	virtual void drawWorld(const GameDrawSets& drawSets, const DrawReason drawReason) override;
+	void beginDrawActors(const GameDrawSets& drawSets, const DrawReason drawReason) override;
+	void endDrawActors(const GameDrawSets& drawSets, const DrawReason drawReason) override;
 
 	// A Legacy function that should end up not being used.
 	void drawActorLegacy(Actor* actor,
@@ -78,20 +100,54 @@ struct SGE_ENGINE_API DefaultGameDrawer : public IGameDrawer {
 	                  const uint32 wireframeColor);
 
   private:
+	/// Computes the bounding sphere of the actor in world space. Returns false if the actor has no bounding box.
+	static bool computeBoundingSphereWs(Actor* actor, vec3f& outPosition, float& outRadius);
 	bool isInFrustum(const GameDrawSets& drawSets, Actor* actor) const;
+
+	/// Computes the projected diameter of the bounding sphere of the actor as a fraction of the viewport height.
+	/// When drawing a shadow map the size is computed for the game camera, so the shadow casters use the same level of detail
+	/// as in the main view. Returns a negative value if the actor has no bounding box.
+	float computeScreenSize(const GameDrawSets& drawSets, Actor* actor) const;
+
+	/// Computes the level of detail of the meshes of the actor based on the projected size of its bounding sphere.
+	static int computeMeshLod(const MeshLodSettings& settings, const float screenSize);
 	void fillGeneralModsWithLights(Actor* actor, GeneralDrawMod& generalMods);
 
+	/// Extracts the distances to the near and the far planes from a perspective or an orthographic projection.
+	static void computeNearFarPlanes(const mat4f& proj, float& outNear, float& outFar);
+
+	/// Builds and uploads @m_lightClusters for the camera used for drawing.
+	void updateLightClusters(const GameDrawSets& drawSets);
+
+	/// Returns @m_threadPool, creates it on the first call.
+	ThreadPool* getThreadPool();
+
+	/// Creates the cube depth texture and the frame targets for each of its faces, used for the shadow maps of the point lights.
+	static void createPointLightShadowMap(const int resolution, GpuHandle<Texture>& outTexture, GpuHandle<FrameTarget> outFaceTargets[]);
+
   public:
 	BasicModelDraw m_modeldraw;
+	MeshLodSettings m_meshLodSettings;
 	ConstantColorWireShader m_constantColorShader;
 	TexturedPlaneDraw m_texturedPlaneDraw;
 	ParticleRenderDataGen m_partRendDataGen;
 
+	/// The lights that get tested against each object, the directional lights and the lights with shadows.
 	std::vector<ShadingLightData> m_shadingLights;
 	std::vector<const ShadingLightData*> m_shadingLightPerObject;
 
+	/// The point and spot lights without shadows, these are shaded via @m_lightClusters.
+	std::vector<ShadingLightData> m_clusteredLights;
+	LightClusters m_lightClusters;
+	/// The camera @m_lightClusters were built for in this frame, nullptr if they weren't built.
+	const ICamera* m_lightClustersCamera = nullptr;
+	/// Used for building the light clusters and for recording the queued model draws.
+	std::unique_ptr<ThreadPool> m_threadPool;
+
 	// TODO: find a proper place for this
 	std::map<ObjectId, LightShadowInfo> m_perLightShadowFrameTarget;
+	/// Decides when the static layers of the shadow maps in @m_perLightShadowFrameTarget need to be redrawn.
+	ShadowCacheInvalidator m_shadowCacheInvalidator;
 
 	SkyShader m_skyShader;
 };
@@ -135,6 +135,9 @@ void EngineGlobal::update(float dt) {
 			continue;
 		}
 	}
+
+	// Apply the texture mip requests made while drawing the previous frame.
+	getCore()->getAssetLib()->getTextureStreaming().update();
 }
 
 void EngineGlobal::changeActivePlugin(IPlugin* pPlugin) {
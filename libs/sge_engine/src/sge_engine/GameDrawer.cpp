@@ -5,7 +5,9 @@
 #include "IWorldScript.h"
 #include "sge_core/DebugDraw.h"
 #include "sge_core/ICore.h"
+#include "sge_core/LightClusters.h"
 #include "sge_engine/EngineGlobal.h"
+#include "sge_engine/actors/ALight.h"
 
 namespace sge {
 
@@ -38,33 +40,89 @@ void IGameDrawer::drawWorld(const GameDrawSets& drawSets, const DrawReason drawR
 	const vec3f zSortingPlaneNormal = drawSets.drawCamera->getCameraLookDir();
 	const Plane zSortPlane = Plane::FromPosAndDir(zSortingPlanePosWs, zSortingPlaneNormal);
 
-	getWorld()->iterateOverPlayingObjects(
-	    [&](GameObject* object) -> bool {
-		    // TODO: Skip this check for whole types. We know they are not actors...
-		    if (Actor* actor = object->getActor()) {
-			    bool shouldDrawTheActorNow = true;
-			    if (actor->m_forceAlphaZSort) {
-				    AABox3f actorBboxOS = actor->getBBoxOS();
-				    if (actorBboxOS.IsEmpty() == false) {
-					    vec3f actorBBoxCenterWs = mat_mul_pos(actor->getTransformMtx(), actorBboxOS.center());
-
-					    ActorsNeedingZSort sortingArgs;
-					    sortingArgs.actor = actor;
-					    sortingArgs.zSortDistance = zSortPlane.Distance(actorBBoxCenterWs);
-
-					    m_zSortedActorsToDraw.push_back(sortingArgs);
-					    shouldDrawTheActorNow = false;
-				    }
-			    }
+	const auto processActor = [&](Actor* const actor) -> void {
+		bool shouldDrawTheActorNow = true;
+		if (actor->m_forceAlphaZSort) {
+			AABox3f actorBboxOS = actor->getBBoxOS();
+			if (actorBboxOS.IsEmpty() == false) {
+				vec3f actorBBoxCenterWs = mat_mul_pos(actor->getTransformMtx(), actorBboxOS.center());
+
+				ActorsNeedingZSort sortingArgs;
+				sortingArgs.actor = actor;
+				sortingArgs.zSortDistance = zSortPlane.Distance(actorBBoxCenterWs);
+
+				m_zSortedActorsToDraw.push_back(sortingArgs);
+				shouldDrawTheActorNow = false;
+			}
+		}
+
+		if (shouldDrawTheActorNow) {
+			drawActor(drawSets, editMode_actors, actor, 0, drawReason);
+		}
+	};
+
+	// When drawing a single layer of a shadow map skip the partition of the spatial index with the actors from the other layer.
+	const bool isShadowPass = drawReason == drawReason_gameplayShadow && drawSets.shadowMapBuildInfo != nullptr;
+	const auto isPartitionDrawn = [&](const bool isStaticPartition) -> bool {
+		if (isShadowPass == false || drawSets.shadowCasterLayer == shadowCasterLayer_all) {
+			return true;
+		}
 
-			    if (shouldDrawTheActorNow) {
-				    drawActor(drawSets, editMode_actors, actor, 0, drawReason);
+		return isStaticPartition == (drawSets.shadowCasterLayer == shadowCasterLayer_static);
+	};
+
+	// The frustums of the faces of a point light reach past its range in their corners, the casters there do not cast shadows.
+	const bool isPointLightShadowPass = isShadowPass && drawSets.shadowMapBuildInfo->isPointLight;
+	const vec3f pointLightPositionWs = drawSets.drawCamera->getCameraPosition();
+	const float pointLightRange = isPointLightShadowPass ? drawSets.shadowMapBuildInfo->pointLightFarPlaneDistance : 0.f;
+
+	beginDrawActors(drawSets, drawReason);
+
+	// If the camera has a frustum visit only the actors that might be inside of it.
+	if (const Frustum* const frustum = drawSets.drawCamera->getFrustumWS()) {
+		m_visibleActorsIds.clear();
+		getWorld()->m_actorsSpatialIndex.queryFrustum(*frustum, m_visibleActorsIds, isPartitionDrawn(true),
+		                                              isPartitionDrawn(false));
+
+		// The index might return actors with fat or outdated boxes, test their current boxes all at once.
+		m_cullCandidates.clear();
+		m_cullCandidatesBoxes.clear();
+		for (const ObjectId& actorId : m_visibleActorsIds) {
+			if (Actor* const actor = getWorld()->getActorById(actorId)) {
+				const AABox3f boundsWs = ActorsSpatialIndex::computeActorBoundsWs(actor);
+				if (boundsWs.IsEmpty()) {
+					processActor(actor);
+				} else {
+					m_cullCandidates.push_back(actor);
+					m_cullCandidatesBoxes.add(boundsWs);
+				}
+			}
+		}
+
+		m_cullVisibleIndices.clear();
+		cullBoxes(*frustum, m_cullCandidatesBoxes, m_cullVisibleIndices);
+		for (const int iCandidate : m_cullVisibleIndices) {
+			if (isPointLightShadowPass &&
+			    LightClusters::doesLightAffectBox(pointLightPositionWs, pointLightRange, false, vec3f(0.f), 0.f,
+			                                      m_cullCandidatesBoxes.get(iCandidate)) == false) {
+				continue;
+			}
+
+			processActor(m_cullCandidates[iCandidate]);
+		}
+	} else {
+		getWorld()->iterateOverPlayingObjects(
+		    [&](GameObject* object) -> bool {
+			    // TODO: Skip this check for whole types. We know they are not actors...
+			    Actor* const actor = object->getActor();
+			    if (actor && isPartitionDrawn(getWorld()->m_actorsSpatialIndex.isActorStatic(actor->getId()))) {
+				    processActor(actor);
 			    }
-		    }
 
-		    return true;
-	    },
-	    false);
+			    return true;
+		    },
+		    false);
+	}
 
 	getCore()->getDebugDraw().getGroup("camera").clear(false);
 	getCore()->getDebugDraw().getGroup("camera").getWiered().line(vec3f(0.f), zSortingPlaneNormal * 10.f, 0xFFFFFFFF);
@@ -74,6 +132,8 @@ void IGameDrawer::drawWorld(const GameDrawSets& drawSets, const DrawReason drawR
 		drawActor(drawSets, editMode_actors, actorZSort.actor, 0, drawReason);
 	}
 
+	endDrawActors(drawSets, drawReason);
+
 	if (getWorld()->inspector && getWorld()->inspector->m_physicsDebugDrawEnabled) {
 		drawSets.rdest.sgecon->clearDepth(drawSets.rdest.frameTarget, 1.f);
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Actor.h"
+#include "sge_utils/math/FrustumCulling.h"
 #include "sge_renderer/renderer/renderer.h"
 
 namespace sge {
@@ -59,6 +60,14 @@ inline bool drawReason_IsGameOrEditNoShadowPass(DrawReason const reason) {
 	return (drawReason_IsGameplay(reason) || drawReason_IsEditOrSelectionTool(reason)) && reason != drawReason_gameplayShadow;
 }
 
+/// The shadow maps are drawn in two layers, the static layer gets cached between the frames and the dynamic one
+/// gets drawn on top of it every frame. See @ShadowCacheInvalidator.
+enum ShadowCasterLayer : int {
+	shadowCasterLayer_all,     ///< All casters.
+	shadowCasterLayer_static,  ///< The actors in the static partition of the @ActorsSpatialIndex.
+	shadowCasterLayer_dynamic, ///< All other actors.
+};
+
 //--------------------------------------------------------------------
 // GameDrawSets
 //-------------------------------------------------------------------
@@ -84,6 +93,7 @@ struct GameDrawSets {
 	ICamera* gameCamera = nullptr; // The camera that the player is going to be using.
 	IGameDrawer* gameDrawer = nullptr;
 	ShadowMapBuildInfo* shadowMapBuildInfo = nullptr; // The build info of the shadow map we are currenty rendering (if we do).
+	ShadowCasterLayer shadowCasterLayer = shadowCasterLayer_all; // The casters to draw when rendering a shadow map.
 };
 
 //--------------------------------------------------------------------
@@ -100,6 +110,12 @@ struct SGE_ENGINE_API IGameDrawer {
 	virtual void updateShadowMaps(const GameDrawSets& drawSets) = 0;
 
 	virtual void drawWorld(const GameDrawSets& drawSets, const DrawReason drawReason);
+
+	/// Called by @drawWorld before and after all the actors get drawn with @drawActor.
+	/// Drawers could use them to collect the draws of the actors and sort them before drawing.
+	virtual void beginDrawActors(const GameDrawSets& UNUSED(drawSets), const DrawReason UNUSED(drawReason)) {}
+	virtual void endDrawActors(const GameDrawSets& UNUSED(drawSets), const DrawReason UNUSED(drawReason)) {}
+
 	virtual void drawActor(
 	    const GameDrawSets& drawSets, EditMode const editMode, Actor* actor, int const itemIndex, DrawReason const drawReason) = 0;
 
@@ -110,6 +126,11 @@ struct SGE_ENGINE_API IGameDrawer {
 
   private:
 	GameWorld* m_world = nullptr;
+	/// The actors found by the frustum query in @drawWorld, kept between the calls to avoid allocations.
+	std::vector<ObjectId> m_visibleActorsIds;
+	std::vector<Actor*> m_cullCandidates;
+	AABoxesSoA m_cullCandidatesBoxes;
+	std::vector<int> m_cullVisibleIndices;
 };
 
 } // namespace sge
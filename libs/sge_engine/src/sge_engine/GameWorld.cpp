@@ -8,6 +8,7 @@
 #include "sge_utils/utils/strings.h"
 #include "sge_utils/utils/timer.h"
 #include "traits/TraitCamera.h"
+#include "traits/TraitModel.h"
 #include <functional>
 #include <thread>
 
@@ -234,6 +235,7 @@ void GameWorld::clear() {
 	}
 
 	playingObjects.clear();
+	m_actorsSpatialIndex.clear();
 
 	for (GameObject* const object : objectsAwaitingCreation) {
 		delete object;
@@ -279,13 +281,19 @@ void GameWorld::update(const GameUpdateSets& updateSets) {
 	}
 
 	// Update the audio device.
-	getCore()->getAudioDevice()->setMasterVolume(m_masterVolume);
+	if (AudioDevice* const audioDevice = getCore()->getAudioDevice()) {
+		audioDevice->setMasterVolume(m_masterVolume);
+	}
 
 	// Add the objects that were created during the last update to the list of playing objects.
 	for (int t = 0; t < objectsAwaitingCreation.size(); ++t) {
 		GameObject* const object = objectsAwaitingCreation[t];
 		playingObjects[object->getType()].emplace_back(object);
 		object->onPlayStateChanged(true);
+
+		if (Actor* const actor = object->getActor()) {
+			m_actorsSpatialIndex.addActor(actor);
+		}
 	}
 	objectsAwaitingCreation.clear();
 
@@ -302,6 +310,7 @@ void GameWorld::update(const GameUpdateSets& updateSets) {
 
 			// Signal the object that we are going to suspend it.
 			object->onPlayStateChanged(false);
+			m_actorsSpatialIndex.removeActor(objToKillId);
 
 			// Now erase the object form the playing actors list.
 			auto& gameObjectsOfType = playingObjects[object->getType()];
@@ -413,12 +422,65 @@ void GameWorld::update(const GameUpdateSets& updateSets) {
 		}
 	}
 
+	evaluateAnimatedModels(updateSets);
+	m_actorsSpatialIndex.update(*this);
+
 	if (updateSets.isGamePaused() == false) {
 		timeSpendPlaying += updateSets.dt;
 		totalStepsTaken++;
 	}
 }
 
+void GameWorld::evaluateAnimatedModels(const GameUpdateSets& updateSets) {
+	const ICamera* const camera = m_useAnimationLod ? getRenderCamera() : nullptr;
+	const Frustum* const frustum = camera ? camera->getFrustumWS() : nullptr;
+	const float animatorsDt = updateSets.isGamePaused() ? 0.f : updateSets.dt;
+
+	for (auto& itrActorByType : playingObjects) {
+		for (GameObject* const object : itrActorByType.second) {
+			TraitModel* const traitModel = getTrait<TraitModel>(object);
+			if (traitModel == nullptr) {
+				continue;
+			}
+
+			traitModel->updateAnimator(animatorsDt);
+			if (traitModel->m_isEvaluationPending == false) {
+				continue;
+			}
+
+			if (traitModel->m_evalModel && traitModel->m_evalModel->isInitialized()) {
+				EvaluatedModel& evalModel = traitModel->m_evalModel.get();
+				AnimationLodState* lodState = nullptr;
+
+				// Pick the level of detail based on the bounding box of the last evaluation.
+				const Actor* const actor = object->getActor();
+				if (camera != nullptr && actor != nullptr) {
+					bool isVisible = true;
+					float distanceToCamera = 0.f;
+					if (evalModel.aabox.IsEmpty() == false) {
+						const AABox3f bboxWs =
+						    evalModel.aabox.getTransformed(actor->getTransform().toMatrix() * traitModel->getAdditionalTransform());
+						distanceToCamera = (bboxWs.center() - camera->getCameraPosition()).length();
+						isVisible = frustum == nullptr || frustum->isBoxOutside(bboxWs) == false;
+					}
+
+					lodState = &traitModel->m_animationLod;
+					lodState->update(m_animationLodSettings, distanceToCamera, isVisible);
+				}
+
+				m_animationSystem.addModel(&evalModel, traitModel->m_pendingEvalMoments.data(),
+				                           int(traitModel->m_pendingEvalMoments.size()), lodState);
+
+				// The animation might change the bounding box of the actor.
+				m_actorsSpatialIndex.markActorDirty(object->getId());
+			}
+			traitModel->m_isEvaluationPending = false;
+		}
+	}
+
+	m_animationSystem.evaluate();
+}
+
 // Used for giving object unique names (However the GameWorld still supports objects with same name).
 int GameWorld::getNextNameIndex() {
 	int retval = m_nextNameIndex;
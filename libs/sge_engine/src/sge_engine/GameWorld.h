@@ -6,8 +6,10 @@
 #include <vector>
 
 #include "Actor.h"
+#include "ActorsSpatialIndex.h"
 #include "Camera.h"
 #include "PhysicsDebugDraw.h"
+#include "sge_core/AnimationSystem.h"
 #include "sge_core/application/input.h"
 #include "sge_engine/Physics.h"
 #include "sge_renderer/renderer/renderer.h"
@@ -270,6 +272,11 @@ struct SGE_ENGINE_API GameWorld {
 
 	ICamera* getRenderCamera();
 
+  private:
+	/// Advances the animators of the @TraitModel-s and evaluates all models that requested evaluation with
+	/// @TraitModel::requestEvaluation during this update.
+	void evaluateAnimatedModels(const GameUpdateSets& updateSets);
+
   public:
 	/// The projection settings specified by the user. (Some of them are window dependad and we update them manully).
 	/// TODO: This is an old idea, and no longer has its place in the game world.
@@ -305,6 +312,17 @@ struct SGE_ENGINE_API GameWorld {
 	/// Per frame physics contact manifold list.
 	std::unordered_map<const RigidBody*, std::vector<const btPersistentManifold*>> m_physicsManifoldList;
 
+	/// Evaluates the models of all @TraitModel that requested it during the update, see @TraitModel::requestEvaluation.
+	AnimationSystem m_animationSystem;
+
+	/// The bounding boxes of the playing actors, used for finding the visible actors without visiting all of them.
+	ActorsSpatialIndex m_actorsSpatialIndex;
+
+	/// The levels of detail used for the animated models, see @AnimationLodState.
+	AnimationLodSettings m_animationLodSettings = AnimationLodSettings::getDefault();
+	/// If false all animated models are sampled fully on every update.
+	bool m_useAnimationLod = true;
+
 	/// The next free game object id.
 	int m_nextObjectId = 1;
 
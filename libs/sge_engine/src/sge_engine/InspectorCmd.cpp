@@ -90,6 +90,7 @@ void CmdMemberChange::apply(GameInspector* inspector) {
 		typeDesc->copyFn(dest, m_newData.get());
 
 	actor->onMemberChanged();
+	inspector->m_world->m_actorsSpatialIndex.markActorDirty(m_objectId);
 
 	// HACK: When we've got a node selected with the transform tool and move it a few time,
 	// if we undo while selected the gizmo with override the transform.
@@ -116,6 +117,7 @@ void CmdMemberChange::undo(GameInspector* inspector) {
 		typeDesc->copyFn(dest, m_orginaldata.get());
 
 	actor->onMemberChanged();
+	inspector->m_world->m_actorsSpatialIndex.markActorDirty(m_objectId);
 
 	// HACK: When we've got a node selected with the transform tool and move it a few time,
 	// if we undo while selected the gizmo with override the transform.
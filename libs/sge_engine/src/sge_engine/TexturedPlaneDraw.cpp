@@ -1,3 +1,4 @@
+#include "sge_core/AssetLibrary.h"
 #include "sge_core/ICore.h"
 
 #include "sge_engine/TexturedPlaneDraw.h"
@@ -55,6 +56,9 @@ void TexturedPlaneDraw::draw(
     const RenderDestination& rdest, const mat4f& projViewWorld, Texture* texture, const vec4f& tint, const vec4f uvRegion) {
 	initialize(rdest.getDevice());
 
+	// The size of the plane on the screen isn't known here, request the most detailed mip.
+	getCore()->getAssetLib()->getTextureStreaming().requestMip(texture, 0);
+
 	m_stateGroup.setProgram(m_shadingProgram);
 	m_stateGroup.setPrimitiveTopology(PrimitiveTopology::TriangleList);
 	m_stateGroup.setVBDeclIndex(m_vertexDecl);
@@ -70,6 +70,8 @@ AABox3f ACRSpline::getBBoxOS() const {
 
 void ACRSpline::onMemberChanged() {
 	makeDirty();
+	// The points might have been added or removed, which changes the bounding box.
+	markBBoxDirty();
 	computeSegmentsLength();
 }
 
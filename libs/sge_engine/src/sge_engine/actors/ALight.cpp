@@ -26,6 +26,7 @@ ReflBlock() {
 	        .addMemberFlag(MFF_Vec3fAsColor) ReflMember(LightDesc, spotLightAngle)
 	        .addMemberFlag(MFF_FloatAsDegrees) ReflMember(LightDesc, hasShadows)
 		ReflMember(LightDesc, shadowMapRes)
+		ReflMember(LightDesc, numShadowCascades).uiRange(1, kMaxShadowCascades, 1.f)
 	;
 
 	ReflAddActor(ALight)
@@ -34,7 +35,8 @@ ReflBlock() {
 // clang-format on
 
 
-Optional<ShadowMapBuildInfo> LightDesc::buildShadowMapInfo(const transf3d& lightWs, const Frustum& mainCameraFrustumWs) const {
+Optional<ShadowMapBuildInfo>
+    LightDesc::buildShadowMapInfo(const transf3d& lightWs, const Frustum& mainCameraFrustumWs, const float mainCameraNear) const {
 	// Check if the light could have shadows, if not just return an empty structure.
 	if (isOn == false || hasShadows == false) {
 		return NullOptional();
@@ -48,36 +50,38 @@ Optional<ShadowMapBuildInfo> LightDesc::buildShadowMapInfo(const transf3d& light
 			transf3d lightToWsNoScaling = lightWs;
 			lightToWsNoScaling.s = vec3f(1.f);
 
-			const mat4f ls2ws = lightToWsNoScaling.toMatrix();
-			const mat4f ws2ls = inverse(ls2ws);
-			AABox3f frustumLSBBox;
-			for (int t = 0; t < SGE_ARRSZ(mainCameraFrustumCornersWs); ++t) {
-				frustumLSBBox.expand(mat_mul_pos(ws2ls, mainCameraFrustumCornersWs[t]));
-			}
+			// The view of the shadow map must not depend on the main camera, otherwise the cascades can't be stable.
+			const mat4f shadowViewMtx = mat4f::getRotationY(half_pi()) * lightToWsNoScaling.toMatrix().inverse();
+			const mat4f shadowViewInvMtx = inverse(shadowViewMtx);
 
-			// Expand the bbox a in the direction opposite of the light.
-			// This is needed in order to still render the objects that are a little bit behind the camera, so they could still cast
-			// shadows.
-			// frustumLSBBox.expand(frustumLSBBox.min - frustumLSBBox.size().x00() * 0.1f);
+			ShadowCascadesSettings cascadesSettings;
+			cascadesSettings.numCascades = clamp(numShadowCascades, 1, kMaxShadowCascades);
+			cascadesSettings.resolution = shadowMapRes;
+			cascadesSettings.casterDistance = range;
 
-			// Make the bbox a bit wider, so objects near the frustum could still cast shadows.
-			// frustumLSBBox.scaleAroundCenter(vec3f(1.f, 1.1f, 1.1f));
+			ShadowCascade cascades[kMaxShadowCascades];
+			fitShadowCascades(mainCameraFrustumCornersWs, mainCameraNear, mainCameraNear + range, shadowViewMtx, cascadesSettings,
+			                  kIsTexcoordStyleD3D, cascades);
 
-			const vec3f camPosLs = frustumLSBBox.center() - frustumLSBBox.halfDiagonal().x00();
-			const vec3f camPosWs = mat_mul_pos(ls2ws, camPosLs);
+			ShadowMapBuildInfo result;
+			result.numCascades = cascadesSettings.numCascades;
+			result.cascadesBlendFraction = cascadesSettings.blendFraction;
 
-			const float camWidth = frustumLSBBox.size().z;
-			const float camheight = frustumLSBBox.size().y;
-			const float camZRange = frustumLSBBox.size().x;
+			for (int iCascade = 0; iCascade < result.numCascades; ++iCascade) {
+				const ShadowCascade& cascade = cascades[iCascade];
 
-			transf3d shadowCameraTrasnform = lightToWsNoScaling;
-			shadowCameraTrasnform.p = camPosWs;
+				// The camera position is on the side of the covered area facing the light.
+				const vec3f camPosLs = cascade.centerLs + vec3f(0.f, 0.f, cascade.radius);
+				RawCamera& cascadeCamera = result.cascadeCameras[iCascade];
+				cascadeCamera = RawCamera(mat_mul_pos(shadowViewInvMtx, camPosLs), shadowViewMtx, cascade.proj);
+				cascadeCamera.m_frustum = Frustum::extractClippingPlanes(cascade.cullingProj * shadowViewMtx, kIsTexcoordStyleD3D);
 
-			const mat4f shadowViewMtx = mat4f::getRotationY(half_pi()) * shadowCameraTrasnform.toMatrix().inverse();
-			const mat4f shadowProjMtx = mat4f::getOrthoRHCentered(camWidth, camheight, 0.f, camZRange, kIsTexcoordStyleD3D);
-			const RawCamera shadowMapCamera = RawCamera(camPosWs, shadowViewMtx, shadowProjMtx);
+				result.cascadeNdcTransforms[iCascade] = computeShadowCascadeNdcTransform(cascades[0], cascade);
+			}
 
-			return ShadowMapBuildInfo(shadowMapCamera);
+			result.shadowMapCamera = result.cascadeCameras[0];
+
+			return result;
 		} break;
 
 		case light_spot: {
@@ -2,6 +2,7 @@
 
 #include "sge_engine/Actor.h"
 #include "sge_engine/traits/TraitCamera.h"
+#include "sge_utils/math/ShadowCascades.h"
 #include "sge_utils/utils/optional.h"
 
 #include "sge_engine/traits/TraitViewportIcon.h"
@@ -24,6 +25,15 @@ struct ShadowMapBuildInfo {
 	RawCamera shadowMapCamera; // todo multiple camera for point lights.
 	RawCamera pointLightShadowMapCameras[SignedAxis::signedAxis_numElements];
 	float pointLightFarPlaneDistance = 0.f;
+
+	/// Directional lights use cascaded shadow maps, the cascades are placed next to each other in the shadow map texture.
+	/// @shadowMapCamera is the camera of the first cascade, its projection is used for sampling all cascades.
+	int numCascades = 0;
+	/// The cameras used for drawing each cascade, their frustums are fitted only to the area covered by the cascade.
+	RawCamera cascadeCameras[kMaxShadowCascades];
+	/// See @computeShadowCascadeNdcTransform.
+	vec4f cascadeNdcTransforms[kMaxShadowCascades];
+	float cascadesBlendFraction = 0.f;
 };
 
 struct SGE_ENGINE_API LightDesc {
@@ -42,8 +52,12 @@ struct SGE_ENGINE_API LightDesc {
 	bool hasShadows = false;
 	/// The resolution of the two sides of the shadow map texture.
 	int shadowMapRes = 128;
+	/// For directional lights only, the number of cascades of the shadow map. Each one has the resolution of @shadowMapRes.
+	int numShadowCascades = 3;
 
-	Optional<ShadowMapBuildInfo> buildShadowMapInfo(const transf3d& lightWs, const Frustum& mainCameraFrustumWs) const;
+	/// @param [in] mainCameraNear the distance to the near plane of the main camera, used for splitting the shadow map cascades.
+	Optional<ShadowMapBuildInfo>
+	    buildShadowMapInfo(const transf3d& lightWs, const Frustum& mainCameraFrustumWs, const float mainCameraNear) const;
 };
 
 struct SGE_ENGINE_API ALight : public Actor {
@@ -76,6 +76,8 @@ AABox3f ALine::getBBoxOS() const {
 
 void ALine::onMemberChanged() {
 	makeDirty();
+	// The points might have been added or removed, which changes the bounding box.
+	markBBoxDirty();
 }
 
 void ALine::computeSegmentsLength() {
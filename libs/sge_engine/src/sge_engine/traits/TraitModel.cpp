@@ -52,13 +52,87 @@ ReflBlock() {
 		ReflMember(TraitModel, m_materialOverrides)
 		ReflMember(TraitModel, useSkeleton)
 		ReflMember(TraitModel, rootSkeletonId)
+		ReflMember(TraitModel, m_loopedAnimation)
 		ReflMember(TraitModel, imageSettings)
 	;
 
 }
 // clang-format on
 
+void TraitModel::markActorBBoxDirty() {
+	if (Actor* const actor = getActor()) {
+		actor->markBBoxDirty();
+	}
+}
+
+ModelAnimator* TraitModel::createAnimator() {
+	AssetModel* const assetModel = m_assetProperty.getAssetModel();
+	if (assetModel == nullptr || assetModel->staticEval.isInitialized() == false) {
+		return nullptr;
+	}
+
+	m_evalModel = EvaluatedModel();
+	m_evalModel->initialize(assetModel->staticEval.m_assetLibrary, &assetModel->model);
+
+	m_animator = ModelAnimator();
+	m_animator->addTrack_begin(m_evalModel.get());
+	return &m_animator.get();
+}
+
+void TraitModel::updateLoopedAnimation() {
+	if (m_loopedAnimation == m_animatorLoopedAnimation) {
+		return;
+	}
+
+	if (m_loopedAnimation.empty()) {
+		// The looped animation got removed, go back to the static model.
+		resetEvaluation();
+		markActorBBoxDirty();
+		return;
+	}
+
+	AssetModel* const assetModel = m_assetProperty.getAssetModel();
+	if (assetModel == nullptr) {
+		// Wait for the model to get loaded.
+		return;
+	}
+
+	m_animatorLoopedAnimation = m_loopedAnimation;
+	if (assetModel->model.getAnimationIndexByName(m_loopedAnimation) < 0) {
+		m_animator = NullOptional();
+		m_evalModel = NullOptional();
+		markActorBBoxDirty();
+		return;
+	}
+
+	if (ModelAnimator* const animator = createAnimator()) {
+		animator->addTrack(0, 0.f, trackTransition_loop);
+		animator->addAnimationToTrack(0, m_assetProperty.getAsset(), m_loopedAnimation.c_str());
+		animator->addTrack_finish();
+		animator->playTrack(0);
+	}
+}
+
+void TraitModel::updateAnimator(const float dt) {
+	updateLoopedAnimation();
+
+	if (m_animator.isValid() == false || m_evalModel.isValid() == false) {
+		return;
+	}
+
+	m_animator->update(dt);
+
+	AnimatorEvalMoments evalMoments;
+	m_animator->computeEvalMoments(evalMoments);
+	requestEvaluation(evalMoments.data(), int(evalMoments.size()));
+}
+
 AABox3f TraitModel::getBBoxOS() const {
+	// If the model is animated use the bounding box of the last evaluation.
+	if (m_evalModel && m_evalModel->isInitialized() && m_evalModel->aabox.IsEmpty() == false) {
+		return m_evalModel->aabox.getTransformed(m_additionalTransform);
+	}
+
 	// If the attached asset is a model use it to compute the bounding box.
 	const AssetModel* const assetModel = getAssetProperty().getAssetModel();
 	if (assetModel && assetModel->staticEval.isInitialized()) {
@@ -293,6 +367,10 @@ void editTraitStaticModel(GameInspector& inspector, GameObject* actor, MemberCha
 		chain.add(sgeFindMember(TraitModel, rootSkeletonId));
 		ProperyEditorUIGen::doMemberUI(inspector, actor, chain);
 		chain.pop();
+
+		chain.add(sgeFindMember(TraitModel, m_loopedAnimation));
+		ProperyEditorUIGen::doMemberUI(inspector, actor, chain);
+		chain.pop();
 	}
 
 	if (traitStaticModel.m_assetProperty.getAssetSprite()) {
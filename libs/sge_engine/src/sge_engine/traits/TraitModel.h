@@ -1,5 +1,6 @@
 #pragma once
 
+#include "sge_core/AnimationLod.h"
 #include "sge_core/Animator.h"
 #include "sge_core/shaders/modeldraw.h"
 #include "sge_engine/Actor.h"
@@ -47,7 +48,8 @@ struct SGE_ENGINE_API TraitModel : public Trait {
 
 	void setModel(std::shared_ptr<Asset>& asset, bool updateNow) {
 		m_assetProperty.setAsset(asset);
-		m_evalModel = NullOptional();
+		resetEvaluation();
+		markActorBBoxDirty();
 		if (updateNow) {
 			updateAssetProperty();
 		}
@@ -65,7 +67,10 @@ struct SGE_ENGINE_API TraitModel : public Trait {
 	const AssetProperty& getAssetProperty() const { return m_assetProperty; }
 
 	mat4f getAdditionalTransform() const { return m_additionalTransform; }
-	void setAdditionalTransform(const mat4f& tr) { m_additionalTransform = tr; }
+	void setAdditionalTransform(const mat4f& tr) {
+		m_additionalTransform = tr;
+		markActorBBoxDirty();
+	}
 
 	AABox3f getBBoxOS() const;
 
@@ -77,15 +82,65 @@ struct SGE_ENGINE_API TraitModel : public Trait {
 	void computeNodeToBoneIds();
 	void computeSkeleton(std::vector<mat4f>& boneOverrides);
 
+	/// @brief Requests @m_evalModel to be evaluated with the specified moments. The evaluation is done by the
+	/// @AnimationSystem of the world at the end of the world update, together with all other animated models.
+	/// Calling it again in the same update overrides the previous request.
+	void requestEvaluation(const EvalMomentSets* const evalMoments, const int numMoments) {
+		m_pendingEvalMoments.assign(evalMoments, evalMoments + ((evalMoments != nullptr) ? numMoments : 0));
+		m_isEvaluationPending = true;
+	}
+
+	void requestEvaluation(const std::vector<EvalMomentSets>& evalMoments) {
+		requestEvaluation(evalMoments.data(), int(evalMoments.size()));
+	}
+
+	bool isEvaluationPending() const { return m_isEvaluationPending; }
+
+	/// @brief Creates an animator for the current model, replacing the existing one, and makes @m_evalModel use it.
+	/// The caller should add the tracks and call @ModelAnimator::addTrack_finish. After that the @GameWorld updates
+	/// the animator every update and evaluates its pose with the @AnimationSystem.
+	/// The animator is destroyed when the model changes.
+	/// Returns nullptr if the asset isn't a loaded 3D model.
+	ModelAnimator* createAnimator();
+	ModelAnimator* getAnimator() { return m_animator ? &m_animator.get() : nullptr; }
+
+	/// Advances @m_animator (if any) and requests the evaluation of its pose. Called by the @GameWorld.
+	void updateAnimator(float dt);
+
+	/// Plays the specified animation of the model in a loop, an empty name makes the model static.
+	void setLoopedAnimation(const char* animationName) { m_loopedAnimation = animationName ? animationName : ""; }
+
   private:
 	bool updateAssetProperty() {
-		if (m_assetProperty.update()) {
-			m_evalModel = NullOptional();
-			return true;
+		const bool hasAssetChanged = m_assetProperty.update();
+		if (hasAssetChanged) {
+			resetEvaluation();
+		}
+
+		// Reloaded assets keep the same Asset object, they are detected by the modification time of their file.
+		const sint64 assetModTime = m_assetProperty.getAsset() ? m_assetProperty.getAsset()->getLastModTime() : 0;
+		if (hasAssetChanged || assetModTime != m_assetModTime) {
+			m_assetModTime = assetModTime;
+			markActorBBoxDirty();
 		}
-		return false;
+
+		return hasAssetChanged;
+	}
+
+	/// Creates or destroys the animator playing @m_loopedAnimation when it changes.
+	void updateLoopedAnimation();
+
+	void resetEvaluation() {
+		m_animatorLoopedAnimation.clear();
+		m_animator = NullOptional();
+		m_evalModel = NullOptional();
+		m_sharedStaticEval.reset();
+		m_isEvaluationPending = false;
 	}
 
+	/// Reports to the spatial index of the world that the bounding box of the owning actor might have changed.
+	void markActorBBoxDirty();
+
 	void onModelChanged() {
 		useSkeleton = false;
 		rootSkeletonId = ObjectId();
@@ -100,9 +155,31 @@ struct SGE_ENGINE_API TraitModel : public Trait {
 
 	mat4f m_additionalTransform = mat4f::getIdentity();
 	AssetProperty m_assetProperty;
+	/// The modification time of the asset the last time the asset property got updated.
+	sint64 m_assetModTime = 0;
 
 	Optional<EvaluatedModel> m_evalModel;
 
+	/// The animator created by @createAnimator, it animates @m_evalModel.
+	Optional<ModelAnimator> m_animator;
+
+	/// The name of the animation of the model to be played in a loop, for example by decoration placed in a level.
+	/// If empty the model is static, unless an animator gets created with @createAnimator.
+	std::string m_loopedAnimation;
+	/// The animation played by @m_animator if it was created for @m_loopedAnimation.
+	std::string m_animatorLoopedAnimation;
+
+	/// The static evaluation of the model with the material overrides of this instance, shared with the other instances
+	/// that use the same overrides. Used when @m_evalModel is not.
+	std::shared_ptr<const SharedEvaluatedModel> m_sharedStaticEval;
+
+	/// The moments passed to @requestEvaluation, waiting for the @AnimationSystem.
+	std::vector<EvalMomentSets> m_pendingEvalMoments;
+	bool m_isEvaluationPending = false;
+
+	/// The level of detail of the animation, updated by the @GameWorld based on the distance to the camera.
+	AnimationLodState m_animationLod;
+
 	// 3D model specific properties.
 	// TODO: move them in a strcuture.
 	InstanceDrawMods instanceDrawMods;
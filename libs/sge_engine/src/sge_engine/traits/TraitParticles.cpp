@@ -438,6 +438,13 @@ void TraitParticles::update(const GameUpdateSets& u) {
 		// TODO: handle duplicated names!
 		m_pgroupState[desc.m_name].update(m_isInWorldSpace, getActor()->getTransformMtx(), desc, u.dt);
 	}
+
+	// The particles move on every update, report the changes of their bounding box to the spatial index of the world.
+	const AABox3f bboxOS = getBBoxOS();
+	if (bboxOS != m_lastReportedBBoxOS) {
+		m_lastReportedBBoxOS = bboxOS;
+		getActor()->markBBoxDirty();
+	}
 }
 
 AABox3f TraitParticles::getBBoxOS() const {
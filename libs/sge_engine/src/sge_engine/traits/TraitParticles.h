@@ -159,6 +159,9 @@ struct SGE_ENGINE_API TraitParticles : public Trait {
 	bool m_isInWorldSpace = false; // if true, the particles are in world space, false is node space of the owning actor.
 	std::vector<ParticleGroupDesc> m_pgroups;
 	std::unordered_map<std::string, ParticleGroupState> m_pgroupState;
+
+	/// The result of @getBBoxOS the last time it was reported to the owning actor with @Actor::markBBoxDirty.
+	AABox3f m_lastReportedBBoxOS;
 };
 
 //--------------------------------------------------------------
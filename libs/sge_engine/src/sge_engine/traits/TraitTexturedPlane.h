@@ -25,7 +25,16 @@ struct SGE_ENGINE_API TraitTexturedPlane : public Trait {
 
 	// Updates the working model.
 	// Returns true if the model has been changed (no matter if it is valid or not).
-	bool postUpdate() { return m_assetProperty.update(); }
+	bool postUpdate() {
+		if (m_assetProperty.update()) {
+			// The size of the plane depends on the texture.
+			if (Actor* const actor = getActor()) {
+				actor->markBBoxDirty();
+			}
+			return true;
+		}
+		return false;
+	}
 
 	void clear() { m_assetProperty.clear(); }
 
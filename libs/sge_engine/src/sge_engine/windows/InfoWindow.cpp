@@ -42,6 +42,14 @@ void InfoWindow::update(SGEContext* const UNUSED(sgecon), const InputState& UNUS
 
 		ImGui::Value("Draw Calls Count", framestats.numDrawCalls);
 		ImGui::Value("Primitives Count", (int)framestats.numPrimitiveDrawn);
+		ImGui::Value("Program Changes", framestats.numProgramChanges);
+		ImGui::Value("Buffer Changes", framestats.numBufferChanges);
+		ImGui::Value("Texture Changes", framestats.numTextureChanges);
+		ImGui::Value("Uniform Changes", framestats.numUniformChanges);
+		ImGui::Value("Render Queue Items", framestats.numRenderQueueItems);
+		ImGui::Value("State Changes Saved", framestats.numStateChangesUnsorted - framestats.numStateChangesSorted);
+		ImGui::Value("Instanced Draw Calls", framestats.numInstancedDrawCalls);
+		ImGui::Value("Draw Calls Saved by Instancing", framestats.numInstancedGeometries - framestats.numInstancedDrawCalls);
 		ImGui::Value("VSync Enabled", getCore()->getDevice()->getVsync());
 
 		SGEDevice* const sgedev = getCore()->getAssetLib()->getDevice();
@@ -0,0 +1,144 @@
+#include "sge_core/AssetLibrary.h"
+#include "sge_engine/Actor.h"
+#include "sge_engine/GameWorld.h"
+#include "sge_engine/traits/TraitModel.h"
+#include "sge_engine/typelibHelper.h"
+#include "sge_utils/utils/strings.h"
+#include "doctest/doctest.h"
+
+namespace sge {
+
+/// An actor that only displays a model, like the decoration placed in the levels.
+struct ATestAnimatedModel : public Actor {
+	TraitModel ttModel;
+
+	void create() final { registerTrait(ttModel); }
+	AABox3f getBBoxOS() const final { return ttModel.getBBoxOS(); }
+};
+
+DefineTypeId(ATestAnimatedModel, 26'10'18'0001);
+ReflBlock() {
+	ReflAddActor(ATestAnimatedModel);
+}
+
+} // namespace sge
+
+using namespace sge;
+
+namespace {
+
+const float kDt = 1.f / 60.f;
+
+/// Creates a model asset with a chain of @numNodes nodes and a "wave" animation moving all of them.
+std::shared_ptr<Asset> makeWavingModelAsset(AssetLibrary& assetLibrary, const int numNodes) {
+	std::shared_ptr<Asset> asset = assetLibrary.makeRuntimeAsset(AssetType::Model, "test/waving.mdl");
+	Model& model = asset->asModel()->model;
+
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		const int newNode = model.makeNewNode();
+		model.nodeAt(newNode)->name = string_format("node%d", iNode);
+		model.nodeAt(newNode)->staticLocalTransform = transf3d(vec3f(0.f, 1.f, 0.f), quatf::getIdentity(), vec3f(1.f));
+		if (iNode > 0) {
+			model.nodeAt(iNode - 1)->childNodes.push_back(newNode);
+		}
+	}
+	model.setRootNodeIndex(0);
+
+	ModelAnimation& anim = *model.animationAt(model.makeNewAnim());
+	anim.animationName = "wave";
+	anim.durationSec = 1.f;
+	for (int iNode = 0; iNode < numNodes; ++iNode) {
+		KeyFrames& keyFrames = anim.getOrAddKeyFramesForNode(iNode);
+		for (int iKey = 0; iKey <= 30; ++iKey) {
+			const float time = float(iKey) / 30.f;
+			keyFrames.positionKeyFrames.setKey(time, vec3f(time, 1.f, 0.f));
+			keyFrames.rotationKeyFrames.setKey(time, quatf::getAxisAngle(vec3f::getAxis(iNode % 3), time * 2.f));
+		}
+	}
+
+	model.computeNodesOrder();
+	model.computeNodesImportance();
+
+	asset->asModel()->staticEval.initialize(&assetLibrary, &model);
+	asset->asModel()->staticEval.evaluateStatic();
+
+	return asset;
+}
+
+/// A world with a single actor looping the animation of its model.
+struct WavingWorld {
+	WavingWorld()
+	    : assetLibrary(nullptr) {
+		asset = makeWavingModelAsset(assetLibrary, 5);
+
+		world.create();
+		actor = world.m_allocator<ATestAnimatedModel>();
+		actor->ttModel.setModel(asset, true);
+		actor->ttModel.setLoopedAnimation("wave");
+	}
+
+	void update(const int numUpdates) {
+		for (int t = 0; t < numUpdates; ++t) {
+			world.update(GameUpdateSets(kDt, false, InputState()));
+		}
+	}
+
+	AssetLibrary assetLibrary;
+	std::shared_ptr<Asset> asset;
+	GameWorld world;
+	ATestAnimatedModel* actor = nullptr;
+};
+
+} // namespace
+
+TEST_CASE("GameWorld Looped animations are evaluated by the world") {
+	WavingWorld waving;
+	waving.world.m_useAnimationLod = false;
+	waving.update(10);
+
+	TraitModel& traitModel = waving.actor->ttModel;
+	REQUIRE(traitModel.getAnimator() != nullptr);
+	REQUIRE(traitModel.m_evalModel.isValid());
+	CHECK(traitModel.isEvaluationPending() == false);
+
+	// The same animation evaluated directly.
+	EvaluatedModel reference;
+	reference.initialize(&waving.assetLibrary, &waving.asset->asModel()->model);
+	ModelAnimator animator;
+	animator.addTrack_begin(reference);
+	animator.addTrack(0, 0.f, trackTransition_loop);
+	animator.addAnimationToTrack(0, waving.asset, "wave");
+	animator.addTrack_finish();
+	animator.playTrack(0);
+	for (int t = 0; t < 10; ++t) {
+		animator.update(kDt);
+	}
+
+	AnimatorEvalMoments evalMoments;
+	animator.computeEvalMoments(evalMoments);
+	reference.evaluateFromMoments(evalMoments.data(), int(evalMoments.size()));
+
+	const EvaluatedModel& evalModel = traitModel.m_evalModel.get();
+	REQUIRE(evalModel.getNumEvalNodes() == reference.getNumEvalNodes());
+	for (int iNode = 0; iNode < reference.getNumEvalNodes(); ++iNode) {
+		CHECK(evalModel.getEvalNode(iNode).evalGlobalTransform == reference.getEvalNode(iNode).evalGlobalTransform);
+	}
+
+	const EvaluatedModel& staticEval = waving.asset->asModel()->staticEval;
+	CHECK(evalModel.getEvalNode(4).evalGlobalTransform != staticEval.getEvalNode(4).evalGlobalTransform);
+
+	// Removing the animation makes the model static again.
+	traitModel.setLoopedAnimation("");
+	waving.update(1);
+	CHECK(traitModel.getAnimator() == nullptr);
+	CHECK(traitModel.m_evalModel.isValid() == false);
+}
+
+TEST_CASE("GameWorld Animated models use the animation level of detail") {
+	WavingWorld waving;
+	waving.world.m_animationLodSettings.levels = {AnimationLodLevel(0.f, 4, false)};
+	waving.world.m_animationLodSettings.freezeWhenCulled = false;
+	waving.update(3);
+
+	CHECK(waving.actor->ttModel.m_animationLod.getLevel().updateInterval == 4);
+}
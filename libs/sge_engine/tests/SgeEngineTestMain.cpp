@@ -0,0 +1,14 @@
+#define DOCTEST_CONFIG_IMPLEMENT
+#include "doctest/doctest.h"
+
+#include "sge_engine/TypeRegister.h"
+
+int main(int argc, char* argv[]) {
+	// The tests allocate game objects, which need the reflection of their types.
+	sge::typeLib().performRegistration();
+
+	doctest::Context ctx;
+	ctx.applyCommandLine(argc, argv);
+
+	return ctx.run();
+}
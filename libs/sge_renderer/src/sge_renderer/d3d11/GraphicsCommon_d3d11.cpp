@@ -454,6 +454,12 @@ DXGI_FORMAT UniformType_GetDX_DXGI_FORMAT(const UniformType::Enum uniformType) {
 
 		case UniformType::Int_RGBA_Unorm_IA:
 			return DXGI_FORMAT_R8G8B8A8_UNORM;
+		case UniformType::Short2_Snorm_IA:
+			return DXGI_FORMAT_R16G16_SNORM;
+		case UniformType::Ushort2_Unorm_IA:
+			return DXGI_FORMAT_R16G16_UNORM;
+		case UniformType::Ushort4_Unorm_IA:
+			return DXGI_FORMAT_R16G16B16A16_UNORM;
 	};
 
 	sgeAssert(false);
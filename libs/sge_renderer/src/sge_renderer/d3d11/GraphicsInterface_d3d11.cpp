@@ -390,6 +390,41 @@ void SGEContextImmediateD3D11::clearDepth(FrameTarget* target, float depth) {
 		D3D11_GetImmContext()->ClearDepthStencilView(dsv, D3D11_CLEAR_DEPTH, depth, 0);
 }
 
+void SGEContextImmediateD3D11::copyDepth(FrameTarget* dest, FrameTarget* src) {
+	ID3D11DepthStencilView* const destDSV = dest ? ((FrameTargetD3D11*)dest)->D3D11_GetDSV() : nullptr;
+	ID3D11DepthStencilView* const srcDSV = src ? ((FrameTargetD3D11*)src)->D3D11_GetDSV() : nullptr;
+	if (destDSV == nullptr || srcDSV == nullptr) {
+		sgeAssert(false);
+		return;
+	}
+
+	sgeAssert(dest->getWidth() == src->getWidth() && dest->getHeight() == src->getHeight());
+
+	// The frame targets may use a single face or array slice of their textures, find the subresource used by the view.
+	const auto getSubresource = [](FrameTarget* const target, ID3D11DepthStencilView* const dsv) -> UINT {
+		D3D11_DEPTH_STENCIL_VIEW_DESC dsvDesc;
+		dsv->GetDesc(&dsvDesc);
+
+		const TextureDesc& texDesc = target->getDepthStencil()->getDesc();
+		const UINT numMips = texDesc.textureType == UniformType::TextureCube ? texDesc.textureCube.numMips : texDesc.texture2D.numMips;
+
+		if (dsvDesc.ViewDimension == D3D11_DSV_DIMENSION_TEXTURE2DARRAY) {
+			return D3D11CalcSubresource(dsvDesc.Texture2DArray.MipSlice, dsvDesc.Texture2DArray.FirstArraySlice, numMips);
+		} else if (dsvDesc.ViewDimension == D3D11_DSV_DIMENSION_TEXTURE2D) {
+			return dsvDesc.Texture2D.MipSlice;
+		}
+
+		return 0;
+	};
+
+	ID3D11Resource* const destResource = ((TextureD3D11*)dest->getDepthStencil())->D3D11_GetTextureResource();
+	ID3D11Resource* const srcResource = ((TextureD3D11*)src->getDepthStencil())->D3D11_GetTextureResource();
+
+	// Depth stencil resources could only be copied as whole subresources, hence no source box.
+	D3D11_GetImmContext()->CopySubresourceRegion(destResource, getSubresource(dest, destDSV), 0, 0, 0, srcResource,
+	                                             getSubresource(src, srcDSV), nullptr);
+}
+
 void* SGEContextImmediateD3D11::map(Buffer* buffer, const Map::Enum map) {
 	return ((BufferD3D11*)buffer)->map(map, this);
 }
@@ -45,6 +45,7 @@ struct SGEDeviceD3D11 : public SGEDevice {
 	BlendState* requestBlendState(const BlendStateDesc& desc) final;
 
 	const FrameStatistics& getFrameStatistics() const final { return m_frameStatistics; }
+	FrameStatistics& getFrameStatistics() final { return m_frameStatistics; }
 
 	bool D3D11_CreateSwapChain(const MainFrameTargetDesc& desc);
 	std::string D3D11_GetWorkingShaderModel(const ShaderType::Enum shaderType) const;
@@ -128,6 +129,7 @@ struct SGEContextImmediateD3D11 : public SGEContext {
 
 	void clearColor(FrameTarget* target, int index, const float rgba[4]) final;
 	void clearDepth(FrameTarget* target, float depth) final;
+	void copyDepth(FrameTarget* dest, FrameTarget* src) final;
 
 	void executeDrawCall(DrawCall& drawCall,
 	                     FrameTarget* frameTarget,
@@ -1,5 +1,7 @@
 #include "GLContextStateCache.h"
 #include "GraphicsCommon_gl.h"
+#include "sge_utils/utils/hash_combine.h"
+#include <cstring>
 
 namespace sge {
 
@@ -17,9 +19,150 @@ namespace {
 	}
 } // namespace
 
+////////////////////////////////////////////////////////////////////
+// GLFunctionTable
+////////////////////////////////////////////////////////////////////
+GLFunctionTable GLFunctionTable::CreateFromLoadedGL() {
+	GLFunctionTable table;
+
+	table.GetError = glGetError;
+
+#if !defined(__EMSCRIPTEN__)
+	table.MapBuffer = glMapBuffer;
+	table.UnmapBuffer = glUnmapBuffer;
+#endif
+	table.GenBuffers = glGenBuffers;
+	table.DeleteBuffers = glDeleteBuffers;
+	table.BindBuffer = glBindBuffer;
+	table.BindBufferBase = glBindBufferBase;
+
+	table.GenVertexArrays = glGenVertexArrays;
+	table.DeleteVertexArrays = glDeleteVertexArrays;
+	table.BindVertexArray = glBindVertexArray;
+	table.EnableVertexAttribArray = glEnableVertexAttribArray;
+	table.DisableVertexAttribArray = glDisableVertexAttribArray;
+	table.VertexAttribPointer = glVertexAttribPointer;
+	table.VertexAttribIPointer = glVertexAttribIPointer;
+
+	table.CreateProgram = glCreateProgram;
+	table.DeleteProgram = glDeleteProgram;
+	table.UseProgram = glUseProgram;
+	table.Uniform1i = glUniform1i;
+	table.Uniform1f = glUniform1f;
+	table.Uniform2fv = glUniform2fv;
+	table.Uniform3fv = glUniform3fv;
+	table.Uniform4fv = glUniform4fv;
+	table.UniformMatrix3fv = glUniformMatrix3fv;
+	table.UniformMatrix4fv = glUniformMatrix4fv;
+
+	table.GenTextures = glGenTextures;
+	table.DeleteTextures = glDeleteTextures;
+	table.ActiveTexture = glActiveTexture;
+	table.BindTexture = glBindTexture;
+
+	table.GenFramebuffers = glGenFramebuffers;
+	table.DeleteFramebuffers = glDeleteFramebuffers;
+	table.BindFramebuffer = glBindFramebuffer;
+
+	table.Viewport = glViewport;
+	table.Scissor = glScissor;
+	table.Enable = glEnable;
+	table.Disable = glDisable;
+	table.CullFace = glCullFace;
+	table.FrontFace = glFrontFace;
+#if !defined(__EMSCRIPTEN__)
+	table.PolygonMode = glPolygonMode;
+#endif
+	table.PolygonOffset = glPolygonOffset;
+	table.DepthMask = glDepthMask;
+	table.DepthFunc = glDepthFunc;
+	table.BlendFuncSeparate = glBlendFuncSeparate;
+	table.BlendEquationSeparate = glBlendEquationSeparate;
+
+	table.DrawElements = glDrawElements;
+	table.DrawElementsInstanced = glDrawElementsInstanced;
+	table.DrawArrays = glDrawArrays;
+	table.DrawArraysInstanced = glDrawArraysInstanced;
+
+	return table;
+}
+
+////////////////////////////////////////////////////////////////////
+// GLContextStateCache::VertexArrayKey
+////////////////////////////////////////////////////////////////////
+bool GLContextStateCache::VertexArrayKey::operator==(const VertexArrayKey& other) const {
+	if (program != other.program || vertexDeclIndex != other.vertexDeclIndex || indexBuffer != other.indexBuffer ||
+	    baseVertex != other.baseVertex) {
+		return false;
+	}
+
+	for (int iSlot = 0; iSlot < GraphicsCaps::kVertexBufferSlotsCount; ++iSlot) {
+		if (vertexBuffers[iSlot] != other.vertexBuffers[iSlot] || vertexBufferStrides[iSlot] != other.vertexBufferStrides[iSlot]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool GLContextStateCache::VertexArrayKey::referencesBuffer(const GLuint buffer) const {
+	if (buffer == 0) {
+		return false;
+	}
+
+	if (indexBuffer == buffer) {
+		return true;
+	}
+
+	for (const GLuint vertexBuffer : vertexBuffers) {
+		if (vertexBuffer == buffer) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+size_t GLContextStateCache::VertexArrayKeyHasher::operator()(const VertexArrayKey& key) const {
+	size_t hash = size_t(key.program);
+	hash = hash_combine(hash, size_t(key.vertexDeclIndex));
+	hash = hash_combine(hash, size_t(key.indexBuffer));
+	hash = hash_combine(hash, size_t(key.baseVertex));
+
+	for (int iSlot = 0; iSlot < GraphicsCaps::kVertexBufferSlotsCount; ++iSlot) {
+		hash = hash_combine(hash, size_t(key.vertexBuffers[iSlot]));
+		hash = hash_combine(hash, size_t(key.vertexBufferStrides[iSlot]));
+	}
+
+	return hash;
+}
+
 ////////////////////////////////////////////////////////////////////
 // GLContextStateCache
 ////////////////////////////////////////////////////////////////////
+void GLContextStateCache::Initialize(const GLFunctionTable& functions, FrameStatistics* const frameStatistics) {
+	m_gl = functions;
+	m_frameStatistics = frameStatistics;
+
+	// The default vertex array is used for everything except the draw calls (uploading data to the buffers and so on).
+	// The draw calls use the cached vertex arrays (see BindVertexArray).
+	m_gl.GenVertexArrays(1, &m_defaultVertexArray);
+	BindVertexArrayObject(m_defaultVertexArray);
+	DumpAllErrors();
+}
+
+void GLContextStateCache::DumpAllErrors() {
+	// Dumping errors for EMSCRIPTEN builds is disabled by default it is way to slow.
+#if !defined(__EMSCRIPTEN__)
+	GLenum opengl_error_code = m_gl.GetError();
+	while (opengl_error_code != GL_NO_ERROR) {
+		DumpGLError(opengl_error_code);
+		sgeAssert(false);
+		opengl_error_code = m_gl.GetError();
+	}
+#endif
+}
+
 void* GLContextStateCache::MapBuffer(const GLenum target, const GLenum access) {
 #if !defined(__EMSCRIPTEN__)
 	// add some debug error checking because
@@ -35,8 +178,8 @@ void* GLContextStateCache::MapBuffer(const GLenum target, const GLenum access) {
 	}
 
 	m_boundBuffers[freq].isMapped = true;
-	void* result = glMapBuffer(target, access);
-	DumpAllGLErrors();
+	void* result = m_gl.MapBuffer(target, access);
+	DumpAllErrors();
 	return result;
 #endif
 }
@@ -57,7 +200,7 @@ void GLContextStateCache::UnmapBuffer(const GLenum target) {
 	sgeAssert(m_boundBuffers[freq].isMapped == true);
 
 	m_boundBuffers[freq].isMapped = false;
-	glUnmapBuffer(target);
+	m_gl.UnmapBuffer(target);
 #endif
 }
 
@@ -80,6 +223,11 @@ void GLContextStateCache::BindBuffer(const GLenum bufferTarget, const GLuint buf
 	//
 	const BUFFER_FREQUENCY freq = GetBufferTargetByFrequency(bufferTarget);
 
+	// The cached vertex arrays must not be modified after they are created.
+	if (freq == BUFFER_FREQUENCY_ELEMENT_ARRAY && m_vertexArray != m_defaultVertexArray && m_boundBuffers[freq].buffer != buffer) {
+		BindDefaultVertexArray();
+	}
+
 #if SGE_GL_CONTEXT_STRICT
 	if (m_boundBuffers[freq].isMapped) {
 		SGE_DEBUG_ERR("SGE GLContext API PROHIBITS Buffer Binding when currently bound buffer on that slot is mapped!");
@@ -87,8 +235,8 @@ void GLContextStateCache::BindBuffer(const GLenum bufferTarget, const GLuint buf
 #endif
 
 	if (UPDATE_ON_DIFF(m_boundBuffers[freq].buffer, buffer)) {
-		glBindBuffer(bufferTarget, buffer);
-		DumpAllGLErrors();
+		m_gl.BindBuffer(bufferTarget, buffer);
+		DumpAllErrors();
 	}
 }
 
@@ -112,12 +260,12 @@ void GLContextStateCache::SetVertexAttribSlotState(const bool bEnabled,
 		currentState.isEnabled = bEnabled;
 		if (currentState.isEnabled) {
 			justEnabled = true;
-			glEnableVertexAttribArray(index);
+			m_gl.EnableVertexAttribArray(index);
 		} else {
-			glDisableVertexAttribArray(index);
+			m_gl.DisableVertexAttribArray(index);
 		}
 
-		DumpAllGLErrors();
+		DumpAllErrors();
 	}
 
 	if (currentState.isEnabled) {
@@ -126,7 +274,7 @@ void GLContextStateCache::SetVertexAttribSlotState(const bool bEnabled,
 		                       (currentState.byteOffset != byteOffset);
 
 		BindBuffer(GL_ARRAY_BUFFER, buffer);
-		DumpAllGLErrors();
+		DumpAllErrors();
 
 		if (stateDiff || justEnabled) {
 			currentState.buffer = buffer;
@@ -143,13 +291,13 @@ void GLContextStateCache::SetVertexAttribSlotState(const bool bEnabled,
 			// Even if we specify GL_INT as a type. glGetError will not report any errors,
 			// but in shader we will not get the integers we've specified.
 			if (currentState.type == GL_INT || currentState.type == GL_UNSIGNED_INT) {
-				glVertexAttribIPointer(index, currentState.size, currentState.type, currentState.stride,
+				m_gl.VertexAttribIPointer(index, currentState.size, currentState.type, currentState.stride,
 				                       (GLvoid*)(std::ptrdiff_t(currentState.byteOffset)));
 			} else {
-				glVertexAttribPointer(index, currentState.size, currentState.type, currentState.normalized, currentState.stride,
+				m_gl.VertexAttribPointer(index, currentState.size, currentState.type, currentState.normalized, currentState.stride,
 				                      (GLvoid*)(std::ptrdiff_t(currentState.byteOffset)));
 			}
-			DumpAllGLErrors();
+			DumpAllErrors();
 		}
 	}
 }
@@ -157,25 +305,90 @@ void GLContextStateCache::SetVertexAttribSlotState(const bool bEnabled,
 //---------------------------------------------------------------------
 void GLContextStateCache::UseProgram(const GLuint program) {
 	if (UPDATE_ON_DIFF(m_program, program)) {
-		glUseProgram(program);
+		m_gl.UseProgram(program);
+		m_programUniformValues = (program != 0) ? &m_uniformValues[program] : nullptr;
+
+		if (m_frameStatistics) {
+			m_frameStatistics->numProgramChanges++;
+		}
 	}
 }
 
 //---------------------------------------------------------------------
 void GLContextStateCache::BindUniformBuffer(const GLuint index, const GLuint buffer) {
 	if (UPDATE_ON_DIFF(m_uniformBuffers[index], buffer)) {
-		glBindBufferBase(GL_UNIFORM_BUFFER, index, buffer);
+		m_gl.BindBufferBase(GL_UNIFORM_BUFFER, index, buffer);
+
+		if (m_frameStatistics) {
+			m_frameStatistics->numBufferChanges++;
+		}
 	}
 }
 
+//---------------------------------------------------------------------
+void GLContextStateCache::SetUniform(const GLint location, const UniformType::Enum type, const GLsizei arraySize, const void* const data) {
+	sgeAssert(m_program != 0 && data != nullptr);
+
+	const GLsizei count = (type == UniformType::Int || type == UniformType::Float) ? 1 : arraySize;
+	const size_t numBytes = size_t(UniformType::GetSizeBytes(type)) * size_t(count);
+
+	// Skip the upload if the program already has this value.
+	if (m_programUniformValues != nullptr && location >= 0 && location < kMaxCachedUniformLocation) {
+		if (m_programUniformValues->size() <= size_t(location)) {
+			m_programUniformValues->resize(location + 1);
+		}
+
+		std::vector<char>& lastValue = (*m_programUniformValues)[location];
+		if (lastValue.size() == numBytes && memcmp(lastValue.data(), data, numBytes) == 0) {
+			return;
+		}
+
+		lastValue.assign((const char*)data, (const char*)data + numBytes);
+	}
+
+	switch (type) {
+		case UniformType::Int:
+			m_gl.Uniform1i(location, *(const int*)data);
+			break;
+		case UniformType::Float:
+			m_gl.Uniform1f(location, *(const float*)data);
+			break;
+		case UniformType::Float2:
+			m_gl.Uniform2fv(location, count, (const float*)data);
+			break;
+		case UniformType::Float3:
+			m_gl.Uniform3fv(location, count, (const float*)data);
+			break;
+		case UniformType::Float4:
+			m_gl.Uniform4fv(location, count, (const float*)data);
+			break;
+		case UniformType::Float3x3:
+			m_gl.UniformMatrix3fv(location, count, GL_FALSE, (const float*)data);
+			break;
+		case UniformType::Float4x4:
+			m_gl.UniformMatrix4fv(location, count, GL_FALSE, (const float*)data);
+			break;
+		default:
+			// Unsupported numeric uniform type.
+			sgeAssert(false);
+			return;
+	}
+
+	if (m_frameStatistics) {
+		m_frameStatistics->numUniformChanges++;
+	}
+
+	DumpAllErrors();
+}
+
 //---------------------------------------------------------------------
 void GLContextStateCache::SetActiveTexture(const GLenum activeSlot) {
 	sgeAssert(activeSlot >= GL_TEXTURE0 && activeSlot <= GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS);
 
 	if (m_activeTexture != activeSlot) {
 		m_activeTexture = activeSlot;
-		glActiveTexture(activeSlot);
-		DumpAllGLErrors();
+		m_gl.ActiveTexture(activeSlot);
+		DumpAllErrors();
 	}
 }
 
@@ -193,10 +406,14 @@ void GLContextStateCache::BindTexture(const GLenum texTarget, const GLuint textu
 		}
 	}
 
+	if (m_frameStatistics) {
+		m_frameStatistics->numTextureChanges++;
+	}
+
 	if (pSlotData) // the binding location(slot, texTarget) is found but the resource is different
 	{
 		pSlotData->resource = texture;
-		glBindTexture(texTarget, texture);
+		m_gl.BindTexture(texTarget, texture);
 	} else {
 		// the binding location isn't found
 		BoundTexture boundTex;
@@ -211,8 +428,8 @@ void GLContextStateCache::BindTexture(const GLenum texTarget, const GLuint textu
 		// increase the array size and recompile or something
 		sgeAssert(success);
 
-		glBindTexture(texTarget, texture);
-		DumpAllGLErrors();
+		m_gl.BindTexture(texTarget, texture);
+		DumpAllErrors();
 	}
 }
 
@@ -220,7 +437,74 @@ void GLContextStateCache::BindTexture(const GLenum texTarget, const GLuint textu
 void GLContextStateCache::BindTextureEx(const GLenum texTarget, const GLenum activeSlot, const GLuint texture) {
 	SetActiveTexture(activeSlot);
 	BindTexture(texTarget, texture);
-	DumpAllGLErrors();
+	DumpAllErrors();
+}
+
+//---------------------------------------------------------------------
+bool GLContextStateCache::BindVertexArray(const VertexArrayKey& key) {
+	const auto itr = m_vertexArrays.find(key);
+	if (itr != m_vertexArrays.end()) {
+		if (m_vertexArray != itr->second) {
+			BindVertexArrayObject(itr->second);
+			m_boundBuffers[BUFFER_FREQUENCY_ELEMENT_ARRAY].buffer = key.indexBuffer;
+		}
+		return false;
+	}
+
+	if (int(m_vertexArrays.size()) >= kMaxCachedVertexArrays) {
+		DeleteAllCachedVertexArrays();
+	}
+
+	GLuint vertexArray = 0;
+	m_gl.GenVertexArrays(1, &vertexArray);
+	m_vertexArrays[key] = vertexArray;
+	BindVertexArrayObject(vertexArray);
+
+	// A new vertex array has all attributes disabled and no index buffer.
+	m_vertAttribPointers.fill(VertexAttribSlotDesc());
+	m_boundBuffers[BUFFER_FREQUENCY_ELEMENT_ARRAY].buffer = key.indexBuffer;
+	if (key.indexBuffer != 0) {
+		m_gl.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, key.indexBuffer);
+	}
+
+	DumpAllErrors();
+	return true;
+}
+
+void GLContextStateCache::BindDefaultVertexArray() {
+	if (m_vertexArray != m_defaultVertexArray) {
+		BindVertexArrayObject(m_defaultVertexArray);
+
+		// The index buffer of the default vertex array isn't tracked while other vertex arrays are bound.
+		// Imagine that a buffer with index max(GLuint) is bound, so the next binding actually happens.
+		m_boundBuffers[BUFFER_FREQUENCY_ELEMENT_ARRAY].buffer = std::numeric_limits<GLuint>::max();
+	}
+}
+
+void GLContextStateCache::BindVertexArrayObject(const GLuint vertexArray) {
+	m_vertexArray = vertexArray;
+	m_gl.BindVertexArray(vertexArray);
+
+	if (m_frameStatistics && vertexArray != m_defaultVertexArray) {
+		m_frameStatistics->numBufferChanges++;
+	}
+}
+
+void GLContextStateCache::DeleteVertexArrayObject(const GLuint vertexArray) {
+	// Deleting the bound vertex array would leave no vertex array bound.
+	if (m_vertexArray == vertexArray) {
+		BindDefaultVertexArray();
+	}
+
+	GLuint vertexArrayToDelete = vertexArray;
+	m_gl.DeleteVertexArrays(1, &vertexArrayToDelete);
+}
+
+void GLContextStateCache::DeleteAllCachedVertexArrays() {
+	for (const auto& itr : m_vertexArrays) {
+		DeleteVertexArrayObject(itr.second);
+	}
+	m_vertexArrays.clear();
 }
 
 //---------------------------------------------------------------------
@@ -231,16 +515,16 @@ void GLContextStateCache::BindFBO(const GLuint fbo) {
 
 	// GL_FRAMEBUFFER is the only possible argument.... currently!
 	// https://www.khronos.org/opengles/sdk/docs/man/xhtml/glBindFramebuffer.xml
-	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-	DumpAllGLErrors();
+	m_gl.BindFramebuffer(GL_FRAMEBUFFER, fbo);
+	DumpAllErrors();
 }
 
 //---------------------------------------------------------------------
 void GLContextStateCache::setViewport(const sge::GLViewport& vp) {
 	if (UPDATE_ON_DIFF(m_viewport.second, vp) || !m_viewport.first) {
-		glViewport(vp.x, vp.y, vp.width, vp.height);
+		m_gl.Viewport(vp.x, vp.y, vp.width, vp.height);
 		m_viewport.first = true;
-		DumpAllGLErrors();
+		DumpAllErrors();
 	}
 }
 
@@ -250,17 +534,17 @@ void GLContextStateCache::ApplyRasterDesc(const RasterDesc& desc) {
 	if (UPDATE_ON_DIFF(m_rasterDesc.cullMode, desc.cullMode)) {
 		switch (desc.cullMode) {
 			case CullMode::Back:
-				glEnable(GL_CULL_FACE);
-				glCullFace(GL_BACK);
+				m_gl.Enable(GL_CULL_FACE);
+				m_gl.CullFace(GL_BACK);
 				break;
 
 			case CullMode::Front:
-				glEnable(GL_CULL_FACE);
-				glCullFace(GL_FRONT);
+				m_gl.Enable(GL_CULL_FACE);
+				m_gl.CullFace(GL_FRONT);
 				break;
 
 			case CullMode::None:
-				glDisable(GL_CULL_FACE);
+				m_gl.Disable(GL_CULL_FACE);
 				break;
 
 			default:
@@ -271,23 +555,23 @@ void GLContextStateCache::ApplyRasterDesc(const RasterDesc& desc) {
 
 	if (UPDATE_ON_DIFF(m_rasterDesc.backFaceCCW, desc.backFaceCCW)) {
 		if (m_rasterDesc.backFaceCCW)
-			glFrontFace(GL_CW);
+			m_gl.FrontFace(GL_CW);
 		else
-			glFrontFace(GL_CCW);
+			m_gl.FrontFace(GL_CCW);
 	}
 
-	DumpAllGLErrors();
+	DumpAllErrors();
 
 	// Fillmode.
 #if !defined(__EMSCRIPTEN__) // WebGL 2 does't support fill mode.
 	if (UPDATE_ON_DIFF(m_rasterDesc.fillMode, desc.fillMode)) {
 		switch (desc.fillMode) {
 			case FillMode::Solid:
-				glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+				m_gl.PolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 				break;
 
 			case FillMode::Wireframe:
-				glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+				m_gl.PolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 				break;
 
 			default:
@@ -317,24 +601,24 @@ void GLContextStateCache::ApplyRasterDesc(const RasterDesc& desc) {
 
 		if (mode != GL_INVALID_ENUM) {
 			if (m_rasterDesc.depthBiasAdd != 0.f || m_rasterDesc.depthBiasSlope != 0.f) {
-				glEnable(mode);
+				m_gl.Enable(mode);
 			}
 
-			glPolygonOffset(m_rasterDesc.depthBiasSlope, m_rasterDesc.depthBiasAdd);
+			m_gl.PolygonOffset(m_rasterDesc.depthBiasSlope, m_rasterDesc.depthBiasAdd);
 		} else {
-			glPolygonOffset(0.f, 0.f);
+			m_gl.PolygonOffset(0.f, 0.f);
 		}
 	}
 
 	// Scissors.
 	if (UPDATE_ON_DIFF(m_rasterDesc.useScissor, desc.useScissor)) {
 		if (desc.useScissor)
-			glEnable(GL_SCISSOR_TEST);
+			m_gl.Enable(GL_SCISSOR_TEST);
 		else
-			glDisable(GL_SCISSOR_TEST);
+			m_gl.Disable(GL_SCISSOR_TEST);
 	}
 
-	DumpAllGLErrors();
+	DumpAllErrors();
 }
 
 //---------------------------------------------------------------------
@@ -350,56 +634,56 @@ void GLContextStateCache::ApplyScissorsRect(GLint x, GLint y, GLsizei width, GLs
 	m_scissorsRect.width = width;
 	m_scissorsRect.height = height;
 
-	glScissor(x, y, width, height);
-	DumpAllGLErrors();
+	m_gl.Scissor(x, y, width, height);
+	DumpAllErrors();
 }
 
 void GLContextStateCache::DepthMask(const GLboolean enabled) {
 	if (UPDATE_ON_DIFF(m_depthStencilDesc.depthWriteEnabled, enabled == GL_TRUE)) {
 		if (enabled)
-			glDepthMask(GL_TRUE);
+			m_gl.DepthMask(GL_TRUE);
 		else
-			glDepthMask(GL_FALSE);
-		DumpAllGLErrors();
+			m_gl.DepthMask(GL_FALSE);
+		DumpAllErrors();
 	}
 }
 
 void GLContextStateCache::ApplyDepthStencilDesc(const DepthStencilDesc& desc) {
 	if (UPDATE_ON_DIFF(m_depthStencilDesc.depthTestEnabled, desc.depthTestEnabled)) {
 		if (desc.depthTestEnabled)
-			glEnable(GL_DEPTH_TEST);
+			m_gl.Enable(GL_DEPTH_TEST);
 		else
-			glDisable(GL_DEPTH_TEST);
-		DumpAllGLErrors();
+			m_gl.Disable(GL_DEPTH_TEST);
+		DumpAllErrors();
 	}
 
 	DepthMask(desc.depthWriteEnabled ? GL_TRUE : GL_FALSE);
 
 	if (UPDATE_ON_DIFF(m_depthStencilDesc.comparisonFunc, desc.comparisonFunc)) {
-		glDepthFunc(DepthComparisonFunc_GetGLNative(desc.comparisonFunc));
-		DumpAllGLErrors();
+		m_gl.DepthFunc(DepthComparisonFunc_GetGLNative(desc.comparisonFunc));
+		DumpAllErrors();
 	}
 }
 
 void GLContextStateCache::ApplyBlendState(const BlendDesc& blendDesc) {
 	if (UPDATE_ON_DIFF(m_blendDesc, blendDesc)) {
 		if (m_blendDesc.enabled)
-			glEnable(GL_BLEND);
+			m_gl.Enable(GL_BLEND);
 		else
-			glDisable(GL_BLEND);
+			m_gl.Disable(GL_BLEND);
 		//}
 
 		// if(m_blendDesc != blendDesc)
 		//{
-		glBlendFuncSeparate(Blend_GetGLNative(m_blendDesc.srcBlend), Blend_GetGLNative(m_blendDesc.destBlend),
+		m_gl.BlendFuncSeparate(Blend_GetGLNative(m_blendDesc.srcBlend), Blend_GetGLNative(m_blendDesc.destBlend),
 		                    Blend_GetGLNative(m_blendDesc.alphaSrcBlend), Blend_GetGLNative(m_blendDesc.alphaDestBlend));
 
-		glBlendEquationSeparate(BlendOp_GetGLNative(m_blendDesc.blendOp), BlendOp_GetGLNative(m_blendDesc.alphaBlendOp));
+		m_gl.BlendEquationSeparate(BlendOp_GetGLNative(m_blendDesc.blendOp), BlendOp_GetGLNative(m_blendDesc.alphaBlendOp));
 
 		m_blendDesc = blendDesc;
 	}
 
-	DumpAllGLErrors();
+	DumpAllErrors();
 }
 
 //---------------------------------------------------------------------
@@ -409,11 +693,11 @@ void GLContextStateCache::DrawElements(const GLenum primTopology,
                                        const GLvoid* indices,
                                        const GLsizei instanceCount) {
 	if (instanceCount == 1)
-		glDrawElements(primTopology, numIndices, elemArrayBufferFormat, indices);
+		m_gl.DrawElements(primTopology, numIndices, elemArrayBufferFormat, indices);
 	else
-		glDrawElementsInstanced(primTopology, numIndices, elemArrayBufferFormat, indices, instanceCount);
+		m_gl.DrawElementsInstanced(primTopology, numIndices, elemArrayBufferFormat, indices, instanceCount);
 
-	DumpAllGLErrors();
+	DumpAllErrors();
 }
 
 //---------------------------------------------------------------------
@@ -422,17 +706,17 @@ void GLContextStateCache::DrawArrays(const GLenum primTopology,
                                      const GLuint numVerts,
                                      const GLsizei instanceCount) {
 	if (instanceCount == 1)
-		glDrawArrays(primTopology, startVertex, numVerts);
+		m_gl.DrawArrays(primTopology, startVertex, numVerts);
 	else
-		glDrawArraysInstanced(primTopology, startVertex, numVerts, instanceCount);
+		m_gl.DrawArraysInstanced(primTopology, startVertex, numVerts, instanceCount);
 
-	DumpAllGLErrors();
+	DumpAllErrors();
 }
 
 //---------------------------------------------------------------------
 void GLContextStateCache::GenBuffers(const GLsizei numBuffers, GLuint* const buffers) {
 	sgeAssert(buffers != nullptr && numBuffers > 0);
-	glGenBuffers(numBuffers, buffers);
+	m_gl.GenBuffers(numBuffers, buffers);
 }
 
 void GLContextStateCache::DeleteBuffers(const GLsizei numBuffers, GLuint* const buffers) {
@@ -452,11 +736,13 @@ void GLContextStateCache::DeleteBuffers(const GLsizei numBuffers, GLuint* const
 			}
 		}
 
-		// Input assembler
-		for (int t = 0; t < m_vertAttribPointers.size(); ++t) {
-			auto& vad = m_vertAttribPointers[t];
-			if (vad.buffer == buffer) {
-				SetVertexAttribSlotState(false, t, 0, 1, GL_FLOAT, GL_FALSE, 0, 0);
+		// Input assembler. The vertex arrays reading from the buffer are no longer usable.
+		for (auto itr = m_vertexArrays.begin(); itr != m_vertexArrays.end();) {
+			if (itr->first.referencesBuffer(buffer)) {
+				DeleteVertexArrayObject(itr->second);
+				itr = m_vertexArrays.erase(itr);
+			} else {
+				++itr;
 			}
 		}
 
@@ -469,14 +755,14 @@ void GLContextStateCache::DeleteBuffers(const GLsizei numBuffers, GLuint* const
 	}
 
 	// And finally delete the buffers.
-	glDeleteBuffers(numBuffers, buffers);
+	m_gl.DeleteBuffers(numBuffers, buffers);
 }
 
 //---------------------------------------------------------------------
 void GLContextStateCache::GenTextures(const GLsizei numTextures, GLuint* const textures) {
 	sgeAssert(textures != nullptr && numTextures > 0);
-	glGenTextures(numTextures, textures);
-	DumpAllGLErrors();
+	m_gl.GenTextures(numTextures, textures);
+	DumpAllErrors();
 }
 
 void GLContextStateCache::DeleteTextures(const GLsizei numTextures, GLuint* const textures) {
@@ -493,13 +779,13 @@ void GLContextStateCache::DeleteTextures(const GLsizei numTextures, GLuint* cons
 		}
 	}
 
-	glDeleteTextures(numTextures, textures);
+	m_gl.DeleteTextures(numTextures, textures);
 }
 
 //---------------------------------------------------------------------
 void GLContextStateCache::GenFrameBuffers(const GLsizei n, GLuint* ids) {
 	sgeAssert(n > 0 && ids != NULL);
-	glGenFramebuffers(n, ids);
+	m_gl.GenFramebuffers(n, ids);
 }
 
 //---------------------------------------------------------------------
@@ -513,15 +799,27 @@ void GLContextStateCache::DeleteFrameBuffers(const GLsizei n, GLuint* ids) {
 	}
 
 	sgeAssert(n > 0 && ids != NULL);
-	glDeleteFramebuffers(n, ids);
+	m_gl.DeleteFramebuffers(n, ids);
 }
 //---------------------------------------------------------------------
 void GLContextStateCache::DeleteProgram(GLuint program) {
 	if (program == m_program) {
 		m_program = 0;
+		m_programUniformValues = nullptr;
+	}
+
+	// The program id could be reused by a new program with different uniforms and attribute locations.
+	m_uniformValues.erase(program);
+	for (auto itr = m_vertexArrays.begin(); itr != m_vertexArrays.end();) {
+		if (itr->first.program == program) {
+			DeleteVertexArrayObject(itr->second);
+			itr = m_vertexArrays.erase(itr);
+		} else {
+			++itr;
+		}
 	}
 
-	glDeleteProgram(program);
+	m_gl.DeleteProgram(program);
 }
 
 //---------------------------------------------------------------------
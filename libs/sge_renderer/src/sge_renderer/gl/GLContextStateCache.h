@@ -17,8 +17,89 @@
 
 #include <sge_utils/math/Box.h>
 
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
 namespace sge {
 
+////////////////////////////////////////////////////////////////////
+// GLFunctionTable
+//
+// The OpenGL functions called by GLContextStateCache.
+// The device fills the table with the loaded OpenGL functions.
+// The tests fill it with mocks, in order to check the state filtering
+// without an OpenGL context.
+////////////////////////////////////////////////////////////////////
+struct GLFunctionTable {
+	// glew declares most of the functions as pointers, the rest of them (and all on Emscripten) are actual functions.
+	template <typename T>
+	using FnPtr = typename std::decay<T>::type;
+
+	/// Fills the table with the functions of the current OpenGL context.
+	/// Must be called after the functions are loaded (glewInit).
+	static GLFunctionTable CreateFromLoadedGL();
+
+	FnPtr<decltype(glGetError)> GetError = nullptr;
+
+#if !defined(__EMSCRIPTEN__)
+	FnPtr<decltype(glMapBuffer)> MapBuffer = nullptr;
+	FnPtr<decltype(glUnmapBuffer)> UnmapBuffer = nullptr;
+#endif
+	FnPtr<decltype(glGenBuffers)> GenBuffers = nullptr;
+	FnPtr<decltype(glDeleteBuffers)> DeleteBuffers = nullptr;
+	FnPtr<decltype(glBindBuffer)> BindBuffer = nullptr;
+	FnPtr<decltype(glBindBufferBase)> BindBufferBase = nullptr;
+
+	FnPtr<decltype(glGenVertexArrays)> GenVertexArrays = nullptr;
+	FnPtr<decltype(glDeleteVertexArrays)> DeleteVertexArrays = nullptr;
+	FnPtr<decltype(glBindVertexArray)> BindVertexArray = nullptr;
+	FnPtr<decltype(glEnableVertexAttribArray)> EnableVertexAttribArray = nullptr;
+	FnPtr<decltype(glDisableVertexAttribArray)> DisableVertexAttribArray = nullptr;
+	FnPtr<decltype(glVertexAttribPointer)> VertexAttribPointer = nullptr;
+	FnPtr<decltype(glVertexAttribIPointer)> VertexAttribIPointer = nullptr;
+
+	FnPtr<decltype(glCreateProgram)> CreateProgram = nullptr;
+	FnPtr<decltype(glDeleteProgram)> DeleteProgram = nullptr;
+	FnPtr<decltype(glUseProgram)> UseProgram = nullptr;
+	FnPtr<decltype(glUniform1i)> Uniform1i = nullptr;
+	FnPtr<decltype(glUniform1f)> Uniform1f = nullptr;
+	FnPtr<decltype(glUniform2fv)> Uniform2fv = nullptr;
+	FnPtr<decltype(glUniform3fv)> Uniform3fv = nullptr;
+	FnPtr<decltype(glUniform4fv)> Uniform4fv = nullptr;
+	FnPtr<decltype(glUniformMatrix3fv)> UniformMatrix3fv = nullptr;
+	FnPtr<decltype(glUniformMatrix4fv)> UniformMatrix4fv = nullptr;
+
+	FnPtr<decltype(glGenTextures)> GenTextures = nullptr;
+	FnPtr<decltype(glDeleteTextures)> DeleteTextures = nullptr;
+	FnPtr<decltype(glActiveTexture)> ActiveTexture = nullptr;
+	FnPtr<decltype(glBindTexture)> BindTexture = nullptr;
+
+	FnPtr<decltype(glGenFramebuffers)> GenFramebuffers = nullptr;
+	FnPtr<decltype(glDeleteFramebuffers)> DeleteFramebuffers = nullptr;
+	FnPtr<decltype(glBindFramebuffer)> BindFramebuffer = nullptr;
+
+	FnPtr<decltype(glViewport)> Viewport = nullptr;
+	FnPtr<decltype(glScissor)> Scissor = nullptr;
+	FnPtr<decltype(glEnable)> Enable = nullptr;
+	FnPtr<decltype(glDisable)> Disable = nullptr;
+	FnPtr<decltype(glCullFace)> CullFace = nullptr;
+	FnPtr<decltype(glFrontFace)> FrontFace = nullptr;
+#if !defined(__EMSCRIPTEN__)
+	FnPtr<decltype(glPolygonMode)> PolygonMode = nullptr;
+#endif
+	FnPtr<decltype(glPolygonOffset)> PolygonOffset = nullptr;
+	FnPtr<decltype(glDepthMask)> DepthMask = nullptr;
+	FnPtr<decltype(glDepthFunc)> DepthFunc = nullptr;
+	FnPtr<decltype(glBlendFuncSeparate)> BlendFuncSeparate = nullptr;
+	FnPtr<decltype(glBlendEquationSeparate)> BlendEquationSeparate = nullptr;
+
+	FnPtr<decltype(glDrawElements)> DrawElements = nullptr;
+	FnPtr<decltype(glDrawElementsInstanced)> DrawElementsInstanced = nullptr;
+	FnPtr<decltype(glDrawArrays)> DrawArrays = nullptr;
+	FnPtr<decltype(glDrawArraysInstanced)> DrawArraysInstanced = nullptr;
+};
+
 ////////////////////////////////////////////////////////////////////
 // GLContextStateCache
 ////////////////////////////////////////////////////////////////////
@@ -66,6 +147,36 @@ struct GLContextStateCache {
 		GLuint resource = 0;
 	};
 
+	// Identifies a vertex array object by the state recorded in it.
+	// The attribute layout is defined by the program and the vertex declaration,
+	// the rest defines where the attributes are read from.
+	struct VertexArrayKey {
+		GLuint program = 0;
+		VertexDeclIndex vertexDeclIndex = VertexDeclIndex_Null;
+		GLuint indexBuffer = 0;
+		// The base vertex of the indexed draw calls is baked into the attribute offsets (see executeDrawCall).
+		GLuint baseVertex = 0;
+		GLuint vertexBuffers[GraphicsCaps::kVertexBufferSlotsCount] = {0};
+		GLuint vertexBufferStrides[GraphicsCaps::kVertexBufferSlotsCount] = {0};
+
+		bool operator==(const VertexArrayKey& other) const;
+		bool operator!=(const VertexArrayKey& other) const { return !(*this == other); }
+
+		/// Returns true if the vertex array reads from the specified buffer.
+		bool referencesBuffer(const GLuint buffer) const;
+	};
+
+	struct VertexArrayKeyHasher {
+		size_t operator()(const VertexArrayKey& key) const;
+	};
+
+	// The cached vertex arrays are dropped when there are more of them than this,
+	// as draw calls with different buffers or base vertices would add new ones every frame.
+	static constexpr int kMaxCachedVertexArrays = 1024;
+
+	// The values of uniforms with locations above this one aren't cached and are always uploaded.
+	static constexpr GLint kMaxCachedUniformLocation = 1024;
+
   public:
 	GLContextStateCache() {
 		//[TODO] Proper default OpenGL states.
@@ -80,6 +191,10 @@ struct GLContextStateCache {
 		m_viewport.first = false;
 	}
 
+	// Sets the OpenGL functions to be called, the statistics to be updated with the state changes (could be nullptr)
+	// and creates the default vertex array. Must be called before anything else.
+	void Initialize(const GLFunctionTable& functions, FrameStatistics* const frameStatistics);
+
 	// https://www.opengl.org/sdk/docs/man/html/glMapBuffer.xhtml
 	void* MapBuffer(const GLenum target,
 	                const GLenum access // = GL_READ_ONLY, GL_WRITE_ONLY, GL_READ_WRITE
@@ -93,14 +208,25 @@ struct GLContextStateCache {
 
 	//@bufferTarget - GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, ect...
 	//@buffer - buffer to bind
+	// The GL_ELEMENT_ARRAY_BUFFER binding is a part of the vertex array state, binding another index buffer
+	// while a cached vertex array is bound switches to the default vertex array, so the cached ones stay intact.
 	void BindBuffer(const GLenum bufferTarget, const GLuint buffer);
 
+	// Binds the cached vertex array object for @key.
+	// Returns true if there wasn't such vertex array, in that case a new one is created, bound and
+	// its index buffer is set. The caller must set the attributes with SetVertexAttribSlotState.
+	bool BindVertexArray(const VertexArrayKey& key);
+
+	// Binds the vertex array used outside of the draw calls.
+	void BindDefaultVertexArray();
+
 	//
 	//[NOTE]Just don't use that function
 	//@index - attribute pointer index
 	//@enabled - should vertex attrib be enabled. If false or buffer == 0 then the call to glVertexAttribPointer is bypassed
 	//@attribData - glVertexAttribPointer arguments excluding index
 	// void BindVertexAttribPointer2(const GLuint index, const bool enabled, const VertexAttribPointerData2& attribData);
+	// Should be called only for vertex arrays that were just created by BindVertexArray.
 	void SetVertexAttribSlotState(const bool bEnabled,
 	                              const GLuint index,
 	                              const GLuint buffer,
@@ -119,6 +245,11 @@ struct GLContextStateCache {
 	//@buffer - uniform buffer to be bound
 	void BindUniformBuffer(const GLuint index, const GLuint buffer);
 
+	// Calls glUniform* for the numeric uniform at @location of the used program,
+	// unless the program already has the same value there (uniform values are a part of the program state).
+	// Int and Float uniforms are always set as a single value, @arraySize is used only for the vector and matrix types.
+	void SetUniform(const GLint location, const UniformType::Enum type, const GLsizei arraySize, const void* const data);
+
 	// update the currently active texture
 	//@activeSlot - this should be activeSlot = GL_TEXTURE0 + N;
 	void SetActiveTexture(const GLenum activeSlot);
@@ -154,10 +285,23 @@ struct GLContextStateCache {
 	void GenFrameBuffers(const GLsizei n, GLuint* ids);
 	void DeleteFrameBuffers(const GLsizei n, GLuint* ids);
 
-	GLuint CreateProgram() { return glCreateProgram(); }
+	GLuint CreateProgram() { return m_gl.CreateProgram(); }
 	void DeleteProgram(GLuint program);
 
+	int getNumCachedVertexArrays() const { return int(m_vertexArrays.size()); }
+
   private:
+	// Calls glGetError (from the function table) and reports the errors.
+	void DumpAllErrors();
+
+	void BindVertexArrayObject(const GLuint vertexArray);
+	void DeleteVertexArrayObject(const GLuint vertexArray);
+	void DeleteAllCachedVertexArrays();
+
+  private:
+	GLFunctionTable m_gl;
+	FrameStatistics* m_frameStatistics = nullptr;
+
 	RasterDesc m_rasterDesc = {false, CullMode::Back, FillMode::Solid, false};
 	ScissorRect m_scissorsRect;
 	DepthStencilDesc m_depthStencilDesc;
@@ -193,11 +337,22 @@ struct GLContextStateCache {
 	GLuint m_program = 0;
 
 	// aguments of glBindBufferBase(GL_UNIFORM_BUFFER, idx, uniformBuffers[idx])
-	std::array<GLuint, 16> m_uniformBuffers;
+	std::array<GLuint, 16> m_uniformBuffers = {};
 
 	// THe bound framebuffer;
 	GLuint m_frameBuffer = 0;
 
+	// The vertex array used outside of the draw calls and the currently bound one.
+	GLuint m_defaultVertexArray = 0;
+	GLuint m_vertexArray = 0;
+	std::unordered_map<VertexArrayKey, GLuint, VertexArrayKeyHasher> m_vertexArrays;
+
+	// The last values uploaded to the numeric uniforms of each program, indexed by the uniform location.
+	// An empty value means that the uniform wasn't set through the cache.
+	std::unordered_map<GLuint, std::vector<std::vector<char>>> m_uniformValues;
+	// The uniform values of the used program.
+	std::vector<std::vector<char>>* m_programUniformValues = nullptr;
+
 	// The bound viewport. "first" holds if there is actually bound viewport.
 	Pair<bool, sge::GLViewport> m_viewport;
 };
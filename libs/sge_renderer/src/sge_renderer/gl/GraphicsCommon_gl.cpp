@@ -510,6 +510,21 @@ void UniformType_ToGLUniformType(const UniformType::Enum type, GLenum& glType, G
 			elemCnt = 4;
 			normalized = GL_TRUE;
 			return;
+		case UniformType::Short2_Snorm_IA:
+			glType = GL_SHORT;
+			elemCnt = 2;
+			normalized = GL_TRUE;
+			return;
+		case UniformType::Ushort2_Unorm_IA:
+			glType = GL_UNSIGNED_SHORT;
+			elemCnt = 2;
+			normalized = GL_TRUE;
+			return;
+		case UniformType::Ushort4_Unorm_IA:
+			glType = GL_UNSIGNED_SHORT;
+			elemCnt = 4;
+			normalized = GL_TRUE;
+			return;
 	}
 
 	sgeAssert(false);
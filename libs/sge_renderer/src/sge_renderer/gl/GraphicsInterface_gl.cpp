@@ -111,6 +111,8 @@ bool SGEDeviceImpl::Create(const MainFrameTargetDesc& frameTargetDesc) {
 
 	DumpAllGLErrors();
 
+	m_gl_contextStateCache.Initialize(GLFunctionTable::CreateFromLoadedGL(), &m_frameStatistics);
+
 	//[[maybe_unused]] const GLubyte* glVersion = glGetString(GL_VERSION);
 	// SGE_DEBUG_LOG("OpenGL Version = %s\n", glVersion);
 
@@ -127,12 +129,6 @@ bool SGEDeviceImpl::Create(const MainFrameTargetDesc& frameTargetDesc) {
 
 	// SGE_DEBUG_LOG("Vendor = %s\nRenderer = %s\n", vendor, renderer);
 
-	// The code uses only one VAO.
-	GLuint globallyUsedDefaultVAO = -1;
-	glGenVertexArrays(1, &globallyUsedDefaultVAO);
-	glBindVertexArray(globallyUsedDefaultVAO);
-	DumpAllGLErrors();
-
 	return true;
 }
 
@@ -344,6 +340,30 @@ void SGEContextImmediate::clearDepth(FrameTarget* target, float depth) {
 #endif
 }
 
+void SGEContextImmediate::copyDepth(FrameTarget* dest, FrameTarget* src) {
+	if (dest == NULL || !dest->isValid() || src == NULL || !src->isValid()) {
+		sgeAssert(false);
+		return;
+	}
+
+	sgeAssert(dest->getWidth() == src->getWidth() && dest->getHeight() == src->getHeight());
+
+	const GLuint destFbo = ((FrameTargetGL*)dest)->GL_GetResource();
+	const GLuint srcFbo = ((FrameTargetGL*)src)->GL_GetResource();
+
+	// The blit is affected by the scissor test.
+	GL_GetContextStateCache()->ApplyRasterDesc(RasterDesc());
+
+	// The state cache binds the frame buffers for both reading and drawing,
+	// change only the read one for the blit and restore it afterwards so the cache stays correct.
+	GL_GetContextStateCache()->BindFBO(destFbo);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, srcFbo);
+	glBlitFramebuffer(0, 0, src->getWidth(), src->getHeight(), 0, 0, dest->getWidth(), dest->getHeight(), GL_DEPTH_BUFFER_BIT,
+	                  GL_NEAREST);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, destFbo);
+	DumpAllGLErrors();
+}
+
 void* SGEContextImmediate::map(Buffer* buffer, const Map::Enum map) {
 	void* result = ((BufferGL*)buffer)->map(map);
 	DumpAllGLErrors();
@@ -366,39 +386,52 @@ void SGEContextImmediate::executeDrawCall(DrawCall& drawCall,
 
 	GLContextStateCache* const glcon = getDeviceImpl()->GL_GetContextStateCache();
 
-	// Vertex attributes and vertex buffers.
+	// Vertex attributes, vertex buffers and the index buffer.
+	// These are recorded in vertex array objects, which are cached and reused by the draw calls with the same state.
 	sgeAssert(stateGroup->m_shadingProg);
 	VertexMapperGL* const vertMapper = ((ShadingProgramGL*)stateGroup->m_shadingProg)->GetVertexMapper(stateGroup->m_vertDeclIndex);
 
 	sgeAssert(vertMapper);
 	{
 		const std::vector<VertexMapperGL::GL_AttribLayout>& glAttribLayout = vertMapper->GL_GetVertexLayout();
-		for (int t = 0; t < (int)glAttribLayout.size(); ++t) {
-			GLenum attrbType;
-			GLint attribAirty;
-			GLboolean attibNormalized;
-			UniformType_ToGLUniformType(glAttribLayout[t].type, attrbType, attribAirty, attibNormalized);
-
-			GLuint const buffer = ((BufferGL*)(stateGroup->m_vertexBuffers[glAttribLayout[t].bufferSlot]))->GL_GetResource();
-			GLuint const byteOffset = glAttribLayout[t].byteOffset;
-			GLuint const stride = stateGroup->m_vbStrides[glAttribLayout[t].bufferSlot];
-
-			// Due to the lack of "glDrawElementsBaseVertex" under OpenGL ES*
-			// we are forced to add that offset here.
-			int drawIndexedBaseVertexAdditionOffset = 0;
-			if (drawCall.m_drawExec.GetType() == DrawExecDesc::Type_Indexed) {
-				drawIndexedBaseVertexAdditionOffset = drawCall.m_drawExec.IndexedCall().startVertex * stride;
-			}
 
-			glcon->SetVertexAttribSlotState(buffer != 0, glAttribLayout[t].index, buffer, attribAirty, attrbType, attibNormalized, stride,
-			                                byteOffset + drawIndexedBaseVertexAdditionOffset);
+		GLContextStateCache::VertexArrayKey vertexArrayKey;
+		vertexArrayKey.program = ((ShadingProgramGL*)stateGroup->m_shadingProg)->GL_GetProgram();
+		vertexArrayKey.vertexDeclIndex = stateGroup->m_vertDeclIndex;
+
+		if (stateGroup->m_indexBuffer != nullptr) {
+			vertexArrayKey.indexBuffer = ((BufferGL*)stateGroup->m_indexBuffer)->GL_GetResource();
+		}
+
+		// Due to the lack of "glDrawElementsBaseVertex" under OpenGL ES*
+		// we are forced to add that offset to the attributes.
+		if (drawCall.m_drawExec.GetType() == DrawExecDesc::Type_Indexed) {
+			vertexArrayKey.baseVertex = drawCall.m_drawExec.IndexedCall().startVertex;
+		}
+
+		for (int t = 0; t < (int)glAttribLayout.size(); ++t) {
+			const int bufferSlot = glAttribLayout[t].bufferSlot;
+			vertexArrayKey.vertexBuffers[bufferSlot] = ((BufferGL*)(stateGroup->m_vertexBuffers[bufferSlot]))->GL_GetResource();
+			vertexArrayKey.vertexBufferStrides[bufferSlot] = stateGroup->m_vbStrides[bufferSlot];
 		}
-	}
 
-	// Index buffer.
-	if (stateGroup->m_indexBuffer != nullptr) {
-		const GLuint indexBuffer = ((BufferGL*)stateGroup->m_indexBuffer)->GL_GetResource();
-		glcon->BindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+		const bool isNewVertexArray = glcon->BindVertexArray(vertexArrayKey);
+		if (isNewVertexArray) {
+			for (int t = 0; t < (int)glAttribLayout.size(); ++t) {
+				GLenum attrbType;
+				GLint attribAirty;
+				GLboolean attibNormalized;
+				UniformType_ToGLUniformType(glAttribLayout[t].type, attrbType, attribAirty, attibNormalized);
+
+				GLuint const buffer = vertexArrayKey.vertexBuffers[glAttribLayout[t].bufferSlot];
+				GLuint const byteOffset = glAttribLayout[t].byteOffset;
+				GLuint const stride = vertexArrayKey.vertexBufferStrides[glAttribLayout[t].bufferSlot];
+				GLuint const drawIndexedBaseVertexAdditionOffset = vertexArrayKey.baseVertex * stride;
+
+				glcon->SetVertexAttribSlotState(buffer != 0, glAttribLayout[t].index, buffer, attribAirty, attrbType, attibNormalized,
+				                                stride, byteOffset + drawIndexedBaseVertexAdditionOffset);
+			}
+		}
 	}
 
 	// The shading program.
@@ -422,27 +455,15 @@ void SGEContextImmediate::executeDrawCall(DrawCall& drawCall,
 
 		sgeAssert(binding.bindLocation.glArraySize >= 1);
 		switch (uniformType) {
-			// Numeric uniforms.
-			case UniformType::Int: {
-				glUniform1i(binding.bindLocation.bindLocation, *(int*)boundData);
-			} break;
-			case UniformType::Float: {
-				glUniform1f(binding.bindLocation.bindLocation, *(float*)boundData);
-			} break;
-			case UniformType::Float2: {
-				glUniform2fv(binding.bindLocation.bindLocation, binding.bindLocation.glArraySize, (float*)boundData);
-			} break;
-			case UniformType::Float3: {
-				glUniform3fv(binding.bindLocation.bindLocation, binding.bindLocation.glArraySize, (float*)boundData);
-			} break;
-			case UniformType::Float4: {
-				glUniform4fv(binding.bindLocation.bindLocation, binding.bindLocation.glArraySize, (float*)boundData);
-			} break;
-			case UniformType::Float4x4: {
-				glUniformMatrix4fv(binding.bindLocation.bindLocation, binding.bindLocation.glArraySize, GL_FALSE, (float*)boundData);
-			} break;
+			// Numeric uniforms. The state cache skips the values that the program already has.
+			case UniformType::Int:
+			case UniformType::Float:
+			case UniformType::Float2:
+			case UniformType::Float3:
+			case UniformType::Float4:
+			case UniformType::Float4x4:
 			case UniformType::Float3x3: {
-				glUniformMatrix3fv(binding.bindLocation.bindLocation, binding.bindLocation.glArraySize, GL_FALSE, (float*)boundData);
+				glcon->SetUniform(binding.bindLocation.bindLocation, uniformType, binding.bindLocation.glArraySize, boundData);
 			} break;
 			// Uniform blocks.
 			case UniformType::ConstantBuffer: {
@@ -485,8 +506,8 @@ void SGEContextImmediate::executeDrawCall(DrawCall& drawCall,
 					glcon->BindTextureEx(textureTarget, GL_TEXTURE0 + binding.bindLocation.glTextureUnit, texture);
 					DumpAllGLErrors();
 
-					glUniform1i(binding.bindLocation.bindLocation, binding.bindLocation.glTextureUnit);
-					DumpAllGLErrors();
+					const GLint textureUnit = binding.bindLocation.glTextureUnit;
+					glcon->SetUniform(binding.bindLocation.bindLocation, UniformType::Int, 1, &textureUnit);
 				} else {
 					for (int t = 0; t < binding.bindLocation.glArraySize; ++t) {
 						// Bind the texture.
@@ -496,8 +517,8 @@ void SGEContextImmediate::executeDrawCall(DrawCall& drawCall,
 						glcon->BindTextureEx(textureTarget, GL_TEXTURE0 + texSlotIdx, texture);
 						DumpAllGLErrors();
 
-						glUniform1i(texSlotIdx, texSlotIdx);
-						DumpAllGLErrors();
+						const GLint textureUnit = texSlotIdx;
+						glcon->SetUniform(textureUnit, UniformType::Int, 1, &textureUnit);
 					}
 				}
 
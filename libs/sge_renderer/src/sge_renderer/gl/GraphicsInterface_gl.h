@@ -70,6 +70,7 @@ struct SGEDeviceImpl : public SGEDevice {
 	BlendState* requestBlendState(const BlendStateDesc& desc) final;
 
 	const FrameStatistics& getFrameStatistics() const final { return m_frameStatistics; }
+	FrameStatistics& getFrameStatistics() final { return m_frameStatistics; }
 
   private:
 	FrameStatistics m_frameStatistics;
@@ -125,6 +126,7 @@ struct SGEContextImmediate : public SGEContextGL {
 
 	void clearColor(FrameTarget* target, int index, const float rgba[4]) final;
 	void clearDepth(FrameTarget* target, float depth) final;
+	void copyDepth(FrameTarget* dest, FrameTarget* src) final;
 
 	void* map(Buffer* buffer, const Map::Enum map) final;
 	void unMap(Buffer* buffer) final;
@@ -142,39 +144,5 @@ struct SGEContextImmediate : public SGEContextGL {
 	void updateTextureData(Texture* texture,  const TextureData& td) override;
 };
 
-//---------------------------------------------------------------------
-// SGERecordingContext
-//---------------------------------------------------------------------
-
-#if 0
-struct SGERecordingContext : public SGEContextGL
-{
-
-	void Create(SGEDeviceImpl* device) { m_device = device; }
-
-	void ClearColor(FrameTargetGL* target, int index, const float rgba[4]) override;
-	void ClearDepth(FrameTargetGL* target, float depth) override;
-	void ExecuteDrawCall(DrawCall& drawCall) override;
-	void* Map(BufferGL* buffer, const Map::Enum map) override; // [CAUTION] Only MapDiscard is supported on recording contexts.
-	void UnMap(BufferGL* buffer) override;
-
-	void Execute(SGEContextImmediate* context); //temp function ofc.
-
-protected :
-
-	std::vector<APICommand> commandIDs;
-
-	std::vector<DrawCall> drawCalls;
-	std::vector<BufferMapCmd> bufferMaps;
-	std::vector<ClearColorCmd> clearColors;
-	std::vector<ClearDepthStencilCmd> clearDepthStencils;
-};
-#endif
-
 } // namespace sge
 
-extern template class std::vector<sge::APICommand>;
-extern template class std::vector<sge::DrawCall>;
-extern template class std::vector<sge::BufferMapCmd>;
-extern template class std::vector<sge::ClearColorCmd>;
-extern template class std::vector<sge::ClearDepthStencilCmd>;
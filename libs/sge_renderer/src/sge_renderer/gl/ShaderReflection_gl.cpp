@@ -214,6 +214,11 @@ bool ShadingProgramRefl::create(ShadingProgram* const shadingProgram) {
 		// Only numeric types are possible.
 		const GLint bindLocation = glGetAttribLocation(program, attribName);
 
+		// Some drivers report the built-in inputs (like gl_InstanceID), they aren't fed by the vertex buffers.
+		if (bindLocation < 0) {
+			continue;
+		}
+
 		VertShaderAttrib attrib;
 		attrib.name = attribName;
 		attrib.type = uniformType;
@@ -34,6 +34,18 @@ bool VertexMapperGL::create(const ShadingProgram* shadingProgram, const VertexDe
 				doesTypeMatch = true;
 			}
 
+			// Quantized attributes get expanded to floats by the input assambler.
+			if (!doesTypeMatch && (attrib.type == UniformType::Float2) &&
+			    (decl.format == UniformType::Short2_Snorm_IA || decl.format == UniformType::Ushort2_Unorm_IA)) {
+				doesTypeMatch = true;
+			}
+
+			// Quantized positions have a padding 4th component, that could be ignored by the shader.
+			if (!doesTypeMatch && (attrib.type == UniformType::Float3 || attrib.type == UniformType::Float4) &&
+			    (decl.format == UniformType::Ushort4_Unorm_IA)) {
+				doesTypeMatch = true;
+			}
+
 			const bool match = (decl.semantic == attrib.name) && doesTypeMatch;
 
 			if (!match) {
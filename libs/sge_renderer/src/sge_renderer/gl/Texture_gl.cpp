@@ -36,27 +36,32 @@ bool TextureGL::create(const TextureDesc& desc, const TextureData initalData[],
 		glPixelStorei(GL_PACK_ALIGNMENT, 1);
 		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-		int width = m_desc.texture2D.width;
-		int height = m_desc.texture2D.height;
+		// Mip streaming: the most detailed mips without data aren't resident, see setResidentMips.
+		m_mostDetailedResidentMip = 0;
+		if (initalData != nullptr && m_desc.texture2D.numMips > 1 && m_desc.texture2D.arraySize == 1) {
+			while (m_mostDetailedResidentMip < m_desc.texture2D.numMips - 1 && initalData[m_mostDetailedResidentMip].data == nullptr) {
+				m_mostDetailedResidentMip++;
+			}
+		}
+		m_mostDetailedAllocatedMip = m_mostDetailedResidentMip;
 
-		for (int iMipLevel = 0; iMipLevel < m_desc.texture2D.numMips; ++iMipLevel) {
+		for (int iMipLevel = m_mostDetailedResidentMip; iMipLevel < m_desc.texture2D.numMips; ++iMipLevel) {
 			if (isCompressed == false) {
 				// The next line is used in Emscripen debugging, as there is no way of breaking here.
 				// SGE_DEBUG_LOG("glInternalFormat = %x glFormat = %x glType = %x\n", glInternalFormat, glFormat, glType);
+				const int width = maxOf(m_desc.texture2D.width >> iMipLevel, 1);
+				const int height = maxOf(m_desc.texture2D.height >> iMipLevel, 1);
 				const void* initialDataForMipLevel = (initalData) ? initalData[iMipLevel].data : NULL;
 				glTexImage2D(GL_TEXTURE_2D, iMipLevel, glInternalFormat, width, height, 0, glFormat, glType, initialDataForMipLevel);
 			} else {
 				sgeAssert(initalData);
-				sgeAssert(initalData[iMipLevel].data != NULL);
-				sgeAssert(initalData[iMipLevel].sliceByteSize > 0);
-
-				glCompressedTexImage2D(GL_TEXTURE_2D, iMipLevel, glInternalFormat, width, height,
-				                       0, // border
-				                       int(initalData[iMipLevel].sliceByteSize), initalData[iMipLevel].data);
+				uploadMip2D(iMipLevel, initalData[iMipLevel]);
 			}
+		}
 
-			width = maxOf(width / 2, 1);
-			height = maxOf(height / 2, 1);
+		if (m_desc.texture2D.numMips > 1) {
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, m_mostDetailedResidentMip);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, m_desc.texture2D.numMips - 1);
 		}
 
 		DumpAllGLErrors();
@@ -143,6 +148,69 @@ bool TextureGL::create(const TextureDesc& desc, const TextureData initalData[],
 	return true;
 }
 
+bool TextureGL::setResidentMips(const int mostDetailedMip, const TextureData mipsData[]) {
+	if (!isValid() || m_desc.textureType != UniformType::Texture2D || m_desc.texture2D.arraySize != 1 ||
+	    m_desc.texture2D.numSamples > 1) {
+		return false;
+	}
+
+	const int newMostDetailedMip = clamp(mostDetailedMip, 0, m_desc.texture2D.numMips - 1);
+	if (newMostDetailedMip == m_mostDetailedResidentMip) {
+		return true;
+	}
+
+	// Only the mips that were never resident need data, the evicted ones keep theirs.
+	if (newMostDetailedMip < m_mostDetailedAllocatedMip && mipsData == nullptr) {
+		sgeAssert(false && "The data of the mips is needed for streaming them in");
+		return false;
+	}
+
+	GLContextStateCache* const glcon = getDevice<SGEDeviceImpl>()->GL_GetContextStateCache();
+	glcon->BindTextureEx(GL_TEXTURE_2D, GL_TEXTURE0, m_glTexture);
+
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	if (newMostDetailedMip < m_mostDetailedAllocatedMip) {
+		for (int iMip = m_mostDetailedAllocatedMip - 1; iMip >= newMostDetailedMip; --iMip) {
+			uploadMip2D(iMip, mipsData[iMip]);
+		}
+		m_mostDetailedAllocatedMip = newMostDetailedMip;
+	}
+
+	// Evicting only stops the mips from being sampled. GL has no portable way of releasing the memory of a single mip level
+	// (respecifying it with zero size isn't guaranteed to work on GLES and WebGL), and recreating the texture would make
+	// every eviction as expensive as a stream-in. The memory gets released with the texture.
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, newMostDetailedMip);
+
+	m_mostDetailedResidentMip = newMostDetailedMip;
+	DumpAllGLErrors();
+
+	glcon->BindTextureEx(GL_TEXTURE_2D, GL_TEXTURE0, 0);
+
+	return true;
+}
+
+void TextureGL::uploadMip2D(const int mipLevel, const TextureData& mipData) {
+	GLint glInternalFormat;
+	GLenum glFormat, glType;
+	TextureFormat_GetGLNative(m_desc.format, glInternalFormat, glFormat, glType);
+
+	const int width = maxOf(m_desc.texture2D.width >> mipLevel, 1);
+	const int height = maxOf(m_desc.texture2D.height >> mipLevel, 1);
+
+	if (TextureFormat::IsBC(m_desc.format)) {
+		sgeAssert(mipData.data != NULL);
+		sgeAssert(mipData.sliceByteSize > 0);
+
+		glCompressedTexImage2D(GL_TEXTURE_2D, mipLevel, glInternalFormat, width, height,
+		                       0, // border
+		                       int(mipData.sliceByteSize), mipData.data);
+	} else {
+		glTexImage2D(GL_TEXTURE_2D, mipLevel, glInternalFormat, width, height, 0, glFormat, glType, mipData.data);
+	}
+}
+
 void TextureGL::setSamplerState(SamplerState* ss) {
 	m_samplerState = ss;
 	if (m_samplerState.HasResource()) {
@@ -26,14 +26,26 @@ struct TextureGL : public Texture {
 	SamplerState* getSamplerState() final { return m_samplerState; }
 	void setSamplerState(SamplerState* ss) final;
 
+	bool isMipStreamingSupported() const final { return true; }
+	bool setResidentMips(const int mostDetailedMip, const TextureData mipsData[]) final;
+	int getMostDetailedResidentMip() const final { return m_mostDetailedResidentMip; }
+
 	GLuint GL_GetResource() { return m_glTexture; }
 
   private:
 	void applySamplerDesc(const SamplerDesc& samplerDesc, bool shouldBindAndUnBindtexture);
 
+	/// Uploads the data of a single mip level of a 2D texture. The texture needs to be bound.
+	void uploadMip2D(const int mipLevel, const TextureData& mipData);
+
 	TextureDesc m_desc;
 	GpuHandle<SamplerState> m_samplerState;
 	GLuint m_glTexture = 0;
+
+	/// The most detailed mip that has its data uploaded. The sampling is limited to the resident mips with GL_TEXTURE_BASE_LEVEL.
+	int m_mostDetailedResidentMip = 0;
+	/// The most detailed mip that has storage. The evicted mips keep their storage and data, so streaming them in again is free.
+	int m_mostDetailedAllocatedMip = 0;
 };
 
 } // namespace sge
@@ -0,0 +1,78 @@
+#include "Buffer_null.h"
+#include "GraphicsInterface_null.h"
+#include <cstring>
+
+namespace sge {
+
+//-----------------------------------------------------------------------------
+// BufferNull
+//-----------------------------------------------------------------------------
+bool BufferNull::create(const BufferDesc& desc, const void* const pInitalData) {
+	destroy();
+
+	SGEDeviceNull* const device = getDevice<SGEDeviceNull>();
+
+	const bool hasKnownBindFlags = (desc.bindFlags & ResourceBindFlags::VertexBuffer) || (desc.bindFlags & ResourceBindFlags::IndexBuffer) ||
+	                               (desc.bindFlags & ResourceBindFlags::ConstantBuffer);
+	if (hasKnownBindFlags == false) {
+		device->reportValidationError("Creating a buffer without vertex, index or constant buffer bind flags");
+		return false;
+	}
+
+	if (desc.sizeBytes == 0) {
+		device->reportValidationError("Creating a buffer with zero size");
+		return false;
+	}
+
+	m_bufferDesc = desc;
+	m_data.resize(desc.sizeBytes);
+	if (pInitalData) {
+		memcpy(m_data.data(), pInitalData, desc.sizeBytes);
+	}
+
+	m_isValid = true;
+	device->trackMemory(ResourceType::Buffer, desc.sizeBytes, 0);
+
+	return true;
+}
+
+void BufferNull::destroy() {
+	if (m_isValid) {
+		if (m_isMapped) {
+			getDevice<SGEDeviceNull>()->reportValidationError("Destroying a mapped buffer");
+		}
+
+		getDevice<SGEDeviceNull>()->trackMemory(ResourceType::Buffer, 0, m_bufferDesc.sizeBytes);
+	}
+
+	m_bufferDesc = BufferDesc();
+	m_data = std::vector<char>();
+	m_isValid = false;
+	m_isMapped = false;
+}
+
+void* BufferNull::map(const Map::Enum UNUSED(map)) {
+	if (!isValid()) {
+		getDevice<SGEDeviceNull>()->reportValidationError("Mapping an invalid buffer");
+		return nullptr;
+	}
+
+	if (m_isMapped) {
+		getDevice<SGEDeviceNull>()->reportValidationError("Mapping a buffer that is already mapped");
+		return nullptr;
+	}
+
+	m_isMapped = true;
+	return m_data.data();
+}
+
+void BufferNull::unMap() {
+	if (m_isMapped == false) {
+		getDevice<SGEDeviceNull>()->reportValidationError("Unmapping a buffer that isn't mapped");
+		return;
+	}
+
+	m_isMapped = false;
+}
+
+} // namespace sge
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "sge_renderer/renderer/renderer.h"
+
+namespace sge {
+
+//-------------------------------------------------------------------
+// BufferNull
+// The contents of the buffer are stored in the CPU memory.
+//-------------------------------------------------------------------
+class BufferNull : public Buffer {
+  public:
+	BufferNull() {}
+	~BufferNull() { destroy(); }
+
+	bool create(const BufferDesc& desc, const void* const pInitalData) final;
+
+	void destroy() final;
+	bool isValid() const final { return m_isValid; }
+
+	const BufferDesc& getDesc() const final { return m_bufferDesc; }
+
+	void* map(const Map::Enum map);
+	void unMap();
+	bool isMapped() const { return m_isMapped; }
+
+	/// The contents of the buffer, as they would be seen by the GPU.
+	const std::vector<char>& getData() const { return m_data; }
+
+  private:
+	BufferDesc m_bufferDesc = BufferDesc(); // Buffer description.
+	std::vector<char> m_data;
+	bool m_isValid = false;
+	bool m_isMapped = false;
+};
+
+} // namespace sge
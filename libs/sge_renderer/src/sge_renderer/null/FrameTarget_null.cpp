@@ -0,0 +1,234 @@
+#include "FrameTarget_null.h"
+#include "GraphicsInterface_null.h"
+
+namespace sge {
+
+//---------------------------------------------------------------
+// FrameTargetNull
+//---------------------------------------------------------------
+bool FrameTargetNull::create() {
+	return create(0, nullptr, nullptr, nullptr, TargetDesc());
+}
+
+bool FrameTargetNull::create(int numRenderTargets,
+                             Texture* renderTargets[],
+                             TargetDesc renderTargetDescs[],
+                             Texture* depthStencil,
+                             const TargetDesc& depthTargetDesc) {
+	destroy();
+
+	if (numRenderTargets > GraphicsCaps::kRenderTargetSlotsCount) {
+		getDevice<SGEDeviceNull>()->reportValidationError("Creating a frame target with %d render targets, the limit is %d",
+		                                                  numRenderTargets, GraphicsCaps::kRenderTargetSlotsCount);
+		return false;
+	}
+
+	m_isCreated = true;
+
+	for (int t = 0; t < numRenderTargets; ++t) {
+		setRenderTarget(t, renderTargets[t], renderTargetDescs[t]);
+	}
+
+	setDepthStencil(depthStencil, depthTargetDesc);
+
+	return true;
+}
+
+void FrameTargetNull::createWindowFrameTarget(int width, int height) {
+	destroy();
+
+	m_isWindowFrameTarget = true;
+	m_frameTargetWidth = width;
+	m_frameTargetHeight = height;
+}
+
+void FrameTargetNull::setRenderTarget(const int slot, Texture* texture, const TargetDesc& UNUSED(targetDesc)) {
+	SGEDeviceNull* const device = getDevice<SGEDeviceNull>();
+
+	if (m_isWindowFrameTarget) {
+		device->reportValidationError("Modifying the window frame target is not possible");
+		return;
+	}
+
+	if (slot < 0 || slot >= GraphicsCaps::kRenderTargetSlotsCount) {
+		device->reportValidationError("Setting a render target at invalid slot %d", slot);
+		return;
+	}
+
+	// Just unbinding nothing more to do here.
+	if (texture == nullptr) {
+		m_renderTargets[slot].Release();
+		return;
+	}
+
+	if (!texture->isValid() || TextureUsage::CanBeRenderTarget(texture->getDesc().usage) == false) {
+		device->reportValidationError("Setting a texture that cannot be a render target at slot %d", slot);
+		return;
+	}
+
+	m_renderTargets[slot].Release();
+	if (updateAttachmentsInfo(texture)) {
+		m_renderTargets[slot] = texture;
+	}
+}
+
+void FrameTargetNull::setDepthStencil(Texture* texture, const TargetDesc& UNUSED(targetDesc)) {
+	SGEDeviceNull* const device = getDevice<SGEDeviceNull>();
+
+	if (m_isWindowFrameTarget) {
+		device->reportValidationError("Modifying the window frame target is not possible");
+		return;
+	}
+
+	if (texture == nullptr) {
+		m_depthBuffer.Release();
+		return;
+	}
+
+	if (!texture->isValid() || TextureUsage::CanBeDepthStencil(texture->getDesc().usage) == false) {
+		device->reportValidationError("Setting a texture that cannot be a depth stencil");
+		return;
+	}
+
+	m_depthBuffer.Release();
+	if (updateAttachmentsInfo(texture)) {
+		m_depthBuffer = texture;
+	}
+}
+
+void FrameTargetNull::destroy() {
+	m_frameTargetWidth = -1;
+	m_frameTargetHeight = -1;
+	m_isCreated = false;
+	m_isWindowFrameTarget = false;
+
+	// release the render targets and the depth buffer
+	for (auto& renderTargetTexture : m_renderTargets) {
+		renderTargetTexture.Release();
+	}
+
+	m_depthBuffer.Release();
+}
+
+bool FrameTargetNull::isValid() const {
+	if (m_isWindowFrameTarget) {
+		return true;
+	}
+
+	if (m_isCreated == false) {
+		return false;
+	}
+
+	// Assume as valid if there is alleast one rendertarget or depth buffer
+	for (unsigned int t = 0; t < SGE_ARRSZ(m_renderTargets); ++t) {
+		if (m_renderTargets[t].IsResourceValid())
+			return true;
+	}
+
+	return m_depthBuffer.IsResourceValid();
+}
+
+Texture* FrameTargetNull::getRenderTarget(const unsigned int index) const {
+	if (m_isWindowFrameTarget) {
+		sgeAssert(false && "Invalid operation, calling getRenderTarget on the window frame target is not possible!");
+		return nullptr;
+	}
+
+	return m_renderTargets[index].GetPtr();
+}
+
+Texture* FrameTargetNull::getDepthStencil() const {
+	if (m_isWindowFrameTarget) {
+		sgeAssert(false && "Invalid operation, calling getDepthStencil on the window frame target is not possible!");
+		return nullptr;
+	}
+
+	return m_depthBuffer.GetPtr();
+}
+
+bool FrameTargetNull::hasAttachment() const {
+	bool hasRenderTarget = false;
+
+	for (int t = 0; t < SGE_ARRSZ(m_renderTargets); ++t) {
+		hasRenderTarget |= m_renderTargets[t].GetPtr() != nullptr;
+	}
+
+	return hasRenderTarget || (m_depthBuffer.GetPtr() != nullptr);
+}
+
+bool FrameTargetNull::isAttached(const Texture* const texture) const {
+	if (texture == nullptr || m_isWindowFrameTarget) {
+		return false;
+	}
+
+	for (int t = 0; t < SGE_ARRSZ(m_renderTargets); ++t) {
+		if (m_renderTargets[t].GetPtr() == texture) {
+			return true;
+		}
+	}
+
+	return m_depthBuffer.GetPtr() == texture;
+}
+
+bool FrameTargetNull::updateAttachmentsInfo(Texture* texture) {
+	if (hasAttachment() == false) {
+		m_frameTargetWidth = -1;
+		m_frameTargetHeight = -1;
+	}
+
+	int width = -1;
+	int height = -1;
+
+	const TextureDesc& desc = texture->getDesc();
+	if (desc.textureType == UniformType::Texture2D) {
+		width = desc.texture2D.width;
+		height = desc.texture2D.height;
+	} else if (desc.textureType == UniformType::Texture3D) {
+		width = desc.texture3D.width;
+		height = desc.texture3D.height;
+	} else if (desc.textureType == UniformType::TextureCube) {
+		width = desc.textureCube.width;
+		height = desc.textureCube.height;
+	} else {
+		getDevice<SGEDeviceNull>()->reportValidationError("Attaching a texture of unsupported type to a frame target");
+		return false;
+	}
+
+	if (m_frameTargetWidth == -1) {
+		m_frameTargetWidth = width;
+		m_frameTargetHeight = height;
+	} else if (m_frameTargetWidth != width || m_frameTargetHeight != height) {
+		getDevice<SGEDeviceNull>()->reportValidationError("Attaching a %dx%d texture to a %dx%d frame target", width, height,
+		                                                  m_frameTargetWidth, m_frameTargetHeight);
+		return false;
+	}
+
+	return true;
+}
+
+bool FrameTargetNull::create2D(int width, int height, TextureFormat::Enum renderTargetFmt, TextureFormat::Enum depthTextureFmt) {
+	// Render Target texture.
+	GpuHandle<Texture> renderTarget;
+	if (renderTargetFmt != TextureFormat::Unknown) {
+		renderTarget = getDevice()->requestResource<Texture>();
+		const TextureDesc renderTargetDesc = TextureDesc::GetDefaultRenderTarget(width, height, renderTargetFmt);
+		renderTarget->create(renderTargetDesc, nullptr);
+	}
+
+	// Depth Stencil texture.
+	GpuHandle<Texture> depthStencilTexture;
+	if (TextureFormat::IsDepth(depthTextureFmt)) {
+		depthStencilTexture = getDevice()->requestResource<Texture>();
+		const TextureDesc depthStencilDesc = TextureDesc::GetDefaultDepthStencil(width, height, depthTextureFmt);
+		depthStencilTexture->create(depthStencilDesc, nullptr);
+	} else {
+		sgeAssert(depthTextureFmt == TextureFormat::Unknown);
+	}
+
+	// Create the frame target itself.
+	TargetDesc tex2DDesc = TargetDesc::FromTex2D();
+	return create(renderTarget.IsResourceValid() ? 1 : 0, renderTarget.PtrPtr(), &tex2DDesc, depthStencilTexture,
+	              TargetDesc::FromTex2D());
+}
+
+} // namespace sge
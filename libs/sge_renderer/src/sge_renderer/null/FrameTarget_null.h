@@ -0,0 +1,67 @@
+#pragma once
+
+#include "sge_renderer/renderer/renderer.h"
+
+namespace sge {
+
+//----------------------------------------------------------
+// FrameTargetNull
+// A container of render targets and a depth buffer, same as in D3D11.
+//----------------------------------------------------------
+struct FrameTargetNull : public FrameTarget {
+	FrameTargetNull() {}
+	~FrameTargetNull() { destroy(); }
+
+	// Sets render target and depth stencil elements can be NULL.
+	bool create(int numRenderTargets,
+	            Texture* renderTargets[],
+	            TargetDesc renderTargetDescs[],
+	            Texture* depthStencil,
+	            const TargetDesc& depthTargetDesc) final;
+
+	bool create() final;
+
+	// Just a shortcut that makes a single 2D render target and optionally a 2D depth stencil texture.
+	bool create2D(int width,
+	              int height,
+	              TextureFormat::Enum renderTargetFmt = TextureFormat::R8G8B8A8_UNORM,
+	              TextureFormat::Enum depthTextureFmt = TextureFormat::D24_UNORM_S8_UINT) final;
+
+	void setRenderTarget(const int slot, Texture* texture, const TargetDesc& targetDesc) final;
+	void setDepthStencil(Texture* texture, const TargetDesc& targetDesc) final;
+
+	void destroy() final;
+
+	// Valid if has at least has 1 render target or a depth stencil.
+	bool isValid() const final;
+
+	Texture* getRenderTarget(const unsigned int index) const final;
+	Texture* getDepthStencil() const final;
+
+	int getWidth() const final { return m_frameTargetWidth; }
+	int getHeight() const final { return m_frameTargetHeight; }
+
+	bool hasAttachment() const final;
+
+	/// Makes the frame target a stand-in for the window back buffer, it has no textures.
+	void createWindowFrameTarget(int width, int height);
+	bool isWindowFrameTarget() const { return m_isWindowFrameTarget; }
+
+	/// Returns true if the texture is attached as a render target or a depth stencil.
+	bool isAttached(const Texture* const texture) const;
+
+  private:
+	/// Checks if the size of the texture matches the frame target and updates it if this is the first attachment.
+	bool updateAttachmentsInfo(Texture* texture);
+
+	int m_frameTargetWidth = -1;
+	int m_frameTargetHeight = -1;
+
+	GpuHandle<Texture> m_renderTargets[GraphicsCaps::kRenderTargetSlotsCount];
+	GpuHandle<Texture> m_depthBuffer;
+
+	bool m_isCreated = false;
+	bool m_isWindowFrameTarget = false;
+};
+
+} // namespace sge
@@ -0,0 +1,639 @@
+#include "sge_utils/Logger.h"
+#include "sge_utils/utils/timer.h"
+#include <algorithm>
+#include <cstdarg>
+#include <cstring>
+
+#include "GraphicsInterface_null.h"
+
+namespace sge {
+
+namespace {
+	/// Returns true if a vertex attribute stored in @declFormat could be read by a shader attribute of @attribType.
+	/// These are the conversions done by the input assembler, same as in OpenGL.
+	bool isVertexFormatCompatible(const UniformType::Enum declFormat, const UniformType::Enum attribType) {
+		if (declFormat == attribType) {
+			return true;
+		}
+
+		// The vertex could use an ineger as a packed float4 color.
+		if (attribType == UniformType::Float4 && declFormat == UniformType::Int_RGBA_Unorm_IA) {
+			return true;
+		}
+
+		// Quantized attributes get expanded to floats.
+		if (attribType == UniformType::Float2 && (declFormat == UniformType::Short2_Snorm_IA || declFormat == UniformType::Ushort2_Unorm_IA)) {
+			return true;
+		}
+
+		// Quantized positions have a padding 4th component, that could be ignored by the shader.
+		if ((attribType == UniformType::Float3 || attribType == UniformType::Float4) && declFormat == UniformType::Ushort4_Unorm_IA) {
+			return true;
+		}
+
+		return false;
+	}
+
+	/// Returns the number of bytes pointed by BoundUniform::data for a numeric uniform.
+	size_t getNumericUniformSizeBytes(const BindLocation& bindLocation) {
+		const int arraySize = maxOf(int(bindLocation.glArraySize), 1);
+		return size_t(UniformType::GetSizeBytes(UniformType::Enum(bindLocation.uniformType))) * size_t(arraySize);
+	}
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// SGEDeviceNull
+//////////////////////////////////////////////////////////////////////////////////////////
+bool SGEDeviceNull::Create(const MainFrameTargetDesc& frameTargetDesc) {
+	m_immContext = new SGEContextImmediateNull(this);
+
+	m_screenTarget = requestResource(ResourceType::FrameTarget);
+	m_screenTarget.as<FrameTargetNull>()->createWindowFrameTarget(frameTargetDesc.width, frameTargetDesc.height);
+
+	setVsync(frameTargetDesc.vSync);
+
+	return true;
+}
+
+SGEDeviceNull::~SGEDeviceNull() {
+	m_screenTarget.Release();
+
+	// Release the references held by the caches, the states that aren't used anymore get deleted.
+	const auto releaseCachedState = [this](RAIResource* const state) {
+		state->releaseRef();
+		if (state->getRefCount() == 0) {
+			releaseResource(state);
+		}
+	};
+
+	std::for_each(rasterizerStateCache.begin(), rasterizerStateCache.end(), releaseCachedState);
+	std::for_each(depthStencilStateCache.begin(), depthStencilStateCache.end(), releaseCachedState);
+	std::for_each(blendStateCache.begin(), blendStateCache.end(), releaseCachedState);
+
+	delete m_immContext;
+	m_immContext = nullptr;
+}
+
+void SGEDeviceNull::resizeBackBuffer(int width, int height) {
+	m_screenTarget.as<FrameTargetNull>()->createWindowFrameTarget(width, height);
+}
+
+void SGEDeviceNull::present() {
+	float const now = Timer::now_seconds();
+
+	m_frameStatistics.Reset();
+	m_frameStatistics.lastPresentDt = now - m_frameStatistics.lastPresentTime;
+	m_frameStatistics.lastPresentTime = now;
+}
+
+RAIResource* SGEDeviceNull::requestResource(const ResourceType::Enum resourceType) {
+	RAIResource* result = nullptr;
+
+	if (resourceType == ResourceType::Buffer)
+		result = new BufferNull;
+	if (resourceType == ResourceType::Texture)
+		result = new TextureNull;
+	if (resourceType == ResourceType::Sampler)
+		result = new SamplerStateNull;
+	if (resourceType == ResourceType::FrameTarget)
+		result = new FrameTargetNull;
+	if (resourceType == ResourceType::Shader)
+		result = new ShaderNull;
+	if (resourceType == ResourceType::ShadingProgram)
+		result = new ShadingProgramNull;
+	if (resourceType == ResourceType::Query)
+		result = new QueryNull;
+	if (resourceType == ResourceType::RasterizerState)
+		result = new RasterizerStateNull;
+	if (resourceType == ResourceType::DepthStencilState)
+		result = new DepthStencilStateNull;
+	if (resourceType == ResourceType::BlendState)
+		result = new BlendStateNull;
+
+	if (!result) {
+		sgeAssert(false && "Unknown resource type");
+		return nullptr;
+	}
+
+	result->setDeviceInternal(this);
+	m_numLiveResources[resourceType] += 1;
+
+	return result;
+}
+
+void SGEDeviceNull::releaseResource(RAIResource* resource) {
+	if (resource == nullptr) {
+		return;
+	}
+
+	m_numLiveResources[resource->getResourceType()] -= 1;
+	delete resource;
+}
+
+void SGEDeviceNull::trackMemory(const ResourceType::Enum resourceType, const size_t numBytesAllocated, const size_t numBytesFreed) {
+	sgeAssert(m_numBytesAllocated[resourceType] + numBytesAllocated >= numBytesFreed);
+	m_numBytesAllocated[resourceType] = m_numBytesAllocated[resourceType] + numBytesAllocated - numBytesFreed;
+}
+
+void SGEDeviceNull::reportValidationError(const char* const format, ...) {
+	char message[1024];
+
+	va_list args;
+	va_start(args, format);
+	vsnprintf(message, sizeof(message), format, args);
+	va_end(args);
+
+	m_numValidationErrors += 1;
+	m_lastValidationError = message;
+
+	// Errors usually repeat every frame, print them only once.
+	if (m_reportedValidationErrors.insert(m_lastValidationError).second) {
+		Logger::getDefaultLog()->writeError("[SGEDeviceNull] Validation error: %s\n", m_lastValidationError.c_str());
+	}
+}
+
+RasterizerState* SGEDeviceNull::requestRasterizerState(const RasterDesc& desc) {
+	// Search if the resource exists.
+	auto itr = std::find_if(rasterizerStateCache.begin(), rasterizerStateCache.end(),
+	                        [&desc](const RasterizerState* state) -> bool { return state->getDesc() == desc; });
+
+	if (itr != std::end(rasterizerStateCache)) {
+		return *itr;
+	}
+
+	// Create the new resource;
+	RasterizerState* const state = (RasterizerState*)requestResource(ResourceType::RasterizerState);
+	state->create(desc);
+
+	// Add the 1 ref to the resource (this cointainer holds it).
+	state->addRef();
+	rasterizerStateCache.push_back(state);
+
+	return state;
+}
+
+DepthStencilState* SGEDeviceNull::requestDepthStencilState(const DepthStencilDesc& desc) {
+	// Search if the resource exists.
+	auto itr = std::find_if(depthStencilStateCache.begin(), depthStencilStateCache.end(),
+	                        [&desc](const DepthStencilState* state) -> bool { return state->getDesc() == desc; });
+
+	if (itr != std::end(depthStencilStateCache)) {
+		return *itr;
+	}
+
+	// Create the new resource;
+	DepthStencilState* const state = (DepthStencilState*)requestResource(ResourceType::DepthStencilState);
+	state->create(desc);
+
+	// Add the 1 ref to the resource (this cointainer holds it).
+	state->addRef();
+	depthStencilStateCache.push_back(state);
+
+	return state;
+}
+
+BlendState* SGEDeviceNull::requestBlendState(const BlendStateDesc& desc) {
+	// Search if the resource exists.
+	auto itr = std::find_if(blendStateCache.begin(), blendStateCache.end(),
+	                        [&desc](const BlendState* state) -> bool { return state->getDesc() == desc; });
+
+	if (itr != std::end(blendStateCache)) {
+		return *itr;
+	}
+
+	// Create the new resource;
+	BlendState* const state = (BlendState*)requestResource(ResourceType::BlendState);
+	state->create(desc);
+
+	// Add the 1 ref to the resource (this cointainer holds it).
+	state->addRef();
+	blendStateCache.push_back(state);
+
+	return state;
+}
+
+VertexDeclIndex SGEDeviceNull::getVertexDeclIndex(const VertexDecl* const declElems, const int declElemsCount) {
+	const std::vector<VertexDecl> decl = VertexDecl::NormalizeDecl(declElems, declElemsCount);
+
+	VertexDeclIndex& idx = m_vertexDeclIndexMap[decl];
+	static_assert(VertexDeclIndex_Null == 0, "");
+	if (idx == VertexDeclIndex_Null) {
+		idx = static_cast<VertexDeclIndex>(m_vertexDeclIndexMap.size());
+	}
+
+	return idx;
+}
+
+const std::vector<VertexDecl>& SGEDeviceNull::getVertexDeclFromIndex(const VertexDeclIndex index) const {
+	for (const auto& e : m_vertexDeclIndexMap) {
+		if (e.second == index) {
+			return e.first;
+		}
+	}
+	static std::vector<VertexDecl> empty = std::vector<VertexDecl>();
+	return empty;
+}
+
+SGEDevice* SGEDevice::create(const MainFrameTargetDesc& frameTargetDesc) {
+	SGEDeviceNull* s = new SGEDeviceNull();
+	s->Create(frameTargetDesc);
+	return s;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// SGEContextImmediateNull
+//////////////////////////////////////////////////////////////////////////////////////////
+void SGEContextImmediateNull::clearColor(FrameTarget* target, int UNUSED(index), const float UNUSED(rgba)[4]) {
+	if (target == nullptr || !target->isValid()) {
+		m_device->reportValidationError("Clearing the color of an invalid frame target");
+	}
+}
+
+void SGEContextImmediateNull::clearDepth(FrameTarget* target, float UNUSED(depth)) {
+	if (target == nullptr || !target->isValid()) {
+		m_device->reportValidationError("Clearing the depth of an invalid frame target");
+		return;
+	}
+
+	if (static_cast<FrameTargetNull*>(target)->isWindowFrameTarget() == false && target->getDepthStencil() == nullptr) {
+		m_device->reportValidationError("Clearing the depth of a frame target without a depth stencil");
+	}
+}
+
+void SGEContextImmediateNull::copyDepth(FrameTarget* dest, FrameTarget* src) {
+	if (dest == nullptr || !dest->isValid() || src == nullptr || !src->isValid()) {
+		m_device->reportValidationError("Copying the depth of invalid frame targets");
+		return;
+	}
+
+	if (dest->getWidth() != src->getWidth() || dest->getHeight() != src->getHeight()) {
+		m_device->reportValidationError("Copying the depth between frame targets with different sizes");
+	}
+}
+
+void* SGEContextImmediateNull::map(Buffer* buffer, const Map::Enum map) {
+	if (buffer == nullptr) {
+		m_device->reportValidationError("Mapping a null buffer");
+		return nullptr;
+	}
+
+	return static_cast<BufferNull*>(buffer)->map(map);
+}
+
+void SGEContextImmediateNull::unMap(Buffer* buffer) {
+	if (buffer == nullptr) {
+		m_device->reportValidationError("Unmapping a null buffer");
+		return;
+	}
+
+	static_cast<BufferNull*>(buffer)->unMap();
+}
+
+void SGEContextImmediateNull::updateTextureData(Texture* texture, const TextureData& texData) {
+	if (texture == nullptr || !texture->isValid()) {
+		m_device->reportValidationError("Updating the data of an invalid texture");
+		return;
+	}
+
+	// Same as OpenGL, only 2D textures could be updated.
+	if (texture->getDesc().textureType != UniformType::Texture2D || texData.data == nullptr) {
+		m_device->reportValidationError("Updating a texture that isn't 2D or without data");
+	}
+}
+
+void SGEContextImmediateNull::beginQuery(Query* const query) {
+	if (!query || !query->isValid()) {
+		m_device->reportValidationError("Beginning an invalid query");
+		return;
+	}
+
+	QueryNull* const queryNull = static_cast<QueryNull*>(query);
+	if (queryNull->isActive()) {
+		m_device->reportValidationError("Beginning a query that is already active");
+		return;
+	}
+
+	queryNull->begin();
+}
+
+void SGEContextImmediateNull::endQuery(Query* const query) {
+	if (!query || !query->isValid()) {
+		m_device->reportValidationError("Ending an invalid query");
+		return;
+	}
+
+	QueryNull* const queryNull = static_cast<QueryNull*>(query);
+	if (queryNull->isActive() == false) {
+		m_device->reportValidationError("Ending a query that isn't active");
+		return;
+	}
+
+	queryNull->end();
+}
+
+bool SGEContextImmediateNull::isQueryReady(Query* const query) {
+	if (!query || !query->isValid()) {
+		m_device->reportValidationError("Checking the result of an invalid query");
+		return false;
+	}
+
+	return static_cast<QueryNull*>(query)->hasResult();
+}
+
+bool SGEContextImmediateNull::getQueryData(Query* const query, uint64& queryData) {
+	if (isQueryReady(query) == false) {
+		m_device->reportValidationError("Reading the result of a query that hasn't ended");
+		return false;
+	}
+
+	// Nothing gets rasterized, the samples are never counted.
+	queryData = 0;
+	return true;
+}
+
+void SGEContextImmediateNull::executeDrawCall(DrawCall& drawCall,
+                                              FrameTarget* frameTarget,
+                                              const Rect2s* const UNUSED(pViewport),
+                                              const Rect2s* const pScissorsRect) {
+	if (validateDrawCall(drawCall, frameTarget, pScissorsRect) == false) {
+		return;
+	}
+
+	applyDrawCallState(drawCall);
+
+	const StateGroup* const stateGroup = drawCall.m_pStateGroup;
+	size_t numPrimitivesDrawn = 0;
+
+	if (drawCall.m_drawExec.GetType() == DrawExecDesc::Type_Indexed) {
+		numPrimitivesDrawn +=
+		    PrimitiveTopology::GetNumPrimitivesByPoints(stateGroup->m_primTopology, drawCall.m_drawExec.IndexedCall().numIndices) *
+		    drawCall.m_drawExec.IndexedCall().numInstances;
+	} else {
+		numPrimitivesDrawn += drawCall.m_drawExec.LinearCall().numInstances * drawCall.m_drawExec.LinearCall().numVerts;
+	}
+
+	m_device->m_frameStatistics.numDrawCalls += 1;
+	m_device->m_frameStatistics.numPrimitiveDrawn += numPrimitivesDrawn;
+}
+
+bool SGEContextImmediateNull::validateDrawCall(const DrawCall& drawCall, FrameTarget* const frameTarget, const Rect2s* const pScissorsRect) {
+	const StateGroup* const stateGroup = drawCall.m_pStateGroup;
+
+	if (stateGroup == nullptr) {
+		m_device->reportValidationError("Draw call without a state group");
+		return false;
+	}
+
+	if (stateGroup->m_shadingProg == nullptr || !stateGroup->m_shadingProg->isValid()) {
+		m_device->reportValidationError("Draw call without a valid shading program");
+		return false;
+	}
+
+	if (frameTarget == nullptr || !frameTarget->isValid()) {
+		m_device->reportValidationError("Draw call without a valid frame target");
+		return false;
+	}
+
+	if (stateGroup->m_primTopology == PrimitiveTopology::Unknown) {
+		m_device->reportValidationError("Draw call without a primitive topology");
+		return false;
+	}
+
+	const DrawExecDesc& drawExec = drawCall.m_drawExec;
+	if (drawExec.GetType() == DrawExecDesc::Type_Invalid) {
+		m_device->reportValidationError("Draw call without draw arguments");
+		return false;
+	}
+
+	const ShadingProgramRefl& refl = stateGroup->m_shadingProg->getReflection();
+
+	// Vertex attributes and vertex buffers.
+	const std::vector<VertexDecl>& vertexDecl = m_device->getVertexDeclFromIndex(stateGroup->m_vertDeclIndex);
+	for (const VertShaderAttrib& attrib : refl.inputVertices) {
+		const auto declItr =
+		    std::find_if(vertexDecl.begin(), vertexDecl.end(), [&attrib](const VertexDecl& decl) { return decl.semantic == attrib.name; });
+
+		if (declItr == vertexDecl.end()) {
+			m_device->reportValidationError("The vertex declaration doesn't have the attribute '%s' used by the shading program",
+			                                attrib.name.c_str());
+			return false;
+		}
+
+		if (isVertexFormatCompatible(declItr->format, attrib.type) == false) {
+			m_device->reportValidationError("The format of vertex attribute '%s' doesn't match the shading program", attrib.name.c_str());
+			return false;
+		}
+
+		const int slot = declItr->bufferSlot;
+		const BufferNull* const vertexBuffer = static_cast<BufferNull*>(stateGroup->m_vertexBuffers[slot]);
+		if (vertexBuffer == nullptr || !vertexBuffer->isValid() || !vertexBuffer->isVertexBuffer()) {
+			m_device->reportValidationError("No valid vertex buffer at slot %d used by vertex attribute '%s'", slot, attrib.name.c_str());
+			return false;
+		}
+
+		if (vertexBuffer->isMapped()) {
+			m_device->reportValidationError("Drawing with a mapped vertex buffer at slot %d", slot);
+			return false;
+		}
+
+		// For linear draws the read vertices are known, for indexed ones they depend on the indices.
+		if (drawExec.GetType() == DrawExecDesc::Type_Linear && drawExec.LinearCall().numVerts > 0) {
+			const size_t lastVertex = size_t(drawExec.LinearCall().startVert) + size_t(drawExec.LinearCall().numVerts) - 1;
+			const size_t numBytesRead = size_t(stateGroup->m_vbOffsets[slot]) + lastVertex * size_t(stateGroup->m_vbStrides[slot]) +
+			                            size_t(declItr->byteOffset) + size_t(UniformType::GetSizeBytes(declItr->format));
+
+			if (numBytesRead > vertexBuffer->getDesc().sizeBytes) {
+				m_device->reportValidationError("The draw call reads past the end of the vertex buffer at slot %d", slot);
+				return false;
+			}
+		}
+	}
+
+	// Index buffer.
+	if (drawExec.GetType() == DrawExecDesc::Type_Indexed) {
+		const BufferNull* const indexBuffer = static_cast<BufferNull*>(stateGroup->m_indexBuffer);
+		if (indexBuffer == nullptr || !indexBuffer->isValid() || !indexBuffer->isIndexBuffer()) {
+			m_device->reportValidationError("Indexed draw call without a valid index buffer");
+			return false;
+		}
+
+		if (indexBuffer->isMapped()) {
+			m_device->reportValidationError("Drawing with a mapped index buffer");
+			return false;
+		}
+
+		if (stateGroup->m_indexBufferFormat != UniformType::Uint16 && stateGroup->m_indexBufferFormat != UniformType::Uint) {
+			m_device->reportValidationError("Indexed draw call with an index format that isn't 16 or 32 bit unsigned integer");
+			return false;
+		}
+
+		const size_t numBytesRead =
+		    size_t(stateGroup->m_indexBufferByteOffset) +
+		    (size_t(drawExec.IndexedCall().startIndex) + size_t(drawExec.IndexedCall().numIndices)) *
+		        size_t(UniformType::GetSizeBytes(stateGroup->m_indexBufferFormat));
+		if (numBytesRead > indexBuffer->getDesc().sizeBytes) {
+			m_device->reportValidationError("The draw call reads past the end of the index buffer");
+			return false;
+		}
+	}
+
+	// Scissors.
+	if (stateGroup->m_rasterState != nullptr && stateGroup->m_rasterState->getDesc().useScissor && pScissorsRect == nullptr) {
+		m_device->reportValidationError("Draw call with scissors enabled but without a scissors rect");
+		return false;
+	}
+
+	// Uniforms, they must be from the reflection of the shading program.
+	for (int iUniform = 0; iUniform < drawCall.numUniforms; ++iUniform) {
+		const BoundUniform& binding = drawCall.uniforms[iUniform];
+		const UniformType::Enum uniformType = UniformType::Enum(binding.bindLocation.uniformType);
+
+		if (UniformType::isNumeric(uniformType)) {
+			const auto itr = std::find_if(refl.numericUnforms.m_uniforms.begin(), refl.numericUnforms.m_uniforms.end(),
+			                              [&binding](const auto& pair) { return pair.first == binding.bindLocation; });
+			if (itr == refl.numericUnforms.m_uniforms.end()) {
+				m_device->reportValidationError("Numeric uniform at location %d isn't used by the shading program",
+				                                int(binding.bindLocation.bindLocation));
+				return false;
+			}
+
+			if (binding.data == nullptr) {
+				m_device->reportValidationError("Numeric uniform '%s' is bound without data", itr->second.name.c_str());
+				return false;
+			}
+		} else if (uniformType == UniformType::ConstantBuffer) {
+			const auto itr = std::find_if(refl.cbuffers.m_uniforms.begin(), refl.cbuffers.m_uniforms.end(),
+			                              [&binding](const auto& pair) { return pair.first == binding.bindLocation; });
+			if (itr == refl.cbuffers.m_uniforms.end()) {
+				m_device->reportValidationError("Uniform block at location %d isn't used by the shading program",
+				                                int(binding.bindLocation.bindLocation));
+				return false;
+			}
+
+			const BufferNull* const cbuffer = static_cast<BufferNull*>(binding.buffer);
+			if (cbuffer == nullptr || !cbuffer->isValid() || !cbuffer->isConstantBuffer()) {
+				m_device->reportValidationError("Uniform block '%s' is bound without a valid constant buffer", itr->second.name.c_str());
+				return false;
+			}
+
+			if (cbuffer->isMapped()) {
+				m_device->reportValidationError("Drawing with a mapped constant buffer for uniform block '%s'", itr->second.name.c_str());
+				return false;
+			}
+
+			if (cbuffer->getDesc().sizeBytes < size_t(itr->second.sizeBytes)) {
+				m_device->reportValidationError("The constant buffer for uniform block '%s' is smaller than the block",
+				                                itr->second.name.c_str());
+				return false;
+			}
+		} else if (uniformType == UniformType::Texture1D || uniformType == UniformType::Texture2D ||
+		           uniformType == UniformType::TextureCube || uniformType == UniformType::Texture3D) {
+			const auto itr = std::find_if(refl.textures.m_uniforms.begin(), refl.textures.m_uniforms.end(),
+			                              [&binding](const auto& pair) { return pair.first == binding.bindLocation; });
+			if (itr == refl.textures.m_uniforms.end()) {
+				m_device->reportValidationError("Texture at location %d isn't used by the shading program",
+				                                int(binding.bindLocation.bindLocation));
+				return false;
+			}
+
+			// Same as OpenGL, an array of a single element means a single texture bound in BoundUniform::texture.
+			const int arraySize = binding.bindLocation.glArraySize;
+			for (int t = 0; t < arraySize; ++t) {
+				const Texture* const texture = (arraySize == 1) ? binding.texture : binding.textures[t];
+
+				// Null textures are allowed, they just unbind the texture unit.
+				if (texture == nullptr) {
+					continue;
+				}
+
+				if (!texture->isValid() || texture->getDesc().textureType != uniformType) {
+					m_device->reportValidationError("Texture '%s' is bound with an invalid texture or a texture of different type",
+					                                itr->second.name.c_str());
+					return false;
+				}
+
+				if (TextureUsage::CanBeShaderResource(texture->getDesc().usage) == false) {
+					m_device->reportValidationError("Texture '%s' is bound with a texture that cannot be a shader resource",
+					                                itr->second.name.c_str());
+					return false;
+				}
+
+				if (static_cast<FrameTargetNull*>(frameTarget)->isAttached(texture)) {
+					m_device->reportValidationError("Texture '%s' is sampled while being rendered to", itr->second.name.c_str());
+					return false;
+				}
+			}
+		} else if (uniformType != UniformType::SamplerState) {
+			m_device->reportValidationError("Uniform with unknown type %d", int(uniformType));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void SGEContextImmediateNull::applyDrawCallState(const DrawCall& drawCall) {
+	const StateGroup* const stateGroup = drawCall.m_pStateGroup;
+	FrameStatistics& stats = m_device->m_frameStatistics;
+
+	// The shading program.
+	if (m_boundProgram != stateGroup->m_shadingProg) {
+		m_boundProgram = stateGroup->m_shadingProg;
+		stats.numProgramChanges += 1;
+	}
+
+	// Vertex and index buffers.
+	for (int slot = 0; slot < GraphicsCaps::kVertexBufferSlotsCount; ++slot) {
+		if (m_boundVertexBuffers[slot] != stateGroup->m_vertexBuffers[slot] ||
+		    m_boundVertexBufferOffsets[slot] != stateGroup->m_vbOffsets[slot]) {
+			m_boundVertexBuffers[slot] = stateGroup->m_vertexBuffers[slot];
+			m_boundVertexBufferOffsets[slot] = stateGroup->m_vbOffsets[slot];
+			stats.numBufferChanges += 1;
+		}
+	}
+
+	if (drawCall.m_drawExec.GetType() == DrawExecDesc::Type_Indexed && m_boundIndexBuffer != stateGroup->m_indexBuffer) {
+		m_boundIndexBuffer = stateGroup->m_indexBuffer;
+		stats.numBufferChanges += 1;
+	}
+
+	// Uniforms.
+	ShadingProgramNull* const program = static_cast<ShadingProgramNull*>(stateGroup->m_shadingProg);
+	for (int iUniform = 0; iUniform < drawCall.numUniforms; ++iUniform) {
+		const BoundUniform& binding = drawCall.uniforms[iUniform];
+		const UniformType::Enum uniformType = UniformType::Enum(binding.bindLocation.uniformType);
+
+		if (UniformType::isNumeric(uniformType)) {
+			// The values of the uniforms are stored in the program, same as in OpenGL.
+			if (program->setNumericUniformValue(binding.bindLocation, binding.data, getNumericUniformSizeBytes(binding.bindLocation))) {
+				stats.numUniformChanges += 1;
+			}
+		} else if (uniformType == UniformType::ConstantBuffer) {
+			const size_t blockIndex = size_t(binding.bindLocation.bindLocation);
+			if (blockIndex >= m_boundConstantBuffers.size()) {
+				m_boundConstantBuffers.resize(blockIndex + 1, nullptr);
+			}
+
+			if (m_boundConstantBuffers[blockIndex] != binding.buffer) {
+				m_boundConstantBuffers[blockIndex] = binding.buffer;
+				stats.numBufferChanges += 1;
+			}
+		} else if (uniformType != UniformType::SamplerState) {
+			const int arraySize = binding.bindLocation.glArraySize;
+			for (int t = 0; t < arraySize; ++t) {
+				Texture* const texture = (arraySize == 1) ? binding.texture : binding.textures[t];
+				const size_t textureUnit = size_t(binding.bindLocation.glTextureUnit) + size_t(t);
+				if (textureUnit >= m_boundTextures.size()) {
+					m_boundTextures.resize(textureUnit + 1, nullptr);
+				}
+
+				if (m_boundTextures[textureUnit] != texture) {
+					m_boundTextures[textureUnit] = texture;
+					stats.numTextureChanges += 1;
+				}
+			}
+		}
+	}
+}
+
+} // namespace sge
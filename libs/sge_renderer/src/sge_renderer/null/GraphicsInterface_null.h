@@ -0,0 +1,156 @@
+#pragma once
+
+#include "sge_renderer/renderer/renderer.h"
+
+#include <sge_utils/utils/StringRegister.h>
+#include <set>
+
+#include "Buffer_null.h"
+#include "FrameTarget_null.h"
+#include "Query_null.h"
+#include "RenderState_null.h"
+#include "SamplerState_null.h"
+#include "Shader_null.h"
+#include "ShadingProgram_null.h"
+#include "Texture_null.h"
+
+namespace sge {
+
+struct SGEContextImmediateNull;
+
+//---------------------------------------------------------------
+// SGEDeviceNull
+//
+// A device that doesn't talk to any graphics API. The resources live
+// in the CPU memory and the draw calls are only validated and counted,
+// so the renderer could run on machines without a GPU (tests, benchmarks, CI).
+//
+// The device follows the OpenGL conventions (GLSL shaders, bind locations, clip space),
+// so the code above the renderer takes the same paths as with OpenGL.
+//
+// The misuses of the API are reported as validation errors,
+// each distinct message is printed once and all of them are counted.
+//---------------------------------------------------------------
+struct SGEDeviceNull : public SGEDevice {
+	friend SGEContextImmediateNull;
+
+	SGEDeviceNull() = default;
+	~SGEDeviceNull();
+
+	bool Create(const MainFrameTargetDesc& frameTargetDesc);
+
+	void present() final;
+
+	using SGEDevice::requestResource;
+	RAIResource* requestResource(const ResourceType::Enum resourceType) final;
+	void releaseResource(RAIResource* resource) final;
+
+	int getStringIndex(const std::string& str) final { return (int)stringRegister.getIndex(str); }
+
+	SGEContext* getContext() final { return (SGEContext*)m_immContext; }
+	FrameTarget* getWindowFrameTarget() final { return m_screenTarget; }
+
+	void resizeBackBuffer(int width, int height) final;
+	void setVsync(const bool enabled) final { m_VSyncEnabled = enabled; }
+	bool getVsync() const final { return m_VSyncEnabled; }
+
+	VertexDeclIndex getVertexDeclIndex(const VertexDecl* const declElems, const int declElemsCount) final;
+	const std::vector<VertexDecl>& getVertexDeclFromIndex(const VertexDeclIndex index) const final;
+	const std::map<std::vector<VertexDecl>, VertexDeclIndex>& getVertexDeclMap() const final { return m_vertexDeclIndexMap; }
+
+	RasterizerState* requestRasterizerState(const RasterDesc& desc) final;
+	DepthStencilState* requestDepthStencilState(const DepthStencilDesc& desc) final;
+	BlendState* requestBlendState(const BlendStateDesc& desc) final;
+
+	const FrameStatistics& getFrameStatistics() const final { return m_frameStatistics; }
+	FrameStatistics& getFrameStatistics() final { return m_frameStatistics; }
+
+	/// Called by the resources when the GPU memory they would occupy changes.
+	void trackMemory(const ResourceType::Enum resourceType, const size_t numBytesAllocated, const size_t numBytesFreed);
+
+	/// The number of bytes the resources of the specified type would occupy in the GPU memory.
+	size_t getNumBytesAllocated(const ResourceType::Enum resourceType) const { return m_numBytesAllocated[resourceType]; }
+
+	/// The number of resources of the specified type that are requested and not yet released.
+	int getNumLiveResources(const ResourceType::Enum resourceType) const { return m_numLiveResources[resourceType]; }
+
+	/// Reports a misuse of the API.
+	void reportValidationError(const char* const format, ...);
+
+	int getNumValidationErrors() const { return m_numValidationErrors; }
+	const std::string& getLastValidationError() const { return m_lastValidationError; }
+
+  private:
+	FrameStatistics m_frameStatistics;
+	bool m_VSyncEnabled = false;
+
+	// A cache of DepthStencilStateNull, RasterizerStateNull, BlendStateNull.
+	std::vector<RasterizerState*> rasterizerStateCache;
+	std::vector<DepthStencilState*> depthStencilStateCache;
+	std::vector<BlendState*> blendStateCache;
+
+	std::map<std::vector<VertexDecl>, VertexDeclIndex> m_vertexDeclIndexMap;
+
+	StringRegister stringRegister;
+
+	SGEContextImmediateNull* m_immContext = nullptr;
+	GpuHandle<FrameTarget> m_screenTarget;
+
+	size_t m_numBytesAllocated[ResourceType::NumElements] = {0};
+	int m_numLiveResources[ResourceType::NumElements] = {0};
+
+	int m_numValidationErrors = 0;
+	std::string m_lastValidationError;
+	std::set<std::string> m_reportedValidationErrors;
+};
+
+//---------------------------------------------------------------------
+// SGEContextImmediateNull
+// Validates the draw calls and tracks the state they would bind,
+// in order to count the state changes as a real device would do.
+//---------------------------------------------------------------------
+struct SGEContextImmediateNull : public SGEContext {
+	explicit SGEContextImmediateNull(SGEDeviceNull* const device)
+	    : m_device(device) {}
+
+	SGEDevice* getDevice() final { return m_device; }
+
+	void clearColor(FrameTarget* target, int index, const float rgba[4]) final;
+	void clearDepth(FrameTarget* target, float depth) final;
+	void copyDepth(FrameTarget* dest, FrameTarget* src) final;
+
+	void* map(Buffer* buffer, const Map::Enum map) final;
+	void unMap(Buffer* buffer) final;
+
+	void executeDrawCall(DrawCall& drawCall,
+	                     FrameTarget* frameTarget,
+	                     const Rect2s* const pViewport = nullptr,
+	                     const Rect2s* const pScissorsRect = nullptr) final;
+
+	void beginQuery(Query* const query) final;
+	void endQuery(Query* const query) final;
+	bool isQueryReady(Query* const query) final;
+	bool getQueryData(Query* const query, uint64& queryData) final;
+
+	void updateTextureData(Texture* texture, const TextureData& td) final;
+
+  private:
+	/// Returns false (and reports why) if the draw call would be invalid on a real device.
+	bool validateDrawCall(const DrawCall& drawCall, FrameTarget* const frameTarget, const Rect2s* const pScissorsRect);
+
+	/// Updates the bound state with the one of the draw call and counts the changes.
+	void applyDrawCallState(const DrawCall& drawCall);
+
+  private:
+	SGEDeviceNull* m_device = nullptr;
+
+	// The state bound by the last draw call.
+	ShadingProgram* m_boundProgram = nullptr;
+	Buffer* m_boundVertexBuffers[GraphicsCaps::kVertexBufferSlotsCount] = {nullptr};
+	uint32 m_boundVertexBufferOffsets[GraphicsCaps::kVertexBufferSlotsCount] = {0};
+	Buffer* m_boundIndexBuffer = nullptr;
+	std::vector<Buffer*> m_boundConstantBuffers; // Indexed by the bind location of the uniform block.
+	std::vector<Texture*> m_boundTextures;       // Indexed by the texture unit.
+};
+
+} // namespace sge
@@ -0,0 +1,24 @@
+#include "Query_null.h"
+
+namespace sge {
+
+bool QueryNull::create(QueryType::Enum const queryType) {
+	destroy();
+
+	m_queryType = queryType;
+	m_isValid = true;
+
+	return true;
+}
+
+void QueryNull::destroy() {
+	m_isValid = false;
+	m_isActive = false;
+	m_hasResult = false;
+}
+
+bool QueryNull::isValid() const {
+	return m_isValid;
+}
+
+} // namespace sge
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "sge_renderer/renderer/renderer.h"
+
+namespace sge {
+
+struct QueryNull : public Query {
+	QueryNull() {}
+	~QueryNull() { destroy(); }
+
+	bool create(QueryType::Enum const queryType) final;
+
+	virtual void destroy() final;
+	virtual bool isValid() const final;
+
+	QueryType::Enum getType() const { return m_queryType; }
+
+	/// True between SGEContext::beginQuery and SGEContext::endQuery.
+	bool isActive() const { return m_isActive; }
+	/// True if the query has been ended at least once, so there is a result to be read.
+	bool hasResult() const { return m_hasResult; }
+
+	void begin() { m_isActive = true; }
+	void end() {
+		m_isActive = false;
+		m_hasResult = true;
+	}
+
+  private:
+	QueryType::Enum m_queryType = QueryType::NumSamplesPassedDepthStencilTest;
+	bool m_isValid = false;
+	bool m_isActive = false;
+	bool m_hasResult = false;
+};
+
+} // namespace sge
@@ -0,0 +1,61 @@
+#include "RenderState_null.h"
+
+namespace sge {
+
+//--------------------------------------------------------------------------
+// RasterizerStateNull
+//--------------------------------------------------------------------------
+bool RasterizerStateNull::create(const RasterDesc& desc) {
+	m_bufferedDesc = desc;
+	m_isValid = true;
+	return true;
+}
+
+void RasterizerStateNull::destroy() {
+	m_isValid = false;
+}
+
+bool RasterizerStateNull::isValid() const {
+	return m_isValid;
+}
+
+//--------------------------------------------------------------------------
+// DepthStencilStateNull
+//--------------------------------------------------------------------------
+bool DepthStencilStateNull::create(const DepthStencilDesc& desc) {
+	m_bufferedDesc = desc;
+	m_isValid = true;
+	return true;
+}
+
+void DepthStencilStateNull::destroy() {
+	m_isValid = false;
+}
+
+bool DepthStencilStateNull::isValid() const {
+	return m_isValid;
+}
+
+//--------------------------------------------------------------------------
+// BlendStateNull
+//--------------------------------------------------------------------------
+bool BlendStateNull::create(const BlendStateDesc& desc) {
+	// Same as OpenGL, there is a single blend state for all render targets.
+	if (desc.independentBlend != false) {
+		sgeAssert(false && "Independent blend state is not supported on the null device!\n");
+	}
+
+	m_bufferedDesc = desc;
+	m_isValid = true;
+	return true;
+}
+
+void BlendStateNull::destroy() {
+	m_isValid = false;
+}
+
+bool BlendStateNull::isValid() const {
+	return m_isValid;
+}
+
+} // namespace sge
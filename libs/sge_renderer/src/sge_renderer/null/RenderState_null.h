@@ -0,0 +1,64 @@
+#pragma once
+
+#include "sge_renderer/renderer/renderer.h"
+
+namespace sge {
+
+//-----------------------------------------------------------------
+// RasterizerStateNull
+//-----------------------------------------------------------------
+struct RasterizerStateNull : public RasterizerState {
+	RasterizerStateNull() {}
+	~RasterizerStateNull() { destroy(); }
+
+	bool create(const RasterDesc& desc) final;
+
+	virtual void destroy() final;
+	virtual bool isValid() const final;
+
+	const RasterDesc& getDesc() const final { return m_bufferedDesc; }
+
+  private:
+	RasterDesc m_bufferedDesc;
+	bool m_isValid = false;
+};
+
+//-----------------------------------------------------------------
+// DepthStencilStateNull
+//-----------------------------------------------------------------
+struct DepthStencilStateNull : public DepthStencilState {
+	DepthStencilStateNull() {}
+	~DepthStencilStateNull() { destroy(); }
+
+	bool create(const DepthStencilDesc& desc) final;
+
+	virtual void destroy() final;
+	virtual bool isValid() const final;
+
+	const DepthStencilDesc& getDesc() const final { return m_bufferedDesc; }
+
+  private:
+	DepthStencilDesc m_bufferedDesc;
+	bool m_isValid = false;
+};
+
+//-----------------------------------------------------------------
+// BlendStateNull
+//-----------------------------------------------------------------
+struct BlendStateNull : public BlendState {
+	BlendStateNull() {}
+	~BlendStateNull() { destroy(); }
+
+	bool create(const BlendStateDesc& desc) final;
+
+	virtual void destroy() final;
+	virtual bool isValid() const final;
+
+	const BlendStateDesc& getDesc() const final { return m_bufferedDesc; }
+
+  private:
+	BlendStateDesc m_bufferedDesc;
+	bool m_isValid = false;
+};
+
+} // namespace sge
@@ -0,0 +1,19 @@
+#include "SamplerState_null.h"
+
+namespace sge {
+
+bool SamplerStateNull::create(const SamplerDesc& desc) {
+	m_cachedDesc = desc;
+	m_isValid = true;
+	return true;
+}
+
+void SamplerStateNull::destroy() {
+	m_isValid = false;
+}
+
+bool SamplerStateNull::isValid() const {
+	return m_isValid;
+}
+
+} // namespace sge
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "sge_renderer/renderer/renderer.h"
+
+namespace sge {
+
+struct SamplerStateNull : public SamplerState {
+	SamplerStateNull() {}
+	~SamplerStateNull() { destroy(); }
+
+	bool create(const SamplerDesc& desc) final;
+
+	const SamplerDesc& getDesc() const final { return m_cachedDesc; }
+
+	void destroy() final;
+	bool isValid() const final;
+
+  protected:
+	SamplerDesc m_cachedDesc;
+	bool m_isValid = false;
+};
+
+} // namespace sge
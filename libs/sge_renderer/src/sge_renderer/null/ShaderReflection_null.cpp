@@ -0,0 +1,467 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <map>
+#include <string_view>
+
+#include "GraphicsInterface_null.h"
+#include "Shader_null.h"
+#include "ShadingProgram_null.h"
+
+#include "sge_renderer/renderer/ShaderReflection.h"
+
+namespace sge {
+
+BindLocation NumericUniformRefl::computeBindLocation() const {
+	return BindLocation((short)bindLocation, (short)uniformType, (short)arraySize, 0);
+}
+
+BindLocation CBufferRefl::computeBindLocation() const {
+	return BindLocation((short)gl_bindLocation, (short)UniformType::ConstantBuffer, 1, 0);
+}
+
+BindLocation TextureRefl::computeBindLocation() const {
+	return BindLocation((short)gl_bindLocation, (short)textureType, short(arraySize), short(gl_bindUnit));
+}
+
+BindLocation SamplerRefl::computeBindLocation() const {
+	// Same as OpenGL, the samplers are embedded in the textures.
+	sgeAssert(false);
+	return BindLocation();
+}
+
+namespace {
+	/// A variable declared in the global scope of the shader or in an uniform block.
+	struct GLSLDeclaration {
+		std::string_view type;
+		std::string_view name;
+		int arraySize = 0; // Zero if not an array.
+	};
+
+	struct GLSLUniformBlock {
+		std::string_view name;
+		std::vector<GLSLDeclaration> members;
+	};
+
+	/// The declarations of a shader that make its interface.
+	struct GLSLInterface {
+		std::vector<GLSLDeclaration> uniforms;
+		std::vector<GLSLUniformBlock> uniformBlocks;
+		std::vector<GLSLDeclaration> inputs;
+	};
+
+	/// Splits the GLSL code into identifiers, numbers and single character punctuators.
+	/// The comments and the preprocessor directives are skipped, the code is expected to be already preprocessed.
+	std::vector<std::string_view> tokenizeGLSL(const std::string& code) {
+		std::vector<std::string_view> tokens;
+
+		const size_t codeLen = code.size();
+		bool isLineStart = true;
+		size_t i = 0;
+		while (i < codeLen) {
+			const char ch = code[i];
+
+			if (ch == '\n') {
+				isLineStart = true;
+				i++;
+			} else if (isspace((unsigned char)ch)) {
+				i++;
+			} else if (ch == '/' && i + 1 < codeLen && code[i + 1] == '/') {
+				while (i < codeLen && code[i] != '\n') {
+					i++;
+				}
+			} else if (ch == '/' && i + 1 < codeLen && code[i + 1] == '*') {
+				const size_t commentEnd = code.find("*/", i + 2);
+				i = (commentEnd == std::string::npos) ? codeLen : commentEnd + 2;
+			} else if (ch == '#' && isLineStart) {
+				// Preprocessor directive, it could continue on the next lines with '\'.
+				while (i < codeLen && code[i] != '\n') {
+					if (code[i] == '\\' && i + 1 < codeLen && code[i + 1] == '\n') {
+						i++;
+					}
+					i++;
+				}
+			} else if (isalnum((unsigned char)ch) || ch == '_') {
+				// Identifiers and numbers (including suffixes and fractions like 1.0f).
+				const size_t tokenStart = i;
+				const bool isNumber = isdigit((unsigned char)ch) != 0;
+				while (i < codeLen && (isalnum((unsigned char)code[i]) || code[i] == '_' || (isNumber && code[i] == '.'))) {
+					i++;
+				}
+				tokens.emplace_back(code.data() + tokenStart, i - tokenStart);
+				isLineStart = false;
+			} else {
+				tokens.emplace_back(code.data() + i, 1);
+				isLineStart = false;
+				i++;
+			}
+		}
+
+		return tokens;
+	}
+
+	/// Returns the numeric uniform type for a GLSL type name or UniformType::Unknown.
+	UniformType::Enum getNumericTypeFromGLSL(const std::string_view& typeName) {
+		static const std::map<std::string_view, UniformType::Enum> glslNumericTypes = {
+		    {"int", UniformType::Int},          {"ivec2", UniformType::Int2},       {"ivec3", UniformType::Int3},
+		    {"ivec4", UniformType::Int4},       {"uint", UniformType::Uint},        {"uvec2", UniformType::Uint2},
+		    {"uvec3", UniformType::Uint3},      {"uvec4", UniformType::Uint4},      {"float", UniformType::Float},
+		    {"vec2", UniformType::Float2},      {"vec3", UniformType::Float3},      {"vec4", UniformType::Float4},
+		    {"mat3", UniformType::Float3x3},    {"mat3x3", UniformType::Float3x3},  {"mat4", UniformType::Float4x4},
+		    {"mat4x4", UniformType::Float4x4},
+		};
+
+		const auto itr = glslNumericTypes.find(typeName);
+		return itr != glslNumericTypes.end() ? itr->second : UniformType::Unknown;
+	}
+
+	/// Returns the texture type for a GLSL sampler type name or UniformType::Unknown.
+	UniformType::Enum getTextureTypeFromGLSL(const std::string_view& typeName) {
+		static const std::map<std::string_view, UniformType::Enum> glslSamplerTypes = {
+		    {"sampler1D", UniformType::Texture1D},         {"isampler1D", UniformType::Texture1D},
+		    {"usampler1D", UniformType::Texture1D},        {"sampler1DShadow", UniformType::Texture1D},
+		    {"sampler2D", UniformType::Texture2D},         {"isampler2D", UniformType::Texture2D},
+		    {"usampler2D", UniformType::Texture2D},        {"sampler2DShadow", UniformType::Texture2D},
+		    {"sampler2DMS", UniformType::Texture2D},       {"samplerCube", UniformType::TextureCube},
+		    {"samplerCubeShadow", UniformType::TextureCube}, {"sampler3D", UniformType::Texture3D},
+		    {"isampler3D", UniformType::Texture3D},        {"usampler3D", UniformType::Texture3D},
+		};
+
+		const auto itr = glslSamplerTypes.find(typeName);
+		return itr != glslSamplerTypes.end() ? itr->second : UniformType::Unknown;
+	}
+
+	/// Computes the size and the alignment of a variable in an uniform block with the std140 layout.
+	/// Returns false if the type isn't supported.
+	bool getStd140SizeAndAlignment(const GLSLDeclaration& decl, int& outSizeBytes, int& outAlignment) {
+		const UniformType::Enum type = getNumericTypeFromGLSL(decl.type);
+		int sizeBytes = 0;
+		int alignment = 0;
+
+		if (decl.type == "bool") {
+			sizeBytes = 4;
+			alignment = 4;
+		} else if (type == UniformType::Float3x3) {
+			// Each column is aligned as a vec4.
+			sizeBytes = 48;
+			alignment = 16;
+		} else if (type == UniformType::Float4x4) {
+			sizeBytes = 64;
+			alignment = 16;
+		} else if (type != UniformType::Unknown) {
+			sizeBytes = int(UniformType::GetSizeBytes(type));
+			// vec3 is aligned as vec4.
+			alignment = sizeBytes == 12 ? 16 : sizeBytes;
+		} else {
+			return false;
+		}
+
+		// The elements of the arrays are aligned as vec4.
+		if (decl.arraySize > 0) {
+			alignment = 16;
+			sizeBytes = ((sizeBytes + 15) / 16) * 16 * decl.arraySize;
+		}
+
+		outSizeBytes = sizeBytes;
+		outAlignment = alignment;
+		return true;
+	}
+
+	/// Returns the index of the token after the matching closing bracket of the opening bracket at @openIdx.
+	size_t skipBrackets(const std::vector<std::string_view>& tokens, size_t openIdx, const char open, const char close) {
+		int depth = 0;
+		for (size_t i = openIdx; i < tokens.size(); ++i) {
+			if (tokens[i].size() == 1 && tokens[i][0] == open) {
+				depth++;
+			} else if (tokens[i].size() == 1 && tokens[i][0] == close) {
+				depth--;
+				if (depth == 0) {
+					return i + 1;
+				}
+			}
+		}
+
+		return tokens.size();
+	}
+
+	/// Parses the tokens [begin, end) in the form "[qualifiers] type name[N], name2 = ..., ..." and adds the declarations to @result.
+	bool parseDeclarators(const std::vector<std::string_view>& tokens, size_t begin, const size_t end, std::vector<GLSLDeclaration>& result) {
+		static const std::string_view qualifiers[] = {"highp", "mediump", "lowp",      "flat", "smooth", "noperspective",
+		                                              "centroid", "invariant", "precise", "const"};
+
+		while (begin < end && std::find(std::begin(qualifiers), std::end(qualifiers), tokens[begin]) != std::end(qualifiers)) {
+			begin++;
+		}
+
+		if (begin >= end) {
+			return false;
+		}
+
+		const std::string_view type = tokens[begin];
+		size_t i = begin + 1;
+		while (i < end) {
+			GLSLDeclaration decl;
+			decl.type = type;
+			decl.name = tokens[i++];
+
+			if (i < end && tokens[i] == "[") {
+				if (i + 2 >= end || tokens[i + 2] != "]") {
+					return false;
+				}
+
+				const std::string arraySizeStr(tokens[i + 1]);
+				char* arraySizeStrEnd = nullptr;
+				decl.arraySize = int(strtol(arraySizeStr.c_str(), &arraySizeStrEnd, 10));
+				if (decl.arraySize <= 0) {
+					return false;
+				}
+
+				i += 3;
+			}
+
+			result.push_back(decl);
+
+			// Skip the initializer if any.
+			while (i < end && tokens[i] != ",") {
+				i = (tokens[i] == "(") ? skipBrackets(tokens, i, '(', ')') : i + 1;
+			}
+
+			i++; // Skip the ','.
+		}
+
+		return true;
+	}
+
+	/// Finds the uniforms, uniform blocks and input attributes declared in the global scope of the shader.
+	/// The function bodies and the struct definitions are skipped.
+	bool parseGLSLInterface(const std::vector<std::string_view>& tokens, GLSLInterface& result) {
+		const size_t numTokens = tokens.size();
+		size_t i = 0;
+
+		while (i < numTokens) {
+			// Skip the layout qualifier, as the null device doesn't use explicit bindings.
+			size_t declBegin = i;
+			if (tokens[declBegin] == "layout" && declBegin + 1 < numTokens && tokens[declBegin + 1] == "(") {
+				declBegin = skipBrackets(tokens, declBegin + 1, '(', ')');
+			}
+
+			// Find the end of the declaration, a ';' or a '{' opening a function body, a struct or an uniform block.
+			size_t declEnd = declBegin;
+			while (declEnd < numTokens && tokens[declEnd] != ";" && tokens[declEnd] != "{") {
+				declEnd = (tokens[declEnd] == "(") ? skipBrackets(tokens, declEnd, '(', ')') : declEnd + 1;
+			}
+
+			if (declEnd >= numTokens) {
+				break;
+			}
+
+			if (declBegin >= declEnd) {
+				i = declEnd + 1;
+				continue;
+			}
+
+			const std::string_view& firstToken = tokens[declBegin];
+
+			if (tokens[declEnd] == "{") {
+				const size_t blockEnd = skipBrackets(tokens, declEnd, '{', '}');
+				if (blockEnd > numTokens) {
+					return false;
+				}
+
+				if (firstToken == "uniform") {
+					// uniform BlockName { members } [instanceName];
+					if (declEnd - declBegin != 2) {
+						return false;
+					}
+
+					GLSLUniformBlock block;
+					block.name = tokens[declBegin + 1];
+
+					size_t memberBegin = declEnd + 1;
+					while (memberBegin < blockEnd - 1) {
+						size_t memberEnd = memberBegin;
+						while (memberEnd < blockEnd - 1 && tokens[memberEnd] != ";") {
+							memberEnd++;
+						}
+
+						if (parseDeclarators(tokens, memberBegin, memberEnd, block.members) == false) {
+							return false;
+						}
+
+						memberBegin = memberEnd + 1;
+					}
+
+					result.uniformBlocks.push_back(block);
+				}
+
+				// The blocks and the structs end with a ';' (possibly after declaring variables), the functions don't.
+				i = blockEnd;
+				if (firstToken == "uniform" || firstToken == "struct") {
+					while (i < numTokens && tokens[i] != ";") {
+						i++;
+					}
+					i++;
+				}
+
+				continue;
+			}
+
+			if (firstToken == "uniform") {
+				if (parseDeclarators(tokens, declBegin + 1, declEnd, result.uniforms) == false) {
+					return false;
+				}
+			} else if (firstToken == "in" || firstToken == "attribute") {
+				if (parseDeclarators(tokens, declBegin + 1, declEnd, result.inputs) == false) {
+					return false;
+				}
+			}
+
+			i = declEnd + 1;
+		}
+
+		return true;
+	}
+} // namespace
+
+//---------------------------------------------------------------
+// ShaderRefl
+//---------------------------------------------------------------
+bool ShadingProgramRefl::create(ShadingProgram* const shadingProgram) {
+	if (!shadingProgram || !shadingProgram->isValid()) {
+		return false;
+	}
+
+	SGEDeviceNull* const device = shadingProgram->getDevice<SGEDeviceNull>();
+	const ShaderNull* const vertShader = static_cast<ShaderNull*>(shadingProgram->getVertexShader());
+	const ShaderNull* const pixelShader = static_cast<ShaderNull*>(shadingProgram->getPixelShader());
+
+	// The tokens point in the code of the shaders.
+	GLSLInterface vsInterface;
+	GLSLInterface psInterface;
+	if (parseGLSLInterface(tokenizeGLSL(vertShader->getCode()), vsInterface) == false) {
+		device->reportValidationError("Failed to parse the declarations of a vertex shader");
+		return false;
+	}
+
+	if (parseGLSLInterface(tokenizeGLSL(pixelShader->getCode()), psInterface) == false) {
+		device->reportValidationError("Failed to parse the declarations of a pixel shader");
+		return false;
+	}
+
+	// Vertex shader attributes.
+	for (const GLSLDeclaration& input : vsInterface.inputs) {
+		VertShaderAttrib attrib;
+		attrib.name = std::string(input.name);
+		attrib.nameStrIdx = device->getStringIndex(attrib.name);
+		attrib.type = getNumericTypeFromGLSL(input.type);
+		attrib.attributeLocation = int(inputVertices.size());
+
+		inputVertices.push_back(attrib);
+	}
+
+	// Uniforms, same as in OpenGL the program has a single set of uniforms for all stages.
+	// Uniforms declared in multiple stages are the same uniform.
+	int nextUniformLocation = 0;
+	int nextTextureUnit = 1; // Unit 0 is left for the texture modifications.
+	std::map<std::string_view, std::string_view> declaredUniformTypes;
+
+	for (const GLSLInterface* const shaderInterface : {&vsInterface, &psInterface}) {
+		for (const GLSLDeclaration& decl : shaderInterface->uniforms) {
+			const auto itrDeclared = declaredUniformTypes.find(decl.name);
+			if (itrDeclared != declaredUniformTypes.end()) {
+				if (itrDeclared->second != decl.type) {
+					device->reportValidationError("Uniform '%s' is declared with different types in the shaders",
+					                              std::string(decl.name).c_str());
+					return false;
+				}
+				continue;
+			}
+
+			declaredUniformTypes[decl.name] = decl.type;
+
+			const UniformType::Enum numericType = getNumericTypeFromGLSL(decl.type);
+			const UniformType::Enum textureType = getTextureTypeFromGLSL(decl.type);
+
+			if (numericType != UniformType::Unknown) {
+				NumericUniformRefl uniform;
+				uniform.name = std::string(decl.name);
+				uniform.nameStrIdx = device->getStringIndex(uniform.name);
+				uniform.uniformType = numericType;
+				uniform.arraySize = maxOf(decl.arraySize, 1);
+				uniform.bindLocation = nextUniformLocation;
+				nextUniformLocation += uniform.arraySize;
+
+				numericUnforms.add(uniform);
+			} else if (textureType != UniformType::Unknown) {
+				TextureRefl texture;
+				texture.name = std::string(decl.name);
+				texture.nameStrIdx = device->getStringIndex(texture.name);
+				texture.textureType = textureType;
+				texture.arraySize = maxOf(decl.arraySize, 1);
+				texture.gl_bindLocation = nextUniformLocation;
+				texture.gl_bindUnit = nextTextureUnit;
+				nextUniformLocation += texture.arraySize;
+				nextTextureUnit += texture.arraySize;
+
+				textures.add(texture);
+			}
+			// Uniforms of other types (structs, bools) aren't supported by the SGE API, they are left unreflected.
+		}
+	}
+
+	// Uniform blocks.
+	int nextBlockIndex = 0;
+	for (const GLSLInterface* const shaderInterface : {&vsInterface, &psInterface}) {
+		for (const GLSLUniformBlock& block : shaderInterface->uniformBlocks) {
+			CBufferRefl cbuffer;
+			cbuffer.name = std::string(block.name);
+			cbuffer.nameStrIdx = device->getStringIndex(cbuffer.name);
+
+			int offset = 0;
+			for (const GLSLDeclaration& member : block.members) {
+				int sizeBytes = 0;
+				int alignment = 0;
+				if (getStd140SizeAndAlignment(member, sizeBytes, alignment) == false) {
+					device->reportValidationError("Unsupported type '%s' in uniform block '%s'", std::string(member.type).c_str(),
+					                              cbuffer.name.c_str());
+					return false;
+				}
+
+				offset = ((offset + alignment - 1) / alignment) * alignment;
+
+				CBufferVariableRefl var;
+				var.name = std::string(member.name);
+				var.nameStrIdx = device->getStringIndex(var.name);
+				var.type = getNumericTypeFromGLSL(member.type);
+				var.offset = offset;
+				var.arraySize = member.arraySize;
+
+				cbuffer.variables.push_back(var);
+				offset += sizeBytes;
+			}
+
+			// The size of the block is rounded up to a vec4.
+			cbuffer.sizeBytes = ((offset + 15) / 16) * 16;
+
+			const BindLocation existingBlock = cbuffers.findUniform(cbuffer.name.c_str(), ShaderType::VertexShader);
+			if (existingBlock.isNull() == false) {
+				for (const auto& itr : cbuffers.m_uniforms) {
+					if (itr.first == existingBlock && itr.second.sizeBytes != cbuffer.sizeBytes) {
+						device->reportValidationError("Uniform block '%s' is declared differently in the shaders", cbuffer.name.c_str());
+						return false;
+					}
+				}
+				continue;
+			}
+
+			cbuffer.gl_bindLocation = nextBlockIndex;
+			nextBlockIndex++;
+
+			cbuffers.add(cbuffer);
+		}
+	}
+
+	return true;
+}
+
+} // namespace sge
@@ -0,0 +1,24 @@
+#include "Shader_null.h"
+
+namespace sge {
+
+CreateShaderResult ShaderNull::createNative(const ShaderType::Enum type, const char* pCode, const char* const UNUSED(entryPoint)) {
+	destroy();
+
+	if (pCode == nullptr) {
+		return CreateShaderResult(false, "No shader code specified");
+	}
+
+	m_shaderType = type;
+	m_code = pCode;
+	m_isValid = true;
+
+	return CreateShaderResult(true, "");
+}
+
+void ShaderNull::destroy() {
+	m_code = std::string();
+	m_isValid = false;
+}
+
+} // namespace sge
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "sge_renderer/renderer/renderer.h"
+
+namespace sge {
+
+//----------------------------------------------------------------------------
+// ShaderNull
+// Keeps the GLSL code of the shader, it gets reflected when linked in a ShadingProgramNull.
+//----------------------------------------------------------------------------
+struct ShaderNull : public Shader {
+	ShaderNull() {}
+	~ShaderNull() { destroy(); }
+
+	// Creates the shader using the native language for the API (GLSL, same as OpenGL).
+	CreateShaderResult createNative(const ShaderType::Enum type, const char* pCode, const char* const entryPoint) final;
+
+	virtual void destroy() override;
+	virtual bool isValid() const override { return m_isValid; }
+
+	const ShaderType::Enum getShaderType() const final { return m_shaderType; }
+
+	const std::string& getCode() const { return m_code; }
+
+  private:
+	ShaderType::Enum m_shaderType = ShaderType::VertexShader;
+	std::string m_code;
+	bool m_isValid = false;
+};
+
+} // namespace sge
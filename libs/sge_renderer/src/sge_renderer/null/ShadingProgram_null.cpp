@@ -0,0 +1,77 @@
+#include "ShadingProgram_null.h"
+#include "GraphicsInterface_null.h"
+#include "Shader_null.h"
+#include <cstring>
+
+namespace sge {
+
+bool ShadingProgramNull::create(Shader* vertShdr, Shader* pixelShdr) {
+	if (!vertShdr || !pixelShdr) {
+		return false;
+	}
+
+	// Cleanup the current state.
+	destroy();
+
+	if (!vertShdr->isValid() || vertShdr->getShaderType() != ShaderType::VertexShader || !pixelShdr->isValid() ||
+	    pixelShdr->getShaderType() != ShaderType::PixelShader) {
+		getDevice<SGEDeviceNull>()->reportValidationError("Linking a shading program with invalid or mismatched shaders");
+		return false;
+	}
+
+	m_vertShdr = vertShdr;
+	m_pixShadr = pixelShdr;
+	m_isValid = true;
+
+	if (m_reflection.create(this) == false) {
+		destroy();
+		return false;
+	}
+
+	return true;
+}
+
+CreateShaderResult ShadingProgramNull::createFromNativeCode(const char* const pVSCode, const char* const pPSCode) {
+	GpuHandle<ShaderNull> vs = getDevice()->requestResource<Shader>();
+	CreateShaderResult createVertexShdrRes = vs->createNative(ShaderType::VertexShader, pVSCode, nullptr);
+	if (createVertexShdrRes.succeeded == false) {
+		return createVertexShdrRes;
+	}
+
+	GpuHandle<ShaderNull> ps = getDevice()->requestResource<Shader>();
+	CreateShaderResult createPixelShdrRes = ps->createNative(ShaderType::PixelShader, pPSCode, nullptr);
+	if (createPixelShdrRes.succeeded == false) {
+		return createPixelShdrRes;
+	}
+
+	if (create(vs, ps)) {
+		return CreateShaderResult(true, "");
+	}
+
+	return CreateShaderResult(false, "Failed to reflect the GLSL code of the shading program");
+}
+
+void ShadingProgramNull::destroy() {
+	m_vertShdr.Release();
+	m_pixShadr.Release();
+	m_reflection = ShadingProgramRefl();
+	m_numericUniformValues.clear();
+	m_isValid = false;
+}
+
+bool ShadingProgramNull::setNumericUniformValue(const BindLocation& bindLocation, const void* const data, const size_t sizeBytes) {
+	const size_t location = size_t(bindLocation.bindLocation);
+	if (location >= m_numericUniformValues.size()) {
+		m_numericUniformValues.resize(location + 1);
+	}
+
+	std::vector<char>& value = m_numericUniformValues[location];
+	if (value.size() == sizeBytes && memcmp(value.data(), data, sizeBytes) == 0) {
+		return false;
+	}
+
+	value.assign(static_cast<const char*>(data), static_cast<const char*>(data) + sizeBytes);
+	return true;
+}
+
+} // namespace sge
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "sge_renderer/renderer/renderer.h"
+
+namespace sge {
+
+//----------------------------------------------------------------------------
+// ShadingProgramNull
+// The reflection is obtained by parsing the declarations in the GLSL code of the shaders.
+//----------------------------------------------------------------------------
+struct ShadingProgramNull : public ShadingProgram {
+	ShadingProgramNull() {}
+	~ShadingProgramNull() { destroy(); }
+
+	bool create(Shader* vertShdr, Shader* pixelShdr) final;
+	CreateShaderResult createFromNativeCode(const char* const pVSCode, const char* const pPSCode) final;
+
+	void destroy() override;
+	bool isValid() const override { return m_isValid; }
+
+	// Resource access.
+	Shader* getVertexShader() const final { return m_vertShdr.GetPtr(); }
+	Shader* getPixelShader() const final { return m_pixShadr.GetPtr(); }
+
+	const ShadingProgramRefl& getReflection() const final { return m_reflection; }
+
+	/// Stores the value of a numeric uniform, like the program object does in OpenGL.
+	/// Returns true if the new value differs from the stored one.
+	bool setNumericUniformValue(const BindLocation& bindLocation, const void* const data, const size_t sizeBytes);
+
+  private:
+	GpuHandle<Shader> m_vertShdr;
+	GpuHandle<Shader> m_pixShadr;
+
+	ShadingProgramRefl m_reflection;
+	bool m_isValid = false;
+
+	/// The last values of the numeric uniforms indexed by their bind location.
+	std::vector<std::vector<char>> m_numericUniformValues;
+};
+
+} // namespace sge
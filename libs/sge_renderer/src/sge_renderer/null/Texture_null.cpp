@@ -0,0 +1,170 @@
+#include "Texture_null.h"
+#include "GraphicsInterface_null.h"
+
+namespace sge {
+
+namespace {
+	/// Returns the number of bytes needed for a single 2D slice of a mip level.
+	size_t computeSliceSizeBytes(const TextureFormat::Enum format, const int width, const int height) {
+		if (TextureFormat::IsBC(format)) {
+			// The BC formats are stored in blocks of 4x4 texels, BC1 and BC4 use 8 bytes per block, the rest use 16.
+			const size_t numBlocks = size_t((width + 3) / 4) * size_t((height + 3) / 4);
+			const bool isSmallBlock = format == TextureFormat::BC1_UNORM || format == TextureFormat::BC4_UNORM ||
+			                          format == TextureFormat::BC4_SNORM;
+			return numBlocks * (isSmallBlock ? 8 : 16);
+		}
+
+		return size_t(width) * size_t(height) * TextureFormat::GetSizeBytes(format);
+	}
+} // namespace
+
+//---------------------------------------------------------------
+// TextureNull
+//---------------------------------------------------------------
+bool TextureNull::create(const TextureDesc& desc, const TextureData initalData[], const SamplerDesc samplerDesc) {
+	destroy();
+
+	SGEDeviceNull* const device = getDevice<SGEDeviceNull>();
+
+	if (desc.format == TextureFormat::Unknown) {
+		device->reportValidationError("Creating a texture with an unknown format");
+		return false;
+	}
+
+	int width = 0;
+	int height = 1;
+	int numMips = 0;
+	int arraySize = 1;
+	if (desc.textureType == UniformType::Texture1D) {
+		width = desc.texture1D.width;
+		numMips = desc.texture1D.numMips;
+		arraySize = desc.texture1D.arraySize;
+	} else if (desc.textureType == UniformType::Texture2D) {
+		width = desc.texture2D.width;
+		height = desc.texture2D.height;
+		numMips = desc.texture2D.numMips;
+		arraySize = desc.texture2D.arraySize;
+	} else if (desc.textureType == UniformType::TextureCube) {
+		width = desc.textureCube.width;
+		height = desc.textureCube.height;
+		numMips = desc.textureCube.numMips;
+		arraySize = desc.textureCube.arraySize;
+	} else if (desc.textureType == UniformType::Texture3D) {
+		width = desc.texture3D.width;
+		height = desc.texture3D.height;
+		numMips = desc.texture3D.numMips;
+	} else {
+		device->reportValidationError("Creating a texture with an unknown texture type");
+		return false;
+	}
+
+	if (width <= 0 || height <= 0 || arraySize <= 0) {
+		device->reportValidationError("Creating a texture with invalid dimensions %dx%d and array size %d", width, height, arraySize);
+		return false;
+	}
+
+	int maxNumMips = 1;
+	while ((maxOf(width, height) >> maxNumMips) > 0) {
+		maxNumMips++;
+	}
+
+	if (numMips <= 0 || numMips > maxNumMips) {
+		device->reportValidationError("Creating a texture with %d mips, the allowed range is [1;%d]", numMips, maxNumMips);
+		return false;
+	}
+
+	if (TextureFormat::IsDepth(desc.format) && TextureUsage::CanBeDepthStencil(desc.usage) == false) {
+		device->reportValidationError("Creating a texture with a depth format but without depth stencil usage");
+		return false;
+	}
+
+	m_desc = desc;
+
+	// Mip streaming: the most detailed mips without data aren't resident, see setResidentMips.
+	m_mostDetailedResidentMip = 0;
+	if (initalData != nullptr && m_desc.textureType == UniformType::Texture2D && m_desc.texture2D.numMips > 1 &&
+	    m_desc.texture2D.arraySize == 1) {
+		while (m_mostDetailedResidentMip < m_desc.texture2D.numMips - 1 && initalData[m_mostDetailedResidentMip].data == nullptr) {
+			m_mostDetailedResidentMip++;
+		}
+	}
+
+	m_samplerState = getDevice()->requestResource<SamplerState>();
+	m_samplerState->create(samplerDesc);
+
+	m_isValid = true;
+	m_numBytesResident = computeNumBytes(m_mostDetailedResidentMip);
+	device->trackMemory(ResourceType::Texture, m_numBytesResident, 0);
+
+	return true;
+}
+
+void TextureNull::destroy() {
+	if (m_isValid) {
+		getDevice<SGEDeviceNull>()->trackMemory(ResourceType::Texture, 0, m_numBytesResident);
+	}
+
+	m_samplerState.Release();
+	m_isValid = false;
+	m_mostDetailedResidentMip = 0;
+	m_numBytesResident = 0;
+}
+
+bool TextureNull::setResidentMips(const int mostDetailedMip, const TextureData mipsData[]) {
+	if (!isValid() || m_desc.textureType != UniformType::Texture2D || m_desc.texture2D.arraySize != 1 ||
+	    m_desc.texture2D.numSamples > 1) {
+		return false;
+	}
+
+	const int newMostDetailedMip = clamp(mostDetailedMip, 0, m_desc.texture2D.numMips - 1);
+	if (newMostDetailedMip == m_mostDetailedResidentMip) {
+		return true;
+	}
+
+	// The data is needed only when streaming in.
+	if (newMostDetailedMip < m_mostDetailedResidentMip && mipsData == nullptr) {
+		getDevice<SGEDeviceNull>()->reportValidationError("Changing the resident texture mips without data");
+		return false;
+	}
+
+	const size_t newNumBytesResident = computeNumBytes(newMostDetailedMip);
+	getDevice<SGEDeviceNull>()->trackMemory(ResourceType::Texture, newNumBytesResident, m_numBytesResident);
+
+	m_mostDetailedResidentMip = newMostDetailedMip;
+	m_numBytesResident = newNumBytesResident;
+
+	return true;
+}
+
+size_t TextureNull::computeNumBytes(const int mostDetailedMip) const {
+	size_t numBytes = 0;
+
+	if (m_desc.textureType == UniformType::Texture1D) {
+		for (int iMip = mostDetailedMip; iMip < m_desc.texture1D.numMips; ++iMip) {
+			numBytes += computeSliceSizeBytes(m_desc.format, maxOf(m_desc.texture1D.width >> iMip, 1), 1);
+		}
+		numBytes *= size_t(m_desc.texture1D.arraySize);
+	} else if (m_desc.textureType == UniformType::Texture2D) {
+		for (int iMip = mostDetailedMip; iMip < m_desc.texture2D.numMips; ++iMip) {
+			numBytes += computeSliceSizeBytes(m_desc.format, maxOf(m_desc.texture2D.width >> iMip, 1),
+			                                  maxOf(m_desc.texture2D.height >> iMip, 1));
+		}
+		numBytes *= size_t(m_desc.texture2D.arraySize) * size_t(maxOf(m_desc.texture2D.numSamples, 1));
+	} else if (m_desc.textureType == UniformType::TextureCube) {
+		for (int iMip = mostDetailedMip; iMip < m_desc.textureCube.numMips; ++iMip) {
+			numBytes += computeSliceSizeBytes(m_desc.format, maxOf(m_desc.textureCube.width >> iMip, 1),
+			                                  maxOf(m_desc.textureCube.height >> iMip, 1));
+		}
+		numBytes *= size_t(m_desc.textureCube.arraySize) * 6;
+	} else if (m_desc.textureType == UniformType::Texture3D) {
+		for (int iMip = mostDetailedMip; iMip < m_desc.texture3D.numMips; ++iMip) {
+			numBytes += computeSliceSizeBytes(m_desc.format, maxOf(m_desc.texture3D.width >> iMip, 1),
+			                                  maxOf(m_desc.texture3D.height >> iMip, 1)) *
+			            size_t(maxOf(m_desc.texture3D.depth >> iMip, 1));
+		}
+	}
+
+	return numBytes;
+}
+
+} // namespace sge
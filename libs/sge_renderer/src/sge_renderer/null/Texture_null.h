@@ -0,0 +1,47 @@
+#pragma once
+
+#include "sge_renderer/renderer/renderer.h"
+
+namespace sge {
+
+//----------------------------------------------------------
+// TextureNull
+// Only the description of the texture is kept, the texels aren't stored
+// as nothing in the API could read them back.
+//----------------------------------------------------------
+struct TextureNull : public Texture {
+	TextureNull() = default;
+	~TextureNull() { destroy(); }
+
+	// Initial data should be ordered in that way (same as the other backends):
+	// arrayElem0(mip0, mip1, mip2, ...)
+	// arrayElem1(mip0, mip1, mip2, ...)
+	bool create(const TextureDesc& desc, const TextureData initalData[], const SamplerDesc sampler = SamplerDesc()) final;
+
+	virtual void destroy() final;
+	virtual bool isValid() const final { return m_isValid; }
+
+	const TextureDesc& getDesc() const final { return m_desc; }
+	SamplerState* getSamplerState() final { return m_samplerState; }
+	void setSamplerState(SamplerState* ss) final { m_samplerState = ss; }
+
+	bool isMipStreamingSupported() const final { return true; }
+	bool setResidentMips(const int mostDetailedMip, const TextureData mipsData[]) final;
+	int getMostDetailedResidentMip() const final { return m_mostDetailedResidentMip; }
+
+	/// The number of bytes the resident mips of the texture would occupy in the GPU memory.
+	size_t getNumBytesResident() const { return m_numBytesResident; }
+
+  private:
+	/// Computes the size of the mips starting from @mostDetailedMip, for all array elements and faces.
+	size_t computeNumBytes(const int mostDetailedMip) const;
+
+	TextureDesc m_desc;
+	GpuHandle<SamplerState> m_samplerState;
+	bool m_isValid = false;
+
+	int m_mostDetailedResidentMip = 0;
+	size_t m_numBytesResident = 0;
+};
+
+} // namespace sge
@@ -187,12 +187,23 @@ struct DrawCall {
 };
 
 //----------------------------------------------------------------------------
-// There are currently used only for SGERecordingContext.
-// [TODO] Consider making them the offical way of doing anything?
+// The commands recorded by SGERecordingContext.
+// Each one starts with a RecordedCmd header and lives in the linear allocator of the recording context,
+// so every pointer in them points to memory owned by the recording context or to a GPU resource.
 //----------------------------------------------------------------------------
+struct RecordedCmd {
+	RecordedCmd(const APICommand type)
+	    : type(type) {}
+
+	APICommand type;
+	RecordedCmd* next = nullptr;
+};
+
+/// The data written to a buffer mapped with Map::WriteDiscard.
 struct BufferMapCmd {
 	Buffer* buffer = nullptr;
 	char* data = nullptr; // There is no guarantee who owns the data.
+	size_t sizeBytes = 0;
 };
 
 struct ClearColorCmd {
@@ -212,4 +223,70 @@ struct ClearDepthStencilCmd {
 	float m_depth = 1.f;
 };
 
+/// Changes the state group used by the following draw calls.
+struct SetStateGroupCmd : RecordedCmd {
+	SetStateGroupCmd()
+	    : RecordedCmd(APICommand_SetStateGroupCmd) {}
+	StateGroup stateGroup;
+};
+
+/// Changes the uniforms used by the following draw calls. The numeric uniform values are copied.
+struct SetUniformsCmd : RecordedCmd {
+	SetUniformsCmd()
+	    : RecordedCmd(APICommand_SetUniformsCmd) {}
+	BoundUniform* uniforms = nullptr;
+	int numUniforms = 0;
+};
+
+/// Draws with the last set state group and uniforms.
+struct DrawCmd : RecordedCmd {
+	DrawCmd()
+	    : RecordedCmd(APICommand_DrawCall) {}
+	DrawExecDesc drawExec;
+	FrameTarget* frameTarget = nullptr;
+	Rect2s viewport;
+	Rect2s scissorsRect;
+	bool hasViewport = false;
+	bool hasScissorsRect = false;
+};
+
+struct MapDiscardCmd : RecordedCmd {
+	MapDiscardCmd()
+	    : RecordedCmd(APICommand_MapDiscardCmd) {}
+	BufferMapCmd map;
+};
+
+struct ClearColorRecordedCmd : RecordedCmd {
+	ClearColorRecordedCmd()
+	    : RecordedCmd(APICommand_ClearColorCmd) {}
+	ClearColorCmd clear;
+};
+
+struct ClearDepthStencilRecordedCmd : RecordedCmd {
+	ClearDepthStencilRecordedCmd()
+	    : RecordedCmd(APICommand_ClearDepthStencilCmd) {}
+	ClearDepthStencilCmd clear;
+};
+
+struct CopyDepthCmd : RecordedCmd {
+	CopyDepthCmd()
+	    : RecordedCmd(APICommand_CopyDepthCmd) {}
+	FrameTarget* dest = nullptr;
+	FrameTarget* src = nullptr;
+};
+
+/// The texture data is copied.
+struct UpdateTextureCmd : RecordedCmd {
+	UpdateTextureCmd()
+	    : RecordedCmd(APICommand_UpdateTextureCmd) {}
+	Texture* texture = nullptr;
+	TextureData textureData;
+};
+
+struct QueryCmd : RecordedCmd {
+	QueryCmd(const APICommand type)
+	    : RecordedCmd(type) {}
+	Query* query = nullptr;
+};
+
 } // namespace sge
@@ -211,6 +211,12 @@ int UniformType::GetSizeBytes(const UniformType::Enum uniformType) {
 
 		case Int_RGBA_Unorm_IA:
 			return 4;
+		case Short2_Snorm_IA:
+			return 4;
+		case Ushort2_Unorm_IA:
+			return 4;
+		case Ushort4_Unorm_IA:
+			return 8;
 	};
 
 	sgeAssert(false);
@@ -14,11 +14,18 @@ namespace sge {
 
 #define SGE_GPRAHICS_COMMON_ENUM_HIDE virtual void operator()() = 0;
 
+/// The types of the commands recorded by SGERecordingContext, see APICommands.h.
 enum APICommand {
 	APICommand_DrawCall,
 	APICommand_MapDiscardCmd,
 	APICommand_ClearColorCmd,
 	APICommand_ClearDepthStencilCmd,
+	APICommand_SetStateGroupCmd,
+	APICommand_SetUniformsCmd,
+	APICommand_CopyDepthCmd,
+	APICommand_UpdateTextureCmd,
+	APICommand_BeginQueryCmd,
+	APICommand_EndQueryCmd,
 
 	APICommand_Num,
 };
@@ -37,7 +44,7 @@ namespace GraphicsCaps {
 		kD3D11_SRV_Count = 8,  //[TODO]
 		kSampleSlotsCount = 8, //[TODO]
 
-#elif SGE_RENDERER_GL
+#elif SGE_RENDERER_GL || SGE_RENDERER_NULL
 
 		// TODO: Real values.
 		// https://www.opengl.org/sdk/docs/man2/xhtml/glVertexAttribPointer.xml
@@ -63,7 +70,8 @@ struct ShadingLanguage {
 
 #if SGE_RENDERER_D3D11
 		ApiNative = HLSL,
-#elif SGE_RENDERER_GL
+#elif SGE_RENDERER_GL || SGE_RENDERER_NULL
+		// The null backend consumes GLSL, so it goes through the same translation as OpenGL.
 		ApiNative = GLSL,
 #else
 	// Not implemented.
@@ -338,6 +346,18 @@ struct UniformType {
 		// Caution: Usable only by the input assambler.
 		// An int that gets expanded to 4 floats when used as an vertex attribute.
 		Int_RGBA_Unorm_IA,
+
+		// Caution: Usable only by the input assambler.
+		// Two signed 16bit integers that get expanded to a float2 in [-1;1] when used as a vertex attribute.
+		Short2_Snorm_IA,
+
+		// Caution: Usable only by the input assambler.
+		// Two unsigned 16bit integers that get expanded to a float2 in [0;1] when used as a vertex attribute.
+		Ushort2_Unorm_IA,
+
+		// Caution: Usable only by the input assambler.
+		// Four unsigned 16bit integers that get expanded to a float4 in [0;1] when used as a vertex attribute.
+		Ushort4_Unorm_IA,
 	};
 
 	static bool isNumeric(Enum const e) { return e > MARKER_NumericUniformsBegin && e < MARKER_NumericUniformsEnd; }
@@ -926,6 +946,27 @@ struct FrameStatistics {
 
 	int numDrawCalls = 0;
 	size_t numPrimitiveDrawn = 0;
+
+	/// The number of draw calls that had to change the bound shading program.
+	int numProgramChanges = 0;
+	/// The number of vertex, index and constant buffer bindings changed by the draw calls.
+	int numBufferChanges = 0;
+	/// The number of texture bindings changed by the draw calls.
+	int numTextureChanges = 0;
+	/// The number of numeric uniforms that got a new value by the draw calls.
+	int numUniformChanges = 0;
+
+	/// The number of items drawn through render queues (see RenderQueue in sge_core).
+	int numRenderQueueItems = 0;
+	/// The number of state changes (program, material or mesh) the render queue items would cause if drawn in the order they were added.
+	int numStateChangesUnsorted = 0;
+	/// The number of state changes of the render queue items after sorting them.
+	int numStateChangesSorted = 0;
+	/// The number of instanced draw calls issued for the render queue items.
+	int numInstancedDrawCalls = 0;
+	/// The number of render queue items drawn by the instanced draw calls, without instancing each would be a separate draw call.
+	int numInstancedGeometries = 0;
+
 	float lastPresentTime = 0;
 	float lastPresentDt = 0;
 };
@@ -0,0 +1,279 @@
+#include "RecordingContext.h"
+#include <cstring>
+
+namespace sge {
+
+namespace {
+	/// Returns the number of bytes pointed by BoundUniform::data for a numeric uniform.
+	size_t getNumericUniformSizeBytes(const BindLocation& bindLocation) {
+#ifdef SGE_RENDERER_D3D11
+		return size_t(bindLocation.texArraySize_or_numericUniformSizeBytes);
+#else
+		const int arraySize = maxOf(int(bindLocation.glArraySize), 1);
+		return size_t(UniformType::GetSizeBytes(UniformType::Enum(bindLocation.uniformType))) * size_t(arraySize);
+#endif
+	}
+
+	/// Returns the number of elements pointed by BoundUniform::textures or BoundUniform::samplers,
+	/// 0 if the uniform points directly to a single resource.
+	int getResourceArraySize(const BindLocation& bindLocation) {
+		const UniformType::Enum uniformType = UniformType::Enum(bindLocation.uniformType);
+#ifdef SGE_RENDERER_D3D11
+		if (uniformType == UniformType::SamplerState) {
+			return bindLocation.texArraySize_or_numericUniformSizeBytes;
+		}
+		return bindLocation.texArraySize_or_numericUniformSizeBytes == 1 ? 0 : bindLocation.texArraySize_or_numericUniformSizeBytes;
+#else
+		if (uniformType == UniformType::SamplerState) {
+			// Embedded in the textures, the backend doesn't read them.
+			return 0;
+		}
+		return bindLocation.glArraySize == 1 ? 0 : bindLocation.glArraySize;
+#endif
+	}
+} // namespace
+
+template <typename T, typename... TArgs>
+T* SGERecordingContext::addCommand(TArgs&&... args) {
+	T* const cmd = m_allocator.make<T>(std::forward<TArgs>(args)...);
+
+	if (m_lastCommand) {
+		m_lastCommand->next = cmd;
+	} else {
+		m_firstCommand = cmd;
+	}
+
+	m_lastCommand = cmd;
+	m_numCommands++;
+	return cmd;
+}
+
+BoundUniform* SGERecordingContext::copyUniforms(const BoundUniform* const uniforms, const int numUniforms) {
+	if (numUniforms == 0) {
+		return nullptr;
+	}
+
+	BoundUniform* const result =
+	    static_cast<BoundUniform*>(m_allocator.allocateCopy(uniforms, sizeof(BoundUniform) * numUniforms, alignof(BoundUniform)));
+
+	for (int iUniform = 0; iUniform < numUniforms; ++iUniform) {
+		BoundUniform& uniform = result[iUniform];
+		const UniformType::Enum uniformType = UniformType::Enum(uniform.bindLocation.uniformType);
+
+		if (UniformType::isNumeric(uniformType)) {
+			uniform.data = m_allocator.allocateCopy(uniform.data, getNumericUniformSizeBytes(uniform.bindLocation));
+		} else if (uniformType == UniformType::Texture1D || uniformType == UniformType::Texture2D ||
+		           uniformType == UniformType::TextureCube || uniformType == UniformType::Texture3D ||
+		           uniformType == UniformType::SamplerState) {
+			// The arrays of resources are pointers to the memory of the caller, the single resources are stored in place.
+			const int arraySize = getResourceArraySize(uniform.bindLocation);
+			if (arraySize > 0) {
+				uniform.data = m_allocator.allocateCopy(uniform.data, sizeof(void*) * size_t(arraySize), alignof(void*));
+			}
+		}
+	}
+
+	return result;
+}
+
+void SGERecordingContext::executeDrawCall(DrawCall& drawCall,
+                                          FrameTarget* frameTarget,
+                                          const Rect2s* const pViewport,
+                                          const Rect2s* const pScissorsRect) {
+	sgeAssert(drawCall.m_pStateGroup != nullptr);
+
+	// Consecutive draw calls usually share the state group, record it only when it changes.
+	const bool isSameStateGroup =
+	    m_lastStateGroup != nullptr && memcmp(m_lastStateGroup, drawCall.m_pStateGroup, sizeof(StateGroup)) == 0;
+	if (isSameStateGroup == false) {
+		SetStateGroupCmd* const cmd = addCommand<SetStateGroupCmd>();
+		cmd->stateGroup = *drawCall.m_pStateGroup;
+		m_lastStateGroup = &cmd->stateGroup;
+	}
+
+	SetUniformsCmd* const uniformsCmd = addCommand<SetUniformsCmd>();
+	uniformsCmd->uniforms = copyUniforms(drawCall.uniforms, drawCall.numUniforms);
+	uniformsCmd->numUniforms = drawCall.numUniforms;
+
+	DrawCmd* const drawCmd = addCommand<DrawCmd>();
+	drawCmd->drawExec = drawCall.m_drawExec;
+	drawCmd->frameTarget = frameTarget;
+	if (pViewport) {
+		drawCmd->viewport = *pViewport;
+		drawCmd->hasViewport = true;
+	}
+	if (pScissorsRect) {
+		drawCmd->scissorsRect = *pScissorsRect;
+		drawCmd->hasScissorsRect = true;
+	}
+
+	m_numDrawCalls++;
+}
+
+void* SGERecordingContext::map(Buffer* buffer, const Map::Enum map) {
+	if (buffer == nullptr || map != Map::WriteDiscard) {
+		sgeAssert(false && "Only Map::WriteDiscard is supported on recording contexts");
+		return nullptr;
+	}
+
+	PendingMap pendingMap;
+	pendingMap.buffer = buffer;
+	pendingMap.data = static_cast<char*>(m_allocator.allocate(buffer->getDesc().sizeBytes));
+	m_pendingMaps.push_back(pendingMap);
+
+	return pendingMap.data;
+}
+
+void SGERecordingContext::unMap(Buffer* buffer) {
+	for (int t = 0; t < int(m_pendingMaps.size()); ++t) {
+		if (m_pendingMaps[t].buffer == buffer) {
+			// The data gets written to the buffer at the point of unmapping.
+			MapDiscardCmd* const cmd = addCommand<MapDiscardCmd>();
+			cmd->map.buffer = buffer;
+			cmd->map.data = m_pendingMaps[t].data;
+			cmd->map.sizeBytes = buffer->getDesc().sizeBytes;
+
+			m_pendingMaps.erase(m_pendingMaps.begin() + t);
+			return;
+		}
+	}
+
+	sgeAssert(false && "Unmapping a buffer that isn't mapped");
+}
+
+void SGERecordingContext::updateTextureData(Texture* texture, const TextureData& td) {
+	if (texture == nullptr || td.data == nullptr) {
+		return;
+	}
+
+	const TextureDesc& desc = texture->getDesc();
+	if (desc.textureType != UniformType::Texture2D) {
+		sgeAssert(false && "Only 2D textures could be updated on recording contexts");
+		return;
+	}
+
+	size_t rowByteSize = td.rowByteSize;
+	if (rowByteSize == 0) {
+		rowByteSize = TextureFormat::GetSizeBytes(desc.format) * size_t(desc.texture2D.width);
+	}
+
+	const size_t dataSizeBytes = rowByteSize * size_t(desc.texture2D.height);
+
+	UpdateTextureCmd* const cmd = addCommand<UpdateTextureCmd>();
+	cmd->texture = texture;
+	cmd->textureData = TextureData(m_allocator.allocateCopy(td.data, dataSizeBytes), rowByteSize, td.sliceByteSize);
+}
+
+void SGERecordingContext::clearColor(FrameTarget* target, int index, const float rgba[4]) {
+	ClearColorRecordedCmd* const cmd = addCommand<ClearColorRecordedCmd>();
+	cmd->clear = ClearColorCmd(target, index, rgba);
+}
+
+void SGERecordingContext::clearDepth(FrameTarget* target, float depth) {
+	ClearDepthStencilRecordedCmd* const cmd = addCommand<ClearDepthStencilRecordedCmd>();
+	cmd->clear = ClearDepthStencilCmd(target, depth);
+}
+
+void SGERecordingContext::copyDepth(FrameTarget* dest, FrameTarget* src) {
+	CopyDepthCmd* const cmd = addCommand<CopyDepthCmd>();
+	cmd->dest = dest;
+	cmd->src = src;
+}
+
+void SGERecordingContext::beginQuery(Query* const query) {
+	addCommand<QueryCmd>(APICommand_BeginQueryCmd)->query = query;
+}
+
+void SGERecordingContext::endQuery(Query* const query) {
+	addCommand<QueryCmd>(APICommand_EndQueryCmd)->query = query;
+}
+
+bool SGERecordingContext::isQueryReady(Query* const UNUSED(query)) {
+	sgeAssert(false && "Queries could be read only from the immediate context");
+	return false;
+}
+
+bool SGERecordingContext::getQueryData(Query* const UNUSED(query), uint64& UNUSED(queryData)) {
+	sgeAssert(false && "Queries could be read only from the immediate context");
+	return false;
+}
+
+void SGERecordingContext::execute(SGEContext* const context) const {
+	sgeAssert(m_pendingMaps.empty() && "All mapped buffers must be unmapped before executing");
+
+	// The state of the draw calls, changed by the commands.
+	StateGroup* stateGroup = nullptr;
+	BoundUniform* uniforms = nullptr;
+	int numUniforms = 0;
+
+	for (RecordedCmd* cmd = m_firstCommand; cmd != nullptr; cmd = cmd->next) {
+		switch (cmd->type) {
+			case APICommand_SetStateGroupCmd: {
+				stateGroup = &static_cast<SetStateGroupCmd*>(cmd)->stateGroup;
+			} break;
+			case APICommand_SetUniformsCmd: {
+				const SetUniformsCmd* const uniformsCmd = static_cast<SetUniformsCmd*>(cmd);
+				uniforms = uniformsCmd->uniforms;
+				numUniforms = uniformsCmd->numUniforms;
+			} break;
+			case APICommand_DrawCall: {
+				const DrawCmd* const drawCmd = static_cast<DrawCmd*>(cmd);
+
+				DrawCall drawCall;
+				drawCall.m_drawExec = drawCmd->drawExec;
+				drawCall.setStateGroup(stateGroup);
+				drawCall.setUniforms(uniforms, numUniforms);
+
+				context->executeDrawCall(drawCall, drawCmd->frameTarget, drawCmd->hasViewport ? &drawCmd->viewport : nullptr,
+				                         drawCmd->hasScissorsRect ? &drawCmd->scissorsRect : nullptr);
+			} break;
+			case APICommand_MapDiscardCmd: {
+				const BufferMapCmd& mapCmd = static_cast<MapDiscardCmd*>(cmd)->map;
+				void* const mappedData = context->map(mapCmd.buffer, Map::WriteDiscard);
+				if (mappedData) {
+					memcpy(mappedData, mapCmd.data, mapCmd.sizeBytes);
+					context->unMap(mapCmd.buffer);
+				}
+			} break;
+			case APICommand_ClearColorCmd: {
+				const ClearColorCmd& clearCmd = static_cast<ClearColorRecordedCmd*>(cmd)->clear;
+				context->clearColor(clearCmd.m_frameTarget, clearCmd.m_index, clearCmd.m_rgba);
+			} break;
+			case APICommand_ClearDepthStencilCmd: {
+				const ClearDepthStencilCmd& clearCmd = static_cast<ClearDepthStencilRecordedCmd*>(cmd)->clear;
+				context->clearDepth(clearCmd.m_frameTarget, clearCmd.m_depth);
+			} break;
+			case APICommand_CopyDepthCmd: {
+				const CopyDepthCmd* const copyCmd = static_cast<CopyDepthCmd*>(cmd);
+				context->copyDepth(copyCmd->dest, copyCmd->src);
+			} break;
+			case APICommand_UpdateTextureCmd: {
+				const UpdateTextureCmd* const updateCmd = static_cast<UpdateTextureCmd*>(cmd);
+				context->updateTextureData(updateCmd->texture, updateCmd->textureData);
+			} break;
+			case APICommand_BeginQueryCmd: {
+				context->beginQuery(static_cast<QueryCmd*>(cmd)->query);
+			} break;
+			case APICommand_EndQueryCmd: {
+				context->endQuery(static_cast<QueryCmd*>(cmd)->query);
+			} break;
+			default: {
+				sgeAssert(false && "Unknown recorded command");
+			} break;
+		}
+	}
+}
+
+void SGERecordingContext::reset() {
+	sgeAssert(m_pendingMaps.empty() && "All mapped buffers must be unmapped before resetting");
+
+	m_allocator.reset();
+	m_firstCommand = nullptr;
+	m_lastCommand = nullptr;
+	m_lastStateGroup = nullptr;
+	m_pendingMaps.clear();
+	m_numCommands = 0;
+	m_numDrawCalls = 0;
+}
+
+} // namespace sge
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "renderer.h"
+#include "sge_utils/utils/LinearAllocator.h"
+
+namespace sge {
+
+//---------------------------------------------------------------------
+// SGERecordingContext
+//---------------------------------------------------------------------
+
+/// @brief A context that records the commands instead of executing them, later they get executed in order by
+/// another context (usually the immediate one) with @execute.
+/// The commands are compact structs (see APICommands.h) allocated in a linear allocator owned by the context.
+/// Everything the commands need (state groups, uniform values, mapped buffer data) gets copied, so the caller could
+/// reuse its memory right after each call.
+///
+/// Recording doesn't touch the graphics API, so each thread could record with its own context in parallel.
+/// The GPU resources used by the commands must stay alive until the commands get executed.
+///
+/// Limitations:
+///   - Buffers could only be mapped with Map::WriteDiscard;
+///   - The results of the queries could only be read from the immediate context;
+///   - Only 2D textures could be updated.
+struct SGERecordingContext : public SGEContext {
+	explicit SGERecordingContext(SGEDevice* const device)
+	    : m_device(device) {}
+
+	SGEDevice* getDevice() final { return m_device; }
+
+	void executeDrawCall(DrawCall& drawCall,
+	                     FrameTarget* frameTarget,
+	                     const Rect2s* const pViewport = nullptr,
+	                     const Rect2s* const pScissorsRect = nullptr) final;
+
+	/// Only Map::WriteDiscard is supported, the returned memory is owned by the recording context.
+	void* map(Buffer* buffer, const Map::Enum map) final;
+	void unMap(Buffer* buffer) final;
+
+	void updateTextureData(Texture* texture, const TextureData& td) final;
+
+	void clearColor(FrameTarget* target, int index, const float rgba[4]) final;
+	void clearDepth(FrameTarget* target, float depth) final;
+	void copyDepth(FrameTarget* dest, FrameTarget* src) final;
+
+	void beginQuery(Query* const query) final;
+	void endQuery(Query* const query) final;
+	/// Not supported, use the immediate context.
+	bool isQueryReady(Query* const query) final;
+	/// Not supported, use the immediate context.
+	bool getQueryData(Query* const query, uint64& queryData) final;
+
+	/// Executes all recorded commands in the order of recording on the specified context.
+	/// The commands are kept, call @reset to record new ones.
+	void execute(SGEContext* const context) const;
+
+	/// Drops all recorded commands, keeps the allocated memory for the next recording.
+	void reset();
+
+	int getNumCommands() const { return m_numCommands; }
+	int getNumDrawCalls() const { return m_numDrawCalls; }
+	const LinearAllocator& getAllocator() const { return m_allocator; }
+
+  private:
+	template <typename T, typename... TArgs>
+	T* addCommand(TArgs&&... args);
+
+	/// Copies the values of the numeric uniforms and the arrays of textures and samplers.
+	BoundUniform* copyUniforms(const BoundUniform* const uniforms, const int numUniforms);
+
+  private:
+	struct PendingMap {
+		Buffer* buffer = nullptr;
+		char* data = nullptr;
+	};
+
+	SGEDevice* m_device = nullptr;
+	LinearAllocator m_allocator;
+
+	RecordedCmd* m_firstCommand = nullptr;
+	RecordedCmd* m_lastCommand = nullptr;
+	/// The last recorded state group, used to skip recording it again when the next draw call uses the same one.
+	const StateGroup* m_lastStateGroup = nullptr;
+	std::vector<PendingMap> m_pendingMaps;
+
+	int m_numCommands = 0;
+	int m_numDrawCalls = 0;
+};
+
+} // namespace sge
@@ -22,7 +22,7 @@ struct BindLocation {
 
 	bool isNull() const { return raw == 0; }
 
-#ifdef SGE_RENDERER_GL
+#if defined(SGE_RENDERER_GL) || defined(SGE_RENDERER_NULL)
 	BindLocation(short const bindLocation, short const uniformType, short const arraySize, short bindUnitTexture) {
 		raw = 0;
 		this->bindLocation = bindLocation;
@@ -101,7 +101,7 @@ struct NumericUniformRefl {
 	ShaderType::Enum d3d11_shaderType = ShaderType::VertexShader;
 	int byteOffset_d3d11 = 0;
 	int sizeBytes_d3d11 = 0;
-#elif defined(SGE_RENDERER_GL)
+#elif defined(SGE_RENDERER_GL) || defined(SGE_RENDERER_NULL)
 	int bindLocation = 0;
 #endif
 };
@@ -127,7 +127,7 @@ struct CBufferRefl {
 #ifdef SGE_RENDERER_D3D11
 	ShaderType::Enum d3d11_shaderType = ShaderType::VertexShader;
 	int d3d11_bindingSlot;
-#elif defined(SGE_RENDERER_GL)
+#elif defined(SGE_RENDERER_GL) || defined(SGE_RENDERER_NULL)
 	int gl_bindLocation;
 #endif
 
@@ -148,7 +148,7 @@ struct TextureRefl {
 #ifdef SGE_RENDERER_D3D11
 	ShaderType::Enum d3d11_shaderType = ShaderType::VertexShader;
 	int d3d11_bindingSlot = -1;
-#elif defined(SGE_RENDERER_GL)
+#elif defined(SGE_RENDERER_GL) || defined(SGE_RENDERER_NULL)
 	int gl_bindLocation = -1;
 	int gl_bindUnit = 0;               // should be used this way: "GL_TEXTURE0 + gl_bindUnit"
 	unsigned int gl_textureTarget = 0; // Reqired target of the texture, see GLUniformTypeToTextureType for more details.
@@ -172,7 +172,7 @@ struct SamplerRefl {
 #ifdef SGE_RENDERER_D3D11
 	ShaderType::Enum d3d11_shaderType = ShaderType::VertexShader;
 	int d3d11_bindingSlot = -1;
-#elif defined(SGE_RENDERER_GL)
+#elif defined(SGE_RENDERER_GL) || defined(SGE_RENDERER_NULL)
 	int gl_bindLocation = 0;
 #endif
 };
@@ -184,7 +184,7 @@ struct VertShaderAttrib {
 	unsigned nameStrIdx = 0;
 	std::string name; // Semantic+index for D3D11, attribute name for OpenGL.
 	UniformType::Enum type = UniformType::Unknown;
-#ifdef SGE_RENDERER_GL
+#if defined(SGE_RENDERER_GL) || defined(SGE_RENDERER_NULL)
 	int attributeLocation = 0; // The binding location of the attribute.
 #endif
 };
@@ -213,7 +213,7 @@ struct UniformContainer {
 			if (itr.second.d3d11_shaderType == shaderType && itr.second.name == name) {
 				return itr.first;
 			}
-#elif defined(SGE_RENDERER_GL)
+#elif defined(SGE_RENDERER_GL) || defined(SGE_RENDERER_NULL)
 			if (itr.second.name == name) {
 				return itr.first;
 			}
@@ -29,7 +29,7 @@ constexpr bool kIsTexcoordStyleD3D = true;
 constexpr float kNDCNear = 0.f;
 #endif
 
-#ifdef SGE_RENDERER_GL
+#if defined(SGE_RENDERER_GL) || defined(SGE_RENDERER_NULL)
 constexpr bool kIsTexcoordStyleD3D = false;
 constexpr float kNDCNear = -1.f;
 #endif
@@ -153,6 +153,22 @@ struct Texture : public RAIResource {
 	virtual SamplerState* getSamplerState() = 0;
 	virtual void setSamplerState(SamplerState* ss) = 0;
 
+	/// @brief Mip streaming allows only the least detailed mips of a texture to be resident in memory.
+	/// Only 2D textures with a single array element could be streamed. If supported, @create accepts
+	/// initial data with nullptr data for the most detailed mips, these mips are created as not resident.
+	virtual bool isMipStreamingSupported() const { return false; }
+
+	/// @brief Changes the resident mips of a streamed texture, after the call mips [mostDetailedMip; numMips) are resident.
+	/// Evicted mips are no longer sampled. Some backends (OpenGL) keep their memory until the texture gets destroyed,
+	/// in exchange evicting and streaming them in again doesn't allocate or upload anything.
+	/// @param [in] mipsData the data of all mips of the texture, only the data for the mips getting streamed in is used.
+	///             Could be nullptr when evicting.
+	/// @return false if the texture doesn't support mip streaming.
+	virtual bool setResidentMips(const int UNUSED(mostDetailedMip), const TextureData UNUSED(mipsData)[]) { return false; }
+
+	/// @brief Returns the most detailed mip that is resident. Always 0 for textures that aren't streamed.
+	virtual int getMostDetailedResidentMip() const { return 0; }
+
 	bool is2DWithSize(const int width, const int height) const {
 		return getDesc().textureType == UniformType::Texture2D && getDesc().texture2D.width == width &&
 		       getDesc().texture2D.height == height;
@@ -264,6 +280,7 @@ struct SGEDevice {
 	};
 
 	static SGEDevice* create(const MainFrameTargetDesc& frameTargetDesc);
+	virtual ~SGEDevice() = default;
 
 	// Returns statically determinated capabilites of the currently selected redering API.
 	static const StaticCaps& staticCaps();
@@ -293,6 +310,8 @@ struct SGEDevice {
 	virtual BlendState* requestBlendState(const BlendStateDesc& desc) = 0;
 
 	virtual const FrameStatistics& getFrameStatistics() const = 0;
+	/// Used by the higher level systems to add their statistics for the current frame.
+	virtual FrameStatistics& getFrameStatistics() = 0;
 
 	// Vertex declaration caching used to speed up draw calls processing.
 	virtual VertexDeclIndex getVertexDeclIndex(const VertexDecl* const declElems, const int declElemsCount) = 0;
@@ -324,6 +343,8 @@ struct SGEContext {
 	// Frame targets.
 	virtual void clearColor(FrameTarget* target, int index, const float rgba[4]) = 0;
 	virtual void clearDepth(FrameTarget* target, float depth) = 0;
+	/// Copies the whole depth stencil of @src to the depth stencil of @dest, both need the same size and format.
+	virtual void copyDepth(FrameTarget* dest, FrameTarget* src) = 0;
 
 	// Queries.
 	virtual void beginQuery(Query* const query) = 0;
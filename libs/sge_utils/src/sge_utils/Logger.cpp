@@ -32,7 +32,7 @@ void Logger::write(const char* format, ...) {
 	string_format(buffer, format, args);
 	va_end(args);
 
-	printf(buffer.data());
+	printf("%s", buffer.c_str());
 }
 
 void Logger::writeError(const char* format, ...) {
@@ -42,7 +42,7 @@ void Logger::writeError(const char* format, ...) {
 	string_format(buffer, format, args);
 	va_end(args);
 
-	printf(buffer.data());
+	printf("%s", buffer.c_str());
 }
 
 void Logger::writeWarning(const char* format, ...) {
@@ -52,7 +52,7 @@ void Logger::writeWarning(const char* format, ...) {
 	string_format(buffer, format, args);
 	va_end(args);
 
-	printf(buffer.data());
+	printf("%s", buffer.c_str());
 }
 
 } // namespace sge
@@ -0,0 +1,446 @@
+#include <algorithm>
+#include <cmath>
+
+#include "DynamicAABBTree.h"
+
+namespace sge {
+
+namespace {
+	AABox3f combineBoxes(const AABox3f& a, const AABox3f& b) {
+		AABox3f result = a;
+		result.expand(b);
+		return result;
+	}
+
+	/// Half of the surface area of the box, used as a cost of the nodes when inserting leaves.
+	float getBoxCost(const AABox3f& box) {
+		const vec3f size = box.size();
+		return size.x * size.y + size.y * size.z + size.z * size.x;
+	}
+
+	bool containsBox(const AABox3f& outer, const AABox3f& inner) {
+		return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z && outer.max.x >= inner.max.x &&
+		       outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+	}
+} // namespace
+
+int DynamicAABBTree::allocateNode() {
+	if (m_freeList == kNullNode) {
+		m_nodes.emplace_back();
+		return int(m_nodes.size()) - 1;
+	}
+
+	const int iNode = m_freeList;
+	m_freeList = m_nodes[iNode].parent;
+	m_nodes[iNode] = Node();
+	return iNode;
+}
+
+void DynamicAABBTree::freeNode(const int iNode) {
+	m_nodes[iNode] = Node();
+	m_nodes[iNode].parent = m_freeList;
+	m_freeList = iNode;
+}
+
+int DynamicAABBTree::createProxy(const AABox3f& box, const int userData) {
+	const int proxyId = allocateNode();
+
+	Node& node = m_nodes[proxyId];
+	node.box = box;
+	node.box.min -= vec3f(m_fatMargin);
+	node.box.max += vec3f(m_fatMargin);
+	node.userData = userData;
+	node.height = 0;
+
+	insertLeaf(proxyId);
+	m_numProxies++;
+
+	return proxyId;
+}
+
+void DynamicAABBTree::destroyProxy(const int proxyId) {
+	sgeAssert(proxyId >= 0 && proxyId < int(m_nodes.size()) && m_nodes[proxyId].height == 0);
+
+	removeLeaf(proxyId);
+	freeNode(proxyId);
+	m_numProxies--;
+}
+
+bool DynamicAABBTree::moveProxy(const int proxyId, const AABox3f& box) {
+	sgeAssert(proxyId >= 0 && proxyId < int(m_nodes.size()) && m_nodes[proxyId].height == 0);
+
+	if (containsBox(m_nodes[proxyId].box, box)) {
+		return false;
+	}
+
+	removeLeaf(proxyId);
+
+	m_nodes[proxyId].box = box;
+	m_nodes[proxyId].box.min -= vec3f(m_fatMargin);
+	m_nodes[proxyId].box.max += vec3f(m_fatMargin);
+
+	insertLeaf(proxyId);
+	return true;
+}
+
+int DynamicAABBTree::getUserData(const int proxyId) const {
+	sgeAssert(proxyId >= 0 && proxyId < int(m_nodes.size()) && m_nodes[proxyId].height == 0);
+	return m_nodes[proxyId].userData;
+}
+
+const AABox3f& DynamicAABBTree::getFatBox(const int proxyId) const {
+	sgeAssert(proxyId >= 0 && proxyId < int(m_nodes.size()) && m_nodes[proxyId].height == 0);
+	return m_nodes[proxyId].box;
+}
+
+void DynamicAABBTree::clear() {
+	m_nodes.clear();
+	m_root = kNullNode;
+	m_freeList = kNullNode;
+	m_numProxies = 0;
+}
+
+int DynamicAABBTree::getHeight() const {
+	return m_root != kNullNode ? m_nodes[m_root].height : -1;
+}
+
+void DynamicAABBTree::insertLeaf(const int leaf) {
+	if (m_root == kNullNode) {
+		m_root = leaf;
+		m_nodes[leaf].parent = kNullNode;
+		return;
+	}
+
+	// Find the best sibling for the leaf, the one that increases the total cost of the tree the least.
+	const AABox3f leafBox = m_nodes[leaf].box;
+	int iNode = m_root;
+	while (m_nodes[iNode].isLeaf() == false) {
+		const Node& node = m_nodes[iNode];
+
+		const float cost = getBoxCost(node.box);
+		const float combinedCost = getBoxCost(combineBoxes(node.box, leafBox));
+
+		// The cost of creating a new parent for this node and the leaf.
+		const float costNewParent = 2.f * combinedCost;
+		// The minimum cost of pushing the leaf further down the tree.
+		const float inheritanceCost = 2.f * (combinedCost - cost);
+
+		const auto getDescendCost = [&](const int iChild) -> float {
+			const AABox3f childCombinedBox = combineBoxes(m_nodes[iChild].box, leafBox);
+			if (m_nodes[iChild].isLeaf()) {
+				return getBoxCost(childCombinedBox) + inheritanceCost;
+			}
+			return getBoxCost(childCombinedBox) - getBoxCost(m_nodes[iChild].box) + inheritanceCost;
+		};
+
+		const float cost0 = getDescendCost(node.child0);
+		const float cost1 = getDescendCost(node.child1);
+
+		if (costNewParent < cost0 && costNewParent < cost1) {
+			break;
+		}
+
+		iNode = cost0 < cost1 ? node.child0 : node.child1;
+	}
+
+	// Create a new parent for the sibling and the leaf.
+	const int sibling = iNode;
+	const int oldParent = m_nodes[sibling].parent;
+	const int newParent = allocateNode();
+	m_nodes[newParent].parent = oldParent;
+	m_nodes[newParent].box = combineBoxes(leafBox, m_nodes[sibling].box);
+	m_nodes[newParent].height = m_nodes[sibling].height + 1;
+	m_nodes[newParent].child0 = sibling;
+	m_nodes[newParent].child1 = leaf;
+	m_nodes[sibling].parent = newParent;
+	m_nodes[leaf].parent = newParent;
+
+	if (oldParent != kNullNode) {
+		if (m_nodes[oldParent].child0 == sibling) {
+			m_nodes[oldParent].child0 = newParent;
+		} else {
+			m_nodes[oldParent].child1 = newParent;
+		}
+	} else {
+		m_root = newParent;
+	}
+
+	// Walk back up the tree fixing the heights and the boxes.
+	iNode = m_nodes[leaf].parent;
+	while (iNode != kNullNode) {
+		iNode = balance(iNode);
+
+		const int child0 = m_nodes[iNode].child0;
+		const int child1 = m_nodes[iNode].child1;
+		m_nodes[iNode].height = 1 + std::max(m_nodes[child0].height, m_nodes[child1].height);
+		m_nodes[iNode].box = combineBoxes(m_nodes[child0].box, m_nodes[child1].box);
+
+		iNode = m_nodes[iNode].parent;
+	}
+}
+
+void DynamicAABBTree::removeLeaf(const int leaf) {
+	if (leaf == m_root) {
+		m_root = kNullNode;
+		return;
+	}
+
+	const int parent = m_nodes[leaf].parent;
+	const int grandParent = m_nodes[parent].parent;
+	const int sibling = m_nodes[parent].child0 == leaf ? m_nodes[parent].child1 : m_nodes[parent].child0;
+
+	if (grandParent == kNullNode) {
+		m_root = sibling;
+		m_nodes[sibling].parent = kNullNode;
+		freeNode(parent);
+		return;
+	}
+
+	// Replace the parent with the sibling.
+	if (m_nodes[grandParent].child0 == parent) {
+		m_nodes[grandParent].child0 = sibling;
+	} else {
+		m_nodes[grandParent].child1 = sibling;
+	}
+	m_nodes[sibling].parent = grandParent;
+	freeNode(parent);
+
+	// Fix the boxes and the heights of the ancestors.
+	int iNode = grandParent;
+	while (iNode != kNullNode) {
+		iNode = balance(iNode);
+
+		const int child0 = m_nodes[iNode].child0;
+		const int child1 = m_nodes[iNode].child1;
+		m_nodes[iNode].box = combineBoxes(m_nodes[child0].box, m_nodes[child1].box);
+		m_nodes[iNode].height = 1 + std::max(m_nodes[child0].height, m_nodes[child1].height);
+
+		iNode = m_nodes[iNode].parent;
+	}
+}
+
+int DynamicAABBTree::balance(const int iA) {
+	// Performs a left or a right rotation if the node A is imbalanced. Returns the new root of the subtree.
+	//       A
+	//     /   \
+	//    B     C
+	//         / \
+	//        F   G
+	Node& A = m_nodes[iA];
+	if (A.isLeaf() || A.height < 2) {
+		return iA;
+	}
+
+	const int iB = A.child0;
+	const int iC = A.child1;
+	Node& B = m_nodes[iB];
+	Node& C = m_nodes[iC];
+
+	const int heightDiff = C.height - B.height;
+
+	// Rotates the child X up, the child Y of X with the larger height stays under X and the other one goes under A.
+	const auto rotateUp = [&](const int iX, Node& X, Node& other, const bool isXChild1) -> int {
+		const int iF = X.child0;
+		const int iG = X.child1;
+		Node& F = m_nodes[iF];
+		Node& G = m_nodes[iG];
+
+		// Swap A and X.
+		X.child0 = iA;
+		X.parent = A.parent;
+		A.parent = iX;
+
+		// A's old parent should point to X.
+		if (X.parent != kNullNode) {
+			if (m_nodes[X.parent].child0 == iA) {
+				m_nodes[X.parent].child0 = iX;
+			} else {
+				m_nodes[X.parent].child1 = iX;
+			}
+		} else {
+			m_root = iX;
+		}
+
+		// Rotate.
+		const int iKept = F.height > G.height ? iF : iG;
+		const int iMoved = F.height > G.height ? iG : iF;
+		Node& kept = m_nodes[iKept];
+		Node& moved = m_nodes[iMoved];
+
+		X.child1 = iKept;
+		if (isXChild1) {
+			A.child1 = iMoved;
+		} else {
+			A.child0 = iMoved;
+		}
+		moved.parent = iA;
+
+		A.box = combineBoxes(other.box, moved.box);
+		X.box = combineBoxes(A.box, kept.box);
+
+		A.height = 1 + std::max(other.height, moved.height);
+		X.height = 1 + std::max(A.height, kept.height);
+
+		return iX;
+	};
+
+	if (heightDiff > 1) {
+		return rotateUp(iC, C, B, true);
+	}
+
+	if (heightDiff < -1) {
+		return rotateUp(iB, B, C, false);
+	}
+
+	return iA;
+}
+
+void DynamicAABBTree::queryBox(const AABox3f& box, std::vector<int>& outUserData) const {
+	if (m_root == kNullNode) {
+		return;
+	}
+
+	m_stack.clear();
+	m_stack.push_back(m_root);
+	while (m_stack.empty() == false) {
+		const int iNode = m_stack.back();
+		m_stack.pop_back();
+
+		const Node& node = m_nodes[iNode];
+		if (node.box.overlaps(box) == false) {
+			continue;
+		}
+
+		if (node.isLeaf()) {
+			outUserData.push_back(node.userData);
+		} else {
+			m_stack.push_back(node.child0);
+			m_stack.push_back(node.child1);
+		}
+	}
+}
+
+void DynamicAABBTree::appendSubtreeLeaves(const int iNode, std::vector<int>& outUserData) const {
+	const size_t stackBase = m_stack.size();
+	m_stack.push_back(iNode);
+	while (m_stack.size() > stackBase) {
+		const Node& node = m_nodes[m_stack.back()];
+		m_stack.pop_back();
+
+		if (node.isLeaf()) {
+			outUserData.push_back(node.userData);
+		} else {
+			m_stack.push_back(node.child0);
+			m_stack.push_back(node.child1);
+		}
+	}
+}
+
+void DynamicAABBTree::queryFrustum(const Frustum& frustum, std::vector<int>& outUserData) {
+	if (m_root == kNullNode) {
+		return;
+	}
+
+	const ubyte kAllPlanesMask = 0x3F;
+
+	m_stack.clear();
+	m_frustumStack.clear();
+	m_frustumStack.push_back(FrustumQueryItem{m_root, kAllPlanesMask});
+	while (m_frustumStack.empty() == false) {
+		const FrustumQueryItem item = m_frustumStack.back();
+		m_frustumStack.pop_back();
+
+		Node& node = m_nodes[item.node];
+		const vec3f center = node.box.center();
+		const vec3f halfDiagonal = node.box.halfDiagonal();
+
+		// Test the plane that rejected the node last time first, it is likely to reject it again.
+		const auto testPlane = [&](const int iPlane, ubyte& planesMask) -> bool {
+			const Plane& plane = frustum.plane(iPlane);
+			const vec3f normal = plane.norm();
+			const float distance = plane.Distance(center);
+			const float extent = halfDiagonal.x * fabsf(normal.x) + halfDiagonal.y * fabsf(normal.y) + halfDiagonal.z * fabsf(normal.z);
+
+			if (distance + extent < 0.f) {
+				return false;
+			}
+
+			if (distance - extent >= 0.f) {
+				// Fully inside that plane, the children don't need to test it.
+				planesMask &= ~ubyte(1 << iPlane);
+			}
+
+			return true;
+		};
+
+		ubyte planesMask = item.planesMask;
+		bool isOutside = false;
+		const int lastRejectingPlane = node.lastRejectingPlane;
+		if ((planesMask & (1 << lastRejectingPlane)) != 0 && testPlane(lastRejectingPlane, planesMask) == false) {
+			isOutside = true;
+		}
+
+		for (int iPlane = 0; iPlane < 6 && isOutside == false; ++iPlane) {
+			if (iPlane != lastRejectingPlane && (planesMask & (1 << iPlane)) != 0 && testPlane(iPlane, planesMask) == false) {
+				node.lastRejectingPlane = ubyte(iPlane);
+				isOutside = true;
+			}
+		}
+
+		if (isOutside) {
+			continue;
+		}
+
+		if (node.isLeaf()) {
+			outUserData.push_back(node.userData);
+		} else if (planesMask == 0) {
+			// The whole subtree is inside the frustum.
+			appendSubtreeLeaves(item.node, outUserData);
+		} else {
+			m_frustumStack.push_back(FrustumQueryItem{node.child0, planesMask});
+			m_frustumStack.push_back(FrustumQueryItem{node.child1, planesMask});
+		}
+	}
+}
+
+bool DynamicAABBTree::validate() const {
+	if (m_root == kNullNode) {
+		return m_numProxies == 0;
+	}
+
+	if (m_nodes[m_root].parent != kNullNode) {
+		return false;
+	}
+
+	int numLeaves = 0;
+	const int height = validateNode(m_root, kNullNode, numLeaves);
+	return height >= 0 && numLeaves == m_numProxies;
+}
+
+int DynamicAABBTree::validateNode(const int iNode, const int parent, int& numLeaves) const {
+	const Node& node = m_nodes[iNode];
+	if (node.parent != parent) {
+		return -1;
+	}
+
+	if (node.isLeaf()) {
+		numLeaves++;
+		return node.height == 0 ? 0 : -1;
+	}
+
+	const int height0 = validateNode(node.child0, iNode, numLeaves);
+	const int height1 = validateNode(node.child1, iNode, numLeaves);
+	if (height0 < 0 || height1 < 0) {
+		return -1;
+	}
+
+	const int height = 1 + std::max(height0, height1);
+	const AABox3f expectedBox = combineBoxes(m_nodes[node.child0].box, m_nodes[node.child1].box);
+	if (node.height != height || node.box.min != expectedBox.min || node.box.max != expectedBox.max) {
+		return -1;
+	}
+
+	return height;
+}
+
+} // namespace sge
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <vector>
+
+#include "Box.h"
+#include "Frustum.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+/// @brief A bounding volume hierarchy of axis aligned boxes that could be changed incrementally.
+/// Each object in the tree is represented by a proxy. The proxies store a "fat" box - the box of the object
+/// expanded by @getFatMargin, so objects moving a bit each frame don't need to be reinserted every frame.
+/// The tree stays balanced with rotations (like an AVL tree) when leaves get inserted or removed.
+///
+/// Frustum queries are frame-to-frame coherent - each node remembers the plane that rejected it last time and tests it first.
+/// Nodes fully inside some planes do not test them again for their children, and nodes fully inside the whole frustum
+/// return all their leaves without any further tests.
+struct DynamicAABBTree {
+	static constexpr int kNullNode = -1;
+
+	/// @param [in] fatMargin the distance by which the boxes of the proxies get expanded. Use 0 for objects that don't move.
+	explicit DynamicAABBTree(const float fatMargin = 0.f)
+	    : m_fatMargin(fatMargin) {}
+
+	float getFatMargin() const { return m_fatMargin; }
+
+	/// @brief Creates a new proxy for an object with the specified box. Returns the id of the proxy.
+	/// @param [in] userData an user specified value returned by the queries.
+	int createProxy(const AABox3f& box, const int userData);
+
+	/// Removes the proxy, its id could be reused by the next created proxy.
+	void destroyProxy(const int proxyId);
+
+	/// @brief Updates the box of the proxy. The proxy gets reinserted in the tree only if the new box is outside
+	/// of its fat box. Returns true if the proxy was reinserted.
+	bool moveProxy(const int proxyId, const AABox3f& box);
+
+	int getUserData(const int proxyId) const;
+	const AABox3f& getFatBox(const int proxyId) const;
+
+	/// Removes all proxies.
+	void clear();
+
+	int getNumProxies() const { return m_numProxies; }
+
+	/// Returns the height of the tree, 0 for a tree with a single leaf and -1 for an empty tree.
+	int getHeight() const;
+
+	/// Appends the user data of all proxies whose fat box overlaps @box.
+	void queryBox(const AABox3f& box, std::vector<int>& outUserData) const;
+
+	/// @brief Appends the user data of all proxies whose fat box isn't outside of the frustum.
+	/// The query updates the cached rejecting planes of the nodes, used to speed up the queries in the following frames.
+	void queryFrustum(const Frustum& frustum, std::vector<int>& outUserData);
+
+	/// Checks the structure of the tree, the boxes and the heights of the nodes. Returns true if the tree is valid.
+	bool validate() const;
+
+  private:
+	struct Node {
+		bool isLeaf() const { return child0 == kNullNode; }
+
+		AABox3f box;
+		int parent = kNullNode; ///< For the nodes in the free list this is the next free node.
+		int child0 = kNullNode;
+		int child1 = kNullNode;
+		int height = -1; ///< 0 for leaves, -1 for the free nodes.
+		int userData = -1;
+		/// The plane of the frustum that rejected the node during the last query, tested first during the next one.
+		ubyte lastRejectingPlane = 0;
+	};
+
+	struct FrustumQueryItem {
+		int node = kNullNode;
+		/// A bit for each plane of the frustum that still needs to be tested. The parent was fully inside the other planes.
+		ubyte planesMask = 0;
+	};
+
+	int allocateNode();
+	void freeNode(const int iNode);
+	void insertLeaf(const int leaf);
+	void removeLeaf(const int leaf);
+	int balance(const int iA);
+	void appendSubtreeLeaves(const int iNode, std::vector<int>& outUserData) const;
+	int validateNode(const int iNode, const int parent, int& numLeaves) const;
+
+  private:
+	std::vector<Node> m_nodes;
+	int m_root = kNullNode;
+	int m_freeList = kNullNode;
+	int m_numProxies = 0;
+	float m_fatMargin = 0.f;
+
+	/// The traversal stacks, kept between the queries to avoid allocations.
+	mutable std::vector<int> m_stack;
+	std::vector<FrustumQueryItem> m_frustumStack;
+};
+
+} // namespace sge
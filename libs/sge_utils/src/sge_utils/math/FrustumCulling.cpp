@@ -0,0 +1,228 @@
+#include "FrustumCulling.h"
+#include "mat4_simd.h"
+
+namespace sge {
+
+namespace {
+	/// A plane of the frustum prepared for culling boxes.
+	/// For each axis we pick the coordinates of the box corner that is the furthest along the plane normal.
+	/// If that corner is behind the plane, all corners are.
+	struct BoxCullPlane {
+		float nx, ny, nz, d;
+		const float* xs;
+		const float* ys;
+		const float* zs;
+	};
+
+	void prepareBoxCullPlanes(BoxCullPlane planes[6], const Frustum& frustum, const AABoxesSoA& boxes) {
+		for (int iPlane = 0; iPlane < 6; ++iPlane) {
+			const Plane& plane = frustum.plane(iPlane);
+			BoxCullPlane& cp = planes[iPlane];
+			cp.nx = plane.v4.x;
+			cp.ny = plane.v4.y;
+			cp.nz = plane.v4.z;
+			cp.d = plane.v4.w;
+			cp.xs = cp.nx >= 0.f ? boxes.maxX.data() : boxes.minX.data();
+			cp.ys = cp.ny >= 0.f ? boxes.maxY.data() : boxes.minY.data();
+			cp.zs = cp.nz >= 0.f ? boxes.maxZ.data() : boxes.minZ.data();
+		}
+	}
+
+	// Caution: The distances below are computed in the same order as @Plane::Distance, so the results match the scalar code exactly.
+	bool isBoxOutsideScalar(const BoxCullPlane planes[6], const int index) {
+		for (int iPlane = 0; iPlane < 6; ++iPlane) {
+			const BoxCullPlane& cp = planes[iPlane];
+			float dist = cp.nx * cp.xs[index];
+			dist += cp.ny * cp.ys[index];
+			dist += cp.nz * cp.zs[index];
+			if (dist + cp.d < 0.f) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool isSphereOutsideScalar(const Frustum& frustum, const SpheresSoA& spheres, const int index) {
+		for (int iPlane = 0; iPlane < 6; ++iPlane) {
+			const vec4f& p = frustum.plane(iPlane).v4;
+			float dist = p.x * spheres.centerX[index];
+			dist += p.y * spheres.centerY[index];
+			dist += p.z * spheres.centerZ[index];
+			if ((dist + p.w) + spheres.radius[index] < 0.f) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+#if defined(SGE_SIMD_SSE)
+	/// Writes the indices of the visible lanes (the zero bits of @outsideMask) at @out. Returns the number of written indices.
+	int writeVisibleLanes(int* const out, const int firstIndex, const int outsideMask) {
+		int numWritten = 0;
+		for (int iLane = 0; iLane < 4; ++iLane) {
+			out[numWritten] = firstIndex + iLane;
+			numWritten += ((outsideMask >> iLane) & 1) ^ 1;
+		}
+		return numWritten;
+	}
+#endif
+} // namespace
+
+//--------------------------------------------------------------------
+// AABoxesSoA
+//--------------------------------------------------------------------
+void AABoxesSoA::clear() {
+	minX.clear();
+	minY.clear();
+	minZ.clear();
+	maxX.clear();
+	maxY.clear();
+	maxZ.clear();
+}
+
+void AABoxesSoA::reserve(const int capacity) {
+	minX.reserve(capacity);
+	minY.reserve(capacity);
+	minZ.reserve(capacity);
+	maxX.reserve(capacity);
+	maxY.reserve(capacity);
+	maxZ.reserve(capacity);
+}
+
+void AABoxesSoA::add(const AABox3f& box) {
+	sgeAssert(box.IsEmpty() == false);
+	minX.push_back(box.min.x);
+	minY.push_back(box.min.y);
+	minZ.push_back(box.min.z);
+	maxX.push_back(box.max.x);
+	maxY.push_back(box.max.y);
+	maxZ.push_back(box.max.z);
+}
+
+AABox3f AABoxesSoA::get(const int index) const {
+	return AABox3f(vec3f(minX[index], minY[index], minZ[index]), vec3f(maxX[index], maxY[index], maxZ[index]));
+}
+
+//--------------------------------------------------------------------
+// SpheresSoA
+//--------------------------------------------------------------------
+void SpheresSoA::clear() {
+	centerX.clear();
+	centerY.clear();
+	centerZ.clear();
+	radius.clear();
+}
+
+void SpheresSoA::reserve(const int capacity) {
+	centerX.reserve(capacity);
+	centerY.reserve(capacity);
+	centerZ.reserve(capacity);
+	radius.reserve(capacity);
+}
+
+void SpheresSoA::add(const vec3f& center, const float r) {
+	centerX.push_back(center.x);
+	centerY.push_back(center.y);
+	centerZ.push_back(center.z);
+	radius.push_back(r);
+}
+
+//--------------------------------------------------------------------
+// Culling
+//--------------------------------------------------------------------
+void cullBoxes(const Frustum& frustum, const AABoxesSoA& boxes, std::vector<int>& outVisibleIndices) {
+	const int numBoxes = boxes.size();
+	if (numBoxes == 0) {
+		return;
+	}
+
+	BoxCullPlane planes[6];
+	prepareBoxCullPlanes(planes, frustum, boxes);
+
+	// Reserve space for all boxes, the unused part gets trimmed at the end.
+	const size_t numVisibleBefore = outVisibleIndices.size();
+	outVisibleIndices.resize(numVisibleBefore + numBoxes);
+	int* const out = outVisibleIndices.data() + numVisibleBefore;
+	int numVisible = 0;
+
+	int iBox = 0;
+#if defined(SGE_SIMD_SSE)
+	for (; iBox + 4 <= numBoxes; iBox += 4) {
+		__m128 outside = _mm_setzero_ps();
+		for (int iPlane = 0; iPlane < 6; ++iPlane) {
+			const BoxCullPlane& cp = planes[iPlane];
+			__m128 dist = _mm_mul_ps(_mm_set1_ps(cp.nx), _mm_loadu_ps(cp.xs + iBox));
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(cp.ny), _mm_loadu_ps(cp.ys + iBox)));
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(cp.nz), _mm_loadu_ps(cp.zs + iBox)));
+			dist = _mm_add_ps(dist, _mm_set1_ps(cp.d));
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(dist, _mm_setzero_ps()));
+
+			// All 4 boxes are already known to be outside.
+			if (_mm_movemask_ps(outside) == 0xF) {
+				break;
+			}
+		}
+
+		numVisible += writeVisibleLanes(out + numVisible, iBox, _mm_movemask_ps(outside));
+	}
+#endif
+
+	for (; iBox < numBoxes; ++iBox) {
+		if (isBoxOutsideScalar(planes, iBox) == false) {
+			out[numVisible++] = iBox;
+		}
+	}
+
+	outVisibleIndices.resize(numVisibleBefore + numVisible);
+}
+
+void cullSpheres(const Frustum& frustum, const SpheresSoA& spheres, std::vector<int>& outVisibleIndices) {
+	const int numSpheres = spheres.size();
+	if (numSpheres == 0) {
+		return;
+	}
+
+	// Reserve space for all spheres, the unused part gets trimmed at the end.
+	const size_t numVisibleBefore = outVisibleIndices.size();
+	outVisibleIndices.resize(numVisibleBefore + numSpheres);
+	int* const out = outVisibleIndices.data() + numVisibleBefore;
+	int numVisible = 0;
+
+	int iSphere = 0;
+#if defined(SGE_SIMD_SSE)
+	for (; iSphere + 4 <= numSpheres; iSphere += 4) {
+		const __m128 cx = _mm_loadu_ps(spheres.centerX.data() + iSphere);
+		const __m128 cy = _mm_loadu_ps(spheres.centerY.data() + iSphere);
+		const __m128 cz = _mm_loadu_ps(spheres.centerZ.data() + iSphere);
+		const __m128 r = _mm_loadu_ps(spheres.radius.data() + iSphere);
+
+		__m128 outside = _mm_setzero_ps();
+		for (int iPlane = 0; iPlane < 6; ++iPlane) {
+			const vec4f& p = frustum.plane(iPlane).v4;
+			__m128 dist = _mm_mul_ps(_mm_set1_ps(p.x), cx);
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(p.y), cy));
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(p.z), cz));
+			dist = _mm_add_ps(dist, _mm_set1_ps(p.w));
+			dist = _mm_add_ps(dist, r);
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(dist, _mm_setzero_ps()));
+
+			// All 4 spheres are already known to be outside.
+			if (_mm_movemask_ps(outside) == 0xF) {
+				break;
+			}
+		}
+
+		numVisible += writeVisibleLanes(out + numVisible, iSphere, _mm_movemask_ps(outside));
+	}
+#endif
+
+	for (; iSphere < numSpheres; ++iSphere) {
+		if (isSphereOutsideScalar(frustum, spheres, iSphere) == false) {
+			out[numVisible++] = iSphere;
+		}
+	}
+
+	outVisibleIndices.resize(numVisibleBefore + numVisible);
+}
+
+} // namespace sge
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+
+#include "Frustum.h"
+
+namespace sge {
+
+/// @brief Axis aligned boxes stored as a separate array for each component (structure of arrays),
+/// so they could be culled a few at a time with SIMD instructions. See @cullBoxes.
+struct AABoxesSoA {
+	void clear();
+	void reserve(const int capacity);
+
+	/// Adds a box, it must not be empty.
+	void add(const AABox3f& box);
+	AABox3f get(const int index) const;
+
+	int size() const { return int(minX.size()); }
+
+	std::vector<float> minX, minY, minZ;
+	std::vector<float> maxX, maxY, maxZ;
+};
+
+/// @brief Spheres stored as a separate array for each component (structure of arrays),
+/// so they could be culled a few at a time with SIMD instructions. See @cullSpheres.
+struct SpheresSoA {
+	void clear();
+	void reserve(const int capacity);
+
+	void add(const vec3f& center, const float radius);
+
+	int size() const { return int(centerX.size()); }
+
+	std::vector<float> centerX, centerY, centerZ;
+	std::vector<float> radius;
+};
+
+/// @brief Appends to @outVisibleIndices the indices of the boxes that aren't outside of the frustum, in increasing order.
+/// The result is exactly the same as calling @Frustum::isBoxOutside for each box.
+void cullBoxes(const Frustum& frustum, const AABoxesSoA& boxes, std::vector<int>& outVisibleIndices);
+
+/// @brief Appends to @outVisibleIndices the indices of the spheres that aren't outside of the frustum, in increasing order.
+/// The result is exactly the same as calling @Frustum::isSphereOutside for each sphere.
+void cullSpheres(const Frustum& frustum, const SpheresSoA& spheres, std::vector<int>& outVisibleIndices);
+
+} // namespace sge
@@ -0,0 +1,133 @@
+#include "ShadowCascades.h"
+#include "common.h"
+#include <cfloat>
+#include <cmath>
+
+namespace sge {
+
+void computeShadowCascadeSplits(const float nearDist, const float farDist, const int numCascades, const float lambda, float outSplitsFar[]) {
+	sgeAssert(numCascades >= 1 && nearDist < farDist);
+
+	// The logarithmic splits aren't defined for a zero near plane.
+	const float logNear = maxOf(nearDist, 1e-3f);
+
+	for (int iCascade = 0; iCascade < numCascades; ++iCascade) {
+		const float p = float(iCascade + 1) / float(numCascades);
+		const float uniformSplit = nearDist + (farDist - nearDist) * p;
+		const float logSplit = logNear * powf(farDist / logNear, p);
+		outSplitsFar[iCascade] = lerp(uniformSplit, logSplit, lambda);
+	}
+
+	outSplitsFar[numCascades - 1] = farDist;
+}
+
+void computeFrustumSliceCorners(const vec3f frustumCorners[8],
+                                const float nearDist,
+                                const float farDist,
+                                const float sliceNear,
+                                const float sliceFar,
+                                vec3f outCorners[8]) {
+	const float tNear = (sliceNear - nearDist) / (farDist - nearDist);
+	const float tFar = (sliceFar - nearDist) / (farDist - nearDist);
+
+	for (int t = 0; t < 4; ++t) {
+		const vec3f& cornerNear = frustumCorners[t];
+		const vec3f& cornerFar = frustumCorners[t + 4];
+
+		outCorners[t] = lerp(cornerNear, cornerFar, tNear);
+		outCorners[t + 4] = lerp(cornerNear, cornerFar, tFar);
+	}
+}
+
+void fitShadowCascades(const vec3f frustumCornersWs[8],
+                       const float nearDist,
+                       const float farDist,
+                       const mat4f& lightView,
+                       const ShadowCascadesSettings& settings,
+                       const bool d3dStyle,
+                       ShadowCascade outCascades[kMaxShadowCascades]) {
+	const int numCascades = clamp(settings.numCascades, 1, kMaxShadowCascades);
+	const float resolution = float(maxOf(settings.resolution, 1));
+
+	float splitsFar[kMaxShadowCascades];
+	computeShadowCascadeSplits(nearDist, farDist, numCascades, settings.splitLambda, splitsFar);
+
+	float commonNearZ = FLT_MAX;
+	float commonFarZ = -FLT_MAX;
+	float cascadeNearZ[kMaxShadowCascades];
+	float cascadeFarZ[kMaxShadowCascades];
+
+	for (int iCascade = 0; iCascade < numCascades; ++iCascade) {
+		ShadowCascade& cascade = outCascades[iCascade];
+
+		// The first cascade starts at 0 so the shaders don't need to know the near plane of the camera.
+		cascade.splitNear = iCascade == 0 ? 0.f : splitsFar[iCascade - 1];
+		cascade.splitFar = splitsFar[iCascade];
+
+		// Extend the covered area backwards over the part of the previous cascade where the two get blended.
+		float sliceNear = nearDist;
+		if (iCascade > 0) {
+			const ShadowCascade& prevCascade = outCascades[iCascade - 1];
+			sliceNear = prevCascade.splitFar - (prevCascade.splitFar - prevCascade.splitNear) * settings.blendFraction;
+			sliceNear = maxOf(sliceNear, nearDist);
+		}
+
+		vec3f sliceCornersWs[8];
+		computeFrustumSliceCorners(frustumCornersWs, nearDist, farDist, sliceNear, cascade.splitFar, sliceCornersWs);
+
+		// The bounding sphere of the slice. Both the center and the radius move rigidly with the camera,
+		// so the radius (and the size of the shadow map texels) doesn't change when the camera moves or rotates.
+		vec3f centerWs = vec3f(0.f);
+		for (const vec3f& corner : sliceCornersWs) {
+			centerWs += corner;
+		}
+		centerWs /= 8.f;
+
+		float radius = 0.f;
+		for (const vec3f& corner : sliceCornersWs) {
+			radius = maxOf(radius, distance(centerWs, corner));
+		}
+
+		// Round up the radius to hide the floating point errors from the computations above.
+		// Add a texel at the border as the snapping below moves the center by up to half a texel.
+		radius = ceilf(radius * 16.f) / 16.f;
+		radius += (2.f * radius) / resolution;
+
+		// Snap the center to whole texels, this way the texels stay at the same place in the world when the camera moves.
+		const float texelSize = (2.f * radius) / resolution;
+		vec3f centerLs = mat_mul_pos(lightView, centerWs);
+		centerLs.x = floorf(centerLs.x / texelSize + 0.5f) * texelSize;
+		centerLs.y = floorf(centerLs.y / texelSize + 0.5f) * texelSize;
+
+		cascade.centerLs = centerLs;
+		cascade.radius = radius;
+		cascade.texelSize = texelSize;
+
+		// The light looks along -z. Include the casters between the light and the covered area.
+		cascadeNearZ[iCascade] = -(centerLs.z + radius) - settings.casterDistance;
+		cascadeFarZ[iCascade] = -(centerLs.z - radius);
+
+		commonNearZ = minOf(commonNearZ, cascadeNearZ[iCascade]);
+		commonFarZ = maxOf(commonFarZ, cascadeFarZ[iCascade]);
+	}
+
+	for (int iCascade = 0; iCascade < numCascades; ++iCascade) {
+		ShadowCascade& cascade = outCascades[iCascade];
+		const float left = cascade.centerLs.x - cascade.radius;
+		const float right = cascade.centerLs.x + cascade.radius;
+		const float top = cascade.centerLs.y + cascade.radius;
+		const float bottom = cascade.centerLs.y - cascade.radius;
+
+		cascade.proj = mat4f::getOrthoRH(left, right, top, bottom, commonNearZ, commonFarZ, d3dStyle);
+		cascade.cullingProj = mat4f::getOrthoRH(left, right, top, bottom, cascadeNearZ[iCascade], cascadeFarZ[iCascade], d3dStyle);
+	}
+}
+
+vec4f computeShadowCascadeNdcTransform(const ShadowCascade& baseCascade, const ShadowCascade& cascade) {
+	const float scale = baseCascade.radius / cascade.radius;
+	const float offsetX = (baseCascade.centerLs.x - cascade.centerLs.x) / cascade.radius;
+	const float offsetY = (baseCascade.centerLs.y - cascade.centerLs.y) / cascade.radius;
+	return vec4f(scale, offsetX, offsetY, cascade.splitFar);
+}
+
+} // namespace sge
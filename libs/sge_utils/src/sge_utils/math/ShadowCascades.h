@@ -0,0 +1,82 @@
+#pragma once
+
+#include "mat4.h"
+
+namespace sge {
+
+/// The maximum number of cascades of a cascaded shadow map.
+constexpr int kMaxShadowCascades = 4;
+
+struct ShadowCascadesSettings {
+	/// The number of cascades, in [1;kMaxShadowCascades].
+	int numCascades = 3;
+	/// Blends the uniform (0) and the logarithmic (1) splits, see @computeShadowCascadeSplits.
+	float splitLambda = 0.75f;
+	/// The part of each cascade (at its end) where it gets blended with the next one.
+	/// The next cascade gets extended backwards to cover that area too.
+	float blendFraction = 0.1f;
+	/// The resolution of a single cascade in texels (the shadow maps are square).
+	int resolution = 1024;
+	/// How far behind the covered area (towards the light) the shadow casters still get included.
+	float casterDistance = 100.f;
+};
+
+/// @brief A single cascade of a cascaded shadow map.
+/// The cascades are bounding spheres of slices of the camera frustum, projected with orthographic projections.
+/// As the radius of a sphere doesn't change when the camera moves or rotates and the projection is snapped to
+/// whole texels in light space, the texels of the shadow map stay fixed in the world and the shadows don't shimmer.
+struct ShadowCascade {
+	/// The view distances (along the camera look direction) where the cascade starts and ends.
+	/// The area where cascade is used, the next cascade overlaps the blended part at the end.
+	float splitNear = 0.f;
+	float splitFar = 0.f;
+	/// The orthographic projection of the cascade in the light view space.
+	/// The depth range is the same for all cascades, so the cascades could be sampled using the projection of any one of them.
+	mat4f proj = mat4f::getIdentity();
+	/// The same as @proj but with a depth range fitted only to the area covered by this cascade.
+	/// Used for culling the shadow casters of the cascade.
+	mat4f cullingProj = mat4f::getIdentity();
+	/// The center (in light view space) and the radius of the covered area.
+	vec3f centerLs = vec3f(0.f);
+	float radius = 0.f;
+	/// The size of a single texel of the cascade in world space.
+	float texelSize = 0.f;
+};
+
+/// @brief Computes the view distances where each cascade ends using the "practical split scheme",
+/// a blend of logarithmic splits (evenly distributed shadow map texel density) and uniform splits.
+/// @param [in] lambda 0 means uniform splits, 1 means logarithmic ones.
+/// @param [out] outSplitsFar receives @numCascades values, the last one is always @farDist.
+void computeShadowCascadeSplits(const float nearDist, const float farDist, const int numCascades, const float lambda, float outSplitsFar[]);
+
+/// @brief Computes the corners of a slice of a frustum.
+/// @param [in] frustumCorners the corners of the frustum, 4 on the near plane and the matching 4 on the far plane (see @Frustum::getCorners).
+/// @param [in] nearDist, farDist the view distances of the near and far planes of the frustum.
+/// @param [in] sliceNear, sliceFar the view distances of the planes of the slice.
+void computeFrustumSliceCorners(const vec3f frustumCorners[8],
+                                const float nearDist,
+                                const float farDist,
+                                const float sliceNear,
+                                const float sliceFar,
+                                vec3f outCorners[8]);
+
+/// @brief Fits the cascades of a cascaded shadow map to a camera frustum.
+/// @param [in] frustumCornersWs the corners of the camera frustum in world space, ending at the view distance where the shadows end,
+///             4 on the near plane and the matching 4 on the far plane (see @Frustum::getCorners).
+/// @param [in] nearDist, farDist the view distances of the near and far planes of the frustum.
+/// @param [in] lightView the view matrix of the light. For stable shadows it must not depend on the camera.
+/// @param [out] outCascades receives @settings.numCascades cascades.
+void fitShadowCascades(const vec3f frustumCornersWs[8],
+                       const float nearDist,
+                       const float farDist,
+                       const mat4f& lightView,
+                       const ShadowCascadesSettings& settings,
+                       const bool d3dStyle,
+                       ShadowCascade outCascades[kMaxShadowCascades]);
+
+/// @brief Computes how the normalized device coordinates of @baseCascade map to the ones of @cascade.
+/// The result (s, x, y, splitFar) means ndc.xy = ndcBase.xy * s + (x, y), the depth is the same for all cascades.
+/// Used by the shaders for finding the position in any cascade with a single projection.
+vec4f computeShadowCascadeNdcTransform(const ShadowCascade& baseCascade, const ShadowCascade& cascade);
+
+} // namespace sge
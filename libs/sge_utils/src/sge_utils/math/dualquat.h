@@ -0,0 +1,68 @@
+#pragma once
+
+#include "mat4.h"
+#include "quat.h"
+#include "vec3.h"
+
+namespace sge {
+
+/// @brief A unit dual quaternion representing a rigid transformation (rotation followed by translation).
+/// Used for skinning, where blending dual quaternions doesn't collapse the volume around twisting joints
+/// like blending matrices does. See Kavan et al. - "Skinning with Dual Quaternions".
+/// Scaling cannot be represented and gets ignored.
+struct dualquatf {
+	dualquatf() = default;
+	dualquatf(const quatf& real, const quatf& dual)
+	    : real(real)
+	    , dual(dual) {}
+
+	static dualquatf getIdentity() { return dualquatf(quatf::getIdentity(), quatf(0.f, 0.f, 0.f, 0.f)); }
+
+	/// Creates a dual quaternion that rotates by @rotation (must be normalized) and then translates by @translation.
+	static dualquatf fromRotationTranslation(const quatf& rotation, const vec3f& translation) {
+		return dualquatf(rotation, quatf(translation, 0.f) * rotation * 0.5f);
+	}
+
+	/// Creates a dual quaternion from the rotation and the translation of the matrix, the scaling is removed.
+	static dualquatf fromMatrix(const mat4f& m) {
+		const quatf rotation = m.removedScaling().toQuat().normalized();
+		return fromRotationTranslation(rotation, m.data[3].xyz());
+	}
+
+	vec3f getTranslation() const { return (dual * real.conjugate() * 2.f).xyz(); }
+
+	/// Returns the dual quaternion divided by the length of its real part, needed after blending.
+	dualquatf normalized() const {
+		const float realLength = real.length();
+		if (realLength < 1e-12f) {
+			return getIdentity();
+		}
+
+		const float invLength = 1.f / realLength;
+		return dualquatf(real * invLength, dual * invLength);
+	}
+
+	/// Transforms a point, the dual quaternion must be normalized.
+	vec3f transformPoint(const vec3f& p) const {
+		const vec3f rv = real.xyz();
+		const vec3f dv = dual.xyz();
+		const vec3f rotated = p + 2.f * rv.cross(rv.cross(p) + real.w * p);
+		const vec3f translation = 2.f * (real.w * dv - dual.w * rv + rv.cross(dv));
+		return rotated + translation;
+	}
+
+	/// Rotates a direction, the dual quaternion must be normalized.
+	vec3f transformDirection(const vec3f& d) const {
+		const vec3f rv = real.xyz();
+		return d + 2.f * rv.cross(rv.cross(d) + real.w * d);
+	}
+
+	dualquatf operator+(const dualquatf& other) const { return dualquatf(real + other.real, dual + other.dual); }
+	dualquatf operator*(const float s) const { return dualquatf(real * s, dual * s); }
+
+  public:
+	quatf real; ///< The rotation.
+	quatf dual; ///< Encodes the translation, 0.5 * translation * real.
+};
+
+} // namespace sge
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "mat4.h"
+
+// Pick the instruction set used by the SIMD helpers below. If none is available the helpers fall back to scalar code.
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define SGE_SIMD_SSE 1
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SGE_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace sge {
+
+/// @brief Computes a * b using SIMD instructions when available.
+/// The result is identical to the scalar mat4f::operator*, the products are summed in the same order.
+inline void mat4f_mul_simd(mat4f& result, const mat4f& a, const mat4f& b) {
+#if defined(SGE_SIMD_SSE)
+	const __m128 a0 = _mm_loadu_ps(a.data[0].data);
+	const __m128 a1 = _mm_loadu_ps(a.data[1].data);
+	const __m128 a2 = _mm_loadu_ps(a.data[2].data);
+	const __m128 a3 = _mm_loadu_ps(a.data[3].data);
+
+	for (int iCol = 0; iCol < 4; ++iCol) {
+		const vec4f& bc = b.data[iCol];
+		__m128 r = _mm_mul_ps(a0, _mm_set1_ps(bc.x));
+		r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_set1_ps(bc.y)));
+		r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_set1_ps(bc.z)));
+		r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_set1_ps(bc.w)));
+		_mm_storeu_ps(result.data[iCol].data, r);
+	}
+#elif defined(SGE_SIMD_NEON)
+	const float32x4_t a0 = vld1q_f32(a.data[0].data);
+	const float32x4_t a1 = vld1q_f32(a.data[1].data);
+	const float32x4_t a2 = vld1q_f32(a.data[2].data);
+	const float32x4_t a3 = vld1q_f32(a.data[3].data);
+
+	for (int iCol = 0; iCol < 4; ++iCol) {
+		const vec4f& bc = b.data[iCol];
+		// vmlaq might be fused, which would change the rounding compared to the scalar code, so multiply and add separately.
+		float32x4_t r = vmulq_n_f32(a0, bc.x);
+		r = vaddq_f32(r, vmulq_n_f32(a1, bc.y));
+		r = vaddq_f32(r, vmulq_n_f32(a2, bc.z));
+		r = vaddq_f32(r, vmulq_n_f32(a3, bc.w));
+		vst1q_f32(result.data[iCol].data, r);
+	}
+#else
+	result = a * b;
+#endif
+}
+
+} // namespace sge
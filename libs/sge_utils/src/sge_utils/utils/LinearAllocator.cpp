@@ -0,0 +1,62 @@
+#include "LinearAllocator.h"
+#include <algorithm>
+#include <cstring>
+
+namespace sge {
+
+void* LinearAllocator::allocate(const size_t sizeBytes, const size_t alignment) {
+	sgeAssert(alignment > 0 && (alignment & (alignment - 1)) == 0 && alignment <= alignof(std::max_align_t));
+
+	// Try to fit the allocation in the current chunk, if it doesn't fit move to the next chunk (allocating it if needed).
+	for (;;) {
+		if (m_iCurrentChunk >= 0) {
+			Chunk& chunk = m_chunks[m_iCurrentChunk];
+			const size_t alignedOffset = (m_currentChunkOffset + alignment - 1) & ~(alignment - 1);
+			if (alignedOffset + sizeBytes <= chunk.sizeBytes) {
+				m_numBytesUsed += alignedOffset + sizeBytes - m_currentChunkOffset;
+				m_currentChunkOffset = alignedOffset + sizeBytes;
+				return chunk.memory.get() + alignedOffset;
+			}
+		}
+
+		m_iCurrentChunk++;
+		m_currentChunkOffset = 0;
+
+		// Reuse the chunks from before the last reset if they are big enough, otherwise drop them.
+		while (m_iCurrentChunk < int(m_chunks.size()) && m_chunks[m_iCurrentChunk].sizeBytes < sizeBytes) {
+			m_chunks.erase(m_chunks.begin() + m_iCurrentChunk);
+		}
+
+		if (m_iCurrentChunk == int(m_chunks.size())) {
+			// Allocations bigger than the chunk size get their own chunk.
+			Chunk newChunk;
+			newChunk.sizeBytes = std::max(m_chunkSizeBytes, sizeBytes);
+			newChunk.memory.reset(new char[newChunk.sizeBytes]);
+			m_chunks.emplace_back(std::move(newChunk));
+		}
+	}
+}
+
+void* LinearAllocator::allocateCopy(const void* const data, const size_t sizeBytes, const size_t alignment) {
+	void* const result = allocate(sizeBytes, alignment);
+	if (sizeBytes != 0) {
+		memcpy(result, data, sizeBytes);
+	}
+	return result;
+}
+
+void LinearAllocator::reset() {
+	m_iCurrentChunk = m_chunks.empty() ? -1 : 0;
+	m_currentChunkOffset = 0;
+	m_numBytesUsed = 0;
+}
+
+size_t LinearAllocator::getNumBytesReserved() const {
+	size_t result = 0;
+	for (const Chunk& chunk : m_chunks) {
+		result += chunk.sizeBytes;
+	}
+	return result;
+}
+
+} // namespace sge
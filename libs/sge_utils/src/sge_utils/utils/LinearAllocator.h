@@ -0,0 +1,58 @@
+#pragma once
+
+#include "sge_utils/sge_utils.h"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace sge {
+
+/// @brief Allocates memory by bumping a pointer inside of big chunks, everything gets freed at once with @reset.
+/// The allocated memory never moves, so pointers to it stay valid until @reset.
+/// The chunks are kept between the resets, after a few frames of warm up there are no more heap allocations.
+/// Not thread safe, each thread should use its own allocator.
+struct LinearAllocator {
+	static constexpr size_t kDefaultChunkSizeBytes = 64 * 1024;
+
+	explicit LinearAllocator(const size_t chunkSizeBytes = kDefaultChunkSizeBytes)
+	    : m_chunkSizeBytes(chunkSizeBytes) {}
+
+	LinearAllocator(const LinearAllocator&) = delete;
+	LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+	/// Returns uninitialized memory, @alignment must be a power of two not bigger than alignof(std::max_align_t).
+	void* allocate(const size_t sizeBytes, const size_t alignment = alignof(std::max_align_t));
+
+	/// Allocates a copy of the specified memory.
+	void* allocateCopy(const void* const data, const size_t sizeBytes, const size_t alignment = alignof(std::max_align_t));
+
+	/// Allocates and constructs an object. The destructors are never called, intended for plain structs.
+	template <typename T, typename... TArgs>
+	T* make(TArgs&&... args) {
+		return new (allocate(sizeof(T), alignof(T))) T(std::forward<TArgs>(args)...);
+	}
+
+	/// Frees all allocations while keeping the chunks for reuse.
+	void reset();
+
+	/// The number of bytes allocated since the last @reset, including the alignment padding.
+	size_t getNumBytesUsed() const { return m_numBytesUsed; }
+	size_t getNumBytesReserved() const;
+
+  private:
+	struct Chunk {
+		std::unique_ptr<char[]> memory;
+		size_t sizeBytes = 0;
+	};
+
+	size_t m_chunkSizeBytes = kDefaultChunkSizeBytes;
+	std::vector<Chunk> m_chunks;
+	/// The chunk currently used for allocating and the offset of its first free byte.
+	int m_iCurrentChunk = -1;
+	size_t m_currentChunkOffset = 0;
+	size_t m_numBytesUsed = 0;
+};
+
+} // namespace sge
@@ -0,0 +1,99 @@
+#if defined(WIN32)
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MemoryMappedFile.h"
+#include "sge_utils/sge_utils.h"
+
+namespace sge {
+
+bool MemoryMappedFile::open(const char* const filename) {
+	close();
+
+	if (filename == nullptr) {
+		return false;
+	}
+
+#if defined(WIN32)
+	HANDLE hFile = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(hFile, &fileSize) == FALSE || fileSize.QuadPart == 0) {
+		CloseHandle(hFile);
+		return false;
+	}
+
+	HANDLE hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (hMapping == nullptr) {
+		CloseHandle(hFile);
+		return false;
+	}
+
+	void* const mapped = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+	if (mapped == nullptr) {
+		CloseHandle(hMapping);
+		CloseHandle(hFile);
+		return false;
+	}
+
+	m_fileHandle = hFile;
+	m_mappingHandle = hMapping;
+	m_data = (const char*)mapped;
+	m_sizeBytes = size_t(fileSize.QuadPart);
+#else
+	const int fd = ::open(filename, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+		::close(fd);
+		return false;
+	}
+
+	void* const mapped = mmap(nullptr, size_t(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// The mapping keeps its own reference to the file, the descriptor is no longer needed.
+	::close(fd);
+
+	if (mapped == MAP_FAILED) {
+		return false;
+	}
+
+	m_data = (const char*)mapped;
+	m_sizeBytes = size_t(fileStat.st_size);
+#endif
+
+	return true;
+}
+
+void MemoryMappedFile::close() {
+	if (m_data == nullptr) {
+		return;
+	}
+
+#if defined(WIN32)
+	UnmapViewOfFile(m_data);
+	CloseHandle((HANDLE)m_mappingHandle);
+	CloseHandle((HANDLE)m_fileHandle);
+	m_mappingHandle = nullptr;
+	m_fileHandle = nullptr;
+#else
+	munmap((void*)m_data, m_sizeBytes);
+#endif
+
+	m_data = nullptr;
+	m_sizeBytes = 0;
+}
+
+} // namespace sge
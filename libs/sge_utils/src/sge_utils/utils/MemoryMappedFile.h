@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+
+namespace sge {
+
+/// @brief A read-only view of a whole file mapped in the address space of the process.
+/// The contents are paged in by the operating system on first access, so opening a big file is cheap.
+/// The mapped memory is valid until @close() is called or the object is destroyed.
+struct MemoryMappedFile {
+	MemoryMappedFile() = default;
+	~MemoryMappedFile() { close(); }
+
+	MemoryMappedFile(const MemoryMappedFile&) = delete;
+	MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+	/// @brief Maps the specified file for reading.
+	/// @return True if the file was mapped successfully.
+	bool open(const char* const filename);
+	void close();
+
+	bool isOpened() const { return m_data != nullptr; }
+
+	const char* data() const { return m_data; }
+	size_t size() const { return m_sizeBytes; }
+
+  private:
+	const char* m_data = nullptr;
+	size_t m_sizeBytes = 0;
+
+#if defined(WIN32)
+	void* m_fileHandle = nullptr;
+	void* m_mappingHandle = nullptr;
+#endif
+};
+
+} // namespace sge
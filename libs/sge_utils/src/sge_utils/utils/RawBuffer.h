@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace sge {
+
+/// @brief A chunk of raw bytes that either owns its memory or is a view into memory owned by someone else,
+/// for example a memory mapped file. When the buffer is a view @m_keepAlive keeps the viewed memory valid.
+/// Writing to a view makes a private copy of the data first.
+struct RawBuffer {
+	RawBuffer() = default;
+
+	RawBuffer(std::vector<char>&& data)
+	    : m_owned(std::move(data)) {}
+
+	RawBuffer& operator=(std::vector<char>&& data) {
+		m_owned = std::move(data);
+		m_view = nullptr;
+		m_viewSizeBytes = 0;
+		m_keepAlive.reset();
+		return *this;
+	}
+
+	/// @brief Makes the buffer point to external memory.
+	/// @param [in] keepAlive an object that owns the memory pointed by @data. Might be nullptr if the memory is static.
+	void setView(const char* const data, const size_t sizeBytes, std::shared_ptr<const void> keepAlive) {
+		m_owned = std::vector<char>();
+		m_view = data;
+		m_viewSizeBytes = sizeBytes;
+		m_keepAlive = std::move(keepAlive);
+	}
+
+	bool isView() const { return m_view != nullptr; }
+
+	const char* data() const { return isView() ? m_view : m_owned.data(); }
+	size_t size() const { return isView() ? m_viewSizeBytes : m_owned.size(); }
+	bool empty() const { return size() == 0; }
+
+	/// @brief Returns a writable pointer to the data. If the buffer is a view, the data gets copied.
+	char* mutableData() {
+		makeOwned();
+		return m_owned.data();
+	}
+
+	void resize(const size_t newSizeBytes) {
+		makeOwned();
+		m_owned.resize(newSizeBytes);
+	}
+
+	std::vector<char> toVector() const { return std::vector<char>(data(), data() + size()); }
+
+  private:
+	void makeOwned() {
+		if (isView()) {
+			m_owned = toVector();
+			m_view = nullptr;
+			m_viewSizeBytes = 0;
+			m_keepAlive.reset();
+		}
+	}
+
+  private:
+	std::vector<char> m_owned;
+	const char* m_view = nullptr;
+	size_t m_viewSizeBytes = 0;
+	std::shared_ptr<const void> m_keepAlive;
+};
+
+} // namespace sge
@@ -68,7 +68,7 @@ class StaticArray {
 
 	bool isFull() { return SIZE == usedElems; }
 
-	void clear() { resize(); }
+	void clear() { resize(0); }
 
 	void resize(const int newSize) {
 		sgeAssert(newSize >= 0);
@@ -0,0 +1,94 @@
+#include "ThreadPool.h"
+
+namespace sge {
+
+ThreadPool::ThreadPool(const int numWorkers) {
+	for (int t = 0; t < numWorkers; ++t) {
+		m_workers.emplace_back([this]() -> void { workerMain(); });
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_shouldQuit = true;
+	}
+	m_workersWakeUp.notify_all();
+
+	for (std::thread& worker : m_workers) {
+		worker.join();
+	}
+}
+
+void ThreadPool::parallelFor(const int numItems, const std::function<void(int iItem)>& fn) {
+	if (numItems <= 0) {
+		return;
+	}
+
+	// Waking up the workers isn't free, do not bother with them if there isn't enough work to share.
+	if (m_workers.empty() || numItems == 1) {
+		for (int iItem = 0; iItem < numItems; ++iItem) {
+			fn(iItem);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_jobFn = &fn;
+		m_jobNumItems = numItems;
+		m_nextItem = 0;
+		m_numWorkersInJob = int(m_workers.size());
+		m_jobGeneration++;
+	}
+	m_workersWakeUp.notify_all();
+
+	executeItems(fn, numItems);
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_jobDone.wait(lock, [this]() -> bool { return m_numWorkersInJob == 0; });
+	m_jobFn = nullptr;
+}
+
+int ThreadPool::getDefaultNumWorkers() {
+	const int numHardwareThreads = int(std::thread::hardware_concurrency());
+	return numHardwareThreads > 1 ? numHardwareThreads - 1 : 0;
+}
+
+void ThreadPool::workerMain() {
+	uint64 lastJobGeneration = 0;
+	while (true) {
+		const std::function<void(int)>* jobFn = nullptr;
+		int jobNumItems = 0;
+
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_workersWakeUp.wait(lock, [&]() -> bool { return m_shouldQuit || m_jobGeneration != lastJobGeneration; });
+			if (m_shouldQuit) {
+				return;
+			}
+
+			lastJobGeneration = m_jobGeneration;
+			jobFn = m_jobFn;
+			jobNumItems = m_jobNumItems;
+		}
+
+		executeItems(*jobFn, jobNumItems);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_numWorkersInJob--;
+			if (m_numWorkersInJob == 0) {
+				m_jobDone.notify_one();
+			}
+		}
+	}
+}
+
+void ThreadPool::executeItems(const std::function<void(int iItem)>& fn, const int numItems) {
+	for (int iItem = m_nextItem.fetch_add(1); iItem < numItems; iItem = m_nextItem.fetch_add(1)) {
+		fn(iItem);
+	}
+}
+
+} // namespace sge
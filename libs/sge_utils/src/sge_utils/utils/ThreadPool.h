@@ -0,0 +1,54 @@
+#pragma once
+
+#include "sge_utils/sge_utils.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sge {
+
+/// @brief A set of worker threads that stay alive between the jobs, so they could be used every frame
+/// without paying for creating new threads.
+/// The pool is intended to be used by a single thread at a time (usually the main thread), which also
+/// participates in executing the job.
+struct ThreadPool {
+	/// @param [in] numWorkers the number of worker threads excluding the calling thread. Pass 0 to execute the jobs serially.
+	explicit ThreadPool(const int numWorkers);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	int getNumWorkers() const { return int(m_workers.size()); }
+
+	/// @brief Calls @fn for every item in [0; numItems) spread across the worker threads and the calling thread.
+	/// The function returns after all items are processed. The order of the calls is not specified.
+	void parallelFor(const int numItems, const std::function<void(int iItem)>& fn);
+
+	/// Returns the number of workers that keeps all hardware threads busy when the calling thread participates too.
+	static int getDefaultNumWorkers();
+
+  private:
+	void workerMain();
+	void executeItems(const std::function<void(int iItem)>& fn, const int numItems);
+
+  private:
+	std::vector<std::thread> m_workers;
+
+	std::mutex m_mutex;
+	std::condition_variable m_workersWakeUp;
+	std::condition_variable m_jobDone;
+
+	// The state of the current job, guarded by @m_mutex (except @m_nextItem).
+	const std::function<void(int)>* m_jobFn = nullptr;
+	int m_jobNumItems = 0;
+	uint64 m_jobGeneration = 0; ///< Incremented for every job, the workers use it to know that there is a new job.
+	int m_numWorkersInJob = 0;  ///< The number of workers that haven't finished the current job yet.
+	bool m_shouldQuit = false;
+	std::atomic<int> m_nextItem{0};
+};
+
+} // namespace sge
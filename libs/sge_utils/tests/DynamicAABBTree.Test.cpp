@@ -0,0 +1,214 @@
+#include "sge_utils/math/DynamicAABBTree.h"
+#include "sge_utils/math/Random.h"
+#include "sge_utils/utils/timer.h"
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace sge;
+
+namespace {
+
+AABox3f makeRandomBox(Random& rnd, const float worldSize, const float maxBoxSize) {
+	const vec3f center(rnd.nextInRange(-worldSize, worldSize), rnd.nextInRange(-worldSize, worldSize), rnd.nextInRange(-worldSize, worldSize));
+	const vec3f halfSize(rnd.nextInRange(0.1f, maxBoxSize), rnd.nextInRange(0.1f, maxBoxSize), rnd.nextInRange(0.1f, maxBoxSize));
+	return AABox3f(center - halfSize, center + halfSize);
+}
+
+Frustum makeCameraFrustum(const vec3f& eye, const vec3f& lookAt, const float farDistance) {
+	const mat4f proj = mat4f::getPerspectiveFovRH(deg2rad(60.f), 16.f / 9.f, 0.1f, farDistance, false);
+	const mat4f view = mat4f::getLookAtRH(eye, lookAt, vec3f(0.f, 1.f, 0.f));
+	return Frustum::extractClippingPlanes(proj * view, false);
+}
+
+/// The reference for the frustum queries, tests the box against every plane.
+bool isBoxOutsideFrustum(const Frustum& frustum, const AABox3f& box) {
+	const vec3f center = box.center();
+	const vec3f halfDiagonal = box.halfDiagonal();
+	for (int iPlane = 0; iPlane < 6; ++iPlane) {
+		const Plane& plane = frustum.plane(iPlane);
+		const vec3f normal = plane.norm();
+		const float extent = halfDiagonal.x * fabsf(normal.x) + halfDiagonal.y * fabsf(normal.y) + halfDiagonal.z * fabsf(normal.z);
+		if (plane.Distance(center) + extent < 0.f) {
+			return true;
+		}
+	}
+	return false;
+}
+
+std::vector<int> getSorted(std::vector<int> values) {
+	std::sort(values.begin(), values.end());
+	return values;
+}
+
+} // namespace
+
+TEST_CASE("DynamicAABBTree Proxies and fat boxes") {
+	DynamicAABBTree tree(0.5f);
+	CHECK(tree.getHeight() == -1);
+	CHECK(tree.validate());
+
+	const int proxyA = tree.createProxy(AABox3f(vec3f(0.f), vec3f(1.f)), 10);
+	const int proxyB = tree.createProxy(AABox3f(vec3f(5.f), vec3f(6.f)), 20);
+	CHECK(tree.getNumProxies() == 2);
+	CHECK(tree.getHeight() == 1);
+	CHECK(tree.getUserData(proxyA) == 10);
+	CHECK(tree.getUserData(proxyB) == 20);
+	CHECK(tree.getFatBox(proxyA).min == vec3f(-0.5f));
+	CHECK(tree.getFatBox(proxyA).max == vec3f(1.5f));
+
+	// Moving inside of the fat box doesn't change the tree.
+	CHECK(tree.moveProxy(proxyA, AABox3f(vec3f(0.3f), vec3f(1.3f))) == false);
+	CHECK(tree.moveProxy(proxyA, AABox3f(vec3f(3.f), vec3f(4.f))) == true);
+	CHECK(tree.getFatBox(proxyA).min == vec3f(2.5f));
+	CHECK(tree.validate());
+
+	std::vector<int> found;
+	tree.queryBox(AABox3f(vec3f(3.2f), vec3f(3.4f)), found);
+	CHECK(found == std::vector<int>{10});
+
+	tree.destroyProxy(proxyA);
+	CHECK(tree.getNumProxies() == 1);
+	CHECK(tree.validate());
+
+	// The freed nodes get reused.
+	const int proxyC = tree.createProxy(AABox3f(vec3f(-3.f), vec3f(-2.f)), 30);
+	CHECK(proxyC <= 2);
+	CHECK(tree.validate());
+
+	tree.clear();
+	CHECK(tree.getNumProxies() == 0);
+	CHECK(tree.getHeight() == -1);
+}
+
+TEST_CASE("DynamicAABBTree Queries match the brute force") {
+	Random rnd(7);
+	DynamicAABBTree tree(0.25f);
+
+	const int numObjects = 2000;
+	std::vector<int> proxies(numObjects, DynamicAABBTree::kNullNode);
+	for (int iObject = 0; iObject < numObjects; ++iObject) {
+		proxies[iObject] = tree.createProxy(makeRandomBox(rnd, 100.f, 3.f), iObject);
+	}
+	REQUIRE(tree.validate());
+
+	// A balanced tree of 2000 leaves has a height of about 11.
+	CHECK(tree.getHeight() <= 24);
+
+	for (int iFrame = 0; iFrame < 20; ++iFrame) {
+		// Move, remove and re-add some of the objects.
+		for (int iChange = 0; iChange < 100; ++iChange) {
+			const int iObject = rnd.nextInt() % numObjects;
+			if (iChange % 3 == 0) {
+				tree.destroyProxy(proxies[iObject]);
+				proxies[iObject] = tree.createProxy(makeRandomBox(rnd, 100.f, 3.f), iObject);
+			} else {
+				AABox3f box = tree.getFatBox(proxies[iObject]);
+				box.move(vec3f(rnd.nextSnorm(), rnd.nextSnorm(), rnd.nextSnorm()) * 2.f);
+				tree.moveProxy(proxies[iObject], box);
+			}
+		}
+		REQUIRE(tree.validate());
+		REQUIRE(tree.getNumProxies() == numObjects);
+
+		// The camera orbits around the center, the planes cached by the previous frames must not change the result.
+		const float angle = float(iFrame) * 0.3f;
+		const vec3f eye(cosf(angle) * 120.f, 20.f, sinf(angle) * 120.f);
+		const Frustum frustum = makeCameraFrustum(eye, vec3f(0.f), 150.f);
+
+		std::vector<int> expectedInFrustum;
+		for (int iObject = 0; iObject < numObjects; ++iObject) {
+			if (isBoxOutsideFrustum(frustum, tree.getFatBox(proxies[iObject])) == false) {
+				expectedInFrustum.push_back(iObject);
+			}
+		}
+
+		std::vector<int> inFrustum;
+		tree.queryFrustum(frustum, inFrustum);
+		CHECK(getSorted(inFrustum) == expectedInFrustum);
+		CHECK(expectedInFrustum.size() > 0);
+		CHECK(expectedInFrustum.size() < size_t(numObjects));
+
+		const AABox3f queryBox = makeRandomBox(rnd, 80.f, 20.f);
+		std::vector<int> expectedInBox;
+		for (int iObject = 0; iObject < numObjects; ++iObject) {
+			if (tree.getFatBox(proxies[iObject]).overlaps(queryBox)) {
+				expectedInBox.push_back(iObject);
+			}
+		}
+
+		std::vector<int> inBox;
+		tree.queryBox(queryBox, inBox);
+		CHECK(getSorted(inBox) == expectedInBox);
+	}
+}
+
+TEST_CASE("DynamicAABBTree Benchmark 200k objects with a moving camera" * doctest::skip()) {
+	const int numObjects = 200000;
+	const int numFrames = 100;
+	const int numMovingObjects = 2000;
+
+	Random rnd(3);
+	std::vector<AABox3f> boxes(numObjects);
+	for (AABox3f& box : boxes) {
+		// Place the objects on the ground.
+		box = makeRandomBox(rnd, 2000.f, 2.f);
+		box.move(vec3f(0.f, -box.min.y, 0.f));
+	}
+
+	// The static objects go in a tree without margin, the moving ones in a separate one with fat boxes.
+	Timer timer;
+	DynamicAABBTree staticTree(0.f);
+	DynamicAABBTree dynamicTree(1.f);
+	std::vector<int> dynamicProxies;
+	for (int iObject = 0; iObject < numObjects; ++iObject) {
+		if (iObject < numMovingObjects) {
+			dynamicProxies.push_back(dynamicTree.createProxy(boxes[iObject], iObject));
+		} else {
+			staticTree.createProxy(boxes[iObject], iObject);
+		}
+	}
+	timer.tick();
+	const float buildSeconds = timer.diff_seconds();
+
+	size_t numVisibleBruteForce = 0;
+	size_t numVisibleTree = 0;
+	float bruteForceSeconds = 0.f;
+	float treeSeconds = 0.f;
+	std::vector<int> visible;
+	for (int iFrame = 0; iFrame < numFrames; ++iFrame) {
+		const vec3f eye(float(iFrame) * 20.f - 1000.f, 30.f, 0.f);
+		const Frustum frustum = makeCameraFrustum(eye, eye + vec3f(1.f, -0.1f, 0.5f), 500.f);
+
+		for (int iObject = 0; iObject < numMovingObjects; ++iObject) {
+			boxes[iObject].move(vec3f(0.1f, 0.f, 0.05f));
+		}
+
+		// Brute force, a sphere test for every object like the drawer did.
+		timer.tick();
+		for (const AABox3f& box : boxes) {
+			if (frustum.isSphereOutside(box.center(), box.halfDiagonal().length()) == false) {
+				numVisibleBruteForce++;
+			}
+		}
+		timer.tick();
+		bruteForceSeconds += timer.diff_seconds();
+
+		for (int iObject = 0; iObject < numMovingObjects; ++iObject) {
+			dynamicTree.moveProxy(dynamicProxies[iObject], boxes[iObject]);
+		}
+		visible.clear();
+		staticTree.queryFrustum(frustum, visible);
+		dynamicTree.queryFrustum(frustum, visible);
+		numVisibleTree += visible.size();
+		timer.tick();
+		treeSeconds += timer.diff_seconds();
+	}
+
+	CHECK(numVisibleTree > 0);
+	MESSAGE(numObjects << " objects, build: " << buildSeconds * 1000.f << "ms. Per frame brute force: " << bruteForceSeconds * 1000.f / numFrames
+	                   << "ms (" << numVisibleBruteForce / numFrames << " visible), tree with updates: " << treeSeconds * 1000.f / numFrames
+	                   << "ms (" << numVisibleTree / numFrames << " visible)");
+}
@@ -0,0 +1,178 @@
+#include "sge_utils/math/FrustumCulling.h"
+#include "sge_utils/math/Random.h"
+#include "sge_utils/utils/timer.h"
+#include "doctest/doctest.h"
+
+#include <vector>
+
+using namespace sge;
+
+namespace {
+
+AABox3f makeRandomBox(Random& rnd, const float worldSize, const float maxBoxSize) {
+	const vec3f center(rnd.nextInRange(-worldSize, worldSize), rnd.nextInRange(-worldSize, worldSize), rnd.nextInRange(-worldSize, worldSize));
+	const vec3f halfSize(rnd.nextInRange(0.f, maxBoxSize), rnd.nextInRange(0.f, maxBoxSize), rnd.nextInRange(0.f, maxBoxSize));
+	return AABox3f(center - halfSize, center + halfSize);
+}
+
+/// A few frustums, the orthographic ones have planes with zero components in their normals.
+std::vector<Frustum> makeTestFrustums() {
+	std::vector<Frustum> frustums;
+
+	const mat4f persp = mat4f::getPerspectiveFovRH(deg2rad(60.f), 16.f / 9.f, 0.1f, 80.f, false);
+	frustums.push_back(Frustum::extractClippingPlanes(persp * mat4f::getLookAtRH(vec3f(0.f, 10.f, 50.f), vec3f(0.f), vec3f(0.f, 1.f, 0.f)), false));
+	frustums.push_back(Frustum::extractClippingPlanes(persp * mat4f::getLookAtRH(vec3f(-30.f, 5.f, -10.f), vec3f(20.f, -3.f, 7.f), vec3f(0.f, 1.f, 0.f)), true));
+
+	const mat4f ortho = mat4f::getOrthoRH(40.f, 30.f, 0.f, 100.f, false);
+	frustums.push_back(Frustum::extractClippingPlanes(ortho * mat4f::getLookAtRH(vec3f(0.f, 0.f, 50.f), vec3f(0.f), vec3f(0.f, 1.f, 0.f)), false));
+
+	return frustums;
+}
+
+} // namespace
+
+TEST_CASE("FrustumCulling Boxes match Frustum::isBoxOutside") {
+	Random rnd(11);
+
+	// Sizes that aren't multiple of the SIMD width test the scalar tail.
+	for (const int numBoxes : {0, 1, 3, 4, 7, 1001}) {
+		AABoxesSoA boxes;
+		for (int iBox = 0; iBox < numBoxes; ++iBox) {
+			boxes.add(makeRandomBox(rnd, 60.f, 10.f));
+		}
+		REQUIRE(boxes.size() == numBoxes);
+
+		for (const Frustum& frustum : makeTestFrustums()) {
+			std::vector<int> expected = {-1};
+			for (int iBox = 0; iBox < numBoxes; ++iBox) {
+				if (frustum.isBoxOutside(boxes.get(iBox)) == false) {
+					expected.push_back(iBox);
+				}
+			}
+
+			// The result must be appended after the existing elements.
+			std::vector<int> visible = {-1};
+			cullBoxes(frustum, boxes, visible);
+			CHECK(visible == expected);
+		}
+	}
+
+	// Boxes touching the planes.
+	AABoxesSoA touchingBoxes;
+	touchingBoxes.add(AABox3f(vec3f(20.f, -1.f, -1.f), vec3f(21.f, 1.f, 1.f)));
+	touchingBoxes.add(AABox3f(vec3f(20.0001f, -1.f, -1.f), vec3f(21.f, 1.f, 1.f)));
+	touchingBoxes.add(AABox3f(vec3f(-1.f, 15.f, -1.f), vec3f(1.f, 16.f, 1.f)));
+	touchingBoxes.add(AABox3f(vec3f(-1.f, -1.f, -51.f), vec3f(1.f, 1.f, -50.f)));
+	touchingBoxes.add(AABox3f(vec3f(-1.f, -1.f, 50.f), vec3f(1.f, 1.f, 51.f)));
+	const Frustum orthoFrustum = makeTestFrustums().back();
+
+	std::vector<int> expected;
+	for (int iBox = 0; iBox < touchingBoxes.size(); ++iBox) {
+		if (orthoFrustum.isBoxOutside(touchingBoxes.get(iBox)) == false) {
+			expected.push_back(iBox);
+		}
+	}
+
+	std::vector<int> visible;
+	cullBoxes(orthoFrustum, touchingBoxes, visible);
+	CHECK(visible == expected);
+}
+
+TEST_CASE("FrustumCulling Spheres match Frustum::isSphereOutside") {
+	Random rnd(5);
+
+	for (const int numSpheres : {0, 2, 4, 9, 1003}) {
+		SpheresSoA spheres;
+		for (int iSphere = 0; iSphere < numSpheres; ++iSphere) {
+			spheres.add(vec3f(rnd.nextInRange(-60.f, 60.f), rnd.nextInRange(-60.f, 60.f), rnd.nextInRange(-60.f, 60.f)),
+			            rnd.nextInRange(0.f, 10.f));
+		}
+		REQUIRE(spheres.size() == numSpheres);
+
+		for (const Frustum& frustum : makeTestFrustums()) {
+			std::vector<int> expected;
+			for (int iSphere = 0; iSphere < numSpheres; ++iSphere) {
+				const vec3f center(spheres.centerX[iSphere], spheres.centerY[iSphere], spheres.centerZ[iSphere]);
+				if (frustum.isSphereOutside(center, spheres.radius[iSphere]) == false) {
+					expected.push_back(iSphere);
+				}
+			}
+
+			std::vector<int> visible;
+			cullSpheres(frustum, spheres, visible);
+			CHECK(visible == expected);
+		}
+	}
+}
+
+TEST_CASE("FrustumCulling Benchmark 1M bounds" * doctest::skip()) {
+	const int numBounds = 1000000;
+	const int numRepeats = 20;
+
+	Random rnd(1);
+	std::vector<AABox3f> boxesAoS;
+	AABoxesSoA boxes;
+	SpheresSoA spheres;
+	boxes.reserve(numBounds);
+	spheres.reserve(numBounds);
+	for (int t = 0; t < numBounds; ++t) {
+		const AABox3f box = makeRandomBox(rnd, 500.f, 3.f);
+		boxesAoS.push_back(box);
+		boxes.add(box);
+		spheres.add(box.center(), box.halfDiagonal().length());
+	}
+
+	const mat4f proj = mat4f::getPerspectiveFovRH(deg2rad(60.f), 16.f / 9.f, 0.1f, 400.f, false);
+	const Frustum frustum = Frustum::extractClippingPlanes(proj * mat4f::getLookAtRH(vec3f(0.f, 20.f, 300.f), vec3f(0.f), vec3f(0.f, 1.f, 0.f)), false);
+
+	std::vector<int> visible;
+	visible.reserve(numBounds);
+	Timer timer;
+
+	size_t numVisibleScalarBoxes = 0;
+	timer.tick();
+	for (int iRepeat = 0; iRepeat < numRepeats; ++iRepeat) {
+		for (const AABox3f& box : boxesAoS) {
+			numVisibleScalarBoxes += frustum.isBoxOutside(box) ? 0 : 1;
+		}
+	}
+	timer.tick();
+	const float scalarBoxesMs = timer.diff_seconds() * 1000.f / numRepeats;
+
+	size_t numVisibleScalarSpheres = 0;
+	timer.tick();
+	for (int iRepeat = 0; iRepeat < numRepeats; ++iRepeat) {
+		for (int t = 0; t < numBounds; ++t) {
+			const vec3f center(spheres.centerX[t], spheres.centerY[t], spheres.centerZ[t]);
+			numVisibleScalarSpheres += frustum.isSphereOutside(center, spheres.radius[t]) ? 0 : 1;
+		}
+	}
+	timer.tick();
+	const float scalarSpheresMs = timer.diff_seconds() * 1000.f / numRepeats;
+
+	size_t numVisibleBatchBoxes = 0;
+	timer.tick();
+	for (int iRepeat = 0; iRepeat < numRepeats; ++iRepeat) {
+		visible.clear();
+		cullBoxes(frustum, boxes, visible);
+		numVisibleBatchBoxes += visible.size();
+	}
+	timer.tick();
+	const float batchBoxesMs = timer.diff_seconds() * 1000.f / numRepeats;
+
+	size_t numVisibleBatchSpheres = 0;
+	timer.tick();
+	for (int iRepeat = 0; iRepeat < numRepeats; ++iRepeat) {
+		visible.clear();
+		cullSpheres(frustum, spheres, visible);
+		numVisibleBatchSpheres += visible.size();
+	}
+	timer.tick();
+	const float batchSpheresMs = timer.diff_seconds() * 1000.f / numRepeats;
+
+	CHECK(numVisibleBatchBoxes == numVisibleScalarBoxes);
+	CHECK(numVisibleBatchSpheres == numVisibleScalarSpheres);
+	MESSAGE(numBounds << " bounds, boxes: scalar " << scalarBoxesMs << "ms, batched " << batchBoxesMs << "ms ("
+	                  << numVisibleBatchBoxes / numRepeats << " visible). Spheres: scalar " << scalarSpheresMs << "ms, batched "
+	                  << batchSpheresMs << "ms (" << numVisibleBatchSpheres / numRepeats << " visible)");
+}
@@ -0,0 +1,208 @@
+#include "sge_utils/math/ShadowCascades.h"
+#include "sge_utils/math/common.h"
+#include "doctest/doctest.h"
+
+#include <cmath>
+
+using namespace sge;
+
+namespace {
+
+/// A perspective camera looking along @lookDir, computes the corners of its frustum in the order of @Frustum::getCorners.
+struct TestCamera {
+	vec3f position = vec3f(0.f);
+	vec3f lookDir = vec3f(0.f, 0.f, -1.f);
+	float fovY = deg2rad(60.f);
+	float aspect = 16.f / 9.f;
+	float nearDist = 0.1f;
+	float farDist = 100.f;
+
+	void getCorners(vec3f corners[8]) const {
+		const vec3f right = normalized(cross(lookDir, vec3f(0.f, 1.f, 0.f)));
+		const vec3f up = cross(right, lookDir);
+
+		const float distances[2] = {nearDist, farDist};
+		for (int iPlane = 0; iPlane < 2; ++iPlane) {
+			const float halfHeight = tanf(fovY * 0.5f) * distances[iPlane];
+			const float halfWidth = halfHeight * aspect;
+			const vec3f center = position + lookDir * distances[iPlane];
+
+			corners[iPlane * 4 + 0] = center + up * halfHeight + right * halfWidth;
+			corners[iPlane * 4 + 1] = center + up * halfHeight - right * halfWidth;
+			corners[iPlane * 4 + 2] = center - up * halfHeight - right * halfWidth;
+			corners[iPlane * 4 + 3] = center - up * halfHeight + right * halfWidth;
+		}
+	}
+
+	void fit(const mat4f& lightView, const ShadowCascadesSettings& settings, ShadowCascade cascades[kMaxShadowCascades]) const {
+		vec3f corners[8];
+		getCorners(corners);
+		fitShadowCascades(corners, nearDist, farDist, lightView, settings, true, cascades);
+	}
+};
+
+mat4f getTestLightView() {
+	return mat4f::getLookAtRH(vec3f(0.f), vec3f(-0.3f, -1.f, -0.2f), vec3f(1.f, 0.f, 0.f));
+}
+
+/// Returns the coordinates of the point in the shadow map texels of the cascade.
+vec2f getTexelCoords(const ShadowCascade& cascade, const mat4f& lightView, const int resolution, const vec3f& pointWs) {
+	const vec3f ndc = mat_mul_pos(cascade.proj * lightView, pointWs);
+	return vec2f(ndc.x * 0.5f + 0.5f, ndc.y * 0.5f + 0.5f) * float(resolution);
+}
+
+} // namespace
+
+TEST_CASE("ShadowCascades Practical split scheme") {
+	float splits[kMaxShadowCascades];
+
+	computeShadowCascadeSplits(1.f, 1000.f, 3, 0.f, splits);
+	CHECK(splits[0] == doctest::Approx(334.f));
+	CHECK(splits[1] == doctest::Approx(667.f));
+	CHECK(splits[2] == 1000.f);
+
+	computeShadowCascadeSplits(1.f, 1000.f, 3, 1.f, splits);
+	CHECK(splits[0] == doctest::Approx(10.f));
+	CHECK(splits[1] == doctest::Approx(100.f));
+	CHECK(splits[2] == 1000.f);
+
+	// The practical splits are between the two.
+	computeShadowCascadeSplits(1.f, 1000.f, 4, 0.75f, splits);
+	for (int t = 0; t < 4; ++t) {
+		const float p = float(t + 1) / 4.f;
+		CHECK(splits[t] >= powf(1000.f, p) - 1e-3f);
+		CHECK(splits[t] <= 1.f + 999.f * p + 1e-3f);
+		if (t > 0) {
+			CHECK(splits[t] > splits[t - 1]);
+		}
+	}
+	CHECK(splits[3] == 1000.f);
+
+	computeShadowCascadeSplits(0.5f, 50.f, 1, 0.75f, splits);
+	CHECK(splits[0] == 50.f);
+}
+
+TEST_CASE("ShadowCascades The cascades contain their frustum slices") {
+	const mat4f lightView = getTestLightView();
+
+	ShadowCascadesSettings settings;
+	settings.numCascades = 4;
+	settings.resolution = 1024;
+
+	TestCamera camera;
+	camera.position = vec3f(3.f, 2.f, -7.f);
+	camera.lookDir = normalized(vec3f(1.f, -0.2f, -1.f));
+
+	ShadowCascade cascades[kMaxShadowCascades];
+	camera.fit(lightView, settings, cascades);
+
+	vec3f frustumCorners[8];
+	camera.getCorners(frustumCorners);
+
+	CHECK(cascades[0].splitNear == 0.f);
+	CHECK(cascades[3].splitFar == camera.farDist);
+
+	for (int iCascade = 0; iCascade < settings.numCascades; ++iCascade) {
+		const ShadowCascade& cascade = cascades[iCascade];
+
+		// The cascade covers its slice and the blended end of the previous cascade.
+		float sliceNear = camera.nearDist;
+		if (iCascade > 0) {
+			const ShadowCascade& prev = cascades[iCascade - 1];
+			CHECK(cascade.splitNear == prev.splitFar);
+			sliceNear = prev.splitFar - (prev.splitFar - prev.splitNear) * settings.blendFraction;
+		}
+
+		vec3f sliceCorners[8];
+		computeFrustumSliceCorners(frustumCorners, camera.nearDist, camera.farDist, sliceNear, cascade.splitFar, sliceCorners);
+
+		for (const vec3f& corner : sliceCorners) {
+			// Both projections must see the whole slice.
+			const mat4f projs[2] = {cascade.proj, cascade.cullingProj};
+			for (const mat4f& proj : projs) {
+				const vec3f ndc = mat_mul_pos(proj * lightView, corner);
+				CHECK(fabsf(ndc.x) <= 1.f);
+				CHECK(fabsf(ndc.y) <= 1.f);
+				CHECK(ndc.z >= 0.f);
+				CHECK(ndc.z <= 1.f);
+			}
+		}
+
+		// A cascade could be sampled using the projection of the first cascade.
+		const vec4f ndcTransform = computeShadowCascadeNdcTransform(cascades[0], cascade);
+		CHECK(ndcTransform.w == cascade.splitFar);
+
+		for (const vec3f& corner : sliceCorners) {
+			const vec3f ndcBase = mat_mul_pos(cascades[0].proj * lightView, corner);
+			const vec3f ndc = mat_mul_pos(cascade.proj * lightView, corner);
+			CHECK(ndcBase.x * ndcTransform.x + ndcTransform.y == doctest::Approx(ndc.x).epsilon(1e-4f));
+			CHECK(ndcBase.y * ndcTransform.x + ndcTransform.z == doctest::Approx(ndc.y).epsilon(1e-4f));
+			CHECK(ndcBase.z == doctest::Approx(ndc.z));
+		}
+	}
+}
+
+TEST_CASE("ShadowCascades The texels stay in place when the camera moves") {
+	const mat4f lightView = getTestLightView();
+
+	ShadowCascadesSettings settings;
+	settings.numCascades = 3;
+	settings.resolution = 2048;
+
+	TestCamera camera;
+	camera.position = vec3f(1.f, 1.7f, 2.f);
+	camera.lookDir = normalized(vec3f(0.f, -0.1f, -1.f));
+
+	ShadowCascade initialCascades[kMaxShadowCascades];
+	camera.fit(lightView, settings, initialCascades);
+
+	// A point visible in all cascades.
+	const vec3f pointWs = camera.position + camera.lookDir * 3.f;
+	vec2f initialTexelCoords[kMaxShadowCascades];
+	for (int iCascade = 0; iCascade < settings.numCascades; ++iCascade) {
+		initialTexelCoords[iCascade] = getTexelCoords(initialCascades[iCascade], lightView, settings.resolution, pointWs);
+	}
+
+	// Move the camera by amounts that aren't multiple of the texel size.
+	for (int iStep = 1; iStep <= 20; ++iStep) {
+		camera.position += vec3f(0.0137f, 0.0031f, -0.0291f);
+
+		ShadowCascade cascades[kMaxShadowCascades];
+		camera.fit(lightView, settings, cascades);
+
+		for (int iCascade = 0; iCascade < settings.numCascades; ++iCascade) {
+			const ShadowCascade& cascade = cascades[iCascade];
+			CHECK(cascade.radius == initialCascades[iCascade].radius);
+			CHECK(cascade.texelSize == initialCascades[iCascade].texelSize);
+
+			// The point moves only by whole texels inside of the shadow map.
+			const vec2f texelCoords = getTexelCoords(cascade, lightView, settings.resolution, pointWs);
+			const vec2f moved = texelCoords - initialTexelCoords[iCascade];
+			CHECK(fabsf(moved.x - roundf(moved.x)) < 0.01f);
+			CHECK(fabsf(moved.y - roundf(moved.y)) < 0.01f);
+		}
+	}
+}
+
+TEST_CASE("ShadowCascades The texel size doesn't change when the camera rotates") {
+	const mat4f lightView = getTestLightView();
+
+	ShadowCascadesSettings settings;
+	settings.numCascades = 4;
+
+	TestCamera camera;
+	ShadowCascade initialCascades[kMaxShadowCascades];
+	camera.fit(lightView, settings, initialCascades);
+
+	for (int iStep = 1; iStep <= 12; ++iStep) {
+		const float angle = float(iStep) * 0.37f;
+		camera.lookDir = normalized(vec3f(sinf(angle), -0.3f, cosf(angle)));
+
+		ShadowCascade cascades[kMaxShadowCascades];
+		camera.fit(lightView, settings, cascades);
+
+		for (int iCascade = 0; iCascade < settings.numCascades; ++iCascade) {
+			CHECK(cascades[iCascade].radius == initialCascades[iCascade].radius);
+		}
+	}
+}
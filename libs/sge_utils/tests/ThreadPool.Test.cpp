@@ -0,0 +1,37 @@
+#include "sge_utils/utils/ThreadPool.h"
+#include "doctest/doctest.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace sge;
+
+TEST_CASE("ThreadPool Every item is processed exactly once") {
+	for (const int numWorkers : {0, 1, 3}) {
+		ThreadPool pool(numWorkers);
+		CHECK(pool.getNumWorkers() == numWorkers);
+
+		// Run multiple jobs to check that the workers correctly pick up the next one.
+		for (const int numItems : {0, 1, 2, 7, 1000}) {
+			std::vector<std::atomic<int>> numCallsPerItem(numItems);
+			for (std::atomic<int>& numCalls : numCallsPerItem) {
+				numCalls = 0;
+			}
+
+			pool.parallelFor(numItems, [&](const int iItem) -> void { numCallsPerItem[iItem]++; });
+
+			for (int iItem = 0; iItem < numItems; ++iItem) {
+				CHECK(numCallsPerItem[iItem] == 1);
+			}
+		}
+	}
+}
+
+TEST_CASE("ThreadPool Many short jobs") {
+	ThreadPool pool(3);
+	std::atomic<int> sum(0);
+	for (int iJob = 0; iJob < 500; ++iJob) {
+		pool.parallelFor(8, [&](const int iItem) -> void { sum += iItem; });
+	}
+	CHECK(sum == 500 * 28);
+}
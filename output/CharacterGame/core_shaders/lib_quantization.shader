@@ -0,0 +1,14 @@
+#ifndef SGE_LIB_QUANTIZATION
+#define SGE_LIB_QUANTIZATION
+
+/// Decodes a unit vector stored with octahedral encoding (see MeshQuantizer::octahedralEncode).
+/// @param e the encoded vector, each component is in [-1;1].
+float3 libQuantization_octahedralDecode(float2 e) {
+	float3 n = float3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+	const float t = max(-n.z, 0.0);
+	n.x += (n.x >= 0.0) ? -t : t;
+	n.y += (n.y >= 0.0) ? -t : t;
+	return normalize(n);
+}
+
+#endif
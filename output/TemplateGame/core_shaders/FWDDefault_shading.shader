@@ -0,0 +1,596 @@
+#include "ShadeCommon.h"
+
+#define PI 3.14159265f
+
+#if OPT_HasVertexSkinning == kHasVertexSkinning_Yes
+	#include "lib_skinning.shader"
+#endif
+
+#if OPT_Instancing == kInstancing_Yes
+	#include "lib_instancing.shader"
+#endif
+
+#if OPT_Lighting != kLightingForceNoLighting
+	#include "lib_pbr.shader"
+#endif
+
+#if OPT_Lighting == kLightingClustered
+	#include "lib_light_clusters.shader"
+#endif
+
+#if OPT_NormalEncoding == kNormalEncoding_Octahedral
+	#include "lib_quantization.shader"
+#endif
+
+//--------------------------------------------------------------------
+// Uniforms
+//--------------------------------------------------------------------
+
+// https://docs.microsoft.com/en-us/windows/win32/direct3dhlsl/dx-graphics-hlsl-packing-rules?redirectedfrom=MSDN
+cbuffer ParamsCbFWDDefaultShading {
+	float4x4 projView;
+	float4x4 world;
+	float4x4 uvwTransform;
+	float4 cameraPositionWs;
+	float4 uCameraLookDirWs;
+
+	float4 uiHighLightColor;
+	float4 uDiffuseColorTint;
+	float3 texDiffuseXYZScaling;
+	float uMetalness;
+	
+	float uRoughness;
+	int uPBRMtlFlags;
+
+	float4 uRimLightColorWWidth;
+	float3 ambientLightColor;
+
+	// Lights uniforms.
+	float4 lightPosition;           // Position, w encodes the type of the light.
+	float4 lightSpotDirAndCosAngle; // all Used in spot lights :( other lights do not use it
+	float4 lightColorWFlag;         // w used for flags.
+	
+	float4x4 lightShadowMapProjView;
+	float4 lightShadowRange; // x - range, y - number of shadow map cascades (0 if not cascaded), z - cascades blend fraction.
+
+	// Skinning.
+	int uSkinningFirstBoneOffsetInTex; ///< The row (integer) in @uSkinningBones of the fist bone for the mesh that is being drawn.
+
+	// Instancing.
+	int uInstancingFirstRowInTex; ///< The row (integer) in @uInstanceData of the 1st instance that is being drawn.
+
+	// Clustered lighting.
+	int uEvalClusteredLights; ///< Non-zero if the lights of the clusters should be added, only the 1st pass of the draw call does it.
+
+	// Vertex attributes dequantization, identity if the mesh isn't quantized.
+	float4 uPositionDequantScale;
+	float4 uPositionDequantOffset;
+	float4 uUvDequantScaleOffset; ///< xy is the scale, zw is the offset.
+
+	// Clustered lighting, see lib_light_clusters.shader.
+	float4 uLightClustersGridSize;
+	float4 uLightClustersDepthParams;
+
+	// Cascaded shadow maps, see getShadowCascade.
+	float4 uShadowCascade0;
+	float4 uShadowCascade1;
+	float4 uShadowCascade2;
+	float4 uShadowCascade3;
+};
+
+// Material.
+uniform sampler2D uTexNormalMap;
+uniform sampler2D uTexMetalness;
+uniform sampler2D uTexRoughness;
+
+#if OPT_DiffuseColorSrc == kDiffuseColorSrcTexture
+uniform sampler2D texDiffuse;
+#elif OPT_DiffuseColorSrc == kDiffuseColorSrcConstant
+// nothing, we use the color
+#elif OPT_DiffuseColorSrc == kDiffuseColorSrcTriplanarTex
+uniform sampler2D texDiffuseX;
+uniform sampler2D texDiffuseY;
+uniform sampler2D texDiffuseZ;
+#endif
+
+// Shadows.
+sampler2D lightShadowMap;
+uniform samplerCUBE uPointLightShadowMap;
+
+// Skinning.
+#if OPT_HasVertexSkinning == kHasVertexSkinning_Yes
+	uniform sampler2D uSkinningBones;
+#endif
+
+// Instancing.
+#if OPT_Instancing == kInstancing_Yes
+	uniform sampler2D uInstanceData;
+#endif
+
+// Clustered lighting.
+#if OPT_Lighting == kLightingClustered
+	uniform sampler2D uLightClusters;
+	uniform sampler2D uLightClusterIndices;
+	uniform sampler2D uClusteredLights;
+#endif
+
+//--------------------------------------------------------------------
+//
+//--------------------------------------------------------------------
+float2 directionToUV_Spherical(float3 dir)
+{
+	const float2 invAtan = float2(0.1591, 0.3183);
+    float2 uv = float2(atan2(dir.z, dir.x), asin(-dir.y));
+    uv *= invAtan;
+    uv += float2(0.5, 0.5);
+    return uv;
+}
+
+//--------------------------------------------------------------------
+// Shadows
+//--------------------------------------------------------------------
+float2 shadowNdcToUv(float2 ndc) {
+#ifndef OpenGL
+	return ndc * float2(0.5, -0.5) + float2(0.5, 0.5);
+#else
+	return ndc * float2(0.5, 0.5) + float2(0.5, 0.5);
+#endif
+}
+
+/// Returns the fraction of the PCF samples around @uv that are in shadow.
+/// The samples are clamped to [uvMin;uvMax], the area of the shadow map that is being sampled.
+float sampleShadowMapPCF(sampler2D shadowMap, float2 uv, float2 uvMin, float2 uvMax, float currentZ) {
+	const float2 pixelSizeUVShadow = (1.0 / tex2Dsize(shadowMap));
+
+	float samplesInShadow = 0.f;
+	const int pcfWidth = 1;
+	const int pcfTotalSamples = (2 * pcfWidth + 1) * (2 * pcfWidth + 1);
+	for (int ix = -pcfWidth; ix <= pcfWidth; ix += 1) {
+		for (int iy = -pcfWidth; iy <= pcfWidth; iy += 1) {
+			const float2 sampleUv = clamp(uv + float2(float(ix) * pixelSizeUVShadow.x, float(iy) * pixelSizeUVShadow.y), uvMin, uvMax);
+			const float shadowZ = tex2D(shadowMap, sampleUv).x;
+			if (shadowZ < currentZ) {
+				samplesInShadow += 1.f;
+			}
+		}
+	}
+
+	return samplesInShadow / (float)(pcfTotalSamples);
+}
+
+/// Returns the parameters of a cascade of a cascaded shadow map, see @computeShadowCascadeNdcTransform.
+/// (x, y, z) transform the normalized device coordinates of @lightShadowMapProjView to the cascade: ndc * x + (y, z).
+/// w is the view distance where the cascade ends.
+float4 getShadowCascade(int iCascade) {
+	if (iCascade == 0) {
+		return uShadowCascade0;
+	} else if (iCascade == 1) {
+		return uShadowCascade1;
+	} else if (iCascade == 2) {
+		return uShadowCascade2;
+	}
+	return uShadowCascade3;
+}
+
+/// Returns the fraction of the PCF samples in shadow for the specified cascade.
+/// The cascades are placed next to each other in the shadow map texture.
+float sampleShadowCascade(float2 ndc, int iCascade, int numCascades, float currentZ) {
+	const float4 cascade = getShadowCascade(iCascade);
+	float2 uv = shadowNdcToUv(ndc * cascade.x + cascade.yz);
+	uv.x = (uv.x + float(iCascade)) / float(numCascades);
+
+	// Do not let the PCF samples leak into the neighbouring cascades.
+	const float2 halfPixelSizeUV = 0.5 / tex2Dsize(lightShadowMap);
+	const float2 uvMin = float2(float(iCascade) / float(numCascades) + halfPixelSizeUV.x, halfPixelSizeUV.y);
+	const float2 uvMax = float2(float(iCascade + 1) / float(numCascades) - halfPixelSizeUV.x, 1.0 - halfPixelSizeUV.y);
+
+	return sampleShadowMapPCF(lightShadowMap, uv, uvMin, uvMax, currentZ);
+}
+
+//--------------------------------------------------------------------
+// Vertex Shader
+//--------------------------------------------------------------------
+struct VS_INPUT {
+	float3 a_position : a_position;
+
+#if (OPT_UseNormalMap == 1) || (OPT_DiffuseColorSrc == kDiffuseColorSrcTexture)
+	float2 a_uv : a_uv;
+#endif
+
+#if OPT_NormalEncoding == kNormalEncoding_Octahedral
+	float2 a_normal : a_normal;
+	#if OPT_UseNormalMap == 1
+	float2 a_tangent : a_tangent;
+	float2 a_binormal : a_binormal;
+	#endif
+#else
+	float3 a_normal : a_normal;
+	#if OPT_UseNormalMap == 1
+	float3 a_tangent : a_tangent;
+	float3 a_binormal : a_binormal;
+	#endif
+#endif
+
+#if OPT_DiffuseColorSrc == kDiffuseColorSrcVertex
+	float4 a_color : a_color;
+#endif
+
+#if OPT_HasVertexSkinning == kHasVertexSkinning_Yes
+	int4 a_bonesIds : a_bonesIds;
+	float4 a_bonesWeights : a_bonesWeights;
+#endif
+
+#if OPT_Instancing == kInstancing_Yes
+	int a_instanceId : SV_InstanceID;
+#endif
+};
+
+struct VS_OUTPUT {
+	float4 SV_Position : SV_Position;
+	float3 v_posWS : v_posWS;
+	float3 v_normal : v_normal;
+#if (OPT_UseNormalMap == 1) || (OPT_DiffuseColorSrc == kDiffuseColorSrcTexture)
+	float2 v_uv : v_uv;
+#endif
+
+#if OPT_UseNormalMap == 1
+	float3 v_tangent : v_tangent;
+	float3 v_binormal : v_binormal;
+#endif
+
+#if OPT_DiffuseColorSrc == kDiffuseColorSrcVertex
+	float4 v_vertexDiffuse : v_vertexDiffuse;
+#endif
+
+#if OPT_Instancing == kInstancing_Yes
+	float4 v_instanceTint : v_instanceTint;
+#endif
+};
+
+VS_OUTPUT vsMain(VS_INPUT vsin) {
+	VS_OUTPUT res;
+	
+	float3 vertexPosOs = vsin.a_position * uPositionDequantScale.xyz + uPositionDequantOffset.xyz;
+#if OPT_NormalEncoding == kNormalEncoding_Octahedral
+	float3 normalOs = libQuantization_octahedralDecode(vsin.a_normal);
+	#if OPT_UseNormalMap == 1
+	const float3 tangentOs = libQuantization_octahedralDecode(vsin.a_tangent);
+	const float3 binormalOs = libQuantization_octahedralDecode(vsin.a_binormal);
+	#endif
+#else
+	float3 normalOs = vsin.a_normal;
+	#if OPT_UseNormalMap == 1
+	const float3 tangentOs = vsin.a_tangent;
+	const float3 binormalOs = vsin.a_binormal;
+	#endif
+#endif
+
+	// If there is a skinning avilable apply it to the vertex in object space.
+#if OPT_HasVertexSkinning == kHasVertexSkinning_Yes
+	float4x4 skinMtx = libSkining_getSkinningTransform(vsin.a_bonesIds, uSkinningFirstBoneOffsetInTex, vsin.a_bonesWeights, uSkinningBones);
+	vertexPosOs = mul(skinMtx, float4(vertexPosOs, 1.0)).xyz;
+	normalOs = mul(skinMtx, float4(normalOs, 0.0)).xyz; // TODO: Proper normal transfrom by inverse transpose.
+#endif
+	
+	// When instancing the world transform and the tint of each instance come from the instance data texture.
+#if OPT_Instancing == kInstancing_Yes
+	const int instanceRow = uInstancingFirstRowInTex + vsin.a_instanceId;
+	const float4x4 instanceWorld = libInstancing_getWorld(instanceRow, uInstanceData);
+	res.v_instanceTint = libInstancing_getTint(instanceRow, uInstanceData);
+#else
+	const float4x4 instanceWorld = world;
+#endif
+
+	// Pass the varyings to the next shader.
+	const float4 worldPos = mul(instanceWorld, float4(vertexPosOs, 1.0));
+	const float4 worldNormal = mul(instanceWorld, float4(normalOs, 0.0)); // TODO: Proper normal transfrom by inverse transpose.
+
+	res.v_normal = worldNormal.xyz;
+	res.v_posWS = worldPos.xyz;
+	res.SV_Position = mul(projView, worldPos);
+
+#if OPT_UseNormalMap == 1
+	res.v_tangent = mul(instanceWorld, float4(tangentOs, 0.0)).xyz;
+	res.v_binormal = mul(instanceWorld, float4(binormalOs, 0.0)).xyz;
+#endif
+
+#if (OPT_UseNormalMap == 1) || (OPT_DiffuseColorSrc == kDiffuseColorSrcTexture)
+	const float2 uv = vsin.a_uv * uUvDequantScaleOffset.xy + uUvDequantScaleOffset.zw;
+	res.v_uv = mul(uvwTransform, float4(uv, 0.0, 1.0)).xy;
+#endif
+
+#if OPT_DiffuseColorSrc == kDiffuseColorSrcVertex
+	res.v_vertexDiffuse = vsin.a_color;
+#endif
+
+	return res;
+}
+
+//--------------------------------------------------------------------
+// Pixel Shader
+//--------------------------------------------------------------------
+#ifdef SGE_PIXEL_SHADER
+#if OPT_Lighting != kLightingForceNoLighting
+/// Computes the light reflected towards the viewer by the Cook-Torrance BRDF for a single light.
+float3 shadeGGX(float3 N, float3 V, float3 L, float3 lightRadiance, float3 diffuseColor, float metallic, float roughness, float3 F0) {
+	const float NdotL = max(dot(N, L), 0.0);
+	const float3 H = normalize(V + L);
+
+	const float NDF = DistributionGGX(N, H, roughness);
+	const float G = GeometrySmith(N, V, L, roughness);
+	const float3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);
+
+	const float3 kS = F;
+	const float3 kD = (float3(1.f, 1.f, 1.f) - kS) * (1.0 - metallic);
+
+	const float3 numerator = NDF * G * F;
+	const float denominator = 4.f * max(dot(N, V), 0.f) * NdotL;
+	const float3 specular = numerator / max(denominator, 0.001f);
+
+	return (kD * diffuseColor / PI + specular) * lightRadiance * NdotL;
+}
+#endif
+
+float4 psMain(VS_OUTPUT IN) : SV_Target0 {
+#if OPT_Instancing == kInstancing_Yes
+	float4 diffuseColor = pow(IN.v_instanceTint, 2.2f);
+#else
+	float4 diffuseColor = pow(uDiffuseColorTint, 2.2f);
+#endif
+
+#if OPT_DiffuseColorSrc == kDiffuseColorSrcVertex
+	diffuseColor = IN.v_vertexDiffuse;
+#elif OPT_DiffuseColorSrc == kDiffuseColorSrcTexture
+	diffuseColor *= tex2D(texDiffuse, IN.v_uv);
+	diffuseColor.xyz = pow(diffuseColor.xyz, 2.2f);
+#elif OPT_DiffuseColorSrc == kDiffuseColorSrcConstant
+	// Nothing
+#elif OPT_DiffuseColorSrc == kDiffuseColorSrcTriplanarTex
+	float3 blendWeights = abs(IN.v_normal).xyz;
+	blendWeights = blendWeights - float3(0.2679f, 0.2679f, 0.2679f);
+	blendWeights.x = max(blendWeights.x, 0.0f);
+	blendWeights.y = max(blendWeights.y, 0.0f);
+	blendWeights.z = max(blendWeights.z, 0.0f);
+
+	// Force sum to 1.0
+	const float blendWeightDenom = 1.0f / (blendWeights.x + blendWeights.y + blendWeights.z);
+	blendWeights = blendWeights * blendWeightDenom;
+
+	float4 colorTexX = tex2D(texDiffuseX, (IN.v_posWS.zy * texDiffuseXYZScaling.x));
+	float4 colorTexY = tex2D(texDiffuseY, (IN.v_posWS.xz * texDiffuseXYZScaling.y));
+	float4 colorTexZ = tex2D(texDiffuseZ, (IN.v_posWS.xy * texDiffuseXYZScaling.z));
+
+	diffuseColor *= (colorTexX * blendWeights.xxxx + colorTexY * blendWeights.yyyy + colorTexZ * blendWeights.zzzz);
+	diffuseColor.xyz = pow(diffuseColor.xyz, 2.2f);
+#else
+	#error Not implemented.
+#endif
+
+	if (diffuseColor.w <= 0.0f) {
+		discard;
+	}
+
+	// DOING SHADING HERE
+
+#if OPT_UseNormalMap == 1
+	float3 normalMapNorm = 2.f * tex2D(uTexNormalMap, IN.v_uv).xyz - float3(1.f, 1.f, 1.f);
+	const float3 normalFromNormalMap =
+	    normalize(IN.v_tangent) * normalMapNorm.x + normalize(IN.v_binormal) * normalMapNorm.y + normalize(IN.v_normal) * normalMapNorm.z;
+	const float3 normal = normalize(normalFromNormalMap);
+#else
+	const float3 normal = normalize(IN.v_normal);
+#endif
+
+	// GGX Crap:
+	const float3 N = normalize(normal);
+	const float3 V = normalize(cameraPositionWs.xyz - IN.v_posWS);
+
+	float3 lighting = float3(0.f, 0.f, 0.f);
+#if OPT_Lighting != kLightingForceNoLighting
+	// Lighting.
+	// GGX Material crap:
+	float metallic = uMetalness;
+#if (OPT_UseNormalMap == 1) || (OPT_DiffuseColorSrc == kDiffuseColorSrcTexture)
+	if ((uPBRMtlFlags & kPBRMtl_Flags_HasMetalnessMap) != 0) {
+		metallic *= pow(tex2D(uTexMetalness, IN.v_uv).r, 2.2f);
+	}
+#endif
+
+	float roughness = uRoughness;
+#if (OPT_UseNormalMap == 1) || (OPT_DiffuseColorSrc == kDiffuseColorSrcTexture)
+	if ((uPBRMtlFlags & kPBRMtl_Flags_HasRoughnessMap) != 0) {
+		roughness *= pow(tex2D(uTexRoughness, IN.v_uv).r, 2.2f);
+	}
+#endif
+
+	const float3 F0 = lerp(float3(0.04f, 0.04f, 0.04f), diffuseColor.xyz, metallic);
+
+	const int fLightFlags = (int)lightColorWFlag.w;
+	const bool dontLight = (fLightFlags & kLightFlt_DontLight) != 0;
+	if (dontLight == false) {
+		float3 lightRadiance = float3(0.f, 0.f, 0.f);
+		float3 L = float3(0.f, 0.f, 0.f);
+
+		const float4 lightPosF4 = lightPosition;
+		const float3 lightColor = lightColorWFlag.xyz;
+		const float range2 = lightShadowRange.x * lightShadowRange.x;
+
+
+		if (lightPosF4.w == 0.f) {
+			// Point Light.
+			const float3 toLightWs = lightPosF4.xyz - IN.v_posWS;
+			float k = 1.f - lerp(0.f, 1.f, saturate(dot(toLightWs, toLightWs) / range2));
+			lightRadiance.xyz = lightColor * saturate(k * k);
+			L = normalize(toLightWs);
+		} else if (lightPosF4.w == 1.f) {
+			// Direction Light.
+			lightRadiance.xyz = lightColor;
+			L = lightPosF4.xyz;
+		} else if (lightPosF4.w == 2.f) {
+			// Spot Light.
+			const float3 toLightWs = lightPosF4.xyz - IN.v_posWS;
+			const float3 revSpotLightDirWs = -lightSpotDirAndCosAngle.xyz;
+			const float spotLightAngleCosine = lightSpotDirAndCosAngle.w;
+			const float visibilityCosine = saturate(dot(normalize(toLightWs), revSpotLightDirWs));
+			const float c = saturate(visibilityCosine - spotLightAngleCosine);
+			const float range = 1.f - spotLightAngleCosine;
+			const float scale = saturate(c / range);
+			const float k = 1.f - lerp(0.f, 1.f, saturate(dot(toLightWs, toLightWs) / range2));
+			lightRadiance.xyz = lightColor * (scale * saturate(k * k));
+			L = normalize(toLightWs);
+		}
+
+		const float NdotL = max(dot(N, L), 0.0);
+
+		const bool useShadowsMap = (fLightFlags & kLightFlg_HasShadowMap) != 0;
+
+		float shadowScale = 1.f;
+#if 1
+		if (useShadowsMap != 0) {
+			if (lightPosF4.w == 0.f) {
+				// Point light.
+				// [FWDDEF_POINTLIGHT_LINEAR_ZDEPTH]
+				float3 lightToVertexWs = IN.v_posWS - lightPosF4.xyz;
+				float lightToVertexWsLength = length(lightToVertexWs);
+				const float shadowSampleDistanceToLight =
+				    lightShadowRange.x * texCUBE(uPointLightShadowMap, lightToVertexWs / lightToVertexWsLength).x;
+				const float currentFragmentDistanceToLight = lightToVertexWsLength;
+
+				if (shadowSampleDistanceToLight < currentFragmentDistanceToLight || NdotL <= 0.0) {
+					shadowScale = 0.f;
+				}
+			} else {
+				// Direction and Spot lights.
+				const float4 pixelShadowProj = mul(lightShadowMapProjView, float4(IN.v_posWS, 1.f));
+				const float4 pixelShadowNDC = pixelShadowProj / pixelShadowProj.w;
+
+#ifndef OpenGL
+				const float currentZ = pixelShadowNDC.z;
+#else
+				const float currentZ = (pixelShadowNDC.z + 1.0) * 0.5;
+#endif
+
+				const int numCascades = (int)lightShadowRange.y;
+				if (numCascades == 0) {
+					// The shadow map uses the whole texture.
+					const float2 uv = shadowNdcToUv(pixelShadowNDC.xy);
+					shadowScale = 1.f - sampleShadowMapPCF(lightShadowMap, uv, float2(0.0, 0.0), float2(1.0, 1.0), currentZ);
+				} else {
+					// Cascaded shadow map, pick the cascade based on the view distance.
+					const float viewDistance = dot(IN.v_posWS - cameraPositionWs.xyz, uCameraLookDirWs.xyz);
+
+					int iCascade = -1;
+					float cascadeStart = 0.f;
+					for (int t = 0; t < numCascades; t += 1) {
+						if (iCascade < 0) {
+							if (viewDistance <= getShadowCascade(t).w) {
+								iCascade = t;
+							} else {
+								cascadeStart = getShadowCascade(t).w;
+							}
+						}
+					}
+
+					// Past the last cascade there are no shadows.
+					if (iCascade >= 0) {
+						float inShadow = sampleShadowCascade(pixelShadowNDC.xy, iCascade, numCascades, currentZ);
+
+						// Blend with the next cascade at the end of the current one to hide the seam.
+						// The last cascade fades out, this hides the rough edge where the shadows end.
+						const float cascadeEnd = getShadowCascade(iCascade).w;
+						const float blendStart = cascadeEnd - (cascadeEnd - cascadeStart) * lightShadowRange.z;
+						if (viewDistance > blendStart) {
+							const float k = saturate((viewDistance - blendStart) / max(cascadeEnd - blendStart, 1e-6f));
+							float nextInShadow = 0.f;
+							if (iCascade + 1 < numCascades) {
+								nextInShadow = sampleShadowCascade(pixelShadowNDC.xy, iCascade + 1, numCascades, currentZ);
+							}
+							inShadow = lerp(inShadow, nextInShadow, k);
+						}
+
+						shadowScale = 1.f - inShadow;
+					}
+				}
+			}
+		}
+#endif // shadow map enabled
+
+		if (NdotL > 1e-6f && shadowScale > 1e-6f) {
+			// cook-torrance brdf
+#if 1
+			lighting += shadowScale * shadeGGX(N, V, L, lightRadiance, diffuseColor.xyz, metallic, roughness, F0);
+#else
+			const float3 lightLighting = shadowScale * diffuseColor.xyz * lightRadiance * NdotL;
+			lighting += lightLighting;
+#endif
+		}
+
+		if (NdotL < 0.f) {
+			const float3 ambience = lightColor * 0.5f;
+			lighting += ((normal.y * 0.5f + 0.5f) * ambience + ambience * 0.05f) * diffuseColor.xyz;
+		}
+	}
+
+#if OPT_Lighting == kLightingClustered
+	// The point and spot lights without shadows come from the cluster of the pixel.
+	if (uEvalClusteredLights != 0) {
+		const int2 cluster = libLightClusters_findCluster(
+		    IN.v_posWS, projView, cameraPositionWs.xyz, uCameraLookDirWs.xyz, uLightClustersGridSize, uLightClustersDepthParams);
+		const int2 clusterLights = libLightClusters_getClusterLights(cluster, uLightClusters);
+
+		for (int iIndex = clusterLights.x; iIndex < clusterLights.x + clusterLights.y; ++iIndex) {
+			const int iLight = libLightClusters_getLightIndex(iIndex, uLightClusterIndices);
+			const float4 clLightPosAndType = libLightClusters_fetch(uClusteredLights, 0, iLight);
+			const float4 clSpotDirAndCosAngle = libLightClusters_fetch(uClusteredLights, 1, iLight);
+			const float4 clColorAndRange = libLightClusters_fetch(uClusteredLights, 2, iLight);
+
+			// Same attenuation as the point and spot lights above.
+			const float3 toLightWs = clLightPosAndType.xyz - IN.v_posWS;
+			const float clRange2 = clColorAndRange.w * clColorAndRange.w;
+			const float k = 1.f - saturate(dot(toLightWs, toLightWs) / clRange2);
+			float attenuation = saturate(k * k);
+			const float3 clL = normalize(toLightWs);
+
+			if (clLightPosAndType.w == 2.f) {
+				const float spotLightAngleCosine = clSpotDirAndCosAngle.w;
+				const float visibilityCosine = saturate(dot(clL, -clSpotDirAndCosAngle.xyz));
+				const float c = saturate(visibilityCosine - spotLightAngleCosine);
+				attenuation *= saturate(c / (1.f - spotLightAngleCosine));
+			}
+
+			if (attenuation > 1e-6f && dot(N, clL) > 1e-6f) {
+				lighting += shadeGGX(N, V, clL, clColorAndRange.xyz * attenuation, diffuseColor.xyz, metallic, roughness, F0);
+			}
+		}
+	}
+#endif
+#endif
+
+#if (OPT_Lighting == kLightingShaded) || (OPT_Lighting == kLightingClustered)
+	const float3 ambientLightColorLinear = ambientLightColor; // pow(ambientLightColor, 2.2f);
+	const float3 fakeAmbientDetail =
+	    ((normal.y * 0.5f + 0.5f) * ambientLightColorLinear + ambientLightColorLinear * 0.05f) * diffuseColor.xyz;
+	const float3 rimLighting =
+	    smoothstep(1.f - uRimLightColorWWidth.w, 1.f, (1.f - dot(uCameraLookDirWs, N))) * diffuseColor.xyz * uRimLightColorWWidth.xyz;
+
+	float4 finalColor = float4(lighting, diffuseColor.w) + float4(fakeAmbientDetail + rimLighting, 0.f);
+#elif OPT_Lighting == kLightingForceNoLighting
+	float4 finalColor = diffuseColor;
+#else
+#error OPT_Lighting unexpected
+#endif
+
+	//// Saturate the color, to make the selection highlight visiable for really brightly lit objects.
+	//finalColor.x = saturate(finalColor.x);
+	//finalColor.y = saturate(finalColor.y);
+	//finalColor.z = saturate(finalColor.z);
+
+	// Apply tone mapping.
+	//finalColor.xyz = finalColor / (finalColor + float3(1.f, 1.f, 1.f));
+
+	// Back to linear color space.
+	finalColor.xyz = pow(finalColor, 1.0f / 2.2f);
+
+	return finalColor;
+}
+#endif
\ No newline at end of file
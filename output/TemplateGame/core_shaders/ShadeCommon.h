@@ -0,0 +1,53 @@
+//
+// A file written in C containing commonalities between C++ and HLSL
+//
+#ifndef SHADECOMMON_H
+#define SHADECOMMON_H
+
+// Settings for skinned meshes OPT_HasVertexSkinning
+#define kHasVertexSkinning_No 0
+#define kHasVertexSkinning_Yes 1
+
+// Settings for OPT_Instancing, if enabled the world transform and the tint of each instance come from a texture, see lib_instancing.shader.
+#define kInstancing_No 0
+#define kInstancing_Yes 1
+
+// The number of RGBA texels in a row of the instance data texture, see InstanceBatcher.
+#define kInstanceDataNumTexels 5
+
+// Setting for OPT_HasVertexColor, vertex color can be used as diffuse source or for tinting.
+#define kHasVertexColor_No 0
+#define kHasVertexColor_YesFloat3 1
+#define kHasVertexColor_YesFloat4 2
+
+// Settings for OPT_DiffuseColorSrc
+#define kDiffuseColorSrcConstant 0
+#define kDiffuseColorSrcVertex 1
+#define kDiffuseColorSrcTexture 2
+#define kDiffuseColorSrcTriplanarTex 3
+
+// Settings for OPT_NormalEncoding, how are the normals, tangents and binormals stored in the vertex buffer.
+#define kNormalEncoding_Float3 0
+#define kNormalEncoding_Octahedral 1 // Two components, see MeshQuantizer.
+
+// Settings for OPT_Lighting
+#define kLightingShaded 0
+#define kLightingForceNoLighting 1
+#define kLightingClustered 2 // Shaded, additionally the point and spot lights come from the light clusters, see lib_light_clusters.shader.
+
+// The number of RGBA texels in a row of the clustered lights texture, see LightClusters.
+#define kClusteredLightNumTexels 3
+// The number of light indices in a row of the clustered light indices texture, 4 indices per texel.
+#define kClusteredLightIndicesPerRow 1024
+
+// Lights flags encoded as float use up to 23
+// These are going to be casted as float in the shader BTW.
+#define kLightFlt_DontLight 1 // user for objects that have no light affecting them besides the amibient one.
+#define kLightFlg_HasShadowMap 2
+
+// Material flags.
+#define kPBRMtl_Flags_HasNormalMap 1
+#define kPBRMtl_Flags_HasMetalnessMap 2
+#define kPBRMtl_Flags_HasRoughnessMap 4
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef SGE_LIB_LIGHT_CLUSTERS
+#define SGE_LIB_LIGHT_CLUSTERS
+
+/// The view frustum is split into clusters, numTilesX * numTilesY tiles on the screen and numSlices depth slices, see LightClusters.
+/// The data of the clusters comes in three textures:
+///   - clusters: a texel per cluster, a row per slice. x is the first index of the cluster lights in the indices texture, y is their count;
+///   - indices: the indices of the lights of all clusters, 4 per texel, kClusteredLightIndicesPerRow per row;
+///   - lights: a row of kClusteredLightNumTexels texels for each light:
+///     (position, type), (spot direction, spot cos angle), (color, range).
+
+/// Fetches a single texel of a point sampled texture.
+float4 libLightClusters_fetch(sampler2D tex, int x, int y) {
+	const float2 texSize = float2((float)(tex2Dsize(tex).x), (float)(tex2Dsize(tex).y));
+	return tex2Dlod(tex, float4(((float)x + 0.5f) / texSize.x, ((float)y + 0.5f) / texSize.y, 0.f, 0.f));
+}
+
+/// Finds the cluster containing the specified world space position.
+/// Returns the texel of the cluster in the clusters texture, x is the tile, y is the slice.
+/// @param gridSize (numTilesX, numTilesY, numSlices) of the clusters.
+/// @param depthParams the parameters of the slices, the slice for a depth d is floor(log(d) * depthParams.z - depthParams.w).
+int2 libLightClusters_findCluster(float3 posWs, float4x4 projView, float3 cameraPosWs, float3 cameraLookDirWs, float4 gridSize, float4 depthParams) {
+	const float4 posClip = mul(projView, float4(posWs, 1.f));
+	const float2 posNdc = posClip.xy / posClip.w;
+	const float2 tile = clamp(floor((posNdc * 0.5f + float2(0.5f, 0.5f)) * gridSize.xy), float2(0.f, 0.f), gridSize.xy - float2(1.f, 1.f));
+
+	const float depth = max(dot(posWs - cameraPosWs, cameraLookDirWs), depthParams.x);
+	const float slice = clamp(floor(log(depth) * depthParams.z - depthParams.w), 0.f, gridSize.z - 1.f);
+
+	return int2((int)(tile.x + tile.y * gridSize.x), (int)slice);
+}
+
+/// Retrieves the lights of a cluster, x is the first index in the indices texture, y is the number of lights.
+int2 libLightClusters_getClusterLights(int2 cluster, sampler2D clustersTex) {
+	const float4 texel = libLightClusters_fetch(clustersTex, cluster.x, cluster.y);
+	return int2((int)(texel.x + 0.5f), (int)(texel.y + 0.5f));
+}
+
+/// Retrieves the index of a light (the row in the lights texture) stored at @index in the indices texture.
+int libLightClusters_getLightIndex(int index, sampler2D indicesTex) {
+	const int numTexelsPerRow = kClusteredLightIndicesPerRow / 4;
+	const int iTexel = index / 4;
+	const int iRow = iTexel / numTexelsPerRow;
+	const float4 texel = libLightClusters_fetch(indicesTex, iTexel - iRow * numTexelsPerRow, iRow);
+
+	const int component = index - iTexel * 4;
+	float indexAsFloat = texel.w;
+	if (component == 0) {
+		indexAsFloat = texel.x;
+	} else if (component == 1) {
+		indexAsFloat = texel.y;
+	} else if (component == 2) {
+		indexAsFloat = texel.z;
+	}
+
+	return (int)(indexAsFloat + 0.5f);
+}
+
+#endif
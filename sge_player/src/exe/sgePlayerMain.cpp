@@ -32,6 +32,7 @@ __declspec(dllexport) int AmdPowerXpressRequestHighPerformance = 1;
 #include "sge_utils/utils/Path.h"
 #include "sge_utils/utils/json.h"
 
+#include <cstring>
 #include <filesystem>
 #include <thread>
 
@@ -277,6 +278,10 @@ int main(int argc, char* argv[]) {
 	SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
 
 #else
+#ifdef SGE_RENDERER_NULL
+	// The null renderer doesn't need a real window, unless specified otherwise use the SDL driver that doesn't need a display.
+	SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+#endif
 	SDL_Init(SDL_INIT_EVERYTHING);
 #ifdef SGE_RENDERER_GL
 	SDL_SetHint(SDL_HINT_RENDER_DRIVER, "opengl");
@@ -314,8 +319,22 @@ int main(int argc, char* argv[]) {
 #ifdef __EMSCRIPTEN__
 	emscripten_set_main_loop(main_loop, 0, true);
 #else
+	// "--num-frames N" stops the game after N frames, useful for automated runs (benchmarks, CI).
+	int numFramesToRun = -1;
+	for (int iArg = 1; iArg + 1 < argc; ++iArg) {
+		if (strcmp(argv[iArg], "--num-frames") == 0) {
+			numFramesToRun = atoi(argv[iArg + 1]);
+		}
+	}
+
+	int numFramesRan = 0;
 	while (sge::ApplicationHandler::get()->shouldStopRunning() == false) {
 		main_loop();
+
+		numFramesRan++;
+		if (numFramesToRun >= 0 && numFramesRan >= numFramesToRun) {
+			break;
+		}
 	};
 #endif
 